@@ -46,7 +46,7 @@ export default class AMCApplicationItem_Content_ParameterList extends Common.AMC
 		// TODO: check validity
 		this.headers = itemJSON.headers;
 		
-		this.stateid = 1;
+		this.stateid = 0;
 		
 		this.loadingtext = "";
 		this.entriesperpage = 25;
@@ -68,15 +68,38 @@ export default class AMCApplicationItem_Content_ParameterList extends Common.AMC
 		if (updateJSON.entriesperpage)
 			this.entriesperpage = Assert.IntegerValue (updateJSON.entriesperpage);
 
-		let oldEntryCount = this.entries.length;
-		for (let index = 0; index < oldEntryCount; index++) {
-			this.entries.pop();
-		}
+		// Delta updates only contain the entries that changed since the state id of the last update
+		if (updateJSON.isdelta && Number.isInteger (updateJSON.entrycount)) {
+			
+			while (this.entries.length > updateJSON.entrycount) {
+				this.entries.pop();
+			}
+			
+			for (let entry of updateJSON.entries) {
+				let entryIndex = Assert.IntegerValue (entry.entryindex);
+				if (entryIndex < this.entries.length) {
+					this.entries.splice (entryIndex, 1, entry);
+				} else {
+					this.entries.push(entry);
+				}
+			}
+			
+		} else {
+		
+			let oldEntryCount = this.entries.length;
+			for (let index = 0; index < oldEntryCount; index++) {
+				this.entries.pop();
+			}
 
-		for (let entry of updateJSON.entries) {
-			this.entries.push(entry);
+			for (let entry of updateJSON.entries) {
+				this.entries.push(entry);
+			}
+			
 		}
 		
+		if (Number.isInteger (updateJSON.stateid))
+			this.stateid = updateJSON.stateid;
+		
 	}
 	
 }
\ No newline at end of file
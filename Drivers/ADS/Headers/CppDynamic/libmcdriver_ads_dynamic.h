@@ -265,6 +265,30 @@ typedef LibMCDriver_ADSResult (*PLibMCDriver_ADSDriver_ADS_WriteStringValuePtr)
 */
 typedef LibMCDriver_ADSResult (*PLibMCDriver_ADSDriver_ADS_GetVariableBoundsPtr) (LibMCDriver_ADS_Driver_ADS pDriver_ADS, const char * pVariableName, LibMCDriver_ADS_int64 * pMinValue, LibMCDriver_ADS_int64 * pMaxValue);
 
+/**
+* Starts a write batch. Subsequent write calls are queued and sent with a single ADS sum command on CommitWriteBatch.
+*
+* @param[in] pDriver_ADS - Driver_ADS instance.
+* @return error code or 0 (success)
+*/
+typedef LibMCDriver_ADSResult (*PLibMCDriver_ADSDriver_ADS_BeginWriteBatchPtr) (LibMCDriver_ADS_Driver_ADS pDriver_ADS);
+
+/**
+* Sends all queued writes of the current write batch to the PLC and ends the batch. Fails if any of the writes failed.
+*
+* @param[in] pDriver_ADS - Driver_ADS instance.
+* @return error code or 0 (success)
+*/
+typedef LibMCDriver_ADSResult (*PLibMCDriver_ADSDriver_ADS_CommitWriteBatchPtr) (LibMCDriver_ADS_Driver_ADS pDriver_ADS);
+
+/**
+* Drops all queued writes of the current write batch and ends the batch.
+*
+* @param[in] pDriver_ADS - Driver_ADS instance.
+* @return error code or 0 (success)
+*/
+typedef LibMCDriver_ADSResult (*PLibMCDriver_ADSDriver_ADS_DiscardWriteBatchPtr) (LibMCDriver_ADS_Driver_ADS pDriver_ADS);
+
 /*************************************************************************************************************************
  Global functions
 **************************************************************************************************************************/
@@ -362,6 +386,9 @@ typedef struct {
 	PLibMCDriver_ADSDriver_ADS_ReadStringValuePtr m_Driver_ADS_ReadStringValue;
 	PLibMCDriver_ADSDriver_ADS_WriteStringValuePtr m_Driver_ADS_WriteStringValue;
 	PLibMCDriver_ADSDriver_ADS_GetVariableBoundsPtr m_Driver_ADS_GetVariableBounds;
+	PLibMCDriver_ADSDriver_ADS_BeginWriteBatchPtr m_Driver_ADS_BeginWriteBatch;
+	PLibMCDriver_ADSDriver_ADS_CommitWriteBatchPtr m_Driver_ADS_CommitWriteBatch;
+	PLibMCDriver_ADSDriver_ADS_DiscardWriteBatchPtr m_Driver_ADS_DiscardWriteBatch;
 	PLibMCDriver_ADSGetVersionPtr m_GetVersion;
 	PLibMCDriver_ADSGetLastErrorPtr m_GetLastError;
 	PLibMCDriver_ADSReleaseInstancePtr m_ReleaseInstance;
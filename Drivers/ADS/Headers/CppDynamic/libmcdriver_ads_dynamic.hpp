@@ -1,4 +1,28 @@
 /*++
+	/**
+	* CDriver_ADS::BeginWriteBatch - Starts a write batch. Subsequent write calls are queued and sent with a single ADS sum command on CommitWriteBatch.
+	*/
+	void CDriver_ADS::BeginWriteBatch()
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_Driver_ADS_BeginWriteBatch(m_pHandle));
+	}
+	
+	/**
+	* CDriver_ADS::CommitWriteBatch - Sends all queued writes of the current write batch to the PLC and ends the batch. Fails if any of the writes failed.
+	*/
+	void CDriver_ADS::CommitWriteBatch()
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_Driver_ADS_CommitWriteBatch(m_pHandle));
+	}
+	
+	/**
+	* CDriver_ADS::DiscardWriteBatch - Drops all queued writes of the current write batch and ends the batch.
+	*/
+	void CDriver_ADS::DiscardWriteBatch()
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_Driver_ADS_DiscardWriteBatch(m_pHandle));
+	}
+	
 
 Copyright (C) 2020 Autodesk Inc.
 
@@ -207,6 +231,10 @@ public:
 			case LIBMCDRIVER_ADS_ERROR_STRINGLENGTHMISSING: return "STRINGLENGTHMISSING";
 			case LIBMCDRIVER_ADS_ERROR_INVALIDSTRINGLENGTH: return "INVALIDSTRINGLENGTH";
 			case LIBMCDRIVER_ADS_ERROR_INVALIDADSSDKRESOURCE: return "INVALIDADSSDKRESOURCE";
+			case LIBMCDRIVER_ADS_ERROR_INVALIDSUMCOMMANDRESPONSE: return "INVALIDSUMCOMMANDRESPONSE";
+			case LIBMCDRIVER_ADS_ERROR_SUMCOMMANDFAILED: return "SUMCOMMANDFAILED";
+			case LIBMCDRIVER_ADS_ERROR_WRITEBATCHALREADYACTIVE: return "WRITEBATCHALREADYACTIVE";
+			case LIBMCDRIVER_ADS_ERROR_NOWRITEBATCHACTIVE: return "NOWRITEBATCHACTIVE";
 		}
 		return "UNKNOWN";
 	}
@@ -256,6 +284,10 @@ public:
 			case LIBMCDRIVER_ADS_ERROR_STRINGLENGTHMISSING: return "string length missing";
 			case LIBMCDRIVER_ADS_ERROR_INVALIDSTRINGLENGTH: return "invalid string length";
 			case LIBMCDRIVER_ADS_ERROR_INVALIDADSSDKRESOURCE: return "invalid ads sdk resource";
+			case LIBMCDRIVER_ADS_ERROR_INVALIDSUMCOMMANDRESPONSE: return "invalid sum command response";
+			case LIBMCDRIVER_ADS_ERROR_SUMCOMMANDFAILED: return "sum command failed";
+			case LIBMCDRIVER_ADS_ERROR_WRITEBATCHALREADYACTIVE: return "write batch already active";
+			case LIBMCDRIVER_ADS_ERROR_NOWRITEBATCHACTIVE: return "no write batch active";
 		}
 		return "unknown error";
 	}
@@ -636,6 +668,9 @@ public:
 		pWrapperTable->m_Driver_ADS_ReadStringValue = nullptr;
 		pWrapperTable->m_Driver_ADS_WriteStringValue = nullptr;
 		pWrapperTable->m_Driver_ADS_GetVariableBounds = nullptr;
+		pWrapperTable->m_Driver_ADS_BeginWriteBatch = nullptr;
+		pWrapperTable->m_Driver_ADS_CommitWriteBatch = nullptr;
+		pWrapperTable->m_Driver_ADS_DiscardWriteBatch = nullptr;
 		pWrapperTable->m_GetVersion = nullptr;
 		pWrapperTable->m_GetLastError = nullptr;
 		pWrapperTable->m_ReleaseInstance = nullptr;
@@ -882,6 +917,33 @@ public:
 		if (pWrapperTable->m_Driver_ADS_GetVariableBounds == nullptr)
 			return LIBMCDRIVER_ADS_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		#ifdef _WIN32
+		pWrapperTable->m_Driver_ADS_BeginWriteBatch = (PLibMCDriver_ADSDriver_ADS_BeginWriteBatchPtr) GetProcAddress(hLibrary, "libmcdriver_ads_driver_ads_beginwritebatch");
+		#else // _WIN32
+		pWrapperTable->m_Driver_ADS_BeginWriteBatch = (PLibMCDriver_ADSDriver_ADS_BeginWriteBatchPtr) dlsym(hLibrary, "libmcdriver_ads_driver_ads_beginwritebatch");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Driver_ADS_BeginWriteBatch == nullptr)
+			return LIBMCDRIVER_ADS_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_Driver_ADS_CommitWriteBatch = (PLibMCDriver_ADSDriver_ADS_CommitWriteBatchPtr) GetProcAddress(hLibrary, "libmcdriver_ads_driver_ads_commitwritebatch");
+		#else // _WIN32
+		pWrapperTable->m_Driver_ADS_CommitWriteBatch = (PLibMCDriver_ADSDriver_ADS_CommitWriteBatchPtr) dlsym(hLibrary, "libmcdriver_ads_driver_ads_commitwritebatch");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Driver_ADS_CommitWriteBatch == nullptr)
+			return LIBMCDRIVER_ADS_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_Driver_ADS_DiscardWriteBatch = (PLibMCDriver_ADSDriver_ADS_DiscardWriteBatchPtr) GetProcAddress(hLibrary, "libmcdriver_ads_driver_ads_discardwritebatch");
+		#else // _WIN32
+		pWrapperTable->m_Driver_ADS_DiscardWriteBatch = (PLibMCDriver_ADSDriver_ADS_DiscardWriteBatchPtr) dlsym(hLibrary, "libmcdriver_ads_driver_ads_discardwritebatch");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Driver_ADS_DiscardWriteBatch == nullptr)
+			return LIBMCDRIVER_ADS_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		#ifdef _WIN32
 		pWrapperTable->m_GetVersion = (PLibMCDriver_ADSGetVersionPtr) GetProcAddress(hLibrary, "libmcdriver_ads_getversion");
 		#else // _WIN32
@@ -1045,6 +1107,18 @@ public:
 		if ( (eLookupError != 0) || (pWrapperTable->m_Driver_ADS_GetVariableBounds == nullptr) )
 			return LIBMCDRIVER_ADS_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		eLookupError = (*pLookup)("libmcdriver_ads_driver_ads_beginwritebatch", (void**)&(pWrapperTable->m_Driver_ADS_BeginWriteBatch));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Driver_ADS_BeginWriteBatch == nullptr) )
+			return LIBMCDRIVER_ADS_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libmcdriver_ads_driver_ads_commitwritebatch", (void**)&(pWrapperTable->m_Driver_ADS_CommitWriteBatch));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Driver_ADS_CommitWriteBatch == nullptr) )
+			return LIBMCDRIVER_ADS_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libmcdriver_ads_driver_ads_discardwritebatch", (void**)&(pWrapperTable->m_Driver_ADS_DiscardWriteBatch));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Driver_ADS_DiscardWriteBatch == nullptr) )
+			return LIBMCDRIVER_ADS_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		eLookupError = (*pLookup)("libmcdriver_ads_getversion", (void**)&(pWrapperTable->m_GetVersion));
 		if ( (eLookupError != 0) || (pWrapperTable->m_GetVersion == nullptr) )
 			return LIBMCDRIVER_ADS_ERROR_COULDNOTFINDLIBRARYEXPORT;
@@ -1334,3 +1408,6 @@ public:
 
 #endif // __LIBMCDRIVER_ADS_CPPHEADER_DYNAMIC_CPP
 
+	inline void BeginWriteBatch();
+	inline void CommitWriteBatch();
+	inline void DiscardWriteBatch();
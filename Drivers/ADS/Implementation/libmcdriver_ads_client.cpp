@@ -39,7 +39,7 @@ using namespace LibMCDriver_ADS::Impl;
 
 
 CADSClientConnection::CADSClientConnection(PADSSDK pSDK, AdsPort nPort, sAmsAddr localAddress)
-	: m_pSDK(pSDK), m_Port(nPort), m_LocalAddress(localAddress)
+	: m_pSDK(pSDK), m_Port(nPort), m_LocalAddress(localAddress), m_bWriteBatchIsActive(false)
 {
 	if (pSDK.get() == nullptr)
 		throw ELibMCDriver_ADSInterfaceException(LIBMCDRIVER_ADS_ERROR_INVALIDPARAM);
@@ -66,6 +66,8 @@ sAmsAddr* CADSClientConnection::getAddressP()
 
 void CADSClientConnection::disconnect()
 {
+	discardWriteBatch();
+
 	if (m_pSDK.get() != nullptr)
 	{
 		auto pSDK = m_pSDK;
@@ -81,9 +83,150 @@ void CADSClientConnection::disconnect()
 	memset((void*)&m_LocalAddress, sizeof(m_LocalAddress), 0);
 }
 
+void CADSClientConnection::sumReadByHandles(const std::vector<uint32_t>& Handles, const std::vector<uint32_t>& Lengths, std::vector<uint8_t>& Data, std::vector<uint32_t>& ErrorCodes)
+{
+	if (Handles.size() != Lengths.size())
+		throw ELibMCDriver_ADSInterfaceException(LIBMCDRIVER_ADS_ERROR_INVALIDPARAM);
+	if (Handles.size() > ADS_MAXSUMCOMMANDCOUNT)
+		throw ELibMCDriver_ADSInterfaceException(LIBMCDRIVER_ADS_ERROR_INVALIDPARAM);
+
+	Data.clear();
+	ErrorCodes.clear();
+
+	uint32_t nCount = (uint32_t)Handles.size();
+	if (nCount == 0)
+		return;
+
+	std::vector<sAdsSumRequestHeader> requestHeaders;
+	requestHeaders.resize(nCount);
+
+	uint64_t nTotalDataLength = 0;
+	for (uint32_t nIndex = 0; nIndex < nCount; nIndex++) {
+		requestHeaders[nIndex].m_nIndexGroup = ADSIGRP_SYM_VALBYHND;
+		requestHeaders[nIndex].m_nIndexOffset = Handles[nIndex];
+		requestHeaders[nIndex].m_nLength = Lengths[nIndex];
+		nTotalDataLength += Lengths[nIndex];
+	}
+
+	// Response consists of one error code per sub command, followed by all values
+	uint64_t nResponseLength = (uint64_t)nCount * sizeof(uint32_t) + nTotalDataLength;
+	if (nResponseLength > UINT32_MAX)
+		throw ELibMCDriver_ADSInterfaceException(LIBMCDRIVER_ADS_ERROR_INVALIDPARAM);
+
+	std::vector<uint8_t> responseBuffer;
+	responseBuffer.resize((size_t)nResponseLength);
+
+	auto pSDK = getSDK();
+	uint32_t nBytesRead = 0;
+	pSDK->checkError(pSDK->AdsSyncReadWriteReqEx2(m_Port, &m_LocalAddress, ADSIGRP_SUMUP_READ, nCount,
+		(uint32_t)nResponseLength, responseBuffer.data(), (uint32_t)(nCount * sizeof(sAdsSumRequestHeader)), requestHeaders.data(), &nBytesRead));
+
+	if (nBytesRead != (uint32_t)nResponseLength)
+		throw ELibMCDriver_ADSInterfaceException(LIBMCDRIVER_ADS_ERROR_INVALIDSUMCOMMANDRESPONSE, "invalid sum read response length: " + std::to_string(nBytesRead));
+
+	ErrorCodes.resize(nCount);
+	memcpy(ErrorCodes.data(), responseBuffer.data(), nCount * sizeof(uint32_t));
+
+	Data.resize((size_t)nTotalDataLength);
+	if (nTotalDataLength > 0)
+		memcpy(Data.data(), responseBuffer.data() + nCount * sizeof(uint32_t), (size_t)nTotalDataLength);
+}
+
+void CADSClientConnection::beginWriteBatch()
+{
+	if (m_bWriteBatchIsActive)
+		throw ELibMCDriver_ADSInterfaceException(LIBMCDRIVER_ADS_ERROR_WRITEBATCHALREADYACTIVE);
+
+	m_QueuedWriteHeaders.clear();
+	m_QueuedWriteData.clear();
+	m_bWriteBatchIsActive = true;
+}
+
+bool CADSClientConnection::writeBatchIsActive()
+{
+	return m_bWriteBatchIsActive;
+}
+
+void CADSClientConnection::queueWriteByHandle(uint32_t nHandle, const void* pData, uint32_t nLength)
+{
+	if (!m_bWriteBatchIsActive)
+		throw ELibMCDriver_ADSInterfaceException(LIBMCDRIVER_ADS_ERROR_NOWRITEBATCHACTIVE);
+	if ((pData == nullptr) || (nLength == 0))
+		throw ELibMCDriver_ADSInterfaceException(LIBMCDRIVER_ADS_ERROR_INVALIDPARAM);
+
+	sAdsSumRequestHeader header;
+	header.m_nIndexGroup = ADSIGRP_SYM_VALBYHND;
+	header.m_nIndexOffset = nHandle;
+	header.m_nLength = nLength;
+	m_QueuedWriteHeaders.push_back(header);
+
+	const uint8_t* pBytes = (const uint8_t*)pData;
+	m_QueuedWriteData.insert(m_QueuedWriteData.end(), pBytes, pBytes + nLength);
+}
+
+void CADSClientConnection::commitWriteBatch()
+{
+	if (!m_bWriteBatchIsActive)
+		throw ELibMCDriver_ADSInterfaceException(LIBMCDRIVER_ADS_ERROR_NOWRITEBATCHACTIVE);
+
+	std::vector<sAdsSumRequestHeader> queuedHeaders;
+	std::vector<uint8_t> queuedData;
+	queuedHeaders.swap(m_QueuedWriteHeaders);
+	queuedData.swap(m_QueuedWriteData);
+	m_bWriteBatchIsActive = false;
+
+	auto pSDK = getSDK();
+
+	size_t nHeaderIndex = 0;
+	size_t nDataOffset = 0;
+	while (nHeaderIndex < queuedHeaders.size()) {
+
+		size_t nChunkCount = queuedHeaders.size() - nHeaderIndex;
+		if (nChunkCount > ADS_MAXSUMCOMMANDCOUNT)
+			nChunkCount = ADS_MAXSUMCOMMANDCOUNT;
+
+		size_t nChunkDataLength = 0;
+		for (size_t nIndex = 0; nIndex < nChunkCount; nIndex++)
+			nChunkDataLength += queuedHeaders[nHeaderIndex + nIndex].m_nLength;
+
+		// Request consists of all sub command headers, followed by all values
+		size_t nHeaderLength = nChunkCount * sizeof(sAdsSumRequestHeader);
+		std::vector<uint8_t> requestBuffer;
+		requestBuffer.resize(nHeaderLength + nChunkDataLength);
+		memcpy(requestBuffer.data(), &queuedHeaders[nHeaderIndex], nHeaderLength);
+		if (nChunkDataLength > 0)
+			memcpy(requestBuffer.data() + nHeaderLength, queuedData.data() + nDataOffset, nChunkDataLength);
+
+		std::vector<uint32_t> errorCodes;
+		errorCodes.resize(nChunkCount);
+
+		uint32_t nBytesRead = 0;
+		pSDK->checkError(pSDK->AdsSyncReadWriteReqEx2(m_Port, &m_LocalAddress, ADSIGRP_SUMUP_WRITE, (uint32_t)nChunkCount,
+			(uint32_t)(nChunkCount * sizeof(uint32_t)), errorCodes.data(), (uint32_t)requestBuffer.size(), requestBuffer.data(), &nBytesRead));
+
+		if (nBytesRead != (uint32_t)(nChunkCount * sizeof(uint32_t)))
+			throw ELibMCDriver_ADSInterfaceException(LIBMCDRIVER_ADS_ERROR_INVALIDSUMCOMMANDRESPONSE, "invalid sum write response length: " + std::to_string(nBytesRead));
+
+		for (size_t nIndex = 0; nIndex < nChunkCount; nIndex++) {
+			if (errorCodes[nIndex] != 0)
+				throw ELibMCDriver_ADSInterfaceException(LIBMCDRIVER_ADS_ERROR_SUMCOMMANDFAILED, "sum write failed for handle " + std::to_string(queuedHeaders[nHeaderIndex + nIndex].m_nIndexOffset) + ": ADS Error " + std::to_string(errorCodes[nIndex]));
+		}
+
+		nHeaderIndex += nChunkCount;
+		nDataOffset += nChunkDataLength;
+	}
+}
+
+void CADSClientConnection::discardWriteBatch()
+{
+	m_QueuedWriteHeaders.clear();
+	m_QueuedWriteData.clear();
+	m_bWriteBatchIsActive = false;
+}
+
 
 CADSClientVariable::CADSClientVariable(PADSClientConnection pConnection, const std::string& sName, uint32_t Handle)
-	: m_pConnection(pConnection), m_sName(sName), m_Handle(Handle)
+	: m_pConnection(pConnection), m_sName(sName), m_Handle(Handle), m_bHasPrefetchedData(false)
 {
 	if (pConnection.get() == nullptr)
 		throw ELibMCDriver_ADSInterfaceException(LIBMCDRIVER_ADS_ERROR_INVALIDPARAM);
@@ -101,6 +244,26 @@ std::string CADSClientVariable::getName()
 	return m_sName;
 }
 
+uint32_t CADSClientVariable::getHandle()
+{
+	return m_Handle;
+}
+
+void CADSClientVariable::setPrefetchedData(const uint8_t* pData, uint32_t nLength)
+{
+	if ((pData == nullptr) || (nLength == 0))
+		throw ELibMCDriver_ADSInterfaceException(LIBMCDRIVER_ADS_ERROR_INVALIDPARAM);
+
+	m_PrefetchedData.resize(nLength);
+	memcpy(m_PrefetchedData.data(), pData, nLength);
+	m_bHasPrefetchedData = true;
+}
+
+void CADSClientVariable::clearPrefetchedData()
+{
+	m_bHasPrefetchedData = false;
+}
+
 
 void CADSClientVariable::readBuffer(void* pData, uint32_t nLength)
 {
@@ -109,6 +272,14 @@ void CADSClientVariable::readBuffer(void* pData, uint32_t nLength)
 	if (nLength == 0)
 		throw ELibMCDriver_ADSInterfaceException(LIBMCDRIVER_ADS_ERROR_INVALIDPARAM);
 
+	if (m_bHasPrefetchedData) {
+		m_bHasPrefetchedData = false;
+		if (m_PrefetchedData.size() == nLength) {
+			memcpy(pData, m_PrefetchedData.data(), nLength);
+			return;
+		}
+	}
+
 	auto pSDK = m_pConnection->getSDK();
 
 	uint32_t bytesRead = 0;
@@ -126,6 +297,14 @@ void CADSClientVariable::writeBuffer(void* pData, uint32_t nLength)
 	if (nLength == 0)
 		throw ELibMCDriver_ADSInterfaceException(LIBMCDRIVER_ADS_ERROR_INVALIDPARAM);
 
+	// A pending prefetched value is outdated by the write
+	m_bHasPrefetchedData = false;
+
+	if (m_pConnection->writeBatchIsActive()) {
+		m_pConnection->queueWriteByHandle(m_Handle, pData, nLength);
+		return;
+	}
+
 	auto pSDK = m_pConnection->getSDK();
 
 	pSDK->checkError(pSDK->AdsSyncWriteReqEx(m_pConnection->getPort(), m_pConnection->getAddressP(), ADSIGRP_SYM_VALBYHND, m_Handle, nLength, pData));
@@ -144,6 +323,11 @@ CADSClientStringVariable::~CADSClientStringVariable()
 {
 }
 
+uint32_t CADSClientStringVariable::getValueSize()
+{
+	return (uint32_t)m_nStringSize;
+}
+
 std::string CADSClientStringVariable::readValueFromPLC()
 {
 	std::vector<char> buffer;
@@ -206,6 +390,11 @@ CADSClientInt8Variable::~CADSClientInt8Variable()
 
 }
 
+uint32_t CADSClientInt8Variable::getValueSize()
+{
+	return sizeof(int8_t);
+}
+
 CADSClientBoolVariable::CADSClientBoolVariable(PADSClientConnection pConnection, const std::string& sName, uint32_t Handle)
 	: CADSClientIntegerVariable(pConnection, sName, Handle)
 {
@@ -217,6 +406,11 @@ CADSClientBoolVariable::~CADSClientBoolVariable()
 
 }
 
+uint32_t CADSClientBoolVariable::getValueSize()
+{
+	return sizeof(bool);
+}
+
 int64_t CADSClientBoolVariable::readValueFromPLC()
 {
 	bool nValue = 0;
@@ -293,6 +487,11 @@ CADSClientUint8Variable::~CADSClientUint8Variable()
 
 }
 
+uint32_t CADSClientUint8Variable::getValueSize()
+{
+	return sizeof(uint8_t);
+}
+
 int64_t CADSClientUint8Variable::readValueFromPLC()
 {
 	uint8_t nValue = 0;
@@ -326,6 +525,11 @@ CADSClientInt16Variable::~CADSClientInt16Variable()
 
 }
 
+uint32_t CADSClientInt16Variable::getValueSize()
+{
+	return sizeof(int16_t);
+}
+
 
 int64_t CADSClientInt16Variable::readValueFromPLC()
 {
@@ -360,6 +564,11 @@ CADSClientUint16Variable::~CADSClientUint16Variable()
 
 }
 
+uint32_t CADSClientUint16Variable::getValueSize()
+{
+	return sizeof(uint16_t);
+}
+
 int64_t CADSClientUint16Variable::readValueFromPLC()
 {
 	uint16_t nValue = 0;
@@ -393,6 +602,11 @@ CADSClientInt32Variable::~CADSClientInt32Variable()
 
 }
 
+uint32_t CADSClientInt32Variable::getValueSize()
+{
+	return sizeof(int32_t);
+}
+
 
 int64_t CADSClientInt32Variable::readValueFromPLC()
 {
@@ -427,6 +641,11 @@ CADSClientUint32Variable::~CADSClientUint32Variable()
 
 }
 
+uint32_t CADSClientUint32Variable::getValueSize()
+{
+	return sizeof(uint32_t);
+}
+
 int64_t CADSClientUint32Variable::readValueFromPLC()
 {
 	uint32_t nValue = 0;
@@ -462,6 +681,11 @@ CADSClientFloat32Variable::~CADSClientFloat32Variable()
 
 }
 
+uint32_t CADSClientFloat32Variable::getValueSize()
+{
+	return sizeof(float);
+}
+
 
 double CADSClientFloat32Variable::readValueFromPLC()
 {
@@ -487,6 +711,11 @@ CADSClientFloat64Variable::~CADSClientFloat64Variable()
 
 }
 
+uint32_t CADSClientFloat64Variable::getValueSize()
+{
+	return sizeof(double);
+}
+
 
 double CADSClientFloat64Variable::readValueFromPLC()
 {
@@ -690,6 +919,85 @@ void CADSClient::registerVariable(PADSClientVariable pVariable)
 	m_VariableMap.insert(std::make_pair(pVariable->getName(), pVariable));
 }
 
+void CADSClient::prefetchVariables(const std::vector<CADSClientVariable*>& Variables)
+{
+	if (m_pCurrentConnection.get() == nullptr)
+		throw ELibMCDriver_ADSInterfaceException(LIBMCDRIVER_ADS_ERROR_NOTCONNECTED);
+
+	size_t nStartIndex = 0;
+	while (nStartIndex < Variables.size()) {
+
+		size_t nChunkCount = Variables.size() - nStartIndex;
+		if (nChunkCount > ADS_MAXSUMCOMMANDCOUNT)
+			nChunkCount = ADS_MAXSUMCOMMANDCOUNT;
+
+		std::vector<uint32_t> handles;
+		std::vector<uint32_t> lengths;
+		handles.reserve(nChunkCount);
+		lengths.reserve(nChunkCount);
+
+		for (size_t nIndex = 0; nIndex < nChunkCount; nIndex++) {
+			auto pVariable = Variables[nStartIndex + nIndex];
+			if (pVariable == nullptr)
+				throw ELibMCDriver_ADSInterfaceException(LIBMCDRIVER_ADS_ERROR_INVALIDPARAM);
+
+			handles.push_back(pVariable->getHandle());
+			lengths.push_back(pVariable->getValueSize());
+		}
+
+		std::vector<uint8_t> data;
+		std::vector<uint32_t> errorCodes;
+		try {
+			m_pCurrentConnection->sumReadByHandles(handles, lengths, data, errorCodes);
+		}
+		catch (ELibMCDriver_ADSInterfaceException&) {
+			// The PLC rejected the sum read as a whole (e.g. an older runtime without ADSIGRP_SUMUP_READ).
+			// The variables of this chunk stay without prefetched data and are read one by one.
+			nStartIndex += nChunkCount;
+			continue;
+		}
+
+		// Variables with an error code are not prefetched, their next read reports the error individually
+		size_t nDataOffset = 0;
+		for (size_t nIndex = 0; nIndex < nChunkCount; nIndex++) {
+			if (errorCodes[nIndex] == 0)
+				Variables[nStartIndex + nIndex]->setPrefetchedData(data.data() + nDataOffset, lengths[nIndex]);
+
+			nDataOffset += lengths[nIndex];
+		}
+
+		nStartIndex += nChunkCount;
+	}
+}
+
+void CADSClient::clearPrefetchedData()
+{
+	for (auto pVariable : m_Variables)
+		pVariable->clearPrefetchedData();
+}
+
+void CADSClient::beginWriteBatch()
+{
+	if (m_pCurrentConnection.get() == nullptr)
+		throw ELibMCDriver_ADSInterfaceException(LIBMCDRIVER_ADS_ERROR_NOTCONNECTED);
+
+	m_pCurrentConnection->beginWriteBatch();
+}
+
+void CADSClient::commitWriteBatch()
+{
+	if (m_pCurrentConnection.get() == nullptr)
+		throw ELibMCDriver_ADSInterfaceException(LIBMCDRIVER_ADS_ERROR_NOTCONNECTED);
+
+	m_pCurrentConnection->commitWriteBatch();
+}
+
+void CADSClient::discardWriteBatch()
+{
+	if (m_pCurrentConnection.get() != nullptr)
+		m_pCurrentConnection->discardWriteBatch();
+}
+
 CADSClientVariable* CADSClient::findVariable(const std::string& sName, bool bFailIfNotExisting)
 {
 	auto iIter = m_VariableMap.find(sName);
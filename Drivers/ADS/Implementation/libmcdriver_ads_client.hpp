@@ -50,6 +50,10 @@ namespace LibMCDriver_ADS {
 			AdsPort m_Port;
 			sAmsAddr m_LocalAddress;
 
+			bool m_bWriteBatchIsActive;
+			std::vector<sAdsSumRequestHeader> m_QueuedWriteHeaders;
+			std::vector<uint8_t> m_QueuedWriteData;
+
 		public:
 			CADSClientConnection(PADSSDK pSDK, AdsPort nPort, sAmsAddr localAddress);
 
@@ -58,6 +62,17 @@ namespace LibMCDriver_ADS {
 			sAmsAddr* getAddressP();
 
 			void disconnect();
+
+			// Reads the values of several handles with ADS sum commands. Data receives the values back to back,
+			// ErrorCodes receives one ADS error code per handle. At most ADS_MAXSUMCOMMANDCOUNT handles per round trip.
+			void sumReadByHandles(const std::vector<uint32_t>& Handles, const std::vector<uint32_t>& Lengths, std::vector<uint8_t>& Data, std::vector<uint32_t>& ErrorCodes);
+
+			// While a write batch is active, writes by handle are queued and sent with ADS sum commands on commit.
+			void beginWriteBatch();
+			bool writeBatchIsActive();
+			void queueWriteByHandle(uint32_t nHandle, const void* pData, uint32_t nLength);
+			void commitWriteBatch();
+			void discardWriteBatch();
 		};
 
 		typedef std::shared_ptr<CADSClientConnection> PADSClientConnection;
@@ -68,8 +83,12 @@ namespace LibMCDriver_ADS {
 
 			std::string m_sName;
 			uint32_t m_Handle;
+
+			bool m_bHasPrefetchedData;
+			std::vector<uint8_t> m_PrefetchedData;
 		protected:
 
+			// Consumes prefetched data, if available. Otherwise reads from the PLC.
 			void readBuffer(void* pData, uint32_t nLength);
 			void writeBuffer(void* pData, uint32_t nLength);
 
@@ -78,6 +97,14 @@ namespace LibMCDriver_ADS {
 			virtual ~CADSClientVariable();
 
 			std::string getName();
+			uint32_t getHandle();
+
+			// Size of the value in the PLC memory in bytes.
+			virtual uint32_t getValueSize() = 0;
+
+			// Value data read by a sum command. Used by the next read instead of a round trip.
+			void setPrefetchedData(const uint8_t* pData, uint32_t nLength);
+			void clearPrefetchedData();
 		};
 
 		class CADSClientStringVariable : public CADSClientVariable {
@@ -90,6 +117,7 @@ namespace LibMCDriver_ADS {
 			virtual std::string readValueFromPLC();
 			virtual void writeValueToPLC(const std::string& sValue);
 
+			virtual uint32_t getValueSize() override;
 		};
 
 		class CADSClientIntegerVariable : public CADSClientVariable {
@@ -113,6 +141,8 @@ namespace LibMCDriver_ADS {
 			virtual void writeValueToPLC(const int64_t nValue) override;
 
 			virtual void getBounds(int64_t& minValue, int64_t& maxValue) override;
+
+			virtual uint32_t getValueSize() override;
 		};
 
 		class CADSClientBoolVariable : public CADSClientIntegerVariable {
@@ -127,6 +157,8 @@ namespace LibMCDriver_ADS {
 			virtual void writeBooleanValueToPLC(const bool bValue);
 
 			virtual void getBounds(int64_t& minValue, int64_t& maxValue) override;
+
+			virtual uint32_t getValueSize() override;
 		};
 
 
@@ -139,6 +171,8 @@ namespace LibMCDriver_ADS {
 			virtual void writeValueToPLC(const int64_t nValue) override;
 
 			virtual void getBounds(int64_t& minValue, int64_t& maxValue) override;
+
+			virtual uint32_t getValueSize() override;
 		};
 
 		class CADSClientInt16Variable : public CADSClientIntegerVariable {
@@ -150,6 +184,8 @@ namespace LibMCDriver_ADS {
 			virtual void writeValueToPLC(const int64_t nValue) override;
 
 			virtual void getBounds(int64_t& minValue, int64_t& maxValue) override;
+
+			virtual uint32_t getValueSize() override;
 		};
 
 		class CADSClientUint16Variable : public CADSClientIntegerVariable {
@@ -161,6 +197,8 @@ namespace LibMCDriver_ADS {
 			virtual void writeValueToPLC(const int64_t nValue) override;
 
 			virtual void getBounds(int64_t& minValue, int64_t& maxValue) override;
+
+			virtual uint32_t getValueSize() override;
 		};
 
 
@@ -173,6 +211,8 @@ namespace LibMCDriver_ADS {
 			virtual void writeValueToPLC(const int64_t nValue) override;
 
 			virtual void getBounds(int64_t& minValue, int64_t& maxValue) override;
+
+			virtual uint32_t getValueSize() override;
 		};
 
 		class CADSClientUint32Variable : public CADSClientIntegerVariable {
@@ -184,6 +224,8 @@ namespace LibMCDriver_ADS {
 			virtual void writeValueToPLC(const int64_t nValue) override;
 
 			virtual void getBounds(int64_t& minValue, int64_t& maxValue) override;
+
+			virtual uint32_t getValueSize() override;
 		};
 
 		class CADSClientFloatVariable : public CADSClientVariable {
@@ -202,6 +244,8 @@ namespace LibMCDriver_ADS {
 
 			virtual double readValueFromPLC() override;
 			virtual void writeValueToPLC(const double nValue) override;
+
+			virtual uint32_t getValueSize() override;
 		};
 
 		class CADSClientFloat64Variable : public CADSClientFloatVariable {
@@ -211,6 +255,8 @@ namespace LibMCDriver_ADS {
 
 			virtual double readValueFromPLC() override;
 			virtual void writeValueToPLC(const double nValue) override;
+
+			virtual uint32_t getValueSize() override;
 		};
 
 		typedef std::shared_ptr<CADSClientVariable> PADSClientVariable;
@@ -259,6 +305,14 @@ namespace LibMCDriver_ADS {
 
 			PADSClientStringVariable registerStringVariable(const std::string& sName, const size_t nStringBufferSize);
 
+			// Reads all given variables with as few ADS sum commands as possible. The values are consumed by the next read of each variable.
+			void prefetchVariables(const std::vector<CADSClientVariable*>& Variables);
+			void clearPrefetchedData();
+
+			void beginWriteBatch();
+			void commitWriteBatch();
+			void discardWriteBatch();
+
 			CADSClientVariable* findVariable(const std::string& sName, bool bFailIfNotExisting);
 			CADSClientIntegerVariable* findIntegerVariable(const std::string& sName, bool bFailIfNotExisting);
 			CADSClientBoolVariable* findBoolVariable(const std::string& sName, bool bFailIfNotExisting);
@@ -331,63 +331,117 @@ void CDriver_ADS::QueryParametersEx(LibMCEnv::PDriverStatusUpdateSession pDriver
 
     if (m_pADSClient.get() != nullptr) {
 
-        for (auto pParameter : m_Parameters) {
-
-            auto eAccessType = pParameter->getAccess();
-            if ((eAccessType == eDriver_ADSParameterAccess::ADSParameterAccess_Read) ||
-                (eAccessType == eDriver_ADSParameterAccess::ADSParameterAccess_ReadWrite)) {
+        try {
+            // Fetch all readable variables with as few ADS sum read round trips as possible
+            std::vector<CADSClientVariable*> readableVariables;
+            for (auto pParameter : m_Parameters) {
+                auto eAccessType = pParameter->getAccess();
+                if ((eAccessType == eDriver_ADSParameterAccess::ADSParameterAccess_Read) ||
+                    (eAccessType == eDriver_ADSParameterAccess::ADSParameterAccess_ReadWrite)) {
+
+                    auto pVariable = m_pADSClient->findVariable(pParameter->getADSName(), false);
+                    if (pVariable != nullptr)
+                        readableVariables.push_back(pVariable);
+                }
+            }
 
-                auto pVariable = m_pADSClient->findVariable(pParameter->getADSName(), false);
-                if (pVariable != nullptr) {
+            m_pADSClient->prefetchVariables(readableVariables);
+
+            for (auto pParameter : m_Parameters) {
+
+                auto eAccessType = pParameter->getAccess();
+                if ((eAccessType == eDriver_ADSParameterAccess::ADSParameterAccess_Read) ||
+                    (eAccessType == eDriver_ADSParameterAccess::ADSParameterAccess_ReadWrite)) {
+
+                    auto pVariable = m_pADSClient->findVariable(pParameter->getADSName(), false);
+                    if (pVariable != nullptr) {
+
+                        switch (pParameter->getType()) {
+                        case eDriver_ADSParameterType::ADSParameter_BOOL: {
+                            auto pBoolVariable = dynamic_cast<CADSClientBoolVariable*> (pVariable);
+                            if (pBoolVariable != nullptr)
+                                pDriverUpdateInstance->SetBoolParameter(pParameter->getName(), pBoolVariable->readBooleanValueFromPLC());
+                            break;
+                        }
+
+                        case eDriver_ADSParameterType::ADSParameter_INT:
+                        case eDriver_ADSParameterType::ADSParameter_SINT:
+                        case eDriver_ADSParameterType::ADSParameter_DINT:
+                        case eDriver_ADSParameterType::ADSParameter_UINT:
+                        case eDriver_ADSParameterType::ADSParameter_USINT:
+                        case eDriver_ADSParameterType::ADSParameter_UDINT: {
+                            auto pIntegerVariable = dynamic_cast<CADSClientIntegerVariable*> (pVariable);
+                            if (pIntegerVariable != nullptr)
+                                pDriverUpdateInstance->SetIntegerParameter(pParameter->getName(), pIntegerVariable->readValueFromPLC());
+                            break;
+                        }
+
+                        case eDriver_ADSParameterType::ADSParameter_REAL:
+                        case eDriver_ADSParameterType::ADSParameter_LREAL: {
+                            auto pFloatVariable = dynamic_cast<CADSClientFloatVariable*> (pVariable);
+                            if (pFloatVariable != nullptr)
+                                pDriverUpdateInstance->SetDoubleParameter(pParameter->getName(), pFloatVariable->readValueFromPLC());
+                            break;
+                        }
+
+                        case eDriver_ADSParameterType::ADSParameter_STRING: {
+                            auto pStringVariable = dynamic_cast<CADSClientStringVariable*> (pVariable);
+                            if (pStringVariable != nullptr)
+                                pDriverUpdateInstance->SetStringParameter(pParameter->getName(), pStringVariable->readValueFromPLC());
+                            break;
+                        }
+
+                        }
 
-                    switch (pParameter->getType()) {
-                    case eDriver_ADSParameterType::ADSParameter_BOOL: {
-                        auto pBoolVariable = dynamic_cast<CADSClientBoolVariable*> (pVariable);
-                        if (pBoolVariable != nullptr)
-                            pDriverUpdateInstance->SetBoolParameter(pParameter->getName(), pBoolVariable->readBooleanValueFromPLC());
-                        break;
                     }
 
-                    case eDriver_ADSParameterType::ADSParameter_INT:
-                    case eDriver_ADSParameterType::ADSParameter_SINT:
-                    case eDriver_ADSParameterType::ADSParameter_DINT:
-                    case eDriver_ADSParameterType::ADSParameter_UINT:
-                    case eDriver_ADSParameterType::ADSParameter_USINT:
-                    case eDriver_ADSParameterType::ADSParameter_UDINT: {
-                        auto pIntegerVariable = dynamic_cast<CADSClientIntegerVariable*> (pVariable);
-                        if (pIntegerVariable != nullptr)
-                            pDriverUpdateInstance->SetIntegerParameter(pParameter->getName(), pIntegerVariable->readValueFromPLC());
-                        break;
-                    }
+                }
 
-                    case eDriver_ADSParameterType::ADSParameter_REAL:
-                    case eDriver_ADSParameterType::ADSParameter_LREAL: {
-                        auto pFloatVariable = dynamic_cast<CADSClientFloatVariable*> (pVariable);
-                        if (pFloatVariable != nullptr)
-                            pDriverUpdateInstance->SetDoubleParameter(pParameter->getName(), pFloatVariable->readValueFromPLC());
-                        break;
-                    }
+            }
+        }
+        catch (...) {
+            m_pADSClient->clearPrefetchedData();
+            throw;
+        }
 
-                    case eDriver_ADSParameterType::ADSParameter_STRING: {
-                        auto pStringVariable = dynamic_cast<CADSClientStringVariable*> (pVariable);
-                        if (pStringVariable != nullptr)
-                            pDriverUpdateInstance->SetStringParameter(pParameter->getName(), pStringVariable->readValueFromPLC());
-                        break;
-                    }
+        m_pADSClient->clearPrefetchedData();
 
-                    }
+    }
 
-                }
 
-            }
+}
 
-        }
 
-    }
+void CDriver_ADS::BeginWriteBatch()
+{
+    if (m_bSimulationMode)
+        return;
+
+    if (m_pADSClient.get() == nullptr)
+        throw ELibMCDriver_ADSInterfaceException(LIBMCDRIVER_ADS_ERROR_DRIVERNOTCONFIGURED);
+
+    m_pADSClient->beginWriteBatch();
+}
+
+void CDriver_ADS::CommitWriteBatch()
+{
+    if (m_bSimulationMode)
+        return;
 
+    if (m_pADSClient.get() == nullptr)
+        throw ELibMCDriver_ADSInterfaceException(LIBMCDRIVER_ADS_ERROR_DRIVERNOTCONFIGURED);
 
+    m_pADSClient->commitWriteBatch();
 }
 
+void CDriver_ADS::DiscardWriteBatch()
+{
+    if (m_bSimulationMode)
+        return;
+
+    if (m_pADSClient.get() != nullptr)
+        m_pADSClient->discardWriteBatch();
+}
 
 void CDriver_ADS::SetToSimulationMode()
 {
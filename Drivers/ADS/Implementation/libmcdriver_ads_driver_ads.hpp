@@ -179,6 +179,12 @@ public:
 
 	void QueryParametersEx(LibMCEnv::PDriverStatusUpdateSession pDriverUpdateInstance) override;
 
+	void BeginWriteBatch() override;
+
+	void CommitWriteBatch() override;
+
+	void DiscardWriteBatch() override;
+
 	void SetToSimulationMode() override;
 
 	bool IsSimulationMode() override;
@@ -46,11 +46,16 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define ADSIGRP_SYM_HNDBYNAME 0xF003
 #define ADSIGRP_SYM_VALBYNAME 0xF004
 #define ADSIGRP_SYM_VALBYHND 0xF005
+#define ADSIGRP_SUMUP_READ 0xF080
+#define ADSIGRP_SUMUP_WRITE 0xF081
 
 #define	AMSPORT_R0_PLC_TC3 851
 
 #define ADS_MAXNAMELENGTH 4096
 
+// TwinCAT limits the number of sub commands in one sum command
+#define ADS_MAXSUMCOMMANDCOUNT 500
+
 
 namespace LibMCDriver_ADS {
 	namespace Impl {
@@ -68,6 +73,14 @@ namespace LibMCDriver_ADS {
 			uint16_t m_Port;
 		} sAmsAddr;
 
+		// Sub command header of ADSIGRP_SUMUP_READ and ADSIGRP_SUMUP_WRITE requests
+		typedef struct _sAdsSumRequestHeader
+		{
+			uint32_t m_nIndexGroup;
+			uint32_t m_nIndexOffset;
+			uint32_t m_nLength;
+		} sAdsSumRequestHeader;
+
 		typedef	struct
 		{
 			uint8_t m_Version;
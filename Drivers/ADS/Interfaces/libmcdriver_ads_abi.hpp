@@ -278,6 +278,30 @@ LIBMCDRIVER_ADS_DECLSPEC LibMCDriver_ADSResult libmcdriver_ads_driver_ads_writes
 */
 LIBMCDRIVER_ADS_DECLSPEC LibMCDriver_ADSResult libmcdriver_ads_driver_ads_getvariablebounds(LibMCDriver_ADS_Driver_ADS pDriver_ADS, const char * pVariableName, LibMCDriver_ADS_int64 * pMinValue, LibMCDriver_ADS_int64 * pMaxValue);
 
+/**
+* Starts a write batch. Subsequent write calls are queued and sent with a single ADS sum command on CommitWriteBatch.
+*
+* @param[in] pDriver_ADS - Driver_ADS instance.
+* @return error code or 0 (success)
+*/
+LIBMCDRIVER_ADS_DECLSPEC LibMCDriver_ADSResult libmcdriver_ads_driver_ads_beginwritebatch(LibMCDriver_ADS_Driver_ADS pDriver_ADS);
+
+/**
+* Sends all queued writes of the current write batch to the PLC and ends the batch. Fails if any of the writes failed.
+*
+* @param[in] pDriver_ADS - Driver_ADS instance.
+* @return error code or 0 (success)
+*/
+LIBMCDRIVER_ADS_DECLSPEC LibMCDriver_ADSResult libmcdriver_ads_driver_ads_commitwritebatch(LibMCDriver_ADS_Driver_ADS pDriver_ADS);
+
+/**
+* Drops all queued writes of the current write batch and ends the batch.
+*
+* @param[in] pDriver_ADS - Driver_ADS instance.
+* @return error code or 0 (success)
+*/
+LIBMCDRIVER_ADS_DECLSPEC LibMCDriver_ADSResult libmcdriver_ads_driver_ads_discardwritebatch(LibMCDriver_ADS_Driver_ADS pDriver_ADS);
+
 /*************************************************************************************************************************
  Global functions
 **************************************************************************************************************************/
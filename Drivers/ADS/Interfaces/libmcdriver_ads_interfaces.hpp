@@ -414,6 +414,21 @@ public:
 	*/
 	virtual void GetVariableBounds(const std::string & sVariableName, LibMCDriver_ADS_int64 & nMinValue, LibMCDriver_ADS_int64 & nMaxValue) = 0;
 
+	/**
+	* IDriver_ADS::BeginWriteBatch - Starts a write batch. Subsequent write calls are queued and sent with a single ADS sum command on CommitWriteBatch.
+	*/
+	virtual void BeginWriteBatch() = 0;
+
+	/**
+	* IDriver_ADS::CommitWriteBatch - Sends all queued writes of the current write batch to the PLC and ends the batch. Fails if any of the writes failed.
+	*/
+	virtual void CommitWriteBatch() = 0;
+
+	/**
+	* IDriver_ADS::DiscardWriteBatch - Drops all queued writes of the current write batch and ends the batch.
+	*/
+	virtual void DiscardWriteBatch() = 0;
+
 };
 
 typedef IBaseSharedPtr<IDriver_ADS> PIDriver_ADS;
@@ -751,6 +751,78 @@ LibMCDriver_ADSResult libmcdriver_ads_driver_ads_getvariablebounds(LibMCDriver_A
 	}
 }
 
+LibMCDriver_ADSResult libmcdriver_ads_driver_ads_beginwritebatch(LibMCDriver_ADS_Driver_ADS pDriver_ADS)
+{
+	IBase* pIBaseClass = (IBase *)pDriver_ADS;
+
+	try {
+		IDriver_ADS* pIDriver_ADS = dynamic_cast<IDriver_ADS*>(pIBaseClass);
+		if (!pIDriver_ADS)
+			throw ELibMCDriver_ADSInterfaceException(LIBMCDRIVER_ADS_ERROR_INVALIDCAST);
+		
+		pIDriver_ADS->BeginWriteBatch();
+
+		return LIBMCDRIVER_ADS_SUCCESS;
+	}
+	catch (ELibMCDriver_ADSInterfaceException & Exception) {
+		return handleLibMCDriver_ADSException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCDriver_ADSResult libmcdriver_ads_driver_ads_commitwritebatch(LibMCDriver_ADS_Driver_ADS pDriver_ADS)
+{
+	IBase* pIBaseClass = (IBase *)pDriver_ADS;
+
+	try {
+		IDriver_ADS* pIDriver_ADS = dynamic_cast<IDriver_ADS*>(pIBaseClass);
+		if (!pIDriver_ADS)
+			throw ELibMCDriver_ADSInterfaceException(LIBMCDRIVER_ADS_ERROR_INVALIDCAST);
+		
+		pIDriver_ADS->CommitWriteBatch();
+
+		return LIBMCDRIVER_ADS_SUCCESS;
+	}
+	catch (ELibMCDriver_ADSInterfaceException & Exception) {
+		return handleLibMCDriver_ADSException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCDriver_ADSResult libmcdriver_ads_driver_ads_discardwritebatch(LibMCDriver_ADS_Driver_ADS pDriver_ADS)
+{
+	IBase* pIBaseClass = (IBase *)pDriver_ADS;
+
+	try {
+		IDriver_ADS* pIDriver_ADS = dynamic_cast<IDriver_ADS*>(pIBaseClass);
+		if (!pIDriver_ADS)
+			throw ELibMCDriver_ADSInterfaceException(LIBMCDRIVER_ADS_ERROR_INVALIDCAST);
+		
+		pIDriver_ADS->DiscardWriteBatch();
+
+		return LIBMCDRIVER_ADS_SUCCESS;
+	}
+	catch (ELibMCDriver_ADSInterfaceException & Exception) {
+		return handleLibMCDriver_ADSException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
 
 
 /*************************************************************************************************************************
@@ -808,6 +880,12 @@ LibMCDriver_ADSResult LibMCDriver_ADS::Impl::LibMCDriver_ADS_GetProcAddress (con
 		*ppProcAddress = (void*) &libmcdriver_ads_driver_ads_writestringvalue;
 	if (sProcName == "libmcdriver_ads_driver_ads_getvariablebounds") 
 		*ppProcAddress = (void*) &libmcdriver_ads_driver_ads_getvariablebounds;
+	if (sProcName == "libmcdriver_ads_driver_ads_beginwritebatch") 
+		*ppProcAddress = (void*) &libmcdriver_ads_driver_ads_beginwritebatch;
+	if (sProcName == "libmcdriver_ads_driver_ads_commitwritebatch") 
+		*ppProcAddress = (void*) &libmcdriver_ads_driver_ads_commitwritebatch;
+	if (sProcName == "libmcdriver_ads_driver_ads_discardwritebatch") 
+		*ppProcAddress = (void*) &libmcdriver_ads_driver_ads_discardwritebatch;
 	if (sProcName == "libmcdriver_ads_getversion") 
 		*ppProcAddress = (void*) &libmcdriver_ads_getversion;
 	if (sProcName == "libmcdriver_ads_getlasterror") 
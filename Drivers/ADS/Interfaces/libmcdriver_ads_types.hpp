@@ -137,6 +137,10 @@ typedef void * LibMCDriver_ADS_pvoid;
 #define LIBMCDRIVER_ADS_ERROR_STRINGLENGTHMISSING 1030 /** string length missing */
 #define LIBMCDRIVER_ADS_ERROR_INVALIDSTRINGLENGTH 1031 /** invalid string length */
 #define LIBMCDRIVER_ADS_ERROR_INVALIDADSSDKRESOURCE 1032 /** invalid ads sdk resource */
+#define LIBMCDRIVER_ADS_ERROR_INVALIDSUMCOMMANDRESPONSE 1033 /** invalid sum command response */
+#define LIBMCDRIVER_ADS_ERROR_SUMCOMMANDFAILED 1034 /** sum command failed */
+#define LIBMCDRIVER_ADS_ERROR_WRITEBATCHALREADYACTIVE 1035 /** write batch already active */
+#define LIBMCDRIVER_ADS_ERROR_NOWRITEBATCHACTIVE 1036 /** no write batch active */
 
 /*************************************************************************************************************************
  Error strings for LibMCDriver_ADS
@@ -186,6 +190,10 @@ inline const char * LIBMCDRIVER_ADS_GETERRORSTRING (LibMCDriver_ADSResult nError
     case LIBMCDRIVER_ADS_ERROR_STRINGLENGTHMISSING: return "string length missing";
     case LIBMCDRIVER_ADS_ERROR_INVALIDSTRINGLENGTH: return "invalid string length";
     case LIBMCDRIVER_ADS_ERROR_INVALIDADSSDKRESOURCE: return "invalid ads sdk resource";
+    case LIBMCDRIVER_ADS_ERROR_INVALIDSUMCOMMANDRESPONSE: return "invalid sum command response";
+    case LIBMCDRIVER_ADS_ERROR_SUMCOMMANDFAILED: return "sum command failed";
+    case LIBMCDRIVER_ADS_ERROR_WRITEBATCHALREADYACTIVE: return "write batch already active";
+    case LIBMCDRIVER_ADS_ERROR_NOWRITEBATCHACTIVE: return "no write batch active";
     default: return "unknown error";
   }
 }
@@ -0,0 +1,335 @@
+/*++
+
+Copyright (C) 2020 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+/*
+ Mock implementation of the TwinCAT ADS DLL exports used by the ADS driver.
+ Symbols are created on first handle request and kept in memory, so the sum
+ command batching of the driver can be tested without a TwinCAT runtime.
+ Load it with SetCustomSDKResource.
+*/
+
+#include "../Implementation/libmcdriver_ads_sdk.hpp"
+
+#include <map>
+#include <vector>
+#include <string>
+#include <mutex>
+#include <cstring>
+
+#ifdef _WIN32
+#define ADSMOCK_EXPORT extern "C" __declspec(dllexport)
+#else
+#define ADSMOCK_EXPORT extern "C" __attribute__((visibility("default")))
+#endif
+
+#define ADSMOCK_ERROR_NOERROR 0
+#define ADSMOCK_ERROR_INVALIDGROUP 0x702
+#define ADSMOCK_ERROR_INVALIDSIZE 0x705
+#define ADSMOCK_ERROR_SYMBOLNOTFOUND 0x710
+#define ADSMOCK_ERROR_INVALIDPARAM 0x70B
+#define ADSMOCK_ERROR_PORTNOTOPEN 0x748
+
+#define ADSMOCK_MAXVALUESIZE 65536
+
+using namespace LibMCDriver_ADS::Impl;
+
+namespace {
+
+	class CADSMockSymbolTable {
+	private:
+		std::mutex m_Mutex;
+		std::map<std::string, uint32_t> m_HandleMap;
+		std::map<uint32_t, std::vector<uint8_t>> m_Values;
+		uint32_t m_nNextHandle;
+		AdsPort m_nNextPort;
+		uint32_t m_nRequestCount;
+
+		AdsError writeValue(uint32_t nHandle, const uint8_t* pData, uint32_t nLength)
+		{
+			auto iIter = m_Values.find(nHandle);
+			if (iIter == m_Values.end())
+				return ADSMOCK_ERROR_SYMBOLNOTFOUND;
+			if (nLength > ADSMOCK_MAXVALUESIZE)
+				return ADSMOCK_ERROR_INVALIDSIZE;
+
+			// Values take the size of the last write, unwritten bytes read as zero
+			iIter->second.assign(pData, pData + nLength);
+			return ADSMOCK_ERROR_NOERROR;
+		}
+
+		AdsError readValue(uint32_t nHandle, uint8_t* pData, uint32_t nLength)
+		{
+			auto iIter = m_Values.find(nHandle);
+			if (iIter == m_Values.end())
+				return ADSMOCK_ERROR_SYMBOLNOTFOUND;
+
+			auto& value = iIter->second;
+			memset(pData, 0, nLength);
+			memcpy(pData, value.data(), (value.size() < nLength) ? value.size() : nLength);
+			return ADSMOCK_ERROR_NOERROR;
+		}
+
+	public:
+
+		CADSMockSymbolTable()
+			: m_nNextHandle(1), m_nNextPort(30000), m_nRequestCount(0)
+		{
+		}
+
+		AdsPort openPort()
+		{
+			std::lock_guard<std::mutex> lockGuard(m_Mutex);
+			return m_nNextPort++;
+		}
+
+		void reset()
+		{
+			std::lock_guard<std::mutex> lockGuard(m_Mutex);
+			m_HandleMap.clear();
+			m_Values.clear();
+			m_nNextHandle = 1;
+			m_nRequestCount = 0;
+		}
+
+		uint32_t getRequestCount()
+		{
+			std::lock_guard<std::mutex> lockGuard(m_Mutex);
+			return m_nRequestCount;
+		}
+
+		AdsError write(AdsUint32 indexGroup, AdsUint32 indexOffset, AdsUint32 length, const void* pData)
+		{
+			std::lock_guard<std::mutex> lockGuard(m_Mutex);
+			m_nRequestCount++;
+
+			if ((pData == nullptr) && (length > 0))
+				return ADSMOCK_ERROR_INVALIDPARAM;
+
+			if (indexGroup == ADSIGRP_SYM_VALBYHND)
+				return writeValue(indexOffset, (const uint8_t*)pData, length);
+
+			return ADSMOCK_ERROR_INVALIDGROUP;
+		}
+
+		AdsError read(AdsUint32 indexGroup, AdsUint32 indexOffset, AdsUint32 length, void* pData, AdsUint32* pBytesRead)
+		{
+			std::lock_guard<std::mutex> lockGuard(m_Mutex);
+			m_nRequestCount++;
+
+			if ((pData == nullptr) && (length > 0))
+				return ADSMOCK_ERROR_INVALIDPARAM;
+
+			if (indexGroup == ADSIGRP_SYM_VALBYHND) {
+				AdsError nError = readValue(indexOffset, (uint8_t*)pData, length);
+				if ((nError == ADSMOCK_ERROR_NOERROR) && (pBytesRead != nullptr))
+					*pBytesRead = length;
+				return nError;
+			}
+
+			return ADSMOCK_ERROR_INVALIDGROUP;
+		}
+
+		AdsError readWrite(AdsUint32 indexGroup, AdsUint32 indexOffset, AdsUint32 cbReadLength, void* pReadData, AdsUint32 cbWriteLength, const void* pWriteData, AdsUint32* pBytesRead)
+		{
+			std::lock_guard<std::mutex> lockGuard(m_Mutex);
+			m_nRequestCount++;
+
+			if ((pReadData == nullptr) || (pWriteData == nullptr))
+				return ADSMOCK_ERROR_INVALIDPARAM;
+
+			const uint8_t* pWriteBytes = (const uint8_t*)pWriteData;
+			uint8_t* pReadBytes = (uint8_t*)pReadData;
+
+			switch (indexGroup) {
+			case ADSIGRP_SYM_HNDBYNAME: {
+				if (cbReadLength != sizeof(uint32_t))
+					return ADSMOCK_ERROR_INVALIDSIZE;
+
+				std::string sName((const char*)pWriteBytes, strnlen((const char*)pWriteBytes, cbWriteLength));
+				if (sName.empty())
+					return ADSMOCK_ERROR_SYMBOLNOTFOUND;
+
+				uint32_t nHandle;
+				auto iIter = m_HandleMap.find(sName);
+				if (iIter != m_HandleMap.end()) {
+					nHandle = iIter->second;
+				}
+				else {
+					nHandle = m_nNextHandle++;
+					m_HandleMap.insert(std::make_pair(sName, nHandle));
+					m_Values.insert(std::make_pair(nHandle, std::vector<uint8_t>()));
+				}
+
+				memcpy(pReadBytes, &nHandle, sizeof(uint32_t));
+				if (pBytesRead != nullptr)
+					*pBytesRead = sizeof(uint32_t);
+				return ADSMOCK_ERROR_NOERROR;
+			}
+
+			case ADSIGRP_SUMUP_READ: {
+				// Request: N headers. Response: N error codes, followed by N values.
+				uint64_t nCount = indexOffset;
+				if (cbWriteLength != nCount * sizeof(sAdsSumRequestHeader))
+					return ADSMOCK_ERROR_INVALIDSIZE;
+
+				const sAdsSumRequestHeader* pHeaders = (const sAdsSumRequestHeader*)pWriteBytes;
+				uint64_t nResponseLength = nCount * sizeof(uint32_t);
+				for (uint64_t nIndex = 0; nIndex < nCount; nIndex++)
+					nResponseLength += pHeaders[nIndex].m_nLength;
+				if (nResponseLength > cbReadLength)
+					return ADSMOCK_ERROR_INVALIDSIZE;
+
+				uint8_t* pValueData = pReadBytes + nCount * sizeof(uint32_t);
+				for (uint64_t nIndex = 0; nIndex < nCount; nIndex++) {
+					uint32_t nResult = ADSMOCK_ERROR_INVALIDGROUP;
+					if (pHeaders[nIndex].m_nIndexGroup == ADSIGRP_SYM_VALBYHND)
+						nResult = readValue(pHeaders[nIndex].m_nIndexOffset, pValueData, pHeaders[nIndex].m_nLength);
+					memcpy(pReadBytes + nIndex * sizeof(uint32_t), &nResult, sizeof(uint32_t));
+					pValueData += pHeaders[nIndex].m_nLength;
+				}
+
+				if (pBytesRead != nullptr)
+					*pBytesRead = (AdsUint32)nResponseLength;
+				return ADSMOCK_ERROR_NOERROR;
+			}
+
+			case ADSIGRP_SUMUP_WRITE: {
+				// Request: N headers, followed by N values. Response: N error codes.
+				uint64_t nCount = indexOffset;
+				uint64_t nHeaderLength = nCount * sizeof(sAdsSumRequestHeader);
+				if ((cbWriteLength < nHeaderLength) || (cbReadLength < nCount * sizeof(uint32_t)))
+					return ADSMOCK_ERROR_INVALIDSIZE;
+
+				const sAdsSumRequestHeader* pHeaders = (const sAdsSumRequestHeader*)pWriteBytes;
+				uint64_t nRequestLength = nHeaderLength;
+				for (uint64_t nIndex = 0; nIndex < nCount; nIndex++)
+					nRequestLength += pHeaders[nIndex].m_nLength;
+				if (nRequestLength != cbWriteLength)
+					return ADSMOCK_ERROR_INVALIDSIZE;
+
+				const uint8_t* pValueData = pWriteBytes + nHeaderLength;
+				for (uint64_t nIndex = 0; nIndex < nCount; nIndex++) {
+					uint32_t nResult = ADSMOCK_ERROR_INVALIDGROUP;
+					if (pHeaders[nIndex].m_nIndexGroup == ADSIGRP_SYM_VALBYHND)
+						nResult = writeValue(pHeaders[nIndex].m_nIndexOffset, pValueData, pHeaders[nIndex].m_nLength);
+					memcpy(pReadBytes + nIndex * sizeof(uint32_t), &nResult, sizeof(uint32_t));
+					pValueData += pHeaders[nIndex].m_nLength;
+				}
+
+				if (pBytesRead != nullptr)
+					*pBytesRead = (AdsUint32)(nCount * sizeof(uint32_t));
+				return ADSMOCK_ERROR_NOERROR;
+			}
+
+			default:
+				return ADSMOCK_ERROR_INVALIDGROUP;
+			}
+		}
+
+	};
+
+	CADSMockSymbolTable& getMockSymbolTable()
+	{
+		static CADSMockSymbolTable symbolTable;
+		return symbolTable;
+	}
+
+}
+
+ADSMOCK_EXPORT AdsUint32 ADS_CALLINGCONVENTION AdsGetDllVersion()
+{
+	AdsVersion version;
+	version.m_Version = 3;
+	version.m_Revision = 1;
+	version.m_Build = 0;
+
+	AdsUint32 nResult = 0;
+	memcpy(&nResult, &version, sizeof(version));
+	return nResult;
+}
+
+ADSMOCK_EXPORT AdsPort ADS_CALLINGCONVENTION AdsPortOpenEx()
+{
+	return getMockSymbolTable().openPort();
+}
+
+ADSMOCK_EXPORT AdsError ADS_CALLINGCONVENTION AdsPortCloseEx(AdsPort nPort)
+{
+	return (nPort != 0) ? ADSMOCK_ERROR_NOERROR : ADSMOCK_ERROR_PORTNOTOPEN;
+}
+
+ADSMOCK_EXPORT AdsError ADS_CALLINGCONVENTION AdsGetLocalAddressEx(AdsPort nPort, sAmsAddr* pAddr)
+{
+	if (pAddr == nullptr)
+		return ADSMOCK_ERROR_INVALIDPARAM;
+
+	memset(pAddr, 0, sizeof(sAmsAddr));
+	pAddr->m_NetworkID.m_Data[0] = 127;
+	pAddr->m_NetworkID.m_Data[3] = 1;
+	pAddr->m_NetworkID.m_Data[4] = 1;
+	pAddr->m_NetworkID.m_Data[5] = 1;
+	pAddr->m_Port = (uint16_t)nPort;
+	return ADSMOCK_ERROR_NOERROR;
+}
+
+ADSMOCK_EXPORT AdsError ADS_CALLINGCONVENTION AdsSyncWriteReqEx(AdsPort nPort, sAmsAddr* pAddr, AdsUint32 indexGroup, AdsUint32 indexOffset, AdsUint32 length, void* pData)
+{
+	if (nPort == 0)
+		return ADSMOCK_ERROR_PORTNOTOPEN;
+
+	return getMockSymbolTable().write(indexGroup, indexOffset, length, pData);
+}
+
+ADSMOCK_EXPORT AdsError ADS_CALLINGCONVENTION AdsSyncReadReqEx2(AdsPort nPort, sAmsAddr* pAddr, AdsUint32 indexGroup, AdsUint32 indexOffset, AdsUint32 length, void* pData, AdsUint32* pBytesRead)
+{
+	if (nPort == 0)
+		return ADSMOCK_ERROR_PORTNOTOPEN;
+
+	return getMockSymbolTable().read(indexGroup, indexOffset, length, pData, pBytesRead);
+}
+
+ADSMOCK_EXPORT AdsError ADS_CALLINGCONVENTION AdsSyncReadWriteReqEx2(AdsPort nPort, sAmsAddr* pAddr, AdsUint32 indexGroup, AdsUint32 indexOffset, AdsUint32 cbReadLength, void* pReadData, AdsUint32 cbWriteLength, const void* pWriteData, AdsUint32* pBytesRead)
+{
+	if (nPort == 0)
+		return ADSMOCK_ERROR_PORTNOTOPEN;
+
+	return getMockSymbolTable().readWrite(indexGroup, indexOffset, cbReadLength, pReadData, cbWriteLength, pWriteData, pBytesRead);
+}
+
+// Number of ADS requests issued since the last reset, used to verify batching
+ADSMOCK_EXPORT AdsUint32 ADS_CALLINGCONVENTION AdsMockGetRequestCount()
+{
+	return getMockSymbolTable().getRequestCount();
+}
+
+ADSMOCK_EXPORT void ADS_CALLINGCONVENTION AdsMockReset()
+{
+	getMockSymbolTable().reset();
+}
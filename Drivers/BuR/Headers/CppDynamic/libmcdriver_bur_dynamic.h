@@ -252,6 +252,15 @@ typedef LibMCDriver_BuRResult (*PLibMCDriver_BuRDriver_BuR_ConnectPtr) (LibMCDri
 */
 typedef LibMCDriver_BuRResult (*PLibMCDriver_BuRDriver_BuR_DisconnectPtr) (LibMCDriver_BuR_Driver_BuR pDriver_BuR);
 
+/**
+* Limits the number of packets that are sent to the PLC before their responses have been received. Only needed for PLCs that cannot buffer a whole command list.
+*
+* @param[in] pDriver_BuR - Driver_BuR instance.
+* @param[in] nMaxPacketsInFlight - Maximum number of packets in flight. 0 sends all packets of a list before the first response is read (default).
+* @return error code or 0 (success)
+*/
+typedef LibMCDriver_BuRResult (*PLibMCDriver_BuRDriver_BuR_SetMaxPacketsInFlightPtr) (LibMCDriver_BuR_Driver_BuR pDriver_BuR, LibMCDriver_BuR_uint32 nMaxPacketsInFlight);
+
 /**
 * Sends the machine initialization command.
 *
@@ -399,6 +408,7 @@ typedef struct {
 	PLibMCDriver_BuRDriver_BuR_IsSimulationModePtr m_Driver_BuR_IsSimulationMode;
 	PLibMCDriver_BuRDriver_BuR_ConnectPtr m_Driver_BuR_Connect;
 	PLibMCDriver_BuRDriver_BuR_DisconnectPtr m_Driver_BuR_Disconnect;
+	PLibMCDriver_BuRDriver_BuR_SetMaxPacketsInFlightPtr m_Driver_BuR_SetMaxPacketsInFlight;
 	PLibMCDriver_BuRDriver_BuR_ReinitializeMachinePtr m_Driver_BuR_ReinitializeMachine;
 	PLibMCDriver_BuRDriver_BuR_CreateCommandListPtr m_Driver_BuR_CreateCommandList;
 	PLibMCDriver_BuRDriver_BuR_CreateCommandPtr m_Driver_BuR_CreateCommand;
@@ -290,6 +290,8 @@ public:
 			case LIBMCDRIVER_BUR_ERROR_JOURNALGROUPNAMENOTFOUND: return "JOURNALGROUPNAMENOTFOUND";
 			case LIBMCDRIVER_BUR_ERROR_NOGROUPATTRIBUTE: return "NOGROUPATTRIBUTE";
 			case LIBMCDRIVER_BUR_ERROR_NOVALUEATTRIBUTE: return "NOVALUEATTRIBUTE";
+			case LIBMCDRIVER_BUR_ERROR_INVALIDMAXPACKETSINFLIGHT: return "INVALIDMAXPACKETSINFLIGHT";
+			case LIBMCDRIVER_BUR_ERROR_RECEIVEDINVALIDCOMMANDID: return "RECEIVEDINVALIDCOMMANDID";
 		}
 		return "UNKNOWN";
 	}
@@ -414,6 +416,8 @@ public:
 			case LIBMCDRIVER_BUR_ERROR_JOURNALGROUPNAMENOTFOUND: return "Journal group name not found";
 			case LIBMCDRIVER_BUR_ERROR_NOGROUPATTRIBUTE: return "No group attribute";
 			case LIBMCDRIVER_BUR_ERROR_NOVALUEATTRIBUTE: return "No value attribute";
+			case LIBMCDRIVER_BUR_ERROR_INVALIDMAXPACKETSINFLIGHT: return "Invalid maximum number of packets in flight";
+			case LIBMCDRIVER_BUR_ERROR_RECEIVEDINVALIDCOMMANDID: return "Received invalid command id";
 		}
 		return "unknown error";
 	}
@@ -682,6 +686,7 @@ public:
 	inline bool IsSimulationMode();
 	inline void Connect(const std::string & sIPAddress, const LibMCDriver_BuR_uint32 nPort, const LibMCDriver_BuR_uint32 nTimeout);
 	inline void Disconnect();
+	inline void SetMaxPacketsInFlight(const LibMCDriver_BuR_uint32 nMaxPacketsInFlight);
 	inline void ReinitializeMachine();
 	inline PPLCCommandList CreateCommandList();
 	inline PPLCCommand CreateCommand(const std::string & sCommandName);
@@ -832,6 +837,7 @@ public:
 		pWrapperTable->m_Driver_BuR_IsSimulationMode = nullptr;
 		pWrapperTable->m_Driver_BuR_Connect = nullptr;
 		pWrapperTable->m_Driver_BuR_Disconnect = nullptr;
+		pWrapperTable->m_Driver_BuR_SetMaxPacketsInFlight = nullptr;
 		pWrapperTable->m_Driver_BuR_ReinitializeMachine = nullptr;
 		pWrapperTable->m_Driver_BuR_CreateCommandList = nullptr;
 		pWrapperTable->m_Driver_BuR_CreateCommand = nullptr;
@@ -1075,6 +1081,15 @@ public:
 		if (pWrapperTable->m_Driver_BuR_Disconnect == nullptr)
 			return LIBMCDRIVER_BUR_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		#ifdef _WIN32
+		pWrapperTable->m_Driver_BuR_SetMaxPacketsInFlight = (PLibMCDriver_BuRDriver_BuR_SetMaxPacketsInFlightPtr) GetProcAddress(hLibrary, "libmcdriver_bur_driver_bur_setmaxpacketsinflight");
+		#else // _WIN32
+		pWrapperTable->m_Driver_BuR_SetMaxPacketsInFlight = (PLibMCDriver_BuRDriver_BuR_SetMaxPacketsInFlightPtr) dlsym(hLibrary, "libmcdriver_bur_driver_bur_setmaxpacketsinflight");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Driver_BuR_SetMaxPacketsInFlight == nullptr)
+			return LIBMCDRIVER_BUR_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		#ifdef _WIN32
 		pWrapperTable->m_Driver_BuR_ReinitializeMachine = (PLibMCDriver_BuRDriver_BuR_ReinitializeMachinePtr) GetProcAddress(hLibrary, "libmcdriver_bur_driver_bur_reinitializemachine");
 		#else // _WIN32
@@ -1288,6 +1303,10 @@ public:
 		if ( (eLookupError != 0) || (pWrapperTable->m_Driver_BuR_Disconnect == nullptr) )
 			return LIBMCDRIVER_BUR_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		eLookupError = (*pLookup)("libmcdriver_bur_driver_bur_setmaxpacketsinflight", (void**)&(pWrapperTable->m_Driver_BuR_SetMaxPacketsInFlight));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Driver_BuR_SetMaxPacketsInFlight == nullptr) )
+			return LIBMCDRIVER_BUR_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		eLookupError = (*pLookup)("libmcdriver_bur_driver_bur_reinitializemachine", (void**)&(pWrapperTable->m_Driver_BuR_ReinitializeMachine));
 		if ( (eLookupError != 0) || (pWrapperTable->m_Driver_BuR_ReinitializeMachine == nullptr) )
 			return LIBMCDRIVER_BUR_ERROR_COULDNOTFINDLIBRARYEXPORT;
@@ -1572,6 +1591,15 @@ public:
 		CheckError(m_pWrapper->m_WrapperTable.m_Driver_BuR_Disconnect(m_pHandle));
 	}
 	
+	/**
+	* CDriver_BuR::SetMaxPacketsInFlight - Limits the number of packets that are sent to the PLC before their responses have been received. Only needed for PLCs that cannot buffer a whole command list.
+	* @param[in] nMaxPacketsInFlight - Maximum number of packets in flight. 0 sends all packets of a list before the first response is read (default).
+	*/
+	void CDriver_BuR::SetMaxPacketsInFlight(const LibMCDriver_BuR_uint32 nMaxPacketsInFlight)
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_Driver_BuR_SetMaxPacketsInFlight(m_pHandle, nMaxPacketsInFlight));
+	}
+	
 	/**
 	* CDriver_BuR::ReinitializeMachine - Sends the machine initialization command.
 	*/
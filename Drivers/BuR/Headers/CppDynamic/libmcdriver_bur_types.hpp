@@ -212,6 +212,8 @@ typedef void * LibMCDriver_BuR_pvoid;
 #define LIBMCDRIVER_BUR_ERROR_JOURNALGROUPNAMENOTFOUND 1114 /** Journal group name not found */
 #define LIBMCDRIVER_BUR_ERROR_NOGROUPATTRIBUTE 1115 /** No group attribute */
 #define LIBMCDRIVER_BUR_ERROR_NOVALUEATTRIBUTE 1116 /** No value attribute */
+#define LIBMCDRIVER_BUR_ERROR_INVALIDMAXPACKETSINFLIGHT 1117 /** Invalid maximum number of packets in flight */
+#define LIBMCDRIVER_BUR_ERROR_RECEIVEDINVALIDCOMMANDID 1118 /** Received invalid command id */
 
 /*************************************************************************************************************************
  Error strings for LibMCDriver_BuR
@@ -336,6 +338,8 @@ inline const char * LIBMCDRIVER_BUR_GETERRORSTRING (LibMCDriver_BuRResult nError
     case LIBMCDRIVER_BUR_ERROR_JOURNALGROUPNAMENOTFOUND: return "Journal group name not found";
     case LIBMCDRIVER_BUR_ERROR_NOGROUPATTRIBUTE: return "No group attribute";
     case LIBMCDRIVER_BUR_ERROR_NOVALUEATTRIBUTE: return "No value attribute";
+    case LIBMCDRIVER_BUR_ERROR_INVALIDMAXPACKETSINFLIGHT: return "Invalid maximum number of packets in flight";
+    case LIBMCDRIVER_BUR_ERROR_RECEIVEDINVALIDCOMMANDID: return "Received invalid command id";
     default: return "unknown error";
   }
 }
@@ -201,7 +201,7 @@ std::vector<uint8_t>& CDriver_BuRPacket::getDataBuffer()
 }
 
 
-CDriver_BuRConnector::CDriver_BuRConnector(LibMCEnv::PDriverEnvironment pDriverEnvironment, uint32_t nWorkerThreadCount, uint32_t nMaxReceiveBufferSize, uint32_t nMajorVersion, uint32_t nMinorVersion, uint32_t nPatchVersion, uint32_t nBuildVersion, uint32_t nMaxPacketQueueSize, eDriver_BurProtocolVersion ProtocolVersion, uint32_t nPacketSignature)
+CDriver_BuRConnector::CDriver_BuRConnector(LibMCEnv::PDriverEnvironment pDriverEnvironment, uint32_t nWorkerThreadCount, uint32_t nMaxReceiveBufferSize, uint32_t nMajorVersion, uint32_t nMinorVersion, uint32_t nPatchVersion, uint32_t nBuildVersion, uint32_t nMaxPacketsInFlight, eDriver_BurProtocolVersion ProtocolVersion, uint32_t nPacketSignature)
     : m_nWorkerThreadCount(nWorkerThreadCount),
     m_nMaxReceiveBufferSize(nMaxReceiveBufferSize),
     m_nMajorVersion(nMajorVersion),
@@ -212,7 +212,7 @@ CDriver_BuRConnector::CDriver_BuRConnector(LibMCEnv::PDriverEnvironment pDriverE
     m_ProtocolVersion (ProtocolVersion),
     m_StartJournaling (false),
     m_nSequenceID (1),
-    m_nMaxPacketQueueSize (nMaxPacketQueueSize),
+    m_nMaxPacketsInFlight (nMaxPacketsInFlight),
     m_nReceiveTimeoutInMS (1000),
     m_pDriverEnvironment (pDriverEnvironment)
 
@@ -220,6 +220,12 @@ CDriver_BuRConnector::CDriver_BuRConnector(LibMCEnv::PDriverEnvironment pDriverE
     if (pDriverEnvironment.get() == nullptr)
         throw ELibMCDriver_BuRInterfaceException(LIBMCDRIVER_BUR_ERROR_INVALIDPARAM);
 
+    if (nMaxPacketsInFlight > BUR_MAX_MAXPACKETSINFLIGHT)
+        throw ELibMCDriver_BuRInterfaceException(LIBMCDRIVER_BUR_ERROR_INVALIDMAXPACKETSINFLIGHT);
+
+    std::random_device randomDevice;
+    m_ClientIDGenerator.seed(randomDevice());
+
 }
 
 CDriver_BuRConnector::~CDriver_BuRConnector()
@@ -228,6 +234,15 @@ CDriver_BuRConnector::~CDriver_BuRConnector()
     m_pDriverEnvironment = nullptr;
 }
 
+void CDriver_BuRConnector::setMaxPacketsInFlight(uint32_t nMaxPacketsInFlight)
+{
+    if (nMaxPacketsInFlight > BUR_MAX_MAXPACKETSINFLIGHT)
+        throw ELibMCDriver_BuRInterfaceException(LIBMCDRIVER_BUR_ERROR_INVALIDMAXPACKETSINFLIGHT);
+
+    std::lock_guard<std::mutex> transactionLock(m_TransactionMutex);
+    m_nMaxPacketsInFlight = nMaxPacketsInFlight;
+}
+
 bool CDriver_BuRConnector::isLegacy()
 {
     return (m_ProtocolVersion == eDriver_BurProtocolVersion::Legacy);
@@ -296,22 +311,35 @@ void CDriver_BuRConnector::sendCommandsToPLC(std::vector<sAMCFToPLCPacketToSend>
 
 }
 
+uint32_t CDriver_BuRConnector::generateClientID()
+{
+    std::uniform_int_distribution<int> distribution(1, 1024 * 1024 * 1024);
+    return (uint32_t)distribution(m_ClientIDGenerator);
+}
+
 void CDriver_BuRConnector::sendCommandsToPLCVersion3(std::vector<sAMCFToPLCPacketToSend>& packetList)
 {
     if (packetList.empty())
         return;
 
-    if (m_pCurrentConnection == nullptr)
-        throw ELibMCDriver_BuRInterfaceException(LIBMCDRIVER_BUR_ERROR_NOTCONNECTED);
+    std::lock_guard<std::mutex> transactionLock(m_TransactionMutex);
 
-    std::default_random_engine generator;
-    std::uniform_int_distribution<int> distribution(1, 1024 * 1024 * 1024);
+    LibMCEnv::PTCPIPConnection pConnection;
+    {
+        std::lock_guard<std::mutex> lockGuard(m_ConnectionOrJournalMutex);
+        pConnection = m_pCurrentConnection;
+    }
+
+    if (pConnection == nullptr)
+        throw ELibMCDriver_BuRInterfaceException(LIBMCDRIVER_BUR_ERROR_NOTCONNECTED);
 
     std::vector<sAMCFToPLCPacketVersion3> TCPPacketList;
     std::vector<sAMCFToPLCPacketSendInfo> SendInfoList;
+    TCPPacketList.reserve(packetList.size());
+    SendInfoList.reserve(packetList.size());
 
     for (auto& packet : packetList) {
-        uint32_t nClientID = distribution(generator);
+        uint32_t nClientID = generateClientID();
 
         sAMCFToPLCPacketVersion3 TCPpacket;
         TCPpacket.m_nSignature = m_nPacketSignature;
@@ -333,63 +361,7 @@ void CDriver_BuRConnector::sendCommandsToPLCVersion3(std::vector<sAMCFToPLCPacke
         m_nSequenceID++;
     }
 
-    if (TCPPacketList.empty())
-        throw ELibMCDriver_BuRInterfaceException(LIBMCENV_ERROR_INTERNALERROR);
-
-    int index = 0;
-    for (auto& packetToSend : TCPPacketList) {
-        auto sendInfo = SendInfoList.at(index);
-
-        if (packetToSend.m_nSequenceID != sendInfo.m_SequenceID)
-            throw ELibMCDriver_BuRInterfaceException(LIBMCENV_ERROR_INTERNALERROR);
-
-        m_pCurrentConnection->SendBuffer (LibMCEnv::CInputVector<uint8_t> ((uint8_t*)&packetToSend, sizeof(sAMCFToPLCPacketVersion3)));
-        index++;
-
-
-    }
-
-    //index = 0;
-    for (auto& sendInfo : SendInfoList) {
-
-        //auto sendInfo = SendInfoList.at(index);
-
-        auto pReceivedPacket = m_pCurrentConnection->ReceiveFixedPacket(sizeof(sPLCToAMCFPacketVersion3), m_nReceiveTimeoutInMS);
-
-        std::vector<uint8_t> recvBuffer;
-        pReceivedPacket->GetData(recvBuffer);
-
-        if (recvBuffer.size() != sizeof(sPLCToAMCFPacketVersion3))
-            throw ELibMCDriver_BuRInterfaceException(LIBMCDRIVER_BUR_ERROR_RECEIVEERROR);
-
-        const sPLCToAMCFPacketVersion3* receivedPacket = (const sPLCToAMCFPacketVersion3*)recvBuffer.data();
-        if (receivedPacket->m_nSignature != m_nPacketSignature) {
-            disconnect();
-            throw ELibMCDriver_BuRInterfaceException(LIBMCDRIVER_BUR_ERROR_RECEIVEDINVALIDPACKETSIGNATURE);
-        }
-
-        auto pPacket = std::make_shared<CDriver_BuRPacket>(sendInfo.m_CommandID, receivedPacket->m_nErrorCode);
-
-        if (receivedPacket->m_nPayloadLength > BUR_MAX_PAYLOADLENGTH)
-            throw ELibMCDriver_BuRInterfaceException(LIBMCDRIVER_BUR_ERROR_RECEIVEDINVALIDPACKETLENGTH);
-
-        if (receivedPacket->m_nPayloadLength > 0) {
-            auto pPayloadPacket = m_pCurrentConnection->ReceiveFixedPacket(receivedPacket->m_nPayloadLength, m_nReceiveTimeoutInMS);
-            pPayloadPacket->GetData (pPacket->getDataBuffer());
-        }
-
-        if (sendInfo.m_SequenceID != receivedPacket->m_nSequenceID)
-            throw ELibMCDriver_BuRInterfaceException(LIBMCDRIVER_BUR_ERROR_INVALIDCLIENTSEQUENCEID);
-        if (sendInfo.m_ClientID != receivedPacket->m_nClientID)
-            throw ELibMCDriver_BuRInterfaceException(LIBMCDRIVER_BUR_ERROR_INVALIDCLIENTID);
-
-        if (sendInfo.m_Callback != nullptr) {
-            auto callback = sendInfo.m_Callback;
-            callback(pPacket.get());
-        }
-
-        //index++;
-    }
+    transmitPacketsPipelined(pConnection, (const uint8_t*)TCPPacketList.data(), sizeof(sAMCFToPLCPacketVersion3), SendInfoList);
 
 }
 
@@ -398,17 +370,24 @@ void CDriver_BuRConnector::sendCommandsToPLCLegacy(std::vector<sAMCFToPLCPacketT
     if (packetList.empty())
         return;
 
-    if (m_pCurrentConnection == nullptr)
-        throw ELibMCDriver_BuRInterfaceException(LIBMCDRIVER_BUR_ERROR_NOTCONNECTED);
+    std::lock_guard<std::mutex> transactionLock(m_TransactionMutex);
 
-    std::default_random_engine generator;
-    std::uniform_int_distribution<int> distribution(1, 1024 * 1024 * 1024);
+    LibMCEnv::PTCPIPConnection pConnection;
+    {
+        std::lock_guard<std::mutex> lockGuard(m_ConnectionOrJournalMutex);
+        pConnection = m_pCurrentConnection;
+    }
+
+    if (pConnection == nullptr)
+        throw ELibMCDriver_BuRInterfaceException(LIBMCDRIVER_BUR_ERROR_NOTCONNECTED);
 
     std::vector<sAMCFToPLCPacketLegacy> TCPPacketList;
     std::vector<sAMCFToPLCPacketSendInfo> SendInfoList;
+    TCPPacketList.reserve(packetList.size());
+    SendInfoList.reserve(packetList.size());
 
     for (auto& packet : packetList) {
-        uint32_t nClientID = distribution(generator);
+        uint32_t nClientID = generateClientID();
 
         sAMCFToPLCPacketLegacy TCPpacket;
         TCPpacket.m_nSignature = m_nPacketSignature;
@@ -434,63 +413,144 @@ void CDriver_BuRConnector::sendCommandsToPLCLegacy(std::vector<sAMCFToPLCPacketT
         m_nSequenceID++;
     }
 
-    if (TCPPacketList.empty())
-        throw ELibMCDriver_BuRInterfaceException(LIBMCENV_ERROR_INTERNALERROR);
+    transmitPacketsPipelined(pConnection, (const uint8_t*)TCPPacketList.data(), sizeof(sAMCFToPLCPacketLegacy), SendInfoList);
 
-    int index = 0;
-    for (auto& packetToSend : TCPPacketList) {
-        auto sendInfo = SendInfoList.at(index);
+}
 
-        if (packetToSend.m_nSequenceID != sendInfo.m_SequenceID)
-            throw ELibMCDriver_BuRInterfaceException(LIBMCENV_ERROR_INTERNALERROR);
+void CDriver_BuRConnector::transmitPacketsPipelined(LibMCEnv::PTCPIPConnection pConnection, const uint8_t* pSerializedPackets, size_t nPacketSize, std::vector<sAMCFToPLCPacketSendInfo>& sendInfoList)
+{
+    if ((pConnection.get() == nullptr) || (pSerializedPackets == nullptr) || (nPacketSize == 0))
+        throw ELibMCDriver_BuRInterfaceException(LIBMCDRIVER_BUR_ERROR_INVALIDPARAM);
 
-        m_pCurrentConnection->SendBuffer (LibMCEnv::CInputVector<uint8_t> ((uint8_t*)&packetToSend, sizeof(sAMCFToPLCPacketLegacy)));
-        index++;
+    // Packets are sent ahead of their responses, up to the in-flight window (by default the whole list). Every refill of the window
+    // is coalesced into one send call, and responses are matched to their requests by sequence ID.
+    std::map<uint32_t, sAMCFToPLCPacketSendInfo*> inFlightPackets;
 
-        
-    }
+    size_t nPacketCount = sendInfoList.size();
+    size_t nWindowSize = (m_nMaxPacketsInFlight > 0) ? m_nMaxPacketsInFlight : nPacketCount;
+    size_t nNextPacketToSend = 0;
+    size_t nReceivedPackets = 0;
 
-    //index = 0;
-    for (auto& sendInfo : SendInfoList) {
+    while (nReceivedPackets < nPacketCount) {
 
-        //auto sendInfo = SendInfoList.at(index);
+        size_t nFirstPacketToSend = nNextPacketToSend;
+        while ((nNextPacketToSend < nPacketCount) && (inFlightPackets.size() < nWindowSize)) {
+            auto& sendInfo = sendInfoList.at(nNextPacketToSend);
+            inFlightPackets.insert(std::make_pair(sendInfo.m_SequenceID, &sendInfo));
+            nNextPacketToSend++;
+        }
+
+        if (nNextPacketToSend > nFirstPacketToSend) {
+            const uint8_t* pSendData = pSerializedPackets + nFirstPacketToSend * nPacketSize;
+            size_t nSendSize = (nNextPacketToSend - nFirstPacketToSend) * nPacketSize;
+            pConnection->SendBuffer(LibMCEnv::CInputVector<uint8_t>(pSendData, nSendSize));
+        }
 
-        std::vector<uint8_t> recvBuffer;
-        auto pReceivedPacket = m_pCurrentConnection->ReceiveFixedPacket (sizeof(sPLCToAMCFPacketLegacy), m_nReceiveTimeoutInMS);
-        pReceivedPacket->GetData(recvBuffer);
+        if (inFlightPackets.empty())
+            throw ELibMCDriver_BuRInterfaceException(LIBMCDRIVER_BUR_ERROR_INVALIDMAXPACKETSINFLIGHT);
 
-        if (recvBuffer.size() != sizeof(sPLCToAMCFPacketLegacy))
+        sAMCFToPLCPacketSendInfo* pSendInfo = nullptr;
+        PDriver_BuRPacket pPacket;
+        if (m_ProtocolVersion == eDriver_BurProtocolVersion::Legacy)
+            pPacket = receiveResponseLegacy(pConnection, inFlightPackets, pSendInfo);
+        else
+            pPacket = receiveResponseVersion3(pConnection, inFlightPackets, pSendInfo);
+
+        if ((pPacket.get() == nullptr) || (pSendInfo == nullptr))
             throw ELibMCDriver_BuRInterfaceException(LIBMCDRIVER_BUR_ERROR_RECEIVEERROR);
 
-        const sPLCToAMCFPacketLegacy* receivedPacket = (const sPLCToAMCFPacketLegacy*)recvBuffer.data();
-        if (receivedPacket->m_nSignature != m_nPacketSignature) {
-            disconnect();
-            throw ELibMCDriver_BuRInterfaceException(LIBMCDRIVER_BUR_ERROR_RECEIVEDINVALIDPACKETSIGNATURE);
+        inFlightPackets.erase(pSendInfo->m_SequenceID);
+        nReceivedPackets++;
+
+        if (pSendInfo->m_Callback != nullptr) {
+            auto callback = pSendInfo->m_Callback;
+            callback(pPacket.get());
         }
 
-        auto pPacket = std::make_shared<CDriver_BuRPacket>(receivedPacket->m_nCommandID, receivedPacket->m_nErrorCode);
+    }
 
-        if (receivedPacket->m_nMessageLen < sizeof(sPLCToAMCFPacketLegacy))
-            throw ELibMCDriver_BuRInterfaceException(LIBMCDRIVER_BUR_ERROR_RECEIVEDINVALIDPACKETLENGTH);
+}
 
-        uint32_t nDataLen = (receivedPacket->m_nMessageLen - sizeof(sPLCToAMCFPacketLegacy));
-        if (nDataLen > 0) {
-            auto pPayloadData = m_pCurrentConnection->ReceiveFixedPacket(nDataLen, m_nReceiveTimeoutInMS);
-            pPayloadData->GetData(pPacket->getDataBuffer());
-        }
+PDriver_BuRPacket CDriver_BuRConnector::receiveResponseVersion3(LibMCEnv::PTCPIPConnection pConnection, std::map<uint32_t, sAMCFToPLCPacketSendInfo*>& inFlightPackets, sAMCFToPLCPacketSendInfo*& pSendInfo)
+{
+    auto pReceivedPacket = pConnection->ReceiveFixedPacket(sizeof(sPLCToAMCFPacketVersion3), m_nReceiveTimeoutInMS);
 
-        if (sendInfo.m_SequenceID != receivedPacket->m_nSequenceID)
-            throw ELibMCDriver_BuRInterfaceException(LIBMCDRIVER_BUR_ERROR_INVALIDCLIENTSEQUENCEID);
-        if (sendInfo.m_ClientID != receivedPacket->m_nClientID)
-            throw ELibMCDriver_BuRInterfaceException(LIBMCDRIVER_BUR_ERROR_INVALIDCLIENTID);
+    std::vector<uint8_t> recvBuffer;
+    pReceivedPacket->GetData(recvBuffer);
 
-        if (sendInfo.m_Callback != nullptr) {
-            auto callback = sendInfo.m_Callback;
-            callback(pPacket.get());
-        }
+    if (recvBuffer.size() != sizeof(sPLCToAMCFPacketVersion3))
+        throw ELibMCDriver_BuRInterfaceException(LIBMCDRIVER_BUR_ERROR_RECEIVEERROR);
+
+    const sPLCToAMCFPacketVersion3* receivedPacket = (const sPLCToAMCFPacketVersion3*)recvBuffer.data();
+    if (receivedPacket->m_nSignature != m_nPacketSignature) {
+        disconnect();
+        throw ELibMCDriver_BuRInterfaceException(LIBMCDRIVER_BUR_ERROR_RECEIVEDINVALIDPACKETSIGNATURE);
+    }
+
+    if (receivedPacket->m_nPayloadLength > BUR_MAX_PAYLOADLENGTH)
+        throw ELibMCDriver_BuRInterfaceException(LIBMCDRIVER_BUR_ERROR_RECEIVEDINVALIDPACKETLENGTH);
+
+    std::vector<uint8_t> payloadBuffer;
+    if (receivedPacket->m_nPayloadLength > 0) {
+        auto pPayloadPacket = pConnection->ReceiveFixedPacket(receivedPacket->m_nPayloadLength, m_nReceiveTimeoutInMS);
+        pPayloadPacket->GetData(payloadBuffer);
+    }
+
+    // Version 3 responses do not repeat the command ID, so the sequence ID identifies the request.
+    auto iIter = inFlightPackets.find(receivedPacket->m_nSequenceID);
+    if (iIter == inFlightPackets.end())
+        throw ELibMCDriver_BuRInterfaceException(LIBMCDRIVER_BUR_ERROR_INVALIDCLIENTSEQUENCEID, "received unexpected sequence id: " + std::to_string(receivedPacket->m_nSequenceID));
+
+    pSendInfo = iIter->second;
+    if (pSendInfo->m_ClientID != receivedPacket->m_nClientID)
+        throw ELibMCDriver_BuRInterfaceException(LIBMCDRIVER_BUR_ERROR_INVALIDCLIENTID);
+
+    auto pPacket = std::make_shared<CDriver_BuRPacket>(pSendInfo->m_CommandID, receivedPacket->m_nErrorCode);
+    pPacket->getDataBuffer().swap(payloadBuffer);
+
+    return pPacket;
+}
 
-        //index++;
+PDriver_BuRPacket CDriver_BuRConnector::receiveResponseLegacy(LibMCEnv::PTCPIPConnection pConnection, std::map<uint32_t, sAMCFToPLCPacketSendInfo*>& inFlightPackets, sAMCFToPLCPacketSendInfo*& pSendInfo)
+{
+    std::vector<uint8_t> recvBuffer;
+    auto pReceivedPacket = pConnection->ReceiveFixedPacket(sizeof(sPLCToAMCFPacketLegacy), m_nReceiveTimeoutInMS);
+    pReceivedPacket->GetData(recvBuffer);
+
+    if (recvBuffer.size() != sizeof(sPLCToAMCFPacketLegacy))
+        throw ELibMCDriver_BuRInterfaceException(LIBMCDRIVER_BUR_ERROR_RECEIVEERROR);
+
+    const sPLCToAMCFPacketLegacy* receivedPacket = (const sPLCToAMCFPacketLegacy*)recvBuffer.data();
+    if (receivedPacket->m_nSignature != m_nPacketSignature) {
+        disconnect();
+        throw ELibMCDriver_BuRInterfaceException(LIBMCDRIVER_BUR_ERROR_RECEIVEDINVALIDPACKETSIGNATURE);
     }
+
+    if (receivedPacket->m_nMessageLen < sizeof(sPLCToAMCFPacketLegacy))
+        throw ELibMCDriver_BuRInterfaceException(LIBMCDRIVER_BUR_ERROR_RECEIVEDINVALIDPACKETLENGTH);
+
+    auto pPacket = std::make_shared<CDriver_BuRPacket>(receivedPacket->m_nCommandID, receivedPacket->m_nErrorCode);
+
+    uint32_t nDataLen = (receivedPacket->m_nMessageLen - sizeof(sPLCToAMCFPacketLegacy));
+    if (nDataLen > BUR_MAX_PAYLOADLENGTH)
+        throw ELibMCDriver_BuRInterfaceException(LIBMCDRIVER_BUR_ERROR_RECEIVEDINVALIDPACKETLENGTH);
+
+    if (nDataLen > 0) {
+        auto pPayloadData = pConnection->ReceiveFixedPacket(nDataLen, m_nReceiveTimeoutInMS);
+        pPayloadData->GetData(pPacket->getDataBuffer());
+    }
+
+    auto iIter = inFlightPackets.find(receivedPacket->m_nSequenceID);
+    if (iIter == inFlightPackets.end())
+        throw ELibMCDriver_BuRInterfaceException(LIBMCDRIVER_BUR_ERROR_INVALIDCLIENTSEQUENCEID, "received unexpected sequence id: " + std::to_string(receivedPacket->m_nSequenceID));
+
+    pSendInfo = iIter->second;
+    if (pSendInfo->m_ClientID != receivedPacket->m_nClientID)
+        throw ELibMCDriver_BuRInterfaceException(LIBMCDRIVER_BUR_ERROR_INVALIDCLIENTID);
+    if (pSendInfo->m_CommandID != receivedPacket->m_nCommandID)
+        throw ELibMCDriver_BuRInterfaceException(LIBMCDRIVER_BUR_ERROR_RECEIVEDINVALIDCOMMANDID, "received invalid command id: " + std::to_string(receivedPacket->m_nCommandID));
+
+    return pPacket;
 }
 
 sAMCFToPLCPacketToSend CDriver_BuRConnector::makePacket(uint32_t nCommandID, BurPacketCallback callback)
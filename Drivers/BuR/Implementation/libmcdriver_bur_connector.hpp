@@ -45,6 +45,7 @@ Abstract: This is the class declaration of CDriver_BuR
 #include <memory>
 #include <queue>
 #include <functional>
+#include <random>
 
 #define BUR_MINCUSTOMCOMMANDID 1024
 #define BUR_MAXCUSTOMCOMMANDID 65535
@@ -69,6 +70,12 @@ Abstract: This is the class declaration of CDriver_BuR
 
 #define BUR_MAX_PAYLOADLENGTH (1024 * 1024)
 
+// 0: no limit, all packets of a transaction are sent before the first response is read
+#define BUR_DEFAULT_MAXPACKETSINFLIGHT 0
+#define BUR_MAX_MAXPACKETSINFLIGHT 1024
+
+struct sAMCFToPLCPacketSendInfo;
+
 namespace LibMCDriver_BuR {
 namespace Impl {
 
@@ -127,7 +134,8 @@ protected:
     uint32_t m_nPatchVersion;
     uint32_t m_nBuildVersion;
 
-    uint32_t m_nMaxPacketQueueSize;
+    // Number of packets that may be sent to the PLC before the first response has been received. 0 means no limit.
+    uint32_t m_nMaxPacketsInFlight;
     uint32_t m_nSequenceID;
     uint32_t m_nPacketSignature;
 
@@ -138,7 +146,10 @@ protected:
     LibMCEnv::PTCPIPConnection m_pCurrentConnection;
 
     std::mutex m_ConnectionOrJournalMutex;
-    std::mutex m_SequenceMapMutex;
+    // Serializes packet transactions, so that status queries and list executions do not interleave on the connection.
+    std::mutex m_TransactionMutex;
+
+    std::default_random_engine m_ClientIDGenerator;
 
     std::list<PDriver_BuRValue> m_DriverParameters;
     std::map<std::string, PDriver_BuRValue> m_DriverParameterMap;
@@ -153,10 +164,16 @@ protected:
     void sendCommandsToPLCLegacy(std::vector<sAMCFToPLCPacketToSend>& packetList);
     void sendCommandsToPLCVersion3(std::vector<sAMCFToPLCPacketToSend>& packetList);
 
+    void transmitPacketsPipelined(LibMCEnv::PTCPIPConnection pConnection, const uint8_t* pSerializedPackets, size_t nPacketSize, std::vector<sAMCFToPLCPacketSendInfo>& sendInfoList);
+    PDriver_BuRPacket receiveResponseLegacy(LibMCEnv::PTCPIPConnection pConnection, std::map<uint32_t, sAMCFToPLCPacketSendInfo*>& inFlightPackets, sAMCFToPLCPacketSendInfo*& pSendInfo);
+    PDriver_BuRPacket receiveResponseVersion3(LibMCEnv::PTCPIPConnection pConnection, std::map<uint32_t, sAMCFToPLCPacketSendInfo*>& inFlightPackets, sAMCFToPLCPacketSendInfo*& pSendInfo);
+
+    uint32_t generateClientID();
+
 
 public:
 
-	CDriver_BuRConnector (LibMCEnv::PDriverEnvironment pDriverEnvironment, uint32_t nWorkerThreadCount, uint32_t nMaxReceiveBufferSize, uint32_t nMajorVersion, uint32_t nMinorVersion, uint32_t nPatchVersion, uint32_t nBuildVersion, uint32_t nMaxPacketQueueSize, eDriver_BurProtocolVersion ProtocolVersion, uint32_t nPacketSignature);
+	CDriver_BuRConnector (LibMCEnv::PDriverEnvironment pDriverEnvironment, uint32_t nWorkerThreadCount, uint32_t nMaxReceiveBufferSize, uint32_t nMajorVersion, uint32_t nMinorVersion, uint32_t nPatchVersion, uint32_t nBuildVersion, uint32_t nMaxPacketsInFlight, eDriver_BurProtocolVersion ProtocolVersion, uint32_t nPacketSignature);
 
     virtual ~CDriver_BuRConnector();
 
@@ -170,6 +187,8 @@ public:
 
     void disconnect();
 
+    void setMaxPacketsInFlight(uint32_t nMaxPacketsInFlight);
+
     void sendCommandsToPLC(std::vector<sAMCFToPLCPacketToSend>& packetList);
 
     void sendCommandToPLC(uint32_t nCommandID, BurPacketCallback callback);
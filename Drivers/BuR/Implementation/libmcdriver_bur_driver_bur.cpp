@@ -133,7 +133,7 @@ CDriver_BuR::CDriver_BuR(const std::string& sName, LibMCEnv::PDriverEnvironment
        m_nMaxReceiveBufferSize (1024*1024),
        m_bIsQueryingParameters (false),
        m_SimulationMode (false),
-       m_nMaxPacketQueueSize(1024),
+       m_nMaxPacketsInFlight(BUR_DEFAULT_MAXPACKETSINFLIGHT),
        m_InitMachineCommandID(DRIVER_BUR_DEFAULT_INITMACHINECOMMANDID)
 
 {  
@@ -330,7 +330,19 @@ void CDriver_BuR::Configure(const std::string& sConfigurationString)
 
     }
 
-    m_pConnector = std::make_shared<CDriver_BuRConnector>(m_pDriverEnvironment, m_nWorkerThreadCount, m_nMaxReceiveBufferSize, m_nMajorVersion, m_nMinorVersion, m_nPatchVersion, m_nBuildVersion, m_nMaxPacketQueueSize, m_ProtocolVersion, m_nPacketSignature); 
+    // Optional: number of packets that are sent ahead without waiting for the PLC's responses. Only needed
+    // for PLCs that cannot buffer a whole list; by default all packets are sent before the first response is read.
+    pugi::xml_node pipeliningNode = burprotocolNode.child("pipelining");
+    if (!pipeliningNode.empty()) {
+        auto maxPacketsInFlightAttrib = pipeliningNode.attribute("maxpacketsinflight");
+        if (!maxPacketsInFlightAttrib.empty()) {
+            m_nMaxPacketsInFlight = maxPacketsInFlightAttrib.as_uint(0);
+            if (m_nMaxPacketsInFlight > BUR_MAX_MAXPACKETSINFLIGHT)
+                throw ELibMCDriver_BuRInterfaceException(LIBMCDRIVER_BUR_ERROR_INVALIDMAXPACKETSINFLIGHT, "invalid maximum number of packets in flight: " + std::string(maxPacketsInFlightAttrib.as_string()));
+        }
+    }
+
+    m_pConnector = std::make_shared<CDriver_BuRConnector>(m_pDriverEnvironment, m_nWorkerThreadCount, m_nMaxReceiveBufferSize, m_nMajorVersion, m_nMinorVersion, m_nPatchVersion, m_nBuildVersion, m_nMaxPacketsInFlight, m_ProtocolVersion, m_nPacketSignature); 
 
 
 }
@@ -465,6 +477,16 @@ void CDriver_BuR::Disconnect()
         m_pConnector->disconnect(); 
 }
 
+void CDriver_BuR::SetMaxPacketsInFlight(const LibMCDriver_BuR_uint32 nMaxPacketsInFlight)
+{
+    if (nMaxPacketsInFlight > BUR_MAX_MAXPACKETSINFLIGHT)
+        throw ELibMCDriver_BuRInterfaceException(LIBMCDRIVER_BUR_ERROR_INVALIDMAXPACKETSINFLIGHT, "invalid maximum number of packets in flight: " + std::to_string(nMaxPacketsInFlight));
+
+    m_nMaxPacketsInFlight = nMaxPacketsInFlight;
+    if (m_pConnector.get() != nullptr)
+        m_pConnector->setMaxPacketsInFlight(nMaxPacketsInFlight);
+}
+
 void CDriver_BuR::ReinitializeMachine()
 {
     if (!m_SimulationMode) {
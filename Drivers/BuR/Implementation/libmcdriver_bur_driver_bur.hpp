@@ -81,7 +81,7 @@ protected:
     uint32_t m_nPatchVersion;
     uint32_t m_nBuildVersion;   
 
-    uint32_t m_nMaxPacketQueueSize;
+    uint32_t m_nMaxPacketsInFlight;
     uint32_t m_InitMachineCommandID;
 
     bool m_bIsQueryingParameters;
@@ -119,6 +119,8 @@ public:
 
     void Disconnect() override;
 
+    void SetMaxPacketsInFlight(const LibMCDriver_BuR_uint32 nMaxPacketsInFlight) override;
+
     void ReinitializeMachine() override;
 
     IPLCCommandList* CreateCommandList() override;
@@ -265,6 +265,15 @@ LIBMCDRIVER_BUR_DECLSPEC LibMCDriver_BuRResult libmcdriver_bur_driver_bur_connec
 */
 LIBMCDRIVER_BUR_DECLSPEC LibMCDriver_BuRResult libmcdriver_bur_driver_bur_disconnect(LibMCDriver_BuR_Driver_BuR pDriver_BuR);
 
+/**
+* Limits the number of packets that are sent to the PLC before their responses have been received. Only needed for PLCs that cannot buffer a whole command list.
+*
+* @param[in] pDriver_BuR - Driver_BuR instance.
+* @param[in] nMaxPacketsInFlight - Maximum number of packets in flight. 0 sends all packets of a list before the first response is read (default).
+* @return error code or 0 (success)
+*/
+LIBMCDRIVER_BUR_DECLSPEC LibMCDriver_BuRResult libmcdriver_bur_driver_bur_setmaxpacketsinflight(LibMCDriver_BuR_Driver_BuR pDriver_BuR, LibMCDriver_BuR_uint32 nMaxPacketsInFlight);
+
 /**
 * Sends the machine initialization command.
 *
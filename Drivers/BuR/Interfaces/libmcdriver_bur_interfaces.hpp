@@ -422,6 +422,12 @@ public:
 	*/
 	virtual void Disconnect() = 0;
 
+	/**
+	* IDriver_BuR::SetMaxPacketsInFlight - Limits the number of packets that are sent to the PLC before their responses have been received. Only needed for PLCs that cannot buffer a whole command list.
+	* @param[in] nMaxPacketsInFlight - Maximum number of packets in flight. 0 sends all packets of a list before the first response is read (default).
+	*/
+	virtual void SetMaxPacketsInFlight(const LibMCDriver_BuR_uint32 nMaxPacketsInFlight) = 0;
+
 	/**
 	* IDriver_BuR::ReinitializeMachine - Sends the machine initialization command.
 	*/
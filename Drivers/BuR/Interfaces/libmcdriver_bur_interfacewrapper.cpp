@@ -682,6 +682,30 @@ LibMCDriver_BuRResult libmcdriver_bur_driver_bur_disconnect(LibMCDriver_BuR_Driv
 	}
 }
 
+LibMCDriver_BuRResult libmcdriver_bur_driver_bur_setmaxpacketsinflight(LibMCDriver_BuR_Driver_BuR pDriver_BuR, LibMCDriver_BuR_uint32 nMaxPacketsInFlight)
+{
+	IBase* pIBaseClass = (IBase *)pDriver_BuR;
+
+	try {
+		IDriver_BuR* pIDriver_BuR = dynamic_cast<IDriver_BuR*>(pIBaseClass);
+		if (!pIDriver_BuR)
+			throw ELibMCDriver_BuRInterfaceException(LIBMCDRIVER_BUR_ERROR_INVALIDCAST);
+		
+		pIDriver_BuR->SetMaxPacketsInFlight(nMaxPacketsInFlight);
+
+		return LIBMCDRIVER_BUR_SUCCESS;
+	}
+	catch (ELibMCDriver_BuRInterfaceException & Exception) {
+		return handleLibMCDriver_BuRException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
 LibMCDriver_BuRResult libmcdriver_bur_driver_bur_reinitializemachine(LibMCDriver_BuR_Driver_BuR pDriver_BuR)
 {
 	IBase* pIBaseClass = (IBase *)pDriver_BuR;
@@ -892,6 +916,8 @@ LibMCDriver_BuRResult LibMCDriver_BuR::Impl::LibMCDriver_BuR_GetProcAddress (con
 		*ppProcAddress = (void*) &libmcdriver_bur_driver_bur_connect;
 	if (sProcName == "libmcdriver_bur_driver_bur_disconnect") 
 		*ppProcAddress = (void*) &libmcdriver_bur_driver_bur_disconnect;
+	if (sProcName == "libmcdriver_bur_driver_bur_setmaxpacketsinflight") 
+		*ppProcAddress = (void*) &libmcdriver_bur_driver_bur_setmaxpacketsinflight;
 	if (sProcName == "libmcdriver_bur_driver_bur_reinitializemachine") 
 		*ppProcAddress = (void*) &libmcdriver_bur_driver_bur_reinitializemachine;
 	if (sProcName == "libmcdriver_bur_driver_bur_createcommandlist") 
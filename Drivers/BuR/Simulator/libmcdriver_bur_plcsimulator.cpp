@@ -0,0 +1,575 @@
+/*++
+
+Copyright (C) 2020 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the Autodesk Inc. nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 'AS IS' AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+/*
+ Loopback PLC for the B&R driver. Listens on a TCP port and answers the packets of
+ the legacy or the version 3 protocol like the PLC task does: lists can be begun,
+ filled with custom commands, executed, queried and deleted, and the journal and
+ machine status commands return empty records. Every response is delayed by the
+ given latency, measured from the arrival of its request, which models the network
+ round trip without serializing the requests. Lets the driver be tested and
+ benchmarked on a machine without PLC.
+
+ For testing the pipelining of the driver, the simulator checks that the sequence IDs
+ of a connection arrive in ascending order, and --maxinflight checks that no more
+ requests are outstanding than the driver's window allows. --reorder 1 answers each
+ batch of due responses in reverse order, so the driver has to match responses to
+ their requests. After a violation, every list reports a failed status and never
+ finishes.
+
+ Usage: bur_plcsimulator [--port 12000] [--protocol version3|legacy] [--signature N]
+                         [--latency milliseconds] [--schema journalschema.json]
+                         [--statussize bytes] [--maxinflight N] [--reorder 0|1]
+*/
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+
+#include <windows.h>
+#include <winsock2.h>
+#include <ws2tcpip.h>
+
+typedef SOCKET simulatorSocket;
+#define SIMULATOR_INVALIDSOCKET INVALID_SOCKET
+#define simulatorCloseSocket closesocket
+#else
+#include <sys/socket.h>
+#include <sys/select.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+
+typedef int simulatorSocket;
+#define SIMULATOR_INVALIDSOCKET -1
+#define simulatorCloseSocket close
+#endif //_WIN32
+
+#include "crcpp/CRC.h"
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <deque>
+#include <map>
+#include <chrono>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+#include <stdexcept>
+
+// Must match the direct command IDs of libmcdriver_bur_connector.hpp
+#define BURSIMULATOR_COMMAND_BEGINLIST 101
+#define BURSIMULATOR_COMMAND_FINISHLIST 102
+#define BURSIMULATOR_COMMAND_EXECUTELIST 103
+#define BURSIMULATOR_COMMAND_LISTSTATUS 105
+#define BURSIMULATOR_COMMAND_ABORTLIST 106
+#define BURSIMULATOR_COMMAND_MACHINESTATUSLEGACY 108
+#define BURSIMULATOR_COMMAND_DELETELIST 112
+#define BURSIMULATOR_COMMAND_CURRENTJOURNALSTATUS 120
+#define BURSIMULATOR_COMMAND_CURRENTJOURNALSCHEMA 121
+#define BURSIMULATOR_MINCUSTOMCOMMANDID 1024
+
+#define BURSIMULATOR_LISTSTATUS_INPROGRESS 1
+#define BURSIMULATOR_LISTSTATUS_FINISHED 6
+#define BURSIMULATOR_LISTSTATUS_FAILED 7
+
+#define BURSIMULATOR_ERROR_NOERROR 0
+#define BURSIMULATOR_ERROR_INVALIDCHECKSUM 1
+#define BURSIMULATOR_ERROR_INVALIDLIST 2
+
+#define BURSIMULATOR_SIGNATURE_LEGACY 0xAB
+
+#pragma pack(push)
+#pragma pack(1)
+
+struct sBuRSimulatorRequestLegacy {
+	uint32_t m_nSignature;
+	uint8_t m_nMajorVersion;
+	uint8_t m_nMinorVersion;
+	uint8_t m_nPatchVersion;
+	uint8_t m_nBuildVersion;
+	uint32_t m_nClientID;
+	uint32_t m_nSequenceID;
+	uint32_t m_nCommandID;
+	uint8_t m_Payload[24];
+	uint32_t m_nChecksum;
+};
+
+struct sBuRSimulatorResponseLegacy {
+	uint32_t m_nSignature;
+	uint8_t m_nMajorVersion;
+	uint8_t m_nMinorVersion;
+	uint8_t m_nPatchVersion;
+	uint8_t m_nBuildVersion;
+	uint32_t m_nClientID;
+	uint32_t m_nSequenceID;
+	uint32_t m_nErrorCode;
+	uint32_t m_nCommandID;
+	uint32_t m_nMessageLen;
+	uint32_t m_nHeaderChecksum;
+	uint32_t m_nDataChecksum;
+};
+
+struct sBuRSimulatorRequestVersion3 {
+	uint32_t m_nSignature;
+	uint32_t m_nClientID;
+	uint32_t m_nSequenceID;
+	uint32_t m_nCommandID;
+	uint8_t m_Payload[24];
+	uint32_t m_nChecksum;
+};
+
+struct sBuRSimulatorResponseVersion3 {
+	uint32_t m_nSignature;
+	uint32_t m_nClientID;
+	uint32_t m_nSequenceID;
+	uint32_t m_nErrorCode;
+	uint32_t m_nPayloadLength;
+	uint32_t m_nHeaderChecksum;
+	uint32_t m_nDataChecksum;
+};
+
+#pragma pack(pop)
+
+typedef std::chrono::steady_clock::time_point simulatorTimePoint;
+
+struct sBuRSimulatorPendingResponse {
+	simulatorTimePoint m_DueTime;
+	std::vector<uint8_t> m_Data;
+};
+
+struct sBuRSimulatorList {
+	uint32_t m_nCommandCount;
+	bool m_bExecuted;
+};
+
+class CBuRPLCSimulator {
+private:
+
+	bool m_bIsLegacy;
+	uint32_t m_nSignature;
+	std::chrono::milliseconds m_Latency;
+	std::string m_sJournalSchema;
+	uint32_t m_nMachineStatusSize;
+
+	uint32_t m_nNextListID;
+	uint32_t m_nCurrentListID;
+	std::map<uint32_t, sBuRSimulatorList> m_Lists;
+
+	uint64_t m_nReceivedPackets;
+
+	// Pipelining checks of the current connection
+	bool m_bReorderResponses;
+	uint32_t m_nMaxPacketsInFlight;
+	bool m_bHasSequenceID;
+	uint32_t m_nLastSequenceID;
+	uint32_t m_nOutstandingRequests;
+	uint32_t m_nMaxOutstandingRequests;
+	bool m_bProtocolViolation;
+
+	void checkRequest(uint32_t nSequenceID)
+	{
+		if (m_bHasSequenceID && (nSequenceID <= m_nLastSequenceID)) {
+			std::cout << "protocol violation: sequence ID " << nSequenceID << " received after " << m_nLastSequenceID << std::endl;
+			m_bProtocolViolation = true;
+		}
+		m_bHasSequenceID = true;
+		m_nLastSequenceID = nSequenceID;
+
+		m_nOutstandingRequests++;
+		if (m_nOutstandingRequests > m_nMaxOutstandingRequests)
+			m_nMaxOutstandingRequests = m_nOutstandingRequests;
+
+		if ((m_nMaxPacketsInFlight > 0) && (m_nOutstandingRequests > m_nMaxPacketsInFlight)) {
+			if (!m_bProtocolViolation)
+				std::cout << "protocol violation: more than " << m_nMaxPacketsInFlight << " requests in flight" << std::endl;
+			m_bProtocolViolation = true;
+		}
+	}
+
+	uint32_t handleCommand(uint32_t nCommandID, const uint8_t* pPayload, std::vector<uint8_t>& responseData)
+	{
+		uint32_t nParameter0;
+		memcpy(&nParameter0, pPayload, sizeof(nParameter0));
+
+		switch (nCommandID) {
+		case BURSIMULATOR_COMMAND_BEGINLIST: {
+			m_nCurrentListID = m_nNextListID++;
+			m_Lists[m_nCurrentListID] = { 0, false };
+			responseData.resize(sizeof(uint32_t));
+			memcpy(responseData.data(), &m_nCurrentListID, sizeof(uint32_t));
+			return BURSIMULATOR_ERROR_NOERROR;
+		}
+
+		case BURSIMULATOR_COMMAND_FINISHLIST:
+		case BURSIMULATOR_COMMAND_ABORTLIST:
+			return (m_Lists.find(nParameter0) != m_Lists.end()) ? BURSIMULATOR_ERROR_NOERROR : BURSIMULATOR_ERROR_INVALIDLIST;
+
+		case BURSIMULATOR_COMMAND_EXECUTELIST: {
+			auto iIter = m_Lists.find(nParameter0);
+			if (iIter == m_Lists.end())
+				return BURSIMULATOR_ERROR_INVALIDLIST;
+			iIter->second.m_bExecuted = true;
+			return BURSIMULATOR_ERROR_NOERROR;
+		}
+
+		case BURSIMULATOR_COMMAND_LISTSTATUS: {
+			auto iIter = m_Lists.find(nParameter0);
+			if (iIter == m_Lists.end())
+				return BURSIMULATOR_ERROR_INVALIDLIST;
+			if (m_bProtocolViolation)
+				responseData.push_back(BURSIMULATOR_LISTSTATUS_FAILED);
+			else
+				responseData.push_back(iIter->second.m_bExecuted ? BURSIMULATOR_LISTSTATUS_FINISHED : BURSIMULATOR_LISTSTATUS_INPROGRESS);
+			return BURSIMULATOR_ERROR_NOERROR;
+		}
+
+		case BURSIMULATOR_COMMAND_DELETELIST:
+			m_Lists.erase(nParameter0);
+			return BURSIMULATOR_ERROR_NOERROR;
+
+		case BURSIMULATOR_COMMAND_MACHINESTATUSLEGACY:
+			responseData.resize(m_nMachineStatusSize, 0);
+			return BURSIMULATOR_ERROR_NOERROR;
+
+		case BURSIMULATOR_COMMAND_CURRENTJOURNALSTATUS:
+			// Empty status record: zero groups
+			responseData.resize(sizeof(uint32_t), 0);
+			return BURSIMULATOR_ERROR_NOERROR;
+
+		case BURSIMULATOR_COMMAND_CURRENTJOURNALSCHEMA:
+			responseData.assign(m_sJournalSchema.begin(), m_sJournalSchema.end());
+			return BURSIMULATOR_ERROR_NOERROR;
+
+		default:
+			if (nCommandID >= BURSIMULATOR_MINCUSTOMCOMMANDID) {
+				auto iIter = m_Lists.find(m_nCurrentListID);
+				if (iIter != m_Lists.end())
+					iIter->second.m_nCommandCount++;
+			}
+			return BURSIMULATOR_ERROR_NOERROR;
+		}
+	}
+
+	std::vector<uint8_t> handleRequestLegacy(const sBuRSimulatorRequestLegacy& request)
+	{
+		std::vector<uint8_t> responseData;
+		uint32_t nErrorCode = BURSIMULATOR_ERROR_INVALIDCHECKSUM;
+		if (request.m_nChecksum == CRC::Calculate(&request, offsetof(sBuRSimulatorRequestLegacy, m_nChecksum), CRC::CRC_32()))
+			nErrorCode = handleCommand(request.m_nCommandID, request.m_Payload, responseData);
+
+		sBuRSimulatorResponseLegacy response;
+		response.m_nSignature = m_nSignature;
+		response.m_nMajorVersion = request.m_nMajorVersion;
+		response.m_nMinorVersion = request.m_nMinorVersion;
+		response.m_nPatchVersion = request.m_nPatchVersion;
+		response.m_nBuildVersion = request.m_nBuildVersion;
+		response.m_nClientID = request.m_nClientID;
+		response.m_nSequenceID = request.m_nSequenceID;
+		response.m_nErrorCode = nErrorCode;
+		response.m_nCommandID = request.m_nCommandID;
+		response.m_nMessageLen = (uint32_t)(sizeof(sBuRSimulatorResponseLegacy) + responseData.size());
+		response.m_nHeaderChecksum = CRC::Calculate(&response, offsetof(sBuRSimulatorResponseLegacy, m_nHeaderChecksum), CRC::CRC_32());
+		response.m_nDataChecksum = CRC::Calculate(responseData.data(), responseData.size(), CRC::CRC_32());
+
+		return serializeResponse(&response, sizeof(response), responseData);
+	}
+
+	std::vector<uint8_t> handleRequestVersion3(const sBuRSimulatorRequestVersion3& request)
+	{
+		std::vector<uint8_t> responseData;
+		uint32_t nErrorCode = BURSIMULATOR_ERROR_INVALIDCHECKSUM;
+		if (request.m_nChecksum == CRC::Calculate(&request, offsetof(sBuRSimulatorRequestVersion3, m_nChecksum), CRC::CRC_32()))
+			nErrorCode = handleCommand(request.m_nCommandID, request.m_Payload, responseData);
+
+		sBuRSimulatorResponseVersion3 response;
+		response.m_nSignature = m_nSignature;
+		response.m_nClientID = request.m_nClientID;
+		response.m_nSequenceID = request.m_nSequenceID;
+		response.m_nErrorCode = nErrorCode;
+		response.m_nPayloadLength = (uint32_t)responseData.size();
+		response.m_nHeaderChecksum = CRC::Calculate(&response, offsetof(sBuRSimulatorResponseVersion3, m_nHeaderChecksum), CRC::CRC_32());
+		response.m_nDataChecksum = CRC::Calculate(responseData.data(), responseData.size(), CRC::CRC_32());
+
+		return serializeResponse(&response, sizeof(response), responseData);
+	}
+
+	static std::vector<uint8_t> serializeResponse(const void* pHeader, size_t nHeaderSize, const std::vector<uint8_t>& responseData)
+	{
+		std::vector<uint8_t> buffer(nHeaderSize + responseData.size());
+		memcpy(buffer.data(), pHeader, nHeaderSize);
+		if (!responseData.empty())
+			memcpy(buffer.data() + nHeaderSize, responseData.data(), responseData.size());
+		return buffer;
+	}
+
+	static bool sendAll(simulatorSocket clientSocket, const uint8_t* pData, size_t nSize)
+	{
+		while (nSize > 0) {
+			int nSent = send(clientSocket, (const char*)pData, (int)nSize, 0);
+			if (nSent <= 0)
+				return false;
+			pData += nSent;
+			nSize -= (size_t)nSent;
+		}
+		return true;
+	}
+
+public:
+
+	CBuRPLCSimulator(bool bIsLegacy, uint32_t nSignature, uint32_t nLatencyInMS, const std::string& sJournalSchema, uint32_t nMachineStatusSize, uint32_t nMaxPacketsInFlight, bool bReorderResponses)
+		: m_bIsLegacy(bIsLegacy), m_nSignature(nSignature), m_Latency(nLatencyInMS), m_sJournalSchema(sJournalSchema),
+		m_nMachineStatusSize(nMachineStatusSize), m_nNextListID(1), m_nCurrentListID(0), m_nReceivedPackets(0),
+		m_bReorderResponses(bReorderResponses), m_nMaxPacketsInFlight(nMaxPacketsInFlight), m_bHasSequenceID(false),
+		m_nLastSequenceID(0), m_nOutstandingRequests(0), m_nMaxOutstandingRequests(0), m_bProtocolViolation(false)
+	{
+	}
+
+	void serveConnection(simulatorSocket clientSocket)
+	{
+		size_t nRequestSize = m_bIsLegacy ? sizeof(sBuRSimulatorRequestLegacy) : sizeof(sBuRSimulatorRequestVersion3);
+
+		std::vector<uint8_t> receiveBuffer;
+		std::deque<sBuRSimulatorPendingResponse> pendingResponses;
+		std::vector<uint8_t> chunk(64 * 1024);
+
+		m_nReceivedPackets = 0;
+		m_bHasSequenceID = false;
+		m_nLastSequenceID = 0;
+		m_nOutstandingRequests = 0;
+		m_nMaxOutstandingRequests = 0;
+		m_bProtocolViolation = false;
+		auto startTime = std::chrono::steady_clock::now();
+
+		while (true) {
+
+			// Wait for new requests until the oldest pending response is due
+			fd_set readSet;
+			FD_ZERO(&readSet);
+			FD_SET(clientSocket, &readSet);
+
+			struct timeval timeOut = { 1, 0 };
+			if (!pendingResponses.empty()) {
+				auto waitTime = std::chrono::duration_cast<std::chrono::microseconds> (pendingResponses.front().m_DueTime - std::chrono::steady_clock::now());
+				int64_t nWaitTimeInUS = (waitTime.count() > 0) ? waitTime.count() : 0;
+				timeOut.tv_sec = (long)(nWaitTimeInUS / 1000000);
+				timeOut.tv_usec = (long)(nWaitTimeInUS % 1000000);
+			}
+
+			int nSelectResult = select((int)clientSocket + 1, &readSet, nullptr, nullptr, &timeOut);
+			if (nSelectResult < 0)
+				break;
+
+			if ((nSelectResult > 0) && FD_ISSET(clientSocket, &readSet)) {
+				int nReceived = recv(clientSocket, (char*)chunk.data(), (int)chunk.size(), 0);
+				if (nReceived <= 0)
+					break;
+
+				auto arrivalTime = std::chrono::steady_clock::now();
+				receiveBuffer.insert(receiveBuffer.end(), chunk.begin(), chunk.begin() + nReceived);
+
+				size_t nOffset = 0;
+				while (receiveBuffer.size() - nOffset >= nRequestSize) {
+					uint32_t nReceivedSignature;
+					memcpy(&nReceivedSignature, receiveBuffer.data() + nOffset, sizeof(uint32_t));
+					if (nReceivedSignature != m_nSignature) {
+						std::cout << "received invalid packet signature: " << nReceivedSignature << std::endl;
+						return;
+					}
+
+					sBuRSimulatorPendingResponse pendingResponse;
+					pendingResponse.m_DueTime = arrivalTime + m_Latency;
+					if (m_bIsLegacy) {
+						sBuRSimulatorRequestLegacy request;
+						memcpy(&request, receiveBuffer.data() + nOffset, sizeof(request));
+						checkRequest(request.m_nSequenceID);
+						pendingResponse.m_Data = handleRequestLegacy(request);
+					}
+					else {
+						sBuRSimulatorRequestVersion3 request;
+						memcpy(&request, receiveBuffer.data() + nOffset, sizeof(request));
+						checkRequest(request.m_nSequenceID);
+						pendingResponse.m_Data = handleRequestVersion3(request);
+					}
+					pendingResponses.push_back(std::move(pendingResponse));
+
+					nOffset += nRequestSize;
+					m_nReceivedPackets++;
+				}
+				receiveBuffer.erase(receiveBuffer.begin(), receiveBuffer.begin() + nOffset);
+			}
+
+			// Coalesce all due responses into one send
+			std::vector<uint8_t> sendBuffer;
+			auto currentTime = std::chrono::steady_clock::now();
+			size_t nDueResponses = 0;
+			while ((nDueResponses < pendingResponses.size()) && (pendingResponses.at(nDueResponses).m_DueTime <= currentTime))
+				nDueResponses++;
+
+			for (size_t nIndex = 0; nIndex < nDueResponses; nIndex++) {
+				auto& responseData = pendingResponses.at(m_bReorderResponses ? (nDueResponses - 1 - nIndex) : nIndex).m_Data;
+				sendBuffer.insert(sendBuffer.end(), responseData.begin(), responseData.end());
+			}
+			pendingResponses.erase(pendingResponses.begin(), pendingResponses.begin() + nDueResponses);
+			m_nOutstandingRequests -= (uint32_t)nDueResponses;
+
+			if (!sendBuffer.empty()) {
+				if (!sendAll(clientSocket, sendBuffer.data(), sendBuffer.size()))
+					break;
+			}
+		}
+
+		auto duration = std::chrono::duration_cast<std::chrono::milliseconds> (std::chrono::steady_clock::now() - startTime);
+		std::cout << "connection closed after " << m_nReceivedPackets << " packets in " << duration.count() << " ms, at most " << m_nMaxOutstandingRequests << " requests in flight" << std::endl;
+		if (m_bProtocolViolation)
+			std::cout << "connection had protocol violations" << std::endl;
+	}
+
+};
+
+
+int main(int argc, char** argv)
+{
+	uint32_t nPort = 12000;
+	bool bIsLegacy = false;
+	uint32_t nSignature = 0;
+	uint32_t nLatencyInMS = 0;
+	uint32_t nMachineStatusSize = 1024;
+	uint32_t nMaxPacketsInFlight = 0;
+	bool bReorderResponses = false;
+	std::string sJournalSchema = "{\"schema\":\"amcf_plcsimulator\",\"groups\":[]}";
+
+	try {
+		for (int nIndex = 1; nIndex < argc; nIndex++) {
+			std::string sArgument = argv[nIndex];
+			if (nIndex + 1 >= argc)
+				throw std::runtime_error("missing value for " + sArgument);
+			std::string sValue = argv[++nIndex];
+
+			if (sArgument == "--port")
+				nPort = (uint32_t)std::stoul(sValue);
+			else if (sArgument == "--protocol") {
+				if (sValue == "legacy")
+					bIsLegacy = true;
+				else if (sValue == "version3")
+					bIsLegacy = false;
+				else
+					throw std::runtime_error("invalid protocol: " + sValue);
+			}
+			else if (sArgument == "--signature")
+				nSignature = (uint32_t)std::stoul(sValue, nullptr, 0);
+			else if (sArgument == "--latency")
+				nLatencyInMS = (uint32_t)std::stoul(sValue);
+			else if (sArgument == "--statussize")
+				nMachineStatusSize = (uint32_t)std::stoul(sValue);
+			else if (sArgument == "--maxinflight")
+				nMaxPacketsInFlight = (uint32_t)std::stoul(sValue);
+			else if (sArgument == "--reorder")
+				bReorderResponses = (std::stoul(sValue) != 0);
+			else if (sArgument == "--schema") {
+				std::ifstream schemaFile(sValue);
+				if (!schemaFile)
+					throw std::runtime_error("could not open journal schema: " + sValue);
+				std::stringstream schemaStream;
+				schemaStream << schemaFile.rdbuf();
+				sJournalSchema = schemaStream.str();
+			}
+			else
+				throw std::runtime_error("unknown argument: " + sArgument);
+		}
+
+		if (bIsLegacy)
+			nSignature = BURSIMULATOR_SIGNATURE_LEGACY;
+		if (nSignature == 0)
+			throw std::runtime_error("the version 3 protocol needs the packet signature of the driver configuration (--signature)");
+	}
+	catch (std::exception& E) {
+		std::cout << "error: " << E.what() << std::endl;
+		std::cout << "usage: bur_plcsimulator [--port 12000] [--protocol version3|legacy] [--signature N] [--latency milliseconds] [--schema journalschema.json] [--statussize bytes] [--maxinflight N] [--reorder 0|1]" << std::endl;
+		return 1;
+	}
+
+#ifdef _WIN32
+	WSADATA wsaData;
+	if (WSAStartup(MAKEWORD(2, 2), &wsaData) != 0) {
+		std::cout << "error: could not initialize winsock" << std::endl;
+		return 1;
+	}
+#endif //_WIN32
+
+	simulatorSocket listenSocket = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+	if (listenSocket == SIMULATOR_INVALIDSOCKET) {
+		std::cout << "error: could not create socket" << std::endl;
+		return 1;
+	}
+
+	int nReuseAddress = 1;
+	setsockopt(listenSocket, SOL_SOCKET, SO_REUSEADDR, (const char*)&nReuseAddress, sizeof(nReuseAddress));
+
+	struct sockaddr_in listenAddress;
+	memset(&listenAddress, 0, sizeof(listenAddress));
+	listenAddress.sin_family = AF_INET;
+	listenAddress.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+	listenAddress.sin_port = htons((uint16_t)nPort);
+
+	if ((bind(listenSocket, (struct sockaddr*)&listenAddress, sizeof(listenAddress)) != 0) || (listen(listenSocket, 1) != 0)) {
+		std::cout << "error: could not listen on port " << nPort << std::endl;
+		simulatorCloseSocket(listenSocket);
+		return 1;
+	}
+
+	std::cout << "simulating " << (bIsLegacy ? "legacy" : "version 3") << " PLC on 127.0.0.1:" << nPort << " with " << nLatencyInMS << " ms latency" << std::endl;
+
+	CBuRPLCSimulator simulator(bIsLegacy, nSignature, nLatencyInMS, sJournalSchema, nMachineStatusSize, nMaxPacketsInFlight, bReorderResponses);
+
+	while (true) {
+		simulatorSocket clientSocket = accept(listenSocket, nullptr, nullptr);
+		if (clientSocket == SIMULATOR_INVALIDSOCKET)
+			break;
+
+		int nNoDelay = 1;
+		setsockopt(clientSocket, IPPROTO_TCP, TCP_NODELAY, (const char*)&nNoDelay, sizeof(nNoDelay));
+
+		std::cout << "client connected" << std::endl;
+		simulator.serveConnection(clientSocket);
+		simulatorCloseSocket(clientSocket);
+	}
+
+	simulatorCloseSocket(listenSocket);
+
+#ifdef _WIN32
+	WSACleanup();
+#endif //_WIN32
+
+	return 0;
+}
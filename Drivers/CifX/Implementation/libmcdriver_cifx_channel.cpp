@@ -35,6 +35,7 @@ Abstract: This is a stub class definition of CChannelInformation
 #include "libmcdriver_cifx_interfaceexception.hpp"
 
 #include <iostream>
+#include <cstring>
 
 #define CIFX_MAXINPUTSIZE (1024 * 1024)
 #define CIFX_MAXOUTPUTSIZE (1024 * 1024)
@@ -131,6 +132,17 @@ void CDriver_CifXChannelBuffer::clear()
 		iIter = 0;
 } 
 
+bool CDriver_CifXChannelBuffer::hasSameContent(CDriver_CifXChannelBuffer& otherBuffer)
+{
+	auto& otherData = otherBuffer.getBuffer();
+	if (otherData.size() != m_Data.size())
+		return false;
+	if (m_Data.empty())
+		return true;
+
+	return (memcmp(m_Data.data(), otherData.data(), m_Data.size()) == 0);
+}
+
 void CDriver_CifXChannelBuffer::readEndianValue(uint32_t nAddress, uint32_t nSize, bool bIsBigEndian, CDriver_CifXChannelEndianValue& outputValue)
 {
 	if ((nSize == 0) || (nSize > 8))
@@ -327,7 +339,9 @@ std::vector<uint8_t>& CDriver_CifXChannelBuffer::getBuffer()
 
 
 CDriver_CifXChannelThreadState::CDriver_CifXChannelThreadState(PCifXSDK pCifXSDK, uint32_t nInputSize, uint32_t nOutputSize, cifxHandle hChannel)
-	: m_pCifXSDK(pCifXSDK), m_hChannel(hChannel), m_bCancelFlag(false), m_bThreadIsRunning(false), m_bDebugMode(true), m_InputBuffer(nInputSize), m_OutputBuffer(nOutputSize)
+	: m_InputBuffers{ CDriver_CifXChannelBuffer(nInputSize), CDriver_CifXChannelBuffer(nInputSize) }, m_nFrontInputBufferIndex(0), m_bHasReceivedInputs(false), m_OutputBuffer(nOutputSize),
+	m_pCifXSDK(pCifXSDK), m_hChannel(hChannel), m_bCancelFlag(false), m_bThreadIsRunning(false), m_bDebugMode(true),
+	m_nSucceededUpdates(0), m_dMinimumUpdateDurationInMs(0.0), m_dMaximumUpdateDurationInMs(0.0), m_dUpdateDurationSumInMs(0.0), m_dUpdateDurationSquareSumInMs(0.0)
 {
 	if (pCifXSDK.get() == nullptr)
 		throw ELibMCDriver_CifXInterfaceException(LIBMCDRIVER_CIFX_ERROR_INVALIDPARAM);
@@ -347,16 +361,49 @@ CDriver_CifXChannelThreadState::~CDriver_CifXChannelThreadState()
 
 }
 
-void CDriver_CifXChannelThreadState::executeThread(uint32_t nReadTimeOut, uint32_t nWriteTimeOut)
+bool CDriver_CifXChannelThreadState::transferProcessImage(uint32_t nReadTimeOut, uint32_t nWriteTimeOut)
 {
-	std::lock_guard<std::mutex> lockGuard(m_Mutex);
-	auto& inputBuffer = m_InputBuffer.getBuffer();
-	if (inputBuffer.size() > 0)
-		m_pCifXSDK->checkError(m_pCifXSDK->xChannelIORead(m_hChannel, 0, 0, (uint32_t)inputBuffer.size(), inputBuffer.data(), nReadTimeOut));
+	uint32_t nBackInputBufferIndex = 1 - m_nFrontInputBufferIndex;
+	auto& inputBuffer = m_InputBuffers[nBackInputBufferIndex].getBuffer();
 	auto& outputBuffer = m_OutputBuffer.getBuffer();
-	if (outputBuffer.size() > 0)
-		m_pCifXSDK->checkError(m_pCifXSDK->xChannelIOWrite(m_hChannel, 0, 0, (uint32_t)outputBuffer.size(), outputBuffer.data(), nWriteTimeOut));
 
+	auto startTime = std::chrono::steady_clock::now();
+
+	{
+		std::lock_guard<std::mutex> lockGuard(m_Mutex);
+		if (m_hChannel == nullptr) {
+			// Channel has been closed by stopThread
+			if (m_bCancelFlag)
+				return false;
+			throw ELibMCDriver_CifXInterfaceException(LIBMCDRIVER_CIFX_ERROR_DRIVERNOTCONNECTED);
+		}
+
+		if (inputBuffer.size() > 0)
+			m_pCifXSDK->checkError(m_pCifXSDK->xChannelIORead(m_hChannel, 0, 0, (uint32_t)inputBuffer.size(), inputBuffer.data(), nReadTimeOut));
+		if (outputBuffer.size() > 0)
+			m_pCifXSDK->checkError(m_pCifXSDK->xChannelIOWrite(m_hChannel, 0, 0, (uint32_t)outputBuffer.size(), outputBuffer.data(), nWriteTimeOut));
+	}
+
+	auto endTime = std::chrono::steady_clock::now();
+	double dDurationInMs = (double)std::chrono::duration_cast<std::chrono::microseconds> (endTime - startTime).count() / 1000.0;
+
+	{
+		std::lock_guard<std::mutex> lockGuard(m_StatisticsMutex);
+		if ((m_nSucceededUpdates == 0) || (dDurationInMs < m_dMinimumUpdateDurationInMs))
+			m_dMinimumUpdateDurationInMs = dDurationInMs;
+		if ((m_nSucceededUpdates == 0) || (dDurationInMs > m_dMaximumUpdateDurationInMs))
+			m_dMaximumUpdateDurationInMs = dDurationInMs;
+		m_dUpdateDurationSumInMs += dDurationInMs;
+		m_dUpdateDurationSquareSumInMs += dDurationInMs * dDurationInMs;
+		m_nSucceededUpdates++;
+		m_LastUpdateTime = endTime;
+	}
+
+	bool bInputHasChanged = !(m_bHasReceivedInputs && m_InputBuffers[nBackInputBufferIndex].hasSameContent(m_InputBuffers[m_nFrontInputBufferIndex]));
+	m_nFrontInputBufferIndex = nBackInputBufferIndex;
+	m_bHasReceivedInputs = true;
+
+	return bInputHasChanged;
 }
 
 void CDriver_CifXChannelThreadState::handleException(uint32_t nErrorCode, const std::string& sMessage)
@@ -364,10 +411,39 @@ void CDriver_CifXChannelThreadState::handleException(uint32_t nErrorCode, const
 	if (m_bDebugMode) {
 		std::cout << "CifX: An exception occured: " << sMessage << std::endl;
 	}
+
+	std::lock_guard<std::mutex> lockGuard(m_StatisticsMutex);
 	m_Exceptions.push_back(std::make_pair(nErrorCode, sMessage));
 
 }
 
+uint32_t CDriver_CifXChannelThreadState::getMillisecondsSinceLastUpdate()
+{
+	std::lock_guard<std::mutex> lockGuard(m_StatisticsMutex);
+	if ((m_nSucceededUpdates == 0) || (!m_bThreadIsRunning))
+		return 0;
+
+	auto duration = std::chrono::steady_clock::now() - m_LastUpdateTime;
+	return (uint32_t)std::chrono::duration_cast<std::chrono::milliseconds> (duration).count();
+}
+
+void CDriver_CifXChannelThreadState::getConnectionStatistics(uint32_t& nNumberOfSucceededUpdates, uint32_t& nNumberOfUpdateErrors, double& dMinimumUpdateDurationInMs, double& dMaximumUpdateDurationInMs, double& dAverageUpdateDurationInMs, double& dUpdateDurationVarianceInMs)
+{
+	std::lock_guard<std::mutex> lockGuard(m_StatisticsMutex);
+	nNumberOfSucceededUpdates = m_nSucceededUpdates;
+	nNumberOfUpdateErrors = (uint32_t)m_Exceptions.size();
+	dMinimumUpdateDurationInMs = m_dMinimumUpdateDurationInMs;
+	dMaximumUpdateDurationInMs = m_dMaximumUpdateDurationInMs;
+	dAverageUpdateDurationInMs = 0.0;
+	dUpdateDurationVarianceInMs = 0.0;
+
+	if (m_nSucceededUpdates > 0) {
+		dAverageUpdateDurationInMs = m_dUpdateDurationSumInMs / m_nSucceededUpdates;
+		double dVariance = (m_dUpdateDurationSquareSumInMs / m_nSucceededUpdates) - (dAverageUpdateDurationInMs * dAverageUpdateDurationInMs);
+		dUpdateDurationVarianceInMs = (dVariance > 0.0) ? dVariance : 0.0;
+	}
+}
+
 bool CDriver_CifXChannelThreadState::threadShallBeCanceled()
 {
 	return m_bCancelFlag;
@@ -406,7 +482,7 @@ void CDriver_CifXChannelThreadState::readInputParameter(CDriver_CifXParameter* p
 	if (pParameter == nullptr)
 		return;
 
-	std::lock_guard<std::mutex> lockGuard(m_Mutex);
+	auto& inputBuffer = m_InputBuffers[m_nFrontInputBufferIndex];
 	uint32_t nAddress = pParameter->getAddress();
 	CDriver_CifXParameter_Bool* pBoolParameter;
 
@@ -415,38 +491,38 @@ void CDriver_CifXChannelThreadState::readInputParameter(CDriver_CifXParameter* p
 		pBoolParameter = dynamic_cast<CDriver_CifXParameter_Bool*> (pParameter);
 		if (pBoolParameter == nullptr)
 			throw ELibMCDriver_CifXInterfaceException(LIBMCDRIVER_CIFX_ERROR_INVALIDBOOLPARAMETERCAST);
-		pParameter->SetActualBoolValue(m_InputBuffer.readBool(nAddress, pBoolParameter->getBit()));
+		pParameter->SetActualBoolValue(inputBuffer.readBool(nAddress, pBoolParameter->getBit()));
 		break;
 	case eDriver_CifXParameterType::CifXParameter_UINT8:
-		pParameter->SetActualIntegerValue(m_InputBuffer.readUint8(nAddress));
+		pParameter->SetActualIntegerValue(inputBuffer.readUint8(nAddress));
 		break;
 
 	case eDriver_CifXParameterType::CifXParameter_UINT16:
-		pParameter->SetActualIntegerValue(m_InputBuffer.readUint16(nAddress, pParameter->isBigEndian()));
+		pParameter->SetActualIntegerValue(inputBuffer.readUint16(nAddress, pParameter->isBigEndian()));
 		break;
 
 	case eDriver_CifXParameterType::CifXParameter_UINT32:
-		pParameter->SetActualIntegerValue(m_InputBuffer.readUint32(nAddress, pParameter->isBigEndian()));
+		pParameter->SetActualIntegerValue(inputBuffer.readUint32(nAddress, pParameter->isBigEndian()));
 		break;
 
 	case eDriver_CifXParameterType::CifXParameter_INT8:
-		pParameter->SetActualIntegerValue(m_InputBuffer.readInt8(nAddress));
+		pParameter->SetActualIntegerValue(inputBuffer.readInt8(nAddress));
 		break;
 
 	case eDriver_CifXParameterType::CifXParameter_INT16:
-		pParameter->SetActualIntegerValue(m_InputBuffer.readInt16(nAddress, pParameter->isBigEndian()));
+		pParameter->SetActualIntegerValue(inputBuffer.readInt16(nAddress, pParameter->isBigEndian()));
 		break;
 
 	case eDriver_CifXParameterType::CifXParameter_INT32:
-		pParameter->SetActualIntegerValue(m_InputBuffer.readInt32(nAddress, pParameter->isBigEndian()));
+		pParameter->SetActualIntegerValue(inputBuffer.readInt32(nAddress, pParameter->isBigEndian()));
 		break;
 
 	case eDriver_CifXParameterType::CifXParameter_FLOAT:
-		pParameter->SetActualDoubleValue(m_InputBuffer.readFloat(nAddress, pParameter->isBigEndian()));
+		pParameter->SetActualDoubleValue(inputBuffer.readFloat(nAddress, pParameter->isBigEndian()));
 		break;
 
 	case eDriver_CifXParameterType::CifXParameter_DOUBLE:
-		pParameter->SetActualDoubleValue(m_InputBuffer.readDouble(nAddress, pParameter->isBigEndian()));
+		pParameter->SetActualDoubleValue(inputBuffer.readDouble(nAddress, pParameter->isBigEndian()));
 		break;
 	}
 
@@ -458,7 +534,6 @@ void CDriver_CifXChannelThreadState::readOutputParameter(CDriver_CifXParameter*
 	if (pParameter == nullptr)
 		return;
 
-	std::lock_guard<std::mutex> lockGuard(m_Mutex);
 	uint32_t nAddress = pParameter->getAddress();
 	CDriver_CifXParameter_Bool* pBoolParameter;
 
@@ -509,7 +584,6 @@ void CDriver_CifXChannelThreadState::writeOutputParameter(CDriver_CifXParameter*
 	if (pParameter == nullptr)
 		return;
 
-	std::lock_guard<std::mutex> lockGuard(m_Mutex);
 	uint32_t nAddress = pParameter->getAddress();
 	CDriver_CifXParameter_Bool* pBoolParameter;
 	int64_t nValue;
@@ -791,6 +865,29 @@ bool CDriver_CifXChannel::isConnected()
 	return false;
 }
 
+uint32_t CDriver_CifXChannel::getMillisecondsSinceLastUpdate()
+{
+	if (m_pThreadState.get() != nullptr)
+		return m_pThreadState->getMillisecondsSinceLastUpdate();
+
+	return 0;
+}
+
+void CDriver_CifXChannel::getConnectionStatistics(uint32_t& nNumberOfSucceededUpdates, uint32_t& nNumberOfUpdateErrors, double& dMinimumUpdateDurationInMs, double& dMaximumUpdateDurationInMs, double& dAverageUpdateDurationInMs, double& dUpdateDurationVarianceInMs)
+{
+	if (m_pThreadState.get() != nullptr) {
+		m_pThreadState->getConnectionStatistics(nNumberOfSucceededUpdates, nNumberOfUpdateErrors, dMinimumUpdateDurationInMs, dMaximumUpdateDurationInMs, dAverageUpdateDurationInMs, dUpdateDurationVarianceInMs);
+	}
+	else {
+		nNumberOfSucceededUpdates = 0;
+		nNumberOfUpdateErrors = 0;
+		dMinimumUpdateDurationInMs = 0.0;
+		dMaximumUpdateDurationInMs = 0.0;
+		dAverageUpdateDurationInMs = 0.0;
+		dUpdateDurationVarianceInMs = 0.0;
+	}
+}
+
 PDriver_CifXParameter CDriver_CifXChannel::findInputValue(const std::string& sName)
 {
 	auto iIter = m_InputMap.find(sName);
@@ -839,7 +936,10 @@ void CDriver_CifXChannel::startSyncThread(PCifXSDK pCifXSDK, cifxHandle hDriverH
 	auto pOutputs = m_Outputs;
 
 	// First call should be in connection thread
-	pThreadState->executeThread(nReadTimeout, nWriteTimeout);
+	if (pThreadState->transferProcessImage(nReadTimeout, nWriteTimeout)) {
+		for (auto pInput : pInputs)
+			pThreadState->readInputParameter(pInput.get());
+	}
 
 	m_SyncThread = std::thread([pThreadState, pInputs, pOutputs, nReadTimeout, nWriteTimeout, nSyncDelay]() {
 
@@ -847,19 +947,29 @@ void CDriver_CifXChannel::startSyncThread(PCifXSDK pCifXSDK, cifxHandle hDriverH
 
 		try
 		{
+			// The sync delay is the cycle period, so the transfer time does not add to it.
+			auto nextCycleTime = std::chrono::steady_clock::now();
+
 			while (!pThreadState->threadShallBeCanceled()) {
 
 				for (auto pOutput : pOutputs)
 					pThreadState->writeOutputParameter(pOutput.get());
 
-				pThreadState->executeThread(nReadTimeout, nWriteTimeout);
+				bool bInputHasChanged = pThreadState->transferProcessImage(nReadTimeout, nWriteTimeout);
 
-				for (auto pInput : pInputs)
-					pThreadState->readInputParameter(pInput.get());
+				if (bInputHasChanged) {
+					for (auto pInput : pInputs)
+						pThreadState->readInputParameter(pInput.get());
+				}
 				for (auto pOutput : pOutputs)
 					pThreadState->readOutputParameter(pOutput.get());
 
-				std::this_thread::sleep_for(std::chrono::milliseconds(nSyncDelay));
+				nextCycleTime += std::chrono::milliseconds(nSyncDelay);
+				auto currentTime = std::chrono::steady_clock::now();
+				if (nextCycleTime < currentTime)
+					nextCycleTime = currentTime;
+				else
+					std::this_thread::sleep_until(nextCycleTime);
 			}
 
 		}
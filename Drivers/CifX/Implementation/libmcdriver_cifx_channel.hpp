@@ -42,6 +42,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <array>
 #include <map>
 #include <vector>
+#include <chrono>
 
 #include "pugixml.hpp"
 
@@ -64,6 +65,8 @@ namespace Impl {
 
 		void clear();
 
+		bool hasSameContent(CDriver_CifXChannelBuffer& otherBuffer);
+
 		uint8_t readUint8(uint32_t nAddress);
 		uint16_t readUint16(uint32_t nAddress, bool bReadBigEndian);
 		uint32_t readUint32(uint32_t nAddress, bool bReadBigEndian);
@@ -90,12 +93,18 @@ namespace Impl {
 
 	class CDriver_CifXChannelThreadState {
 	private:
-		CDriver_CifXChannelBuffer m_InputBuffer;
+		// The process image is read into the back buffer and then swapped to the front.
+		// Parameters are decoded from the front buffer, only if its content has changed.
+		// All buffers are owned by the sync thread and are accessed without the channel lock.
+		CDriver_CifXChannelBuffer m_InputBuffers[2];
+		uint32_t m_nFrontInputBufferIndex;
+		bool m_bHasReceivedInputs;
 		CDriver_CifXChannelBuffer m_OutputBuffer;
 
 		PCifXSDK m_pCifXSDK;
 		cifxHandle m_hChannel;
 
+		// Channel lock, only held during the block transfer and while closing the channel.
 		std::mutex m_Mutex;
 
 		std::atomic<bool> m_bCancelFlag;
@@ -104,6 +113,13 @@ namespace Impl {
 		bool m_bDebugMode;
 		std::vector<std::pair<uint32_t, std::string>> m_Exceptions;
 
+		std::mutex m_StatisticsMutex;
+		uint32_t m_nSucceededUpdates;
+		double m_dMinimumUpdateDurationInMs;
+		double m_dMaximumUpdateDurationInMs;
+		double m_dUpdateDurationSumInMs;
+		double m_dUpdateDurationSquareSumInMs;
+		std::chrono::steady_clock::time_point m_LastUpdateTime;
 
 	public:
 
@@ -111,7 +127,8 @@ namespace Impl {
 
 		virtual ~CDriver_CifXChannelThreadState();
 
-		void executeThread(uint32_t nReadTimeOut, uint32_t nWriteTimeOut);
+		// Transfers the whole input and output process image. Returns true, if the input image has changed.
+		bool transferProcessImage(uint32_t nReadTimeOut, uint32_t nWriteTimeOut);
 
 		void handleException(uint32_t nErrorCode, const std::string& sMessage);
 
@@ -126,6 +143,9 @@ namespace Impl {
 
 		bool isConnected();
 
+		uint32_t getMillisecondsSinceLastUpdate();
+		void getConnectionStatistics(uint32_t& nNumberOfSucceededUpdates, uint32_t& nNumberOfUpdateErrors, double& dMinimumUpdateDurationInMs, double& dMaximumUpdateDurationInMs, double& dAverageUpdateDurationInMs, double& dUpdateDurationVarianceInMs);
+
 	};
 
 
@@ -171,6 +191,9 @@ namespace Impl {
 
 		bool isConnected();
 
+		uint32_t getMillisecondsSinceLastUpdate();
+		void getConnectionStatistics(uint32_t& nNumberOfSucceededUpdates, uint32_t& nNumberOfUpdateErrors, double& dMinimumUpdateDurationInMs, double& dMaximumUpdateDurationInMs, double& dAverageUpdateDurationInMs, double& dUpdateDurationVarianceInMs);
+
 		PDriver_CifXParameter findInputValue(const std::string& sName);
 		PDriver_CifXParameter findOutputValue(const std::string& sName);
 
@@ -74,12 +74,12 @@ bool CChannelInformation::IsConnected()
 
 LibMCDriver_CifX_uint32 CChannelInformation::GetMillisecondsSinceLastUpdate()
 {
-	throw ELibMCDriver_CifXInterfaceException(LIBMCDRIVER_CIFX_ERROR_NOTIMPLEMENTED);
+	return m_pChannel->getMillisecondsSinceLastUpdate();
 }
 
 void CChannelInformation::GetConnectionStatistics(LibMCDriver_CifX_uint32 & nNumberOfSucceededUpdates, LibMCDriver_CifX_uint32 & nNumberOfUpdateErrors, LibMCDriver_CifX_double & dMinimumUpdateDurationInMs, LibMCDriver_CifX_double & dMaximumUpdateDurationInMs, LibMCDriver_CifX_double & dAverageUpdateDurationInMs, LibMCDriver_CifX_double & dUpdateDurationVarianceInMs)
 {
-	throw ELibMCDriver_CifXInterfaceException(LIBMCDRIVER_CIFX_ERROR_NOTIMPLEMENTED);
+	m_pChannel->getConnectionStatistics(nNumberOfSucceededUpdates, nNumberOfUpdateErrors, dMinimumUpdateDurationInMs, dMaximumUpdateDurationInMs, dAverageUpdateDurationInMs, dUpdateDurationVarianceInMs);
 }
 
 bool CChannelInformation::ValueExists(const std::string & sName)
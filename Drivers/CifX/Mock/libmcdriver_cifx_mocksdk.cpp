@@ -0,0 +1,302 @@
+/*++
+
+Copyright (C) 2020 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+/*
+ Software-only implementation of the cifX driver API used by the CifX driver.
+ Every board name is accepted and provides CIFXMOCK_CHANNELCOUNT channels. Each
+ channel has an input and an output process image of CIFXMOCK_IOAREASIZE bytes.
+ The simulated fieldbus slave echoes the output image into the input image, so
+ written values can be read back one cycle later. IO access requires host state
+ ready and bus state on, like on a real card. Load it with SetCustomSDKResource.
+*/
+
+#include "../Implementation/libmcdriver_cifx_sdk.hpp"
+
+#include <map>
+#include <memory>
+#include <vector>
+#include <string>
+#include <mutex>
+#include <cstring>
+
+#ifdef _WIN32
+#define CIFXMOCK_EXPORT extern "C" __declspec(dllexport)
+#else
+#define CIFXMOCK_EXPORT extern "C" __attribute__((visibility("default")))
+#endif
+
+#define CIFXMOCK_NOERROR 0
+#define CIFXMOCK_ERROR_INVALIDPOINTER ((int32_t)0x800A0001)
+#define CIFXMOCK_ERROR_INVALIDHANDLE ((int32_t)0x800A0002)
+#define CIFXMOCK_ERROR_INVALIDCHANNEL ((int32_t)0x800A0003)
+#define CIFXMOCK_ERROR_INVALIDCOMMAND ((int32_t)0x800A0004)
+#define CIFXMOCK_ERROR_INVALIDAREA ((int32_t)0x800A0005)
+#define CIFXMOCK_ERROR_INVALIDACCESSSIZE ((int32_t)0x800A0006)
+#define CIFXMOCK_ERROR_BUSNOTRUNNING ((int32_t)0x800A0007)
+#define CIFXMOCK_ERROR_NOTSUPPORTED ((int32_t)0x800A0008)
+
+#define CIFXMOCK_CHANNELCOUNT 4
+#define CIFXMOCK_IOAREASIZE 5760
+
+using namespace LibMCDriver_CifX::Impl;
+
+namespace {
+
+	class CCifXMockChannel {
+	public:
+		std::mutex m_Mutex;
+		uint32_t m_nHostState = CIFX_HOST_STATE_NOT_READY;
+		uint32_t m_nBusState = CIFX_BUS_STATE_OFF;
+		std::vector<uint8_t> m_InputImage = std::vector<uint8_t>(CIFXMOCK_IOAREASIZE, 0);
+		std::vector<uint8_t> m_OutputImage = std::vector<uint8_t>(CIFXMOCK_IOAREASIZE, 0);
+		uint32_t m_nOpenCount = 0;
+	};
+
+	class CCifXMockDriver {
+	public:
+		std::mutex m_Mutex;
+		std::map<std::pair<std::string, uint32_t>, std::shared_ptr<CCifXMockChannel>> m_Channels;
+	};
+
+	std::mutex g_DriverMutex;
+	std::shared_ptr<CCifXMockDriver> g_pDriver;
+
+	CCifXMockChannel* getChannel(cifxHandle hChannel)
+	{
+		return (CCifXMockChannel*)hChannel;
+	}
+
+	int32_t changeState(uint32_t& nState, uint32_t nCommand, uint32_t nOffState, uint32_t nOnState, uint32_t nGetState, uint32_t* pnState)
+	{
+		if (pnState == nullptr)
+			return CIFXMOCK_ERROR_INVALIDPOINTER;
+
+		if (nCommand == nOffState || nCommand == nOnState)
+			nState = nCommand;
+		else if (nCommand != nGetState)
+			return CIFXMOCK_ERROR_INVALIDCOMMAND;
+
+		*pnState = nState;
+		return CIFXMOCK_NOERROR;
+	}
+
+}
+
+
+CIFXMOCK_EXPORT cifxError CIFX_CALLINGCONVENTION xDriverOpen(cifxHandle* phDriver)
+{
+	if (phDriver == nullptr)
+		return CIFXMOCK_ERROR_INVALIDPOINTER;
+
+	std::lock_guard<std::mutex> lockGuard(g_DriverMutex);
+	if (g_pDriver.get() == nullptr)
+		g_pDriver = std::make_shared<CCifXMockDriver>();
+
+	*phDriver = (cifxHandle)g_pDriver.get();
+	return CIFXMOCK_NOERROR;
+}
+
+CIFXMOCK_EXPORT cifxError CIFX_CALLINGCONVENTION xDriverClose(cifxHandle hDriver)
+{
+	std::lock_guard<std::mutex> lockGuard(g_DriverMutex);
+	if ((hDriver == nullptr) || (hDriver != (cifxHandle)g_pDriver.get()))
+		return CIFXMOCK_ERROR_INVALIDHANDLE;
+
+	return CIFXMOCK_NOERROR;
+}
+
+CIFXMOCK_EXPORT cifxError CIFX_CALLINGCONVENTION xDriverGetInformation(cifxHandle hDriver, uint32_t nSize, void* pDriverInfo)
+{
+	return CIFXMOCK_ERROR_NOTSUPPORTED;
+}
+
+CIFXMOCK_EXPORT cifxError CIFX_CALLINGCONVENTION xDriverGetErrorDescription(cifxError nError, char* pszBuffer, uint32_t nBufferLen)
+{
+	if ((pszBuffer == nullptr) || (nBufferLen == 0))
+		return CIFXMOCK_ERROR_INVALIDPOINTER;
+
+	std::string sDescription;
+	switch (nError) {
+	case CIFXMOCK_NOERROR: sDescription = "no error"; break;
+	case CIFXMOCK_ERROR_INVALIDPOINTER: sDescription = "invalid pointer"; break;
+	case CIFXMOCK_ERROR_INVALIDHANDLE: sDescription = "invalid handle"; break;
+	case CIFXMOCK_ERROR_INVALIDCHANNEL: sDescription = "invalid channel"; break;
+	case CIFXMOCK_ERROR_INVALIDCOMMAND: sDescription = "invalid command"; break;
+	case CIFXMOCK_ERROR_INVALIDAREA: sDescription = "invalid area"; break;
+	case CIFXMOCK_ERROR_INVALIDACCESSSIZE: sDescription = "invalid access size"; break;
+	case CIFXMOCK_ERROR_BUSNOTRUNNING: sDescription = "bus is not running"; break;
+	case CIFXMOCK_ERROR_NOTSUPPORTED: sDescription = "function not supported by simulation"; break;
+	default: sDescription = "unknown error"; break;
+	}
+
+	strncpy(pszBuffer, sDescription.c_str(), nBufferLen - 1);
+	pszBuffer[nBufferLen - 1] = 0;
+	return CIFXMOCK_NOERROR;
+}
+
+CIFXMOCK_EXPORT cifxError CIFX_CALLINGCONVENTION xDriverEnumBoards(cifxHandle hDriver, uint32_t nBoard, uint32_t nSize, void* pBoardInfo)
+{
+	return CIFXMOCK_ERROR_NOTSUPPORTED;
+}
+
+CIFXMOCK_EXPORT cifxError CIFX_CALLINGCONVENTION xDriverEnumChannels(cifxHandle hDriver, uint32_t nBoard, uint32_t nChannel, uint32_t nSize, void* pChannelInfo)
+{
+	return CIFXMOCK_ERROR_NOTSUPPORTED;
+}
+
+CIFXMOCK_EXPORT cifxError CIFX_CALLINGCONVENTION xDriverMemoryPointer(cifxHandle hDriver, uint32_t nBoard, uint32_t nCommandId, void* pMemoryInfo)
+{
+	return CIFXMOCK_ERROR_NOTSUPPORTED;
+}
+
+CIFXMOCK_EXPORT cifxError CIFX_CALLINGCONVENTION xDriverRestartDevice(cifxHandle hDriver, const char* pszBoardName, void* pData)
+{
+	return CIFXMOCK_NOERROR;
+}
+
+CIFXMOCK_EXPORT cifxError CIFX_CALLINGCONVENTION xChannelOpen(cifxHandle hDriver, const char* pszBoardName, uint32_t nChannel, cifxHandle* phChannel)
+{
+	if ((pszBoardName == nullptr) || (phChannel == nullptr))
+		return CIFXMOCK_ERROR_INVALIDPOINTER;
+	if (nChannel >= CIFXMOCK_CHANNELCOUNT)
+		return CIFXMOCK_ERROR_INVALIDCHANNEL;
+
+	std::shared_ptr<CCifXMockDriver> pDriver;
+	{
+		std::lock_guard<std::mutex> lockGuard(g_DriverMutex);
+		if ((hDriver == nullptr) || (hDriver != (cifxHandle)g_pDriver.get()))
+			return CIFXMOCK_ERROR_INVALIDHANDLE;
+		pDriver = g_pDriver;
+	}
+
+	std::lock_guard<std::mutex> lockGuard(pDriver->m_Mutex);
+	auto key = std::make_pair(std::string(pszBoardName), nChannel);
+	auto iIter = pDriver->m_Channels.find(key);
+	if (iIter == pDriver->m_Channels.end())
+		iIter = pDriver->m_Channels.insert(std::make_pair(key, std::make_shared<CCifXMockChannel>())).first;
+
+	auto pChannel = iIter->second;
+	std::lock_guard<std::mutex> channelLock(pChannel->m_Mutex);
+	pChannel->m_nOpenCount++;
+
+	*phChannel = (cifxHandle)pChannel.get();
+	return CIFXMOCK_NOERROR;
+}
+
+CIFXMOCK_EXPORT cifxError CIFX_CALLINGCONVENTION xChannelClose(cifxHandle hChannel)
+{
+	auto pChannel = getChannel(hChannel);
+	if (pChannel == nullptr)
+		return CIFXMOCK_ERROR_INVALIDHANDLE;
+
+	std::lock_guard<std::mutex> lockGuard(pChannel->m_Mutex);
+	if (pChannel->m_nOpenCount > 0)
+		pChannel->m_nOpenCount--;
+
+	return CIFXMOCK_NOERROR;
+}
+
+CIFXMOCK_EXPORT cifxError CIFX_CALLINGCONVENTION xChannelHostState(cifxHandle hChannel, uint32_t nCommand, uint32_t* pnState, uint32_t nTimeout)
+{
+	auto pChannel = getChannel(hChannel);
+	if (pChannel == nullptr)
+		return CIFXMOCK_ERROR_INVALIDHANDLE;
+
+	std::lock_guard<std::mutex> lockGuard(pChannel->m_Mutex);
+	return changeState(pChannel->m_nHostState, nCommand, CIFX_HOST_STATE_NOT_READY, CIFX_HOST_STATE_READY, CIFX_HOST_STATE_READ, pnState);
+}
+
+CIFXMOCK_EXPORT cifxError CIFX_CALLINGCONVENTION xChannelBusState(cifxHandle hChannel, uint32_t nCommand, uint32_t* pnState, uint32_t nTimeout)
+{
+	auto pChannel = getChannel(hChannel);
+	if (pChannel == nullptr)
+		return CIFXMOCK_ERROR_INVALIDHANDLE;
+
+	std::lock_guard<std::mutex> lockGuard(pChannel->m_Mutex);
+	return changeState(pChannel->m_nBusState, nCommand, CIFX_BUS_STATE_OFF, CIFX_BUS_STATE_ON, CIFX_BUS_STATE_GETSTATE, pnState);
+}
+
+CIFXMOCK_EXPORT cifxError CIFX_CALLINGCONVENTION xChannelPutPacket(cifxHandle hChannel, cifxPacket* pSendPkt, uint32_t nTimeout)
+{
+	return CIFXMOCK_ERROR_NOTSUPPORTED;
+}
+
+CIFXMOCK_EXPORT cifxError CIFX_CALLINGCONVENTION xChannelGetPacket(cifxHandle hChannel, uint32_t nSize, cifxPacket* pRecvPkt, uint32_t nTimeout)
+{
+	return CIFXMOCK_ERROR_NOTSUPPORTED;
+}
+
+CIFXMOCK_EXPORT cifxError CIFX_CALLINGCONVENTION xChannelIORead(cifxHandle hChannel, uint32_t nAreaNumber, uint32_t nOffset, uint32_t nDataLen, void* pData, uint32_t nTimeout)
+{
+	auto pChannel = getChannel(hChannel);
+	if (pChannel == nullptr)
+		return CIFXMOCK_ERROR_INVALIDHANDLE;
+	if ((pData == nullptr) && (nDataLen > 0))
+		return CIFXMOCK_ERROR_INVALIDPOINTER;
+	if (nAreaNumber != 0)
+		return CIFXMOCK_ERROR_INVALIDAREA;
+	if (((uint64_t)nOffset + nDataLen) > CIFXMOCK_IOAREASIZE)
+		return CIFXMOCK_ERROR_INVALIDACCESSSIZE;
+
+	std::lock_guard<std::mutex> lockGuard(pChannel->m_Mutex);
+	if ((pChannel->m_nHostState != CIFX_HOST_STATE_READY) || (pChannel->m_nBusState != CIFX_BUS_STATE_ON))
+		return CIFXMOCK_ERROR_BUSNOTRUNNING;
+
+	if (nDataLen > 0)
+		memcpy(pData, pChannel->m_InputImage.data() + nOffset, nDataLen);
+
+	return CIFXMOCK_NOERROR;
+}
+
+CIFXMOCK_EXPORT cifxError CIFX_CALLINGCONVENTION xChannelIOWrite(cifxHandle hChannel, uint32_t nAreaNumber, uint32_t nOffset, uint32_t nDataLen, void* pData, uint32_t nTimeout)
+{
+	auto pChannel = getChannel(hChannel);
+	if (pChannel == nullptr)
+		return CIFXMOCK_ERROR_INVALIDHANDLE;
+	if ((pData == nullptr) && (nDataLen > 0))
+		return CIFXMOCK_ERROR_INVALIDPOINTER;
+	if (nAreaNumber != 0)
+		return CIFXMOCK_ERROR_INVALIDAREA;
+	if (((uint64_t)nOffset + nDataLen) > CIFXMOCK_IOAREASIZE)
+		return CIFXMOCK_ERROR_INVALIDACCESSSIZE;
+
+	std::lock_guard<std::mutex> lockGuard(pChannel->m_Mutex);
+	if ((pChannel->m_nHostState != CIFX_HOST_STATE_READY) || (pChannel->m_nBusState != CIFX_BUS_STATE_ON))
+		return CIFXMOCK_ERROR_BUSNOTRUNNING;
+
+	if (nDataLen > 0) {
+		memcpy(pChannel->m_OutputImage.data() + nOffset, pData, nDataLen);
+
+		// The simulated slave echoes the outputs, the driver reads them back in its next cycle
+		memcpy(pChannel->m_InputImage.data() + nOffset, pChannel->m_OutputImage.data() + nOffset, nDataLen);
+	}
+
+	return CIFXMOCK_NOERROR;
+}
@@ -155,7 +155,7 @@ typedef LibMCDriver_FrameBufferResult (*PLibMCDriver_FrameBufferFrameBufferAcces
 typedef LibMCDriver_FrameBufferResult (*PLibMCDriver_FrameBufferFrameBufferAccess_UsesDoubleBufferingPtr) (LibMCDriver_FrameBuffer_FrameBufferAccess pFrameBufferAccess, bool * pDoubleBufferingIsEnabled);
 
 /**
-* Flips the buffers and shows the current draw buffer on screen. Does nothing if double buffering is disabled.
+* Flips the buffers and shows the current draw buffer on screen. Afterwards, the draw buffer contains the frame that is shown, so only changed regions need to be redrawn. Does nothing if double buffering is disabled.
 *
 * @param[in] pFrameBufferAccess - FrameBufferAccess instance.
 * @return error code or 0 (success)
@@ -206,6 +206,19 @@ typedef LibMCDriver_FrameBufferResult (*PLibMCDriver_FrameBufferFrameBufferAcces
 */
 typedef LibMCDriver_FrameBufferResult (*PLibMCDriver_FrameBufferFrameBufferAccess_SetPixelRGBPtr) (LibMCDriver_FrameBuffer_FrameBufferAccess pFrameBufferAccess, LibMCDriver_FrameBuffer_int32 nX, LibMCDriver_FrameBuffer_int32 nY, LibMCDriver_FrameBuffer_uint8 nRed, LibMCDriver_FrameBuffer_uint8 nGreen, LibMCDriver_FrameBuffer_uint8 nBlue);
 
+/**
+* Returns the color of a pixel as it is shown on screen. With double buffering, this is the content of the display buffer.
+*
+* @param[in] pFrameBufferAccess - FrameBufferAccess instance.
+* @param[in] nX - X Coordinate of pixel to read. MUST be within the screen.
+* @param[in] nY - Y Coordinate of pixel to read. MUST be within the screen.
+* @param[out] pRed - Red value of the pixel (0-255).
+* @param[out] pGreen - Green value of the pixel (0-255).
+* @param[out] pBlue - Blue value of the pixel (0-255).
+* @return error code or 0 (success)
+*/
+typedef LibMCDriver_FrameBufferResult (*PLibMCDriver_FrameBufferFrameBufferAccess_GetPixelRGBPtr) (LibMCDriver_FrameBuffer_FrameBufferAccess pFrameBufferAccess, LibMCDriver_FrameBuffer_int32 nX, LibMCDriver_FrameBuffer_int32 nY, LibMCDriver_FrameBuffer_uint8 * pRed, LibMCDriver_FrameBuffer_uint8 * pGreen, LibMCDriver_FrameBuffer_uint8 * pBlue);
+
 /**
 * Draws a rectangle in a certain color, including the corner points.
 *
@@ -412,6 +425,7 @@ typedef struct {
 	PLibMCDriver_FrameBufferFrameBufferAccess_ClearScreenRGBPtr m_FrameBufferAccess_ClearScreenRGB;
 	PLibMCDriver_FrameBufferFrameBufferAccess_SetPixelPtr m_FrameBufferAccess_SetPixel;
 	PLibMCDriver_FrameBufferFrameBufferAccess_SetPixelRGBPtr m_FrameBufferAccess_SetPixelRGB;
+	PLibMCDriver_FrameBufferFrameBufferAccess_GetPixelRGBPtr m_FrameBufferAccess_GetPixelRGB;
 	PLibMCDriver_FrameBufferFrameBufferAccess_FillRectanglePtr m_FrameBufferAccess_FillRectangle;
 	PLibMCDriver_FrameBufferFrameBufferAccess_FillRectangleRGBPtr m_FrameBufferAccess_FillRectangleRGB;
 	PLibMCDriver_FrameBufferFrameBufferAccess_DrawImagePtr m_FrameBufferAccess_DrawImage;
@@ -193,6 +193,8 @@ public:
 			case LIBMCDRIVER_FRAMEBUFFER_ERROR_INVALIDSCREENSIZE: return "INVALIDSCREENSIZE";
 			case LIBMCDRIVER_FRAMEBUFFER_ERROR_INVALIDDRAWBUFFER: return "INVALIDDRAWBUFFER";
 			case LIBMCDRIVER_FRAMEBUFFER_ERROR_INVALIDLINELENGTH: return "INVALIDLINELENGTH";
+			case LIBMCDRIVER_FRAMEBUFFER_ERROR_FRAMEBUFFERIDENTIFIERALREADYEXISTS: return "FRAMEBUFFERIDENTIFIERALREADYEXISTS";
+			case LIBMCDRIVER_FRAMEBUFFER_ERROR_INVALIDPIXELCOORDINATE: return "INVALIDPIXELCOORDINATE";
 		}
 		return "UNKNOWN";
 	}
@@ -224,6 +226,8 @@ public:
 			case LIBMCDRIVER_FRAMEBUFFER_ERROR_INVALIDSCREENSIZE: return "invalid screen size";
 			case LIBMCDRIVER_FRAMEBUFFER_ERROR_INVALIDDRAWBUFFER: return "invalid draw buffer";
 			case LIBMCDRIVER_FRAMEBUFFER_ERROR_INVALIDLINELENGTH: return "invalid line length";
+			case LIBMCDRIVER_FRAMEBUFFER_ERROR_FRAMEBUFFERIDENTIFIERALREADYEXISTS: return "framebuffer identifier already exists";
+			case LIBMCDRIVER_FRAMEBUFFER_ERROR_INVALIDPIXELCOORDINATE: return "invalid pixel coordinate";
 		}
 		return "unknown error";
 	}
@@ -454,6 +458,7 @@ public:
 	inline void ClearScreenRGB(const LibMCDriver_FrameBuffer_uint8 nRed, const LibMCDriver_FrameBuffer_uint8 nGreen, const LibMCDriver_FrameBuffer_uint8 nBlue);
 	inline void SetPixel(const LibMCDriver_FrameBuffer_int32 nX, const LibMCDriver_FrameBuffer_int32 nY, const sColor & RGBColor);
 	inline void SetPixelRGB(const LibMCDriver_FrameBuffer_int32 nX, const LibMCDriver_FrameBuffer_int32 nY, const LibMCDriver_FrameBuffer_uint8 nRed, const LibMCDriver_FrameBuffer_uint8 nGreen, const LibMCDriver_FrameBuffer_uint8 nBlue);
+	inline void GetPixelRGB(const LibMCDriver_FrameBuffer_int32 nX, const LibMCDriver_FrameBuffer_int32 nY, LibMCDriver_FrameBuffer_uint8 & nRed, LibMCDriver_FrameBuffer_uint8 & nGreen, LibMCDriver_FrameBuffer_uint8 & nBlue);
 	inline void FillRectangle(const LibMCDriver_FrameBuffer_int32 nX1, const LibMCDriver_FrameBuffer_int32 nY1, const LibMCDriver_FrameBuffer_int32 nX2, const LibMCDriver_FrameBuffer_int32 nY2, const sColor & RGBColor);
 	inline void FillRectangleRGB(const LibMCDriver_FrameBuffer_int32 nX1, const LibMCDriver_FrameBuffer_int32 nY1, const LibMCDriver_FrameBuffer_int32 nX2, const LibMCDriver_FrameBuffer_int32 nY2, const LibMCDriver_FrameBuffer_uint8 nRed, const LibMCDriver_FrameBuffer_uint8 nGreen, const LibMCDriver_FrameBuffer_uint8 nBlue);
 	inline void DrawImage(const LibMCDriver_FrameBuffer_int32 nX, const LibMCDriver_FrameBuffer_int32 nY, classParam<LibMCEnv::CImageData> pImage);
@@ -619,6 +624,7 @@ public:
 		pWrapperTable->m_FrameBufferAccess_ClearScreenRGB = nullptr;
 		pWrapperTable->m_FrameBufferAccess_SetPixel = nullptr;
 		pWrapperTable->m_FrameBufferAccess_SetPixelRGB = nullptr;
+		pWrapperTable->m_FrameBufferAccess_GetPixelRGB = nullptr;
 		pWrapperTable->m_FrameBufferAccess_FillRectangle = nullptr;
 		pWrapperTable->m_FrameBufferAccess_FillRectangleRGB = nullptr;
 		pWrapperTable->m_FrameBufferAccess_DrawImage = nullptr;
@@ -821,6 +827,15 @@ public:
 		if (pWrapperTable->m_FrameBufferAccess_SetPixelRGB == nullptr)
 			return LIBMCDRIVER_FRAMEBUFFER_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		#ifdef _WIN32
+		pWrapperTable->m_FrameBufferAccess_GetPixelRGB = (PLibMCDriver_FrameBufferFrameBufferAccess_GetPixelRGBPtr) GetProcAddress(hLibrary, "libmcdriver_framebuffer_framebufferaccess_getpixelrgb");
+		#else // _WIN32
+		pWrapperTable->m_FrameBufferAccess_GetPixelRGB = (PLibMCDriver_FrameBufferFrameBufferAccess_GetPixelRGBPtr) dlsym(hLibrary, "libmcdriver_framebuffer_framebufferaccess_getpixelrgb");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_FrameBufferAccess_GetPixelRGB == nullptr)
+			return LIBMCDRIVER_FRAMEBUFFER_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		#ifdef _WIN32
 		pWrapperTable->m_FrameBufferAccess_FillRectangle = (PLibMCDriver_FrameBufferFrameBufferAccess_FillRectanglePtr) GetProcAddress(hLibrary, "libmcdriver_framebuffer_framebufferaccess_fillrectangle");
 		#else // _WIN32
@@ -1050,6 +1065,10 @@ public:
 		if ( (eLookupError != 0) || (pWrapperTable->m_FrameBufferAccess_SetPixelRGB == nullptr) )
 			return LIBMCDRIVER_FRAMEBUFFER_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		eLookupError = (*pLookup)("libmcdriver_framebuffer_framebufferaccess_getpixelrgb", (void**)&(pWrapperTable->m_FrameBufferAccess_GetPixelRGB));
+		if ( (eLookupError != 0) || (pWrapperTable->m_FrameBufferAccess_GetPixelRGB == nullptr) )
+			return LIBMCDRIVER_FRAMEBUFFER_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		eLookupError = (*pLookup)("libmcdriver_framebuffer_framebufferaccess_fillrectangle", (void**)&(pWrapperTable->m_FrameBufferAccess_FillRectangle));
 		if ( (eLookupError != 0) || (pWrapperTable->m_FrameBufferAccess_FillRectangle == nullptr) )
 			return LIBMCDRIVER_FRAMEBUFFER_ERROR_COULDNOTFINDLIBRARYEXPORT;
@@ -1258,7 +1277,7 @@ public:
 	}
 	
 	/**
-	* CFrameBufferAccess::Flip - Flips the buffers and shows the current draw buffer on screen. Does nothing if double buffering is disabled.
+	* CFrameBufferAccess::Flip - Flips the buffers and shows the current draw buffer on screen. Afterwards, the draw buffer contains the frame that is shown, so only changed regions need to be redrawn. Does nothing if double buffering is disabled.
 	*/
 	void CFrameBufferAccess::Flip()
 	{
@@ -1309,6 +1328,19 @@ public:
 		CheckError(m_pWrapper->m_WrapperTable.m_FrameBufferAccess_SetPixelRGB(m_pHandle, nX, nY, nRed, nGreen, nBlue));
 	}
 	
+	/**
+	* CFrameBufferAccess::GetPixelRGB - Returns the color of a pixel as it is shown on screen. With double buffering, this is the content of the display buffer.
+	* @param[in] nX - X Coordinate of pixel to read. MUST be within the screen.
+	* @param[in] nY - Y Coordinate of pixel to read. MUST be within the screen.
+	* @param[out] nRed - Red value of the pixel (0-255).
+	* @param[out] nGreen - Green value of the pixel (0-255).
+	* @param[out] nBlue - Blue value of the pixel (0-255).
+	*/
+	void CFrameBufferAccess::GetPixelRGB(const LibMCDriver_FrameBuffer_int32 nX, const LibMCDriver_FrameBuffer_int32 nY, LibMCDriver_FrameBuffer_uint8 & nRed, LibMCDriver_FrameBuffer_uint8 & nGreen, LibMCDriver_FrameBuffer_uint8 & nBlue)
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_FrameBufferAccess_GetPixelRGB(m_pHandle, nX, nY, &nRed, &nGreen, &nBlue));
+	}
+	
 	/**
 	* CFrameBufferAccess::FillRectangle - Draws a rectangle in a certain color, including the corner points.
 	* @param[in] nX1 - X Coordinate of first point to use.
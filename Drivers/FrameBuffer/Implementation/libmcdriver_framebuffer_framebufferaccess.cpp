@@ -110,6 +110,14 @@ void CFrameBufferAccess::SetPixelRGB(const LibMCDriver_FrameBuffer_int32 nX, con
 	m_pInstance->setPixel(nX, nY, RGBColor);
 }
 
+void CFrameBufferAccess::GetPixelRGB(const LibMCDriver_FrameBuffer_int32 nX, const LibMCDriver_FrameBuffer_int32 nY, LibMCDriver_FrameBuffer_uint8 & nRed, LibMCDriver_FrameBuffer_uint8 & nGreen, LibMCDriver_FrameBuffer_uint8 & nBlue)
+{
+	LibMCDriver_FrameBuffer::sColor RGBColor = m_pInstance->getPixel(nX, nY);
+	nRed = RGBColor.m_Red;
+	nGreen = RGBColor.m_Green;
+	nBlue = RGBColor.m_Blue;
+}
+
 
 void CFrameBufferAccess::FillRectangle(const LibMCDriver_FrameBuffer_int32 nX1, const LibMCDriver_FrameBuffer_int32 nY1, const LibMCDriver_FrameBuffer_int32 nX2, const LibMCDriver_FrameBuffer_int32 nY2, const LibMCDriver_FrameBuffer::sColor RGBColor)
 {
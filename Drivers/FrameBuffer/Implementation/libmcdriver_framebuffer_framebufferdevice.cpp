@@ -128,6 +128,7 @@ CFrameBufferDeviceInstance::CFrameBufferDeviceInstance(const std::string& sIdent
     if (m_bDoubleBufferingEnabled) {
         m_nCurrentBufferIndex = 1;
         setDrawBuffer(m_pFramebufferPtr + ((uint64_t)m_nScanLineLength * nScreenHeight), m_nScanLineLength);
+        setDisplayBuffer(m_pFramebufferPtr);
     }
 
 #else
@@ -159,25 +160,22 @@ void CFrameBufferDeviceInstance::flip()
         fb_var_screeninfo vinfo;
         if (ioctl(m_nFBDeviceHandle, FBIOGET_VSCREENINFO, &vinfo)) 
             throw ELibMCDriver_FrameBufferInterfaceException(LIBMCDRIVER_FRAMEBUFFER_ERROR_COULDNOTGETVARIABLESCREENINFO);
-        
+
+        // Only the regions that changed in the display buffer since the last flip are copied
+        completeDrawBuffer();
+
         uint32_t nScreenHeight = getScreenHeight();
         vinfo.yoffset = m_nCurrentBufferIndex * nScreenHeight;
         ioctl(m_nFBDeviceHandle, FBIOPAN_DISPLAY, &vinfo);
 
-        if (m_nCurrentBufferIndex == 0) {
-            m_nCurrentBufferIndex = 1;
-            setDrawBuffer(m_pFramebufferPtr + ((uint64_t)m_nScanLineLength * nScreenHeight), m_nScanLineLength);
-        }
-        else {
-            m_nCurrentBufferIndex = 0;
-            setDrawBuffer(m_pFramebufferPtr, m_nScanLineLength);
-
-        }
+        m_nCurrentBufferIndex = 1 - m_nCurrentBufferIndex;
+        swapBuffers();
 
 #endif
     }
     else {
         setDrawBuffer(m_pFramebufferPtr, m_nScanLineLength);
+        swapBuffers();
     }
 
 }
@@ -34,6 +34,9 @@ Abstract: This is a stub class definition of CFrameBufferAccess
 #include "libmcdriver_framebuffer_framebufferinstance.hpp"
 #include "libmcdriver_framebuffer_interfaceexception.hpp"
 
+#include <algorithm>
+#include <cstring>
+
 using namespace LibMCDriver_FrameBuffer::Impl;
 
 CFrameBufferInstance::CFrameBufferInstance(const std::string& sIdentifier)
@@ -42,7 +45,10 @@ CFrameBufferInstance::CFrameBufferInstance(const std::string& sIdentifier)
     m_nScreenHeight(0),
     m_BitDepth(LibMCDriver_FrameBuffer::eFrameBufferBitDepth::Unknown),
     m_pDrawbufferPtr(nullptr),
-    m_nLineLength (0)
+    m_nLineLength (0),
+    m_pDisplaybufferPtr (nullptr),
+    m_bHasPixelRegion (false),
+    m_PixelRegion ({ 0, 0, 0, 0 })
 
 {
 
@@ -79,6 +85,8 @@ void CFrameBufferInstance::setPixel(const LibMCDriver_FrameBuffer_int32 nX, cons
         uint32_t nPositiveY = (uint32_t)nY;
 
         if ((nPositiveX < m_nScreenWidth) && (nPositiveY < m_nScreenHeight)) {
+            beginPixelDrawing(nPositiveX, nPositiveY);
+
             switch (m_BitDepth) {
                 case LibMCDriver_FrameBuffer::eFrameBufferBitDepth::RGB565: {
 
@@ -121,6 +129,42 @@ void CFrameBufferInstance::setPixel(const LibMCDriver_FrameBuffer_int32 nX, cons
     }
 }
 
+LibMCDriver_FrameBuffer::sColor CFrameBufferInstance::getPixel(const LibMCDriver_FrameBuffer_int32 nX, const LibMCDriver_FrameBuffer_int32 nY)
+{
+    if ((nX < 0) || (nY < 0) || ((uint32_t)nX >= m_nScreenWidth) || ((uint32_t)nY >= m_nScreenHeight))
+        throw ELibMCDriver_FrameBufferInterfaceException(LIBMCDRIVER_FRAMEBUFFER_ERROR_INVALIDPIXELCOORDINATE);
+
+    // With double buffering, the screen shows the display buffer
+    uint8_t* pBufferPtr = (m_pDisplaybufferPtr != nullptr) ? m_pDisplaybufferPtr : m_pDrawbufferPtr;
+    if (pBufferPtr == nullptr)
+        throw ELibMCDriver_FrameBufferInterfaceException(LIBMCDRIVER_FRAMEBUFFER_ERROR_INVALIDDRAWBUFFER);
+
+    LibMCDriver_FrameBuffer::sColor RGBColor;
+    uint8_t* pPixelPtr = pBufferPtr + (uint64_t)m_nLineLength * ((uint64_t)nY) + (uint64_t)nX * getBytesPerPixel();
+
+    switch (m_BitDepth) {
+        case LibMCDriver_FrameBuffer::eFrameBufferBitDepth::RGB565: {
+            uint16_t rawColor = *((uint16_t*)pPixelPtr);
+            RGBColor.m_Red = (uint8_t)((rawColor << 3) & 0xF8);
+            RGBColor.m_Green = (uint8_t)((rawColor >> 3) & 0xFC);
+            RGBColor.m_Blue = (uint8_t)((rawColor >> 8) & 0xF8);
+            break;
+        }
+
+        case LibMCDriver_FrameBuffer::eFrameBufferBitDepth::RGB888:
+        case LibMCDriver_FrameBuffer::eFrameBufferBitDepth::RGBA8888:
+            RGBColor.m_Red = pPixelPtr[0];
+            RGBColor.m_Green = pPixelPtr[1];
+            RGBColor.m_Blue = pPixelPtr[2];
+            break;
+
+        default:
+            throw ELibMCDriver_FrameBufferInterfaceException(LIBMCDRIVER_FRAMEBUFFER_ERROR_INVALIDPIXELFORMAT);
+    }
+
+    return RGBColor;
+}
+
 void CFrameBufferInstance::clearScreen(const LibMCDriver_FrameBuffer::sColor RGBColor)
 {
     fillRectangle(0, 0, m_nScreenWidth - 1, m_nScreenHeight - 1, RGBColor);
@@ -180,7 +224,9 @@ void CFrameBufferInstance::fillRectangle(const LibMCDriver_FrameBuffer_int32 nX1
     uint32_t nCountX = (uint32_t) ((nMaxX - nMinX) + 1);
     uint32_t nCountY = (uint32_t) ((nMaxY - nMinY) + 1);
 
-    // Fill the rectangle based on the framebuffer's bit depth
+    beginDrawing({ (uint32_t)nMinX, (uint32_t)nMinY, (uint32_t)nMaxX, (uint32_t)nMaxY });
+
+    // Fill the rectangle based on the framebuffer's bit depth. Every row is written as one span
     switch (m_BitDepth) {
     case LibMCDriver_FrameBuffer::eFrameBufferBitDepth::RGB565: {
 
@@ -191,15 +237,9 @@ void CFrameBufferInstance::fillRectangle(const LibMCDriver_FrameBuffer_int32 nX1
 
         uint16_t rawColor = ((nBlue & 0xF8) << 8) | ((nGreen & 0xFC) << 3) | (nRed >> 3);
 
-        // Fill the rectangle row by row
         for (uint32_t nY = 0; nY < nCountY; nY++) {
-
-            uint16_t* pPixelPtr = (uint16_t*)(m_pDrawbufferPtr + (uint64_t)m_nLineLength * ((uint64_t)nY + nMinY)) + nMinX;
-
-            for (uint32_t nX = 0; nX < nCountX; nX++) {
-                *pPixelPtr = rawColor;
-                pPixelPtr++;
-            }
+            uint16_t* pRowPtr = (uint16_t*)(m_pDrawbufferPtr + (uint64_t)m_nLineLength * ((uint64_t)nY + nMinY)) + nMinX;
+            std::fill_n(pRowPtr, nCountX, rawColor);
         }
 
         break;
@@ -207,19 +247,24 @@ void CFrameBufferInstance::fillRectangle(const LibMCDriver_FrameBuffer_int32 nX1
 
     case LibMCDriver_FrameBuffer::eFrameBufferBitDepth::RGB888: {
 
-        // Fill the rectangle row by row with 24-bit RGB values
-        for (uint32_t nY = 0; nY < nCountY; nY++) {
-
-            uint8_t* pPixelPtr = m_pDrawbufferPtr + (uint64_t)m_nLineLength * ((uint64_t)nY + nMinY) + (uint64_t) nMinX * 3;
+        // Prepare one row of 24-bit RGB values and copy it into every row of the rectangle
+        size_t nRowSize = (size_t)nCountX * 3;
+        if (m_RowPattern.size() < nRowSize)
+            m_RowPattern.resize(nRowSize);
+
+        uint8_t* pPatternPtr = m_RowPattern.data();
+        for (uint32_t nX = 0; nX < nCountX; nX++) {
+            *pPatternPtr = RGBColor.m_Red;
+            pPatternPtr++;
+            *pPatternPtr = RGBColor.m_Green;
+            pPatternPtr++;
+            *pPatternPtr = RGBColor.m_Blue;
+            pPatternPtr++;
+        }
 
-            for (uint32_t nX = 0; nX < nCountX; nX++) {
-                *pPixelPtr = RGBColor.m_Red;
-                pPixelPtr++;
-                *pPixelPtr = RGBColor.m_Green;
-                pPixelPtr++;
-                *pPixelPtr = RGBColor.m_Blue;
-                pPixelPtr++;
-            }
+        for (uint32_t nY = 0; nY < nCountY; nY++) {
+            uint8_t* pRowPtr = m_pDrawbufferPtr + (uint64_t)m_nLineLength * ((uint64_t)nY + nMinY) + (uint64_t)nMinX * 3;
+            memcpy(pRowPtr, m_RowPattern.data(), nRowSize);
         }
 
         break;
@@ -227,22 +272,14 @@ void CFrameBufferInstance::fillRectangle(const LibMCDriver_FrameBuffer_int32 nX1
 
     case LibMCDriver_FrameBuffer::eFrameBufferBitDepth::RGBA8888: {
 
-        // Fill the rectangle row by row with 32-bit RGBA values
+        // 32-bit RGBA value in memory order, alpha is hardcoded to fully opaque
+        uint8_t rawBytes[4] = { RGBColor.m_Red, RGBColor.m_Green, RGBColor.m_Blue, 255 };
+        uint32_t rawColor;
+        memcpy(&rawColor, rawBytes, 4);
 
         for (uint32_t nY = 0; nY < nCountY; nY++) {
-
-            uint8_t* pPixelPtr = m_pDrawbufferPtr + (uint64_t)m_nLineLength * ((uint64_t)nY + nMinY) + (uint64_t)nMinX * 4;
-
-            for (uint32_t nX = 0; nX < nCountX; nX++) {
-                *pPixelPtr = RGBColor.m_Red;
-                pPixelPtr++;
-                *pPixelPtr = RGBColor.m_Green;
-                pPixelPtr++;
-                *pPixelPtr = RGBColor.m_Blue;
-                pPixelPtr++;
-                *pPixelPtr = 255; // Hardcoded alpha value (fully opaque)
-                pPixelPtr++;
-            }
+            uint32_t* pRowPtr = (uint32_t*)(m_pDrawbufferPtr + (uint64_t)m_nLineLength * ((uint64_t)nY + nMinY)) + nMinX;
+            std::fill_n(pRowPtr, nCountX, rawColor);
         }
 
         break;
@@ -253,8 +290,6 @@ void CFrameBufferInstance::fillRectangle(const LibMCDriver_FrameBuffer_int32 nX1
 
     }
 
-
-
 }
 
 void CFrameBufferInstance::drawImage(const LibMCDriver_FrameBuffer_int32 nX, const LibMCDriver_FrameBuffer_int32 nY, LibMCEnv::PImageData pImage)
@@ -341,6 +376,8 @@ void CFrameBufferInstance::drawImage(const LibMCDriver_FrameBuffer_int32 nX, con
             throw ELibMCDriver_FrameBufferInterfaceException(LIBMCDRIVER_FRAMEBUFFER_ERROR_INVALIDPIXELFORMAT);
     }
 
+    beginDrawing({ nFrameBufferCoordStartX, nFrameBufferCoordStartY, nFrameBufferCoordStartX + nImageSectionCountX - 1, nFrameBufferCoordStartY + nImageSectionCountY - 1 });
+
     // Calculate the starting position in the framebuffer where the image will be drawn
     uint8_t* pTargetPtr = m_pDrawbufferPtr + (size_t)m_nLineLength * nFrameBufferCoordStartY + nFrameBufferCoordStartX * nBytesPerPixel;
 
@@ -373,3 +410,161 @@ void CFrameBufferInstance::setDrawBuffer(uint8_t* pDrawBuffer, uint32_t nLineLen
     m_nLineLength = nLineLength;
 }
 
+void CFrameBufferInstance::setDisplayBuffer(uint8_t* pDisplayBuffer)
+{
+    if (pDisplayBuffer == nullptr)
+        throw ELibMCDriver_FrameBufferInterfaceException(LIBMCDRIVER_FRAMEBUFFER_ERROR_INVALIDDRAWBUFFER);
+
+    m_pDisplaybufferPtr = pDisplayBuffer;
+
+    m_bHasPixelRegion = false;
+    m_DirtyRegions.clear();
+    m_PendingRegions.clear();
+    m_PendingRegions.push_back({ 0, 0, m_nScreenWidth - 1, m_nScreenHeight - 1 });
+}
+
+void CFrameBufferInstance::completeDrawBuffer()
+{
+    if (m_pDisplaybufferPtr == nullptr)
+        return;
+
+    for (auto& region : m_PendingRegions)
+        copyRegion(region, m_pDisplaybufferPtr, m_pDrawbufferPtr);
+
+    m_PendingRegions.clear();
+}
+
+void CFrameBufferInstance::swapBuffers()
+{
+    flushPixelRegion();
+
+    if (m_pDisplaybufferPtr == nullptr) {
+        m_DirtyRegions.clear();
+        return;
+    }
+
+    if (!m_PendingRegions.empty())
+        throw ELibMCDriver_FrameBufferInterfaceException(LIBMCDRIVER_FRAMEBUFFER_ERROR_INVALIDDRAWBUFFER, "draw buffer has not been completed");
+
+    std::swap(m_pDrawbufferPtr, m_pDisplaybufferPtr);
+
+    // The new draw buffer misses everything that has been drawn into the new display buffer
+    m_PendingRegions.swap(m_DirtyRegions);
+    m_DirtyRegions.clear();
+}
+
+void CFrameBufferInstance::beginDrawing(const sFrameBufferRegion& region)
+{
+    if (m_pDisplaybufferPtr == nullptr)
+        return;
+
+    flushPixelRegion();
+
+    auto iIter = m_PendingRegions.begin();
+    while (iIter != m_PendingRegions.end()) {
+        auto& pendingRegion = *iIter;
+
+        bool bIntersects = (region.m_nMinX <= pendingRegion.m_nMaxX) && (region.m_nMaxX >= pendingRegion.m_nMinX) &&
+            (region.m_nMinY <= pendingRegion.m_nMaxY) && (region.m_nMaxY >= pendingRegion.m_nMinY);
+
+        if (bIntersects) {
+            bool bCovers = (region.m_nMinX <= pendingRegion.m_nMinX) && (region.m_nMaxX >= pendingRegion.m_nMaxX) &&
+                (region.m_nMinY <= pendingRegion.m_nMinY) && (region.m_nMaxY >= pendingRegion.m_nMaxY);
+
+            // Pending regions that are overwritten completely do not need to be copied
+            if (!bCovers)
+                copyRegion(pendingRegion, m_pDisplaybufferPtr, m_pDrawbufferPtr);
+
+            iIter = m_PendingRegions.erase(iIter);
+        }
+        else {
+            iIter++;
+        }
+    }
+
+    addRegion(m_DirtyRegions, region);
+}
+
+void CFrameBufferInstance::beginPixelDrawing(uint32_t nX, uint32_t nY)
+{
+    if (m_pDisplaybufferPtr == nullptr)
+        return;
+
+    if (m_bHasPixelRegion) {
+        m_PixelRegion.m_nMinX = std::min(m_PixelRegion.m_nMinX, nX);
+        m_PixelRegion.m_nMinY = std::min(m_PixelRegion.m_nMinY, nY);
+        m_PixelRegion.m_nMaxX = std::max(m_PixelRegion.m_nMaxX, nX);
+        m_PixelRegion.m_nMaxY = std::max(m_PixelRegion.m_nMaxY, nY);
+        return;
+    }
+
+    // Single pixels hardly ever cover a pending region, so it would need to be copied before the next flip anyway
+    completeDrawBuffer();
+
+    m_PixelRegion = { nX, nY, nX, nY };
+    m_bHasPixelRegion = true;
+}
+
+void CFrameBufferInstance::flushPixelRegion()
+{
+    if (!m_bHasPixelRegion)
+        return;
+
+    m_bHasPixelRegion = false;
+    addRegion(m_DirtyRegions, m_PixelRegion);
+}
+
+void CFrameBufferInstance::addRegion(std::vector<sFrameBufferRegion>& regions, const sFrameBufferRegion& region)
+{
+    for (auto& existingRegion : regions) {
+        if ((existingRegion.m_nMinX <= region.m_nMinX) && (existingRegion.m_nMaxX >= region.m_nMaxX) &&
+            (existingRegion.m_nMinY <= region.m_nMinY) && (existingRegion.m_nMaxY >= region.m_nMaxY))
+            return;
+    }
+
+    regions.erase(std::remove_if(regions.begin(), regions.end(), [&region](const sFrameBufferRegion& existingRegion) {
+        return (region.m_nMinX <= existingRegion.m_nMinX) && (region.m_nMaxX >= existingRegion.m_nMaxX) &&
+            (region.m_nMinY <= existingRegion.m_nMinY) && (region.m_nMaxY >= existingRegion.m_nMaxY);
+    }), regions.end());
+
+    regions.push_back(region);
+
+    // Too many scattered regions are merged into their bounding box
+    if (regions.size() > FRAMEBUFFER_MAXDIRTYREGIONS) {
+        sFrameBufferRegion boundingBox = regions.front();
+        for (auto& existingRegion : regions) {
+            boundingBox.m_nMinX = std::min(boundingBox.m_nMinX, existingRegion.m_nMinX);
+            boundingBox.m_nMinY = std::min(boundingBox.m_nMinY, existingRegion.m_nMinY);
+            boundingBox.m_nMaxX = std::max(boundingBox.m_nMaxX, existingRegion.m_nMaxX);
+            boundingBox.m_nMaxY = std::max(boundingBox.m_nMaxY, existingRegion.m_nMaxY);
+        }
+
+        regions.clear();
+        regions.push_back(boundingBox);
+    }
+}
+
+void CFrameBufferInstance::copyRegion(const sFrameBufferRegion& region, const uint8_t* pSourceBuffer, uint8_t* pTargetBuffer)
+{
+    uint64_t nBytesPerPixel = getBytesPerPixel();
+    size_t nRowSize = (size_t)((uint64_t)(region.m_nMaxX - region.m_nMinX + 1) * nBytesPerPixel);
+
+    for (uint32_t nY = region.m_nMinY; nY <= region.m_nMaxY; nY++) {
+        uint64_t nOffset = (uint64_t)m_nLineLength * nY + (uint64_t)region.m_nMinX * nBytesPerPixel;
+        memcpy(pTargetBuffer + nOffset, pSourceBuffer + nOffset, nRowSize);
+    }
+}
+
+uint32_t CFrameBufferInstance::getBytesPerPixel()
+{
+    switch (m_BitDepth) {
+    case LibMCDriver_FrameBuffer::eFrameBufferBitDepth::RGB565:
+        return 2;
+    case LibMCDriver_FrameBuffer::eFrameBufferBitDepth::RGB888:
+        return 3;
+    case LibMCDriver_FrameBuffer::eFrameBufferBitDepth::RGBA8888:
+        return 4;
+    default:
+        throw ELibMCDriver_FrameBufferInterfaceException(LIBMCDRIVER_FRAMEBUFFER_ERROR_INVALIDPIXELFORMAT);
+    }
+}
@@ -37,14 +37,26 @@ Abstract: This is the class declaration of CFrameBufferAccess
 
 #include "libmcdriver_framebuffer_interfaces.hpp"
 
+#include <vector>
+
 #define FRAMEBUFFER_MINSCREENSIZE 128UL
 #define FRAMEBUFFER_MAXSCREENSIZE 16384UL
+#define FRAMEBUFFER_MAXDIRTYREGIONS 16
 
 
 namespace LibMCDriver_FrameBuffer {
 namespace Impl {
 
 
+// Pixel region of the screen, bounds are inclusive.
+typedef struct _sFrameBufferRegion {
+	uint32_t m_nMinX;
+	uint32_t m_nMinY;
+	uint32_t m_nMaxX;
+	uint32_t m_nMaxY;
+} sFrameBufferRegion;
+
+
 /*************************************************************************************************************************
  Class declaration of CFrameBufferAccess 
 **************************************************************************************************************************/
@@ -61,11 +73,53 @@ private:
 
 	LibMCDriver_FrameBuffer::eFrameBufferBitDepth m_BitDepth;
 
+	// Buffer that is currently shown on screen, if double buffering is used.
+	uint8_t* m_pDisplaybufferPtr;
+
+	// Regions that have been drawn since the last flip.
+	std::vector<sFrameBufferRegion> m_DirtyRegions;
+
+	// Regions in which the draw buffer still differs from the display buffer. They are copied lazily,
+	// so that regions that are redrawn completely are never copied at all.
+	std::vector<sFrameBufferRegion> m_PendingRegions;
+
+	// Bounding box of the pixels set since the last other drawing operation. It is marked dirty as a whole,
+	// so that single pixels do not need to be tracked one by one.
+	bool m_bHasPixelRegion;
+	sFrameBufferRegion m_PixelRegion;
+
+	// Pixel row in RGB888 format, which has no native integer type to fill with.
+	std::vector<uint8_t> m_RowPattern;
+
+	uint32_t getBytesPerPixel();
+
+	void addRegion(std::vector<sFrameBufferRegion> & regions, const sFrameBufferRegion & region);
+
+	void copyRegion(const sFrameBufferRegion& region, const uint8_t* pSourceBuffer, uint8_t* pTargetBuffer);
+
+	// Brings the part of the draw buffer that is about to be drawn up to date and marks it dirty.
+	void beginDrawing(const sFrameBufferRegion& region);
+
+	// Same as beginDrawing for single pixels. Brings the whole draw buffer up to date on the first pixel, afterwards only the pixel region grows.
+	void beginPixelDrawing(uint32_t nX, uint32_t nY);
+
+	// Marks the pixel region dirty and ends the current run of pixels.
+	void flushPixelRegion();
+
 protected:
 
 	void setScreenResolution (uint32_t nScreenWidth, uint32_t nScreenHeight, LibMCDriver_FrameBuffer::eFrameBufferBitDepth bitDepth);
 	void setDrawBuffer (uint8_t* pDrawBuffer, uint32_t nLineLength);
 
+	// Enables double buffering. The draw buffer is treated as completely outdated.
+	void setDisplayBuffer(uint8_t* pDisplayBuffer);
+
+	// Copies all outdated regions from the display buffer into the draw buffer. Needs to be called before showing the draw buffer.
+	void completeDrawBuffer();
+
+	// Exchanges draw buffer and display buffer. Regions drawn since the last flip become outdated in the new draw buffer.
+	void swapBuffers();
+
 public:
 
 	CFrameBufferInstance (const std::string & sIdentifier);
@@ -86,6 +140,9 @@ public:
 
 	void setPixel(const LibMCDriver_FrameBuffer_int32 nX, const LibMCDriver_FrameBuffer_int32 nY, const LibMCDriver_FrameBuffer::sColor RGBColor);
 
+	// Returns the color of a pixel as it is shown on screen. Bits that RGB565 does not store are returned as zero.
+	LibMCDriver_FrameBuffer::sColor getPixel(const LibMCDriver_FrameBuffer_int32 nX, const LibMCDriver_FrameBuffer_int32 nY);
+
 	void fillRectangle(const LibMCDriver_FrameBuffer_int32 nX1, const LibMCDriver_FrameBuffer_int32 nY1, const LibMCDriver_FrameBuffer_int32 nX2, const LibMCDriver_FrameBuffer_int32 nY2, const LibMCDriver_FrameBuffer::sColor RGBColor);
 
 	void drawImage(const LibMCDriver_FrameBuffer_int32 nX, const LibMCDriver_FrameBuffer_int32 nY, LibMCEnv::PImageData pImage);
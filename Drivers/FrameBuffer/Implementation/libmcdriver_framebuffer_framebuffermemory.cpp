@@ -0,0 +1,96 @@
+/*++
+
+Copyright (C) 2024 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the Autodesk Inc. nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 'AS IS' AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+Abstract: This is the class definition of CFrameBufferMemoryInstance
+
+*/
+
+#include "libmcdriver_framebuffer_framebuffermemory.hpp"
+#include "libmcdriver_framebuffer_interfaceexception.hpp"
+
+using namespace LibMCDriver_FrameBuffer::Impl;
+
+/*************************************************************************************************************************
+ Class definition of CFrameBufferMemoryInstance 
+**************************************************************************************************************************/
+
+CFrameBufferMemoryInstance::CFrameBufferMemoryInstance(const std::string& sIdentifier, uint32_t nScreenWidth, uint32_t nScreenHeight, LibMCDriver_FrameBuffer::eFrameBufferBitDepth bitDepth)
+:   CFrameBufferInstance (sIdentifier),
+    m_nScanLineLength (0)
+{
+    uint32_t nBytesPerPixel;
+    switch (bitDepth) {
+    case LibMCDriver_FrameBuffer::eFrameBufferBitDepth::RGB565:
+        nBytesPerPixel = 2;
+        break;
+    case LibMCDriver_FrameBuffer::eFrameBufferBitDepth::RGB888:
+        nBytesPerPixel = 3;
+        break;
+    case LibMCDriver_FrameBuffer::eFrameBufferBitDepth::RGBA8888:
+        nBytesPerPixel = 4;
+        break;
+    default:
+        throw ELibMCDriver_FrameBufferInterfaceException(LIBMCDRIVER_FRAMEBUFFER_ERROR_UNKNOWNFRAMEBUFFERBITDEPTH);
+    }
+
+    setScreenResolution(nScreenWidth, nScreenHeight, bitDepth);
+
+    // Scan lines are 32-bit aligned, as on framebuffer devices
+    m_nScanLineLength = ((nScreenWidth * nBytesPerPixel + 3) / 4) * 4;
+    m_Memory.resize((size_t)m_nScanLineLength * nScreenHeight * 2);
+
+    uint8_t* pFirstBuffer = m_Memory.data();
+    uint8_t* pSecondBuffer = m_Memory.data() + (size_t)m_nScanLineLength * nScreenHeight;
+
+    setDrawBuffer(pFirstBuffer, m_nScanLineLength);
+
+    LibMCDriver_FrameBuffer::sColor black;
+    black.m_Red = 0;
+    black.m_Green = 0;
+    black.m_Blue = 0;
+    clearScreen(black);
+
+    setDrawBuffer(pSecondBuffer, m_nScanLineLength);
+    setDisplayBuffer(pFirstBuffer);
+}
+
+CFrameBufferMemoryInstance::~CFrameBufferMemoryInstance()
+{
+}
+
+void CFrameBufferMemoryInstance::flip()
+{
+    completeDrawBuffer();
+    swapBuffers();
+}
+
+bool CFrameBufferMemoryInstance::usesDoubleBuffering()
+{
+    return true;
+}
@@ -0,0 +1,77 @@
+/*++
+
+Copyright (C) 2024 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the Autodesk Inc. nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 'AS IS' AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+Abstract: This is the class declaration of CFrameBufferMemoryInstance
+
+*/
+
+
+#ifndef __LIBMCDRIVER_FRAMEBUFFER_FRAMEBUFFERMEMORY
+#define __LIBMCDRIVER_FRAMEBUFFER_FRAMEBUFFERMEMORY
+
+#include "libmcdriver_framebuffer_interfaces.hpp"
+#include "libmcdriver_framebuffer_framebufferinstance.hpp"
+
+#include <vector>
+
+
+namespace LibMCDriver_FrameBuffer {
+namespace Impl {
+
+
+/*************************************************************************************************************************
+ Class declaration of CFrameBufferMemoryInstance 
+**************************************************************************************************************************/
+
+// Double buffered framebuffer in process memory. Behaves like a framebuffer device,
+// but does not need a /dev/fb device and shows nothing on screen.
+class CFrameBufferMemoryInstance : public CFrameBufferInstance {
+private:
+
+	std::vector<uint8_t> m_Memory;
+	uint32_t m_nScanLineLength;
+
+public:
+	
+	CFrameBufferMemoryInstance (const std::string & sIdentifier, uint32_t nScreenWidth, uint32_t nScreenHeight, LibMCDriver_FrameBuffer::eFrameBufferBitDepth bitDepth);
+	
+	virtual ~CFrameBufferMemoryInstance ();
+	
+	virtual void flip() override;
+
+	virtual bool usesDoubleBuffering() override;
+
+};
+
+typedef std::shared_ptr<CFrameBufferMemoryInstance> PFrameBufferMemoryInstance;
+
+} // namespace Impl
+} // namespace LibMCDriver_FrameBuffer
+
+#endif // __LIBMCDRIVER_FRAMEBUFFER_FRAMEBUFFERMEMORY
@@ -340,7 +340,7 @@ public:
 	virtual bool UsesDoubleBuffering() = 0;
 
 	/**
-	* IFrameBufferAccess::Flip - Flips the buffers and shows the current draw buffer on screen. Does nothing if double buffering is disabled.
+	* IFrameBufferAccess::Flip - Flips the buffers and shows the current draw buffer on screen. Afterwards, the draw buffer contains the frame that is shown, so only changed regions need to be redrawn. Does nothing if double buffering is disabled.
 	*/
 	virtual void Flip() = 0;
 
@@ -376,6 +376,16 @@ public:
 	*/
 	virtual void SetPixelRGB(const LibMCDriver_FrameBuffer_int32 nX, const LibMCDriver_FrameBuffer_int32 nY, const LibMCDriver_FrameBuffer_uint8 nRed, const LibMCDriver_FrameBuffer_uint8 nGreen, const LibMCDriver_FrameBuffer_uint8 nBlue) = 0;
 
+	/**
+	* IFrameBufferAccess::GetPixelRGB - Returns the color of a pixel as it is shown on screen. With double buffering, this is the content of the display buffer.
+	* @param[in] nX - X Coordinate of pixel to read. MUST be within the screen.
+	* @param[in] nY - Y Coordinate of pixel to read. MUST be within the screen.
+	* @param[out] nRed - Red value of the pixel (0-255).
+	* @param[out] nGreen - Green value of the pixel (0-255).
+	* @param[out] nBlue - Blue value of the pixel (0-255).
+	*/
+	virtual void GetPixelRGB(const LibMCDriver_FrameBuffer_int32 nX, const LibMCDriver_FrameBuffer_int32 nY, LibMCDriver_FrameBuffer_uint8 & nRed, LibMCDriver_FrameBuffer_uint8 & nGreen, LibMCDriver_FrameBuffer_uint8 & nBlue) = 0;
+
 	/**
 	* IFrameBufferAccess::FillRectangle - Draws a rectangle in a certain color, including the corner points.
 	* @param[in] nX1 - X Coordinate of first point to use.
@@ -541,6 +541,36 @@ LibMCDriver_FrameBufferResult libmcdriver_framebuffer_framebufferaccess_setpixel
 	}
 }
 
+LibMCDriver_FrameBufferResult libmcdriver_framebuffer_framebufferaccess_getpixelrgb(LibMCDriver_FrameBuffer_FrameBufferAccess pFrameBufferAccess, LibMCDriver_FrameBuffer_int32 nX, LibMCDriver_FrameBuffer_int32 nY, LibMCDriver_FrameBuffer_uint8 * pRed, LibMCDriver_FrameBuffer_uint8 * pGreen, LibMCDriver_FrameBuffer_uint8 * pBlue)
+{
+	IBase* pIBaseClass = (IBase *)pFrameBufferAccess;
+
+	try {
+		if (!pRed)
+			throw ELibMCDriver_FrameBufferInterfaceException (LIBMCDRIVER_FRAMEBUFFER_ERROR_INVALIDPARAM);
+		if (!pGreen)
+			throw ELibMCDriver_FrameBufferInterfaceException (LIBMCDRIVER_FRAMEBUFFER_ERROR_INVALIDPARAM);
+		if (!pBlue)
+			throw ELibMCDriver_FrameBufferInterfaceException (LIBMCDRIVER_FRAMEBUFFER_ERROR_INVALIDPARAM);
+		IFrameBufferAccess* pIFrameBufferAccess = dynamic_cast<IFrameBufferAccess*>(pIBaseClass);
+		if (!pIFrameBufferAccess)
+			throw ELibMCDriver_FrameBufferInterfaceException(LIBMCDRIVER_FRAMEBUFFER_ERROR_INVALIDCAST);
+		
+		pIFrameBufferAccess->GetPixelRGB(nX, nY, *pRed, *pGreen, *pBlue);
+
+		return LIBMCDRIVER_FRAMEBUFFER_SUCCESS;
+	}
+	catch (ELibMCDriver_FrameBufferInterfaceException & Exception) {
+		return handleLibMCDriver_FrameBufferException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
 LibMCDriver_FrameBufferResult libmcdriver_framebuffer_framebufferaccess_fillrectangle(LibMCDriver_FrameBuffer_FrameBufferAccess pFrameBufferAccess, LibMCDriver_FrameBuffer_int32 nX1, LibMCDriver_FrameBuffer_int32 nY1, LibMCDriver_FrameBuffer_int32 nX2, LibMCDriver_FrameBuffer_int32 nY2, const sLibMCDriver_FrameBufferColor * pRGBColor)
 {
 	IBase* pIBaseClass = (IBase *)pFrameBufferAccess;
@@ -871,6 +901,8 @@ LibMCDriver_FrameBufferResult LibMCDriver_FrameBuffer::Impl::LibMCDriver_FrameBu
 		*ppProcAddress = (void*) &libmcdriver_framebuffer_framebufferaccess_setpixel;
 	if (sProcName == "libmcdriver_framebuffer_framebufferaccess_setpixelrgb") 
 		*ppProcAddress = (void*) &libmcdriver_framebuffer_framebufferaccess_setpixelrgb;
+	if (sProcName == "libmcdriver_framebuffer_framebufferaccess_getpixelrgb") 
+		*ppProcAddress = (void*) &libmcdriver_framebuffer_framebufferaccess_getpixelrgb;
 	if (sProcName == "libmcdriver_framebuffer_framebufferaccess_fillrectangle") 
 		*ppProcAddress = (void*) &libmcdriver_framebuffer_framebufferaccess_fillrectangle;
 	if (sProcName == "libmcdriver_framebuffer_framebufferaccess_fillrectanglergb") 
@@ -306,6 +306,24 @@ typedef LibMCDriver_RasterizerResult (*PLibMCDriver_RasterizerRasterizer_SetSamp
 */
 typedef LibMCDriver_RasterizerResult (*PLibMCDriver_RasterizerRasterizer_GetSamplingParametersPtr) (LibMCDriver_Rasterizer_Rasterizer pRasterizer, LibMCDriver_Rasterizer_uint32 * pUnitsPerSubpixel, LibMCDriver_Rasterizer_uint32 * pPixelsPerBlock);
 
+/**
+* Sets the number of threads that calculate the image. Rasterization is single threaded by default. The block rows of the image are distributed onto the threads, the result does not depend on the thread count.
+*
+* @param[in] pRasterizer - Rasterizer instance.
+* @param[in] nThreadCount - Number of worker threads. Minimum 1, Maximum 64. Default is 1.
+* @return error code or 0 (success)
+*/
+typedef LibMCDriver_RasterizerResult (*PLibMCDriver_RasterizerRasterizer_SetThreadCountPtr) (LibMCDriver_Rasterizer_Rasterizer pRasterizer, LibMCDriver_Rasterizer_uint32 nThreadCount);
+
+/**
+* Returns the number of worker threads that calculate the image.
+*
+* @param[in] pRasterizer - Rasterizer instance.
+* @param[out] pThreadCount - Number of worker threads.
+* @return error code or 0 (success)
+*/
+typedef LibMCDriver_RasterizerResult (*PLibMCDriver_RasterizerRasterizer_GetThreadCountPtr) (LibMCDriver_Rasterizer_Rasterizer pRasterizer, LibMCDriver_Rasterizer_uint32 * pThreadCount);
+
 /**
 * Adds a layer object to subsample.
 *
@@ -543,6 +561,8 @@ typedef struct {
 	PLibMCDriver_RasterizerRasterizer_GetSubsamplingPtr m_Rasterizer_GetSubsampling;
 	PLibMCDriver_RasterizerRasterizer_SetSamplingParametersPtr m_Rasterizer_SetSamplingParameters;
 	PLibMCDriver_RasterizerRasterizer_GetSamplingParametersPtr m_Rasterizer_GetSamplingParameters;
+	PLibMCDriver_RasterizerRasterizer_SetThreadCountPtr m_Rasterizer_SetThreadCount;
+	PLibMCDriver_RasterizerRasterizer_GetThreadCountPtr m_Rasterizer_GetThreadCount;
 	PLibMCDriver_RasterizerRasterizer_AddLayerPtr m_Rasterizer_AddLayer;
 	PLibMCDriver_RasterizerRasterizer_CalculateImagePtr m_Rasterizer_CalculateImage;
 	PLibMCDriver_RasterizerSliceStack_GetLayerCountPtr m_SliceStack_GetLayerCount;
@@ -213,6 +213,7 @@ public:
 			case LIBMCDRIVER_RASTERIZER_ERROR_TOOMANYLINESINLAYER: return "TOOMANYLINESINLAYER";
 			case LIBMCDRIVER_RASTERIZER_ERROR_INVALIDHATCHCOUNT: return "INVALIDHATCHCOUNT";
 			case LIBMCDRIVER_RASTERIZER_ERROR_RASTERIZATIONNOTINITIALIZED: return "RASTERIZATIONNOTINITIALIZED";
+			case LIBMCDRIVER_RASTERIZER_ERROR_INVALIDTHREADCOUNT: return "INVALIDTHREADCOUNT";
 		}
 		return "UNKNOWN";
 	}
@@ -256,6 +257,7 @@ public:
 			case LIBMCDRIVER_RASTERIZER_ERROR_TOOMANYLINESINLAYER: return "too many lines in layer";
 			case LIBMCDRIVER_RASTERIZER_ERROR_INVALIDHATCHCOUNT: return "invalid hatch count";
 			case LIBMCDRIVER_RASTERIZER_ERROR_RASTERIZATIONNOTINITIALIZED: return "rasterization not initialized";
+			case LIBMCDRIVER_RASTERIZER_ERROR_INVALIDTHREADCOUNT: return "invalid thread count";
 		}
 		return "unknown error";
 	}
@@ -513,6 +515,8 @@ public:
 	inline void GetSubsampling(LibMCDriver_Rasterizer_uint32 & nSubsamplingX, LibMCDriver_Rasterizer_uint32 & nSubsamplingY);
 	inline void SetSamplingParameters(const LibMCDriver_Rasterizer_uint32 nUnitsPerSubpixel, const LibMCDriver_Rasterizer_uint32 nPixelsPerBlock);
 	inline void GetSamplingParameters(LibMCDriver_Rasterizer_uint32 & nUnitsPerSubpixel, LibMCDriver_Rasterizer_uint32 & nPixelsPerBlock);
+	inline void SetThreadCount(const LibMCDriver_Rasterizer_uint32 nThreadCount);
+	inline LibMCDriver_Rasterizer_uint32 GetThreadCount();
 	inline void AddLayer(classParam<CLayerObject> pLayerObject);
 	inline void CalculateImage(classParam<LibMCEnv::CImageData> pImageObject, const bool bAntialiased);
 };
@@ -706,6 +710,8 @@ public:
 		pWrapperTable->m_Rasterizer_GetSubsampling = nullptr;
 		pWrapperTable->m_Rasterizer_SetSamplingParameters = nullptr;
 		pWrapperTable->m_Rasterizer_GetSamplingParameters = nullptr;
+		pWrapperTable->m_Rasterizer_SetThreadCount = nullptr;
+		pWrapperTable->m_Rasterizer_GetThreadCount = nullptr;
 		pWrapperTable->m_Rasterizer_AddLayer = nullptr;
 		pWrapperTable->m_Rasterizer_CalculateImage = nullptr;
 		pWrapperTable->m_SliceStack_GetLayerCount = nullptr;
@@ -992,6 +998,24 @@ public:
 		if (pWrapperTable->m_Rasterizer_GetSamplingParameters == nullptr)
 			return LIBMCDRIVER_RASTERIZER_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		#ifdef _WIN32
+		pWrapperTable->m_Rasterizer_SetThreadCount = (PLibMCDriver_RasterizerRasterizer_SetThreadCountPtr) GetProcAddress(hLibrary, "libmcdriver_rasterizer_rasterizer_setthreadcount");
+		#else // _WIN32
+		pWrapperTable->m_Rasterizer_SetThreadCount = (PLibMCDriver_RasterizerRasterizer_SetThreadCountPtr) dlsym(hLibrary, "libmcdriver_rasterizer_rasterizer_setthreadcount");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Rasterizer_SetThreadCount == nullptr)
+			return LIBMCDRIVER_RASTERIZER_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_Rasterizer_GetThreadCount = (PLibMCDriver_RasterizerRasterizer_GetThreadCountPtr) GetProcAddress(hLibrary, "libmcdriver_rasterizer_rasterizer_getthreadcount");
+		#else // _WIN32
+		pWrapperTable->m_Rasterizer_GetThreadCount = (PLibMCDriver_RasterizerRasterizer_GetThreadCountPtr) dlsym(hLibrary, "libmcdriver_rasterizer_rasterizer_getthreadcount");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Rasterizer_GetThreadCount == nullptr)
+			return LIBMCDRIVER_RASTERIZER_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		#ifdef _WIN32
 		pWrapperTable->m_Rasterizer_AddLayer = (PLibMCDriver_RasterizerRasterizer_AddLayerPtr) GetProcAddress(hLibrary, "libmcdriver_rasterizer_rasterizer_addlayer");
 		#else // _WIN32
@@ -1284,6 +1308,14 @@ public:
 		if ( (eLookupError != 0) || (pWrapperTable->m_Rasterizer_GetSamplingParameters == nullptr) )
 			return LIBMCDRIVER_RASTERIZER_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		eLookupError = (*pLookup)("libmcdriver_rasterizer_rasterizer_setthreadcount", (void**)&(pWrapperTable->m_Rasterizer_SetThreadCount));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Rasterizer_SetThreadCount == nullptr) )
+			return LIBMCDRIVER_RASTERIZER_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libmcdriver_rasterizer_rasterizer_getthreadcount", (void**)&(pWrapperTable->m_Rasterizer_GetThreadCount));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Rasterizer_GetThreadCount == nullptr) )
+			return LIBMCDRIVER_RASTERIZER_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		eLookupError = (*pLookup)("libmcdriver_rasterizer_rasterizer_addlayer", (void**)&(pWrapperTable->m_Rasterizer_AddLayer));
 		if ( (eLookupError != 0) || (pWrapperTable->m_Rasterizer_AddLayer == nullptr) )
 			return LIBMCDRIVER_RASTERIZER_ERROR_COULDNOTFINDLIBRARYEXPORT;
@@ -1681,6 +1713,27 @@ public:
 		CheckError(m_pWrapper->m_WrapperTable.m_Rasterizer_GetSamplingParameters(m_pHandle, &nUnitsPerSubpixel, &nPixelsPerBlock));
 	}
 	
+	/**
+	* CRasterizer::SetThreadCount - Sets the number of threads that calculate the image. Rasterization is single threaded by default. The block rows of the image are distributed onto the threads, the result does not depend on the thread count.
+	* @param[in] nThreadCount - Number of worker threads. Minimum 1, Maximum 64. Default is 1.
+	*/
+	void CRasterizer::SetThreadCount(const LibMCDriver_Rasterizer_uint32 nThreadCount)
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_Rasterizer_SetThreadCount(m_pHandle, nThreadCount));
+	}
+	
+	/**
+	* CRasterizer::GetThreadCount - Returns the number of worker threads that calculate the image.
+	* @return Number of worker threads.
+	*/
+	LibMCDriver_Rasterizer_uint32 CRasterizer::GetThreadCount()
+	{
+		LibMCDriver_Rasterizer_uint32 resultThreadCount = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_Rasterizer_GetThreadCount(m_pHandle, &resultThreadCount));
+		
+		return resultThreadCount;
+	}
+	
 	/**
 	* CRasterizer::AddLayer - Adds a layer object to subsample.
 	* @param[in] pLayerObject - Layer object instance.
@@ -131,6 +131,7 @@ typedef void * LibMCDriver_Rasterizer_pvoid;
 #define LIBMCDRIVER_RASTERIZER_ERROR_TOOMANYLINESINLAYER 33 /** too many lines in layer */
 #define LIBMCDRIVER_RASTERIZER_ERROR_INVALIDHATCHCOUNT 34 /** invalid hatch count */
 #define LIBMCDRIVER_RASTERIZER_ERROR_RASTERIZATIONNOTINITIALIZED 35 /** rasterization not initialized */
+#define LIBMCDRIVER_RASTERIZER_ERROR_INVALIDTHREADCOUNT 36 /** invalid thread count */
 
 /*************************************************************************************************************************
  Error strings for LibMCDriver_Rasterizer
@@ -174,6 +175,7 @@ inline const char * LIBMCDRIVER_RASTERIZER_GETERRORSTRING (LibMCDriver_Rasterize
     case LIBMCDRIVER_RASTERIZER_ERROR_TOOMANYLINESINLAYER: return "too many lines in layer";
     case LIBMCDRIVER_RASTERIZER_ERROR_INVALIDHATCHCOUNT: return "invalid hatch count";
     case LIBMCDRIVER_RASTERIZER_ERROR_RASTERIZATIONNOTINITIALIZED: return "rasterization not initialized";
+    case LIBMCDRIVER_RASTERIZER_ERROR_INVALIDTHREADCOUNT: return "invalid thread count";
     default: return "unknown error";
   }
 }
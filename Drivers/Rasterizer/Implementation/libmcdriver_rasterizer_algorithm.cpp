@@ -687,14 +687,21 @@ void CRasterizationAlgorithm::buildBlockScanLines(uint32_t nBlockIndexX, uint32_
 
 }
 
+void CRasterizationAlgorithm::buildBlockRowScanLines(uint32_t nBlockIndexY)
+{
+    // The winding number seeds are propagated from left to right, so the blocks of a row need to be built in order.
+    for (uint32_t nBlockIndexX = 0; nBlockIndexX < m_nBlockCountX; nBlockIndexX++)
+        buildBlockScanLines(nBlockIndexX, nBlockIndexY);
+}
+
 void CRasterizationAlgorithm::addDrawLineToBlock(_sRasterBlockStructure* pBlock, int32_t nStartXInUnits, int32_t nEndXInUnits, int32_t nYValueInUnits)
 {
     __RASTERASSERT(pBlock != nullptr, "invalid block parameter");
-    if (m_nCurrentDrawLineBufferIndex >= m_DrawLineBuffer.size())
+    uint64_t nDrawLineIndex = m_nCurrentDrawLineBufferIndex.fetch_add(1);
+    if (nDrawLineIndex >= m_DrawLineBuffer.size())
         throw std::runtime_error("draw line buffer overflow!");
 
-    sRasterBlockDrawLine* pDrawLine = &m_DrawLineBuffer.at(m_nCurrentDrawLineBufferIndex);
-    m_nCurrentDrawLineBufferIndex++;
+    sRasterBlockDrawLine* pDrawLine = &m_DrawLineBuffer.at(nDrawLineIndex);
 
     pDrawLine->m_nStartXInUnits = nStartXInUnits;
     pDrawLine->m_nEndXInUnits = nEndXInUnits;
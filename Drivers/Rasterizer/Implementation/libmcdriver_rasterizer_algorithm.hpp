@@ -35,6 +35,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <vector>
 #include <memory>
+#include <atomic>
 
 #define RASTERALGORITHM_MINUNITSPERSUBPIXEL 4
 #define RASTERALGORITHM_MAXUNITSPERSUBPIXEL (1024 * 1024)
@@ -47,6 +48,11 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define RASTERALGORITHM_MAXPIXELSPERBLOCK 1024
 #define RASTERALGORITHM_DEFAULTPIXELSPERBLOCK 32
 
+// Rasterization is single threaded unless more threads are requested explicitly
+#define RASTERALGORITHM_MINTHREADCOUNT 1
+#define RASTERALGORITHM_MAXTHREADCOUNT 64
+#define RASTERALGORITHM_DEFAULTTHREADCOUNT 1
+
 namespace LibMCDriver_Rasterizer {
     namespace Impl {
 
@@ -142,7 +148,8 @@ namespace LibMCDriver_Rasterizer {
                 std::vector<sRasterLine> m_Lines;
                 std::vector<int32_t> m_ScanSeedValueBuffer;
 
-                uint64_t m_nCurrentDrawLineBufferIndex;
+                // Draw lines are allocated concurrently when block rows are processed in parallel
+                std::atomic<uint64_t> m_nCurrentDrawLineBufferIndex;
                 std::vector<sRasterBlockDrawLine> m_DrawLineBuffer;
 
                 bool isOnScanLineX(int32_t nXunits);
@@ -167,6 +174,9 @@ namespace LibMCDriver_Rasterizer {
                 void buildBlocks();
                 void buildBlockScanLines(uint32_t nBlockIndexX, uint32_t nBlockIndexY);
 
+                // Block rows are independent of each other and may be built from different threads.
+                void buildBlockRowScanLines(uint32_t nBlockIndexY);
+
                 sRasterBlockStructure* getBlock(uint32_t nBlockIndexX, uint32_t nBlockIndexY);
                 eBlockType getBlockInfoAtXY (int32_t nXunits, int32_t nYunits);
                 eBlockType getBlockInfo(int32_t nBlockX, int32_t nBlockY);
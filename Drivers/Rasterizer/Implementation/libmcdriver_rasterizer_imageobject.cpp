@@ -195,7 +195,7 @@ std::vector<uint8_t>& CImageObject::getBuffer()
 }
 
 
-void CImageObject::initRasterizationAlgorithms(uint32_t nUnitsPerSubPixel, uint32_t nPixelsPerBlock, uint32_t nSubSamplingX, uint32_t nSubSamplingY)
+void CImageObject::initRasterizationAlgorithms(uint32_t nUnitsPerSubPixel, uint32_t nPixelsPerBlock, uint32_t nSubSamplingX, uint32_t nSubSamplingY, PRasterizerWorkerPool pWorkerPool)
 {
 	if (nSubSamplingX < RASTERER_MINSUBSAMPLING)
 		throw ELibMCDriver_RasterizerInterfaceException(LIBMCDRIVER_RASTERIZER_ERROR_INVALIDSUBSAMPLING);
@@ -205,6 +205,8 @@ void CImageObject::initRasterizationAlgorithms(uint32_t nUnitsPerSubPixel, uint3
 		throw ELibMCDriver_RasterizerInterfaceException(LIBMCDRIVER_RASTERIZER_ERROR_INVALIDSUBSAMPLING);
 	if (nSubSamplingY > RASTERER_MAXSUBSAMPLING)
 		throw ELibMCDriver_RasterizerInterfaceException(LIBMCDRIVER_RASTERIZER_ERROR_INVALIDSUBSAMPLING);
+	if (pWorkerPool.get() == nullptr)
+		throw ELibMCDriver_RasterizerInterfaceException(LIBMCDRIVER_RASTERIZER_ERROR_INVALIDPARAM);
 
 	m_nBlockCountX = (m_nPixelCountX + nPixelsPerBlock - 1) / nPixelsPerBlock;
 	m_nBlockCountY = (m_nPixelCountY + nPixelsPerBlock - 1) / nPixelsPerBlock;
@@ -216,6 +218,7 @@ void CImageObject::initRasterizationAlgorithms(uint32_t nUnitsPerSubPixel, uint3
 
 	m_nSubSamplingX = nSubSamplingX;
 	m_nSubSamplingY = nSubSamplingY;
+	m_pWorkerPool = pWorkerPool;
 
 	m_Algorithms.clear();
 
@@ -234,24 +237,27 @@ void CImageObject::addRasterizationLayer(CLayerDataObject* pLayer)
 
 	pLayer->addClosedPolygonsToAlgorithm(pAlgorithm.get(), m_dUnitsX, m_dUnitsY);
 	pAlgorithm->buildBlocks();
-	for (uint32_t nBlockY = 0; nBlockY < m_nBlockCountY; nBlockY++) {
-		for (uint32_t nBlockX = 0; nBlockX < m_nBlockCountX; nBlockX++) {
-			pAlgorithm->buildBlockScanLines (nBlockX, nBlockY);
-		}
-	}
-			
+
+	processBlockRows([&pAlgorithm](uint32_t nBlockY) {
+		pAlgorithm->buildBlockRowScanLines(nBlockY);
+	});
 
 	m_Algorithms.push_back(pAlgorithm);
 
 }
 
-void CImageObject::calculateRasterizationImage(bool bAntiAliased)
+void CImageObject::processBlockRows(std::function<void(uint32_t nBlockY)> rowFunction)
 {
-	if ((m_nBlockCountX == 0) || (m_nBlockCountY == 0))
+	if (m_pWorkerPool.get() == nullptr)
 		throw ELibMCDriver_RasterizerInterfaceException(LIBMCDRIVER_RASTERIZER_ERROR_RASTERIZATIONNOTINITIALIZED);
-	if (m_Algorithms.empty ()) 
-		throw ELibMCDriver_RasterizerInterfaceException(LIBMCDRIVER_RASTERIZER_ERROR_INVALIDSUBSAMPLING);
 
+	// Rows are handed out dynamically, as the amount of border blocks varies strongly across the image.
+	// Every row writes into disjoint memory, so the result does not depend on the scheduling.
+	m_pWorkerPool->processInParallel(m_nBlockCountY, rowFunction);
+}
+
+void CImageObject::calculateRasterizationBlockRow(uint32_t nBlockY, bool bAntiAliased)
+{
 	uint32_t nNumberOfZSamples = (uint32_t) m_Algorithms.size();
 	uint32_t nValueRange = 255;
 	uint32_t nValueBWThreshold = nValueRange / 2;
@@ -263,71 +269,82 @@ void CImageObject::calculateRasterizationImage(bool bAntiAliased)
 	m_BlockBuffer.resize((size_t)m_nPixelsPerBlock * (size_t)m_nPixelsPerBlock);
 
 	for (uint32_t nBlockX = 0; nBlockX < m_nBlockCountX; nBlockX++) {
-		for (uint32_t nBlockY = 0; nBlockY < m_nBlockCountY; nBlockY++) {
 			
-			uint32_t nBaseValue = 0;
-			uint32_t nActiveLayerCount = 0;
-			for (auto algorithm : m_Algorithms) {
-				auto blockInfo = algorithm->getBlockInfo(nBlockX, nBlockY);
-				if (blockInfo == eBlockType::btCompleteInside)
-					nBaseValue += nValueRange;
-				if (blockInfo == eBlockType::btBorder) {
-					m_ActiveAlgorithms[nActiveLayerCount] = algorithm.get();
-					nActiveLayerCount++;
-				}
+		uint32_t nBaseValue = 0;
+		uint32_t nActiveLayerCount = 0;
+		for (auto algorithm : m_Algorithms) {
+			auto blockInfo = algorithm->getBlockInfo(nBlockX, nBlockY);
+			if (blockInfo == eBlockType::btCompleteInside)
+				nBaseValue += nValueRange;
+			if (blockInfo == eBlockType::btBorder) {
+				m_ActiveAlgorithms[nActiveLayerCount] = algorithm.get();
+				nActiveLayerCount++;
 			}
+		}
 
-			if (nActiveLayerCount == 0) {
-				uint32_t nValueNormalized = nBaseValue / nNumberOfZSamples;
-				if (!bAntiAliased) {
-					if (nValueNormalized > nValueBWThreshold)
-						nValueNormalized = nValueRange;
-					else
-						nValueNormalized = 0;
-				}
+		if (nActiveLayerCount == 0) {
+			uint32_t nValueNormalized = nBaseValue / nNumberOfZSamples;
+			if (!bAntiAliased) {
+				if (nValueNormalized > nValueBWThreshold)
+					nValueNormalized = nValueRange;
+				else
+					nValueNormalized = 0;
+			}
 
-				for (uint32_t dY = 0; dY < m_nPixelsPerBlock; dY++) {
-					uint32_t nY = nBlockY * m_nPixelsPerBlock + dY;
-					uint32_t nX = nBlockX * m_nPixelsPerBlock;
-					for (uint32_t dX = 0; dX < m_nPixelsPerBlock; dX++) {
-						setPixel(nX, nY, (uint8_t)nValueNormalized);
-						nX++;
-					}
+			for (uint32_t dY = 0; dY < m_nPixelsPerBlock; dY++) {
+				uint32_t nY = nBlockY * m_nPixelsPerBlock + dY;
+				uint32_t nX = nBlockX * m_nPixelsPerBlock;
+				for (uint32_t dX = 0; dX < m_nPixelsPerBlock; dX++) {
+					setPixel(nX, nY, (uint8_t)nValueNormalized);
+					nX++;
 				}
 			}
-			else {
-				for (auto it = m_BlockBuffer.begin(); it != m_BlockBuffer.end(); it++)
-					*it = nBaseValue;
+		}
+		else {
+			for (auto it = m_BlockBuffer.begin(); it != m_BlockBuffer.end(); it++)
+				*it = nBaseValue;
 
-				for (uint32_t nSampleIndex = 0; nSampleIndex < nActiveLayerCount; nSampleIndex++) {
-					m_ActiveAlgorithms[nSampleIndex]->addBlockToBuffer (nBlockX, nBlockY, m_BlockBuffer);
-				}
+			for (uint32_t nSampleIndex = 0; nSampleIndex < nActiveLayerCount; nSampleIndex++) {
+				m_ActiveAlgorithms[nSampleIndex]->addBlockToBuffer (nBlockX, nBlockY, m_BlockBuffer);
+			}
 
-				for (uint32_t dY = 0; dY < m_nPixelsPerBlock; dY++) {
-					uint32_t nY = nBlockY * m_nPixelsPerBlock + dY;
-					uint32_t nX = nBlockX * m_nPixelsPerBlock;
-					for (uint32_t dX = 0; dX < m_nPixelsPerBlock; dX++) {
-						uint32_t nValueNormalized = m_BlockBuffer[(size_t)dX + (size_t)dY * m_nPixelsPerBlock] / nNumberOfZSamples;
-						if (!bAntiAliased) {
-							if (nValueNormalized > nValueBWThreshold)
-								nValueNormalized = nValueRange;
-							else
-								nValueNormalized = 0;
-						}
-
-						setPixel(nX, nY, (uint8_t)nValueNormalized);
-						nX++;
+			for (uint32_t dY = 0; dY < m_nPixelsPerBlock; dY++) {
+				uint32_t nY = nBlockY * m_nPixelsPerBlock + dY;
+				uint32_t nX = nBlockX * m_nPixelsPerBlock;
+				for (uint32_t dX = 0; dX < m_nPixelsPerBlock; dX++) {
+					uint32_t nValueNormalized = m_BlockBuffer[(size_t)dX + (size_t)dY * m_nPixelsPerBlock] / nNumberOfZSamples;
+					if (!bAntiAliased) {
+						if (nValueNormalized > nValueBWThreshold)
+							nValueNormalized = nValueRange;
+						else
+							nValueNormalized = 0;
 					}
-				}
 
+					setPixel(nX, nY, (uint8_t)nValueNormalized);
+					nX++;
+				}
 			}
 
 		}
+
 	}
 
+}
+
+void CImageObject::calculateRasterizationImage(bool bAntiAliased)
+{
+	if ((m_nBlockCountX == 0) || (m_nBlockCountY == 0))
+		throw ELibMCDriver_RasterizerInterfaceException(LIBMCDRIVER_RASTERIZER_ERROR_RASTERIZATIONNOTINITIALIZED);
+	if (m_Algorithms.empty ()) 
+		throw ELibMCDriver_RasterizerInterfaceException(LIBMCDRIVER_RASTERIZER_ERROR_INVALIDSUBSAMPLING);
+
+	processBlockRows([this, bAntiAliased](uint32_t nBlockY) {
+		calculateRasterizationBlockRow(nBlockY, bAntiAliased);
+	});
+
 	m_nBlockCountX = 0;
 	m_nBlockCountY = 0;
 	m_Algorithms.clear();
+	m_pWorkerPool = nullptr;
 
 }
-
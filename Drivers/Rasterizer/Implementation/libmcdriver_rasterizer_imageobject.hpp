@@ -46,6 +46,8 @@ Abstract: This is the class declaration of CImageObject
 #endif
 
 // Include custom headers here.
+#include "libmcdriver_rasterizer_workerpool.hpp"
+#include <functional>
 
 
 namespace LibMCDriver_Rasterizer {
@@ -59,6 +61,10 @@ namespace Impl {
 class CImageObject {
 private:
 
+	// Distributes the block rows of the image onto the threads of m_pWorkerPool.
+	void processBlockRows(std::function<void(uint32_t nBlockY)> rowFunction);
+
+	void calculateRasterizationBlockRow(uint32_t nBlockY, bool bAntiAliased);
 
 protected:
 
@@ -79,6 +85,7 @@ protected:
 	uint32_t m_nSubSamplingX;
 	uint32_t m_nSubSamplingY;
 	uint32_t m_nPixelsPerBlock;
+	PRasterizerWorkerPool m_pWorkerPool;
 	double m_dUnitsX;
 	double m_dUnitsY;
 
@@ -103,7 +110,7 @@ public:
 
 	std::vector<uint8_t> & getBuffer();
 
-	void initRasterizationAlgorithms(uint32_t nUnitsPerSubPixel, uint32_t nPixelsPerBlock, uint32_t nSubSamplingX, uint32_t nSubSamplingY);
+	void initRasterizationAlgorithms(uint32_t nUnitsPerSubPixel, uint32_t nPixelsPerBlock, uint32_t nSubSamplingX, uint32_t nSubSamplingY, PRasterizerWorkerPool pWorkerPool);
 
 	void addRasterizationLayer(CLayerDataObject * pLayer);
 
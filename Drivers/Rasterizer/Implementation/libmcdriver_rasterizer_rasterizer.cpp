@@ -134,7 +134,7 @@ void CRasterizerInstance::AddLayer(ILayerObject* pLayerObject)
 	m_Layers.push_back(pLayerObjectInstance->getDataObject());
 }
 
-void CRasterizerInstance::CalculateImage(LibMCEnv::CImageData* pImageData, const bool bAntialiased, uint32_t nUnitsPerSubPixel, uint32_t nPixelsPerBlock)
+void CRasterizerInstance::CalculateImage(LibMCEnv::CImageData* pImageData, const bool bAntialiased, uint32_t nUnitsPerSubPixel, uint32_t nPixelsPerBlock, uint32_t nThreadCount)
 {
 	if (pImageData == nullptr)
 		throw ELibMCDriver_RasterizerInterfaceException(LIBMCDRIVER_RASTERIZER_ERROR_INVALIDPARAM);
@@ -146,6 +146,8 @@ void CRasterizerInstance::CalculateImage(LibMCEnv::CImageData* pImageData, const
 		throw ELibMCDriver_RasterizerInterfaceException(LIBMCDRIVER_RASTERIZER_ERROR_INVALIDUNITSPERSUBPIXEL);
 	if ((nPixelsPerBlock < RASTERALGORITHM_MINPIXELSPERBLOCK) || (nPixelsPerBlock > RASTERALGORITHM_MAXPIXELSPERBLOCK))
 		throw ELibMCDriver_RasterizerInterfaceException(LIBMCDRIVER_RASTERIZER_ERROR_INVALIDPIXELSPERBLOCK);
+	if ((nThreadCount < RASTERALGORITHM_MINTHREADCOUNT) || (nThreadCount > RASTERALGORITHM_MAXTHREADCOUNT))
+		throw ELibMCDriver_RasterizerInterfaceException(LIBMCDRIVER_RASTERIZER_ERROR_INVALIDTHREADCOUNT);
 
 	uint32_t nPixelSizeX = 0;
 	uint32_t nPixelSizeY = 0;
@@ -162,7 +164,14 @@ void CRasterizerInstance::CalculateImage(LibMCEnv::CImageData* pImageData, const
 
 	if (!m_Layers.empty()) {
 
-		pImage->initRasterizationAlgorithms(nUnitsPerSubPixel, nPixelsPerBlock, m_nSubSamplingX, m_nSubSamplingY);
+		// The worker threads are kept alive between calculations and only restarted if the thread count changes
+		if ((m_pWorkerPool.get() == nullptr) || (m_pWorkerPool->getThreadCount() != nThreadCount))
+		{
+			m_pWorkerPool = nullptr;
+			m_pWorkerPool = std::make_shared<CRasterizerWorkerPool>(nThreadCount);
+		}
+
+		pImage->initRasterizationAlgorithms(nUnitsPerSubPixel, nPixelsPerBlock, m_nSubSamplingX, m_nSubSamplingY, m_pWorkerPool);
 		for (auto pLayer : m_Layers)
 			pImage->addRasterizationLayer (pLayer.get());
 		pImage->calculateRasterizationImage (bAntialiased);
@@ -182,7 +191,8 @@ void CRasterizerInstance::CalculateImage(LibMCEnv::CImageData* pImageData, const
 CRasterizer::CRasterizer(PRasterizerInstance pRasterizerInstance)
 	: m_pRasterizerInstance (pRasterizerInstance),
 	m_nUnitsPerSubPixel (RASTERALGORITHM_DEFAULTUNITSPERSUBPIXEL),
-	m_nPixelsPerBlock (RASTERALGORITHM_DEFAULTPIXELSPERBLOCK)
+	m_nPixelsPerBlock (RASTERALGORITHM_DEFAULTPIXELSPERBLOCK),
+	m_nThreadCount (RASTERALGORITHM_DEFAULTTHREADCOUNT)
 {
 	if (pRasterizerInstance.get() == nullptr)
 		throw ELibMCDriver_RasterizerInterfaceException(LIBMCDRIVER_RASTERIZER_ERROR_INVALIDPARAM);
@@ -236,7 +246,7 @@ void CRasterizer::AddLayer(ILayerObject* pLayerObject)
 
 void CRasterizer::CalculateImage(LibMCEnv::PImageData pImageObject, const bool bAntialiased)
 {
-	m_pRasterizerInstance->CalculateImage(pImageObject.get(), bAntialiased, m_nUnitsPerSubPixel, m_nPixelsPerBlock);
+	m_pRasterizerInstance->CalculateImage(pImageObject.get(), bAntialiased, m_nUnitsPerSubPixel, m_nPixelsPerBlock, m_nThreadCount);
 }
 
 void CRasterizer::SetSamplingParameters(const LibMCDriver_Rasterizer_uint32 nUnitsPerSubpixel, const LibMCDriver_Rasterizer_uint32 nPixelsPerBlock)
@@ -257,3 +267,16 @@ void CRasterizer::GetSamplingParameters(LibMCDriver_Rasterizer_uint32& nUnitsPer
 	nPixelsPerBlock = m_nPixelsPerBlock;
 }
 
+void CRasterizer::SetThreadCount(const LibMCDriver_Rasterizer_uint32 nThreadCount)
+{
+	if ((nThreadCount < RASTERALGORITHM_MINTHREADCOUNT) || (nThreadCount > RASTERALGORITHM_MAXTHREADCOUNT))
+		throw ELibMCDriver_RasterizerInterfaceException(LIBMCDRIVER_RASTERIZER_ERROR_INVALIDTHREADCOUNT);
+
+	m_nThreadCount = nThreadCount;
+}
+
+LibMCDriver_Rasterizer_uint32 CRasterizer::GetThreadCount()
+{
+	return m_nThreadCount;
+}
+
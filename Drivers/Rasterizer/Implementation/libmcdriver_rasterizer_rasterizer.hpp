@@ -37,6 +37,7 @@ Abstract: This is the class declaration of CRasterizer
 
 #include "libmcdriver_rasterizer_interfaces.hpp"
 #include "libmcdriver_rasterizer_layerobject.hpp"
+#include "libmcdriver_rasterizer_workerpool.hpp"
 
 // Parent classes
 #include "libmcdriver_rasterizer_base.hpp"
@@ -71,6 +72,8 @@ private:
 
 	std::vector<PLayerDataObject> m_Layers;
 
+	PRasterizerWorkerPool m_pWorkerPool;
+
 protected:
 
 
@@ -94,7 +97,7 @@ public:
 
 	void AddLayer(ILayerObject* pLayerObject);
 
-	void CalculateImage(LibMCEnv::CImageData * pImageData, const bool bAntialiased, uint32_t nUnitsPerSubPixel, uint32_t nPixelsPerBlock);
+	void CalculateImage(LibMCEnv::CImageData * pImageData, const bool bAntialiased, uint32_t nUnitsPerSubPixel, uint32_t nPixelsPerBlock, uint32_t nThreadCount);
 
 
 };
@@ -113,6 +116,7 @@ protected:
 
 	uint32_t m_nUnitsPerSubPixel;
 	uint32_t m_nPixelsPerBlock;
+	uint32_t m_nThreadCount;
 
 public:
 
@@ -142,6 +146,10 @@ public:
 
 	void GetSamplingParameters(LibMCDriver_Rasterizer_uint32& nUnitsPerSubpixel, LibMCDriver_Rasterizer_uint32& nPixelsPerBlock) override;
 
+	void SetThreadCount(const LibMCDriver_Rasterizer_uint32 nThreadCount) override;
+
+	LibMCDriver_Rasterizer_uint32 GetThreadCount() override;
+
 };
 
 } // namespace Impl
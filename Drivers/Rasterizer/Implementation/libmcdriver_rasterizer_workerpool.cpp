@@ -0,0 +1,147 @@
+/*++
+
+Copyright (C) 2022 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the Autodesk Inc. nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 'AS IS' AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+
+Abstract: This is the class definition of CRasterizerWorkerPool
+
+*/
+
+#include "libmcdriver_rasterizer_workerpool.hpp"
+#include "libmcdriver_rasterizer_algorithm.hpp"
+#include "libmcdriver_rasterizer_interfaceexception.hpp"
+
+using namespace LibMCDriver_Rasterizer::Impl;
+
+CRasterizerWorkerPool::CRasterizerWorkerPool(uint32_t nThreadCount)
+	: m_pProcessIndex(nullptr), m_nCount(0), m_nNextIndex(0), m_nGeneration(0), m_nBusyWorkerCount(0), m_bShutdown(false)
+{
+	if ((nThreadCount < RASTERALGORITHM_MINTHREADCOUNT) || (nThreadCount > RASTERALGORITHM_MAXTHREADCOUNT))
+		throw ELibMCDriver_RasterizerInterfaceException(LIBMCDRIVER_RASTERIZER_ERROR_INVALIDTHREADCOUNT);
+
+	m_Workers.reserve(nThreadCount - 1);
+	for (uint32_t nWorkerIndex = 1; nWorkerIndex < nThreadCount; nWorkerIndex++)
+		m_Workers.push_back(std::thread(&CRasterizerWorkerPool::workerLoop, this));
+}
+
+CRasterizerWorkerPool::~CRasterizerWorkerPool()
+{
+	{
+		std::lock_guard<std::mutex> lockGuard(m_StateMutex);
+		m_bShutdown = true;
+	}
+	m_WorkAvailableSignal.notify_all();
+
+	for (auto& worker : m_Workers)
+		worker.join();
+}
+
+uint32_t CRasterizerWorkerPool::getThreadCount()
+{
+	return (uint32_t)m_Workers.size() + 1;
+}
+
+void CRasterizerWorkerPool::workerLoop()
+{
+	uint64_t nLastGeneration = 0;
+
+	while (true) {
+		{
+			std::unique_lock<std::mutex> lock(m_StateMutex);
+			m_WorkAvailableSignal.wait(lock, [this, nLastGeneration]() { return m_bShutdown || (m_nGeneration != nLastGeneration); });
+			if (m_bShutdown)
+				return;
+
+			nLastGeneration = m_nGeneration;
+		}
+
+		processIndices();
+
+		{
+			std::lock_guard<std::mutex> lockGuard(m_StateMutex);
+			m_nBusyWorkerCount--;
+			if (m_nBusyWorkerCount == 0)
+				m_WorkFinishedSignal.notify_all();
+		}
+	}
+}
+
+void CRasterizerWorkerPool::processIndices()
+{
+	try {
+		uint32_t nIndex;
+		while ((nIndex = m_nNextIndex.fetch_add(1)) < m_nCount)
+			(*m_pProcessIndex)(nIndex);
+	}
+	catch (...) {
+		std::lock_guard<std::mutex> lockGuard(m_StateMutex);
+		if (!m_pFirstException)
+			m_pFirstException = std::current_exception();
+
+		// Let the other threads run out of work
+		m_nNextIndex.store(m_nCount);
+	}
+}
+
+void CRasterizerWorkerPool::processInParallel(uint32_t nCount, const std::function<void(uint32_t nIndex)>& processIndex)
+{
+	if (m_Workers.empty() || (nCount <= 1)) {
+		for (uint32_t nIndex = 0; nIndex < nCount; nIndex++)
+			processIndex(nIndex);
+		return;
+	}
+
+	std::lock_guard<std::mutex> callLockGuard(m_CallMutex);
+
+	{
+		std::lock_guard<std::mutex> lockGuard(m_StateMutex);
+		m_pProcessIndex = &processIndex;
+		m_nCount = nCount;
+		m_nNextIndex.store(0);
+		m_pFirstException = nullptr;
+		m_nBusyWorkerCount = m_Workers.size();
+		m_nGeneration++;
+	}
+	m_WorkAvailableSignal.notify_all();
+
+	// The calling thread takes part in the work
+	processIndices();
+
+	std::exception_ptr pException;
+	{
+		std::unique_lock<std::mutex> lock(m_StateMutex);
+		m_WorkFinishedSignal.wait(lock, [this]() { return m_nBusyWorkerCount == 0; });
+
+		m_pProcessIndex = nullptr;
+		pException = m_pFirstException;
+		m_pFirstException = nullptr;
+	}
+
+	if (pException)
+		std::rethrow_exception(pException);
+}
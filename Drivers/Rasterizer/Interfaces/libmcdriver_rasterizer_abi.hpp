@@ -319,6 +319,24 @@ LIBMCDRIVER_RASTERIZER_DECLSPEC LibMCDriver_RasterizerResult libmcdriver_rasteri
 */
 LIBMCDRIVER_RASTERIZER_DECLSPEC LibMCDriver_RasterizerResult libmcdriver_rasterizer_rasterizer_getsamplingparameters(LibMCDriver_Rasterizer_Rasterizer pRasterizer, LibMCDriver_Rasterizer_uint32 * pUnitsPerSubpixel, LibMCDriver_Rasterizer_uint32 * pPixelsPerBlock);
 
+/**
+* Sets the number of threads that calculate the image. Rasterization is single threaded by default. The block rows of the image are distributed onto the threads, the result does not depend on the thread count.
+*
+* @param[in] pRasterizer - Rasterizer instance.
+* @param[in] nThreadCount - Number of worker threads. Minimum 1, Maximum 64. Default is 1.
+* @return error code or 0 (success)
+*/
+LIBMCDRIVER_RASTERIZER_DECLSPEC LibMCDriver_RasterizerResult libmcdriver_rasterizer_rasterizer_setthreadcount(LibMCDriver_Rasterizer_Rasterizer pRasterizer, LibMCDriver_Rasterizer_uint32 nThreadCount);
+
+/**
+* Returns the number of worker threads that calculate the image.
+*
+* @param[in] pRasterizer - Rasterizer instance.
+* @param[out] pThreadCount - Number of worker threads.
+* @return error code or 0 (success)
+*/
+LIBMCDRIVER_RASTERIZER_DECLSPEC LibMCDriver_RasterizerResult libmcdriver_rasterizer_rasterizer_getthreadcount(LibMCDriver_Rasterizer_Rasterizer pRasterizer, LibMCDriver_Rasterizer_uint32 * pThreadCount);
+
 /**
 * Adds a layer object to subsample.
 *
@@ -458,6 +458,18 @@ public:
 	*/
 	virtual void GetSamplingParameters(LibMCDriver_Rasterizer_uint32 & nUnitsPerSubpixel, LibMCDriver_Rasterizer_uint32 & nPixelsPerBlock) = 0;
 
+	/**
+	* IRasterizer::SetThreadCount - Sets the number of threads that calculate the image. Rasterization is single threaded by default. The block rows of the image are distributed onto the threads, the result does not depend on the thread count.
+	* @param[in] nThreadCount - Number of worker threads. Minimum 1, Maximum 64. Default is 1.
+	*/
+	virtual void SetThreadCount(const LibMCDriver_Rasterizer_uint32 nThreadCount) = 0;
+
+	/**
+	* IRasterizer::GetThreadCount - Returns the number of worker threads that calculate the image.
+	* @return Number of worker threads.
+	*/
+	virtual LibMCDriver_Rasterizer_uint32 GetThreadCount() = 0;
+
 	/**
 	* IRasterizer::AddLayer - Adds a layer object to subsample.
 	* @param[in] pLayerObject - Layer object instance.
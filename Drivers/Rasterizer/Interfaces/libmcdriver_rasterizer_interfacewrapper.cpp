@@ -812,6 +812,56 @@ LibMCDriver_RasterizerResult libmcdriver_rasterizer_rasterizer_getsamplingparame
 	}
 }
 
+LibMCDriver_RasterizerResult libmcdriver_rasterizer_rasterizer_setthreadcount(LibMCDriver_Rasterizer_Rasterizer pRasterizer, LibMCDriver_Rasterizer_uint32 nThreadCount)
+{
+	IBase* pIBaseClass = (IBase *)pRasterizer;
+
+	try {
+		IRasterizer* pIRasterizer = dynamic_cast<IRasterizer*>(pIBaseClass);
+		if (!pIRasterizer)
+			throw ELibMCDriver_RasterizerInterfaceException(LIBMCDRIVER_RASTERIZER_ERROR_INVALIDCAST);
+		
+		pIRasterizer->SetThreadCount(nThreadCount);
+
+		return LIBMCDRIVER_RASTERIZER_SUCCESS;
+	}
+	catch (ELibMCDriver_RasterizerInterfaceException & Exception) {
+		return handleLibMCDriver_RasterizerException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCDriver_RasterizerResult libmcdriver_rasterizer_rasterizer_getthreadcount(LibMCDriver_Rasterizer_Rasterizer pRasterizer, LibMCDriver_Rasterizer_uint32 * pThreadCount)
+{
+	IBase* pIBaseClass = (IBase *)pRasterizer;
+
+	try {
+		if (pThreadCount == nullptr)
+			throw ELibMCDriver_RasterizerInterfaceException (LIBMCDRIVER_RASTERIZER_ERROR_INVALIDPARAM);
+		IRasterizer* pIRasterizer = dynamic_cast<IRasterizer*>(pIBaseClass);
+		if (!pIRasterizer)
+			throw ELibMCDriver_RasterizerInterfaceException(LIBMCDRIVER_RASTERIZER_ERROR_INVALIDCAST);
+		
+		*pThreadCount = pIRasterizer->GetThreadCount();
+
+		return LIBMCDRIVER_RASTERIZER_SUCCESS;
+	}
+	catch (ELibMCDriver_RasterizerInterfaceException & Exception) {
+		return handleLibMCDriver_RasterizerException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
 LibMCDriver_RasterizerResult libmcdriver_rasterizer_rasterizer_addlayer(LibMCDriver_Rasterizer_Rasterizer pRasterizer, LibMCDriver_Rasterizer_LayerObject pLayerObject)
 {
 	IBase* pIBaseClass = (IBase *)pRasterizer;
@@ -1247,6 +1297,10 @@ LibMCDriver_RasterizerResult LibMCDriver_Rasterizer::Impl::LibMCDriver_Rasterize
 		*ppProcAddress = (void*) &libmcdriver_rasterizer_rasterizer_setsamplingparameters;
 	if (sProcName == "libmcdriver_rasterizer_rasterizer_getsamplingparameters") 
 		*ppProcAddress = (void*) &libmcdriver_rasterizer_rasterizer_getsamplingparameters;
+	if (sProcName == "libmcdriver_rasterizer_rasterizer_setthreadcount") 
+		*ppProcAddress = (void*) &libmcdriver_rasterizer_rasterizer_setthreadcount;
+	if (sProcName == "libmcdriver_rasterizer_rasterizer_getthreadcount") 
+		*ppProcAddress = (void*) &libmcdriver_rasterizer_rasterizer_getthreadcount;
 	if (sProcName == "libmcdriver_rasterizer_rasterizer_addlayer") 
 		*ppProcAddress = (void*) &libmcdriver_rasterizer_rasterizer_addlayer;
 	if (sProcName == "libmcdriver_rasterizer_rasterizer_calculateimage") 
@@ -230,6 +230,7 @@ public:
 			case LIBMCDRIVER_S7NET_ERROR_COMMANDFIELDNOTFOUND: return "COMMANDFIELDNOTFOUND";
 			case LIBMCDRIVER_S7NET_ERROR_INVALIDPARAMETERTYPE: return "INVALIDPARAMETERTYPE";
 			case LIBMCDRIVER_S7NET_ERROR_COMMANDPARAMETEROUTOFBOUNDS: return "COMMANDPARAMETEROUTOFBOUNDS";
+			case LIBMCDRIVER_S7NET_ERROR_INVALIDREADBLOCKADDRESS: return "INVALIDREADBLOCKADDRESS";
 		}
 		return "UNKNOWN";
 	}
@@ -298,6 +299,7 @@ public:
 			case LIBMCDRIVER_S7NET_ERROR_COMMANDFIELDNOTFOUND: return "command field not found";
 			case LIBMCDRIVER_S7NET_ERROR_INVALIDPARAMETERTYPE: return "command field parameter is of wrong type";
 			case LIBMCDRIVER_S7NET_ERROR_COMMANDPARAMETEROUTOFBOUNDS: return "command field parameter is out of bounds";
+			case LIBMCDRIVER_S7NET_ERROR_INVALIDREADBLOCKADDRESS: return "invalid read block address";
 		}
 		return "unknown error";
 	}
@@ -156,6 +156,7 @@ typedef void * LibMCDriver_S7Net_pvoid;
 #define LIBMCDRIVER_S7NET_ERROR_COMMANDFIELDNOTFOUND 1049 /** command field not found */
 #define LIBMCDRIVER_S7NET_ERROR_INVALIDPARAMETERTYPE 1050 /** command field parameter is of wrong type */
 #define LIBMCDRIVER_S7NET_ERROR_COMMANDPARAMETEROUTOFBOUNDS 1051 /** command field parameter is out of bounds */
+#define LIBMCDRIVER_S7NET_ERROR_INVALIDREADBLOCKADDRESS 1052 /** invalid read block address */
 
 /*************************************************************************************************************************
  Error strings for LibMCDriver_S7Net
@@ -224,6 +225,7 @@ inline const char * LIBMCDRIVER_S7NET_GETERRORSTRING (LibMCDriver_S7NetResult nE
     case LIBMCDRIVER_S7NET_ERROR_COMMANDFIELDNOTFOUND: return "command field not found";
     case LIBMCDRIVER_S7NET_ERROR_INVALIDPARAMETERTYPE: return "command field parameter is of wrong type";
     case LIBMCDRIVER_S7NET_ERROR_COMMANDPARAMETEROUTOFBOUNDS: return "command field parameter is out of bounds";
+    case LIBMCDRIVER_S7NET_ERROR_INVALIDREADBLOCKADDRESS: return "invalid read block address";
     default: return "unknown error";
   }
 }
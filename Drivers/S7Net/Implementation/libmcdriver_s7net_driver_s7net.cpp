@@ -40,6 +40,12 @@ Abstract: This is a stub class definition of CDriver_S7Net
 // Include custom headers here.
 #include "pugixml.hpp"
 
+#include <algorithm>
+#include <cstring>
+
+// Values which are at most this many bytes apart are fetched with the same block read.
+#define S7NET_MAXREADBLOCKGAP 64
+
 using namespace LibMCDriver_S7Net::Impl;
 
 
@@ -70,40 +76,39 @@ CDriver_S7RealValue::CDriver_S7RealValue(const std::string& sName, const uint32_
 
 }
 
-double CDriver_S7RealValue::readValue(LibS7Com::CPLCCommunication* pCommunication)
+ePLCFieldType CDriver_S7RealValue::getFieldType()
 {
-    if (pCommunication == nullptr)
-        throw ELibMCDriver_S7NetInterfaceException(LIBMCDRIVER_S7NET_ERROR_INVALIDPARAM);
-
-    return pCommunication->ReadVariableReal(m_nAddress);
+    return ePLCFieldType::ftReal;
 }
 
-ePLCFieldType CDriver_S7RealValue::getFieldType()
+uint32_t CDriver_S7RealValue::getSize()
 {
-    return ePLCFieldType::ftReal;
+    return 4;
 }
 
-void CDriver_S7RealValue::writeToPLCParameters(LibS7Com::CCommandParameters* pCommandParameters, const std::string& sStringValue)
+void CDriver_S7RealValue::writeToPLCParameters(LibS7Com::CCommandParameters* pCommandParameters, const sPLCCommandValue& commandValue)
 {
     if (pCommandParameters == nullptr)
         throw ELibMCDriver_S7NetInterfaceException(LIBMCDRIVER_S7NET_ERROR_INVALIDPARAM);
+    if (commandValue.m_FieldType != getFieldType())
+        throw ELibMCDriver_S7NetInterfaceException(LIBMCDRIVER_S7NET_ERROR_INVALIDPARAMETERTYPE, "command field parameter is of wrong type: " + m_sName);
 
-    pCommandParameters->WriteReal(getAddress (), std::stod (sStringValue));
+    pCommandParameters->WriteReal(getAddress(), commandValue.m_dDoubleValue);
 }
 
-
-CDriver_S7LRealValue::CDriver_S7LRealValue(const std::string& sName, const uint32_t nAddress)
-    : CDriver_S7Value(sName, nAddress)
+void CDriver_S7RealValue::updateFromReadBlock(CDriver_S7ReadBlock* pReadBlock, LibMCEnv::CDriverStatusUpdateSession* pDriverUpdateInstance)
 {
+    if ((pReadBlock == nullptr) || (pDriverUpdateInstance == nullptr))
+        throw ELibMCDriver_S7NetInterfaceException(LIBMCDRIVER_S7NET_ERROR_INVALIDPARAM);
 
+    pDriverUpdateInstance->SetDoubleParameter(m_sName, pReadBlock->readReal(m_nAddress));
 }
 
-double CDriver_S7LRealValue::readValue(LibS7Com::CPLCCommunication* pCommunication)
+
+CDriver_S7LRealValue::CDriver_S7LRealValue(const std::string& sName, const uint32_t nAddress)
+    : CDriver_S7Value(sName, nAddress)
 {
-    if (pCommunication == nullptr)
-        throw ELibMCDriver_S7NetInterfaceException(LIBMCDRIVER_S7NET_ERROR_INVALIDPARAM);
 
-    return pCommunication->ReadVariableLReal(m_nAddress);
 }
 
 ePLCFieldType CDriver_S7LRealValue::getFieldType()
@@ -111,26 +116,33 @@ ePLCFieldType CDriver_S7LRealValue::getFieldType()
     return ePLCFieldType::ftReal;
 }
 
-void CDriver_S7LRealValue::writeToPLCParameters(LibS7Com::CCommandParameters* pCommandParameters, const std::string& sStringValue)
+uint32_t CDriver_S7LRealValue::getSize()
+{
+    return 8;
+}
+
+void CDriver_S7LRealValue::writeToPLCParameters(LibS7Com::CCommandParameters* pCommandParameters, const sPLCCommandValue& commandValue)
 {
     if (pCommandParameters == nullptr)
         throw ELibMCDriver_S7NetInterfaceException(LIBMCDRIVER_S7NET_ERROR_INVALIDPARAM);
+    if (commandValue.m_FieldType != getFieldType())
+        throw ELibMCDriver_S7NetInterfaceException(LIBMCDRIVER_S7NET_ERROR_INVALIDPARAMETERTYPE, "command field parameter is of wrong type: " + m_sName);
 
-    pCommandParameters->WriteLReal(getAddress(), std::stod(sStringValue));
+    pCommandParameters->WriteLReal(getAddress(), commandValue.m_dDoubleValue);
 }
 
-CDriver_S7DIntValue::CDriver_S7DIntValue(const std::string& sName, const uint32_t nAddress)
-    : CDriver_S7Value(sName, nAddress)
+void CDriver_S7LRealValue::updateFromReadBlock(CDriver_S7ReadBlock* pReadBlock, LibMCEnv::CDriverStatusUpdateSession* pDriverUpdateInstance)
 {
+    if ((pReadBlock == nullptr) || (pDriverUpdateInstance == nullptr))
+        throw ELibMCDriver_S7NetInterfaceException(LIBMCDRIVER_S7NET_ERROR_INVALIDPARAM);
 
+    pDriverUpdateInstance->SetDoubleParameter(m_sName, pReadBlock->readLReal(m_nAddress));
 }
 
-int32_t CDriver_S7DIntValue::readValue(LibS7Com::CPLCCommunication* pCommunication)
+CDriver_S7DIntValue::CDriver_S7DIntValue(const std::string& sName, const uint32_t nAddress)
+    : CDriver_S7Value(sName, nAddress)
 {
-    if (pCommunication == nullptr)
-        throw ELibMCDriver_S7NetInterfaceException(LIBMCDRIVER_S7NET_ERROR_INVALIDPARAM);
 
-    return pCommunication->ReadVariableInt32(m_nAddress);
 }
 
 ePLCFieldType CDriver_S7DIntValue::getFieldType()
@@ -138,27 +150,34 @@ ePLCFieldType CDriver_S7DIntValue::getFieldType()
     return ePLCFieldType::ftDInt;
 }
 
-void CDriver_S7DIntValue::writeToPLCParameters(LibS7Com::CCommandParameters* pCommandParameters, const std::string& sStringValue)
+uint32_t CDriver_S7DIntValue::getSize()
+{
+    return 4;
+}
+
+void CDriver_S7DIntValue::writeToPLCParameters(LibS7Com::CCommandParameters* pCommandParameters, const sPLCCommandValue& commandValue)
 {
     if (pCommandParameters == nullptr)
         throw ELibMCDriver_S7NetInterfaceException(LIBMCDRIVER_S7NET_ERROR_INVALIDPARAM);
+    if (commandValue.m_FieldType != getFieldType())
+        throw ELibMCDriver_S7NetInterfaceException(LIBMCDRIVER_S7NET_ERROR_INVALIDPARAMETERTYPE, "command field parameter is of wrong type: " + m_sName);
 
-    pCommandParameters->WriteInt32(getAddress(), std::stoi(sStringValue));
+    pCommandParameters->WriteInt32(getAddress(), commandValue.m_nIntegerValue);
 }
 
-
-CDriver_S7IntValue::CDriver_S7IntValue(const std::string& sName, const uint32_t nAddress)
-    : CDriver_S7Value(sName, nAddress)
+void CDriver_S7DIntValue::updateFromReadBlock(CDriver_S7ReadBlock* pReadBlock, LibMCEnv::CDriverStatusUpdateSession* pDriverUpdateInstance)
 {
+    if ((pReadBlock == nullptr) || (pDriverUpdateInstance == nullptr))
+        throw ELibMCDriver_S7NetInterfaceException(LIBMCDRIVER_S7NET_ERROR_INVALIDPARAM);
 
+    pDriverUpdateInstance->SetIntegerParameter(m_sName, pReadBlock->readInt32(m_nAddress));
 }
 
-int32_t CDriver_S7IntValue::readValue(LibS7Com::CPLCCommunication* pCommunication)
+
+CDriver_S7IntValue::CDriver_S7IntValue(const std::string& sName, const uint32_t nAddress)
+    : CDriver_S7Value(sName, nAddress)
 {
-    if (pCommunication == nullptr)
-        throw ELibMCDriver_S7NetInterfaceException(LIBMCDRIVER_S7NET_ERROR_INVALIDPARAM);
 
-    return pCommunication->ReadVariableInt16(m_nAddress);
 }
 
 ePLCFieldType CDriver_S7IntValue::getFieldType()
@@ -167,12 +186,27 @@ ePLCFieldType CDriver_S7IntValue::getFieldType()
 }
 
 
-void CDriver_S7IntValue::writeToPLCParameters(LibS7Com::CCommandParameters* pCommandParameters, const std::string& sStringValue)
+uint32_t CDriver_S7IntValue::getSize()
+{
+    return 2;
+}
+
+void CDriver_S7IntValue::writeToPLCParameters(LibS7Com::CCommandParameters* pCommandParameters, const sPLCCommandValue& commandValue)
 {
     if (pCommandParameters == nullptr)
         throw ELibMCDriver_S7NetInterfaceException(LIBMCDRIVER_S7NET_ERROR_INVALIDPARAM);
+    if (commandValue.m_FieldType != getFieldType())
+        throw ELibMCDriver_S7NetInterfaceException(LIBMCDRIVER_S7NET_ERROR_INVALIDPARAMETERTYPE, "command field parameter is of wrong type: " + m_sName);
 
-    pCommandParameters->WriteInt16(getAddress(), std::stoi(sStringValue));
+    pCommandParameters->WriteInt16(getAddress(), (int16_t)commandValue.m_nIntegerValue);
+}
+
+void CDriver_S7IntValue::updateFromReadBlock(CDriver_S7ReadBlock* pReadBlock, LibMCEnv::CDriverStatusUpdateSession* pDriverUpdateInstance)
+{
+    if ((pReadBlock == nullptr) || (pDriverUpdateInstance == nullptr))
+        throw ELibMCDriver_S7NetInterfaceException(LIBMCDRIVER_S7NET_ERROR_INVALIDPARAM);
+
+    pDriverUpdateInstance->SetIntegerParameter(m_sName, pReadBlock->readInt16(m_nAddress));
 }
 
 
@@ -181,26 +215,32 @@ CDriver_S7BoolValue::CDriver_S7BoolValue(const std::string& sName, const uint32_
 {
 }
 
-bool CDriver_S7BoolValue::readValue(LibS7Com::CPLCCommunication* pCommunication)
+ePLCFieldType CDriver_S7BoolValue::getFieldType()
 {
-    if (pCommunication == nullptr)
-        throw ELibMCDriver_S7NetInterfaceException(LIBMCDRIVER_S7NET_ERROR_INVALIDPARAM);
-
-    return pCommunication->ReadVariableBool(m_nAddress, m_nBit);
-
+    return ePLCFieldType::ftBool;
 }
 
-ePLCFieldType CDriver_S7BoolValue::getFieldType()
+uint32_t CDriver_S7BoolValue::getSize()
 {
-    return ePLCFieldType::ftBool;
+    return 1;
 }
 
-void CDriver_S7BoolValue::writeToPLCParameters(LibS7Com::CCommandParameters* pCommandParameters, const std::string& sStringValue)
+void CDriver_S7BoolValue::writeToPLCParameters(LibS7Com::CCommandParameters* pCommandParameters, const sPLCCommandValue& commandValue)
 {
     if (pCommandParameters == nullptr)
         throw ELibMCDriver_S7NetInterfaceException(LIBMCDRIVER_S7NET_ERROR_INVALIDPARAM);
+    if (commandValue.m_FieldType != getFieldType())
+        throw ELibMCDriver_S7NetInterfaceException(LIBMCDRIVER_S7NET_ERROR_INVALIDPARAMETERTYPE, "command field parameter is of wrong type: " + m_sName);
 
-    pCommandParameters->WriteBool(getAddress(), getBit (), std::stoi(sStringValue) != 0);
+    pCommandParameters->WriteBool(getAddress(), getBit(), commandValue.m_bBoolValue);
+}
+
+void CDriver_S7BoolValue::updateFromReadBlock(CDriver_S7ReadBlock* pReadBlock, LibMCEnv::CDriverStatusUpdateSession* pDriverUpdateInstance)
+{
+    if ((pReadBlock == nullptr) || (pDriverUpdateInstance == nullptr))
+        throw ELibMCDriver_S7NetInterfaceException(LIBMCDRIVER_S7NET_ERROR_INVALIDPARAM);
+
+    pDriverUpdateInstance->SetBoolParameter(m_sName, pReadBlock->readBool(m_nAddress, m_nBit));
 }
 
 
@@ -215,23 +255,159 @@ CDriver_S7StringValue::CDriver_S7StringValue(const std::string& sName, const uin
 {
 }
 
-std::string CDriver_S7StringValue::readValue(LibS7Com::CPLCCommunication* pCommunication)
-{
-    return pCommunication->ReadVariableString(m_nAddress, m_nLength);;
-}
-
 ePLCFieldType CDriver_S7StringValue::getFieldType()
 {
     return ePLCFieldType::ftString;
 }
 
 
-void CDriver_S7StringValue::writeToPLCParameters(LibS7Com::CCommandParameters* pCommandParameters, const std::string& sStringValue)
+uint32_t CDriver_S7StringValue::getSize()
+{
+    return m_nLength + 2;
+}
+
+void CDriver_S7StringValue::writeToPLCParameters(LibS7Com::CCommandParameters* pCommandParameters, const sPLCCommandValue& commandValue)
 {
     if (pCommandParameters == nullptr)
         throw ELibMCDriver_S7NetInterfaceException(LIBMCDRIVER_S7NET_ERROR_INVALIDPARAM);
+    if (commandValue.m_FieldType != getFieldType())
+        throw ELibMCDriver_S7NetInterfaceException(LIBMCDRIVER_S7NET_ERROR_INVALIDPARAMETERTYPE, "command field parameter is of wrong type: " + m_sName);
+
+    pCommandParameters->WriteString(getAddress(), m_nLength, commandValue.m_sStringValue);
+}
+
+void CDriver_S7StringValue::updateFromReadBlock(CDriver_S7ReadBlock* pReadBlock, LibMCEnv::CDriverStatusUpdateSession* pDriverUpdateInstance)
+{
+    if ((pReadBlock == nullptr) || (pDriverUpdateInstance == nullptr))
+        throw ELibMCDriver_S7NetInterfaceException(LIBMCDRIVER_S7NET_ERROR_INVALIDPARAM);
+
+    pDriverUpdateInstance->SetStringParameter(m_sName, pReadBlock->readString(m_nAddress, m_nLength));
+}
+
+
+CDriver_S7ReadBlock::CDriver_S7ReadBlock(PDriver_S7Value pFirstValue)
+    : m_nStartAddress (0), m_nSize (0)
+{
+    if (pFirstValue.get() == nullptr)
+        throw ELibMCDriver_S7NetInterfaceException(LIBMCDRIVER_S7NET_ERROR_INVALIDPARAM);
+
+    m_nStartAddress = pFirstValue->getAddress();
+    m_nSize = pFirstValue->getSize();
+    m_Values.push_back(pFirstValue);
+}
+
+CDriver_S7ReadBlock::~CDriver_S7ReadBlock()
+{
+
+}
+
+uint32_t CDriver_S7ReadBlock::getStartAddress()
+{
+    return m_nStartAddress;
+}
+
+uint32_t CDriver_S7ReadBlock::getEndAddress()
+{
+    return m_nStartAddress + m_nSize;
+}
+
+void CDriver_S7ReadBlock::addValue(PDriver_S7Value pValue)
+{
+    if (pValue.get() == nullptr)
+        throw ELibMCDriver_S7NetInterfaceException(LIBMCDRIVER_S7NET_ERROR_INVALIDPARAM);
+    if (pValue->getAddress() < m_nStartAddress)
+        throw ELibMCDriver_S7NetInterfaceException(LIBMCDRIVER_S7NET_ERROR_INVALIDREADBLOCKADDRESS, "read block values must be added in address order: " + pValue->getName());
+
+    uint32_t nEndAddress = pValue->getAddress() + pValue->getSize();
+    if (nEndAddress > getEndAddress())
+        m_nSize = nEndAddress - m_nStartAddress;
+
+    m_Values.push_back(pValue);
+}
+
+void CDriver_S7ReadBlock::readFromPLC(LibS7Com::CPLCCommunication* pCommunication)
+{
+    if (pCommunication == nullptr)
+        throw ELibMCDriver_S7NetInterfaceException(LIBMCDRIVER_S7NET_ERROR_INVALIDPARAM);
+
+    pCommunication->ReadVariableBlock(m_nStartAddress, m_nSize, m_Data);
+    if (m_Data.size() != m_nSize)
+        throw ELibMCDriver_S7NetInterfaceException(LIBMCDRIVER_S7NET_ERROR_INVALIDREADBLOCKADDRESS);
+}
+
+void CDriver_S7ReadBlock::updateParameters(LibMCEnv::CDriverStatusUpdateSession* pDriverUpdateInstance)
+{
+    for (auto pValue : m_Values)
+        pValue->updateFromReadBlock(this, pDriverUpdateInstance);
+}
+
+const uint8_t* CDriver_S7ReadBlock::getDataPointer(const uint32_t nAddress, const uint32_t nSize)
+{
+    if ((nAddress < m_nStartAddress) || (((uint64_t)nAddress + nSize) > ((uint64_t)m_nStartAddress + m_Data.size())))
+        throw ELibMCDriver_S7NetInterfaceException(LIBMCDRIVER_S7NET_ERROR_INVALIDREADBLOCKADDRESS, "invalid read block address: " + std::to_string(nAddress));
+
+    return &m_Data.at((size_t)nAddress - m_nStartAddress);
+}
+
+bool CDriver_S7ReadBlock::readBool(const uint32_t nAddress, const uint32_t nBit)
+{
+    if (nBit >= 8)
+        throw ELibMCDriver_S7NetInterfaceException(LIBMCDRIVER_S7NET_ERROR_INVALIDPARAM);
+
+    auto pData = getDataPointer(nAddress, 1);
+    return ((*pData & (1UL << nBit)) != 0);
+}
+
+// S7 data blocks are stored in big endian byte order
+int16_t CDriver_S7ReadBlock::readInt16(const uint32_t nAddress)
+{
+    auto pData = getDataPointer(nAddress, 2);
+    return (int16_t)(((uint16_t)pData[0] << 8) | (uint16_t)pData[1]);
+}
 
-    pCommandParameters->WriteString(getAddress(), m_nLength, sStringValue);
+int32_t CDriver_S7ReadBlock::readInt32(const uint32_t nAddress)
+{
+    auto pData = getDataPointer(nAddress, 4);
+    return (int32_t)(((uint32_t)pData[0] << 24) | ((uint32_t)pData[1] << 16) | ((uint32_t)pData[2] << 8) | (uint32_t)pData[3]);
+}
+
+float CDriver_S7ReadBlock::readReal(const uint32_t nAddress)
+{
+    uint32_t nBits = (uint32_t)readInt32(nAddress);
+
+    float fValue;
+    memcpy(&fValue, &nBits, sizeof(fValue));
+    return fValue;
+}
+
+double CDriver_S7ReadBlock::readLReal(const uint32_t nAddress)
+{
+    auto pData = getDataPointer(nAddress, 8);
+    uint64_t nBits = 0;
+    for (uint32_t nIndex = 0; nIndex < 8; nIndex++)
+        nBits = (nBits << 8) | (uint64_t)pData[nIndex];
+
+    double dValue;
+    memcpy(&dValue, &nBits, sizeof(dValue));
+    return dValue;
+}
+
+std::string CDriver_S7ReadBlock::readString(const uint32_t nAddress, const uint32_t nMaxLength)
+{
+    auto pData = getDataPointer(nAddress, nMaxLength + 2);
+
+    uint32_t nLength = pData[0];
+    if (nLength > nMaxLength)
+        nLength = nMaxLength;
+
+    std::string sValue((const char*)&pData[2], nLength);
+
+    // Strings are terminated by the first null character
+    auto nNullPosition = sValue.find('\0');
+    if (nNullPosition != std::string::npos)
+        sValue.resize(nNullPosition);
+
+    return sValue;
 }
 
 
@@ -481,6 +657,8 @@ void CDriver_S7Net::Configure(const std::string& sConfigurationString)
         }
     }
 
+    buildReadBlocks();
+
     pugi::xml_node controldbNode = s7protocolNode.child("controldb");
     if (controldbNode.empty())
         throw ELibMCDriver_S7NetInterfaceException(LIBMCDRIVER_S7NET_ERROR_NOCONTROLDBDEFINITION);
@@ -704,44 +882,30 @@ void CDriver_S7Net::updateParameters(LibMCEnv::PDriverStatusUpdateSession pDrive
         return;
 
     if (m_pCommunication.get() != nullptr) {
-        for (auto pParameter : m_DriverParameters) {
-            auto sName = pParameter->getName();
-
-            auto pRealParameter = std::dynamic_pointer_cast<CDriver_S7RealValue> (pParameter);
-            if (pRealParameter.get() != nullptr) {
-                double dValue = pRealParameter->readValue(m_pCommunication.get());
-                pDriverUpdateInstance->SetDoubleParameter(sName, dValue);
-            }
-
-            auto pLRealParameter = std::dynamic_pointer_cast<CDriver_S7LRealValue> (pParameter);
-            if (pLRealParameter.get() != nullptr) {
-                double dValue = pLRealParameter->readValue(m_pCommunication.get());
-                pDriverUpdateInstance->SetDoubleParameter(sName, dValue);
-            }
-
-            auto pBoolParameter = std::dynamic_pointer_cast<CDriver_S7BoolValue> (pParameter);
-            if (pBoolParameter.get() != nullptr) {
-                bool bValue = pBoolParameter->readValue(m_pCommunication.get());
-                pDriverUpdateInstance->SetBoolParameter(sName, bValue);
-            }
+        for (auto pReadBlock : m_ReadBlocks) {
+            pReadBlock->readFromPLC(m_pCommunication.get());
+            pReadBlock->updateParameters(pDriverUpdateInstance.get());
+        }
+    }
+}
 
-            auto pStringParameter = std::dynamic_pointer_cast<CDriver_S7StringValue> (pParameter);
-            if (pStringParameter.get() != nullptr) {
-                std::string sValue = pStringParameter->readValue(m_pCommunication.get());
-                pDriverUpdateInstance->SetStringParameter(sName, sValue);
-            }
+void CDriver_S7Net::buildReadBlocks()
+{
+    m_ReadBlocks.clear();
 
-            auto pDintParameter = std::dynamic_pointer_cast<CDriver_S7DIntValue> (pParameter);
-            if (pDintParameter.get() != nullptr) {
-                int32_t nValue = pDintParameter->readValue(m_pCommunication.get());
-                pDriverUpdateInstance->SetIntegerParameter(sName, nValue);
-            }
+    std::vector<PDriver_S7Value> sortedParameters(m_DriverParameters.begin(), m_DriverParameters.end());
+    std::stable_sort(sortedParameters.begin(), sortedParameters.end(), [](const PDriver_S7Value& pValue1, const PDriver_S7Value& pValue2) {
+        return pValue1->getAddress() < pValue2->getAddress();
+    });
 
-            auto pIntParameter = std::dynamic_pointer_cast<CDriver_S7IntValue> (pParameter);
-            if (pIntParameter.get() != nullptr) {
-                int32_t nValue = pIntParameter->readValue(m_pCommunication.get());
-                pDriverUpdateInstance->SetIntegerParameter(sName, nValue);
-            }
+    PDriver_S7ReadBlock pCurrentBlock;
+    for (auto pParameter : sortedParameters) {
+        if ((pCurrentBlock.get() != nullptr) && (pParameter->getAddress() <= (uint64_t)pCurrentBlock->getEndAddress() + S7NET_MAXREADBLOCKGAP)) {
+            pCurrentBlock->addValue(pParameter);
+        }
+        else {
+            pCurrentBlock = std::make_shared<CDriver_S7ReadBlock>(pParameter);
+            m_ReadBlocks.push_back(pCurrentBlock);
         }
     }
 }
@@ -824,13 +988,13 @@ void CDriver_S7Net::ExecuteCommand(IPLCCommand* pPLCCommand)
     auto pCommandDefinition = iIter->second;
     auto parameterNames = pCommandDefinition->getParameterNames();
     for (auto parameterName : parameterNames) {
-        auto sParameterValue = pPLCCommandInstance->getParameterValue(parameterName);
-        if (!sParameterValue.empty()) {
+        auto pParameterValue = pPLCCommandInstance->findParameterValue(parameterName);
+        if (pParameterValue != nullptr) {
 
             auto pParameter = pCommandDefinition->findParameter(parameterName);
             auto sFieldName = pParameter->getField();
             auto iControlIterator = m_ControlParameterMap.find(sFieldName);
-            iControlIterator->second->writeToPLCParameters(pParameters.get(), sParameterValue);
+            iControlIterator->second->writeToPLCParameters(pParameters.get(), *pParameterValue);
         }
     }
 
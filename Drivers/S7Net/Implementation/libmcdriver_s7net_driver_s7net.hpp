@@ -38,6 +38,7 @@ Abstract: This is the class declaration of CDriver_S7Net
 #include "libmcdriver_s7net_interfaces.hpp"
 #include <string>
 #include <map>
+#include <vector>
 
 // Parent classes
 #include "libmcdriver_s7net_driver.hpp"
@@ -61,6 +62,8 @@ namespace Impl {
 **************************************************************************************************************************/
 
 
+class CDriver_S7ReadBlock;
+
 class CDriver_S7Value {
 protected:
     std::string m_sName;
@@ -75,7 +78,12 @@ public:
 
     virtual ePLCFieldType getFieldType () = 0;
 
-    virtual void writeToPLCParameters (LibS7Com::CCommandParameters * pCommandParameters, const std::string & sStringValue) = 0;
+    // Number of bytes the value occupies in the data block.
+    virtual uint32_t getSize () = 0;
+
+    virtual void writeToPLCParameters (LibS7Com::CCommandParameters * pCommandParameters, const sPLCCommandValue & commandValue) = 0;
+
+    virtual void updateFromReadBlock (CDriver_S7ReadBlock * pReadBlock, LibMCEnv::CDriverStatusUpdateSession * pDriverUpdateInstance) = 0;
 
 };
 
@@ -86,11 +94,13 @@ public:
 
     CDriver_S7RealValue(const std::string& sName, const uint32_t nAddress);
 
-    double readValue(LibS7Com::CPLCCommunication * pCommunication);
-
     ePLCFieldType getFieldType() override;
 
-    void writeToPLCParameters(LibS7Com::CCommandParameters* pCommandParameters, const std::string& sStringValue) override;
+    uint32_t getSize() override;
+
+    void writeToPLCParameters(LibS7Com::CCommandParameters* pCommandParameters, const sPLCCommandValue& commandValue) override;
+
+    void updateFromReadBlock(CDriver_S7ReadBlock* pReadBlock, LibMCEnv::CDriverStatusUpdateSession* pDriverUpdateInstance) override;
 
 };
 
@@ -100,11 +110,13 @@ public:
 
     CDriver_S7LRealValue(const std::string& sName, const uint32_t nAddress);
 
-    double readValue(LibS7Com::CPLCCommunication* pCommunication);
-
     ePLCFieldType getFieldType() override;
 
-    void writeToPLCParameters(LibS7Com::CCommandParameters* pCommandParameters, const std::string& sStringValue) override;
+    uint32_t getSize() override;
+
+    void writeToPLCParameters(LibS7Com::CCommandParameters* pCommandParameters, const sPLCCommandValue& commandValue) override;
+
+    void updateFromReadBlock(CDriver_S7ReadBlock* pReadBlock, LibMCEnv::CDriverStatusUpdateSession* pDriverUpdateInstance) override;
 
 };
 
@@ -114,11 +126,13 @@ public:
 
     CDriver_S7DIntValue(const std::string& sName, const uint32_t nAddress);
 
-    int32_t readValue(LibS7Com::CPLCCommunication* pCommunication);
-
     ePLCFieldType getFieldType() override;
 
-    void writeToPLCParameters(LibS7Com::CCommandParameters* pCommandParameters, const std::string& sStringValue) override;
+    uint32_t getSize() override;
+
+    void writeToPLCParameters(LibS7Com::CCommandParameters* pCommandParameters, const sPLCCommandValue& commandValue) override;
+
+    void updateFromReadBlock(CDriver_S7ReadBlock* pReadBlock, LibMCEnv::CDriverStatusUpdateSession* pDriverUpdateInstance) override;
 
 };
 
@@ -129,11 +143,13 @@ public:
 
     CDriver_S7IntValue(const std::string& sName, const uint32_t nAddress);
 
-    int32_t readValue(LibS7Com::CPLCCommunication* pCommunication);
-
     ePLCFieldType getFieldType() override;
 
-    void writeToPLCParameters(LibS7Com::CCommandParameters* pCommandParameters, const std::string& sStringValue) override;
+    uint32_t getSize() override;
+
+    void writeToPLCParameters(LibS7Com::CCommandParameters* pCommandParameters, const sPLCCommandValue& commandValue) override;
+
+    void updateFromReadBlock(CDriver_S7ReadBlock* pReadBlock, LibMCEnv::CDriverStatusUpdateSession* pDriverUpdateInstance) override;
 
 };
 
@@ -148,13 +164,15 @@ public:
 
     CDriver_S7BoolValue(const std::string& sName, const uint32_t nAddress, const uint32_t nBit);
 
-    bool readValue(LibS7Com::CPLCCommunication* pCommunication);
-
     ePLCFieldType getFieldType() override;
 
     uint32_t getBit();
 
-    void writeToPLCParameters(LibS7Com::CCommandParameters* pCommandParameters, const std::string& sStringValue) override;
+    uint32_t getSize() override;
+
+    void writeToPLCParameters(LibS7Com::CCommandParameters* pCommandParameters, const sPLCCommandValue& commandValue) override;
+
+    void updateFromReadBlock(CDriver_S7ReadBlock* pReadBlock, LibMCEnv::CDriverStatusUpdateSession* pDriverUpdateInstance) override;
 
 };
 
@@ -167,17 +185,55 @@ public:
 
     CDriver_S7StringValue(const std::string& sName, const uint32_t nAddress, const uint32_t nLength);
 
-    std::string readValue(LibS7Com::CPLCCommunication* pCommunication);
-
     ePLCFieldType getFieldType() override;
 
-    void writeToPLCParameters(LibS7Com::CCommandParameters* pCommandParameters, const std::string& sStringValue) override;
+    uint32_t getSize() override;
+
+    void writeToPLCParameters(LibS7Com::CCommandParameters* pCommandParameters, const sPLCCommandValue& commandValue) override;
+
+    void updateFromReadBlock(CDriver_S7ReadBlock* pReadBlock, LibMCEnv::CDriverStatusUpdateSession* pDriverUpdateInstance) override;
 
 };
 
 
 typedef std::shared_ptr<CDriver_S7Value> PDriver_S7Value;
 
+
+// Coalesces values with neighbouring addresses, so that they are fetched with one block read and decoded locally.
+class CDriver_S7ReadBlock {
+protected:
+    uint32_t m_nStartAddress;
+    uint32_t m_nSize;
+    std::vector<uint8_t> m_Data;
+    std::vector<PDriver_S7Value> m_Values;
+
+    const uint8_t* getDataPointer(const uint32_t nAddress, const uint32_t nSize);
+
+public:
+
+    CDriver_S7ReadBlock(PDriver_S7Value pFirstValue);
+    virtual ~CDriver_S7ReadBlock();
+
+    uint32_t getStartAddress();
+    uint32_t getEndAddress();
+
+    void addValue(PDriver_S7Value pValue);
+
+    void readFromPLC(LibS7Com::CPLCCommunication* pCommunication);
+    void updateParameters(LibMCEnv::CDriverStatusUpdateSession* pDriverUpdateInstance);
+
+    bool readBool(const uint32_t nAddress, const uint32_t nBit);
+    int16_t readInt16(const uint32_t nAddress);
+    int32_t readInt32(const uint32_t nAddress);
+    float readReal(const uint32_t nAddress);
+    double readLReal(const uint32_t nAddress);
+    std::string readString(const uint32_t nAddress, const uint32_t nMaxLength);
+
+};
+
+typedef std::shared_ptr<CDriver_S7ReadBlock> PDriver_S7ReadBlock;
+
+
 class CDriver_S7CommandParameter {
 private:
     std::string m_sName;
@@ -237,12 +293,15 @@ protected:
 
     std::list<PDriver_S7Value> m_DriverParameters;
     std::map<std::string, PDriver_S7Value> m_DriverParameterMap;
+    std::vector<PDriver_S7ReadBlock> m_ReadBlocks;
 
     std::map<std::string, PDriver_S7Command> m_CommandDefinitions;
     std::map<std::string, PDriver_S7Value> m_ControlParameterMap;
 
     void updateParameters (LibMCEnv::PDriverStatusUpdateSession pDriverUpdateInstance);
 
+    void buildReadBlocks ();
+
     uint32_t findPLCToAMCIntOffset (const std::string & sName);
     uint32_t findPLCToAMCDIntOffset(const std::string& sName);
     uint32_t findPLCToAMCStringOffset(const std::string& sName);
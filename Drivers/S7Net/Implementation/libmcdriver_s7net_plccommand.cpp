@@ -89,7 +89,8 @@ void CPLCCommand::SetIntegerParameter(const std::string& sParameterName, const L
     }
         
 
-    m_ParameterValues.insert(std::make_pair(sParameterName, std::to_string (nValue)));
+    sPLCCommandValue commandValue = { iParameterType->second, nValue, 0.0, false, "" };
+    m_ParameterValues.insert(std::make_pair(sParameterName, commandValue));
 }
 
 void CPLCCommand::SetStringParameter(const std::string& sParameterName, const std::string& sValue)
@@ -101,7 +102,8 @@ void CPLCCommand::SetStringParameter(const std::string& sParameterName, const st
     if (iParameterType->second != ePLCFieldType::ftString)
         throw ELibMCDriver_S7NetInterfaceException(LIBMCDRIVER_S7NET_ERROR_INVALIDPARAMETERTYPE, "command parameter is not of type string: " + sParameterName);
 
-    m_ParameterValues.insert(std::make_pair(sParameterName, sValue));
+    sPLCCommandValue commandValue = { iParameterType->second, 0, 0.0, false, sValue };
+    m_ParameterValues.insert(std::make_pair(sParameterName, commandValue));
 }
 
 void CPLCCommand::SetBoolParameter(const std::string& sParameterName, const bool bValue)
@@ -113,7 +115,8 @@ void CPLCCommand::SetBoolParameter(const std::string& sParameterName, const bool
     if (iParameterType->second != ePLCFieldType::ftBool)
         throw ELibMCDriver_S7NetInterfaceException(LIBMCDRIVER_S7NET_ERROR_INVALIDPARAMETERTYPE, "command parameter is not of type bool: " + sParameterName);
 
-    m_ParameterValues.insert(std::make_pair(sParameterName, bValue ? "1" : "0" ));
+    sPLCCommandValue commandValue = { iParameterType->second, 0, 0.0, bValue, "" };
+    m_ParameterValues.insert(std::make_pair(sParameterName, commandValue));
 }
 
 void CPLCCommand::SetDoubleParameter(const std::string& sParameterName, const LibMCDriver_S7Net_double dValue)
@@ -125,15 +128,16 @@ void CPLCCommand::SetDoubleParameter(const std::string& sParameterName, const Li
     if (iParameterType->second != ePLCFieldType::ftReal)
         throw ELibMCDriver_S7NetInterfaceException(LIBMCDRIVER_S7NET_ERROR_INVALIDPARAMETERTYPE, "command parameter is not of type double: " + sParameterName);
 
-    m_ParameterValues.insert(std::make_pair(sParameterName, std::to_string(dValue)));
+    sPLCCommandValue commandValue = { iParameterType->second, 0, dValue, false, "" };
+    m_ParameterValues.insert(std::make_pair(sParameterName, commandValue));
 }
 
 
-std::string CPLCCommand::getParameterValue(const std::string& sParameterName)
+sPLCCommandValue* CPLCCommand::findParameterValue(const std::string& sParameterName)
 {
     auto iParameterValue = m_ParameterValues.find(sParameterName);
     if (iParameterValue != m_ParameterValues.end())
-        return iParameterValue->second;
+        return &iParameterValue->second;
 
-    return "";
+    return nullptr;
 }
@@ -64,6 +64,14 @@ enum class ePLCFieldType : int32_t {
     ftReal = 5,
 };
 
+typedef struct _sPLCCommandValue {
+    ePLCFieldType m_FieldType;
+    int32_t m_nIntegerValue;
+    double m_dDoubleValue;
+    bool m_bBoolValue;
+    std::string m_sStringValue;
+} sPLCCommandValue;
+
 
 class CPLCCommand : public virtual IPLCCommand, public virtual CBase {
 private:
@@ -74,7 +82,7 @@ protected:
     uint32_t m_nSequenceID;
 
     std::map<std::string, ePLCFieldType> m_ParameterTypeMap;
-    std::map<std::string, std::string> m_ParameterValues; // Store values as strings
+    std::map<std::string, sPLCCommandValue> m_ParameterValues;
 
 public:
 
@@ -94,7 +102,8 @@ public:
 
     void SetDoubleParameter(const std::string& sParameterName, const LibMCDriver_S7Net_double dValue) override;
 
-    std::string getParameterValue (const std::string& sParameterName);
+    // Returns nullptr, if the parameter has not been set.
+    sPLCCommandValue* findParameterValue (const std::string& sParameterName);
 
 };
 
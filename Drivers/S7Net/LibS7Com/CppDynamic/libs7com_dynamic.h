@@ -345,6 +345,19 @@ typedef LibS7ComResult (*PLibS7ComPLCCommunication_ReadVariableRealPtr) (LibS7Co
 */
 typedef LibS7ComResult (*PLibS7ComPLCCommunication_ReadVariableLRealPtr) (LibS7Com_PLCCommunication pPLCCommunication, LibS7Com_uint32 nAddress, LibS7Com_double * pValue);
 
+/**
+* Returns a contiguous block of the retrieved status data.
+*
+* @param[in] pPLCCommunication - PLCCommunication instance.
+* @param[in] nAddress - Start address of the block.
+* @param[in] nLength - Length of the block in bytes.
+* @param[in] nDataBufferSize - Number of elements in buffer
+* @param[out] pDataNeededCount - will be filled with the count of the written elements, or needed buffer size.
+* @param[out] pDataBuffer - uint8  buffer of Content of the block.
+* @return error code or 0 (success)
+*/
+typedef LibS7ComResult (*PLibS7ComPLCCommunication_ReadVariableBlockPtr) (LibS7Com_PLCCommunication pPLCCommunication, LibS7Com_uint32 nAddress, LibS7Com_uint32 nLength, const LibS7Com_uint64 nDataBufferSize, LibS7Com_uint64* pDataNeededCount, LibS7Com_uint8 * pDataBuffer);
+
 /*************************************************************************************************************************
  Global functions
 **************************************************************************************************************************/
@@ -445,6 +458,7 @@ typedef struct {
 	PLibS7ComPLCCommunication_ReadVariableUint32Ptr m_PLCCommunication_ReadVariableUint32;
 	PLibS7ComPLCCommunication_ReadVariableRealPtr m_PLCCommunication_ReadVariableReal;
 	PLibS7ComPLCCommunication_ReadVariableLRealPtr m_PLCCommunication_ReadVariableLReal;
+	PLibS7ComPLCCommunication_ReadVariableBlockPtr m_PLCCommunication_ReadVariableBlock;
 	PLibS7ComGetVersionPtr m_GetVersion;
 	PLibS7ComGetLastErrorPtr m_GetLastError;
 	PLibS7ComAcquireInstancePtr m_AcquireInstance;
@@ -459,6 +459,7 @@ public:
 	inline LibS7Com_uint32 ReadVariableUint32(const LibS7Com_uint32 nAddress);
 	inline LibS7Com_double ReadVariableReal(const LibS7Com_uint32 nAddress);
 	inline LibS7Com_double ReadVariableLReal(const LibS7Com_uint32 nAddress);
+	inline void ReadVariableBlock(const LibS7Com_uint32 nAddress, const LibS7Com_uint32 nLength, std::vector<LibS7Com_uint8> & DataBuffer);
 };
 	
 	/**
@@ -605,6 +606,7 @@ public:
 		pWrapperTable->m_PLCCommunication_ReadVariableUint32 = nullptr;
 		pWrapperTable->m_PLCCommunication_ReadVariableReal = nullptr;
 		pWrapperTable->m_PLCCommunication_ReadVariableLReal = nullptr;
+		pWrapperTable->m_PLCCommunication_ReadVariableBlock = nullptr;
 		pWrapperTable->m_GetVersion = nullptr;
 		pWrapperTable->m_GetLastError = nullptr;
 		pWrapperTable->m_AcquireInstance = nullptr;
@@ -905,6 +907,15 @@ public:
 		if (pWrapperTable->m_PLCCommunication_ReadVariableLReal == nullptr)
 			return LIBS7COM_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		#ifdef _WIN32
+		pWrapperTable->m_PLCCommunication_ReadVariableBlock = (PLibS7ComPLCCommunication_ReadVariableBlockPtr) GetProcAddress(hLibrary, "libs7com_plccommunication_readvariableblock");
+		#else // _WIN32
+		pWrapperTable->m_PLCCommunication_ReadVariableBlock = (PLibS7ComPLCCommunication_ReadVariableBlockPtr) dlsym(hLibrary, "libs7com_plccommunication_readvariableblock");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_PLCCommunication_ReadVariableBlock == nullptr)
+			return LIBS7COM_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		#ifdef _WIN32
 		pWrapperTable->m_GetVersion = (PLibS7ComGetVersionPtr) GetProcAddress(hLibrary, "libs7com_getversion");
 		#else // _WIN32
@@ -1092,6 +1103,10 @@ public:
 		if ( (eLookupError != 0) || (pWrapperTable->m_PLCCommunication_ReadVariableLReal == nullptr) )
 			return LIBS7COM_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		eLookupError = (*pLookup)("libs7com_plccommunication_readvariableblock", (void**)&(pWrapperTable->m_PLCCommunication_ReadVariableBlock));
+		if ( (eLookupError != 0) || (pWrapperTable->m_PLCCommunication_ReadVariableBlock == nullptr) )
+			return LIBS7COM_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		eLookupError = (*pLookup)("libs7com_getversion", (void**)&(pWrapperTable->m_GetVersion));
 		if ( (eLookupError != 0) || (pWrapperTable->m_GetVersion == nullptr) )
 			return LIBS7COM_ERROR_COULDNOTFINDLIBRARYEXPORT;
@@ -1464,6 +1479,23 @@ public:
 		
 		return resultValue;
 	}
+	
+	/**
+	* CPLCCommunication::ReadVariableBlock - Returns a contiguous block of the retrieved status data.
+	* @param[in] nAddress - Start address of the block.
+	* @param[in] nLength - Length of the block in bytes.
+	* @param[in] nDataBufferSize - Number of elements in buffer
+	* @param[out] pDataNeededCount - will be filled with the count of the written structs, or needed buffer size.
+	* @param[out] pDataBuffer - uint8 buffer of Content of the block.
+	*/
+	void CPLCCommunication::ReadVariableBlock(const LibS7Com_uint32 nAddress, const LibS7Com_uint32 nLength, std::vector<LibS7Com_uint8> & DataBuffer)
+	{
+		LibS7Com_uint64 elementsNeededData = 0;
+		LibS7Com_uint64 elementsWrittenData = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_PLCCommunication_ReadVariableBlock(m_pHandle, nAddress, nLength, 0, &elementsNeededData, nullptr));
+		DataBuffer.resize((size_t) elementsNeededData);
+		CheckError(m_pWrapper->m_WrapperTable.m_PLCCommunication_ReadVariableBlock(m_pHandle, nAddress, nLength, elementsNeededData, &elementsWrittenData, DataBuffer.data()));
+	}
 
 } // namespace LibS7Com
 
@@ -36,6 +36,7 @@ Abstract: This is a stub class definition of CPLCCommunication
 #include "libs7com_commandparameters.hpp"
 
 // Include custom headers here.
+#include <cstring>
 
 
 using namespace LibS7Com::Impl;
@@ -347,3 +348,20 @@ LibS7Com_double CPLCCommunication::ReadVariableLReal(const LibS7Com_uint32 nAddr
     return *((double*)&nValue[0]);
 
 }
+
+void CPLCCommunication::ReadVariableBlock(const LibS7Com_uint32 nAddress, const LibS7Com_uint32 nLength, LibS7Com_uint64 nDataBufferSize, LibS7Com_uint64* pDataNeededCount, LibS7Com_uint8* pDataBuffer)
+{
+    if (((uint64_t)nAddress + nLength) > m_PLCRecvBuffer.size())
+        throw ELibS7ComInterfaceException(LIBS7COM_ERROR_INVALIDREADADDRESS);
+
+    if (pDataNeededCount != nullptr)
+        *pDataNeededCount = nLength;
+
+    if (pDataBuffer != nullptr) {
+        if (nDataBufferSize < nLength)
+            throw ELibS7ComInterfaceException(LIBS7COM_ERROR_BUFFERTOOSMALL);
+
+        if (nLength > 0)
+            memcpy(pDataBuffer, &m_PLCRecvBuffer.at(nAddress), nLength);
+    }
+}
@@ -134,6 +134,8 @@ public:
 
 	LibS7Com_double ReadVariableLReal(const LibS7Com_uint32 nAddress) override;
 
+	void ReadVariableBlock(const LibS7Com_uint32 nAddress, const LibS7Com_uint32 nLength, LibS7Com_uint64 nDataBufferSize, LibS7Com_uint64* pDataNeededCount, LibS7Com_uint8 * pDataBuffer) override;
+
 };
 
 } // namespace Impl
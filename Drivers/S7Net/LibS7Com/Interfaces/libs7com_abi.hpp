@@ -358,6 +358,19 @@ LIBS7COM_DECLSPEC LibS7ComResult libs7com_plccommunication_readvariablereal(LibS
 */
 LIBS7COM_DECLSPEC LibS7ComResult libs7com_plccommunication_readvariablelreal(LibS7Com_PLCCommunication pPLCCommunication, LibS7Com_uint32 nAddress, LibS7Com_double * pValue);
 
+/**
+* Returns a contiguous block of the retrieved status data.
+*
+* @param[in] pPLCCommunication - PLCCommunication instance.
+* @param[in] nAddress - Start address of the block.
+* @param[in] nLength - Length of the block in bytes.
+* @param[in] nDataBufferSize - Number of elements in buffer
+* @param[out] pDataNeededCount - will be filled with the count of the written elements, or needed buffer size.
+* @param[out] pDataBuffer - uint8  buffer of Content of the block.
+* @return error code or 0 (success)
+*/
+LIBS7COM_DECLSPEC LibS7ComResult libs7com_plccommunication_readvariableblock(LibS7Com_PLCCommunication pPLCCommunication, LibS7Com_uint32 nAddress, LibS7Com_uint32 nLength, const LibS7Com_uint64 nDataBufferSize, LibS7Com_uint64* pDataNeededCount, LibS7Com_uint8 * pDataBuffer);
+
 /*************************************************************************************************************************
  Global functions
 **************************************************************************************************************************/
@@ -461,6 +461,16 @@ public:
 	*/
 	virtual LibS7Com_double ReadVariableLReal(const LibS7Com_uint32 nAddress) = 0;
 
+	/**
+	* IPLCCommunication::ReadVariableBlock - Returns a contiguous block of the retrieved status data.
+	* @param[in] nAddress - Start address of the block.
+	* @param[in] nLength - Length of the block in bytes.
+	* @param[in] nDataBufferSize - Number of elements in buffer
+	* @param[out] pDataNeededCount - will be filled with the count of the written structs, or needed buffer size.
+	* @param[out] pDataBuffer - uint8 buffer of Content of the block.
+	*/
+	virtual void ReadVariableBlock(const LibS7Com_uint32 nAddress, const LibS7Com_uint32 nLength, LibS7Com_uint64 nDataBufferSize, LibS7Com_uint64* pDataNeededCount, LibS7Com_uint8 * pDataBuffer) = 0;
+
 };
 
 typedef IBaseSharedPtr<IPLCCommunication> PIPLCCommunication;
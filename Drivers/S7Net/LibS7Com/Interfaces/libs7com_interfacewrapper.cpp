@@ -800,6 +800,32 @@ LibS7ComResult libs7com_plccommunication_readvariablelreal(LibS7Com_PLCCommunica
 	}
 }
 
+LibS7ComResult libs7com_plccommunication_readvariableblock(LibS7Com_PLCCommunication pPLCCommunication, LibS7Com_uint32 nAddress, LibS7Com_uint32 nLength, const LibS7Com_uint64 nDataBufferSize, LibS7Com_uint64* pDataNeededCount, LibS7Com_uint8 * pDataBuffer)
+{
+	IBase* pIBaseClass = (IBase *)pPLCCommunication;
+
+	try {
+		if ((!pDataBuffer) && !(pDataNeededCount))
+			throw ELibS7ComInterfaceException (LIBS7COM_ERROR_INVALIDPARAM);
+		IPLCCommunication* pIPLCCommunication = dynamic_cast<IPLCCommunication*>(pIBaseClass);
+		if (!pIPLCCommunication)
+			throw ELibS7ComInterfaceException(LIBS7COM_ERROR_INVALIDCAST);
+		
+		pIPLCCommunication->ReadVariableBlock(nAddress, nLength, nDataBufferSize, pDataNeededCount, pDataBuffer);
+
+		return LIBS7COM_SUCCESS;
+	}
+	catch (ELibS7ComInterfaceException & Exception) {
+		return handleLibS7ComException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
 
 
 /*************************************************************************************************************************
@@ -869,6 +895,8 @@ LibS7ComResult LibS7Com::Impl::LibS7Com_GetProcAddress (const char * pProcName,
 		*ppProcAddress = (void*) &libs7com_plccommunication_readvariablereal;
 	if (sProcName == "libs7com_plccommunication_readvariablelreal") 
 		*ppProcAddress = (void*) &libs7com_plccommunication_readvariablelreal;
+	if (sProcName == "libs7com_plccommunication_readvariableblock") 
+		*ppProcAddress = (void*) &libs7com_plccommunication_readvariableblock;
 	if (sProcName == "libs7com_getversion") 
 		*ppProcAddress = (void*) &libs7com_getversion;
 	if (sProcName == "libs7com_getlasterror") 
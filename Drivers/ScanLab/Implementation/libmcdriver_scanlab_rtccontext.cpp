@@ -2783,12 +2783,27 @@ void CRTCContext::addLayerToListEx(LibMCEnv::PToolpathLayer pLayer, eOIERecordin
 	//std::cout << "Custom predelay segment attribute " << nCustomPreDelaySegmentAttributeID << std::endl;
 	//std::cout << "Custom postdelay segment attribute " << nCustomPostDelaySegmentAttributeID << std::endl;
 
+	// Resolve profile values once per layer, so that the segment loop does not need any string lookups
+	uint32_t nMeasurementIDHandle = pLayer->ResolveProfileValueHandle("http://schemas.scanlab.com/oie/2023/08", "measurementid");
+	uint32_t nPIDIndexHandle = pLayer->ResolveProfileValueHandle("http://schemas.scanlab.com/oie/2023/08", "pidindex");
+	uint32_t nPreSequenceHandle = pLayer->ResolveProfileValueHandle("http://schemas.scanlab.com/gpiosequence/2025/01", "presequence");
+	uint32_t nPostSequenceHandle = pLayer->ResolveProfileValueHandle("http://schemas.scanlab.com/gpiosequence/2025/01", "postsequence");
+	uint32_t nAFXModeHandle = pLayer->ResolveProfileValueHandle("http://schemas.nlight.com/afx/2024/09", "afxmode");
+	uint32_t nSkywritingModeHandle = pLayer->ResolveProfileValueHandle("http://schemas.scanlab.com/skywriting/2023/01", "mode");
+	uint32_t nLaserIndexHandle = pLayer->ResolveProfileValueHandle("", "laserindex");
+	uint32_t nJumpSpeedHandle = pLayer->ResolveTypedProfileValueHandle(LibMCEnv::eToolpathProfileValueType::JumpSpeed);
+	uint32_t nMarkSpeedHandle = pLayer->ResolveTypedProfileValueHandle(LibMCEnv::eToolpathProfileValueType::Speed);
+	uint32_t nLaserPowerHandle = pLayer->ResolveTypedProfileValueHandle(LibMCEnv::eToolpathProfileValueType::LaserPower);
+	uint32_t nLaserFocusHandle = pLayer->ResolveTypedProfileValueHandle(LibMCEnv::eToolpathProfileValueType::LaserFocus);
+	uint32_t nPreSegmentDelayHandle = pLayer->ResolveTypedProfileValueHandle(LibMCEnv::eToolpathProfileValueType::PreSegmentDelay);
+	uint32_t nPostSegmentDelayHandle = pLayer->ResolveTypedProfileValueHandle(LibMCEnv::eToolpathProfileValueType::PostSegmentDelay);
+
 
 	uint32_t nSegmentCount = pLayer->GetSegmentCount();
 	for (uint32_t nSegmentIndex = 0; nSegmentIndex < nSegmentCount; nSegmentIndex++) {
 
 		m_CurrentMeasurementTagInfo.m_SegmentID = (uint32_t) (nSegmentIndex + 1);
-		m_CurrentMeasurementTagInfo.m_ProfileID = (uint32_t) pLayer->GetSegmentProfileIntegerValueDef(nSegmentIndex, "http://schemas.scanlab.com/oie/2023/08", "measurementid", 0);
+		m_CurrentMeasurementTagInfo.m_ProfileID = (uint32_t) pLayer->GetSegmentProfileIntegerValueByHandleDef(nSegmentIndex, nMeasurementIDHandle, 0);
 		m_CurrentMeasurementTagInfo.m_PartID = (uint32_t)pLayer->GetSegmentLocalPartID(nSegmentIndex);
 
 		LibMCEnv::eToolpathSegmentType eSegmentType;
@@ -2804,7 +2819,7 @@ void CRTCContext::addLayerToListEx(LibMCEnv::PToolpathLayer pLayer, eOIERecordin
 		if (bDrawSegment && (nPointCount >= 2)) {
 
 			// Run GPIO Pre-Sequence
-			auto sPreSequence = pLayer->GetSegmentProfileValueDef(nSegmentIndex, "http://schemas.scanlab.com/gpiosequence/2025/01", "presequence", "");
+			auto sPreSequence = pLayer->GetSegmentProfileValueByHandleDef(nSegmentIndex, nPreSequenceHandle, "");
 			if (!sPreSequence.empty()) {
 				addGPIOSequenceToList (sPreSequence);
 			}
@@ -2812,7 +2827,7 @@ void CRTCContext::addLayerToListEx(LibMCEnv::PToolpathLayer pLayer, eOIERecordin
 			// Update nLight AFX Mode if necessary
 			if (m_pNLightAFXSelectorInstance.get() != nullptr) {
 				if (m_pNLightAFXSelectorInstance->isEnabled()) {
-					int64_t nLightAFXMode = pLayer->GetSegmentProfileIntegerValueDef(nSegmentIndex, "http://schemas.nlight.com/afx/2024/09", "afxmode", 0);
+					int64_t nLightAFXMode = pLayer->GetSegmentProfileIntegerValueByHandleDef(nSegmentIndex, nAFXModeHandle, 0);
 					if (nLightAFXMode < 0) 
 						throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_INVALIDNLIGHTAFXMODE, "Invalid nLightAFXMode: " + std::to_string(nLightAFXMode));
 					if (nLightAFXMode > (int64_t) m_pNLightAFXSelectorInstance->getMaxAFXMode ())
@@ -2824,27 +2839,31 @@ void CRTCContext::addLayerToListEx(LibMCEnv::PToolpathLayer pLayer, eOIERecordin
 			}
 
 
-			float fJumpSpeedInMMPerSecond = (float)pLayer->GetSegmentProfileTypedValue(nSegmentIndex, LibMCEnv::eToolpathProfileValueType::JumpSpeed);
-			float fMarkSpeedInMMPerSecond = (float)pLayer->GetSegmentProfileTypedValue(nSegmentIndex, LibMCEnv::eToolpathProfileValueType::Speed);
-			float fPowerInWatts = (float)pLayer->GetSegmentProfileTypedValue(nSegmentIndex, LibMCEnv::eToolpathProfileValueType::LaserPower);
+			float fMarkSpeedInMMPerSecond = (float)pLayer->GetSegmentProfileDoubleValueByHandle(nSegmentIndex, nMarkSpeedHandle);
+			float fPowerInWatts = (float)pLayer->GetSegmentProfileDoubleValueByHandle(nSegmentIndex, nLaserPowerHandle);
+
+			// Legacy behaviour: Fall back to Laser Speed if no jump speed is available.
+			float fJumpSpeedInMMPerSecond = fMarkSpeedInMMPerSecond;
+			if (pLayer->SegmentProfileHasValueByHandle(nSegmentIndex, nJumpSpeedHandle))
+				fJumpSpeedInMMPerSecond = (float)pLayer->GetSegmentProfileDoubleValueByHandle(nSegmentIndex, nJumpSpeedHandle);
 			
 			double dPowerInPercent = 0.0;
 			if (!m_pPowerMapping->mapLaserPowerFromWattsToPercent((double)fPowerInWatts, dPowerInPercent)) {
 				// TODO: Throw exception?
 			}
 				
-			float fLaserFocus = (float)pLayer->GetSegmentProfileTypedValue(nSegmentIndex, LibMCEnv::eToolpathProfileValueType::LaserFocus);
-			double dPreSegmentDelay = (float)pLayer->GetSegmentProfileTypedValueDef(nSegmentIndex, LibMCEnv::eToolpathProfileValueType::PreSegmentDelay, 0.0);
-			double dPostSegmentDelay = (float)pLayer->GetSegmentProfileTypedValueDef(nSegmentIndex, LibMCEnv::eToolpathProfileValueType::PostSegmentDelay, 0.0);
+			float fLaserFocus = (float)pLayer->GetSegmentProfileDoubleValueByHandle(nSegmentIndex, nLaserFocusHandle);
+			double dPreSegmentDelay = (float)pLayer->GetSegmentProfileDoubleValueByHandleDef(nSegmentIndex, nPreSegmentDelayHandle, 0.0);
+			double dPostSegmentDelay = (float)pLayer->GetSegmentProfileDoubleValueByHandleDef(nSegmentIndex, nPostSegmentDelayHandle, 0.0);
 
 			uint32_t nOIEPIDControlIndex = 0;
 			if (m_bEnableOIEPIDControl) {
-				nOIEPIDControlIndex = (uint32_t) pLayer->GetSegmentProfileIntegerValueDef(nSegmentIndex, "http://schemas.scanlab.com/oie/2023/08", "pidindex", 0);
+				nOIEPIDControlIndex = (uint32_t) pLayer->GetSegmentProfileIntegerValueByHandleDef(nSegmentIndex, nPIDIndexHandle, 0);
 			}
 
 			// Legacy fix: There might be 3MFs with double values as laser index (like 1.0000)
 			// Ensure that they are at least approximately installers
-			double dLaserIndexOfSegment = pLayer->GetSegmentProfileDoubleValueDef(nSegmentIndex, "", "laserindex", 0);
+			double dLaserIndexOfSegment = pLayer->GetSegmentProfileDoubleValueByHandleDef(nSegmentIndex, nLaserIndexHandle, 0);
 			int64_t nLaserIndexOfSegment = (int64_t)round(dLaserIndexOfSegment);
 			if (abs(dLaserIndexOfSegment - double(nLaserIndexOfSegment)) > 0.001)
 				throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_SEGMENTHASINVALIDLASERINDEX, "Segment has invalid laser index: " + std::to_string(dLaserIndexOfSegment));
@@ -2858,7 +2877,7 @@ void CRTCContext::addLayerToListEx(LibMCEnv::PToolpathLayer pLayer, eOIERecordin
 
 			if (nLaserIndexOfSegment == nCurrentLaserIndex) {
 
-				int64_t nSkywritingMode = pLayer->GetSegmentProfileIntegerValueDef(nSegmentIndex, "http://schemas.scanlab.com/skywriting/2023/01", "mode", 0);
+				int64_t nSkywritingMode = pLayer->GetSegmentProfileIntegerValueByHandleDef(nSegmentIndex, nSkywritingModeHandle, 0);
 
 				if (nSkywritingMode != 0) {
 
@@ -3001,7 +3020,7 @@ void CRTCContext::addLayerToListEx(LibMCEnv::PToolpathLayer pLayer, eOIERecordin
 		}
 
 		// Run GPIO Post-Sequence
-		auto sPostSequence = pLayer->GetSegmentProfileValueDef(nSegmentIndex, "http://schemas.scanlab.com/gpiosequence/2025/01", "postsequence", "");
+		auto sPostSequence = pLayer->GetSegmentProfileValueByHandleDef(nSegmentIndex, nPostSequenceHandle, "");
 		if (!sPostSequence.empty()) {
 			addGPIOSequenceToList(sPostSequence);
 		}
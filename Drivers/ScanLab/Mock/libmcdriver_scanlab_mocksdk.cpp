@@ -0,0 +1,1702 @@
+/*++
+
+Copyright (C) 2020 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+/*
+ Software-only implementation of the RTC6 DLL exports used by the ScanLab driver.
+ List commands are recorded into an in-memory list buffer of the same capacity as
+ the card. Executing a list computes the scan trajectory from speeds and delays and
+ replays it against the wall clock, so list status, position values and the data
+ recording channels behave like a connected scan head. The simulated card reports
+ the serial number 123456 both on the local bus and on the ethernet search.
+ Load it with LoadCustomSDK.
+*/
+
+#include "../Implementation/libmcdriver_scanlab_sdk.hpp"
+
+#include <map>
+#include <memory>
+#include <array>
+#include <vector>
+#include <string>
+#include <mutex>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <algorithm>
+
+#ifdef _WIN32
+#define RTC6MOCK_EXPORT extern "C" __declspec(dllexport)
+#else
+#define RTC6MOCK_EXPORT extern "C" __attribute__((visibility("default")))
+#endif
+
+#define RTC6MOCK_ERROR_NOERROR 0
+#define RTC6MOCK_ERROR_NOCARD 1
+#define RTC6MOCK_ERROR_ACCESSDENIED 2
+#define RTC6MOCK_ERROR_PARAMETER 16
+#define RTC6MOCK_ERROR_BUSY 32
+#define RTC6MOCK_ERROR_REJECTED 64
+
+#define RTC6MOCK_SERIALNUMBER 123456
+#define RTC6MOCK_DLLVERSION 636
+#define RTC6MOCK_HEXVERSION 636
+#define RTC6MOCK_BIOSVERSION 1
+#define RTC6MOCK_RTCVERSION 0x1630
+#define RTC6MOCK_CARDTYPE 6
+
+#define RTC6MOCK_LISTMEMORYSIZE (1UL << 23)
+#define RTC6MOCK_MAXMEASUREMENTPOSITION (1UL << 22)
+#define RTC6MOCK_SIGNALCOUNT 8
+#define RTC6MOCK_FREEVARIABLECOUNT 8
+
+// Bits per mm of the simulated correction table
+#define RTC6MOCK_CORRECTIONFACTOR 5000.0
+
+// Defaults in bits/ms and in 10us clock ticks
+#define RTC6MOCK_DEFAULTMARKSPEED 1000.0
+#define RTC6MOCK_DEFAULTJUMPSPEED 10000.0
+#define RTC6MOCK_CLOCKPERIODINMS 0.01
+
+// The simulated scan head follows the target position with a constant lag
+#define RTC6MOCK_TRACKINGDELAYINMS 0.25
+
+#define RTC6MOCK_HEADSTATUS_OK ((1UL << 3) | (1UL << 4) | (1UL << 6) | (1UL << 7))
+
+namespace {
+
+	enum class eRTC6MockCommandType : uint32_t {
+		Nop = 0,
+		EndOfList = 1,
+		JumpAbs = 2,
+		MarkAbs = 3,
+		TimedMarkAbs = 4,
+		MicroVectorAbs = 5,
+		MicroVectorRel = 6,
+		LongDelay = 7,
+		MarkSpeed = 8,
+		JumpSpeed = 9,
+		ScannerDelays = 10,
+		Defocus = 11,
+		FreeVariable = 12,
+		Trigger = 13,
+		FlyReturn = 14
+	};
+
+	typedef struct {
+		eRTC6MockCommandType m_Type;
+		int32_t m_nParam1;
+		int32_t m_nParam2;
+		int32_t m_nParam3;
+		double m_dValue;
+	} sRTC6MockCommand;
+
+	typedef struct {
+		uint32_t m_nPeriod;
+		std::array<uint32_t, RTC6MOCK_SIGNALCOUNT> m_Signals;
+	} sRTC6MockTrigger;
+
+	// One straight movement of the executed trajectory. Times are in ms since list start.
+	typedef struct {
+		double m_dStartTime;
+		double m_dEndTime;
+		int32_t m_nStartX;
+		int32_t m_nStartY;
+		int32_t m_nEndX;
+		int32_t m_nEndY;
+		int32_t m_nZ;
+		bool m_bLaserOn;
+		double m_dMarkSpeed;
+	} sRTC6MockMotion;
+
+	typedef struct {
+		int32_t m_nX;
+		int32_t m_nY;
+		int32_t m_nZ;
+		bool m_bLaserOn;
+		double m_dMarkSpeed;
+	} sRTC6MockSample;
+
+	class CRTC6MockCard {
+	private:
+		uint32_t m_nSerialNumber;
+		uint32_t m_nLastError;
+		uint32_t m_nAccumulatedError;
+
+		uint32_t m_nListSize1;
+		uint32_t m_nListSize2;
+		std::vector<sRTC6MockCommand> m_ListMemory;
+		uint32_t m_nInputPointer;
+		uint32_t m_nInputListEnd;
+		std::vector<sRTC6MockTrigger> m_Triggers;
+		std::array<uint32_t, RTC6MOCK_FREEVARIABLECOUNT> m_FreeVariables;
+
+		int32_t m_nCurrentX;
+		int32_t m_nCurrentY;
+		int32_t m_nCurrentZ;
+		double m_dCurrentMarkSpeed;
+
+		bool m_bExecuting;
+		std::chrono::steady_clock::time_point m_ExecutionStart;
+		uint32_t m_nExecutionStartPosition;
+		double m_dExecutionDuration;
+		std::vector<double> m_CommandEndTimes;
+		std::vector<sRTC6MockMotion> m_Motions;
+		sRTC6MockSample m_InitialSample;
+		sRTC6MockSample m_FinalSample;
+
+		bool m_bHasRecording;
+		double m_dRecordingStart;
+		double m_dRecordingEnd;
+		sRTC6MockTrigger m_RecordingTrigger;
+
+		double getElapsedTime()
+		{
+			auto duration = std::chrono::steady_clock::now() - m_ExecutionStart;
+			return (double)std::chrono::duration_cast<std::chrono::microseconds> (duration).count() / 1000.0;
+		}
+
+		void updateExecution()
+		{
+			if (m_bExecuting && (getElapsedTime() >= m_dExecutionDuration)) {
+				m_bExecuting = false;
+				m_nCurrentX = m_FinalSample.m_nX;
+				m_nCurrentY = m_FinalSample.m_nY;
+				m_nCurrentZ = m_FinalSample.m_nZ;
+				m_dCurrentMarkSpeed = m_FinalSample.m_dMarkSpeed;
+			}
+		}
+
+		uint32_t getListBase(uint32_t nListNo)
+		{
+			return (nListNo == 2) ? m_nListSize1 : 0;
+		}
+
+		uint32_t getListEnd(uint32_t nListNo)
+		{
+			return (nListNo == 2) ? (m_nListSize1 + m_nListSize2) : m_nListSize1;
+		}
+
+		sRTC6MockSample sampleTrajectory(double dTime)
+		{
+			sRTC6MockSample sample = m_InitialSample;
+
+			if (m_Motions.empty() || (dTime < m_Motions.front().m_dStartTime))
+				return sample;
+
+			auto iIter = std::upper_bound(m_Motions.begin(), m_Motions.end(), dTime, [](double dValue, const sRTC6MockMotion& motion) {
+				return dValue < motion.m_dStartTime;
+			});
+			auto& motion = *(iIter - 1);
+
+			sample.m_nZ = motion.m_nZ;
+			sample.m_dMarkSpeed = motion.m_dMarkSpeed;
+			double dDuration = motion.m_dEndTime - motion.m_dStartTime;
+			if ((dTime >= motion.m_dEndTime) || (dDuration <= 0.0)) {
+				sample.m_nX = motion.m_nEndX;
+				sample.m_nY = motion.m_nEndY;
+			}
+			else {
+				double dFactor = (dTime - motion.m_dStartTime) / dDuration;
+				sample.m_nX = motion.m_nStartX + (int32_t)std::round((motion.m_nEndX - motion.m_nStartX) * dFactor);
+				sample.m_nY = motion.m_nStartY + (int32_t)std::round((motion.m_nEndY - motion.m_nStartY) * dFactor);
+				sample.m_bLaserOn = motion.m_bLaserOn;
+			}
+
+			return sample;
+		}
+
+		int32_t sampleSignal(uint32_t nSignal, double dTime)
+		{
+			switch (nSignal) {
+			case 0: return sampleTrajectory(dTime).m_bLaserOn ? 1 : 0;
+			case 1: return sampleTrajectory(dTime - RTC6MOCK_TRACKINGDELAYINMS).m_nX;
+			case 2: return sampleTrajectory(dTime - RTC6MOCK_TRACKINGDELAYINMS).m_nY;
+			case 4: return sampleTrajectory(dTime - RTC6MOCK_TRACKINGDELAYINMS).m_nZ;
+			case 7: case 10: case 20: return sampleTrajectory(dTime).m_nX;
+			case 8: case 11: case 21: return sampleTrajectory(dTime).m_nY;
+			case 9: case 12: case 32: return sampleTrajectory(dTime).m_nZ;
+			case 45: return (int32_t)sampleTrajectory(dTime).m_dMarkSpeed;
+			case 39: case 40: case 41: case 42: return (int32_t)m_FreeVariables.at(nSignal - 39);
+			case 48: case 49: case 50: case 51: return (int32_t)m_FreeVariables.at(nSignal - 44);
+			default: return 0;
+			}
+		}
+
+		uint32_t getRecordedSampleCount(double dTime)
+		{
+			if (!m_bHasRecording || (dTime < m_dRecordingStart))
+				return 0;
+
+			double dPeriod = m_RecordingTrigger.m_nPeriod * RTC6MOCK_CLOCKPERIODINMS;
+			double dEnd = std::min(dTime, m_dRecordingEnd);
+			return (uint32_t)((dEnd - m_dRecordingStart) / dPeriod);
+		}
+
+		void buildTrajectory(uint32_t nStartPosition, uint32_t nListEnd)
+		{
+			m_CommandEndTimes.clear();
+			m_Motions.clear();
+			m_bHasRecording = false;
+
+			int32_t nX = m_nCurrentX;
+			int32_t nY = m_nCurrentY;
+			int32_t nZ = m_nCurrentZ;
+			double dMarkSpeed = m_dCurrentMarkSpeed;
+			double dJumpSpeed = RTC6MOCK_DEFAULTJUMPSPEED;
+			double dJumpDelay = 0.0;
+			double dMarkDelay = 0.0;
+			double dPolygonDelay = 0.0;
+			bool bLastMotionWasMark = false;
+			double dTime = 0.0;
+
+			m_InitialSample.m_nX = nX;
+			m_InitialSample.m_nY = nY;
+			m_InitialSample.m_nZ = nZ;
+			m_InitialSample.m_bLaserOn = false;
+			m_InitialSample.m_dMarkSpeed = dMarkSpeed;
+
+			auto addMotion = [&](int32_t nTargetX, int32_t nTargetY, double dDuration, bool bLaserOn) {
+				sRTC6MockMotion motion;
+				motion.m_dStartTime = dTime;
+				motion.m_dEndTime = dTime + dDuration;
+				motion.m_nStartX = nX;
+				motion.m_nStartY = nY;
+				motion.m_nEndX = nTargetX;
+				motion.m_nEndY = nTargetY;
+				motion.m_nZ = nZ;
+				motion.m_bLaserOn = bLaserOn;
+				motion.m_dMarkSpeed = dMarkSpeed;
+				m_Motions.push_back(motion);
+
+				dTime += dDuration;
+				nX = nTargetX;
+				nY = nTargetY;
+			};
+
+			auto getDistance = [&](int32_t nTargetX, int32_t nTargetY) {
+				double dX = (double)nTargetX - (double)nX;
+				double dY = (double)nTargetY - (double)nY;
+				return std::sqrt(dX * dX + dY * dY);
+			};
+
+			uint32_t nEndPosition = std::min(nListEnd, (uint32_t)m_ListMemory.size());
+			for (uint32_t nPosition = nStartPosition; nPosition < nEndPosition; nPosition++) {
+				auto& command = m_ListMemory.at(nPosition);
+				if (command.m_Type == eRTC6MockCommandType::EndOfList) {
+					m_CommandEndTimes.push_back(dTime);
+					break;
+				}
+
+				switch (command.m_Type) {
+				case eRTC6MockCommandType::JumpAbs:
+				case eRTC6MockCommandType::FlyReturn:
+					if (bLastMotionWasMark)
+						dTime += dMarkDelay;
+					addMotion(command.m_nParam1, command.m_nParam2, getDistance(command.m_nParam1, command.m_nParam2) / dJumpSpeed, false);
+					dTime += dJumpDelay;
+					bLastMotionWasMark = false;
+					break;
+
+				case eRTC6MockCommandType::MarkAbs:
+					if (bLastMotionWasMark)
+						dTime += dPolygonDelay;
+					addMotion(command.m_nParam1, command.m_nParam2, getDistance(command.m_nParam1, command.m_nParam2) / dMarkSpeed, true);
+					bLastMotionWasMark = true;
+					break;
+
+				case eRTC6MockCommandType::TimedMarkAbs:
+					if (bLastMotionWasMark)
+						dTime += dPolygonDelay;
+					addMotion(command.m_nParam1, command.m_nParam2, command.m_dValue / 1000.0, true);
+					bLastMotionWasMark = true;
+					break;
+
+				case eRTC6MockCommandType::MicroVectorAbs:
+					addMotion(command.m_nParam1, command.m_nParam2, RTC6MOCK_CLOCKPERIODINMS, command.m_nParam3 != 0);
+					break;
+
+				case eRTC6MockCommandType::MicroVectorRel:
+					addMotion(nX + command.m_nParam1, nY + command.m_nParam2, RTC6MOCK_CLOCKPERIODINMS, command.m_nParam3 != 0);
+					break;
+
+				case eRTC6MockCommandType::LongDelay:
+					dTime += command.m_nParam1 * RTC6MOCK_CLOCKPERIODINMS;
+					break;
+
+				case eRTC6MockCommandType::MarkSpeed:
+					if (command.m_dValue > 0.0)
+						dMarkSpeed = command.m_dValue;
+					break;
+
+				case eRTC6MockCommandType::JumpSpeed:
+					if (command.m_dValue > 0.0)
+						dJumpSpeed = command.m_dValue;
+					break;
+
+				case eRTC6MockCommandType::ScannerDelays:
+					dJumpDelay = command.m_nParam1 * RTC6MOCK_CLOCKPERIODINMS;
+					dMarkDelay = command.m_nParam2 * RTC6MOCK_CLOCKPERIODINMS;
+					dPolygonDelay = command.m_nParam3 * RTC6MOCK_CLOCKPERIODINMS;
+					break;
+
+				case eRTC6MockCommandType::Defocus:
+					nZ = command.m_nParam1;
+					break;
+
+				case eRTC6MockCommandType::FreeVariable:
+					if ((uint32_t)command.m_nParam1 < RTC6MOCK_FREEVARIABLECOUNT)
+						m_FreeVariables.at(command.m_nParam1) = (uint32_t)command.m_nParam2;
+					break;
+
+				case eRTC6MockCommandType::Trigger: {
+					auto& trigger = m_Triggers.at(command.m_nParam1);
+					if (trigger.m_nPeriod > 0) {
+						m_bHasRecording = true;
+						m_dRecordingStart = dTime;
+						m_dRecordingEnd = -1.0;
+						m_RecordingTrigger = trigger;
+					}
+					else if (m_bHasRecording && (m_dRecordingEnd < 0.0)) {
+						m_dRecordingEnd = dTime;
+					}
+					break;
+				}
+
+				default:
+					break;
+				}
+
+				m_CommandEndTimes.push_back(dTime);
+			}
+
+			if (bLastMotionWasMark)
+				dTime += dMarkDelay;
+
+			if (m_bHasRecording && (m_dRecordingEnd < 0.0))
+				m_dRecordingEnd = dTime;
+
+			m_dExecutionDuration = dTime;
+			m_FinalSample.m_nX = nX;
+			m_FinalSample.m_nY = nY;
+			m_FinalSample.m_nZ = nZ;
+			m_FinalSample.m_bLaserOn = false;
+			m_FinalSample.m_dMarkSpeed = dMarkSpeed;
+		}
+
+	public:
+
+		CRTC6MockCard(uint32_t nSerialNumber)
+			: m_nSerialNumber(nSerialNumber), m_nLastError(RTC6MOCK_ERROR_NOERROR), m_nAccumulatedError(RTC6MOCK_ERROR_NOERROR),
+			m_nListSize1(RTC6MOCK_LISTMEMORYSIZE / 2), m_nListSize2(RTC6MOCK_LISTMEMORYSIZE / 2),
+			m_nInputPointer(0), m_nInputListEnd(RTC6MOCK_LISTMEMORYSIZE / 2),
+			m_nCurrentX(0), m_nCurrentY(0), m_nCurrentZ(0), m_dCurrentMarkSpeed(RTC6MOCK_DEFAULTMARKSPEED),
+			m_bExecuting(false), m_nExecutionStartPosition(0), m_dExecutionDuration(0.0),
+			m_bHasRecording(false), m_dRecordingStart(0.0), m_dRecordingEnd(0.0)
+		{
+			m_FreeVariables.fill(0);
+			m_InitialSample.m_nX = 0;
+			m_InitialSample.m_nY = 0;
+			m_InitialSample.m_nZ = 0;
+			m_InitialSample.m_bLaserOn = false;
+			m_InitialSample.m_dMarkSpeed = RTC6MOCK_DEFAULTMARKSPEED;
+			m_FinalSample = m_InitialSample;
+			m_RecordingTrigger.m_nPeriod = 0;
+			m_RecordingTrigger.m_Signals.fill(0);
+		}
+
+		uint32_t getSerialNumber()
+		{
+			return m_nSerialNumber;
+		}
+
+		void setError(uint32_t nError)
+		{
+			m_nLastError = nError;
+			m_nAccumulatedError |= nError;
+		}
+
+		void clearLastError()
+		{
+			m_nLastError = RTC6MOCK_ERROR_NOERROR;
+		}
+
+		uint32_t getLastError()
+		{
+			return m_nLastError;
+		}
+
+		uint32_t getAccumulatedError()
+		{
+			return m_nAccumulatedError;
+		}
+
+		void resetError(uint32_t nCode)
+		{
+			m_nAccumulatedError &= ~nCode;
+		}
+
+		bool isBusy()
+		{
+			updateExecution();
+			return m_bExecuting;
+		}
+
+		void configureLists(uint32_t nMem1, uint32_t nMem2)
+		{
+			if (isBusy()) {
+				setError(RTC6MOCK_ERROR_BUSY);
+				return;
+			}
+
+			if (((uint64_t)nMem1 + (uint64_t)nMem2) > RTC6MOCK_LISTMEMORYSIZE) {
+				setError(RTC6MOCK_ERROR_PARAMETER);
+				return;
+			}
+
+			m_nListSize1 = nMem1;
+			m_nListSize2 = nMem2;
+			m_nInputPointer = 0;
+			m_nInputListEnd = m_nListSize1;
+			m_ListMemory.clear();
+			m_Triggers.clear();
+		}
+
+		void setStartListPos(uint32_t nListNo, uint32_t nListPos)
+		{
+			if (((nListNo != 1) && (nListNo != 2)) || (nListPos >= getListEnd(nListNo) - getListBase(nListNo))) {
+				setError(RTC6MOCK_ERROR_PARAMETER);
+				return;
+			}
+
+			if (nListPos == 0) {
+				// Lists are rewritten from the start, forget trigger settings of earlier jobs
+				if (!isBusy())
+					m_Triggers.clear();
+			}
+
+			m_nInputPointer = getListBase(nListNo) + nListPos;
+			m_nInputListEnd = getListEnd(nListNo);
+		}
+
+		uint32_t getInputPointer()
+		{
+			return m_nInputPointer;
+		}
+
+		void addListCommand(eRTC6MockCommandType commandType, int32_t nParam1, int32_t nParam2, int32_t nParam3, double dValue)
+		{
+			if (m_nInputPointer >= m_nInputListEnd) {
+				setError(RTC6MOCK_ERROR_REJECTED);
+				return;
+			}
+
+			if (m_nInputPointer >= m_ListMemory.size())
+				m_ListMemory.resize((size_t)m_nInputPointer + 1);
+
+			auto& command = m_ListMemory.at(m_nInputPointer);
+			command.m_Type = commandType;
+			command.m_nParam1 = nParam1;
+			command.m_nParam2 = nParam2;
+			command.m_nParam3 = nParam3;
+			command.m_dValue = dValue;
+
+			m_nInputPointer++;
+		}
+
+		void addTrigger(uint32_t nPeriod, const std::array<uint32_t, RTC6MOCK_SIGNALCOUNT>& signals)
+		{
+			sRTC6MockTrigger trigger;
+			trigger.m_nPeriod = nPeriod & ~RTC6_BITFLAG_SETTRIGGER_ROUNDTRIP;
+			trigger.m_Signals = signals;
+			m_Triggers.push_back(trigger);
+
+			addListCommand(eRTC6MockCommandType::Trigger, (int32_t)(m_Triggers.size() - 1), 0, 0, 0.0);
+		}
+
+		void executeList(uint32_t nListNo, uint32_t nListPos)
+		{
+			if (isBusy()) {
+				setError(RTC6MOCK_ERROR_BUSY);
+				return;
+			}
+
+			if (((nListNo != 1) && (nListNo != 2)) || (nListPos >= getListEnd(nListNo) - getListBase(nListNo))) {
+				setError(RTC6MOCK_ERROR_PARAMETER);
+				return;
+			}
+
+			m_nExecutionStartPosition = getListBase(nListNo) + nListPos;
+			buildTrajectory(m_nExecutionStartPosition, getListEnd(nListNo));
+
+			m_ExecutionStart = std::chrono::steady_clock::now();
+			m_bExecuting = true;
+		}
+
+		void stopExecution()
+		{
+			if (isBusy()) {
+				double dElapsed = getElapsedTime();
+				m_FinalSample = sampleTrajectory(dElapsed);
+				m_dExecutionDuration = dElapsed;
+				if (m_bHasRecording)
+					m_dRecordingEnd = std::min(m_dRecordingEnd, dElapsed);
+				updateExecution();
+			}
+		}
+
+		void getStatus(uint32_t* pnStatus, uint32_t* pnPos)
+		{
+			bool bBusy = isBusy();
+			uint32_t nPosition = m_nExecutionStartPosition;
+			if (!m_CommandEndTimes.empty()) {
+				if (bBusy) {
+					auto iIter = std::upper_bound(m_CommandEndTimes.begin(), m_CommandEndTimes.end(), getElapsedTime());
+					nPosition += (uint32_t)(iIter - m_CommandEndTimes.begin());
+				}
+				else {
+					nPosition += (uint32_t)(m_CommandEndTimes.size() - 1);
+				}
+			}
+
+			if (pnStatus != nullptr)
+				*pnStatus = bBusy ? 1 : 0;
+			if (pnPos != nullptr)
+				*pnPos = nPosition;
+		}
+
+		void getMeasurementStatus(uint32_t* pnBusy, uint32_t* pnPos)
+		{
+			uint32_t nBusy = 0;
+			uint32_t nPosition = 0;
+
+			if (m_bHasRecording) {
+				double dTime = isBusy() ? getElapsedTime() : m_dExecutionDuration;
+				if (dTime < m_dRecordingStart) {
+					nPosition = (uint32_t)-1;
+				}
+				else {
+					nBusy = (dTime < m_dRecordingEnd) ? 1 : 0;
+					nPosition = getRecordedSampleCount(dTime) % RTC6MOCK_MAXMEASUREMENTPOSITION;
+				}
+			}
+
+			if (pnBusy != nullptr)
+				*pnBusy = nBusy;
+			if (pnPos != nullptr)
+				*pnPos = nPosition;
+		}
+
+		void getWaveform(uint32_t nChannel, uint32_t nOffset, uint32_t nNumber, int32_t* pBuffer)
+		{
+			if ((pBuffer == nullptr) || (nChannel < 1) || (nChannel > RTC6MOCK_SIGNALCOUNT) || !m_bHasRecording) {
+				setError(RTC6MOCK_ERROR_PARAMETER);
+				return;
+			}
+
+			double dTime = isBusy() ? getElapsedTime() : m_dExecutionDuration;
+			uint64_t nSampleCount = getRecordedSampleCount(dTime);
+			uint64_t nRoundtripBase = (nSampleCount / RTC6MOCK_MAXMEASUREMENTPOSITION) * RTC6MOCK_MAXMEASUREMENTPOSITION;
+
+			uint32_t nSignal = m_RecordingTrigger.m_Signals.at(nChannel - 1);
+			double dPeriod = m_RecordingTrigger.m_nPeriod * RTC6MOCK_CLOCKPERIODINMS;
+
+			for (uint32_t nIndex = 0; nIndex < nNumber; nIndex++) {
+				uint64_t nSampleIndex = nRoundtripBase + nOffset + nIndex;
+				if ((nSampleIndex > nSampleCount) && (nSampleIndex >= RTC6MOCK_MAXMEASUREMENTPOSITION))
+					nSampleIndex -= RTC6MOCK_MAXMEASUREMENTPOSITION;
+
+				pBuffer[nIndex] = sampleSignal(nSignal, m_dRecordingStart + nSampleIndex * dPeriod);
+			}
+		}
+
+		int32_t getValue(uint32_t nSignal)
+		{
+			double dTime = isBusy() ? getElapsedTime() : m_dExecutionDuration;
+			if (!m_bExecuting) {
+				switch (nSignal) {
+				case 1: case 7: case 10: case 20: return m_nCurrentX;
+				case 2: case 8: case 11: case 21: return m_nCurrentY;
+				case 4: case 9: case 12: case 32: return m_nCurrentZ;
+				case 45: return (int32_t)m_dCurrentMarkSpeed;
+				case 0: return 0;
+				default: break;
+				}
+			}
+
+			return sampleSignal(nSignal, dTime);
+		}
+
+		void setFreeVariable(uint32_t nVarNo, uint32_t nValue)
+		{
+			if (nVarNo >= RTC6MOCK_FREEVARIABLECOUNT) {
+				setError(RTC6MOCK_ERROR_PARAMETER);
+				return;
+			}
+			m_FreeVariables.at(nVarNo) = nValue;
+		}
+
+		uint32_t getFreeVariable(uint32_t nVarNo)
+		{
+			if (nVarNo >= RTC6MOCK_FREEVARIABLECOUNT) {
+				setError(RTC6MOCK_ERROR_PARAMETER);
+				return 0;
+			}
+			return m_FreeVariables.at(nVarNo);
+		}
+
+	};
+
+	class CRTC6MockSDK {
+	private:
+		std::mutex m_Mutex;
+		std::map<uint32_t, std::unique_ptr<CRTC6MockCard>> m_Cards;
+		uint32_t m_nLastError;
+		uint32_t m_nEthernetSearchCount;
+
+		void initialize()
+		{
+			// A single simulated card is present on the local bus
+			if (m_Cards.empty())
+				m_Cards.insert(std::make_pair(1, std::unique_ptr<CRTC6MockCard>(new CRTC6MockCard(RTC6MOCK_SERIALNUMBER))));
+		}
+
+	public:
+
+		CRTC6MockSDK()
+			: m_nLastError(RTC6MOCK_ERROR_NOERROR), m_nEthernetSearchCount(0)
+		{
+		}
+
+		std::mutex& getMutex()
+		{
+			return m_Mutex;
+		}
+
+		uint32_t init()
+		{
+			std::lock_guard<std::mutex> lockGuard(m_Mutex);
+			initialize();
+			m_nLastError = RTC6MOCK_ERROR_NOERROR;
+			return RTC6MOCK_ERROR_NOERROR;
+		}
+
+		void free()
+		{
+			std::lock_guard<std::mutex> lockGuard(m_Mutex);
+			m_Cards.clear();
+			m_nEthernetSearchCount = 0;
+		}
+
+		uint32_t getLastError()
+		{
+			std::lock_guard<std::mutex> lockGuard(m_Mutex);
+			return m_nLastError;
+		}
+
+		void setLastError(uint32_t nError)
+		{
+			m_nLastError = nError;
+		}
+
+		uint32_t countLocalCards()
+		{
+			std::lock_guard<std::mutex> lockGuard(m_Mutex);
+			initialize();
+			return 1;
+		}
+
+		uint32_t countCards()
+		{
+			std::lock_guard<std::mutex> lockGuard(m_Mutex);
+			initialize();
+			return (uint32_t)m_Cards.size();
+		}
+
+		uint32_t searchEthernetCards()
+		{
+			std::lock_guard<std::mutex> lockGuard(m_Mutex);
+			m_nEthernetSearchCount = 1;
+			return m_nEthernetSearchCount;
+		}
+
+		uint32_t getEthernetSearchCount()
+		{
+			std::lock_guard<std::mutex> lockGuard(m_Mutex);
+			return m_nEthernetSearchCount;
+		}
+
+		uint32_t getEthernetSerial(uint32_t nSearchNo)
+		{
+			std::lock_guard<std::mutex> lockGuard(m_Mutex);
+			if ((nSearchNo < 1) || (nSearchNo > m_nEthernetSearchCount))
+				return 0;
+			return RTC6MOCK_SERIALNUMBER;
+		}
+
+		int32_t assignEthernetCard(uint32_t nSearchNo, uint32_t nCardNo)
+		{
+			std::lock_guard<std::mutex> lockGuard(m_Mutex);
+			initialize();
+			if ((nSearchNo < 1) || (nSearchNo > m_nEthernetSearchCount)) {
+				m_nLastError = RTC6MOCK_ERROR_PARAMETER;
+				return 0;
+			}
+
+			uint32_t nNewCardNo = nCardNo;
+			if (nNewCardNo == 0)
+				nNewCardNo = m_Cards.rbegin()->first + 1;
+
+			m_Cards[nNewCardNo] = std::unique_ptr<CRTC6MockCard>(new CRTC6MockCard(RTC6MOCK_SERIALNUMBER));
+			return (int32_t)nNewCardNo;
+		}
+
+		int32_t removeCard(uint32_t nCardNo)
+		{
+			std::lock_guard<std::mutex> lockGuard(m_Mutex);
+			if ((nCardNo <= 1) || (m_Cards.erase(nCardNo) == 0))
+				return -1;
+			return 0;
+		}
+
+		// Must be called with the mutex locked. Returns nullptr and sets the global error for unknown cards.
+		CRTC6MockCard* findCard(uint32_t nCardNo)
+		{
+			auto iIter = m_Cards.find(nCardNo);
+			if (iIter == m_Cards.end()) {
+				m_nLastError = RTC6MOCK_ERROR_NOCARD;
+				return nullptr;
+			}
+
+			iIter->second->clearLastError();
+			return iIter->second.get();
+		}
+
+		uint32_t getCardError(uint32_t nCardNo, bool bAccumulated)
+		{
+			std::lock_guard<std::mutex> lockGuard(m_Mutex);
+			auto iIter = m_Cards.find(nCardNo);
+			if (iIter == m_Cards.end())
+				return RTC6MOCK_ERROR_NOCARD;
+
+			return bAccumulated ? iIter->second->getAccumulatedError() : iIter->second->getLastError();
+		}
+
+		void controlCommand(uint32_t nCardNo)
+		{
+			std::lock_guard<std::mutex> lockGuard(m_Mutex);
+			findCard(nCardNo);
+		}
+
+		void listCommand(uint32_t nCardNo, eRTC6MockCommandType commandType, int32_t nParam1 = 0, int32_t nParam2 = 0, int32_t nParam3 = 0, double dValue = 0.0)
+		{
+			std::lock_guard<std::mutex> lockGuard(m_Mutex);
+			auto pCard = findCard(nCardNo);
+			if (pCard != nullptr)
+				pCard->addListCommand(commandType, nParam1, nParam2, nParam3, dValue);
+		}
+
+	};
+
+	CRTC6MockSDK& getMockSDK()
+	{
+		static CRTC6MockSDK mockSDK;
+		return mockSDK;
+	}
+
+	// Locks the SDK for the lifetime of the accessor and resolves the card number
+	class CRTC6MockCardAccess {
+	private:
+		std::lock_guard<std::mutex> m_LockGuard;
+		CRTC6MockCard* m_pCard;
+
+	public:
+		CRTC6MockCardAccess(uint32_t nCardNo)
+			: m_LockGuard(getMockSDK().getMutex()), m_pCard(getMockSDK().findCard(nCardNo))
+		{
+		}
+
+		CRTC6MockCard* get()
+		{
+			return m_pCard;
+		}
+	};
+
+}
+
+/*************************************************************************************************************************
+ DLL and card management
+**************************************************************************************************************************/
+
+RTC6MOCK_EXPORT uint32_t SCANLAB_CALLINGCONVENTION init_rtc6_dll()
+{
+	return getMockSDK().init();
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION free_rtc6_dll()
+{
+	getMockSDK().free();
+}
+
+RTC6MOCK_EXPORT uint32_t SCANLAB_CALLINGCONVENTION eth_convert_string_to_ip(const char* pIPString)
+{
+	if (pIPString == nullptr)
+		return 0;
+
+	uint32_t nIP = 0;
+	uint32_t nOctet = 0;
+	uint32_t nOctetCount = 0;
+	for (const char* pChar = pIPString; ; pChar++) {
+		if ((*pChar >= '0') && (*pChar <= '9')) {
+			nOctet = nOctet * 10 + (uint32_t)(*pChar - '0');
+			if (nOctet > 255)
+				return 0;
+		}
+		else if ((*pChar == '.') || (*pChar == 0)) {
+			// The RTC DLL stores the first octet in the lowest byte
+			nIP |= nOctet << (8 * nOctetCount);
+			nOctet = 0;
+			nOctetCount++;
+			if ((*pChar == 0) || (nOctetCount > 3))
+				break;
+		}
+		else {
+			return 0;
+		}
+	}
+
+	return (nOctetCount == 4) ? nIP : 0;
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION eth_set_search_cards_timeout(const uint32_t nTimeOut)
+{
+}
+
+RTC6MOCK_EXPORT uint32_t SCANLAB_CALLINGCONVENTION eth_search_cards_range(const uint32_t nStartIP, const uint32_t nEndIP)
+{
+	return getMockSDK().searchEthernetCards();
+}
+
+RTC6MOCK_EXPORT uint32_t SCANLAB_CALLINGCONVENTION eth_search_cards(uint32_t nIP, uint32_t nNetMask)
+{
+	return getMockSDK().searchEthernetCards();
+}
+
+RTC6MOCK_EXPORT uint32_t SCANLAB_CALLINGCONVENTION rtc6_count_cards()
+{
+	return getMockSDK().countLocalCards();
+}
+
+RTC6MOCK_EXPORT uint32_t SCANLAB_CALLINGCONVENTION eth_count_cards()
+{
+	return getMockSDK().countCards() - 1;
+}
+
+RTC6MOCK_EXPORT uint32_t SCANLAB_CALLINGCONVENTION eth_found_cards()
+{
+	return getMockSDK().getEthernetSearchCount();
+}
+
+RTC6MOCK_EXPORT int32_t SCANLAB_CALLINGCONVENTION eth_assign_card(const uint32_t nSearchNo, const uint32_t nCardNo)
+{
+	return getMockSDK().assignEthernetCard(nSearchNo, nCardNo);
+}
+
+RTC6MOCK_EXPORT int32_t SCANLAB_CALLINGCONVENTION eth_remove_card(const uint32_t nCardNo)
+{
+	return getMockSDK().removeCard(nCardNo);
+}
+
+RTC6MOCK_EXPORT uint32_t SCANLAB_CALLINGCONVENTION eth_get_serial_search(uint32_t nSearchNo)
+{
+	return getMockSDK().getEthernetSerial(nSearchNo);
+}
+
+RTC6MOCK_EXPORT uint32_t SCANLAB_CALLINGCONVENTION acquire_rtc(uint32_t nCardNo)
+{
+	CRTC6MockCardAccess card(nCardNo);
+	return (card.get() != nullptr) ? nCardNo : 0;
+}
+
+RTC6MOCK_EXPORT uint32_t SCANLAB_CALLINGCONVENTION release_rtc(uint32_t nCardNo)
+{
+	CRTC6MockCardAccess card(nCardNo);
+	return (card.get() != nullptr) ? nCardNo : 0;
+}
+
+RTC6MOCK_EXPORT uint32_t SCANLAB_CALLINGCONVENTION get_last_error()
+{
+	return getMockSDK().getLastError();
+}
+
+RTC6MOCK_EXPORT uint32_t SCANLAB_CALLINGCONVENTION n_get_last_error(uint32_t nCardNo)
+{
+	return getMockSDK().getCardError(nCardNo, false);
+}
+
+RTC6MOCK_EXPORT uint32_t SCANLAB_CALLINGCONVENTION n_get_error(uint32_t nCardNo)
+{
+	return getMockSDK().getCardError(nCardNo, true);
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_reset_error(uint32_t nCardNo, uint32_t nCode)
+{
+	CRTC6MockCardAccess card(nCardNo);
+	if (card.get() != nullptr)
+		card.get()->resetError(nCode);
+}
+
+RTC6MOCK_EXPORT uint32_t SCANLAB_CALLINGCONVENTION n_get_serial_number(uint32_t nCardNo)
+{
+	CRTC6MockCardAccess card(nCardNo);
+	return (card.get() != nullptr) ? card.get()->getSerialNumber() : 0;
+}
+
+RTC6MOCK_EXPORT uint32_t SCANLAB_CALLINGCONVENTION get_dll_version()
+{
+	return RTC6MOCK_DLLVERSION;
+}
+
+RTC6MOCK_EXPORT uint32_t SCANLAB_CALLINGCONVENTION n_get_hex_version(uint32_t nCardNo)
+{
+	CRTC6MockCardAccess card(nCardNo);
+	return RTC6MOCK_HEXVERSION;
+}
+
+RTC6MOCK_EXPORT uint32_t SCANLAB_CALLINGCONVENTION n_get_bios_version(uint32_t nCardNo)
+{
+	CRTC6MockCardAccess card(nCardNo);
+	return RTC6MOCK_BIOSVERSION;
+}
+
+RTC6MOCK_EXPORT uint32_t SCANLAB_CALLINGCONVENTION n_get_rtc_version(uint32_t nCardNo)
+{
+	CRTC6MockCardAccess card(nCardNo);
+	return RTC6MOCK_RTCVERSION;
+}
+
+RTC6MOCK_EXPORT uint32_t SCANLAB_CALLINGCONVENTION n_get_card_type(uint32_t nCardNo)
+{
+	CRTC6MockCardAccess card(nCardNo);
+	return RTC6MOCK_CARDTYPE;
+}
+
+RTC6MOCK_EXPORT uint32_t SCANLAB_CALLINGCONVENTION n_load_program_file(uint32_t nCardNo, const char* pPath)
+{
+	CRTC6MockCardAccess card(nCardNo);
+	return (card.get() != nullptr) ? RTC6MOCK_ERROR_NOERROR : RTC6MOCK_ERROR_NOCARD;
+}
+
+RTC6MOCK_EXPORT uint32_t SCANLAB_CALLINGCONVENTION n_load_correction_file(uint32_t nCardNo, const char* pFileName, uint32_t nNo, uint32_t nDimension)
+{
+	CRTC6MockCardAccess card(nCardNo);
+	return (card.get() != nullptr) ? RTC6MOCK_ERROR_NOERROR : RTC6MOCK_ERROR_NOCARD;
+}
+
+RTC6MOCK_EXPORT double SCANLAB_CALLINGCONVENTION n_get_table_para(uint32_t nCardNo, uint32_t nTableNo, uint32_t nParaNo)
+{
+	CRTC6MockCardAccess card(nCardNo);
+	return (nParaNo == 1) ? RTC6MOCK_CORRECTIONFACTOR : 0.0;
+}
+
+RTC6MOCK_EXPORT uint32_t SCANLAB_CALLINGCONVENTION n_get_head_status(uint32_t nCardNo, uint32_t nHeadNo)
+{
+	CRTC6MockCardAccess card(nCardNo);
+	return (card.get() != nullptr) ? RTC6MOCK_HEADSTATUS_OK : 0;
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_eth_set_com_timeouts_auto(uint32_t nCardNo, const double dInitialTimeout, const double dMaxTimeout, const double dMultiplier, const uint32_t nMode)
+{
+	getMockSDK().controlCommand(nCardNo);
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_eth_get_com_timeouts_auto(uint32_t nCardNo, double* pdInitialTimeout, double* pdMaxTimeout, double* pdMultiplier, uint32_t* pnMode)
+{
+	getMockSDK().controlCommand(nCardNo);
+	if (pdInitialTimeout != nullptr)
+		*pdInitialTimeout = 0.75;
+	if (pdMaxTimeout != nullptr)
+		*pdMaxTimeout = 10.0;
+	if (pdMultiplier != nullptr)
+		*pdMultiplier = 1.3;
+	if (pnMode != nullptr)
+		*pnMode = 1;
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_eth_config_waveform_streaming_ctrl(uint32_t nCardNo, uint32_t nSize, uint32_t nFlags)
+{
+	getMockSDK().controlCommand(nCardNo);
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_eth_set_high_performance_mode(uint32_t nCardNo, uint32_t nMode)
+{
+	getMockSDK().controlCommand(nCardNo);
+}
+
+/*************************************************************************************************************************
+ List management and execution
+**************************************************************************************************************************/
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_config_list(uint32_t nCardNo, uint32_t nMem1, uint32_t nMem2)
+{
+	CRTC6MockCardAccess card(nCardNo);
+	if (card.get() != nullptr)
+		card.get()->configureLists(nMem1, nMem2);
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_set_start_list_pos(uint32_t nCardNo, uint32_t nListNo, uint32_t nListPos)
+{
+	CRTC6MockCardAccess card(nCardNo);
+	if (card.get() != nullptr)
+		card.get()->setStartListPos(nListNo, nListPos);
+}
+
+RTC6MOCK_EXPORT uint32_t SCANLAB_CALLINGCONVENTION n_get_input_pointer(uint32_t nCardNo)
+{
+	CRTC6MockCardAccess card(nCardNo);
+	return (card.get() != nullptr) ? card.get()->getInputPointer() : 0;
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_set_end_of_list(uint32_t nCardNo)
+{
+	getMockSDK().listCommand(nCardNo, eRTC6MockCommandType::EndOfList);
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_execute_list_pos(uint32_t nCardNo, uint32_t nListNo, uint32_t nPos)
+{
+	CRTC6MockCardAccess card(nCardNo);
+	if (card.get() != nullptr)
+		card.get()->executeList(nListNo, nPos);
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_auto_change_pos(uint32_t nCardNo, uint32_t nPos)
+{
+	getMockSDK().controlCommand(nCardNo);
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_stop_execution(uint32_t nCardNo)
+{
+	CRTC6MockCardAccess card(nCardNo);
+	if (card.get() != nullptr)
+		card.get()->stopExecution();
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_get_status(uint32_t nCardNo, uint32_t* pnStatus, uint32_t* pnPos)
+{
+	CRTC6MockCardAccess card(nCardNo);
+	if (card.get() != nullptr) {
+		card.get()->getStatus(pnStatus, pnPos);
+	}
+	else {
+		if (pnStatus != nullptr)
+			*pnStatus = 0;
+		if (pnPos != nullptr)
+			*pnPos = 0;
+	}
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_list_nop(uint32_t nCardNo)
+{
+	getMockSDK().listCommand(nCardNo, eRTC6MockCommandType::Nop);
+}
+
+// Loops and conditional jumps occupy their list position, but are executed once in linear order
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_list_repeat(uint32_t nCardNo)
+{
+	getMockSDK().listCommand(nCardNo, eRTC6MockCommandType::Nop);
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_list_until(uint32_t nCardNo, uint32_t nNumberOfRepetitions)
+{
+	getMockSDK().listCommand(nCardNo, eRTC6MockCommandType::Nop);
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_list_jump_rel_cond(uint32_t nCardNo, uint32_t nMask1, uint32_t nMask0, int32_t nRelativeJumpPosition)
+{
+	getMockSDK().listCommand(nCardNo, eRTC6MockCommandType::Nop);
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_list_jump_rel(uint32_t nCardNo, int32_t nRelativeJumpPosition)
+{
+	getMockSDK().listCommand(nCardNo, eRTC6MockCommandType::Nop);
+}
+
+/*************************************************************************************************************************
+ Motion list commands
+**************************************************************************************************************************/
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_jump_abs(uint32_t nCardNo, int32_t nX, int32_t nY)
+{
+	getMockSDK().listCommand(nCardNo, eRTC6MockCommandType::JumpAbs, nX, nY);
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_mark_abs(uint32_t nCardNo, int32_t nX, int32_t nY)
+{
+	getMockSDK().listCommand(nCardNo, eRTC6MockCommandType::MarkAbs, nX, nY);
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_timed_mark_abs(uint32_t nCardNo, int32_t nX, int32_t nY, double dTime)
+{
+	getMockSDK().listCommand(nCardNo, eRTC6MockCommandType::TimedMarkAbs, nX, nY, 0, dTime);
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_micro_vector_abs_3d(uint32_t nCardNo, int32_t nX, int32_t nY, int32_t nZ, int32_t nLasOn, int32_t nLasOff)
+{
+	getMockSDK().listCommand(nCardNo, eRTC6MockCommandType::MicroVectorAbs, nX, nY, (nLasOn >= 0) ? 1 : 0);
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_micro_vector_rel_3d(uint32_t nCardNo, int32_t ndX, int32_t ndY, int32_t ndZ, int32_t nLasOn, int32_t nLasOff)
+{
+	getMockSDK().listCommand(nCardNo, eRTC6MockCommandType::MicroVectorRel, ndX, ndY, (nLasOn >= 0) ? 1 : 0);
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_micro_vector_abs(uint32_t nCardNo, int32_t nX, int32_t nY, int32_t nLasOn, int32_t nLasOff)
+{
+	getMockSDK().listCommand(nCardNo, eRTC6MockCommandType::MicroVectorAbs, nX, nY, (nLasOn >= 0) ? 1 : 0);
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_micro_vector_rel(uint32_t nCardNo, int32_t ndX, int32_t ndY, int32_t nLasOn, int32_t nLasOff)
+{
+	getMockSDK().listCommand(nCardNo, eRTC6MockCommandType::MicroVectorRel, ndX, ndY, (nLasOn >= 0) ? 1 : 0);
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_long_delay(uint32_t nCardNo, uint32_t nDelay)
+{
+	getMockSDK().listCommand(nCardNo, eRTC6MockCommandType::LongDelay, (int32_t)nDelay);
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_set_mark_speed(uint32_t nCardNo, double dSpeed)
+{
+	getMockSDK().listCommand(nCardNo, eRTC6MockCommandType::MarkSpeed, 0, 0, 0, dSpeed);
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_set_jump_speed(uint32_t nCardNo, double dSpeed)
+{
+	getMockSDK().listCommand(nCardNo, eRTC6MockCommandType::JumpSpeed, 0, 0, 0, dSpeed);
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_set_scanner_delays(uint32_t nCardNo, uint32_t nJump, uint32_t nMark, uint32_t nPolygon)
+{
+	getMockSDK().listCommand(nCardNo, eRTC6MockCommandType::ScannerDelays, (int32_t)nJump, (int32_t)nMark, (int32_t)nPolygon);
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_set_defocus_list(uint32_t nCardNo, int32_t nShift)
+{
+	getMockSDK().listCommand(nCardNo, eRTC6MockCommandType::Defocus, nShift);
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_fly_return(uint32_t nCardNo, int32_t nX, int32_t nY)
+{
+	getMockSDK().listCommand(nCardNo, eRTC6MockCommandType::FlyReturn, nX, nY);
+}
+
+/*************************************************************************************************************************
+ Laser and IO list commands
+**************************************************************************************************************************/
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_set_laser_delays(uint32_t nCardNo, int32_t nLaserOnDelay, uint32_t nLaserOffDelay)
+{
+	getMockSDK().listCommand(nCardNo, eRTC6MockCommandType::Nop);
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_set_laser_pulses(uint32_t nCardNo, uint32_t nHalfPeriod, uint32_t nPulseLength)
+{
+	getMockSDK().listCommand(nCardNo, eRTC6MockCommandType::Nop);
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_set_laser_power(uint32_t nCardNo, uint32_t nPort, uint32_t nPower)
+{
+	getMockSDK().listCommand(nCardNo, eRTC6MockCommandType::Nop);
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_set_firstpulse_killer_list(uint32_t nCardNo, uint32_t nLength)
+{
+	getMockSDK().listCommand(nCardNo, eRTC6MockCommandType::Nop);
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_set_qswitch_delay_list(uint32_t nCardNo, uint32_t nDelay)
+{
+	getMockSDK().listCommand(nCardNo, eRTC6MockCommandType::Nop);
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_set_laser_pin_out_list(uint32_t nCardNo, uint32_t nPins)
+{
+	getMockSDK().listCommand(nCardNo, eRTC6MockCommandType::Nop);
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_write_io_port_list(uint32_t nCardNo, uint32_t nValue)
+{
+	getMockSDK().listCommand(nCardNo, eRTC6MockCommandType::Nop);
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_write_io_port_mask_list(uint32_t nCardNo, uint32_t nValue, uint32_t nMask)
+{
+	getMockSDK().listCommand(nCardNo, eRTC6MockCommandType::Nop);
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_write_8bit_port_list(uint32_t nCardNo, uint32_t nValue)
+{
+	getMockSDK().listCommand(nCardNo, eRTC6MockCommandType::Nop);
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_write_da_1_list(uint32_t nCardNo, uint32_t nValue)
+{
+	getMockSDK().listCommand(nCardNo, eRTC6MockCommandType::Nop);
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_write_da_2_list(uint32_t nCardNo, uint32_t nValue)
+{
+	getMockSDK().listCommand(nCardNo, eRTC6MockCommandType::Nop);
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_set_multi_mcbsp_in_list(uint32_t nCardNo, uint32_t nCtrl, uint32_t nP, uint32_t nMode)
+{
+	getMockSDK().listCommand(nCardNo, eRTC6MockCommandType::Nop);
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_set_free_variable_list(uint32_t nCardNo, uint32_t nVarNo, uint32_t nValue)
+{
+	getMockSDK().listCommand(nCardNo, eRTC6MockCommandType::FreeVariable, (int32_t)nVarNo, (int32_t)nValue);
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_set_sky_writing_para_list(uint32_t nCardNo, double dTimelag, int32_t nLaserOnShift, uint32_t nNprev, uint32_t nNPost)
+{
+	getMockSDK().listCommand(nCardNo, eRTC6MockCommandType::Nop);
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_set_sky_writing_list(uint32_t nCardNo, double dTimelag, int32_t nLaserOnShift)
+{
+	getMockSDK().listCommand(nCardNo, eRTC6MockCommandType::Nop);
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_set_sky_writing_limit_list(uint32_t nCardNo, double dCosAngle)
+{
+	getMockSDK().listCommand(nCardNo, eRTC6MockCommandType::Nop);
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_set_sky_writing_mode_list(uint32_t nCardNo, uint32_t nMode)
+{
+	getMockSDK().listCommand(nCardNo, eRTC6MockCommandType::Nop);
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_set_fly_2d(uint32_t nCardNo, const double dScaleX, const double dScaleY)
+{
+	getMockSDK().listCommand(nCardNo, eRTC6MockCommandType::Nop);
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_set_fly_x_pos(uint32_t nCardNo, const double dScaleX)
+{
+	getMockSDK().listCommand(nCardNo, eRTC6MockCommandType::Nop);
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_set_fly_y_pos(uint32_t nCardNo, const double dScaleY)
+{
+	getMockSDK().listCommand(nCardNo, eRTC6MockCommandType::Nop);
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_set_fly_x(uint32_t nCardNo, const double dScaleX)
+{
+	getMockSDK().listCommand(nCardNo, eRTC6MockCommandType::Nop);
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_set_fly_y(uint32_t nCardNo, const double dScaleY)
+{
+	getMockSDK().listCommand(nCardNo, eRTC6MockCommandType::Nop);
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_activate_fly_2d(uint32_t nCardNo, const double dScaleX, const double dScaleY)
+{
+	getMockSDK().listCommand(nCardNo, eRTC6MockCommandType::Nop);
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_activate_fly_2d_encoder(uint32_t nCardNo, const double dScaleX, const double dScaleY, int32_t nEncoderOffsetX, int32_t nEncoderOffsetY)
+{
+	getMockSDK().listCommand(nCardNo, eRTC6MockCommandType::Nop);
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_wait_for_encoder(uint32_t nCardNo, int32_t nValue, uint32_t nEncoderNo)
+{
+	getMockSDK().listCommand(nCardNo, eRTC6MockCommandType::Nop);
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_wait_for_encoder_mode(uint32_t nCardNo, int32_t nValue, uint32_t nEncoderNo, int32_t nMode)
+{
+	getMockSDK().listCommand(nCardNo, eRTC6MockCommandType::Nop);
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_set_fly_limits(uint32_t nCardNo, int32_t nXMin, int32_t nXMax, int32_t nYMin, int32_t nYMax)
+{
+	getMockSDK().listCommand(nCardNo, eRTC6MockCommandType::Nop);
+}
+
+/*************************************************************************************************************************
+ Data recording
+**************************************************************************************************************************/
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_set_trigger(uint32_t nCardNo, uint32_t nPeriod, uint32_t nSignal1, uint32_t nSignal2)
+{
+	CRTC6MockCardAccess card(nCardNo);
+	if (card.get() != nullptr)
+		card.get()->addTrigger(nPeriod, { nSignal1, nSignal2, 0, 0, 0, 0, 0, 0 });
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_set_trigger4(uint32_t nCardNo, uint32_t nPeriod, uint32_t nSignal1, uint32_t nSignal2, uint32_t nSignal3, uint32_t nSignal4)
+{
+	CRTC6MockCardAccess card(nCardNo);
+	if (card.get() != nullptr)
+		card.get()->addTrigger(nPeriod, { nSignal1, nSignal2, nSignal3, nSignal4, 0, 0, 0, 0 });
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_set_trigger8(uint32_t nCardNo, uint32_t nPeriod, uint32_t nSignal1, uint32_t nSignal2, uint32_t nSignal3, uint32_t nSignal4, uint32_t nSignal5, uint32_t nSignal6, uint32_t nSignal7, uint32_t nSignal8)
+{
+	CRTC6MockCardAccess card(nCardNo);
+	if (card.get() != nullptr)
+		card.get()->addTrigger(nPeriod, { nSignal1, nSignal2, nSignal3, nSignal4, nSignal5, nSignal6, nSignal7, nSignal8 });
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_measurement_status(uint32_t nCardNo, uint32_t* pnBusy, uint32_t* pnPos)
+{
+	CRTC6MockCardAccess card(nCardNo);
+	if (card.get() != nullptr) {
+		card.get()->getMeasurementStatus(pnBusy, pnPos);
+	}
+	else {
+		if (pnBusy != nullptr)
+			*pnBusy = 0;
+		if (pnPos != nullptr)
+			*pnPos = 0;
+	}
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_get_waveform_offset(uint32_t nCardNo, uint32_t nChannel, uint32_t nOffset, uint32_t nNumber, int32_t* pPtr)
+{
+	CRTC6MockCardAccess card(nCardNo);
+	if (card.get() != nullptr)
+		card.get()->getWaveform(nChannel, nOffset, nNumber, pPtr);
+}
+
+RTC6MOCK_EXPORT int32_t SCANLAB_CALLINGCONVENTION n_get_value(uint32_t nCardNo, uint32_t nSignalNo)
+{
+	CRTC6MockCardAccess card(nCardNo);
+	return (card.get() != nullptr) ? card.get()->getValue(nSignalNo) : 0;
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_set_free_variable(uint32_t nCardNo, uint32_t nVarNo, uint32_t nValue)
+{
+	CRTC6MockCardAccess card(nCardNo);
+	if (card.get() != nullptr)
+		card.get()->setFreeVariable(nVarNo, nValue);
+}
+
+RTC6MOCK_EXPORT uint32_t SCANLAB_CALLINGCONVENTION n_get_free_variable(uint32_t nCardNo, uint32_t nVarNo)
+{
+	CRTC6MockCardAccess card(nCardNo);
+	return (card.get() != nullptr) ? card.get()->getFreeVariable(nVarNo) : 0;
+}
+
+RTC6MOCK_EXPORT uint32_t SCANLAB_CALLINGCONVENTION n_get_marking_info(uint32_t nCardNo)
+{
+	CRTC6MockCardAccess card(nCardNo);
+	return 0;
+}
+
+/*************************************************************************************************************************
+ Control commands without simulated effect
+**************************************************************************************************************************/
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_select_cor_table(uint32_t nCardNo, uint32_t nHeadA, uint32_t nHeadB)
+{
+	getMockSDK().controlCommand(nCardNo);
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_set_laser_mode(uint32_t nCardNo, uint32_t nMode)
+{
+	getMockSDK().controlCommand(nCardNo);
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_set_laser_control(uint32_t nCardNo, uint32_t nControl)
+{
+	getMockSDK().controlCommand(nCardNo);
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_set_auto_laser_control(uint32_t nCardNo, uint32_t nControl, uint32_t nValue, uint32_t nMode, uint32_t nMinValue, uint32_t nMaxValue)
+{
+	getMockSDK().controlCommand(nCardNo);
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_set_standby(uint32_t nCardNo, uint32_t nHalfPeriod, uint32_t nPulseLength)
+{
+	getMockSDK().controlCommand(nCardNo);
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_write_io_port(uint32_t nCardNo, uint32_t nValue)
+{
+	getMockSDK().controlCommand(nCardNo);
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_write_8bit_port(uint32_t nCardNo, uint32_t nValue)
+{
+	getMockSDK().controlCommand(nCardNo);
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_write_da_1(uint32_t nCardNo, uint32_t nValue)
+{
+	getMockSDK().controlCommand(nCardNo);
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_write_da_2(uint32_t nCardNo, uint32_t nValue)
+{
+	getMockSDK().controlCommand(nCardNo);
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_write_da_x(uint32_t nCardNo, uint32_t nX, uint32_t nValue)
+{
+	getMockSDK().controlCommand(nCardNo);
+}
+
+RTC6MOCK_EXPORT uint32_t SCANLAB_CALLINGCONVENTION n_set_mcbsp_freq(uint32_t nCardNo, uint32_t nFrequency)
+{
+	getMockSDK().controlCommand(nCardNo);
+	return nFrequency;
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_mcbsp_init(uint32_t nCardNo, uint32_t nXDelay, uint32_t nYDelay)
+{
+	getMockSDK().controlCommand(nCardNo);
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_mcbsp_init_spi(uint32_t nCardNo, uint32_t nClockLevel, uint32_t nClockDelay)
+{
+	getMockSDK().controlCommand(nCardNo);
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_set_mcbsp_out_ptr(uint32_t nCardNo, uint32_t nNumber, void* pSignalPtr)
+{
+	getMockSDK().controlCommand(nCardNo);
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_set_mcbsp_out_oie_ctrl(uint32_t nCardNo, uint32_t nSignalID1, uint32_t nSignalID2)
+{
+	getMockSDK().controlCommand(nCardNo);
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_set_multi_mcbsp_in(uint32_t nCardNo, uint32_t nCtrl, uint32_t nP, uint32_t nMode)
+{
+	getMockSDK().controlCommand(nCardNo);
+}
+
+RTC6MOCK_EXPORT int32_t SCANLAB_CALLINGCONVENTION n_read_multi_mcbsp(uint32_t nCardNo, uint32_t nRegisterNo)
+{
+	getMockSDK().controlCommand(nCardNo);
+	return 0;
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_set_control_mode(uint32_t nCardNo, uint32_t nMode)
+{
+	getMockSDK().controlCommand(nCardNo);
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_set_laser_pulses_ctrl(uint32_t nCardNo, uint32_t nHalfPeriod, uint32_t nPulseLength)
+{
+	getMockSDK().controlCommand(nCardNo);
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_set_mark_speed_ctrl(uint32_t nCardNo, double dSpeed)
+{
+	getMockSDK().controlCommand(nCardNo);
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_set_jump_speed_ctrl(uint32_t nCardNo, double dSpeed)
+{
+	getMockSDK().controlCommand(nCardNo);
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_set_firstpulse_killer(uint32_t nCardNo, uint32_t nLength)
+{
+	getMockSDK().controlCommand(nCardNo);
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_set_qswitch_delay(uint32_t nCardNo, uint32_t nDelay)
+{
+	getMockSDK().controlCommand(nCardNo);
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_set_laser_pin_out(uint32_t nCardNo, uint32_t nPins)
+{
+	getMockSDK().controlCommand(nCardNo);
+}
+
+RTC6MOCK_EXPORT uint32_t SCANLAB_CALLINGCONVENTION n_get_laser_pin_in(uint32_t nCardNo)
+{
+	getMockSDK().controlCommand(nCardNo);
+	return 0;
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_set_sky_writing_para(uint32_t nCardNo, double dTimelag, int32_t nLaserOnShift, uint32_t nNprev, uint32_t nNPost)
+{
+	getMockSDK().controlCommand(nCardNo);
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_set_sky_writing_limit(uint32_t nCardNo, double dCosAngle)
+{
+	getMockSDK().controlCommand(nCardNo);
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_set_sky_writing_mode(uint32_t nCardNo, uint32_t nMode)
+{
+	getMockSDK().controlCommand(nCardNo);
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_set_sky_writing(uint32_t nCardNo, double dTimelag, int32_t nLaserOnShift)
+{
+	getMockSDK().controlCommand(nCardNo);
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_control_command(uint32_t nCardNo, uint32_t nHead, uint32_t nAxis, uint32_t nData)
+{
+	getMockSDK().controlCommand(nCardNo);
+}
+
+RTC6MOCK_EXPORT uint32_t SCANLAB_CALLINGCONVENTION n_get_scanahead_params(uint32_t nCardNo, uint32_t nHead, uint32_t* pPreViewTime, uint32_t* pVmax, double* pAmax)
+{
+	getMockSDK().controlCommand(nCardNo);
+	if (pPreViewTime != nullptr)
+		*pPreViewTime = 0;
+	if (pVmax != nullptr)
+		*pVmax = 0;
+	if (pAmax != nullptr)
+		*pAmax = 0.0;
+	return RTC6MOCK_ERROR_NOERROR;
+}
+
+RTC6MOCK_EXPORT int32_t SCANLAB_CALLINGCONVENTION n_activate_scanahead_autodelays(uint32_t nCardNo, int32_t nMode)
+{
+	getMockSDK().controlCommand(nCardNo);
+	return nMode;
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_set_scanahead_laser_shifts(uint32_t nCardNo, int32_t nDLasOn, int32_t nDLasOff)
+{
+	getMockSDK().controlCommand(nCardNo);
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_set_scanahead_line_params(uint32_t nCardNo, uint32_t nCornerScale, uint32_t nEndScale, uint32_t nAccScale)
+{
+	getMockSDK().controlCommand(nCardNo);
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_set_scanahead_line_params_ex(uint32_t nCardNo, uint32_t nCornerScale, uint32_t nEndScale, uint32_t nAccScale, uint32_t nJumpScale)
+{
+	getMockSDK().controlCommand(nCardNo);
+}
+
+RTC6MOCK_EXPORT uint32_t SCANLAB_CALLINGCONVENTION n_set_scanahead_params(uint32_t nCardNo, uint32_t nMode, uint32_t nHeadNo, uint32_t nTableNo, uint32_t nPreviewTime, uint32_t nVMax, double dAmax)
+{
+	getMockSDK().controlCommand(nCardNo);
+	return RTC6MOCK_ERROR_NOERROR;
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_set_scanahead_speed_control(uint32_t nCardNo, uint32_t nMode)
+{
+	getMockSDK().controlCommand(nCardNo);
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_set_angle(uint32_t nCardNo, uint32_t nHeadNo, double dAngle, uint32_t nAtOnce)
+{
+	getMockSDK().controlCommand(nCardNo);
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_set_scale(uint32_t nCardNo, uint32_t nHeadNo, double dScaleFactor, uint32_t nAtOnce)
+{
+	getMockSDK().controlCommand(nCardNo);
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_set_offset(uint32_t nCardNo, uint32_t nHeadNo, int32_t nXOffset, int32_t nYOffset, uint32_t nAtOnce)
+{
+	getMockSDK().controlCommand(nCardNo);
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_set_matrix(uint32_t nCardNo, uint32_t nHeadNo, double dM11, double dM12, double dM21, double dM22, uint32_t nAtOnce)
+{
+	getMockSDK().controlCommand(nCardNo);
+}
+
+RTC6MOCK_EXPORT uint32_t SCANLAB_CALLINGCONVENTION transform(int32_t* pSignal1, int32_t* pSignal2, uint8_t* pTransform, uint32_t nCode)
+{
+	// The simulated scan head reports positions in target coordinates already
+	return RTC6MOCK_ERROR_NOERROR;
+}
+
+RTC6MOCK_EXPORT uint32_t SCANLAB_CALLINGCONVENTION n_upload_transform(uint32_t nCardNo, uint32_t nHeadNo, uint8_t* pTransformData)
+{
+	getMockSDK().controlCommand(nCardNo);
+	return RTC6MOCK_ERROR_NOERROR;
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_set_timelag_compensation(uint32_t nCardNo, uint32_t nHeadNo, uint32_t nTimelagXY, uint32_t nTimelagZ)
+{
+	getMockSDK().controlCommand(nCardNo);
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_init_fly_2d(uint32_t nCardNo, int32_t nOffsetX, int32_t nOffsetY, uint32_t nNo)
+{
+	getMockSDK().controlCommand(nCardNo);
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_get_fly_2d_offset(uint32_t nCardNo, const int32_t* pOffsetX, const int32_t* pOffsetY)
+{
+	getMockSDK().controlCommand(nCardNo);
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_get_encoder(uint32_t nCardNo, const int32_t* pEncoderX, const int32_t* pEncoderY)
+{
+	getMockSDK().controlCommand(nCardNo);
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_range_checking(uint32_t nCardNo, uint32_t nHeadNo, uint32_t nMode, uint32_t nData)
+{
+	getMockSDK().controlCommand(nCardNo);
+}
+
+RTC6MOCK_EXPORT uint32_t SCANLAB_CALLINGCONVENTION n_uart_config(uint32_t nCardNo, uint32_t nBaudRate)
+{
+	getMockSDK().controlCommand(nCardNo);
+	return nBaudRate;
+}
+
+RTC6MOCK_EXPORT void SCANLAB_CALLINGCONVENTION n_rs232_write_data(uint32_t nCardNo, uint32_t nData)
+{
+	getMockSDK().controlCommand(nCardNo);
+}
+
+RTC6MOCK_EXPORT uint32_t SCANLAB_CALLINGCONVENTION n_rs232_read_data(uint32_t nCardNo)
+{
+	getMockSDK().controlCommand(nCardNo);
+	return 0;
+}
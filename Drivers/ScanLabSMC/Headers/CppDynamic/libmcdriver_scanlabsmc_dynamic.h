@@ -374,6 +374,24 @@ typedef LibMCDriver_ScanLabSMCResult (*PLibMCDriver_ScanLabSMCSMCConfiguration_S
 */
 typedef LibMCDriver_ScanLabSMCResult (*PLibMCDriver_ScanLabSMCSMCConfiguration_GetSendToHardwarePtr) (LibMCDriver_ScanLabSMC_SMCConfiguration pSMCConfiguration, bool * pSendToHardware);
 
+/**
+* Sets the number of threads that parse simulation and log record files. Default is 1, which parses on the calling thread only.
+*
+* @param[in] pSMCConfiguration - SMCConfiguration instance.
+* @param[in] nThreadCount - Number of parser threads. MUST be between 1 and 8.
+* @return error code or 0 (success)
+*/
+typedef LibMCDriver_ScanLabSMCResult (*PLibMCDriver_ScanLabSMCSMCConfiguration_SetParserThreadCountPtr) (LibMCDriver_ScanLabSMC_SMCConfiguration pSMCConfiguration, LibMCDriver_ScanLabSMC_uint32 nThreadCount);
+
+/**
+* Returns the number of threads that parse simulation and log record files.
+*
+* @param[in] pSMCConfiguration - SMCConfiguration instance.
+* @param[out] pThreadCount - Number of parser threads.
+* @return error code or 0 (success)
+*/
+typedef LibMCDriver_ScanLabSMCResult (*PLibMCDriver_ScanLabSMCSMCConfiguration_GetParserThreadCountPtr) (LibMCDriver_ScanLabSMC_SMCConfiguration pSMCConfiguration, LibMCDriver_ScanLabSMC_uint32 * pThreadCount);
+
 /**
 * Sets the RTC Serial number. MUST be larger than 0.
 *
@@ -898,6 +916,8 @@ typedef struct {
 	PLibMCDriver_ScanLabSMCSMCConfiguration_GetBlendModePtr m_SMCConfiguration_GetBlendMode;
 	PLibMCDriver_ScanLabSMCSMCConfiguration_SetSendToHardwarePtr m_SMCConfiguration_SetSendToHardware;
 	PLibMCDriver_ScanLabSMCSMCConfiguration_GetSendToHardwarePtr m_SMCConfiguration_GetSendToHardware;
+	PLibMCDriver_ScanLabSMCSMCConfiguration_SetParserThreadCountPtr m_SMCConfiguration_SetParserThreadCount;
+	PLibMCDriver_ScanLabSMCSMCConfiguration_GetParserThreadCountPtr m_SMCConfiguration_GetParserThreadCount;
 	PLibMCDriver_ScanLabSMCSMCConfiguration_SetSerialNumberPtr m_SMCConfiguration_SetSerialNumber;
 	PLibMCDriver_ScanLabSMCSMCConfiguration_GetSerialNumberPtr m_SMCConfiguration_GetSerialNumber;
 	PLibMCDriver_ScanLabSMCSMCConfiguration_SetIPAddressPtr m_SMCConfiguration_SetIPAddress;
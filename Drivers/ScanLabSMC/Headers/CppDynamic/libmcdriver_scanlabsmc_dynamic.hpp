@@ -246,6 +246,7 @@ public:
 			case LIBMCDRIVER_SCANLABSMC_ERROR_INVALIDMAXPOWERVALUE: return "INVALIDMAXPOWERVALUE";
 			case LIBMCDRIVER_SCANLABSMC_ERROR_SIMULATIONWORKINGFILEISNOTINITIALIZED: return "SIMULATIONWORKINGFILEISNOTINITIALIZED";
 			case LIBMCDRIVER_SCANLABSMC_ERROR_SIMULATIONWORKINGFILESIZEMISMATCH: return "SIMULATIONWORKINGFILESIZEMISMATCH";
+			case LIBMCDRIVER_SCANLABSMC_ERROR_INVALIDPARSERTHREADCOUNT: return "INVALIDPARSERTHREADCOUNT";
 		}
 		return "UNKNOWN";
 	}
@@ -322,6 +323,7 @@ public:
 			case LIBMCDRIVER_SCANLABSMC_ERROR_INVALIDMAXPOWERVALUE: return "Invalid max power value.";
 			case LIBMCDRIVER_SCANLABSMC_ERROR_SIMULATIONWORKINGFILEISNOTINITIALIZED: return "Simulation working file is not initialized.";
 			case LIBMCDRIVER_SCANLABSMC_ERROR_SIMULATIONWORKINGFILESIZEMISMATCH: return "Simulation working file size mismatch.";
+			case LIBMCDRIVER_SCANLABSMC_ERROR_INVALIDPARSERTHREADCOUNT: return "Invalid parser thread count.";
 		}
 		return "unknown error";
 	}
@@ -587,6 +589,8 @@ public:
 	inline eBlendMode GetBlendMode();
 	inline void SetSendToHardware(const bool bSendToHardware);
 	inline bool GetSendToHardware();
+	inline void SetParserThreadCount(const LibMCDriver_ScanLabSMC_uint32 nThreadCount);
+	inline LibMCDriver_ScanLabSMC_uint32 GetParserThreadCount();
 	inline void SetSerialNumber(const LibMCDriver_ScanLabSMC_uint32 nValue);
 	inline LibMCDriver_ScanLabSMC_uint32 GetSerialNumber();
 	inline void SetIPAddress(const std::string & sValue);
@@ -816,6 +820,8 @@ public:
 		pWrapperTable->m_SMCConfiguration_GetBlendMode = nullptr;
 		pWrapperTable->m_SMCConfiguration_SetSendToHardware = nullptr;
 		pWrapperTable->m_SMCConfiguration_GetSendToHardware = nullptr;
+		pWrapperTable->m_SMCConfiguration_SetParserThreadCount = nullptr;
+		pWrapperTable->m_SMCConfiguration_GetParserThreadCount = nullptr;
 		pWrapperTable->m_SMCConfiguration_SetSerialNumber = nullptr;
 		pWrapperTable->m_SMCConfiguration_GetSerialNumber = nullptr;
 		pWrapperTable->m_SMCConfiguration_SetIPAddress = nullptr;
@@ -1202,6 +1208,24 @@ public:
 		if (pWrapperTable->m_SMCConfiguration_GetSendToHardware == nullptr)
 			return LIBMCDRIVER_SCANLABSMC_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		#ifdef _WIN32
+		pWrapperTable->m_SMCConfiguration_SetParserThreadCount = (PLibMCDriver_ScanLabSMCSMCConfiguration_SetParserThreadCountPtr) GetProcAddress(hLibrary, "libmcdriver_scanlabsmc_smcconfiguration_setparserthreadcount");
+		#else // _WIN32
+		pWrapperTable->m_SMCConfiguration_SetParserThreadCount = (PLibMCDriver_ScanLabSMCSMCConfiguration_SetParserThreadCountPtr) dlsym(hLibrary, "libmcdriver_scanlabsmc_smcconfiguration_setparserthreadcount");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_SMCConfiguration_SetParserThreadCount == nullptr)
+			return LIBMCDRIVER_SCANLABSMC_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_SMCConfiguration_GetParserThreadCount = (PLibMCDriver_ScanLabSMCSMCConfiguration_GetParserThreadCountPtr) GetProcAddress(hLibrary, "libmcdriver_scanlabsmc_smcconfiguration_getparserthreadcount");
+		#else // _WIN32
+		pWrapperTable->m_SMCConfiguration_GetParserThreadCount = (PLibMCDriver_ScanLabSMCSMCConfiguration_GetParserThreadCountPtr) dlsym(hLibrary, "libmcdriver_scanlabsmc_smcconfiguration_getparserthreadcount");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_SMCConfiguration_GetParserThreadCount == nullptr)
+			return LIBMCDRIVER_SCANLABSMC_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		#ifdef _WIN32
 		pWrapperTable->m_SMCConfiguration_SetSerialNumber = (PLibMCDriver_ScanLabSMCSMCConfiguration_SetSerialNumberPtr) GetProcAddress(hLibrary, "libmcdriver_scanlabsmc_smcconfiguration_setserialnumber");
 		#else // _WIN32
@@ -1778,6 +1802,14 @@ public:
 		if ( (eLookupError != 0) || (pWrapperTable->m_SMCConfiguration_GetSendToHardware == nullptr) )
 			return LIBMCDRIVER_SCANLABSMC_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		eLookupError = (*pLookup)("libmcdriver_scanlabsmc_smcconfiguration_setparserthreadcount", (void**)&(pWrapperTable->m_SMCConfiguration_SetParserThreadCount));
+		if ( (eLookupError != 0) || (pWrapperTable->m_SMCConfiguration_SetParserThreadCount == nullptr) )
+			return LIBMCDRIVER_SCANLABSMC_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libmcdriver_scanlabsmc_smcconfiguration_getparserthreadcount", (void**)&(pWrapperTable->m_SMCConfiguration_GetParserThreadCount));
+		if ( (eLookupError != 0) || (pWrapperTable->m_SMCConfiguration_GetParserThreadCount == nullptr) )
+			return LIBMCDRIVER_SCANLABSMC_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		eLookupError = (*pLookup)("libmcdriver_scanlabsmc_smcconfiguration_setserialnumber", (void**)&(pWrapperTable->m_SMCConfiguration_SetSerialNumber));
 		if ( (eLookupError != 0) || (pWrapperTable->m_SMCConfiguration_SetSerialNumber == nullptr) )
 			return LIBMCDRIVER_SCANLABSMC_ERROR_COULDNOTFINDLIBRARYEXPORT;
@@ -2348,6 +2380,27 @@ public:
 		return resultSendToHardware;
 	}
 	
+	/**
+	* CSMCConfiguration::SetParserThreadCount - Sets the number of threads that parse simulation and log record files. Default is 1, which parses on the calling thread only.
+	* @param[in] nThreadCount - Number of parser threads. MUST be between 1 and 8.
+	*/
+	void CSMCConfiguration::SetParserThreadCount(const LibMCDriver_ScanLabSMC_uint32 nThreadCount)
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_SMCConfiguration_SetParserThreadCount(m_pHandle, nThreadCount));
+	}
+	
+	/**
+	* CSMCConfiguration::GetParserThreadCount - Returns the number of threads that parse simulation and log record files.
+	* @return Number of parser threads.
+	*/
+	LibMCDriver_ScanLabSMC_uint32 CSMCConfiguration::GetParserThreadCount()
+	{
+		LibMCDriver_ScanLabSMC_uint32 resultThreadCount = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_SMCConfiguration_GetParserThreadCount(m_pHandle, &resultThreadCount));
+		
+		return resultThreadCount;
+	}
+	
 	/**
 	* CSMCConfiguration::SetSerialNumber - Sets the RTC Serial number. MUST be larger than 0.
 	* @param[in] nValue - Value to set.
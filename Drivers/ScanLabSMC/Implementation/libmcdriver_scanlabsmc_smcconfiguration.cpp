@@ -52,7 +52,8 @@ CSMCConfiguration::CSMCConfiguration(LibMCEnv::PDriverEnvironment pDriverEnviron
      m_WarnLevel (LibMCDriver_ScanLabSMC::eWarnLevel::Error),
     m_nSerialNumber (0),
     m_BlendMode (LibMCDriver_ScanLabSMC::eBlendMode::Deactivated),
-    m_bSendToHardware (false)
+    m_bSendToHardware (false),
+    m_nParserThreadCount (SCANLABSMC_PARSERDEFAULTTHREADCOUNT)
 
 {
     if (pDriverEnvironment.get() == nullptr)
@@ -112,6 +113,19 @@ bool CSMCConfiguration::GetSendToHardware()
     return m_bSendToHardware;
 }
 
+void CSMCConfiguration::SetParserThreadCount(const LibMCDriver_ScanLabSMC_uint32 nThreadCount)
+{
+    if ((nThreadCount < 1) || (nThreadCount > SCANLABSMC_PARSERMAXTHREADCOUNT))
+        throw ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_INVALIDPARSERTHREADCOUNT, "invalid parser thread count: " + std::to_string(nThreadCount));
+
+    m_nParserThreadCount = nThreadCount;
+}
+
+LibMCDriver_ScanLabSMC_uint32 CSMCConfiguration::GetParserThreadCount()
+{
+    return m_nParserThreadCount;
+}
+
 
 std::string CSMCConfiguration::GetIPAddress()
 {
@@ -39,6 +39,7 @@ Abstract: This is the class declaration of CSMCConfiguration
 
 // Parent classes
 #include "libmcdriver_scanlabsmc_base.hpp"
+#include "libmcdriver_scanlabsmc_smcparserworkerpool.hpp"
 #ifdef _MSC_VER
 #pragma warning(push)
 #pragma warning(disable : 4250)
@@ -78,6 +79,8 @@ private:
 
     bool m_bSendToHardware;
 
+    uint32_t m_nParserThreadCount;
+
 public:
 
     CSMCConfiguration(LibMCEnv::PDriverEnvironment pDriverEnvironment);
@@ -102,6 +105,10 @@ public:
 
     bool GetSendToHardware() override;
 
+    void SetParserThreadCount(const LibMCDriver_ScanLabSMC_uint32 nThreadCount) override;
+
+    LibMCDriver_ScanLabSMC_uint32 GetParserThreadCount() override;
+
 	std::string GetIPAddress() override;
 
 	void SetCorrectionFile(const LibMCDriver_ScanLabSMC_uint64 nCorrectionFileDataBufferSize, const LibMCDriver_ScanLabSMC_uint8* pCorrectionFileDataBuffer) override;
@@ -117,6 +117,8 @@ CSMCContextInstance::CSMCContextInstance(const std::string& sContextName, ISMCCo
 
 	m_bSendToHardware = pSMCConfiguration->GetSendToHardware();	
 
+	m_pParserWorkerPool = std::make_shared<CSMCParserWorkerPool>(pSMCConfiguration->GetParserThreadCount());
+
 	eSMCConfigVersion configVersion = eSMCConfigVersion::Unknown;
 	auto versionInfo = m_pSDK->slsc_cfg_get_scanmotioncontrol_version();
 	std::string sVersionString = std::to_string(versionInfo.m_nMajor) + "." + std::to_string(versionInfo.m_nMinor) + "." + std::to_string(versionInfo.m_nRevision);
@@ -232,7 +234,7 @@ std::string CSMCContextInstance::GetSimulationSubDirectory()
 
 PSMCJobInstance CSMCContextInstance::BeginJob(const double dStartPositionX, const double dStartPositionY, const double dMaxPowerInWatts)
 {
-	return std::make_shared<CSMCJobInstance> (m_pContextHandle, dStartPositionX, dStartPositionY, m_pWorkingDirectory, m_sSimulationSubDirectory, m_bSendToHardware, dMaxPowerInWatts);
+	return std::make_shared<CSMCJobInstance> (m_pContextHandle, dStartPositionX, dStartPositionY, m_pWorkingDirectory, m_sSimulationSubDirectory, m_bSendToHardware, dMaxPowerInWatts, m_pParserWorkerPool);
 }
 
 PSMCJobInstance CSMCContextInstance::GetUnfinishedJob()
@@ -66,6 +66,9 @@ private:
 
 	bool m_bSendToHardware;
 
+	// Shared by the simulation and log record parsers of all jobs
+	PSMCParserWorkerPool m_pParserWorkerPool;
+
 public:
 
 	CSMCContextInstance(const std::string & sContextName, ISMCConfiguration* pSMCConfiguration, PScanLabSMCSDK pSDK, LibMCEnv::PDriverEnvironment pDriverEnvironment, const std::string & sRTCDLLDirectory);
@@ -34,430 +34,368 @@ Abstract: This is the class definition of CSMCCSVParser
 #include "libmcdriver_scanlabsmc_smccsvparser.hpp"
 #include "libmcdriver_scanlabsmc_interfaceexception.hpp"
 
-#include <fstream>
 #include <stdexcept>
 #include <charconv>
-#include <string_view>
-#include <ctime>
 #include <cmath>
+#include <algorithm>
 
-#include <cctype> // for std::tolower
-#include <iostream>
+#include <cctype>
 
 using namespace LibMCDriver_ScanLabSMC::Impl;
 
-CSMCCSVParser::CSMCCSVParser(const std::string& sAbsoluteFileNameUTF8, char delimiter)
-    : m_delimiter(delimiter)
+CSMCCSVParser::CSMCCSVParser(const std::string& sAbsoluteFileNameUTF8, char delimiter, PSMCParserWorkerPool pWorkerPool)
+    : m_delimiter(delimiter), m_pWorkerPool(pWorkerPool)
 {
-
-#ifdef _WIN32
-    if (sAbsoluteFileNameUTF8.length() > 65536)
+    if (pWorkerPool.get() == nullptr)
         throw ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_INVALIDPARAM);
 
-    int nLength = (int)sAbsoluteFileNameUTF8.length();
-    int nBufferSize = nLength * 2 + 2;
-    std::vector<wchar_t> wsLibraryFileName(nBufferSize);
-    int nResult = MultiByteToWideChar(CP_UTF8, 0, sAbsoluteFileNameUTF8.c_str(), nLength, &wsLibraryFileName[0], nBufferSize);
-    if (nResult == 0)
-        throw ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_INVALIDSIMULATIONFILENAME);
-
-    std::ifstream file(wsLibraryFileName.data(), std::ios::binary);
-#else
-    std::ifstream file(sAbsoluteFileNameUTF8, std::ios::binary);
-#endif
-
-    if (!file.is_open())
-        throw ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_COULDNOTOOPENSIMULATIONFILE);
-
-    file.seekg(0, std::ios::end);
-    std::streamsize size = file.tellg();
-    file.seekg(0, std::ios::beg);
-
-    m_fileBuff.resize(static_cast<size_t>(size));
-    if (!file.read(m_fileBuff.data(), size)) {
-        throw ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_COULDNOTREADSIMULATIONFILE);
-    }
+    m_pFile = std::make_shared<CSMCMappedFile>(sAbsoluteFileNameUTF8);
 }
 
 void CSMCCSVParser::Parse(const std::vector<FieldBinding>& field_bindings)
 {
-    const char* data = m_fileBuff.data();
-    const char* end = data + m_fileBuff.size();
+    m_columns.clear();
+    m_timestamps.clear();
+    m_timestampColumn.clear();
+    m_valueSlotCount = 0;
+    m_laserSlotCount = 0;
+    m_nextTimestamp = 0.0;
+    m_prevTsIdx = 0;
+    m_currTsIdx = 0;
+    m_rowCount = 0;
+
+    for (auto& binding : field_bindings) {
+        ColumnData columnData;
+        columnData.meta = binding.meta;
+        columnData.column = binding.column;
+        columnData.valueSlot = 0;
+        columnData.laserSlot = 0;
+
+        switch (binding.meta.type) {
+        case FieldParserType::None:
+            break;
+        case FieldParserType::Timestamp:
+            m_timestampColumn = binding.column;
+            columnData.meta.type = FieldParserType::None;
+            break;
+        case FieldParserType::Int:
+        case FieldParserType::UInt32:
+        case FieldParserType::Double:
+            columnData.valueSlot = m_valueSlotCount++;
+            break;
+        case FieldParserType::LaserSignal:
+            columnData.laserSlot = m_laserSlotCount++;
+            break;
+        default:
+            throw ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_CSVPARSERUNKNOWNFIELDPARSERTYPE);
+        }
 
-    const char* lineStart = data;
-    const char* ptr = data;
+        // Unbound fields are not parsed at all
+        if (columnData.column.empty())
+            columnData.meta.type = FieldParserType::None;
 
-    double timestamp = 0.0;
+        m_columns.push_back(columnData);
+    }
 
-    size_t prevTsIdx = 0;
-    size_t currTsIdx = 0;
+    // Files of several hundred MB result in a few thousand rows per chunk. Only a few batches of chunks
+    // are held in tokenized form at a time, so memory usage stays bounded by the resulting columns.
+    std::vector<sSMCFileChunk> chunks;
+    m_pFile->splitIntoChunks(0, ChunkSize, chunks);
 
-    std::vector<ParserFunc> parsers;
-    std::vector<ExtenderFunc> extenders;
-    std::vector<InterpolatorFunc> interpolators;
+    size_t nBatchSize = (size_t)m_pWorkerPool->getThreadCount() * 2;
+    std::vector<ChunkTokens> batchTokens;
 
-    void* ts_target = nullptr;
+    for (size_t nBatchStart = 0; nBatchStart < chunks.size(); nBatchStart += nBatchSize) {
+        size_t nBatchCount = std::min(nBatchSize, chunks.size() - nBatchStart);
 
-    for (size_t i = 0; i < field_bindings.size(); ++i) {
-        if (field_bindings[i].meta.type == FieldParserType::Timestamp)
-            ts_target = field_bindings[i].target;
-        else {
-            parsers.push_back(GetParser(field_bindings[i].meta.type));
-            extenders.push_back(GetExtender(field_bindings[i].meta.type));
-            interpolators.push_back(GetInterpolator(field_bindings[i].meta.type));
-        }
-    }
+        batchTokens.clear();
+        batchTokens.resize(nBatchCount);
 
-    while (ptr < end) {
-        const char* lineEnd = nullptr;
-        bool isLineEnd = false;
+        m_pWorkerPool->processInParallel(nBatchCount, [this, &chunks, &batchTokens, nBatchStart](size_t nIndex) {
+            TokenizeChunk(chunks.at(nBatchStart + nIndex), batchTokens.at(nIndex));
+        });
 
-        if (*ptr == '\r') {
-            if ((ptr + 1 < end) && *(ptr + 1) == '\n') {
-                lineEnd = ptr;
-                ptr += 2;
-            }
-            else {
-                lineEnd = ptr;
-                ptr += 1;
-            }
-            isLineEnd = true;
-        }
-        else if (*ptr == '\n') {
-            lineEnd = ptr;
-            ptr += 1;
-            isLineEnd = true;
-        }
-        else if (ptr == end - 1) {
-            lineEnd = ptr + 1;
-            ++ptr;
-            isLineEnd = true;
-        }
-        else {
-            ++ptr;
-        }
+        for (auto& tokens : batchTokens)
+            MergeChunk(tokens);
+    }
+}
 
-        if (isLineEnd) {
-            size_t lineLength = lineEnd - lineStart;
+size_t CSMCCSVParser::GetTimestampCount() const
+{
+    return m_timestamps.size();
+}
 
-            if (lineLength > 0 && *lineStart == '#') {
-                ParseComment(lineStart, lineLength);
-            }
-            else if (lineLength > 0) {
-                const char* fieldStart = lineStart;
-                size_t fieldLength = 0;
-                size_t parserIndex = 0;
+const std::vector<double>& CSMCCSVParser::GetTimestamps() const
+{
+    return m_timestamps;
+}
 
-                PushTimestamp(ts_target, timestamp);
+const CSMCCSVParser::ColumnData& CSMCCSVParser::FindColumn(const std::string& sColumn, FieldParserType type1, FieldParserType type2) const
+{
+    for (auto& columnData : m_columns) {
+        if ((columnData.column == sColumn) && ((columnData.meta.type == type1) || (columnData.meta.type == type2)))
+            return columnData;
+    }
+
+    throw ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_INVALIDPARAM, "column not found: " + sColumn);
+}
 
-                prevTsIdx = currTsIdx;
+const std::vector<double>& CSMCCSVParser::GetDoubleColumnValues(const std::string& sColumn) const
+{
+    return FindColumn(sColumn, FieldParserType::Double, FieldParserType::Double).doubleValues;
+}
 
-                auto vec_ts = static_cast<std::vector<double>*>(ts_target);
-                if (vec_ts)
-                    currTsIdx = vec_ts->size() - 1;
+const std::vector<int32_t>& CSMCCSVParser::GetInt32ColumnValues(const std::string& sColumn) const
+{
+    return FindColumn(sColumn, FieldParserType::Int, FieldParserType::Int).int32Values;
+}
 
-                timestamp += CSMCCSVParser::TimestampDefaultInc;
+const std::vector<uint32_t>& CSMCCSVParser::GetUint32ColumnValues(const std::string& sColumn) const
+{
+    return FindColumn(sColumn, FieldParserType::UInt32, FieldParserType::LaserSignal).uint32Values;
+}
 
-                const char* p = lineStart;
-                while (p <= lineEnd && parserIndex < parsers.size()) {
-                    if (p == lineEnd || *p == m_delimiter) {
-                        fieldLength = p - fieldStart;
+void CSMCCSVParser::WriteToDataTable(LibMCEnv::PDataTable pDataTable)
+{
+    if (pDataTable.get() == nullptr)
+        throw ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_INVALIDPARAM);
 
-                        if (parsers[parserIndex] && field_bindings[parserIndex].target) {
-                            parsers[parserIndex](fieldStart, fieldLength, field_bindings[parserIndex].target, ts_target);
-                        }
+    if (!m_timestampColumn.empty()) {
+        pDataTable->SetDoubleColumnValues(m_timestampColumn, m_timestamps);
+        std::vector<double>().swap(m_timestamps);
+    }
 
-                        ++parserIndex;
-                        fieldStart = p + 1;
-                    }
-                    ++p;
-                }
+    for (auto& columnData : m_columns) {
+        switch (columnData.meta.type) {
+        case FieldParserType::Int:
+            pDataTable->SetInt32ColumnValues(columnData.column, columnData.int32Values);
+            std::vector<int32_t>().swap(columnData.int32Values);
+            break;
+        case FieldParserType::UInt32:
+        case FieldParserType::LaserSignal:
+            pDataTable->SetUint32ColumnValues(columnData.column, columnData.uint32Values);
+            std::vector<uint32_t>().swap(columnData.uint32Values);
+            break;
+        case FieldParserType::Double:
+            pDataTable->SetDoubleColumnValues(columnData.column, columnData.doubleValues);
+            std::vector<double>().swap(columnData.doubleValues);
+            break;
+        default:
+            break;
+        }
+    }
+}
 
-                if (currTsIdx != prevTsIdx) {
-                    parserIndex = 0;
-                    while (parserIndex < extenders.size()) {
-                        if (interpolators[parserIndex] && field_bindings[parserIndex].target) {
-                            interpolators[parserIndex](prevTsIdx, currTsIdx, field_bindings[parserIndex].target, ts_target);
-                        }
-                        ++parserIndex;
+void CSMCCSVParser::TokenizeChunk(const sSMCFileChunk& chunk, ChunkTokens& tokens) const
+{
+    const char* end = chunk.m_pEnd;
+    const char* lineStart = chunk.m_pStart;
+
+    // Rows of a chunk are approximately equally long
+    size_t estimatedRowCount = ((size_t)(end - lineStart) / 64) + 1;
+    tokens.fieldCounts.reserve(estimatedRowCount);
+    tokens.values.reserve(estimatedRowCount * m_valueSlotCount);
+    tokens.laserCycleCounts.reserve(estimatedRowCount * m_laserSlotCount);
+
+    while (lineStart < end) {
+        const char* lineEnd = CSMCMappedFile::findLineEnd(lineStart, end);
+
+        // Empty lines and comment lines are skipped
+        if ((lineEnd > lineStart) && (*lineStart != '#')) {
+            size_t valueOffset = tokens.values.size();
+            size_t laserOffset = tokens.laserCycleCounts.size();
+            tokens.values.resize(valueOffset + m_valueSlotCount, 0.0);
+            tokens.laserCycleCounts.resize(laserOffset + m_laserSlotCount, 0);
+
+            const char* fieldStart = lineStart;
+            size_t fieldIndex = 0;
+
+            for (const char* p = lineStart; (p <= lineEnd) && (fieldIndex < m_columns.size()); ++p) {
+                if ((p == lineEnd) || (*p == m_delimiter)) {
+                    const char* fieldData = fieldStart;
+                    size_t fieldLength = p - fieldStart;
+                    auto& columnData = m_columns[fieldIndex];
+
+                    switch (columnData.meta.type) {
+                    case FieldParserType::Int:
+                        tokens.values[valueOffset + columnData.valueSlot] = (double)ParseValue<int32_t>(fieldData, fieldLength);
+                        break;
+                    case FieldParserType::UInt32:
+                        tokens.values[valueOffset + columnData.valueSlot] = (double)ParseValue<uint32_t>(fieldData, fieldLength);
+                        break;
+                    case FieldParserType::Double:
+                        tokens.values[valueOffset + columnData.valueSlot] = ParseValue<double>(fieldData, fieldLength);
+                        break;
+                    case FieldParserType::LaserSignal:
+                        tokens.laserCycleCounts[laserOffset + columnData.laserSlot] = (uint32_t)ParseLaserSignal(fieldData, fieldLength, tokens.laserCycles);
+                        break;
+                    default:
+                        break;
                     }
-                }
 
-                parserIndex = 0;
-                while (parserIndex < extenders.size()) {
-                    if (extenders[parserIndex] && field_bindings[parserIndex].target) {
-                        extenders[parserIndex](field_bindings[parserIndex].target, ts_target);
-                    }
-                    ++parserIndex;
+                    ++fieldIndex;
+                    fieldStart = p + 1;
                 }
-
-                ++m_rowCount;
             }
 
-            lineStart = ptr;
+            tokens.fieldCounts.push_back((uint32_t)fieldIndex);
+            tokens.rowCount++;
         }
-    }
-}
 
-void CSMCCSVParser::ParseComment(const char* lineStart, size_t length)
-{
-    // Handle comment lines starting with '#' (optional)
-    // Example: logging or ignoring
-    // std::string_view comment(lineStart, length);
-    // std::cout << "Comment: " << comment << std::endl;
+        lineStart = CSMCMappedFile::skipLineBreak(lineEnd, end);
+    }
 }
 
-void CSMCCSVParser::PushTimestamp(void* ts_target, double ts)
+void CSMCCSVParser::MergeChunk(const ChunkTokens& tokens)
 {
-    auto* vec = static_cast<std::vector<double>*>(ts_target);
-    vec->push_back(ts);
-}
+    const SubCycle* nextLaserCycle = tokens.laserCycles.data();
+
+    for (size_t rowIndex = 0; rowIndex < tokens.rowCount; ++rowIndex) {
+        const double* rowValues = tokens.values.data() + rowIndex * m_valueSlotCount;
+        const uint32_t* rowLaserCycleCounts = tokens.laserCycleCounts.data() + rowIndex * m_laserSlotCount;
+        size_t fieldCount = tokens.fieldCounts[rowIndex];
+
+        m_timestamps.push_back(m_nextTimestamp);
+        m_prevTsIdx = m_currTsIdx;
+        m_currTsIdx = m_timestamps.size() - 1;
+        m_nextTimestamp += CSMCCSVParser::TimestampDefaultInc;
+
+        // Fields missing at the end of a row do not get a value
+        for (size_t fieldIndex = 0; fieldIndex < fieldCount; ++fieldIndex) {
+            auto& columnData = m_columns[fieldIndex];
+
+            switch (columnData.meta.type) {
+            case FieldParserType::Int:
+                columnData.int32Values.push_back((int32_t)rowValues[columnData.valueSlot]);
+                break;
+            case FieldParserType::UInt32:
+                columnData.uint32Values.push_back((uint32_t)rowValues[columnData.valueSlot]);
+                break;
+            case FieldParserType::Double:
+                columnData.doubleValues.push_back(rowValues[columnData.valueSlot]);
+                break;
+            case FieldParserType::LaserSignal: {
+                uint32_t cycleCount = rowLaserCycleCounts[columnData.laserSlot];
+                if (cycleCount == 0) {
+                    columnData.uint32Values.push_back(0);
+                }
+                else {
+                    columnData.uint32Values.push_back(nextLaserCycle[0].Toggle);
+
+                    // Every toggle within the row gets its own timestamp
+                    double ts = m_timestamps.back();
+                    for (uint32_t i = 1; i < cycleCount; ++i) {
+                        columnData.uint32Values.push_back(nextLaserCycle[i].Toggle);
+                        m_timestamps.push_back(ts + nextLaserCycle[i].TimeOffset);
+                    }
+                }
 
-double CSMCCSVParser::LastTimestamp(void* ts_target)
-{
-    auto* vec = static_cast<std::vector<double>*>(ts_target);
-    double ts = 0.0;
-    if (vec->size())
-        ts = vec->back();    
-    return ts;
-}
+                nextLaserCycle += cycleCount;
+                break;
+            }
+            default:
+                break;
+            }
+        }
 
-void CSMCCSVParser::ParseTimestamp(const char* data, size_t length, void* target, void* ts_target)
-{
-    // Parse the timestamp as a Unix timestamp or in another format
-    std::string timestampStr(data, length);
+        for (auto& columnData : m_columns) {
+            bool interpolate = (m_currTsIdx != m_prevTsIdx) && ((columnData.meta.processing & FieldProcessingStep::Interpolate) != 0);
+            bool extend = (columnData.meta.processing & FieldProcessingStep::Extend) != 0;
+
+            switch (columnData.meta.type) {
+            case FieldParserType::Int:
+                if (interpolate)
+                    InterpolateColumn(columnData.int32Values, m_prevTsIdx, m_currTsIdx);
+                if (extend)
+                    ExtendColumn(columnData.int32Values, m_timestamps.size());
+                break;
+            case FieldParserType::UInt32:
+                if (interpolate)
+                    InterpolateColumn(columnData.uint32Values, m_prevTsIdx, m_currTsIdx);
+                if (extend)
+                    ExtendColumn(columnData.uint32Values, m_timestamps.size());
+                break;
+            case FieldParserType::Double:
+                if (interpolate)
+                    InterpolateColumn(columnData.doubleValues, m_prevTsIdx, m_currTsIdx);
+                if (extend)
+                    ExtendColumn(columnData.doubleValues, m_timestamps.size());
+                break;
+            default:
+                break;
+            }
+        }
 
-    // If parsing Unix timestamp (integer)
-    try {
-        long timestamp = std::stol(timestampStr);
-        *reinterpret_cast<std::time_t*>(target) = static_cast<std::time_t>(timestamp);
-    }
-    catch (const std::exception& e) {
-        // Handle invalid format if needed
-        *reinterpret_cast<std::time_t*>(target) = 0;  // or throw an exception
+        ++m_rowCount;
     }
 }
 
 template<typename T>
-void CSMCCSVParser::ParseValue(const char* data, size_t length, void* target, void* ts_target)
+T CSMCCSVParser::ParseValue(const char* data, size_t length)
 {
-    auto* vec = static_cast<std::vector<T>*>(target);
-    T value = 0;
-
     // Skip leading whitespace
     while (length > 0 && std::isspace(static_cast<unsigned char>(*data))) {
         ++data;
         --length;
     }
 
-    if constexpr (std::is_same_v<T, int> || std::is_same_v<T, uint32_t>)
-    {
-        auto [ptr, ec] = std::from_chars(data, data + length, value);
-        vec->push_back((ec == std::errc()) ? value : 0);
-    }
-    else if constexpr (std::is_same_v<T, double>)
-    {
-        try {
-            // Convert to std::string to support + or - and decimal parsing via stod
-            std::string str(data, length);
-            value = std::stod(str);
-            vec->push_back(value);
-        }
-        catch (...) {
-            vec->push_back(0.0); // fallback on failure
-        }
-    }
-    else
-    {
-        throw ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_CSVPARSERUNKNOWNFIELDPARSERTYPE);
+    // from_chars does not accept an explicit plus sign
+    if (length > 0 && *data == '+') {
+        ++data;
+        --length;
     }
+
+    T value = 0;
+    auto [ptr, ec] = std::from_chars(data, data + length, value);
+    if (ec != std::errc())
+        return 0;
+
+    return value;
 }
 
 template<typename T>
-void CSMCCSVParser::ExtendVector(void* target, void* ts_target)
+void CSMCCSVParser::ExtendColumn(std::vector<T>& values, size_t size)
 {
-    auto* vec = static_cast<std::vector<T>*>(target);
-    auto* vec_ts = static_cast<std::vector<double>*>(ts_target);
-
-    auto diff = vec_ts->size() - vec->size();
-    if (diff > 0 && !vec->empty()) {
-        const T copy = vec->back();
-        for (size_t i = 0; i < diff; ++i)
-            vec->push_back(copy);
-    }
+    if (!values.empty() && (values.size() < size))
+        values.resize(size, values.back());
 }
 
 template<typename T>
-void CSMCCSVParser::InterpolateVector(size_t idx_from, size_t idx_to, void* target, void* ts_target)
+void CSMCCSVParser::InterpolateColumn(std::vector<T>& values, size_t idx_from, size_t idx_to)
 {
     if (idx_from + 1 == idx_to)
         return; // nothing to interpolate
 
-    auto* position = static_cast<std::vector<T>*>(target);
-    auto* timestamp = static_cast<std::vector<double>*>(ts_target);
-
-    if (idx_from >= timestamp->size() || idx_to >= timestamp->size() ||
-        idx_from >= position->size() || idx_to >= position->size()) {
+    if (idx_from >= m_timestamps.size() || idx_to >= m_timestamps.size() ||
+        idx_from >= values.size() || idx_to >= values.size()) {
         throw ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_CSVPARSERINTERPOLATEINDEXOUTOFRANGE);
     }
 
-    double t0 = timestamp->at(idx_from);
-    double t1 = timestamp->at(idx_to);
+    double t0 = m_timestamps[idx_from];
+    double t1 = m_timestamps[idx_to];
 
-    T x0 = position->at(idx_from);
-    T x1 = position->at(idx_to);
+    double x0 = (double)values[idx_from];
+    double x1 = (double)values[idx_to];
 
     for (size_t i = idx_from + 1; i < idx_to; ++i)
     {
-        double target_time = timestamp->at(i);
-        double t = (target_time - t0) / (t1 - t0);
+        double t = (m_timestamps[i] - t0) / (t1 - t0);
 
-        T interpolated;
         if constexpr (std::is_floating_point<T>::value) {
-            interpolated = static_cast<T>(x0 + t * (x1 - x0));
+            values[i] = static_cast<T>(x0 + t * (x1 - x0));
         }
         else {
-            interpolated = static_cast<T>(std::round(x0 + t * (x1 - x0)));
-        }
-
-        position->at(i) = interpolated;
-    }
-}
-
-void CSMCCSVParser::ParseBool(const char* data, size_t length, void* target, void* ts_target)
-{
-    auto* vec = static_cast<std::vector<bool>*>(target);
-    bool value = false;
-
-    if (length == 1) {
-        value = (data[0] == '1' || std::tolower(data[0]) == 't');
-    }
-    else {
-        std::string_view sv(data, length);
-        if (sv == "true" || sv == "True" || sv == "TRUE" ||
-            sv == "yes" || sv == "Yes" || sv == "YES") {
-            value = true;
-        }
-    }
-
-    vec->push_back(value);
-}
-
-void CSMCCSVParser::ParseString(const char* data, size_t length, void* target, void* ts_target)
-{
-    auto* vec = static_cast<std::vector<std::string>*>(target);
-    vec->emplace_back(data, length);
-}
-
-void CSMCCSVParser::ParseLaserSignal(const char* data, size_t length, void* target, void* ts_target)
-{
-    auto* vec = static_cast<std::vector<uint32_t>*>(target);
-
-    std::vector<SubCycle> sub_cycles;
-
-    //std::cout << "-----------------" << std::endl;
-    //std::cout << std::string(data, length) << std::endl;
-
-    ParseLaserSignal_Internal(data, length, (void*)&sub_cycles, nullptr);
-    vec->push_back(sub_cycles[0].Toggle);
-    //std::cout << "init  " << sub_cycles[0].Toggle << " at " << CSMCCSVParser::FormatDouble(sub_cycles[0].TimeOffset) << std::endl;
-
-    if (sub_cycles.size() > 1)
-    {
-        double ts = LastTimestamp(ts_target);
-
-        for (int i = 1; i < sub_cycles.size(); ++i)
-        {
-            vec->push_back(sub_cycles[i].Toggle);
-
-            if (sub_cycles.size() > 1)
-                CSMCCSVParser::PushTimestamp(ts_target, ts + sub_cycles[i].TimeOffset);
-
-            //std::cout << "toggle to " << sub_cycles[i].Toggle << " at " << CSMCCSVParser::FormatDouble(ts) << " + " << CSMCCSVParser::FormatDouble(sub_cycles[i].TimeOffset) << std::endl;
+            values[i] = static_cast<T>(std::round(x0 + t * (x1 - x0)));
         }
     }
-
-    //std::cout << "-----------------" << std::endl;
 }
 
-CSMCCSVParser::ParserFunc CSMCCSVParser::GetParser(FieldParserType type)
+size_t CSMCCSVParser::ParseLaserSignal(const char* data, size_t length, std::vector<SubCycle>& sub_cycles)
 {
-    switch (type) {
-    case FieldParserType::None:
-        return nullptr;
-    case FieldParserType::Timestamp:
-        return nullptr; //return &CSMCCSVParser::ParseTimestamp;
-    case FieldParserType::Int:
-        return static_cast<ParserFunc>(&CSMCCSVParser::ParseValue<int32_t>);    //return &CSMCCSVParser::ParseInt32;
-    case FieldParserType::UInt32:
-        return static_cast<ParserFunc>(&CSMCCSVParser::ParseValue<uint32_t>);   //return &CSMCCSVParser::ParseUInt32;
-    case FieldParserType::Double:
-        return static_cast<ParserFunc>(&CSMCCSVParser::ParseValue<double>);     // return &CSMCCSVParser::ParseDouble;
-    case FieldParserType::Bool:
-        return &CSMCCSVParser::ParseBool;
-    case FieldParserType::String:
-        return &CSMCCSVParser::ParseString;
-    case FieldParserType::LaserSignal:
-        return &CSMCCSVParser::ParseLaserSignal;
-    default:
-        throw ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_CSVPARSERUNKNOWNFIELDPARSERTYPE);
-    }
-}
+    if (!data || length == 0)
+        return 0;
 
-CSMCCSVParser::ExtenderFunc CSMCCSVParser::GetExtender(FieldParserType type) {
-    switch (type) {
-    case FieldParserType::None:
-        return nullptr;
-    case FieldParserType::Timestamp:
-        return nullptr; //return &CSMCCSVParser::ParseTimestamp;
-    case FieldParserType::Int:
-        return static_cast<ExtenderFunc>(&CSMCCSVParser::ExtendVector<int32_t>);
-    case FieldParserType::UInt32:
-        return static_cast<ExtenderFunc>(&CSMCCSVParser::ExtendVector<uint32_t>);
-    case FieldParserType::Double:
-        return static_cast<ExtenderFunc>(&CSMCCSVParser::ExtendVector<double>);
-    case FieldParserType::Bool:
-        return static_cast<ExtenderFunc>(&CSMCCSVParser::ExtendVector<bool>);
-    case FieldParserType::String:
-        return static_cast<ExtenderFunc>(&CSMCCSVParser::ExtendVector<std::string>);
-    case FieldParserType::LaserSignal:
-        return nullptr;
-    default:
-        throw ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_CSVPARSERUNKNOWNFIELDPARSERTYPE);
-    }
-}
-
-CSMCCSVParser::InterpolatorFunc CSMCCSVParser::GetInterpolator(FieldParserType type)
-{
-    switch (type) {
-    case FieldParserType::None:
-        return nullptr;
-    case FieldParserType::Timestamp:
-        return nullptr;
-    case FieldParserType::Int:
-        return static_cast<InterpolatorFunc>(&CSMCCSVParser::InterpolateVector<int32_t>);
-    case FieldParserType::UInt32:
-        return static_cast<InterpolatorFunc>(&CSMCCSVParser::InterpolateVector<uint32_t>);
-    case FieldParserType::Double:
-        return static_cast<InterpolatorFunc>(&CSMCCSVParser::InterpolateVector<double>);
-    case FieldParserType::Bool:
-        return nullptr;
-    case FieldParserType::String:
-        return nullptr;
-    case FieldParserType::LaserSignal:
-        return nullptr;
-    default:
-        throw ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_CSVPARSERUNKNOWNFIELDPARSERTYPE);
-    }
-}
-
-void CSMCCSVParser::ParseLaserSignal_Internal(const char* data, size_t length, void* target, void* ts_target)
-{
-    if (!target || !data || length == 0)
-        return;
-
-    auto* outVec = static_cast<std::vector<SubCycle>*>(target);
-    outVec->clear();
+    size_t initialSize = sub_cycles.size();
 
     const char* ptr = data;
     const char* end = data + length;
@@ -468,8 +406,8 @@ void CSMCCSVParser::ParseLaserSignal_Internal(const char* data, size_t length, v
     bool laserActive = (ptr - token_start == 1 && token_start[0] == '1');
 
     if (!laserActive) {
-        outVec->push_back({ false, 0.0 });
-        return;
+        sub_cycles.push_back({ false, 0.0 });
+        return 1;
     }
 
     // Move to next token (InitToggleState)
@@ -482,21 +420,21 @@ void CSMCCSVParser::ParseLaserSignal_Internal(const char* data, size_t length, v
 
     if (ptr - token_start == 1 && token_start[0] == '1') initState = true;
     else if (ptr - token_start == 1 && token_start[0] == '0') initState = false;
-    else return; // invalid InitToggleState
+    else return 0; // invalid InitToggleState
     
-    outVec->push_back({ initState, 0.0 });
+    sub_cycles.push_back({ initState, 0.0 });
 
     // Move to first time offset
     if (ptr < end && *ptr == '_')
         ++ptr;
     else        
-        return;
+        return sub_cycles.size() - initialSize;
 
     SubCycle sub_cycle;
     sub_cycle.Toggle = !initState;
 
     while (ptr <= end) {
-        // Step 5.1: Parse next token (time offset or empty)
+        // Step 3: Parse next token (time offset or empty)
         token_start = ptr;
         while (ptr < end && *ptr != '_') ++ptr;
         size_t token_len = ptr - token_start;
@@ -505,26 +443,19 @@ void CSMCCSVParser::ParseLaserSignal_Internal(const char* data, size_t length, v
             sub_cycle.TimeOffset = 0.0;
         }
         else {
-            std::vector<double> temp;
-            //CSMCCSVParser::ParseDouble(token_start, token_len, &temp, ts_target);
-            CSMCCSVParser::ParseValue<double>(token_start, token_len, &temp, ts_target);
-            sub_cycle.TimeOffset = temp.empty() ? 0.0 : temp.back();
+            sub_cycle.TimeOffset = ParseValue<double>(token_start, token_len);
         }
 
-        outVec->push_back(sub_cycle);
+        sub_cycles.push_back(sub_cycle);
 
-        // Step 5.2: Flip toggle state
+        // Step 4: Flip toggle state
         sub_cycle.Toggle = !sub_cycle.Toggle;
 
         if (ptr < end && *ptr == '_') ++ptr;
         else break;
     }
 
-    // If no time offsets, still add initial with offset = 0
-    if (outVec->empty()) {
-        sub_cycle.TimeOffset = 0.0;
-        outVec->push_back(sub_cycle);
-    }
+    return sub_cycles.size() - initialSize;
 }
 
 std::string CSMCCSVParser::FormatDouble(double value)
@@ -539,4 +470,4 @@ std::string CSMCCSVParser::FormatDouble(double value)
     }
 
     return std::string(buffer);
-}
\ No newline at end of file
+}
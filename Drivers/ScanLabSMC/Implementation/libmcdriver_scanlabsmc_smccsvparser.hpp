@@ -35,10 +35,11 @@ Abstract: This is the class declaration of CSMCCSVParser
 #define __LIBMCDRIVER_SCANLABSMC_SMCCSVPARSER
 
 #include "libmcdriver_scanlabsmc_interfaces.hpp"
+#include "libmcdriver_scanlabsmc_smcmappedfile.hpp"
+#include "libmcdriver_scanlabsmc_smcparserworkerpool.hpp"
 
 #include <string>
 #include <vector>
-#include <functional>
 
 
 
@@ -46,61 +47,53 @@ namespace LibMCDriver_ScanLabSMC {
 namespace Impl {
 
     /**
-        * @brief A fast single-pass CSV parser that loads the file into memory
-        *        and parses fields without copying using pointer slicing.
+        * @brief A fast CSV parser that works on a memory mapping of the file.
+        *
+        * The file is split into fixed-size chunks at line boundaries. The chunks are tokenized
+        * independently (optionally in parallel), and then merged in file order, which assigns
+        * timestamps and applies the processing steps. The resulting columns are written into
+        * a data table without further copies.
         */
     class CSMCCSVParser {
     public:
 
         /**
             * @brief Enumeration of supported field parser types.
-            * Used for mapping column definitions to parser functions.
+            * Used for mapping column definitions to data table column types.
             */
         enum class FieldParserType {
             /**
-                * Skips this field during parsing. Equivalent to nullptr in targets.
+                * Skips this field during parsing.
                 * Useful for ignoring unused CSV columns.
                 */
             None,
             /**
-                * Parses a field as a timestamp using CSMCCSVParser::ParseDouble.
-                * Expected format: "+0.000000000", "-12.345678901"
-                * Typically represents absolute or relative time in seconds.
+                * Marks the column that receives the generated timestamps (DoubleColumn).
+                * The field content itself is not parsed. Timestamps advance by TimestampDefaultInc
+                * per row, and laser signal sub-cycles insert additional timestamps in between.
                 */
             Timestamp,
 
             /**
-                * Parses a field as signed integer using CSMCCSVParser::ParseInt.
+                * Parses a field as signed 32-bit integer (Int32Column).
                 * Expects input like: "42", "-7", "0"
                 */
             Int,
 
             /**
-                * Parses a field as unsigned 32-bit integer using CSMCCSVParser::ParseUInt32.
+                * Parses a field as unsigned 32-bit integer (Uint32Column).
                 * Expects input like: "123", "0", "4294967295"
                 */
             UInt32,
 
             /**
-                * Parses a field as double using CSMCCSVParser::ParseDouble.
+                * Parses a field as double (DoubleColumn).
                 * Expects fixed-point or scientific notation: "3.14", "+0.0", "-1.23e-5"
                 */
             Double,
 
             /**
-                * Parses a field as boolean using CSMCCSVParser::ParseBool.
-                * Accepts "1", "0", "true", "false", "yes", "no"
-                */
-            Bool,
-
-            /**
-                * Parses a field as std::string using CSMCCSVParser::ParseString.
-                * Accepts arbitrary UTF-8 text.
-                */
-            String,
-
-            /**
-                * Parses a field as a laser signal descriptor using CSMCCSVParser::ParseLaserSignal.
+                * Parses a field as a laser signal descriptor (Uint32Column) using CSMCCSVParser::ParseLaserSignal.
                 * Expects compound format: "1_1_+2.0_+3.5_+8.1"
                 */
             LaserSignal
@@ -141,7 +134,7 @@ namespace Impl {
          */
         struct FieldMetadata {
             /**
-             * @brief Defines how the field should be parsed (e.g., as double, int, bool, etc.).
+             * @brief Defines how the field should be parsed (e.g., as double, int, etc.).
              */
             FieldParserType         type;
             /**
@@ -151,10 +144,9 @@ namespace Impl {
         };
 
         /**
-         * @brief Associates metadata with a pointer to the destination buffer for parsed data.
+         * @brief Associates metadata with the data table column that receives the parsed data.
          *
-         * This structure maps a single CSV field to both its interpretation rules (metadata)
-         * and the memory location where the parsed values should be stored.
+         * The n-th binding describes the n-th field of every CSV row.
          */
         struct FieldBinding {
             /**
@@ -163,147 +155,85 @@ namespace Impl {
             FieldMetadata meta;
 
             /**
-             * @brief Pointer to the target container where parsed values are appended.
+             * @brief Identifier of the data table column that receives the values.
              *
-             * This is typically a pointer to a std::vector<T>.
+             * Fields with an empty identifier are skipped during parsing.
              */
-            void* target;
+            std::string column;
         };
 
-
         /**
-            * @brief Type alias for parser function pointer.
-            * The function receives:
-            * - pointer to character buffer (not null-terminated),
-            * - length of the field,
-            * - pointer to target vector<T>.
+            * @brief Constructs the parser and maps the file into memory.
+            * @param sAbsoluteFileNameUTF8 Path to the CSV file.
+            * @param delimiter Delimiter character used in the CSV (e.g. ',', ';').
+            * @param pWorkerPool Threads that tokenize the chunks. A pool with one thread parses on the calling thread only.
             */
-        using ParserFunc = std::function<void(const char*, size_t, void*, void*)>;
-
-        /**
-         * @brief Function type used to extend a data vector after parsing.
-         *
-         * This function is responsible for duplicating the last known value
-         * to ensure the vector matches the length of the timestamp vector.
-         *
-         * @param target Pointer to the target data vector (e.g., std::vector<T>).
-         * @param ts_target Pointer to the timestamp vector (std::vector<double>).
-         */
-        using ExtenderFunc = std::function<void(void*, void*)>;
-        
+        CSMCCSVParser(const std::string& sAbsoluteFileNameUTF8, char delimiter, PSMCParserWorkerPool pWorkerPool);
 
         /**
-         * @brief Function type used to interpolate values between two known timestamp indices.
-         *
-         * This function is applied when a field supports interpolation between sparse data points.
-         * It modifies the target vector in-place to insert estimated values using linear interpolation.
-         *
-         * @param idx_from Index of the first known timestamp.
-         * @param idx_to Index of the second known timestamp.
-         * @param target Pointer to the target data vector (e.g., std::vector<T>).
-         * @param ts_target Pointer to the timestamp vector (std::vector<double>).
-         */
-        using InterpolatorFunc = std::function<void(size_t, size_t, void*, void*)>;
+            * @brief Parses the CSV file into the columns given by the field bindings.
+            * @param field_bindings A vector of binding between fields metadata and destination columns
+            */
+        void Parse(const std::vector<FieldBinding>& field_bindings);
 
         /**
-            * @brief Constructs the parser and loads the entire file into memory.
-            * @param filename Path to the CSV file.
-            * @param delimiter Delimiter character used in the CSV (e.g. ',', ';').
+            * @brief Returns the number of generated timestamps, i.e. the row count of the parsed columns.
             */
-        CSMCCSVParser(const std::string& sAbsoluteFileNameUTF8, char delimiter);
+        size_t GetTimestampCount() const;
 
         /**
-            * @brief Starts parsing the CSV file using user-provided parsers and target vectors.
-            * @param field_bindings A vector of binding between fields metadata and destination targe containers
+            * @brief Returns the generated timestamps. Empty after WriteToDataTable.
             */
-        void Parse(const std::vector<FieldBinding>& field_bindings);
-
-        // Static parsing functions for specific data types
-
-        static constexpr size_t TimestampDefaultInc = 10;
+        const std::vector<double>& GetTimestamps() const;
 
         /**
-         * @brief Adds a timestamp to the timestamp target vector.
-         * @param ts_target Pointer to the timestamp vector (std::vector<double>*).
-         * @param ts Timestamp value to be added.
-         */
-        static void PushTimestamp(void* ts_target, double ts);
+            * @brief Returns the parsed values of a column. Empty after WriteToDataTable.
+            * @param sColumn Identifier of a bound column of matching type. Fails otherwise.
+            */
+        const std::vector<double>& GetDoubleColumnValues(const std::string& sColumn) const;
+        const std::vector<int32_t>& GetInt32ColumnValues(const std::string& sColumn) const;
+        const std::vector<uint32_t>& GetUint32ColumnValues(const std::string& sColumn) const;
 
         /**
-         * @brief Returns the last timestamp from the timestamp target vector.
-         * @param ts_target Pointer to the timestamp vector (std::vector<double>*).
-         * @return The last timestamp value or 0.0 if the vector is empty.
-         */
-        static double LastTimestamp(void* ts_target);
-
+            * @brief Writes all parsed columns into the data table and releases them.
+            * The columns need to be added to the data table with the matching column type before.
+            * @param pDataTable Target data table.
+            */
+        void WriteToDataTable(LibMCEnv::PDataTable pDataTable);
 
-        /**
-         * @brief Parses a timestamp string and stores it in the provided target.
-         * @param data Pointer to the character buffer.
-         * @param length Length of the buffer.
-         * @param target Pointer to the output target (std::time_t*).
-         * @param ts_target Optional pointer to the timestamp vector.
-         */
-        static void ParseTimestamp(const char* data, size_t length, void* target, void* ts_target);
+        static constexpr size_t TimestampDefaultInc = 10;
 
-        /**
-         * @brief Parses a boolean value (e.g. '1', 'true') and stores it in the target vector.
-         * @param data Pointer to the character buffer.
-         * @param length Length of the buffer.
-         * @param target Pointer to the output vector (std::vector<bool>*).
-         * @param ts_target Optional pointer to the timestamp vector.
-         */
-        static void ParseBool(const char* data, size_t length, void* target, void* ts_target);
+        static constexpr size_t ChunkSize = SCANLABSMC_PARSERCHUNKSIZE;
 
         /**
-         * @brief Parses a string and stores it in the target vector.
-         * @param data Pointer to the character buffer.
-         * @param length Length of the buffer.
-         * @param target Pointer to the output vector (std::vector<std::string>*).
-         * @param ts_target Optional pointer to the timestamp vector.
+         * @brief Represents a laser toggle sub-cycle with timing.
          */
-        static void ParseString(const char* data, size_t length, void* target, void* ts_target);
+        struct SubCycle {
+            bool Toggle;        ///< Toggle state (on/off).
+            double TimeOffset;  ///< Time offset from the base timestamp.
+        };
 
         /**
-         * @brief Generic value parser for numeric types (int, uint32_t, double).
+         * @brief Generic value parser for numeric types (int32_t, uint32_t, double).
+         * Leading whitespace and an explicit plus sign are skipped. Invalid input results in 0.
          * @tparam T The numeric type to parse.
          * @param data Pointer to the character buffer.
          * @param length Length of the buffer.
-         * @param target Pointer to the output vector (std::vector<T>*).
-         * @param ts_target Optional pointer to the timestamp vector.
+         * @return The parsed value.
          */
         template<typename T>
-        static void ParseValue(const char* data, size_t length, void* target, void* ts_target);
+        static T ParseValue(const char* data, size_t length);
 
         /**
-         * @brief Fills the vector with repeated last value to match the length of the timestamp vector.
-         * @tparam T The value type.
-         * @param target Pointer to the output vector (std::vector<T>*).
-         * @param ts_target Pointer to the timestamp vector (std::vector<double>*).
-         */
-        template<typename T>
-        static void ExtendVector(void* target, void* ts_target);
-
-        /**
-         * @brief Interpolates values between two known points in time.
-         * @tparam T The value type.
-         * @param idx_from Start index in the timestamp vector.
-         * @param idx_to End index in the timestamp vector.
-         * @param target Pointer to the output vector (std::vector<T>*).
-         * @param ts_target Pointer to the timestamp vector (std::vector<double>*).
-         */
-        template<typename T>
-        static void InterpolateVector(size_t idx_from, size_t idx_to, void* target, void* ts_target);
-
-        /**
-         * @brief Parses a complex laser signal structure and stores toggle states in the target vector.
-         * @param data Pointer to the character buffer.
+         * @brief Parses a laser signal descriptor with sub-cycle toggle encoding.
+         * Format: "LaserActive_InitToggleState_Offset1_Offset2_...". An inactive laser results in
+         * a single sub-cycle, an invalid InitToggleState in no sub-cycle at all.
+         * @param data Pointer to the input character buffer.
          * @param length Length of the buffer.
-         * @param target Pointer to the output vector (std::vector<bool>*).
-         * @param ts_target Pointer to the timestamp vector (std::vector<double>*).
+         * @param sub_cycles Vector the sub-cycles are appended to.
+         * @return Number of appended sub-cycles.
          */
-        static void ParseLaserSignal(const char* data, size_t length, void* target, void* ts_target);
-
+        static size_t ParseLaserSignal(const char* data, size_t length, std::vector<SubCycle>& sub_cycles);
 
         /**
          * @brief Formats a double with fixed precision and explicit sign.
@@ -313,53 +243,79 @@ namespace Impl {
         static std::string FormatDouble(double value);
 
     private:
+
         /**
-            * @brief Handles comment lines (starting with '#').
-            * This function can be customized to log, ignore or store comments.
-            */
-        void ParseComment(const char* lineStart, size_t length);
+         * @brief Parse target of one CSV field.
+         *
+         * Numeric fields own a slot in the row values of a tokenized chunk, laser signal fields
+         * a slot in the sub-cycle counts. Only the vector matching the column type is filled.
+         */
+        struct ColumnData {
+            FieldMetadata meta;
+            std::string column;
+            size_t valueSlot;
+            size_t laserSlot;
+            std::vector<double> doubleValues;
+            std::vector<int32_t> int32Values;
+            std::vector<uint32_t> uint32Values;
+        };
 
         /**
-         * @brief Retrieves the appropriate parser function for a given field type.
-         * @param type The type of the field to be parsed.
-         * @return A function pointer to the corresponding parser.
+         * @brief Result of tokenizing one chunk. Holds no reference to other chunks,
+         * so chunks can be tokenized concurrently.
          */
-        static CSMCCSVParser::ParserFunc GetParser(FieldParserType type);
+        struct ChunkTokens {
+            size_t rowCount = 0;
+            std::vector<uint32_t> fieldCounts;         ///< Number of fields present per row
+            std::vector<double> values;                ///< Numeric fields, row-major
+            std::vector<uint32_t> laserCycleCounts;    ///< Sub-cycle count per row and laser field
+            std::vector<SubCycle> laserCycles;         ///< Sub-cycles of all rows
+        };
 
         /**
-         * @brief Retrieves the extender function for the given field type.
-         * @param type The type of the field to extend.
-         * @return A function pointer to the corresponding extender.
+         * @brief Splits the rows of a chunk into fields and converts them. Thread-safe.
          */
-        static CSMCCSVParser::ExtenderFunc GetExtender(FieldParserType type);
+        void TokenizeChunk(const sSMCFileChunk& chunk, ChunkTokens& tokens) const;
 
         /**
-         * @brief Retrieves the interpolation function for the given field type.
-         * @param type The type of the field to interpolate.
-         * @return A function pointer to the corresponding interpolator.
+         * @brief Appends the rows of a tokenized chunk to the columns.
+         * Needs to be called in file order, as timestamps depend on all previous rows.
          */
-        static CSMCCSVParser::InterpolatorFunc GetInterpolator(FieldParserType type);
+        void MergeChunk(const ChunkTokens& tokens);
 
         /**
-         * @brief Represents a laser toggle sub-cycle with timing.
+         * @brief Fills the column with its last value up to the given size.
          */
-        struct SubCycle {
-            bool Toggle;        ///< Toggle state (on/off).
-            double TimeOffset;  ///< Time offset from the base timestamp.
-        };
+        template<typename T>
+        static void ExtendColumn(std::vector<T>& values, size_t size);
 
         /**
-         * @brief Internal parser for complex LaserSignal field with sub-cycle toggle encoding.
-         * @param data Pointer to the input character buffer.
-         * @param length Length of the buffer.
-         * @param target Pointer to the output vector of SubCycle.
-         * @param ts_target Pointer to the timestamp vector.
+         * @brief Interpolates the values between two known points in time linearly.
+         * @param idx_from Start index in the timestamp vector.
+         * @param idx_to End index in the timestamp vector.
          */
-        static void ParseLaserSignal_Internal(const char* data, size_t length, void* target, void* ts_target);
+        template<typename T>
+        void InterpolateColumn(std::vector<T>& values, size_t idx_from, size_t idx_to);
 
-        std::vector<char> m_fileBuff;   ///< Raw file contents held in memory
-        char m_delimiter;               ///< CSV field delimiter character
-        size_t m_rowCount = 0;          ///< Number of parsed data rows
+        /**
+         * @brief Returns the bound column with the given identifier and one of the given types.
+         */
+        const ColumnData& FindColumn(const std::string& sColumn, FieldParserType type1, FieldParserType type2) const;
+
+        PSMCMappedFile m_pFile;                     ///< Memory mapping of the file
+        char m_delimiter;                           ///< CSV field delimiter character
+        PSMCParserWorkerPool m_pWorkerPool;         ///< Tokenizer threads
+
+        std::vector<ColumnData> m_columns;          ///< Parse targets, one per CSV field
+        std::string m_timestampColumn;              ///< Column that receives the timestamps
+        std::vector<double> m_timestamps;           ///< Generated timestamps
+        size_t m_valueSlotCount = 0;                ///< Numeric fields per row
+        size_t m_laserSlotCount = 0;                ///< Laser signal fields per row
+
+        double m_nextTimestamp = 0.0;               ///< Timestamp of the next row
+        size_t m_prevTsIdx = 0;                     ///< Timestamp index of the previous row
+        size_t m_currTsIdx = 0;                     ///< Timestamp index of the current row
+        size_t m_rowCount = 0;                      ///< Number of parsed data rows
     };
 
 } //namespace Impl 
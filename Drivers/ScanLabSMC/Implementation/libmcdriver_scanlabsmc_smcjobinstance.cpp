@@ -55,7 +55,7 @@ using namespace LibMCDriver_ScanLabSMC::Impl;
  Class definition of CSMCJob
 **************************************************************************************************************************/
 
-CSMCJobInstance::CSMCJobInstance(PSMCContextHandle pContextHandle, double dStartPositionX, double dStartPositionY, LibMCEnv::PWorkingDirectory pWorkingDirectory, std::string sSimulationSubDirectory, bool bSendToHardware, double dMaxPowerInWatts)
+CSMCJobInstance::CSMCJobInstance(PSMCContextHandle pContextHandle, double dStartPositionX, double dStartPositionY, LibMCEnv::PWorkingDirectory pWorkingDirectory, std::string sSimulationSubDirectory, bool bSendToHardware, double dMaxPowerInWatts, PSMCParserWorkerPool pParserWorkerPool)
     : m_pContextHandle(pContextHandle), 
     m_JobID(0), 
     m_bIsFinalized(false), 
@@ -64,10 +64,13 @@ CSMCJobInstance::CSMCJobInstance(PSMCContextHandle pContextHandle, double dStart
     m_bHasJobDuration (false),
     m_dJobDuration (0.0),
     m_bSendToHardware (bSendToHardware),
-    m_dMaxPowerInWatts (dMaxPowerInWatts)
+    m_dMaxPowerInWatts (dMaxPowerInWatts),
+    m_pParserWorkerPool (pParserWorkerPool)
 {
     if (m_pWorkingDirectory.get() == nullptr)
         throw ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_INVALIDPARAM);
+    if (m_pParserWorkerPool.get() == nullptr)
+        throw ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_INVALIDPARAM);
     if (m_pContextHandle.get() == nullptr)
         throw ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_INVALIDPARAM);
 
@@ -763,30 +766,9 @@ void CSMCJobInstance::ReadSimulationFile_SMC_v0_8(LibMCEnv::PDataTable pDataTabl
     if (!m_sSimulationSubDirectory.empty ())
         sSimulationDirectory += m_sSimulationSubDirectory + "/";
 
-    CSMCSimulationParser parser(sSimulationDirectory + sSimulationFileName);
-
-    pDataTable->AddColumn("timestamp", "Timestamp", LibMCEnv::eDataTableColumnType::DoubleColumn);
-    pDataTable->AddColumn("x", "X", LibMCEnv::eDataTableColumnType::DoubleColumn);
-    pDataTable->AddColumn("y", "Y", LibMCEnv::eDataTableColumnType::DoubleColumn);
-    pDataTable->AddColumn("laseron", "LaserOn", LibMCEnv::eDataTableColumnType::Int32Column);
-    pDataTable->AddColumn("active1", "Active Channel 1", LibMCEnv::eDataTableColumnType::DoubleColumn);
-    pDataTable->AddColumn("active2", "Active Channel 2", LibMCEnv::eDataTableColumnType::DoubleColumn);
-    pDataTable->AddColumn("cmdindex", "Command Index", LibMCEnv::eDataTableColumnType::Int32Column);
-
-    std::vector<double> timestampValues;
-    parser.readTimestampValues(timestampValues);
-    pDataTable->SetDoubleColumnValues("timestamp", timestampValues);
-    timestampValues.resize(0);
+    CSMCSimulationParser parser(sSimulationDirectory + sSimulationFileName, m_pParserWorkerPool);
 
-    std::vector<double> xValues;
-    parser.readXValues(xValues);
-    pDataTable->SetDoubleColumnValues("x", xValues);
-    xValues.resize(0);
-
-    std::vector<double> yValues;
-    parser.readYValues(yValues);
-    pDataTable->SetDoubleColumnValues("y", yValues);
-    yValues.resize(0);
+    parser.writeToDataTable(pDataTable);
 
     m_dJobDuration = (double)parser.getCount() / (double)SCANLABSMC_MICROSTEPSPERSECOND;
     m_bHasJobDuration = true;
@@ -810,42 +792,24 @@ void CSMCJobInstance::ReadSimulationFile_SMC_v1_0(LibMCEnv::PDataTable pDataTabl
     if (!m_sSimulationSubDirectory.empty())
         sSimulationDirectory += m_sSimulationSubDirectory + "/";
 
-    CSMCCSVParser parser(sSimulationDirectory + sSimulationFileName, ';');
-
-    std::vector<double>     scanheadX;            // DisplacedX_Galvo_1
-    std::vector<double>     scanheadY;            // DisplacedY_Galvo_1
-    std::vector<uint32_t>   laserSignal;        // LaserSignal
-    std::vector<uint32_t>   laserToggle;        // LaserToggle
-    std::vector<double>     activeChannel0;     // ActiveChannel0
-    std::vector<double>     activeChannel1;     // ActiveChannel1
-    std::vector<int>        cmdCount;           // CommandCount
-    std::vector<int>        triggerSignal;      // TriggerSignal
-    std::vector<int>        dummy;               //
-    std::vector<double>     timestampValues;    //
+    CSMCCSVParser parser(sSimulationDirectory + sSimulationFileName, ';', m_pParserWorkerPool);
 
+    // Fields: DisplacedX_Galvo_1, DisplacedY_Galvo_1, LaserSignal, LaserToggle, ActiveChannel0, ActiveChannel1, CommandCount, TriggerSignal, (unused), Timestamp
     std::vector<CSMCCSVParser::FieldBinding> bindings = {
-        {{CSMCCSVParser::FieldParserType::Double, CSMCCSVParser::FieldProcessingStep::Extend | CSMCCSVParser::FieldProcessingStep::Interpolate }, &scanheadX},
-        {{CSMCCSVParser::FieldParserType::Double, CSMCCSVParser::FieldProcessingStep::Extend | CSMCCSVParser::FieldProcessingStep::Interpolate }, &scanheadY},
-        {{CSMCCSVParser::FieldParserType::LaserSignal,CSMCCSVParser::FieldProcessingStep::Nop}, &laserSignal},
-        {{CSMCCSVParser::FieldParserType::UInt32,CSMCCSVParser::FieldProcessingStep::Nop}, &laserToggle},
-        //{{CSMCCSVParser::FieldParserType::None,CSMCCSVParser::FieldProcessingStep::Nop}, nullptr},
-        //{{CSMCCSVParser::FieldParserType::None,CSMCCSVParser::FieldProcessingStep::Nop}, nullptr},
-        {{CSMCCSVParser::FieldParserType::Double,CSMCCSVParser::FieldProcessingStep::Nop}, &activeChannel0},
-        {{CSMCCSVParser::FieldParserType::Double,CSMCCSVParser::FieldProcessingStep::Nop}, &activeChannel1},
-        {{CSMCCSVParser::FieldParserType::Int,CSMCCSVParser::FieldProcessingStep::Nop}, &cmdCount},
-        {{CSMCCSVParser::FieldParserType::None,CSMCCSVParser::FieldProcessingStep::Nop}, nullptr},
-        {{CSMCCSVParser::FieldParserType::None,CSMCCSVParser::FieldProcessingStep::Nop}, nullptr},
-        {{CSMCCSVParser::FieldParserType::Timestamp,CSMCCSVParser::FieldProcessingStep::Nop}, &timestampValues}
+        {{CSMCCSVParser::FieldParserType::Double, CSMCCSVParser::FieldProcessingStep::Extend | CSMCCSVParser::FieldProcessingStep::Interpolate }, "x"},
+        {{CSMCCSVParser::FieldParserType::Double, CSMCCSVParser::FieldProcessingStep::Extend | CSMCCSVParser::FieldProcessingStep::Interpolate }, "y"},
+        {{CSMCCSVParser::FieldParserType::LaserSignal,CSMCCSVParser::FieldProcessingStep::Nop}, "laseron"},
+        {{CSMCCSVParser::FieldParserType::None,CSMCCSVParser::FieldProcessingStep::Nop}, ""},
+        {{CSMCCSVParser::FieldParserType::Double,CSMCCSVParser::FieldProcessingStep::Extend | CSMCCSVParser::FieldProcessingStep::Interpolate }, "power"},
+        {{CSMCCSVParser::FieldParserType::Double,CSMCCSVParser::FieldProcessingStep::Extend | CSMCCSVParser::FieldProcessingStep::Interpolate }, "active1"},
+        {{CSMCCSVParser::FieldParserType::None,CSMCCSVParser::FieldProcessingStep::Nop}, ""},
+        {{CSMCCSVParser::FieldParserType::None,CSMCCSVParser::FieldProcessingStep::Nop}, ""},
+        {{CSMCCSVParser::FieldParserType::None,CSMCCSVParser::FieldProcessingStep::Nop}, ""},
+        {{CSMCCSVParser::FieldParserType::Timestamp,CSMCCSVParser::FieldProcessingStep::Nop}, "timestamp"}
     };
 
     parser.Parse(bindings);
 
-#if NOT_IMPLEMENTED
-    const auto& headers = parser.getHeader();
-    const auto& types = parser.getColumnTypes();
-    const auto& rows = parser.getRows();
-#endif
-
     pDataTable->AddColumn("timestamp", "Timestamp", LibMCEnv::eDataTableColumnType::DoubleColumn);
     pDataTable->AddColumn("x", "X", LibMCEnv::eDataTableColumnType::DoubleColumn);
     pDataTable->AddColumn("y", "Y", LibMCEnv::eDataTableColumnType::DoubleColumn);
@@ -854,26 +818,10 @@ void CSMCJobInstance::ReadSimulationFile_SMC_v1_0(LibMCEnv::PDataTable pDataTabl
     pDataTable->AddColumn("active1", "Active Channel 1", LibMCEnv::eDataTableColumnType::DoubleColumn);
     pDataTable->AddColumn("cmdindex", "Command Index", LibMCEnv::eDataTableColumnType::Int32Column);
 
-    m_dJobDuration = (double)timestampValues.size() / (double)SCANLABSMC_MICROSTEPSPERSECOND;
+    m_dJobDuration = (double)parser.GetTimestampCount() / (double)SCANLABSMC_MICROSTEPSPERSECOND;
     m_bHasJobDuration = true;
 
-    pDataTable->SetDoubleColumnValues("timestamp", timestampValues);
-    timestampValues.resize(0);
-
-    pDataTable->SetDoubleColumnValues("x", scanheadX);
-    scanheadX.resize(0);
-
-    pDataTable->SetDoubleColumnValues("y", scanheadY);
-    scanheadY.resize(0);
-
-    pDataTable->SetUint32ColumnValues("laseron", laserSignal);
-    laserSignal.resize(0);
-
-    pDataTable->SetDoubleColumnValues("power", activeChannel0);
-    activeChannel0.resize(0);
-
-    pDataTable->SetDoubleColumnValues("active1", activeChannel1);
-    activeChannel1.resize(0);    
+    parser.WriteToDataTable(pDataTable);
 }
 
 void CSMCJobInstance::ReadLogRecordFile(LibMCEnv::PDataTable pDataTable)
@@ -897,30 +845,17 @@ void CSMCJobInstance::ReadLogRecordFile(LibMCEnv::PDataTable pDataTable)
 
     //-----------------------------------
 
-    CSMCCSVParser parser(sLogRecordAbsoluteFileName, ';');
-
-    std::vector<double> timestampValues;
-    std::vector<double> scanheadX;
-    std::vector<double> scanheadY;
-    std::vector<uint32_t> laserSignal;
+    CSMCCSVParser parser(sLogRecordAbsoluteFileName, ';', m_pParserWorkerPool);
 
     std::vector<CSMCCSVParser::FieldBinding> bindings = {
-        {{CSMCCSVParser::FieldParserType::Double, CSMCCSVParser::FieldProcessingStep::Extend | CSMCCSVParser::FieldProcessingStep::Interpolate }, &scanheadX},
-        {{CSMCCSVParser::FieldParserType::Double, CSMCCSVParser::FieldProcessingStep::Extend | CSMCCSVParser::FieldProcessingStep::Interpolate }, &scanheadY},
-        {{CSMCCSVParser::FieldParserType::LaserSignal,CSMCCSVParser::FieldProcessingStep::Nop}, &laserSignal},
-        {{CSMCCSVParser::FieldParserType::Timestamp,CSMCCSVParser::FieldProcessingStep::Nop}, &timestampValues}
+        {{CSMCCSVParser::FieldParserType::Double, CSMCCSVParser::FieldProcessingStep::Extend | CSMCCSVParser::FieldProcessingStep::Interpolate }, "x"},
+        {{CSMCCSVParser::FieldParserType::Double, CSMCCSVParser::FieldProcessingStep::Extend | CSMCCSVParser::FieldProcessingStep::Interpolate }, "y"},
+        {{CSMCCSVParser::FieldParserType::LaserSignal,CSMCCSVParser::FieldProcessingStep::Nop}, "laseron"},
+        {{CSMCCSVParser::FieldParserType::Timestamp,CSMCCSVParser::FieldProcessingStep::Nop}, "timestamp"}
     };
 
-    auto start = std::chrono::high_resolution_clock::now();
-
     parser.Parse(bindings);
 
-#if NOT_IMPLEMENTED
-    const auto& headers = parser.getHeader();
-    const auto& types = parser.getColumnTypes();
-    const auto& rows = parser.getRows();
-#endif
-
     pDataTable->AddColumn("timestamp", "Timestamp", LibMCEnv::eDataTableColumnType::DoubleColumn);
     pDataTable->AddColumn("x", "X", LibMCEnv::eDataTableColumnType::DoubleColumn);
     pDataTable->AddColumn("y", "Y", LibMCEnv::eDataTableColumnType::DoubleColumn);
@@ -929,20 +864,10 @@ void CSMCJobInstance::ReadLogRecordFile(LibMCEnv::PDataTable pDataTable)
     pDataTable->AddColumn("active2", "Active Channel 2", LibMCEnv::eDataTableColumnType::DoubleColumn);
     pDataTable->AddColumn("cmdindex", "Command Index", LibMCEnv::eDataTableColumnType::Int32Column);
 
-    m_dJobDuration = (double)timestampValues.size() / (double)SCANLABSMC_MICROSTEPSPERSECOND;
+    m_dJobDuration = (double)parser.GetTimestampCount() / (double)SCANLABSMC_MICROSTEPSPERSECOND;
     m_bHasJobDuration = true;
 
-    pDataTable->SetDoubleColumnValues("timestamp", timestampValues);
-    timestampValues.resize(0);
-
-    pDataTable->SetDoubleColumnValues("x", scanheadX);
-    scanheadX.resize(0);
-
-    pDataTable->SetDoubleColumnValues("y", scanheadY);
-    scanheadY.resize(0);
-
-    pDataTable->SetUint32ColumnValues("laseron", laserSignal);
-    laserSignal.resize(0);
+    parser.WriteToDataTable(pDataTable);
 }
 
 void CSMCJobInstance::AddLayerToList(LibMCEnv::PToolpathLayer pLayer)
@@ -0,0 +1,192 @@
+/*++
+
+Copyright (C) 2023 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the Autodesk Inc. nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 'AS IS' AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+Abstract: This is the class definition of CSMCMappedFile
+
+*/
+
+#include "libmcdriver_scanlabsmc_smcmappedfile.hpp"
+#include "libmcdriver_scanlabsmc_interfaceexception.hpp"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+using namespace LibMCDriver_ScanLabSMC::Impl;
+
+CSMCMappedFile::CSMCMappedFile(const std::string& sAbsoluteFileNameUTF8)
+    : m_pData(nullptr), m_nSize(0)
+#ifdef _WIN32
+    , m_hFile(INVALID_HANDLE_VALUE), m_hMapping(nullptr)
+#endif
+{
+#ifdef _WIN32
+    if (sAbsoluteFileNameUTF8.length() > 65536)
+        throw ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_INVALIDPARAM);
+
+    int nLength = (int)sAbsoluteFileNameUTF8.length();
+    int nBufferSize = nLength * 2 + 2;
+    std::vector<wchar_t> wsFileName(nBufferSize);
+    int nResult = MultiByteToWideChar(CP_UTF8, 0, sAbsoluteFileNameUTF8.c_str(), nLength, &wsFileName[0], nBufferSize);
+    if (nResult == 0)
+        throw ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_INVALIDSIMULATIONFILENAME);
+
+    HANDLE hFile = CreateFileW(wsFileName.data(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (hFile == INVALID_HANDLE_VALUE)
+        throw ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_COULDNOTOOPENSIMULATIONFILE);
+    m_hFile = hFile;
+
+    LARGE_INTEGER nFileSize;
+    if (!GetFileSizeEx(hFile, &nFileSize)) {
+        CloseHandle(hFile);
+        throw ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_COULDNOTREADSIMULATIONFILE);
+    }
+    m_nSize = (uint64_t)nFileSize.QuadPart;
+
+    // Empty files can not be mapped
+    if (m_nSize > 0) {
+        HANDLE hMapping = CreateFileMappingW(hFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (hMapping == nullptr) {
+            CloseHandle(hFile);
+            throw ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_COULDNOTREADSIMULATIONFILE);
+        }
+        m_hMapping = hMapping;
+
+        m_pData = (const char*)MapViewOfFile(hMapping, FILE_MAP_READ, 0, 0, 0);
+        if (m_pData == nullptr) {
+            CloseHandle(hMapping);
+            CloseHandle(hFile);
+            throw ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_COULDNOTREADSIMULATIONFILE);
+        }
+    }
+#else
+    int nFileDescriptor = open(sAbsoluteFileNameUTF8.c_str(), O_RDONLY);
+    if (nFileDescriptor < 0)
+        throw ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_COULDNOTOOPENSIMULATIONFILE);
+
+    struct stat fileStat;
+    if (fstat(nFileDescriptor, &fileStat) != 0) {
+        close(nFileDescriptor);
+        throw ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_COULDNOTREADSIMULATIONFILE);
+    }
+    m_nSize = (uint64_t)fileStat.st_size;
+
+    // Empty files can not be mapped
+    if (m_nSize > 0) {
+        void* pMapping = mmap(nullptr, (size_t)m_nSize, PROT_READ, MAP_PRIVATE, nFileDescriptor, 0);
+        if (pMapping == MAP_FAILED) {
+            close(nFileDescriptor);
+            throw ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_COULDNOTREADSIMULATIONFILE);
+        }
+
+        // The file is read front to back exactly once
+        madvise(pMapping, (size_t)m_nSize, MADV_SEQUENTIAL);
+
+        m_pData = (const char*)pMapping;
+    }
+
+    // The mapping stays valid after closing the descriptor
+    close(nFileDescriptor);
+#endif
+}
+
+CSMCMappedFile::~CSMCMappedFile()
+{
+#ifdef _WIN32
+    if (m_pData != nullptr)
+        UnmapViewOfFile(m_pData);
+    if (m_hMapping != nullptr)
+        CloseHandle((HANDLE)m_hMapping);
+    if (m_hFile != INVALID_HANDLE_VALUE)
+        CloseHandle((HANDLE)m_hFile);
+#else
+    if (m_pData != nullptr)
+        munmap((void*)m_pData, (size_t)m_nSize);
+#endif
+    m_pData = nullptr;
+    m_nSize = 0;
+}
+
+const char* CSMCMappedFile::getData()
+{
+    return m_pData;
+}
+
+uint64_t CSMCMappedFile::getSize()
+{
+    return m_nSize;
+}
+
+void CSMCMappedFile::splitIntoChunks(uint64_t nStartOffset, size_t nChunkSize, std::vector<sSMCFileChunk>& chunks)
+{
+    chunks.clear();
+
+    if (nChunkSize == 0)
+        throw ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_INVALIDPARAM);
+
+    if ((m_pData == nullptr) || (nStartOffset >= m_nSize))
+        return;
+
+    const char* pEnd = m_pData + m_nSize;
+    const char* pChunkStart = m_pData + nStartOffset;
+
+    while (pChunkStart < pEnd) {
+        const char* pChunkEnd = pEnd;
+        if ((size_t)(pEnd - pChunkStart) > nChunkSize)
+            pChunkEnd = skipLineBreak(findLineEnd(pChunkStart + nChunkSize, pEnd), pEnd);
+
+        chunks.push_back({ pChunkStart, pChunkEnd });
+        pChunkStart = pChunkEnd;
+    }
+}
+
+const char* CSMCMappedFile::findLineEnd(const char* pLineStart, const char* pEnd)
+{
+    const char* pPtr = pLineStart;
+    while ((pPtr < pEnd) && (*pPtr != '\n') && (*pPtr != '\r'))
+        pPtr++;
+
+    return pPtr;
+}
+
+const char* CSMCMappedFile::skipLineBreak(const char* pLineEnd, const char* pEnd)
+{
+    if (pLineEnd >= pEnd)
+        return pEnd;
+
+    if ((*pLineEnd == '\r') && (pLineEnd + 1 < pEnd) && (*(pLineEnd + 1) == '\n'))
+        return pLineEnd + 2;
+
+    return pLineEnd + 1;
+}
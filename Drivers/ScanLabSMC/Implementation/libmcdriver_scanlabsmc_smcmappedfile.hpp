@@ -0,0 +1,94 @@
+/*++
+
+Copyright (C) 2023 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the Autodesk Inc. nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 'AS IS' AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+Abstract: This is the class declaration of CSMCMappedFile
+
+*/
+
+
+#ifndef __LIBMCDRIVER_SCANLABSMC_SMCMAPPEDFILE
+#define __LIBMCDRIVER_SCANLABSMC_SMCMAPPEDFILE
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <cstdint>
+
+#define SCANLABSMC_PARSERCHUNKSIZE (4 * 1024 * 1024)
+
+namespace LibMCDriver_ScanLabSMC {
+namespace Impl {
+
+typedef struct _sSMCFileChunk {
+	const char* m_pStart;
+	const char* m_pEnd;
+} sSMCFileChunk;
+
+// Read-only mapping of a simulation or log record file. The file content is paged in on access,
+// so that files of several hundred MB are parsed without being copied into a buffer first.
+class CSMCMappedFile {
+private:
+
+	const char* m_pData;
+	uint64_t m_nSize;
+
+#ifdef _WIN32
+	void* m_hFile;
+	void* m_hMapping;
+#endif
+
+public:
+
+	CSMCMappedFile(const std::string& sAbsoluteFileNameUTF8);
+
+	virtual ~CSMCMappedFile();
+
+	// Returns nullptr for empty files.
+	const char* getData();
+
+	uint64_t getSize();
+
+	// Splits the file from nStartOffset on into chunks of roughly nChunkSize bytes.
+	// Every chunk ends after a line break, so that lines are never split between chunks.
+	void splitIntoChunks(uint64_t nStartOffset, size_t nChunkSize, std::vector<sSMCFileChunk>& chunks);
+
+	// Returns the end of the line that starts at pLineStart (excluding the line break).
+	static const char* findLineEnd(const char* pLineStart, const char* pEnd);
+
+	// Returns the start of the next line. Treats "\r\n", "\r" and "\n" as one line break.
+	static const char* skipLineBreak(const char* pLineEnd, const char* pEnd);
+
+};
+
+typedef std::shared_ptr<CSMCMappedFile> PSMCMappedFile;
+
+} // namespace Impl
+} // namespace LibMCDriver_ScanLabSMC
+
+#endif // __LIBMCDRIVER_SCANLABSMC_SMCMAPPEDFILE
@@ -0,0 +1,145 @@
+/*++
+
+Copyright (C) 2023 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the Autodesk Inc. nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 'AS IS' AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+Abstract: This is the class definition of CSMCParserWorkerPool
+
+*/
+
+#include "libmcdriver_scanlabsmc_smcparserworkerpool.hpp"
+#include "libmcdriver_scanlabsmc_interfaceexception.hpp"
+
+using namespace LibMCDriver_ScanLabSMC::Impl;
+
+CSMCParserWorkerPool::CSMCParserWorkerPool(uint32_t nThreadCount)
+    : m_pProcessChunk(nullptr), m_nCount(0), m_nNextIndex(0), m_nGeneration(0), m_nBusyWorkerCount(0), m_bShutdown(false)
+{
+    if ((nThreadCount < 1) || (nThreadCount > SCANLABSMC_PARSERMAXTHREADCOUNT))
+        throw ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_INVALIDPARSERTHREADCOUNT, "invalid parser thread count: " + std::to_string(nThreadCount));
+
+    m_Workers.reserve(nThreadCount - 1);
+    for (uint32_t nWorkerIndex = 1; nWorkerIndex < nThreadCount; nWorkerIndex++)
+        m_Workers.push_back(std::thread(&CSMCParserWorkerPool::workerLoop, this));
+}
+
+CSMCParserWorkerPool::~CSMCParserWorkerPool()
+{
+    {
+        std::lock_guard<std::mutex> lockGuard(m_StateMutex);
+        m_bShutdown = true;
+    }
+    m_WorkAvailableSignal.notify_all();
+
+    for (auto& worker : m_Workers)
+        worker.join();
+}
+
+uint32_t CSMCParserWorkerPool::getThreadCount()
+{
+    return (uint32_t)m_Workers.size() + 1;
+}
+
+void CSMCParserWorkerPool::workerLoop()
+{
+    uint64_t nLastGeneration = 0;
+
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(m_StateMutex);
+            m_WorkAvailableSignal.wait(lock, [this, nLastGeneration]() { return m_bShutdown || (m_nGeneration != nLastGeneration); });
+            if (m_bShutdown)
+                return;
+
+            nLastGeneration = m_nGeneration;
+        }
+
+        processIndices();
+
+        {
+            std::lock_guard<std::mutex> lockGuard(m_StateMutex);
+            m_nBusyWorkerCount--;
+            if (m_nBusyWorkerCount == 0)
+                m_WorkFinishedSignal.notify_all();
+        }
+    }
+}
+
+void CSMCParserWorkerPool::processIndices()
+{
+    try {
+        size_t nIndex;
+        while ((nIndex = m_nNextIndex.fetch_add(1)) < m_nCount)
+            (*m_pProcessChunk)(nIndex);
+    }
+    catch (...) {
+        std::lock_guard<std::mutex> lockGuard(m_StateMutex);
+        if (!m_pFirstException)
+            m_pFirstException = std::current_exception();
+
+        // Let the other threads run out of work
+        m_nNextIndex.store(m_nCount);
+    }
+}
+
+void CSMCParserWorkerPool::processInParallel(size_t nCount, const std::function<void(size_t nIndex)>& processChunk)
+{
+    if (m_Workers.empty() || (nCount <= 1)) {
+        for (size_t nIndex = 0; nIndex < nCount; nIndex++)
+            processChunk(nIndex);
+        return;
+    }
+
+    std::lock_guard<std::mutex> callLockGuard(m_CallMutex);
+
+    {
+        std::lock_guard<std::mutex> lockGuard(m_StateMutex);
+        m_pProcessChunk = &processChunk;
+        m_nCount = nCount;
+        m_nNextIndex.store(0);
+        m_pFirstException = nullptr;
+        m_nBusyWorkerCount = m_Workers.size();
+        m_nGeneration++;
+    }
+    m_WorkAvailableSignal.notify_all();
+
+    // The calling thread takes part in the work
+    processIndices();
+
+    std::exception_ptr pException;
+    {
+        std::unique_lock<std::mutex> lock(m_StateMutex);
+        m_WorkFinishedSignal.wait(lock, [this]() { return m_nBusyWorkerCount == 0; });
+
+        m_pProcessChunk = nullptr;
+        pException = m_pFirstException;
+        m_pFirstException = nullptr;
+    }
+
+    if (pException)
+        std::rethrow_exception(pException);
+}
@@ -0,0 +1,101 @@
+/*++
+
+Copyright (C) 2023 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the Autodesk Inc. nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 'AS IS' AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+Abstract: This is the class declaration of CSMCParserWorkerPool
+
+*/
+
+
+#ifndef __LIBMCDRIVER_SCANLABSMC_SMCPARSERWORKERPOOL
+#define __LIBMCDRIVER_SCANLABSMC_SMCPARSERWORKERPOOL
+
+#include <vector>
+#include <memory>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <exception>
+#include <cstdint>
+
+#define SCANLABSMC_PARSERDEFAULTTHREADCOUNT 1
+#define SCANLABSMC_PARSERMAXTHREADCOUNT 8
+
+namespace LibMCDriver_ScanLabSMC {
+namespace Impl {
+
+// Worker threads that tokenize file chunks for the simulation and log record parsers.
+// The threads are started once per SMC context and are reused by every parse.
+class CSMCParserWorkerPool {
+private:
+
+	std::vector<std::thread> m_Workers;
+
+	// Only one call of processInParallel runs at a time
+	std::mutex m_CallMutex;
+
+	std::mutex m_StateMutex;
+	std::condition_variable m_WorkAvailableSignal;
+	std::condition_variable m_WorkFinishedSignal;
+
+	const std::function<void(size_t nIndex)>* m_pProcessChunk;
+	size_t m_nCount;
+	std::atomic<size_t> m_nNextIndex;
+	uint64_t m_nGeneration;
+	size_t m_nBusyWorkerCount;
+	bool m_bShutdown;
+	std::exception_ptr m_pFirstException;
+
+	void workerLoop();
+
+	void processIndices();
+
+public:
+
+	// The calling thread of processInParallel counts as one of nThreadCount threads,
+	// so a thread count of 1 does not start any worker thread.
+	CSMCParserWorkerPool(uint32_t nThreadCount);
+
+	virtual ~CSMCParserWorkerPool();
+
+	uint32_t getThreadCount();
+
+	// Calls processChunk for every index in [0, nCount). The first exception of any thread
+	// is rethrown after all threads have finished.
+	void processInParallel(size_t nCount, const std::function<void(size_t nIndex)>& processChunk);
+
+};
+
+typedef std::shared_ptr<CSMCParserWorkerPool> PSMCParserWorkerPool;
+
+} // namespace Impl
+} // namespace LibMCDriver_ScanLabSMC
+
+#endif // __LIBMCDRIVER_SCANLABSMC_SMCPARSERWORKERPOOL
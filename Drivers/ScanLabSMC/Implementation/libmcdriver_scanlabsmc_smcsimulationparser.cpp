@@ -38,180 +38,293 @@ Abstract: This is a stub class definition of CSMCJob
 // Include custom headers here.
 
 #include <array>
-#include <thread>
-#include <iostream>
 #include <algorithm>
-#include <fstream>
+#include <numeric>
 #include <sstream>
+#include <charconv>
+#include <string_view>
+#include <cctype>
 
-#ifdef _WIN32
-#endif
+#define SCANLABSMC_SIMULATION_TIMESTAMPINCREMENT 10.0
 
 using namespace LibMCDriver_ScanLabSMC::Impl;
 
-CSMCSimulationParser::CSMCSimulationParser(const std::string& sAbsoluteFileNameUTF8)
+template<typename T>
+static T parseSimulationValue(const std::string_view& sField)
 {
-    
-#ifdef _WIN32
-    if (sAbsoluteFileNameUTF8.length () > 65536)
-        throw ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_INVALIDPARAM);
+    const char* pData = sField.data();
+    const char* pEnd = pData + sField.size();
 
-    int nLength = (int)sAbsoluteFileNameUTF8.length();
-    int nBufferSize = nLength * 2 + 2;
-    std::vector<wchar_t> wsLibraryFileName(nBufferSize);
-    int nResult = MultiByteToWideChar(CP_UTF8, 0, sAbsoluteFileNameUTF8.c_str(), nLength, &wsLibraryFileName[0], nBufferSize);
-    if (nResult == 0)
-        throw ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_INVALIDSIMULATIONFILENAME);
-
-    std::ifstream file(wsLibraryFileName.data (), std::ios::in);
-#else
-    std::ifstream file(sAbsoluteFileNameUTF8, std::ios::in);
-#endif
-
-
-    if (!file.is_open ()) 
-        throw ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_COULDNOTOOPENSIMULATIONFILE);
-    
-    std::string line;
-    double timestamp = 0;
-    int numberOfCoordinates = 0;
-    int scanDevices = 0;
-    int stages = 0;
+    while ((pData < pEnd) && std::isspace(static_cast<unsigned char>(*pData)))
+        pData++;
 
-        while (std::getline(file, line)) {
-
-            if (!line.empty()) {
-                if (line.rfind("<!--Simulation output", 0) == 0) {
-                    std::istringstream iss(line);
-                    std::string item;
-                    while (iss >> item) {
-                        if (item.find("ScanDevices") == 0) {
-                            scanDevices = std::stoi(item.substr(13, item.size() - 14));
-                        }
-                        else if (item.find("Stage") == 0 && item.find("StageDelay") != 0) {
-                            std::string stagesRaw = item.substr(7, item.size() - 8);
-                            stages = (stagesRaw == "None") ? 0 : std::stoi(stagesRaw.substr(5));
-                        }
-                    }
-                    numberOfCoordinates = scanDevices * 2 + stages * 2;
-                }
+    // from_chars does not accept an explicit plus sign
+    if ((pData < pEnd) && (*pData == '+'))
+        pData++;
 
-                if (line[0] == '+' || line[0] == '-') {
-                    std::istringstream iss(line);
-                    std::string token;
-                    std::vector<std::string> data;
-
-                    sSMCSimulationEntry newEntry;
-
-                    while (std::getline(iss, token, ';')) {
-                        data.push_back(token);
-                    }
-
-                    if (data.size() > 3) {
-                        int numLaserOnDelays = std::stoi(data[numberOfCoordinates]);
-                        int numLaserOffDelays = std::stoi(data[numberOfCoordinates + 1 + numLaserOnDelays]);
-
-                        newEntry.m_dCoordinates[0] = std::stod(data[0]);
-                        newEntry.m_dCoordinates[1] = std::stod(data[1]);
-                        newEntry.m_dCoordinates[2] = 0.0;
-
-                        newEntry.m_dLaserToggle = std::stoi(data[numberOfCoordinates + 2 + numLaserOnDelays + numLaserOffDelays]);
-                        newEntry.m_dActiveChannel1 = std::stod(data[numberOfCoordinates + 3 + numLaserOnDelays + numLaserOffDelays]);
-                        newEntry.m_dActiveChannel2 = std::stod(data[numberOfCoordinates + 4 + numLaserOnDelays + numLaserOffDelays]);
-                        newEntry.m_CommandIndex = std::stoi(data[numberOfCoordinates + 5 + numLaserOnDelays + numLaserOffDelays]);
-
-                        double tempTimestamp = timestamp + 10;
-                        if (numLaserOnDelays > 0) {
-                            for (int i = 0; i < numLaserOnDelays; i++) {
-                                double timeStep = std::stod(data[numberOfCoordinates + 1 + i]);
-                                timestamp = tempTimestamp + timeStep;
-
-                                newEntry.m_dTimestamp = timestamp;
-                                m_Entries.push_back(newEntry);
-                            }
-                            timestamp = tempTimestamp;
-                        }
-                        if (numLaserOffDelays > 0) {
-                            for (int i = 0; i < numLaserOffDelays; i++) {
-                                double timeStep = std::stod(data[numberOfCoordinates + 2 + numLaserOnDelays + i]);
-                                timestamp = tempTimestamp + timeStep;
-
-                                newEntry.m_dTimestamp = timestamp;
-                                m_Entries.push_back(newEntry);
-                            }
-                            timestamp = tempTimestamp;
-                        }
-                        if (numLaserOnDelays == 0 && numLaserOffDelays == 0) {
-
-                            newEntry.m_dTimestamp = tempTimestamp;
-                            m_Entries.push_back(newEntry);
-
-                            timestamp += 10;
-                        }
-                    }
-                }
-            }
-        }
-
-        std::sort(m_Entries.begin(), m_Entries.end(),
-            [](const sSMCSimulationEntry& x, const sSMCSimulationEntry& y) { return x.m_dTimestamp < y.m_dTimestamp; });
+    T value = 0;
+    auto [ptr, ec] = std::from_chars(pData, pEnd, value);
+    if (ec != std::errc())
+        throw ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_COULDNOTREADSIMULATIONFILE);
 
+    return value;
 }
 
-CSMCSimulationParser::~CSMCSimulationParser()
+template<typename T>
+static void reorderValues(std::vector<T>& values, const std::vector<size_t>& permutation)
 {
+    std::vector<T> sortedValues(values.size());
+    for (size_t nIndex = 0; nIndex < permutation.size(); nIndex++)
+        sortedValues[nIndex] = values[permutation[nIndex]];
 
+    values.swap(sortedValues);
 }
 
-size_t CSMCSimulationParser::getCount()
+template<typename T>
+static void appendValues(std::vector<T>& values, std::vector<T>& chunkValues)
 {
-    return m_Entries.size();
+    values.insert(values.end(), chunkValues.begin(), chunkValues.end());
+    std::vector<T>().swap(chunkValues);
 }
 
-sSMCSimulationEntry& CSMCSimulationParser::getEntry(size_t nIndex)
+CSMCSimulationParser::CSMCSimulationParser(const std::string& sAbsoluteFileNameUTF8, PSMCParserWorkerPool pWorkerPool)
+    : m_pWorkerPool(pWorkerPool), m_nNumberOfCoordinates(0), m_nEntryCount(0)
 {
-    return m_Entries.at(nIndex);
+    if (pWorkerPool.get() == nullptr)
+        throw ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_INVALIDPARAM);
+
+    m_Columns.m_nLineCount = 0;
+
+    m_pFile = std::make_shared<CSMCMappedFile>(sAbsoluteFileNameUTF8);
+
+    uint64_t nDataOffset = parseHeader();
+
+    std::vector<sSMCFileChunk> chunks;
+    m_pFile->splitIntoChunks(nDataOffset, SCANLABSMC_PARSERCHUNKSIZE, chunks);
+
+    // Only a few batches of chunks are held in tokenized form at a time
+    size_t nBatchSize = (size_t)m_pWorkerPool->getThreadCount() * 2;
+    std::vector<sSMCSimulationColumns> batchColumns;
+
+    for (size_t nBatchStart = 0; nBatchStart < chunks.size(); nBatchStart += nBatchSize) {
+        size_t nBatchCount = std::min(nBatchSize, chunks.size() - nBatchStart);
+
+        batchColumns.clear();
+        batchColumns.resize(nBatchCount);
+
+        m_pWorkerPool->processInParallel(nBatchCount, [this, &chunks, &batchColumns, nBatchStart](size_t nIndex) {
+            tokenizeChunk(chunks.at(nBatchStart + nIndex), batchColumns.at(nIndex));
+        });
+
+        for (auto& chunkColumns : batchColumns)
+            appendChunk(chunkColumns);
+    }
+
+    sortByTimestamp();
+
+    m_nEntryCount = m_Columns.m_Timestamps.size();
 }
 
-void CSMCSimulationParser::readTimestampValues(std::vector<double>& values)
+CSMCSimulationParser::~CSMCSimulationParser()
 {
-    values.resize(m_Entries.size());
 
-    if (m_Entries.size() > 0) {
-        double* pTarget = values.data();
+}
+
+uint64_t CSMCSimulationParser::parseHeader()
+{
+    const char* pData = m_pFile->getData();
+    const char* pEnd = pData + m_pFile->getSize();
+    const char* pLineStart = pData;
 
-        for (auto& entry : m_Entries) {
-            *pTarget = entry.m_dTimestamp;
-            pTarget++;
+    int scanDevices = 0;
+    int stages = 0;
+
+    // The header precedes the simulation data lines
+    while (pLineStart < pEnd) {
+        if ((*pLineStart == '+') || (*pLineStart == '-'))
+            break;
+
+        const char* pLineEnd = CSMCMappedFile::findLineEnd(pLineStart, pEnd);
+        std::string line(pLineStart, pLineEnd);
+
+        if (line.rfind("<!--Simulation output", 0) == 0) {
+            std::istringstream iss(line);
+            std::string item;
+            while (iss >> item) {
+                if (item.find("ScanDevices") == 0) {
+                    scanDevices = std::stoi(item.substr(13, item.size() - 14));
+                }
+                else if (item.find("Stage") == 0 && item.find("StageDelay") != 0) {
+                    std::string stagesRaw = item.substr(7, item.size() - 8);
+                    stages = (stagesRaw == "None") ? 0 : std::stoi(stagesRaw.substr(5));
+                }
+            }
+            m_nNumberOfCoordinates = scanDevices * 2 + stages * 2;
         }
+
+        pLineStart = CSMCMappedFile::skipLineBreak(pLineEnd, pEnd);
     }
+
+    return (uint64_t)(pLineStart - pData);
 }
 
-void CSMCSimulationParser::readXValues(std::vector<double>& values)
+void CSMCSimulationParser::tokenizeChunk(const sSMCFileChunk& chunk, sSMCSimulationColumns& chunkColumns)
 {
-    values.resize(m_Entries.size());
+    const char* pEnd = chunk.m_pEnd;
+    const char* pLineStart = chunk.m_pStart;
+
+    size_t nCoordinates = m_nNumberOfCoordinates;
+    std::vector<std::string_view> data;
+    double dTimestamp = 0.0;
+
+    chunkColumns.m_nLineCount = 0;
+
+    while (pLineStart < pEnd) {
+        const char* pLineEnd = CSMCMappedFile::findLineEnd(pLineStart, pEnd);
 
-    if (m_Entries.size() > 0) {
-        double* pTarget = values.data();
+        if ((pLineEnd > pLineStart) && ((*pLineStart == '+') || (*pLineStart == '-'))) {
 
-        for (auto& entry : m_Entries) {
-            *pTarget = entry.m_dCoordinates[0];
-            pTarget++;
+            // Split into fields. A trailing separator does not start another field.
+            data.clear();
+            const char* pFieldStart = pLineStart;
+            for (const char* pPtr = pLineStart; pPtr < pLineEnd; pPtr++) {
+                if (*pPtr == ';') {
+                    data.push_back(std::string_view(pFieldStart, pPtr - pFieldStart));
+                    pFieldStart = pPtr + 1;
+                }
+            }
+            if (pFieldStart < pLineEnd)
+                data.push_back(std::string_view(pFieldStart, pLineEnd - pFieldStart));
+
+            if (data.size() > 3) {
+                if (data.size() <= nCoordinates + 1)
+                    throw ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_COULDNOTREADSIMULATIONFILE);
+                int32_t numLaserOnDelays = parseSimulationValue<int32_t>(data[nCoordinates]);
+                if ((numLaserOnDelays < 0) || ((size_t)numLaserOnDelays + nCoordinates + 1 >= data.size()))
+                    throw ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_COULDNOTREADSIMULATIONFILE);
+                int32_t numLaserOffDelays = parseSimulationValue<int32_t>(data[nCoordinates + 1 + numLaserOnDelays]);
+                if ((numLaserOffDelays < 0) || (nCoordinates + 5 + (size_t)numLaserOnDelays + (size_t)numLaserOffDelays >= data.size()))
+                    throw ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_COULDNOTREADSIMULATIONFILE);
+
+                size_t nChannelOffset = nCoordinates + 2 + numLaserOnDelays + numLaserOffDelays;
+
+                double dX = parseSimulationValue<double>(data[0]);
+                double dY = parseSimulationValue<double>(data[1]);
+                int32_t nLaserToggle = parseSimulationValue<int32_t>(data[nChannelOffset]);
+                double dActiveChannel1 = parseSimulationValue<double>(data[nChannelOffset + 1]);
+                double dActiveChannel2 = parseSimulationValue<double>(data[nChannelOffset + 2]);
+                int32_t nCommandIndex = parseSimulationValue<int32_t>(data[nChannelOffset + 3]);
+
+                dTimestamp += SCANLABSMC_SIMULATION_TIMESTAMPINCREMENT;
+
+                // Every laser on and off delay results in an entry. Lines without delays result in one entry.
+                size_t nEntryCount = (size_t)numLaserOnDelays + (size_t)numLaserOffDelays;
+                if (nEntryCount == 0) {
+                    chunkColumns.m_Timestamps.push_back(dTimestamp);
+                    nEntryCount = 1;
+                }
+                else {
+                    for (int32_t nIndex = 0; nIndex < numLaserOnDelays; nIndex++)
+                        chunkColumns.m_Timestamps.push_back(dTimestamp + parseSimulationValue<double>(data[nCoordinates + 1 + nIndex]));
+                    for (int32_t nIndex = 0; nIndex < numLaserOffDelays; nIndex++)
+                        chunkColumns.m_Timestamps.push_back(dTimestamp + parseSimulationValue<double>(data[nCoordinates + 2 + numLaserOnDelays + nIndex]));
+                }
+
+                chunkColumns.m_XValues.insert(chunkColumns.m_XValues.end(), nEntryCount, dX);
+                chunkColumns.m_YValues.insert(chunkColumns.m_YValues.end(), nEntryCount, dY);
+                chunkColumns.m_LaserToggleValues.insert(chunkColumns.m_LaserToggleValues.end(), nEntryCount, nLaserToggle);
+                chunkColumns.m_ActiveChannel1Values.insert(chunkColumns.m_ActiveChannel1Values.end(), nEntryCount, dActiveChannel1);
+                chunkColumns.m_ActiveChannel2Values.insert(chunkColumns.m_ActiveChannel2Values.end(), nEntryCount, dActiveChannel2);
+                chunkColumns.m_CommandIndexValues.insert(chunkColumns.m_CommandIndexValues.end(), nEntryCount, nCommandIndex);
+
+                chunkColumns.m_nLineCount++;
+            }
         }
+
+        pLineStart = CSMCMappedFile::skipLineBreak(pLineEnd, pEnd);
     }
 }
 
-void CSMCSimulationParser::readYValues(std::vector<double>& values)
+void CSMCSimulationParser::appendChunk(sSMCSimulationColumns& chunkColumns)
 {
-    values.resize(m_Entries.size());
+    // Timestamps advance by a fixed increment per line, so the chunk only needs to be shifted
+    double dTimestampOffset = (double)m_Columns.m_nLineCount * SCANLABSMC_SIMULATION_TIMESTAMPINCREMENT;
+    for (auto& dTimestamp : chunkColumns.m_Timestamps)
+        dTimestamp += dTimestampOffset;
+
+    appendValues(m_Columns.m_Timestamps, chunkColumns.m_Timestamps);
+    appendValues(m_Columns.m_XValues, chunkColumns.m_XValues);
+    appendValues(m_Columns.m_YValues, chunkColumns.m_YValues);
+    appendValues(m_Columns.m_LaserToggleValues, chunkColumns.m_LaserToggleValues);
+    appendValues(m_Columns.m_ActiveChannel1Values, chunkColumns.m_ActiveChannel1Values);
+    appendValues(m_Columns.m_ActiveChannel2Values, chunkColumns.m_ActiveChannel2Values);
+    appendValues(m_Columns.m_CommandIndexValues, chunkColumns.m_CommandIndexValues);
+
+    m_Columns.m_nLineCount += chunkColumns.m_nLineCount;
+}
 
-    if (m_Entries.size() > 0) {
-        double* pTarget = values.data();
+void CSMCSimulationParser::sortByTimestamp()
+{
+    auto& timestamps = m_Columns.m_Timestamps;
+    if (std::is_sorted(timestamps.begin(), timestamps.end()))
+        return;
+
+    // Laser delays may move entries before the previous line
+    std::vector<size_t> permutation(timestamps.size());
+    std::iota(permutation.begin(), permutation.end(), 0);
+    std::stable_sort(permutation.begin(), permutation.end(),
+        [&timestamps](size_t nIndex1, size_t nIndex2) { return timestamps[nIndex1] < timestamps[nIndex2]; });
+
+    reorderValues(m_Columns.m_Timestamps, permutation);
+    reorderValues(m_Columns.m_XValues, permutation);
+    reorderValues(m_Columns.m_YValues, permutation);
+    reorderValues(m_Columns.m_LaserToggleValues, permutation);
+    reorderValues(m_Columns.m_ActiveChannel1Values, permutation);
+    reorderValues(m_Columns.m_ActiveChannel2Values, permutation);
+    reorderValues(m_Columns.m_CommandIndexValues, permutation);
+}
 
-        for (auto& entry : m_Entries) {
-            *pTarget = entry.m_dCoordinates[1];
-            pTarget++;
-        }
-    }
+size_t CSMCSimulationParser::getCount()
+{
+    return m_nEntryCount;
+}
+
+const sSMCSimulationColumns& CSMCSimulationParser::getColumns()
+{
+    return m_Columns;
+}
+
+void CSMCSimulationParser::writeToDataTable(LibMCEnv::PDataTable pDataTable)
+{
+    if (pDataTable.get() == nullptr)
+        throw ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_INVALIDPARAM);
+
+    pDataTable->AddColumn("timestamp", "Timestamp", LibMCEnv::eDataTableColumnType::DoubleColumn);
+    pDataTable->AddColumn("x", "X", LibMCEnv::eDataTableColumnType::DoubleColumn);
+    pDataTable->AddColumn("y", "Y", LibMCEnv::eDataTableColumnType::DoubleColumn);
+    pDataTable->AddColumn("laseron", "LaserOn", LibMCEnv::eDataTableColumnType::Int32Column);
+    pDataTable->AddColumn("active1", "Active Channel 1", LibMCEnv::eDataTableColumnType::DoubleColumn);
+    pDataTable->AddColumn("active2", "Active Channel 2", LibMCEnv::eDataTableColumnType::DoubleColumn);
+    pDataTable->AddColumn("cmdindex", "Command Index", LibMCEnv::eDataTableColumnType::Int32Column);
+
+    pDataTable->SetDoubleColumnValues("timestamp", m_Columns.m_Timestamps);
+    std::vector<double>().swap(m_Columns.m_Timestamps);
+
+    pDataTable->SetDoubleColumnValues("x", m_Columns.m_XValues);
+    std::vector<double>().swap(m_Columns.m_XValues);
+
+    pDataTable->SetDoubleColumnValues("y", m_Columns.m_YValues);
+    std::vector<double>().swap(m_Columns.m_YValues);
+
+    pDataTable->SetInt32ColumnValues("laseron", m_Columns.m_LaserToggleValues);
+    std::vector<int32_t>().swap(m_Columns.m_LaserToggleValues);
+
+    pDataTable->SetDoubleColumnValues("active1", m_Columns.m_ActiveChannel1Values);
+    std::vector<double>().swap(m_Columns.m_ActiveChannel1Values);
+
+    pDataTable->SetDoubleColumnValues("active2", m_Columns.m_ActiveChannel2Values);
+    std::vector<double>().swap(m_Columns.m_ActiveChannel2Values);
 
+    pDataTable->SetInt32ColumnValues("cmdindex", m_Columns.m_CommandIndexValues);
+    std::vector<int32_t>().swap(m_Columns.m_CommandIndexValues);
 }
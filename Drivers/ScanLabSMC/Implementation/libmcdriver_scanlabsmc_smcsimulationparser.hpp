@@ -38,6 +38,8 @@ Abstract: This is the class declaration of CSMCJob
 #include "libmcdriver_scanlabsmc_interfaces.hpp"
 
 #include "libmcdriver_scanlabsmc_smccontexthandle.hpp"
+#include "libmcdriver_scanlabsmc_smcmappedfile.hpp"
+#include "libmcdriver_scanlabsmc_smcparserworkerpool.hpp"
 #include "libmcdriver_scanlabsmc_sdk.hpp"
 
 
@@ -45,34 +47,55 @@ namespace LibMCDriver_ScanLabSMC {
 namespace Impl {
 
 
-typedef struct _sSMCSimulationEntry {
-	double m_dTimestamp;
-	double m_dCoordinates[3];
-	int32_t m_dLaserToggle;
-	double m_dActiveChannel1;
-	double m_dActiveChannel2;
-	int32_t m_CommandIndex;
-} sSMCSimulationEntry;
+// Column data of a consecutive range of simulation lines.
+// Timestamps are relative to the start of the range.
+typedef struct _sSMCSimulationColumns {
+	size_t m_nLineCount;
+	std::vector<double> m_Timestamps;
+	std::vector<double> m_XValues;
+	std::vector<double> m_YValues;
+	std::vector<int32_t> m_LaserToggleValues;
+	std::vector<double> m_ActiveChannel1Values;
+	std::vector<double> m_ActiveChannel2Values;
+	std::vector<int32_t> m_CommandIndexValues;
+} sSMCSimulationColumns;
 
 
 class CSMCSimulationParser {
 private:
 
-	std::vector<sSMCSimulationEntry> m_Entries;
+	PSMCMappedFile m_pFile;
+
+	PSMCParserWorkerPool m_pWorkerPool;
+
+	uint32_t m_nNumberOfCoordinates;
+
+	size_t m_nEntryCount;
+
+	sSMCSimulationColumns m_Columns;
+
+	// Reads the simulation output header and returns the offset of the first data line.
+	uint64_t parseHeader();
+
+	void tokenizeChunk(const sSMCFileChunk& chunk, sSMCSimulationColumns& chunkColumns);
+
+	void appendChunk(sSMCSimulationColumns& chunkColumns);
+
+	void sortByTimestamp();
 
 public:
 
-	CSMCSimulationParser(const std::string & sAbsoluteFileName);
+	CSMCSimulationParser(const std::string & sAbsoluteFileName, PSMCParserWorkerPool pWorkerPool);
 
 	virtual ~CSMCSimulationParser();
 
 	size_t getCount();
 
-	sSMCSimulationEntry & getEntry(size_t nIndex);
+	// Parsed columns, sorted by timestamp. Empty after writeToDataTable.
+	const sSMCSimulationColumns& getColumns();
 
-	void readTimestampValues(std::vector<double> & values);
-	void readXValues(std::vector<double>& values);
-	void readYValues(std::vector<double>& values);
+	// Adds the simulation columns to the data table and moves the parsed values into it.
+	void writeToDataTable(LibMCEnv::PDataTable pDataTable);
 
 };
 
@@ -387,6 +387,24 @@ LIBMCDRIVER_SCANLABSMC_DECLSPEC LibMCDriver_ScanLabSMCResult libmcdriver_scanlab
 */
 LIBMCDRIVER_SCANLABSMC_DECLSPEC LibMCDriver_ScanLabSMCResult libmcdriver_scanlabsmc_smcconfiguration_getsendtohardware(LibMCDriver_ScanLabSMC_SMCConfiguration pSMCConfiguration, bool * pSendToHardware);
 
+/**
+* Sets the number of threads that parse simulation and log record files. Default is 1, which parses on the calling thread only.
+*
+* @param[in] pSMCConfiguration - SMCConfiguration instance.
+* @param[in] nThreadCount - Number of parser threads. MUST be between 1 and 8.
+* @return error code or 0 (success)
+*/
+LIBMCDRIVER_SCANLABSMC_DECLSPEC LibMCDriver_ScanLabSMCResult libmcdriver_scanlabsmc_smcconfiguration_setparserthreadcount(LibMCDriver_ScanLabSMC_SMCConfiguration pSMCConfiguration, LibMCDriver_ScanLabSMC_uint32 nThreadCount);
+
+/**
+* Returns the number of threads that parse simulation and log record files.
+*
+* @param[in] pSMCConfiguration - SMCConfiguration instance.
+* @param[out] pThreadCount - Number of parser threads.
+* @return error code or 0 (success)
+*/
+LIBMCDRIVER_SCANLABSMC_DECLSPEC LibMCDriver_ScanLabSMCResult libmcdriver_scanlabsmc_smcconfiguration_getparserthreadcount(LibMCDriver_ScanLabSMC_SMCConfiguration pSMCConfiguration, LibMCDriver_ScanLabSMC_uint32 * pThreadCount);
+
 /**
 * Sets the RTC Serial number. MUST be larger than 0.
 *
@@ -525,6 +525,18 @@ public:
 	*/
 	virtual bool GetSendToHardware() = 0;
 
+	/**
+	* ISMCConfiguration::SetParserThreadCount - Sets the number of threads that parse simulation and log record files. Default is 1, which parses on the calling thread only.
+	* @param[in] nThreadCount - Number of parser threads. MUST be between 1 and 8.
+	*/
+	virtual void SetParserThreadCount(const LibMCDriver_ScanLabSMC_uint32 nThreadCount) = 0;
+
+	/**
+	* ISMCConfiguration::GetParserThreadCount - Returns the number of threads that parse simulation and log record files.
+	* @return Number of parser threads.
+	*/
+	virtual LibMCDriver_ScanLabSMC_uint32 GetParserThreadCount() = 0;
+
 	/**
 	* ISMCConfiguration::SetSerialNumber - Sets the RTC Serial number. MUST be larger than 0.
 	* @param[in] nValue - Value to set.
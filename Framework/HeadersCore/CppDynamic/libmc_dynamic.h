@@ -87,6 +87,16 @@ typedef LibMCResult (*PLibMCStreamData_GetMIMETypePtr) (LibMC_StreamData pStream
 */
 typedef LibMCResult (*PLibMCStreamConnection_GetNewContentPtr) (LibMC_StreamConnection pStreamConnection, LibMC_StreamData * pNewContent);
 
+/**
+* Blocks until new content for the stream is available or the timeout has passed.
+*
+* @param[in] pStreamConnection - StreamConnection instance.
+* @param[in] nTimeOutInMS - Maximum time to wait in milliseconds.
+* @param[out] pNewContent - Stream Data Instance. Null, if no new content arrived in time.
+* @return error code or 0 (success)
+*/
+typedef LibMCResult (*PLibMCStreamConnection_WaitForNewContentPtr) (LibMC_StreamConnection pStreamConnection, LibMC_uint32 nTimeOutInMS, LibMC_StreamData * pNewContent);
+
 /**
 * Returns the number of milliseconds, that the caller should wait before checking for another content.
 *
@@ -209,6 +219,60 @@ typedef LibMCResult (*PLibMCAPIRequestHandler_GetResultDataPtr) (LibMC_APIReques
 */
 typedef LibMCResult (*PLibMCAPIRequestHandler_GetContentDispositionNamePtr) (LibMC_APIRequestHandler pAPIRequestHandler, const LibMC_uint32 nContentDispositionNameBufferSize, LibMC_uint32* pContentDispositionNameNeededChars, char * pContentDispositionNameBuffer);
 
+/**
+* Returns the entity tag of the response. Must be called after Handle.
+*
+* @param[in] pAPIRequestHandler - APIRequestHandler instance.
+* @param[in] nETagBufferSize - size of the buffer (including trailing 0)
+* @param[out] pETagNeededChars - will be filled with the count of the written bytes, or needed buffer size.
+* @param[out] pETagBuffer -  buffer of Strong entity tag including quotes. Empty, if the response is not cacheable., may be NULL
+* @return error code or 0 (success)
+*/
+typedef LibMCResult (*PLibMCAPIRequestHandler_GetETagPtr) (LibMC_APIRequestHandler pAPIRequestHandler, const LibMC_uint32 nETagBufferSize, LibMC_uint32* pETagNeededChars, char * pETagBuffer);
+
+/**
+* Selects a precompressed variant of the response, if the client accepts it. Must be called after Handle and before GetResultData.
+*
+* @param[in] pAPIRequestHandler - APIRequestHandler instance.
+* @param[in] pAcceptEncoding - Value of the Accept-Encoding request header.
+* @param[in] nContentEncodingBufferSize - size of the buffer (including trailing 0)
+* @param[out] pContentEncodingNeededChars - will be filled with the count of the written bytes, or needed buffer size.
+* @param[out] pContentEncodingBuffer -  buffer of Selected content encoding (gzip or deflate). Empty, if the result data is sent unencoded., may be NULL
+* @return error code or 0 (success)
+*/
+typedef LibMCResult (*PLibMCAPIRequestHandler_SelectContentEncodingPtr) (LibMC_APIRequestHandler pAPIRequestHandler, const char * pAcceptEncoding, const LibMC_uint32 nContentEncodingBufferSize, LibMC_uint32* pContentEncodingNeededChars, char * pContentEncodingBuffer);
+
+/**
+* Returns if the result data may be delivered in byte ranges. Must be called after Handle.
+*
+* @param[in] pAPIRequestHandler - APIRequestHandler instance.
+* @param[out] pAcceptsRanges - True, if the response supports range requests.
+* @return error code or 0 (success)
+*/
+typedef LibMCResult (*PLibMCAPIRequestHandler_AcceptsRangesPtr) (LibMC_APIRequestHandler pAPIRequestHandler, bool * pAcceptsRanges);
+
+/**
+* Returns the size of the result data in the selected content encoding. Must be called after Handle.
+*
+* @param[in] pAPIRequestHandler - APIRequestHandler instance.
+* @param[out] pSize - Size of the result data in bytes.
+* @return error code or 0 (success)
+*/
+typedef LibMCResult (*PLibMCAPIRequestHandler_GetResultSizePtr) (LibMC_APIRequestHandler pAPIRequestHandler, LibMC_uint64 * pSize);
+
+/**
+* Returns a byte range of the resulting data. Call only after Handle().
+*
+* @param[in] pAPIRequestHandler - APIRequestHandler instance.
+* @param[in] nOffset - Offset of the first byte to return.
+* @param[in] nLength - Number of bytes to return. Offset plus Length MUST NOT exceed the result size.
+* @param[in] nDataBufferSize - Number of elements in buffer
+* @param[out] pDataNeededCount - will be filled with the count of the written elements, or needed buffer size.
+* @param[out] pDataBuffer - uint8  buffer of Data buffer.
+* @return error code or 0 (success)
+*/
+typedef LibMCResult (*PLibMCAPIRequestHandler_GetResultDataRangePtr) (LibMC_APIRequestHandler pAPIRequestHandler, LibMC_uint64 nOffset, LibMC_uint64 nLength, const LibMC_uint64 nDataBufferSize, LibMC_uint64* pDataNeededCount, LibMC_uint8 * pDataBuffer);
+
 /*************************************************************************************************************************
  Class definition for MCContext
 **************************************************************************************************************************/
@@ -426,6 +490,7 @@ typedef struct {
 	PLibMCStreamData_GetDataPtr m_StreamData_GetData;
 	PLibMCStreamData_GetMIMETypePtr m_StreamData_GetMIMEType;
 	PLibMCStreamConnection_GetNewContentPtr m_StreamConnection_GetNewContent;
+	PLibMCStreamConnection_WaitForNewContentPtr m_StreamConnection_WaitForNewContent;
 	PLibMCStreamConnection_GetIdleDelayPtr m_StreamConnection_GetIdleDelay;
 	PLibMCStreamConnection_GetStreamTypePtr m_StreamConnection_GetStreamType;
 	PLibMCAPIRequestHandler_ExpectsRawBodyPtr m_APIRequestHandler_ExpectsRawBody;
@@ -437,6 +502,11 @@ typedef struct {
 	PLibMCAPIRequestHandler_HandlePtr m_APIRequestHandler_Handle;
 	PLibMCAPIRequestHandler_GetResultDataPtr m_APIRequestHandler_GetResultData;
 	PLibMCAPIRequestHandler_GetContentDispositionNamePtr m_APIRequestHandler_GetContentDispositionName;
+	PLibMCAPIRequestHandler_GetETagPtr m_APIRequestHandler_GetETag;
+	PLibMCAPIRequestHandler_SelectContentEncodingPtr m_APIRequestHandler_SelectContentEncoding;
+	PLibMCAPIRequestHandler_AcceptsRangesPtr m_APIRequestHandler_AcceptsRanges;
+	PLibMCAPIRequestHandler_GetResultSizePtr m_APIRequestHandler_GetResultSize;
+	PLibMCAPIRequestHandler_GetResultDataRangePtr m_APIRequestHandler_GetResultDataRange;
 	PLibMCMCContext_RegisterLibraryPathPtr m_MCContext_RegisterLibraryPath;
 	PLibMCMCContext_SetTempBasePathPtr m_MCContext_SetTempBasePath;
 	PLibMCMCContext_ParseConfigurationPtr m_MCContext_ParseConfiguration;
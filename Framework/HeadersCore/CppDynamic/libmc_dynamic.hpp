@@ -796,6 +796,22 @@ public:
 			case LIBMC_ERROR_TELEMETRYCHUNKIDMISMATCH: return "TELEMETRYCHUNKIDMISMATCH";
 			case LIBMC_ERROR_TELEMETRYCHUNKISREADONLY: return "TELEMETRYCHUNKISREADONLY";
 			case LIBMC_ERROR_TELEMETRYCHUNKSCANONLYBEARCHIVEDIFREADONLY: return "TELEMETRYCHUNKSCANONLYBEARCHIVEDIFREADONLY";
+			case LIBMC_ERROR_TOOLPATHLAYERCACHEBOOKKEEPINGERROR: return "TOOLPATHLAYERCACHEBOOKKEEPINGERROR";
+			case LIBMC_ERROR_INVALIDPROFILEVALUEHANDLE: return "INVALIDPROFILEVALUEHANDLE";
+			case LIBMC_ERROR_PROFILEVALUEISNOTNUMERIC: return "PROFILEVALUEISNOTNUMERIC";
+			case LIBMC_ERROR_STREAMNOTFOUND: return "STREAMNOTFOUND";
+			case LIBMC_ERROR_INVALIDSTREAMIDENTIFIER: return "INVALIDSTREAMIDENTIFIER";
+			case LIBMC_ERROR_STREAMTYPEMISMATCH: return "STREAMTYPEMISMATCH";
+			case LIBMC_ERROR_INVALIDSTREAMIMAGEDATA: return "INVALIDSTREAMIMAGEDATA";
+			case LIBMC_ERROR_SYSTEMTASKNOTFOUND: return "SYSTEMTASKNOTFOUND";
+			case LIBMC_ERROR_DUPLICATESYSTEMTASK: return "DUPLICATESYSTEMTASK";
+			case LIBMC_ERROR_INVALIDSYSTEMTASKINTERVAL: return "INVALIDSYSTEMTASKINTERVAL";
+			case LIBMC_ERROR_INVALIDRESULTDATARANGE: return "INVALIDRESULTDATARANGE";
+			case LIBMC_ERROR_INVALIDTOOLPATHLAYERCACHEPARAMETER: return "INVALIDTOOLPATHLAYERCACHEPARAMETER";
+			case LIBMC_ERROR_MISSINGTESTBUILDUUID: return "MISSINGTESTBUILDUUID";
+			case LIBMC_ERROR_MISSINGTESTBUILDNAME: return "MISSINGTESTBUILDNAME";
+			case LIBMC_ERROR_MISSINGTESTBUILDFILENAME: return "MISSINGTESTBUILDFILENAME";
+			case LIBMC_ERROR_EMPTYTESTBUILDFILE: return "EMPTYTESTBUILDFILE";
 		}
 		return "UNKNOWN";
 	}
@@ -1426,6 +1442,22 @@ public:
 			case LIBMC_ERROR_TELEMETRYCHUNKIDMISMATCH: return "Telemetry Chunk ID mismatch.";
 			case LIBMC_ERROR_TELEMETRYCHUNKISREADONLY: return "Telemetry Chunk is readonly.";
 			case LIBMC_ERROR_TELEMETRYCHUNKSCANONLYBEARCHIVEDIFREADONLY: return "Telemetry Chunks can only be archived if readonly.";
+			case LIBMC_ERROR_TOOLPATHLAYERCACHEBOOKKEEPINGERROR: return "Toolpath layer cache memory bookkeeping error.";
+			case LIBMC_ERROR_INVALIDPROFILEVALUEHANDLE: return "Invalid profile value handle.";
+			case LIBMC_ERROR_PROFILEVALUEISNOTNUMERIC: return "Profile value is not of the requested numeric type.";
+			case LIBMC_ERROR_STREAMNOTFOUND: return "Stream not found.";
+			case LIBMC_ERROR_INVALIDSTREAMIDENTIFIER: return "Invalid stream identifier.";
+			case LIBMC_ERROR_STREAMTYPEMISMATCH: return "Stream has already been registered with a different type.";
+			case LIBMC_ERROR_INVALIDSTREAMIMAGEDATA: return "Invalid stream image data. Expected a JPEG image.";
+			case LIBMC_ERROR_SYSTEMTASKNOTFOUND: return "System task not found.";
+			case LIBMC_ERROR_DUPLICATESYSTEMTASK: return "System task has already been registered.";
+			case LIBMC_ERROR_INVALIDSYSTEMTASKINTERVAL: return "Invalid system task interval.";
+			case LIBMC_ERROR_INVALIDRESULTDATARANGE: return "Requested range exceeds the result data.";
+			case LIBMC_ERROR_INVALIDTOOLPATHLAYERCACHEPARAMETER: return "Invalid toolpath layer cache parameter.";
+			case LIBMC_ERROR_MISSINGTESTBUILDUUID: return "Missing test build uuid.";
+			case LIBMC_ERROR_MISSINGTESTBUILDNAME: return "Missing test build name.";
+			case LIBMC_ERROR_MISSINGTESTBUILDFILENAME: return "Missing test build file name.";
+			case LIBMC_ERROR_EMPTYTESTBUILDFILE: return "Empty test build file.";
 		}
 		return "unknown error";
 	}
@@ -1644,6 +1676,7 @@ public:
 	}
 	
 	inline PStreamData GetNewContent();
+	inline PStreamData WaitForNewContent(const LibMC_uint32 nTimeOutInMS);
 	inline LibMC_uint32 GetIdleDelay();
 	inline eStreamConnectionType GetStreamType();
 };
@@ -1671,6 +1704,11 @@ public:
 	inline void Handle(const CInputVector<LibMC_uint8> & RawBodyBuffer, std::string & sContentType, LibMC_uint32 & nHTTPCode);
 	inline void GetResultData(std::vector<LibMC_uint8> & DataBuffer);
 	inline std::string GetContentDispositionName();
+	inline std::string GetETag();
+	inline std::string SelectContentEncoding(const std::string & sAcceptEncoding);
+	inline bool AcceptsRanges();
+	inline LibMC_uint64 GetResultSize();
+	inline void GetResultDataRange(const LibMC_uint64 nOffset, const LibMC_uint64 nLength, std::vector<LibMC_uint8> & DataBuffer);
 };
 	
 /*************************************************************************************************************************
@@ -1814,6 +1852,7 @@ public:
 		pWrapperTable->m_StreamData_GetData = nullptr;
 		pWrapperTable->m_StreamData_GetMIMEType = nullptr;
 		pWrapperTable->m_StreamConnection_GetNewContent = nullptr;
+		pWrapperTable->m_StreamConnection_WaitForNewContent = nullptr;
 		pWrapperTable->m_StreamConnection_GetIdleDelay = nullptr;
 		pWrapperTable->m_StreamConnection_GetStreamType = nullptr;
 		pWrapperTable->m_APIRequestHandler_ExpectsRawBody = nullptr;
@@ -1825,6 +1864,11 @@ public:
 		pWrapperTable->m_APIRequestHandler_Handle = nullptr;
 		pWrapperTable->m_APIRequestHandler_GetResultData = nullptr;
 		pWrapperTable->m_APIRequestHandler_GetContentDispositionName = nullptr;
+		pWrapperTable->m_APIRequestHandler_GetETag = nullptr;
+		pWrapperTable->m_APIRequestHandler_SelectContentEncoding = nullptr;
+		pWrapperTable->m_APIRequestHandler_AcceptsRanges = nullptr;
+		pWrapperTable->m_APIRequestHandler_GetResultSize = nullptr;
+		pWrapperTable->m_APIRequestHandler_GetResultDataRange = nullptr;
 		pWrapperTable->m_MCContext_RegisterLibraryPath = nullptr;
 		pWrapperTable->m_MCContext_SetTempBasePath = nullptr;
 		pWrapperTable->m_MCContext_ParseConfiguration = nullptr;
@@ -1923,6 +1967,15 @@ public:
 		if (pWrapperTable->m_StreamConnection_GetNewContent == nullptr)
 			return LIBMC_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		#ifdef _WIN32
+		pWrapperTable->m_StreamConnection_WaitForNewContent = (PLibMCStreamConnection_WaitForNewContentPtr) GetProcAddress(hLibrary, "libmc_streamconnection_waitfornewcontent");
+		#else // _WIN32
+		pWrapperTable->m_StreamConnection_WaitForNewContent = (PLibMCStreamConnection_WaitForNewContentPtr) dlsym(hLibrary, "libmc_streamconnection_waitfornewcontent");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_StreamConnection_WaitForNewContent == nullptr)
+			return LIBMC_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		#ifdef _WIN32
 		pWrapperTable->m_StreamConnection_GetIdleDelay = (PLibMCStreamConnection_GetIdleDelayPtr) GetProcAddress(hLibrary, "libmc_streamconnection_getidledelay");
 		#else // _WIN32
@@ -2022,6 +2075,51 @@ public:
 		if (pWrapperTable->m_APIRequestHandler_GetContentDispositionName == nullptr)
 			return LIBMC_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		#ifdef _WIN32
+		pWrapperTable->m_APIRequestHandler_GetETag = (PLibMCAPIRequestHandler_GetETagPtr) GetProcAddress(hLibrary, "libmc_apirequesthandler_getetag");
+		#else // _WIN32
+		pWrapperTable->m_APIRequestHandler_GetETag = (PLibMCAPIRequestHandler_GetETagPtr) dlsym(hLibrary, "libmc_apirequesthandler_getetag");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_APIRequestHandler_GetETag == nullptr)
+			return LIBMC_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_APIRequestHandler_SelectContentEncoding = (PLibMCAPIRequestHandler_SelectContentEncodingPtr) GetProcAddress(hLibrary, "libmc_apirequesthandler_selectcontentencoding");
+		#else // _WIN32
+		pWrapperTable->m_APIRequestHandler_SelectContentEncoding = (PLibMCAPIRequestHandler_SelectContentEncodingPtr) dlsym(hLibrary, "libmc_apirequesthandler_selectcontentencoding");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_APIRequestHandler_SelectContentEncoding == nullptr)
+			return LIBMC_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_APIRequestHandler_AcceptsRanges = (PLibMCAPIRequestHandler_AcceptsRangesPtr) GetProcAddress(hLibrary, "libmc_apirequesthandler_acceptsranges");
+		#else // _WIN32
+		pWrapperTable->m_APIRequestHandler_AcceptsRanges = (PLibMCAPIRequestHandler_AcceptsRangesPtr) dlsym(hLibrary, "libmc_apirequesthandler_acceptsranges");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_APIRequestHandler_AcceptsRanges == nullptr)
+			return LIBMC_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_APIRequestHandler_GetResultSize = (PLibMCAPIRequestHandler_GetResultSizePtr) GetProcAddress(hLibrary, "libmc_apirequesthandler_getresultsize");
+		#else // _WIN32
+		pWrapperTable->m_APIRequestHandler_GetResultSize = (PLibMCAPIRequestHandler_GetResultSizePtr) dlsym(hLibrary, "libmc_apirequesthandler_getresultsize");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_APIRequestHandler_GetResultSize == nullptr)
+			return LIBMC_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_APIRequestHandler_GetResultDataRange = (PLibMCAPIRequestHandler_GetResultDataRangePtr) GetProcAddress(hLibrary, "libmc_apirequesthandler_getresultdatarange");
+		#else // _WIN32
+		pWrapperTable->m_APIRequestHandler_GetResultDataRange = (PLibMCAPIRequestHandler_GetResultDataRangePtr) dlsym(hLibrary, "libmc_apirequesthandler_getresultdatarange");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_APIRequestHandler_GetResultDataRange == nullptr)
+			return LIBMC_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		#ifdef _WIN32
 		pWrapperTable->m_MCContext_RegisterLibraryPath = (PLibMCMCContext_RegisterLibraryPathPtr) GetProcAddress(hLibrary, "libmc_mccontext_registerlibrarypath");
 		#else // _WIN32
@@ -2239,6 +2337,10 @@ public:
 		if ( (eLookupError != 0) || (pWrapperTable->m_StreamConnection_GetNewContent == nullptr) )
 			return LIBMC_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		eLookupError = (*pLookup)("libmc_streamconnection_waitfornewcontent", (void**)&(pWrapperTable->m_StreamConnection_WaitForNewContent));
+		if ( (eLookupError != 0) || (pWrapperTable->m_StreamConnection_WaitForNewContent == nullptr) )
+			return LIBMC_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		eLookupError = (*pLookup)("libmc_streamconnection_getidledelay", (void**)&(pWrapperTable->m_StreamConnection_GetIdleDelay));
 		if ( (eLookupError != 0) || (pWrapperTable->m_StreamConnection_GetIdleDelay == nullptr) )
 			return LIBMC_ERROR_COULDNOTFINDLIBRARYEXPORT;
@@ -2283,6 +2385,26 @@ public:
 		if ( (eLookupError != 0) || (pWrapperTable->m_APIRequestHandler_GetContentDispositionName == nullptr) )
 			return LIBMC_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		eLookupError = (*pLookup)("libmc_apirequesthandler_getetag", (void**)&(pWrapperTable->m_APIRequestHandler_GetETag));
+		if ( (eLookupError != 0) || (pWrapperTable->m_APIRequestHandler_GetETag == nullptr) )
+			return LIBMC_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libmc_apirequesthandler_selectcontentencoding", (void**)&(pWrapperTable->m_APIRequestHandler_SelectContentEncoding));
+		if ( (eLookupError != 0) || (pWrapperTable->m_APIRequestHandler_SelectContentEncoding == nullptr) )
+			return LIBMC_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libmc_apirequesthandler_acceptsranges", (void**)&(pWrapperTable->m_APIRequestHandler_AcceptsRanges));
+		if ( (eLookupError != 0) || (pWrapperTable->m_APIRequestHandler_AcceptsRanges == nullptr) )
+			return LIBMC_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libmc_apirequesthandler_getresultsize", (void**)&(pWrapperTable->m_APIRequestHandler_GetResultSize));
+		if ( (eLookupError != 0) || (pWrapperTable->m_APIRequestHandler_GetResultSize == nullptr) )
+			return LIBMC_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libmc_apirequesthandler_getresultdatarange", (void**)&(pWrapperTable->m_APIRequestHandler_GetResultDataRange));
+		if ( (eLookupError != 0) || (pWrapperTable->m_APIRequestHandler_GetResultDataRange == nullptr) )
+			return LIBMC_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		eLookupError = (*pLookup)("libmc_mccontext_registerlibrarypath", (void**)&(pWrapperTable->m_MCContext_RegisterLibraryPath));
 		if ( (eLookupError != 0) || (pWrapperTable->m_MCContext_RegisterLibraryPath == nullptr) )
 			return LIBMC_ERROR_COULDNOTFINDLIBRARYEXPORT;
@@ -2428,6 +2550,23 @@ public:
 		}
 	}
 	
+	/**
+	* CStreamConnection::WaitForNewContent - Blocks until new content for the stream is available or the timeout has passed.
+	* @param[in] nTimeOutInMS - Maximum time to wait in milliseconds.
+	* @return Stream Data Instance. Null, if no new content arrived in time.
+	*/
+	PStreamData CStreamConnection::WaitForNewContent(const LibMC_uint32 nTimeOutInMS)
+	{
+		LibMCHandle hNewContent = nullptr;
+		CheckError(m_pWrapper->m_WrapperTable.m_StreamConnection_WaitForNewContent(m_pHandle, nTimeOutInMS, &hNewContent));
+		
+		if (hNewContent) {
+			return std::make_shared<CStreamData>(m_pWrapper, hNewContent);
+		} else {
+			return nullptr;
+		}
+	}
+	
 	/**
 	* CStreamConnection::GetIdleDelay - Returns the number of milliseconds, that the caller should wait before checking for another content.
 	* @return Idle Delay.
@@ -2572,6 +2711,78 @@ public:
 		return std::string(&bufferContentDispositionName[0]);
 	}
 	
+	/**
+	* CAPIRequestHandler::GetETag - Returns the entity tag of the response. Must be called after Handle.
+	* @return Strong entity tag including quotes. Empty, if the response is not cacheable.
+	*/
+	std::string CAPIRequestHandler::GetETag()
+	{
+		LibMC_uint32 bytesNeededETag = 0;
+		LibMC_uint32 bytesWrittenETag = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_APIRequestHandler_GetETag(m_pHandle, 0, &bytesNeededETag, nullptr));
+		std::vector<char> bufferETag(bytesNeededETag);
+		CheckError(m_pWrapper->m_WrapperTable.m_APIRequestHandler_GetETag(m_pHandle, bytesNeededETag, &bytesWrittenETag, &bufferETag[0]));
+		
+		return std::string(&bufferETag[0]);
+	}
+	
+	/**
+	* CAPIRequestHandler::SelectContentEncoding - Selects a precompressed variant of the response, if the client accepts it. Must be called after Handle and before GetResultData.
+	* @param[in] sAcceptEncoding - Value of the Accept-Encoding request header.
+	* @return Selected content encoding (gzip or deflate). Empty, if the result data is sent unencoded.
+	*/
+	std::string CAPIRequestHandler::SelectContentEncoding(const std::string & sAcceptEncoding)
+	{
+		LibMC_uint32 bytesNeededContentEncoding = 0;
+		LibMC_uint32 bytesWrittenContentEncoding = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_APIRequestHandler_SelectContentEncoding(m_pHandle, sAcceptEncoding.c_str(), 0, &bytesNeededContentEncoding, nullptr));
+		std::vector<char> bufferContentEncoding(bytesNeededContentEncoding);
+		CheckError(m_pWrapper->m_WrapperTable.m_APIRequestHandler_SelectContentEncoding(m_pHandle, sAcceptEncoding.c_str(), bytesNeededContentEncoding, &bytesWrittenContentEncoding, &bufferContentEncoding[0]));
+		
+		return std::string(&bufferContentEncoding[0]);
+	}
+	
+	/**
+	* CAPIRequestHandler::AcceptsRanges - Returns if the result data may be delivered in byte ranges. Must be called after Handle.
+	* @return True, if the response supports range requests.
+	*/
+	bool CAPIRequestHandler::AcceptsRanges()
+	{
+		bool resultAcceptsRanges = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_APIRequestHandler_AcceptsRanges(m_pHandle, &resultAcceptsRanges));
+		
+		return resultAcceptsRanges;
+	}
+	
+	/**
+	* CAPIRequestHandler::GetResultSize - Returns the size of the result data in the selected content encoding. Must be called after Handle.
+	* @return Size of the result data in bytes.
+	*/
+	LibMC_uint64 CAPIRequestHandler::GetResultSize()
+	{
+		LibMC_uint64 resultSize = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_APIRequestHandler_GetResultSize(m_pHandle, &resultSize));
+		
+		return resultSize;
+	}
+	
+	/**
+	* CAPIRequestHandler::GetResultDataRange - Returns a byte range of the resulting data. Call only after Handle().
+	* @param[in] nOffset - Offset of the first byte to return.
+	* @param[in] nLength - Number of bytes to return. Offset plus Length MUST NOT exceed the result size.
+	* @param[in] nDataBufferSize - Number of elements in buffer
+	* @param[out] pDataNeededCount - will be filled with the count of the written structs, or needed buffer size.
+	* @param[out] pDataBuffer - uint8 buffer of Data buffer.
+	*/
+	void CAPIRequestHandler::GetResultDataRange(const LibMC_uint64 nOffset, const LibMC_uint64 nLength, std::vector<LibMC_uint8> & DataBuffer)
+	{
+		LibMC_uint64 elementsNeededData = 0;
+		LibMC_uint64 elementsWrittenData = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_APIRequestHandler_GetResultDataRange(m_pHandle, nOffset, nLength, 0, &elementsNeededData, nullptr));
+		DataBuffer.resize((size_t) elementsNeededData);
+		CheckError(m_pWrapper->m_WrapperTable.m_APIRequestHandler_GetResultDataRange(m_pHandle, nOffset, nLength, elementsNeededData, &elementsWrittenData, DataBuffer.data()));
+	}
+	
 	/**
 	 * Method definitions for class CMCContext
 	 */
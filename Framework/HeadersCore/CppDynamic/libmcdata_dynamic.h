@@ -194,6 +194,14 @@ typedef LibMCDataResult (*PLibMCDataLogSession_AddEntryPtr) (LibMCData_LogSessio
 */
 typedef LibMCDataResult (*PLibMCDataLogSession_GetMaxLogEntryIDPtr) (LibMCData_LogSession pLogSession, LibMCData_uint32 * pMaxLogID);
 
+/**
+* writes all pending log entries to the database before returning.
+*
+* @param[in] pLogSession - LogSession instance.
+* @return error code or 0 (success)
+*/
+typedef LibMCDataResult (*PLibMCDataLogSession_FlushPtr) (LibMCData_LogSession pLogSession);
+
 /**
 * retrieves an excerpt of the log.
 *
@@ -843,6 +851,16 @@ typedef LibMCDataResult (*PLibMCDataStorageStream_GetContentPtr) (LibMCData_Stor
 */
 typedef LibMCDataResult (*PLibMCDataStorageStream_GetCallbacksPtr) (LibMCData_StorageStream pStorageStream, LibMCData_pvoid * pTheReadCallback, LibMCData_pvoid * pTheSeekCallback, LibMCData_pvoid * pStreamHandle);
 
+/**
+* returns a read-only memory mapping of the storage stream content. The mapping is only valid throughout the existence of the StorageStream instance.
+*
+* @param[in] pStorageStream - StorageStream instance.
+* @param[out] pData - Pointer to the first byte of the stream. Null, if the stream is empty.
+* @param[out] pSize - Size of the mapping in bytes.
+* @return error code or 0 (success)
+*/
+typedef LibMCDataResult (*PLibMCDataStorageStream_MapContentPtr) (LibMCData_StorageStream pStorageStream, LibMCData_pvoid * pData, LibMCData_uint64 * pSize);
+
 /*************************************************************************************************************************
  Class definition for StorageZIPWriter
 **************************************************************************************************************************/
@@ -3294,6 +3312,7 @@ typedef struct {
 	PLibMCDataLogSession_GetSessionUUIDPtr m_LogSession_GetSessionUUID;
 	PLibMCDataLogSession_AddEntryPtr m_LogSession_AddEntry;
 	PLibMCDataLogSession_GetMaxLogEntryIDPtr m_LogSession_GetMaxLogEntryID;
+	PLibMCDataLogSession_FlushPtr m_LogSession_Flush;
 	PLibMCDataLogSession_RetrieveLogEntriesByIDPtr m_LogSession_RetrieveLogEntriesByID;
 	PLibMCDataAlert_GetUUIDPtr m_Alert_GetUUID;
 	PLibMCDataAlert_GetIdentifierPtr m_Alert_GetIdentifier;
@@ -3351,6 +3370,7 @@ typedef struct {
 	PLibMCDataStorageStream_GetSizePtr m_StorageStream_GetSize;
 	PLibMCDataStorageStream_GetContentPtr m_StorageStream_GetContent;
 	PLibMCDataStorageStream_GetCallbacksPtr m_StorageStream_GetCallbacks;
+	PLibMCDataStorageStream_MapContentPtr m_StorageStream_MapContent;
 	PLibMCDataStorageZIPWriter_StartNewEntryPtr m_StorageZIPWriter_StartNewEntry;
 	PLibMCDataStorageZIPWriter_FinishCurrentEntryPtr m_StorageZIPWriter_FinishCurrentEntry;
 	PLibMCDataStorageZIPWriter_GetOpenEntryIDPtr m_StorageZIPWriter_GetOpenEntryID;
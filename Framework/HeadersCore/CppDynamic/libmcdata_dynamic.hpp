@@ -672,6 +672,7 @@ public:
 			case LIBMCDATA_ERROR_INVALIDTELEMETRYCHANNELIDENTIFIER: return "INVALIDTELEMETRYCHANNELIDENTIFIER";
 			case LIBMCDATA_ERROR_TELEMETRYCHANNELALREADYEXISTS: return "TELEMETRYCHANNELALREADYEXISTS";
 			case LIBMCDATA_ERROR_TELEMETRYCHANNELNOTFOUND: return "TELEMETRYCHANNELNOTFOUND";
+			case LIBMCDATA_ERROR_COULDNOTMAPSTORAGESTREAM: return "COULDNOTMAPSTORAGESTREAM";
 		}
 		return "UNKNOWN";
 	}
@@ -1059,6 +1060,7 @@ public:
 			case LIBMCDATA_ERROR_INVALIDTELEMETRYCHANNELIDENTIFIER: return "Invalid telemetry channel identifier.";
 			case LIBMCDATA_ERROR_TELEMETRYCHANNELALREADYEXISTS: return "Telemetry channel already exists.";
 			case LIBMCDATA_ERROR_TELEMETRYCHANNELNOTFOUND: return "Telemetry channel not found.";
+			case LIBMCDATA_ERROR_COULDNOTMAPSTORAGESTREAM: return "Could not map storage stream.";
 		}
 		return "unknown error";
 	}
@@ -1329,6 +1331,7 @@ public:
 	inline std::string GetSessionUUID();
 	inline void AddEntry(const std::string & sMessage, const std::string & sSubSystem, const eLogLevel eLogLevel, const std::string & sTimestampUTC);
 	inline LibMCData_uint32 GetMaxLogEntryID();
+	inline void Flush();
 	inline PLogEntryList RetrieveLogEntriesByID(const LibMCData_uint32 nMinLogID, const LibMCData_uint32 nMaxLogID, const eLogLevel eMinLogLevel);
 };
 	
@@ -1514,6 +1517,7 @@ public:
 	inline LibMCData_uint64 GetSize();
 	inline void GetContent(std::vector<LibMCData_uint8> & ContentBuffer);
 	inline void GetCallbacks(LibMCData_pvoid & pTheReadCallback, LibMCData_pvoid & pTheSeekCallback, LibMCData_pvoid & pStreamHandle);
+	inline void MapContent(LibMCData_pvoid & pData, LibMCData_uint64 & nSize);
 };
 	
 /*************************************************************************************************************************
@@ -2206,6 +2210,7 @@ public:
 		pWrapperTable->m_LogSession_GetSessionUUID = nullptr;
 		pWrapperTable->m_LogSession_AddEntry = nullptr;
 		pWrapperTable->m_LogSession_GetMaxLogEntryID = nullptr;
+		pWrapperTable->m_LogSession_Flush = nullptr;
 		pWrapperTable->m_LogSession_RetrieveLogEntriesByID = nullptr;
 		pWrapperTable->m_Alert_GetUUID = nullptr;
 		pWrapperTable->m_Alert_GetIdentifier = nullptr;
@@ -2263,6 +2268,7 @@ public:
 		pWrapperTable->m_StorageStream_GetSize = nullptr;
 		pWrapperTable->m_StorageStream_GetContent = nullptr;
 		pWrapperTable->m_StorageStream_GetCallbacks = nullptr;
+		pWrapperTable->m_StorageStream_MapContent = nullptr;
 		pWrapperTable->m_StorageZIPWriter_StartNewEntry = nullptr;
 		pWrapperTable->m_StorageZIPWriter_FinishCurrentEntry = nullptr;
 		pWrapperTable->m_StorageZIPWriter_GetOpenEntryID = nullptr;
@@ -2641,6 +2647,15 @@ public:
 		if (pWrapperTable->m_LogSession_GetMaxLogEntryID == nullptr)
 			return LIBMCDATA_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		#ifdef _WIN32
+		pWrapperTable->m_LogSession_Flush = (PLibMCDataLogSession_FlushPtr) GetProcAddress(hLibrary, "libmcdata_logsession_flush");
+		#else // _WIN32
+		pWrapperTable->m_LogSession_Flush = (PLibMCDataLogSession_FlushPtr) dlsym(hLibrary, "libmcdata_logsession_flush");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_LogSession_Flush == nullptr)
+			return LIBMCDATA_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		#ifdef _WIN32
 		pWrapperTable->m_LogSession_RetrieveLogEntriesByID = (PLibMCDataLogSession_RetrieveLogEntriesByIDPtr) GetProcAddress(hLibrary, "libmcdata_logsession_retrievelogentriesbyid");
 		#else // _WIN32
@@ -3154,6 +3169,15 @@ public:
 		if (pWrapperTable->m_StorageStream_GetCallbacks == nullptr)
 			return LIBMCDATA_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		#ifdef _WIN32
+		pWrapperTable->m_StorageStream_MapContent = (PLibMCDataStorageStream_MapContentPtr) GetProcAddress(hLibrary, "libmcdata_storagestream_mapcontent");
+		#else // _WIN32
+		pWrapperTable->m_StorageStream_MapContent = (PLibMCDataStorageStream_MapContentPtr) dlsym(hLibrary, "libmcdata_storagestream_mapcontent");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_StorageStream_MapContent == nullptr)
+			return LIBMCDATA_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		#ifdef _WIN32
 		pWrapperTable->m_StorageZIPWriter_StartNewEntry = (PLibMCDataStorageZIPWriter_StartNewEntryPtr) GetProcAddress(hLibrary, "libmcdata_storagezipwriter_startnewentry");
 		#else // _WIN32
@@ -5198,6 +5222,10 @@ public:
 		if ( (eLookupError != 0) || (pWrapperTable->m_LogSession_GetMaxLogEntryID == nullptr) )
 			return LIBMCDATA_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		eLookupError = (*pLookup)("libmcdata_logsession_flush", (void**)&(pWrapperTable->m_LogSession_Flush));
+		if ( (eLookupError != 0) || (pWrapperTable->m_LogSession_Flush == nullptr) )
+			return LIBMCDATA_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		eLookupError = (*pLookup)("libmcdata_logsession_retrievelogentriesbyid", (void**)&(pWrapperTable->m_LogSession_RetrieveLogEntriesByID));
 		if ( (eLookupError != 0) || (pWrapperTable->m_LogSession_RetrieveLogEntriesByID == nullptr) )
 			return LIBMCDATA_ERROR_COULDNOTFINDLIBRARYEXPORT;
@@ -5426,6 +5454,10 @@ public:
 		if ( (eLookupError != 0) || (pWrapperTable->m_StorageStream_GetCallbacks == nullptr) )
 			return LIBMCDATA_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		eLookupError = (*pLookup)("libmcdata_storagestream_mapcontent", (void**)&(pWrapperTable->m_StorageStream_MapContent));
+		if ( (eLookupError != 0) || (pWrapperTable->m_StorageStream_MapContent == nullptr) )
+			return LIBMCDATA_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		eLookupError = (*pLookup)("libmcdata_storagezipwriter_startnewentry", (void**)&(pWrapperTable->m_StorageZIPWriter_StartNewEntry));
 		if ( (eLookupError != 0) || (pWrapperTable->m_StorageZIPWriter_StartNewEntry == nullptr) )
 			return LIBMCDATA_ERROR_COULDNOTFINDLIBRARYEXPORT;
@@ -6510,6 +6542,14 @@ public:
 		return resultMaxLogID;
 	}
 	
+	/**
+	* CLogSession::Flush - writes all pending log entries to the database before returning.
+	*/
+	void CLogSession::Flush()
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_LogSession_Flush(m_pHandle));
+	}
+	
 	/**
 	* CLogSession::RetrieveLogEntriesByID - retrieves an excerpt of the log.
 	* @param[in] nMinLogID - Minimum log entry ID to receive.
@@ -7339,6 +7379,16 @@ public:
 		CheckError(m_pWrapper->m_WrapperTable.m_StorageStream_GetCallbacks(m_pHandle, &pTheReadCallback, &pTheSeekCallback, &pStreamHandle));
 	}
 	
+	/**
+	* CStorageStream::MapContent - returns a read-only memory mapping of the storage stream content. The mapping is only valid throughout the existence of the StorageStream instance.
+	* @param[out] pData - Pointer to the first byte of the stream. Null, if the stream is empty.
+	* @param[out] nSize - Size of the mapping in bytes.
+	*/
+	void CStorageStream::MapContent(LibMCData_pvoid & pData, LibMCData_uint64 & nSize)
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_StorageStream_MapContent(m_pHandle, &pData, &nSize));
+	}
+	
 	/**
 	 * Method definitions for class CStorageZIPWriter
 	 */
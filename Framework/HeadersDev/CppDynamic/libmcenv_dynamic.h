@@ -3336,6 +3336,134 @@ typedef LibMCEnvResult (*PLibMCEnvToolpathLayer_GetSegmentProfileTypedValueDefPt
 */
 typedef LibMCEnvResult (*PLibMCEnvToolpathLayer_GetSegmentProfileTypedModificationTypePtr) (LibMCEnv_ToolpathLayer pToolpathLayer, LibMCEnv_uint32 nSegmentIndex, LibMCEnv::eToolpathProfileValueType eValueType, LibMCEnv::eToolpathProfileModificationType * pModificationType);
 
+/**
+* Resolves a profile value name into a handle that is valid for all segments of this layer. Handles allow fast repeated access to profile values without string lookups.
+*
+* @param[in] pToolpathLayer - ToolpathLayer instance.
+* @param[in] pNamespace - Namespace to query for.
+* @param[in] pValueName - Value Name to query for.
+* @param[out] pValueHandle - Value handle. Returns 0 if no profile of the layer has the value.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvToolpathLayer_ResolveProfileValueHandlePtr) (LibMCEnv_ToolpathLayer pToolpathLayer, const char * pNamespace, const char * pValueName, LibMCEnv_uint32 * pValueHandle);
+
+/**
+* Resolves a profile value of a standard type into a handle that is valid for all segments of this layer.
+*
+* @param[in] pToolpathLayer - ToolpathLayer instance.
+* @param[in] eValueType - Enum to query for. MUST NOT be custom.
+* @param[out] pValueHandle - Value handle. Returns 0 if no profile of the layer has the value.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvToolpathLayer_ResolveTypedProfileValueHandlePtr) (LibMCEnv_ToolpathLayer pToolpathLayer, eLibMCEnvToolpathProfileValueType eValueType, LibMCEnv_uint32 * pValueHandle);
+
+/**
+* Returns if the segment profile has a value.
+*
+* @param[in] pToolpathLayer - ToolpathLayer instance.
+* @param[in] nSegmentIndex - Index. Must be between 0 and Count - 1.
+* @param[in] nValueHandle - Value handle, as returned by ResolveProfileValueHandle.
+* @param[out] pHasValue - Returns true if value exist.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvToolpathLayer_SegmentProfileHasValueByHandlePtr) (LibMCEnv_ToolpathLayer pToolpathLayer, LibMCEnv_uint32 nSegmentIndex, LibMCEnv_uint32 nValueHandle, bool * pHasValue);
+
+/**
+* Retrieves an assigned profile custom value. Fails if value does not exist.
+*
+* @param[in] pToolpathLayer - ToolpathLayer instance.
+* @param[in] nSegmentIndex - Index. Must be between 0 and Count - 1.
+* @param[in] nValueHandle - Value handle, as returned by ResolveProfileValueHandle.
+* @param[in] nValueBufferSize - size of the buffer (including trailing 0)
+* @param[out] pValueNeededChars - will be filled with the count of the written bytes, or needed buffer size.
+* @param[out] pValueBuffer -  buffer of String Value., may be NULL
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvToolpathLayer_GetSegmentProfileValueByHandlePtr) (LibMCEnv_ToolpathLayer pToolpathLayer, LibMCEnv_uint32 nSegmentIndex, LibMCEnv_uint32 nValueHandle, const LibMCEnv_uint32 nValueBufferSize, LibMCEnv_uint32* pValueNeededChars, char * pValueBuffer);
+
+/**
+* Retrieves an assigned profile custom value.
+*
+* @param[in] pToolpathLayer - ToolpathLayer instance.
+* @param[in] nSegmentIndex - Index. Must be between 0 and Count - 1.
+* @param[in] nValueHandle - Value handle, as returned by ResolveProfileValueHandle.
+* @param[in] pDefaultValue - Default value if value does not exist.
+* @param[in] nValueBufferSize - size of the buffer (including trailing 0)
+* @param[out] pValueNeededChars - will be filled with the count of the written bytes, or needed buffer size.
+* @param[out] pValueBuffer -  buffer of String Value., may be NULL
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvToolpathLayer_GetSegmentProfileValueByHandleDefPtr) (LibMCEnv_ToolpathLayer pToolpathLayer, LibMCEnv_uint32 nSegmentIndex, LibMCEnv_uint32 nValueHandle, const char * pDefaultValue, const LibMCEnv_uint32 nValueBufferSize, LibMCEnv_uint32* pValueNeededChars, char * pValueBuffer);
+
+/**
+* Retrieves an assigned profile custom double value. Fails if value does not exist or is not a double value.
+*
+* @param[in] pToolpathLayer - ToolpathLayer instance.
+* @param[in] nSegmentIndex - Index. Must be between 0 and Count - 1.
+* @param[in] nValueHandle - Value handle, as returned by ResolveProfileValueHandle.
+* @param[out] pValue - Double Value.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvToolpathLayer_GetSegmentProfileDoubleValueByHandlePtr) (LibMCEnv_ToolpathLayer pToolpathLayer, LibMCEnv_uint32 nSegmentIndex, LibMCEnv_uint32 nValueHandle, LibMCEnv_double * pValue);
+
+/**
+* Retrieves an assigned profile custom double value. Fails if value exists but is not a double value.
+*
+* @param[in] pToolpathLayer - ToolpathLayer instance.
+* @param[in] nSegmentIndex - Index. Must be between 0 and Count - 1.
+* @param[in] nValueHandle - Value handle, as returned by ResolveProfileValueHandle.
+* @param[in] dDefaultValue - Default value if value does not exist.
+* @param[out] pValue - Double Value.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvToolpathLayer_GetSegmentProfileDoubleValueByHandleDefPtr) (LibMCEnv_ToolpathLayer pToolpathLayer, LibMCEnv_uint32 nSegmentIndex, LibMCEnv_uint32 nValueHandle, LibMCEnv_double dDefaultValue, LibMCEnv_double * pValue);
+
+/**
+* Retrieves an assigned profile custom integer value. Fails if value does not exist or is not a integer value.
+*
+* @param[in] pToolpathLayer - ToolpathLayer instance.
+* @param[in] nSegmentIndex - Index. Must be between 0 and Count - 1.
+* @param[in] nValueHandle - Value handle, as returned by ResolveProfileValueHandle.
+* @param[out] pValue - Integer Value.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvToolpathLayer_GetSegmentProfileIntegerValueByHandlePtr) (LibMCEnv_ToolpathLayer pToolpathLayer, LibMCEnv_uint32 nSegmentIndex, LibMCEnv_uint32 nValueHandle, LibMCEnv_int64 * pValue);
+
+/**
+* Retrieves an assigned profile custom integer value. Fails if value exists but is not a integer value.
+*
+* @param[in] pToolpathLayer - ToolpathLayer instance.
+* @param[in] nSegmentIndex - Index. Must be between 0 and Count - 1.
+* @param[in] nValueHandle - Value handle, as returned by ResolveProfileValueHandle.
+* @param[in] nDefaultValue - Default value if value does not exist.
+* @param[out] pValue - Integer Value.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvToolpathLayer_GetSegmentProfileIntegerValueByHandleDefPtr) (LibMCEnv_ToolpathLayer pToolpathLayer, LibMCEnv_uint32 nSegmentIndex, LibMCEnv_uint32 nValueHandle, LibMCEnv_int64 nDefaultValue, LibMCEnv_int64 * pValue);
+
+/**
+* Retrieves an assigned profile custom boolean value. A Boolean value is either an integer value, or strings of the form true or false (case insensitive). Fails if value does not exist or is not a bool value.
+*
+* @param[in] pToolpathLayer - ToolpathLayer instance.
+* @param[in] nSegmentIndex - Index. Must be between 0 and Count - 1.
+* @param[in] nValueHandle - Value handle, as returned by ResolveProfileValueHandle.
+* @param[out] pValue - Boolean Value.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvToolpathLayer_GetSegmentProfileBoolValueByHandlePtr) (LibMCEnv_ToolpathLayer pToolpathLayer, LibMCEnv_uint32 nSegmentIndex, LibMCEnv_uint32 nValueHandle, bool * pValue);
+
+/**
+* Retrieves an assigned profile custom boolean value. A Boolean value is either an integer value, or strings of the form true or false (case insensitive). Fails if value exists but is not a bool value.
+*
+* @param[in] pToolpathLayer - ToolpathLayer instance.
+* @param[in] nSegmentIndex - Index. Must be between 0 and Count - 1.
+* @param[in] nValueHandle - Value handle, as returned by ResolveProfileValueHandle.
+* @param[in] bDefaultValue - Default value if value does not exist.
+* @param[out] pValue - Boolean Value.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvToolpathLayer_GetSegmentProfileBoolValueByHandleDefPtr) (LibMCEnv_ToolpathLayer pToolpathLayer, LibMCEnv_uint32 nSegmentIndex, LibMCEnv_uint32 nValueHandle, bool bDefaultValue, bool * pValue);
+
 /**
 * Retrieves the assigned segment part uuid.
 *
@@ -8118,6 +8246,75 @@ typedef LibMCEnvResult (*PLibMCEnvJournalVariable_ComputeDoubleSamplePtr) (LibMC
 */
 typedef LibMCEnvResult (*PLibMCEnvJournalVariable_ComputeIntegerSamplePtr) (LibMCEnv_JournalVariable pJournalVariable, LibMCEnv_uint64 nTimeInMicroSeconds, LibMCEnv_int64 * pSampleValue);
 
+/**
+* Computes the minimum value of the variable in a time interval.
+*
+* @param[in] pJournalVariable - JournalVariable instance.
+* @param[in] nStartTimeInMicroSeconds - Start of the interval in microseconds.
+* @param[in] nEndTimeInMicroSeconds - End of the interval in microseconds. MUST be larger than the start.
+* @param[out] pValue - Minimum value in the interval.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvJournalVariable_ComputeMinimumPtr) (LibMCEnv_JournalVariable pJournalVariable, LibMCEnv_uint64 nStartTimeInMicroSeconds, LibMCEnv_uint64 nEndTimeInMicroSeconds, LibMCEnv_double * pValue);
+
+/**
+* Computes the maximum value of the variable in a time interval.
+*
+* @param[in] pJournalVariable - JournalVariable instance.
+* @param[in] nStartTimeInMicroSeconds - Start of the interval in microseconds.
+* @param[in] nEndTimeInMicroSeconds - End of the interval in microseconds. MUST be larger than the start.
+* @param[out] pValue - Maximum value in the interval.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvJournalVariable_ComputeMaximumPtr) (LibMCEnv_JournalVariable pJournalVariable, LibMCEnv_uint64 nStartTimeInMicroSeconds, LibMCEnv_uint64 nEndTimeInMicroSeconds, LibMCEnv_double * pValue);
+
+/**
+* Computes the time weighted average of the variable in a time interval.
+*
+* @param[in] pJournalVariable - JournalVariable instance.
+* @param[in] nStartTimeInMicroSeconds - Start of the interval in microseconds.
+* @param[in] nEndTimeInMicroSeconds - End of the interval in microseconds. MUST be larger than the start.
+* @param[out] pValue - Average value in the interval.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvJournalVariable_ComputeAveragePtr) (LibMCEnv_JournalVariable pJournalVariable, LibMCEnv_uint64 nStartTimeInMicroSeconds, LibMCEnv_uint64 nEndTimeInMicroSeconds, LibMCEnv_double * pValue);
+
+/**
+* Computes the time integral of the variable in a time interval.
+*
+* @param[in] pJournalVariable - JournalVariable instance.
+* @param[in] nStartTimeInMicroSeconds - Start of the interval in microseconds.
+* @param[in] nEndTimeInMicroSeconds - End of the interval in microseconds. MUST be larger than the start.
+* @param[out] pValue - Integral of the variable in value times seconds.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvJournalVariable_ComputeIntegralPtr) (LibMCEnv_JournalVariable pJournalVariable, LibMCEnv_uint64 nStartTimeInMicroSeconds, LibMCEnv_uint64 nEndTimeInMicroSeconds, LibMCEnv_double * pValue);
+
+/**
+* Samples the variable at equidistant time stamps, including both interval ends.
+*
+* @param[in] pJournalVariable - JournalVariable instance.
+* @param[in] nStartTimeInMicroSeconds - Start of the interval in microseconds.
+* @param[in] nEndTimeInMicroSeconds - End of the interval in microseconds. MUST be larger than the start.
+* @param[in] nNumberOfSamples - Number of samples. MUST be at least 2.
+* @param[out] pSampling - Sampling instance.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvJournalVariable_ComputeUniformSamplingPtr) (LibMCEnv_JournalVariable pJournalVariable, LibMCEnv_uint64 nStartTimeInMicroSeconds, LibMCEnv_uint64 nEndTimeInMicroSeconds, LibMCEnv_uint32 nNumberOfSamples, LibMCEnv_UniformJournalSampling * pSampling);
+
+/**
+* Returns the value at the interval start and all recorded value changes within the interval.
+*
+* @param[in] pJournalVariable - JournalVariable instance.
+* @param[in] nStartTimeInMicroSeconds - Start of the interval in microseconds.
+* @param[in] nEndTimeInMicroSeconds - End of the interval in microseconds. MUST be larger than the start.
+* @param[in] nTimeStreamEntriesBufferSize - Number of elements in buffer
+* @param[out] pTimeStreamEntriesNeededCount - will be filled with the count of the written elements, or needed buffer size.
+* @param[out] pTimeStreamEntriesBuffer - TimeStreamEntry  buffer of Array of Timestream entries, in increasing order.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvJournalVariable_ReceiveRawTimeStreamPtr) (LibMCEnv_JournalVariable pJournalVariable, LibMCEnv_uint64 nStartTimeInMicroSeconds, LibMCEnv_uint64 nEndTimeInMicroSeconds, const LibMCEnv_uint64 nTimeStreamEntriesBufferSize, LibMCEnv_uint64* pTimeStreamEntriesNeededCount, LibMCEnv::sTimeStreamEntry * pTimeStreamEntriesBuffer);
+
 /*************************************************************************************************************************
  Class definition for Alert
 **************************************************************************************************************************/
@@ -9949,6 +10146,51 @@ typedef LibMCEnvResult (*PLibMCEnvStateEnvironment_FindDataSeriesPtr) (LibMCEnv_
 */
 typedef LibMCEnvResult (*PLibMCEnvStateEnvironment_ReleaseDataSeriesPtr) (LibMCEnv_StateEnvironment pStateEnvironment, const char * pDataSeriesUUID);
 
+/**
+* Registers a push stream of JSON events, that clients can subscribe to as Server-Sent Events. Returns the existing stream, if the identifier has been registered before.
+*
+* @param[in] pStateEnvironment - StateEnvironment instance.
+* @param[in] pIdentifier - Identifier of the stream.
+* @param[in] nStreamUUIDBufferSize - size of the buffer (including trailing 0)
+* @param[out] pStreamUUIDNeededChars - will be filled with the count of the written bytes, or needed buffer size.
+* @param[out] pStreamUUIDBuffer -  buffer of UUID of the stream., may be NULL
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvStateEnvironment_RegisterJSONEventStreamPtr) (LibMCEnv_StateEnvironment pStateEnvironment, const char * pIdentifier, const LibMCEnv_uint32 nStreamUUIDBufferSize, LibMCEnv_uint32* pStreamUUIDNeededChars, char * pStreamUUIDBuffer);
+
+/**
+* Registers a push stream of JPEG images, that clients can subscribe to as MJPEG stream. Returns the existing stream, if the identifier has been registered before.
+*
+* @param[in] pStateEnvironment - StateEnvironment instance.
+* @param[in] pIdentifier - Identifier of the stream.
+* @param[in] nStreamUUIDBufferSize - size of the buffer (including trailing 0)
+* @param[out] pStreamUUIDNeededChars - will be filled with the count of the written bytes, or needed buffer size.
+* @param[out] pStreamUUIDBuffer -  buffer of UUID of the stream., may be NULL
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvStateEnvironment_RegisterJPEGImageStreamPtr) (LibMCEnv_StateEnvironment pStateEnvironment, const char * pIdentifier, const LibMCEnv_uint32 nStreamUUIDBufferSize, LibMCEnv_uint32* pStreamUUIDNeededChars, char * pStreamUUIDBuffer);
+
+/**
+* Publishes a JSON event to all connections of a JSON event stream.
+*
+* @param[in] pStateEnvironment - StateEnvironment instance.
+* @param[in] pStreamUUID - UUID of the stream.
+* @param[in] pEventJSON - JSON payload of the event.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvStateEnvironment_PublishStreamEventPtr) (LibMCEnv_StateEnvironment pStateEnvironment, const char * pStreamUUID, const char * pEventJSON);
+
+/**
+* Publishes a JPEG frame to all connections of a JPEG image stream.
+*
+* @param[in] pStateEnvironment - StateEnvironment instance.
+* @param[in] pStreamUUID - UUID of the stream.
+* @param[in] nJPEGDataBufferSize - Number of elements in buffer
+* @param[in] pJPEGDataBuffer - uint8 buffer of JPEG encoded frame.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvStateEnvironment_PublishStreamImagePtr) (LibMCEnv_StateEnvironment pStateEnvironment, const char * pStreamUUID, LibMCEnv_uint64 nJPEGDataBufferSize, const LibMCEnv_uint8 * pJPEGDataBuffer);
+
 /**
 * creates a new alert
 *
@@ -11427,6 +11669,17 @@ typedef struct {
 	PLibMCEnvToolpathLayer_GetSegmentProfileTypedValuePtr m_ToolpathLayer_GetSegmentProfileTypedValue;
 	PLibMCEnvToolpathLayer_GetSegmentProfileTypedValueDefPtr m_ToolpathLayer_GetSegmentProfileTypedValueDef;
 	PLibMCEnvToolpathLayer_GetSegmentProfileTypedModificationTypePtr m_ToolpathLayer_GetSegmentProfileTypedModificationType;
+	PLibMCEnvToolpathLayer_ResolveProfileValueHandlePtr m_ToolpathLayer_ResolveProfileValueHandle;
+	PLibMCEnvToolpathLayer_ResolveTypedProfileValueHandlePtr m_ToolpathLayer_ResolveTypedProfileValueHandle;
+	PLibMCEnvToolpathLayer_SegmentProfileHasValueByHandlePtr m_ToolpathLayer_SegmentProfileHasValueByHandle;
+	PLibMCEnvToolpathLayer_GetSegmentProfileValueByHandlePtr m_ToolpathLayer_GetSegmentProfileValueByHandle;
+	PLibMCEnvToolpathLayer_GetSegmentProfileValueByHandleDefPtr m_ToolpathLayer_GetSegmentProfileValueByHandleDef;
+	PLibMCEnvToolpathLayer_GetSegmentProfileDoubleValueByHandlePtr m_ToolpathLayer_GetSegmentProfileDoubleValueByHandle;
+	PLibMCEnvToolpathLayer_GetSegmentProfileDoubleValueByHandleDefPtr m_ToolpathLayer_GetSegmentProfileDoubleValueByHandleDef;
+	PLibMCEnvToolpathLayer_GetSegmentProfileIntegerValueByHandlePtr m_ToolpathLayer_GetSegmentProfileIntegerValueByHandle;
+	PLibMCEnvToolpathLayer_GetSegmentProfileIntegerValueByHandleDefPtr m_ToolpathLayer_GetSegmentProfileIntegerValueByHandleDef;
+	PLibMCEnvToolpathLayer_GetSegmentProfileBoolValueByHandlePtr m_ToolpathLayer_GetSegmentProfileBoolValueByHandle;
+	PLibMCEnvToolpathLayer_GetSegmentProfileBoolValueByHandleDefPtr m_ToolpathLayer_GetSegmentProfileBoolValueByHandleDef;
 	PLibMCEnvToolpathLayer_GetSegmentPartUUIDPtr m_ToolpathLayer_GetSegmentPartUUID;
 	PLibMCEnvToolpathLayer_GetSegmentLocalPartIDPtr m_ToolpathLayer_GetSegmentLocalPartID;
 	PLibMCEnvToolpathLayer_GetSegmentPolylineDataPtr m_ToolpathLayer_GetSegmentPolylineData;
@@ -11876,6 +12129,12 @@ typedef struct {
 	PLibMCEnvJournalVariable_GetVariableNamePtr m_JournalVariable_GetVariableName;
 	PLibMCEnvJournalVariable_ComputeDoubleSamplePtr m_JournalVariable_ComputeDoubleSample;
 	PLibMCEnvJournalVariable_ComputeIntegerSamplePtr m_JournalVariable_ComputeIntegerSample;
+	PLibMCEnvJournalVariable_ComputeMinimumPtr m_JournalVariable_ComputeMinimum;
+	PLibMCEnvJournalVariable_ComputeMaximumPtr m_JournalVariable_ComputeMaximum;
+	PLibMCEnvJournalVariable_ComputeAveragePtr m_JournalVariable_ComputeAverage;
+	PLibMCEnvJournalVariable_ComputeIntegralPtr m_JournalVariable_ComputeIntegral;
+	PLibMCEnvJournalVariable_ComputeUniformSamplingPtr m_JournalVariable_ComputeUniformSampling;
+	PLibMCEnvJournalVariable_ReceiveRawTimeStreamPtr m_JournalVariable_ReceiveRawTimeStream;
 	PLibMCEnvAlert_GetUUIDPtr m_Alert_GetUUID;
 	PLibMCEnvAlert_IsActivePtr m_Alert_IsActive;
 	PLibMCEnvAlert_GetAlertLevelPtr m_Alert_GetAlertLevel;
@@ -12043,6 +12302,10 @@ typedef struct {
 	PLibMCEnvStateEnvironment_HasDataSeriesPtr m_StateEnvironment_HasDataSeries;
 	PLibMCEnvStateEnvironment_FindDataSeriesPtr m_StateEnvironment_FindDataSeries;
 	PLibMCEnvStateEnvironment_ReleaseDataSeriesPtr m_StateEnvironment_ReleaseDataSeries;
+	PLibMCEnvStateEnvironment_RegisterJSONEventStreamPtr m_StateEnvironment_RegisterJSONEventStream;
+	PLibMCEnvStateEnvironment_RegisterJPEGImageStreamPtr m_StateEnvironment_RegisterJPEGImageStream;
+	PLibMCEnvStateEnvironment_PublishStreamEventPtr m_StateEnvironment_PublishStreamEvent;
+	PLibMCEnvStateEnvironment_PublishStreamImagePtr m_StateEnvironment_PublishStreamImage;
 	PLibMCEnvStateEnvironment_CreateAlertPtr m_StateEnvironment_CreateAlert;
 	PLibMCEnvStateEnvironment_FindAlertPtr m_StateEnvironment_FindAlert;
 	PLibMCEnvStateEnvironment_AlertExistsPtr m_StateEnvironment_AlertExists;
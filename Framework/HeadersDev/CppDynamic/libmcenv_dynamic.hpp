@@ -734,6 +734,7 @@ public:
 			case LIBMCENV_ERROR_MACHINECONFIGURATIONSCHEMATYPEALREADYREGISTERED: return "MACHINECONFIGURATIONSCHEMATYPEALREADYREGISTERED";
 			case LIBMCENV_ERROR_NOCONFIGURATIONVERSIONFOUND: return "NOCONFIGURATIONVERSIONFOUND";
 			case LIBMCENV_ERROR_NOCONFIGURATIONVERSIONACTIVE: return "NOCONFIGURATIONVERSIONACTIVE";
+			case LIBMCENV_ERROR_INVALIDJOURNALSAMPLEINDEX: return "INVALIDJOURNALSAMPLEINDEX";
 		}
 		return "UNKNOWN";
 	}
@@ -995,6 +996,7 @@ public:
 			case LIBMCENV_ERROR_MACHINECONFIGURATIONSCHEMATYPEALREADYREGISTERED: return "Schema type already registered, but with a different name.";
 			case LIBMCENV_ERROR_NOCONFIGURATIONVERSIONFOUND: return "No configuration version found.";
 			case LIBMCENV_ERROR_NOCONFIGURATIONVERSIONACTIVE: return "No configuration version active.";
+			case LIBMCENV_ERROR_INVALIDJOURNALSAMPLEINDEX: return "Invalid journal sample index.";
 		}
 		return "unknown error";
 	}
@@ -2105,6 +2107,17 @@ public:
 	inline LibMCEnv_double GetSegmentProfileTypedValue(const LibMCEnv_uint32 nSegmentIndex, const eToolpathProfileValueType eValueType);
 	inline LibMCEnv_double GetSegmentProfileTypedValueDef(const LibMCEnv_uint32 nSegmentIndex, const eToolpathProfileValueType eValueType, const LibMCEnv_double dDefaultValue);
 	inline eToolpathProfileModificationType GetSegmentProfileTypedModificationType(const LibMCEnv_uint32 nSegmentIndex, const eToolpathProfileValueType eValueType);
+	inline LibMCEnv_uint32 ResolveProfileValueHandle(const std::string & sNamespace, const std::string & sValueName);
+	inline LibMCEnv_uint32 ResolveTypedProfileValueHandle(const eToolpathProfileValueType eValueType);
+	inline bool SegmentProfileHasValueByHandle(const LibMCEnv_uint32 nSegmentIndex, const LibMCEnv_uint32 nValueHandle);
+	inline std::string GetSegmentProfileValueByHandle(const LibMCEnv_uint32 nSegmentIndex, const LibMCEnv_uint32 nValueHandle);
+	inline std::string GetSegmentProfileValueByHandleDef(const LibMCEnv_uint32 nSegmentIndex, const LibMCEnv_uint32 nValueHandle, const std::string & sDefaultValue);
+	inline LibMCEnv_double GetSegmentProfileDoubleValueByHandle(const LibMCEnv_uint32 nSegmentIndex, const LibMCEnv_uint32 nValueHandle);
+	inline LibMCEnv_double GetSegmentProfileDoubleValueByHandleDef(const LibMCEnv_uint32 nSegmentIndex, const LibMCEnv_uint32 nValueHandle, const LibMCEnv_double dDefaultValue);
+	inline LibMCEnv_int64 GetSegmentProfileIntegerValueByHandle(const LibMCEnv_uint32 nSegmentIndex, const LibMCEnv_uint32 nValueHandle);
+	inline LibMCEnv_int64 GetSegmentProfileIntegerValueByHandleDef(const LibMCEnv_uint32 nSegmentIndex, const LibMCEnv_uint32 nValueHandle, const LibMCEnv_int64 nDefaultValue);
+	inline bool GetSegmentProfileBoolValueByHandle(const LibMCEnv_uint32 nSegmentIndex, const LibMCEnv_uint32 nValueHandle);
+	inline bool GetSegmentProfileBoolValueByHandleDef(const LibMCEnv_uint32 nSegmentIndex, const LibMCEnv_uint32 nValueHandle, const bool bDefaultValue);
 	inline std::string GetSegmentPartUUID(const LibMCEnv_uint32 nSegmentIndex);
 	inline LibMCEnv_uint32 GetSegmentLocalPartID(const LibMCEnv_uint32 nSegmentIndex);
 	inline void GetSegmentPolylineData(const LibMCEnv_uint32 nSegmentIndex, std::vector<sPosition2D> & PointDataBuffer);
@@ -3050,6 +3063,12 @@ public:
 	inline std::string GetVariableName();
 	inline LibMCEnv_double ComputeDoubleSample(const LibMCEnv_uint64 nTimeInMicroSeconds);
 	inline LibMCEnv_int64 ComputeIntegerSample(const LibMCEnv_uint64 nTimeInMicroSeconds);
+	inline LibMCEnv_double ComputeMinimum(const LibMCEnv_uint64 nStartTimeInMicroSeconds, const LibMCEnv_uint64 nEndTimeInMicroSeconds);
+	inline LibMCEnv_double ComputeMaximum(const LibMCEnv_uint64 nStartTimeInMicroSeconds, const LibMCEnv_uint64 nEndTimeInMicroSeconds);
+	inline LibMCEnv_double ComputeAverage(const LibMCEnv_uint64 nStartTimeInMicroSeconds, const LibMCEnv_uint64 nEndTimeInMicroSeconds);
+	inline LibMCEnv_double ComputeIntegral(const LibMCEnv_uint64 nStartTimeInMicroSeconds, const LibMCEnv_uint64 nEndTimeInMicroSeconds);
+	inline PUniformJournalSampling ComputeUniformSampling(const LibMCEnv_uint64 nStartTimeInMicroSeconds, const LibMCEnv_uint64 nEndTimeInMicroSeconds, const LibMCEnv_uint32 nNumberOfSamples);
+	inline void ReceiveRawTimeStream(const LibMCEnv_uint64 nStartTimeInMicroSeconds, const LibMCEnv_uint64 nEndTimeInMicroSeconds, std::vector<sTimeStreamEntry> & TimeStreamEntriesBuffer);
 };
 	
 /*************************************************************************************************************************
@@ -3441,6 +3460,10 @@ public:
 	inline bool HasDataSeries(const std::string & sDataSeriesUUID);
 	inline PDataSeries FindDataSeries(const std::string & sDataSeriesUUID);
 	inline void ReleaseDataSeries(const std::string & sDataSeriesUUID);
+	inline std::string RegisterJSONEventStream(const std::string & sIdentifier);
+	inline std::string RegisterJPEGImageStream(const std::string & sIdentifier);
+	inline void PublishStreamEvent(const std::string & sStreamUUID, const std::string & sEventJSON);
+	inline void PublishStreamImage(const std::string & sStreamUUID, const CInputVector<LibMCEnv_uint8> & JPEGDataBuffer);
 	inline PAlert CreateAlert(const std::string & sIdentifier, const std::string & sReadableContextInformation, const bool bAutomaticLogEntry);
 	inline PAlert FindAlert(const std::string & sUUID);
 	inline bool AlertExists(const std::string & sUUID);
@@ -3970,6 +3993,17 @@ public:
 		pWrapperTable->m_ToolpathLayer_GetSegmentProfileTypedValue = nullptr;
 		pWrapperTable->m_ToolpathLayer_GetSegmentProfileTypedValueDef = nullptr;
 		pWrapperTable->m_ToolpathLayer_GetSegmentProfileTypedModificationType = nullptr;
+		pWrapperTable->m_ToolpathLayer_ResolveProfileValueHandle = nullptr;
+		pWrapperTable->m_ToolpathLayer_ResolveTypedProfileValueHandle = nullptr;
+		pWrapperTable->m_ToolpathLayer_SegmentProfileHasValueByHandle = nullptr;
+		pWrapperTable->m_ToolpathLayer_GetSegmentProfileValueByHandle = nullptr;
+		pWrapperTable->m_ToolpathLayer_GetSegmentProfileValueByHandleDef = nullptr;
+		pWrapperTable->m_ToolpathLayer_GetSegmentProfileDoubleValueByHandle = nullptr;
+		pWrapperTable->m_ToolpathLayer_GetSegmentProfileDoubleValueByHandleDef = nullptr;
+		pWrapperTable->m_ToolpathLayer_GetSegmentProfileIntegerValueByHandle = nullptr;
+		pWrapperTable->m_ToolpathLayer_GetSegmentProfileIntegerValueByHandleDef = nullptr;
+		pWrapperTable->m_ToolpathLayer_GetSegmentProfileBoolValueByHandle = nullptr;
+		pWrapperTable->m_ToolpathLayer_GetSegmentProfileBoolValueByHandleDef = nullptr;
 		pWrapperTable->m_ToolpathLayer_GetSegmentPartUUID = nullptr;
 		pWrapperTable->m_ToolpathLayer_GetSegmentLocalPartID = nullptr;
 		pWrapperTable->m_ToolpathLayer_GetSegmentPolylineData = nullptr;
@@ -4419,6 +4453,12 @@ public:
 		pWrapperTable->m_JournalVariable_GetVariableName = nullptr;
 		pWrapperTable->m_JournalVariable_ComputeDoubleSample = nullptr;
 		pWrapperTable->m_JournalVariable_ComputeIntegerSample = nullptr;
+		pWrapperTable->m_JournalVariable_ComputeMinimum = nullptr;
+		pWrapperTable->m_JournalVariable_ComputeMaximum = nullptr;
+		pWrapperTable->m_JournalVariable_ComputeAverage = nullptr;
+		pWrapperTable->m_JournalVariable_ComputeIntegral = nullptr;
+		pWrapperTable->m_JournalVariable_ComputeUniformSampling = nullptr;
+		pWrapperTable->m_JournalVariable_ReceiveRawTimeStream = nullptr;
 		pWrapperTable->m_Alert_GetUUID = nullptr;
 		pWrapperTable->m_Alert_IsActive = nullptr;
 		pWrapperTable->m_Alert_GetAlertLevel = nullptr;
@@ -4586,6 +4626,10 @@ public:
 		pWrapperTable->m_StateEnvironment_HasDataSeries = nullptr;
 		pWrapperTable->m_StateEnvironment_FindDataSeries = nullptr;
 		pWrapperTable->m_StateEnvironment_ReleaseDataSeries = nullptr;
+		pWrapperTable->m_StateEnvironment_RegisterJSONEventStream = nullptr;
+		pWrapperTable->m_StateEnvironment_RegisterJPEGImageStream = nullptr;
+		pWrapperTable->m_StateEnvironment_PublishStreamEvent = nullptr;
+		pWrapperTable->m_StateEnvironment_PublishStreamImage = nullptr;
 		pWrapperTable->m_StateEnvironment_CreateAlert = nullptr;
 		pWrapperTable->m_StateEnvironment_FindAlert = nullptr;
 		pWrapperTable->m_StateEnvironment_AlertExists = nullptr;
@@ -7535,6 +7579,105 @@ public:
 		if (pWrapperTable->m_ToolpathLayer_GetSegmentProfileTypedModificationType == nullptr)
 			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		#ifdef _WIN32
+		pWrapperTable->m_ToolpathLayer_ResolveProfileValueHandle = (PLibMCEnvToolpathLayer_ResolveProfileValueHandlePtr) GetProcAddress(hLibrary, "libmcenv_toolpathlayer_resolveprofilevaluehandle");
+		#else // _WIN32
+		pWrapperTable->m_ToolpathLayer_ResolveProfileValueHandle = (PLibMCEnvToolpathLayer_ResolveProfileValueHandlePtr) dlsym(hLibrary, "libmcenv_toolpathlayer_resolveprofilevaluehandle");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_ToolpathLayer_ResolveProfileValueHandle == nullptr)
+			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_ToolpathLayer_ResolveTypedProfileValueHandle = (PLibMCEnvToolpathLayer_ResolveTypedProfileValueHandlePtr) GetProcAddress(hLibrary, "libmcenv_toolpathlayer_resolvetypedprofilevaluehandle");
+		#else // _WIN32
+		pWrapperTable->m_ToolpathLayer_ResolveTypedProfileValueHandle = (PLibMCEnvToolpathLayer_ResolveTypedProfileValueHandlePtr) dlsym(hLibrary, "libmcenv_toolpathlayer_resolvetypedprofilevaluehandle");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_ToolpathLayer_ResolveTypedProfileValueHandle == nullptr)
+			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_ToolpathLayer_SegmentProfileHasValueByHandle = (PLibMCEnvToolpathLayer_SegmentProfileHasValueByHandlePtr) GetProcAddress(hLibrary, "libmcenv_toolpathlayer_segmentprofilehasvaluebyhandle");
+		#else // _WIN32
+		pWrapperTable->m_ToolpathLayer_SegmentProfileHasValueByHandle = (PLibMCEnvToolpathLayer_SegmentProfileHasValueByHandlePtr) dlsym(hLibrary, "libmcenv_toolpathlayer_segmentprofilehasvaluebyhandle");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_ToolpathLayer_SegmentProfileHasValueByHandle == nullptr)
+			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_ToolpathLayer_GetSegmentProfileValueByHandle = (PLibMCEnvToolpathLayer_GetSegmentProfileValueByHandlePtr) GetProcAddress(hLibrary, "libmcenv_toolpathlayer_getsegmentprofilevaluebyhandle");
+		#else // _WIN32
+		pWrapperTable->m_ToolpathLayer_GetSegmentProfileValueByHandle = (PLibMCEnvToolpathLayer_GetSegmentProfileValueByHandlePtr) dlsym(hLibrary, "libmcenv_toolpathlayer_getsegmentprofilevaluebyhandle");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_ToolpathLayer_GetSegmentProfileValueByHandle == nullptr)
+			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_ToolpathLayer_GetSegmentProfileValueByHandleDef = (PLibMCEnvToolpathLayer_GetSegmentProfileValueByHandleDefPtr) GetProcAddress(hLibrary, "libmcenv_toolpathlayer_getsegmentprofilevaluebyhandledef");
+		#else // _WIN32
+		pWrapperTable->m_ToolpathLayer_GetSegmentProfileValueByHandleDef = (PLibMCEnvToolpathLayer_GetSegmentProfileValueByHandleDefPtr) dlsym(hLibrary, "libmcenv_toolpathlayer_getsegmentprofilevaluebyhandledef");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_ToolpathLayer_GetSegmentProfileValueByHandleDef == nullptr)
+			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_ToolpathLayer_GetSegmentProfileDoubleValueByHandle = (PLibMCEnvToolpathLayer_GetSegmentProfileDoubleValueByHandlePtr) GetProcAddress(hLibrary, "libmcenv_toolpathlayer_getsegmentprofiledoublevaluebyhandle");
+		#else // _WIN32
+		pWrapperTable->m_ToolpathLayer_GetSegmentProfileDoubleValueByHandle = (PLibMCEnvToolpathLayer_GetSegmentProfileDoubleValueByHandlePtr) dlsym(hLibrary, "libmcenv_toolpathlayer_getsegmentprofiledoublevaluebyhandle");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_ToolpathLayer_GetSegmentProfileDoubleValueByHandle == nullptr)
+			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_ToolpathLayer_GetSegmentProfileDoubleValueByHandleDef = (PLibMCEnvToolpathLayer_GetSegmentProfileDoubleValueByHandleDefPtr) GetProcAddress(hLibrary, "libmcenv_toolpathlayer_getsegmentprofiledoublevaluebyhandledef");
+		#else // _WIN32
+		pWrapperTable->m_ToolpathLayer_GetSegmentProfileDoubleValueByHandleDef = (PLibMCEnvToolpathLayer_GetSegmentProfileDoubleValueByHandleDefPtr) dlsym(hLibrary, "libmcenv_toolpathlayer_getsegmentprofiledoublevaluebyhandledef");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_ToolpathLayer_GetSegmentProfileDoubleValueByHandleDef == nullptr)
+			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_ToolpathLayer_GetSegmentProfileIntegerValueByHandle = (PLibMCEnvToolpathLayer_GetSegmentProfileIntegerValueByHandlePtr) GetProcAddress(hLibrary, "libmcenv_toolpathlayer_getsegmentprofileintegervaluebyhandle");
+		#else // _WIN32
+		pWrapperTable->m_ToolpathLayer_GetSegmentProfileIntegerValueByHandle = (PLibMCEnvToolpathLayer_GetSegmentProfileIntegerValueByHandlePtr) dlsym(hLibrary, "libmcenv_toolpathlayer_getsegmentprofileintegervaluebyhandle");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_ToolpathLayer_GetSegmentProfileIntegerValueByHandle == nullptr)
+			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_ToolpathLayer_GetSegmentProfileIntegerValueByHandleDef = (PLibMCEnvToolpathLayer_GetSegmentProfileIntegerValueByHandleDefPtr) GetProcAddress(hLibrary, "libmcenv_toolpathlayer_getsegmentprofileintegervaluebyhandledef");
+		#else // _WIN32
+		pWrapperTable->m_ToolpathLayer_GetSegmentProfileIntegerValueByHandleDef = (PLibMCEnvToolpathLayer_GetSegmentProfileIntegerValueByHandleDefPtr) dlsym(hLibrary, "libmcenv_toolpathlayer_getsegmentprofileintegervaluebyhandledef");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_ToolpathLayer_GetSegmentProfileIntegerValueByHandleDef == nullptr)
+			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_ToolpathLayer_GetSegmentProfileBoolValueByHandle = (PLibMCEnvToolpathLayer_GetSegmentProfileBoolValueByHandlePtr) GetProcAddress(hLibrary, "libmcenv_toolpathlayer_getsegmentprofileboolvaluebyhandle");
+		#else // _WIN32
+		pWrapperTable->m_ToolpathLayer_GetSegmentProfileBoolValueByHandle = (PLibMCEnvToolpathLayer_GetSegmentProfileBoolValueByHandlePtr) dlsym(hLibrary, "libmcenv_toolpathlayer_getsegmentprofileboolvaluebyhandle");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_ToolpathLayer_GetSegmentProfileBoolValueByHandle == nullptr)
+			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_ToolpathLayer_GetSegmentProfileBoolValueByHandleDef = (PLibMCEnvToolpathLayer_GetSegmentProfileBoolValueByHandleDefPtr) GetProcAddress(hLibrary, "libmcenv_toolpathlayer_getsegmentprofileboolvaluebyhandledef");
+		#else // _WIN32
+		pWrapperTable->m_ToolpathLayer_GetSegmentProfileBoolValueByHandleDef = (PLibMCEnvToolpathLayer_GetSegmentProfileBoolValueByHandleDefPtr) dlsym(hLibrary, "libmcenv_toolpathlayer_getsegmentprofileboolvaluebyhandledef");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_ToolpathLayer_GetSegmentProfileBoolValueByHandleDef == nullptr)
+			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		#ifdef _WIN32
 		pWrapperTable->m_ToolpathLayer_GetSegmentPartUUID = (PLibMCEnvToolpathLayer_GetSegmentPartUUIDPtr) GetProcAddress(hLibrary, "libmcenv_toolpathlayer_getsegmentpartuuid");
 		#else // _WIN32
@@ -11576,6 +11719,60 @@ public:
 		if (pWrapperTable->m_JournalVariable_ComputeIntegerSample == nullptr)
 			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		#ifdef _WIN32
+		pWrapperTable->m_JournalVariable_ComputeMinimum = (PLibMCEnvJournalVariable_ComputeMinimumPtr) GetProcAddress(hLibrary, "libmcenv_journalvariable_computeminimum");
+		#else // _WIN32
+		pWrapperTable->m_JournalVariable_ComputeMinimum = (PLibMCEnvJournalVariable_ComputeMinimumPtr) dlsym(hLibrary, "libmcenv_journalvariable_computeminimum");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_JournalVariable_ComputeMinimum == nullptr)
+			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_JournalVariable_ComputeMaximum = (PLibMCEnvJournalVariable_ComputeMaximumPtr) GetProcAddress(hLibrary, "libmcenv_journalvariable_computemaximum");
+		#else // _WIN32
+		pWrapperTable->m_JournalVariable_ComputeMaximum = (PLibMCEnvJournalVariable_ComputeMaximumPtr) dlsym(hLibrary, "libmcenv_journalvariable_computemaximum");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_JournalVariable_ComputeMaximum == nullptr)
+			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_JournalVariable_ComputeAverage = (PLibMCEnvJournalVariable_ComputeAveragePtr) GetProcAddress(hLibrary, "libmcenv_journalvariable_computeaverage");
+		#else // _WIN32
+		pWrapperTable->m_JournalVariable_ComputeAverage = (PLibMCEnvJournalVariable_ComputeAveragePtr) dlsym(hLibrary, "libmcenv_journalvariable_computeaverage");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_JournalVariable_ComputeAverage == nullptr)
+			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_JournalVariable_ComputeIntegral = (PLibMCEnvJournalVariable_ComputeIntegralPtr) GetProcAddress(hLibrary, "libmcenv_journalvariable_computeintegral");
+		#else // _WIN32
+		pWrapperTable->m_JournalVariable_ComputeIntegral = (PLibMCEnvJournalVariable_ComputeIntegralPtr) dlsym(hLibrary, "libmcenv_journalvariable_computeintegral");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_JournalVariable_ComputeIntegral == nullptr)
+			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_JournalVariable_ComputeUniformSampling = (PLibMCEnvJournalVariable_ComputeUniformSamplingPtr) GetProcAddress(hLibrary, "libmcenv_journalvariable_computeuniformsampling");
+		#else // _WIN32
+		pWrapperTable->m_JournalVariable_ComputeUniformSampling = (PLibMCEnvJournalVariable_ComputeUniformSamplingPtr) dlsym(hLibrary, "libmcenv_journalvariable_computeuniformsampling");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_JournalVariable_ComputeUniformSampling == nullptr)
+			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_JournalVariable_ReceiveRawTimeStream = (PLibMCEnvJournalVariable_ReceiveRawTimeStreamPtr) GetProcAddress(hLibrary, "libmcenv_journalvariable_receiverawtimestream");
+		#else // _WIN32
+		pWrapperTable->m_JournalVariable_ReceiveRawTimeStream = (PLibMCEnvJournalVariable_ReceiveRawTimeStreamPtr) dlsym(hLibrary, "libmcenv_journalvariable_receiverawtimestream");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_JournalVariable_ReceiveRawTimeStream == nullptr)
+			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		#ifdef _WIN32
 		pWrapperTable->m_Alert_GetUUID = (PLibMCEnvAlert_GetUUIDPtr) GetProcAddress(hLibrary, "libmcenv_alert_getuuid");
 		#else // _WIN32
@@ -13079,6 +13276,42 @@ public:
 		if (pWrapperTable->m_StateEnvironment_ReleaseDataSeries == nullptr)
 			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		#ifdef _WIN32
+		pWrapperTable->m_StateEnvironment_RegisterJSONEventStream = (PLibMCEnvStateEnvironment_RegisterJSONEventStreamPtr) GetProcAddress(hLibrary, "libmcenv_stateenvironment_registerjsoneventstream");
+		#else // _WIN32
+		pWrapperTable->m_StateEnvironment_RegisterJSONEventStream = (PLibMCEnvStateEnvironment_RegisterJSONEventStreamPtr) dlsym(hLibrary, "libmcenv_stateenvironment_registerjsoneventstream");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_StateEnvironment_RegisterJSONEventStream == nullptr)
+			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_StateEnvironment_RegisterJPEGImageStream = (PLibMCEnvStateEnvironment_RegisterJPEGImageStreamPtr) GetProcAddress(hLibrary, "libmcenv_stateenvironment_registerjpegimagestream");
+		#else // _WIN32
+		pWrapperTable->m_StateEnvironment_RegisterJPEGImageStream = (PLibMCEnvStateEnvironment_RegisterJPEGImageStreamPtr) dlsym(hLibrary, "libmcenv_stateenvironment_registerjpegimagestream");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_StateEnvironment_RegisterJPEGImageStream == nullptr)
+			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_StateEnvironment_PublishStreamEvent = (PLibMCEnvStateEnvironment_PublishStreamEventPtr) GetProcAddress(hLibrary, "libmcenv_stateenvironment_publishstreamevent");
+		#else // _WIN32
+		pWrapperTable->m_StateEnvironment_PublishStreamEvent = (PLibMCEnvStateEnvironment_PublishStreamEventPtr) dlsym(hLibrary, "libmcenv_stateenvironment_publishstreamevent");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_StateEnvironment_PublishStreamEvent == nullptr)
+			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_StateEnvironment_PublishStreamImage = (PLibMCEnvStateEnvironment_PublishStreamImagePtr) GetProcAddress(hLibrary, "libmcenv_stateenvironment_publishstreamimage");
+		#else // _WIN32
+		pWrapperTable->m_StateEnvironment_PublishStreamImage = (PLibMCEnvStateEnvironment_PublishStreamImagePtr) dlsym(hLibrary, "libmcenv_stateenvironment_publishstreamimage");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_StateEnvironment_PublishStreamImage == nullptr)
+			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		#ifdef _WIN32
 		pWrapperTable->m_StateEnvironment_CreateAlert = (PLibMCEnvStateEnvironment_CreateAlertPtr) GetProcAddress(hLibrary, "libmcenv_stateenvironment_createalert");
 		#else // _WIN32
@@ -15316,6 +15549,50 @@ public:
 		if ( (eLookupError != 0) || (pWrapperTable->m_ToolpathLayer_GetSegmentProfileTypedModificationType == nullptr) )
 			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		eLookupError = (*pLookup)("libmcenv_toolpathlayer_resolveprofilevaluehandle", (void**)&(pWrapperTable->m_ToolpathLayer_ResolveProfileValueHandle));
+		if ( (eLookupError != 0) || (pWrapperTable->m_ToolpathLayer_ResolveProfileValueHandle == nullptr) )
+			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libmcenv_toolpathlayer_resolvetypedprofilevaluehandle", (void**)&(pWrapperTable->m_ToolpathLayer_ResolveTypedProfileValueHandle));
+		if ( (eLookupError != 0) || (pWrapperTable->m_ToolpathLayer_ResolveTypedProfileValueHandle == nullptr) )
+			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libmcenv_toolpathlayer_segmentprofilehasvaluebyhandle", (void**)&(pWrapperTable->m_ToolpathLayer_SegmentProfileHasValueByHandle));
+		if ( (eLookupError != 0) || (pWrapperTable->m_ToolpathLayer_SegmentProfileHasValueByHandle == nullptr) )
+			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libmcenv_toolpathlayer_getsegmentprofilevaluebyhandle", (void**)&(pWrapperTable->m_ToolpathLayer_GetSegmentProfileValueByHandle));
+		if ( (eLookupError != 0) || (pWrapperTable->m_ToolpathLayer_GetSegmentProfileValueByHandle == nullptr) )
+			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libmcenv_toolpathlayer_getsegmentprofilevaluebyhandledef", (void**)&(pWrapperTable->m_ToolpathLayer_GetSegmentProfileValueByHandleDef));
+		if ( (eLookupError != 0) || (pWrapperTable->m_ToolpathLayer_GetSegmentProfileValueByHandleDef == nullptr) )
+			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libmcenv_toolpathlayer_getsegmentprofiledoublevaluebyhandle", (void**)&(pWrapperTable->m_ToolpathLayer_GetSegmentProfileDoubleValueByHandle));
+		if ( (eLookupError != 0) || (pWrapperTable->m_ToolpathLayer_GetSegmentProfileDoubleValueByHandle == nullptr) )
+			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libmcenv_toolpathlayer_getsegmentprofiledoublevaluebyhandledef", (void**)&(pWrapperTable->m_ToolpathLayer_GetSegmentProfileDoubleValueByHandleDef));
+		if ( (eLookupError != 0) || (pWrapperTable->m_ToolpathLayer_GetSegmentProfileDoubleValueByHandleDef == nullptr) )
+			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libmcenv_toolpathlayer_getsegmentprofileintegervaluebyhandle", (void**)&(pWrapperTable->m_ToolpathLayer_GetSegmentProfileIntegerValueByHandle));
+		if ( (eLookupError != 0) || (pWrapperTable->m_ToolpathLayer_GetSegmentProfileIntegerValueByHandle == nullptr) )
+			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libmcenv_toolpathlayer_getsegmentprofileintegervaluebyhandledef", (void**)&(pWrapperTable->m_ToolpathLayer_GetSegmentProfileIntegerValueByHandleDef));
+		if ( (eLookupError != 0) || (pWrapperTable->m_ToolpathLayer_GetSegmentProfileIntegerValueByHandleDef == nullptr) )
+			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libmcenv_toolpathlayer_getsegmentprofileboolvaluebyhandle", (void**)&(pWrapperTable->m_ToolpathLayer_GetSegmentProfileBoolValueByHandle));
+		if ( (eLookupError != 0) || (pWrapperTable->m_ToolpathLayer_GetSegmentProfileBoolValueByHandle == nullptr) )
+			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libmcenv_toolpathlayer_getsegmentprofileboolvaluebyhandledef", (void**)&(pWrapperTable->m_ToolpathLayer_GetSegmentProfileBoolValueByHandleDef));
+		if ( (eLookupError != 0) || (pWrapperTable->m_ToolpathLayer_GetSegmentProfileBoolValueByHandleDef == nullptr) )
+			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		eLookupError = (*pLookup)("libmcenv_toolpathlayer_getsegmentpartuuid", (void**)&(pWrapperTable->m_ToolpathLayer_GetSegmentPartUUID));
 		if ( (eLookupError != 0) || (pWrapperTable->m_ToolpathLayer_GetSegmentPartUUID == nullptr) )
 			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
@@ -17112,6 +17389,30 @@ public:
 		if ( (eLookupError != 0) || (pWrapperTable->m_JournalVariable_ComputeIntegerSample == nullptr) )
 			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		eLookupError = (*pLookup)("libmcenv_journalvariable_computeminimum", (void**)&(pWrapperTable->m_JournalVariable_ComputeMinimum));
+		if ( (eLookupError != 0) || (pWrapperTable->m_JournalVariable_ComputeMinimum == nullptr) )
+			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libmcenv_journalvariable_computemaximum", (void**)&(pWrapperTable->m_JournalVariable_ComputeMaximum));
+		if ( (eLookupError != 0) || (pWrapperTable->m_JournalVariable_ComputeMaximum == nullptr) )
+			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libmcenv_journalvariable_computeaverage", (void**)&(pWrapperTable->m_JournalVariable_ComputeAverage));
+		if ( (eLookupError != 0) || (pWrapperTable->m_JournalVariable_ComputeAverage == nullptr) )
+			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libmcenv_journalvariable_computeintegral", (void**)&(pWrapperTable->m_JournalVariable_ComputeIntegral));
+		if ( (eLookupError != 0) || (pWrapperTable->m_JournalVariable_ComputeIntegral == nullptr) )
+			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libmcenv_journalvariable_computeuniformsampling", (void**)&(pWrapperTable->m_JournalVariable_ComputeUniformSampling));
+		if ( (eLookupError != 0) || (pWrapperTable->m_JournalVariable_ComputeUniformSampling == nullptr) )
+			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libmcenv_journalvariable_receiverawtimestream", (void**)&(pWrapperTable->m_JournalVariable_ReceiveRawTimeStream));
+		if ( (eLookupError != 0) || (pWrapperTable->m_JournalVariable_ReceiveRawTimeStream == nullptr) )
+			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		eLookupError = (*pLookup)("libmcenv_alert_getuuid", (void**)&(pWrapperTable->m_Alert_GetUUID));
 		if ( (eLookupError != 0) || (pWrapperTable->m_Alert_GetUUID == nullptr) )
 			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
@@ -17780,6 +18081,22 @@ public:
 		if ( (eLookupError != 0) || (pWrapperTable->m_StateEnvironment_ReleaseDataSeries == nullptr) )
 			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		eLookupError = (*pLookup)("libmcenv_stateenvironment_registerjsoneventstream", (void**)&(pWrapperTable->m_StateEnvironment_RegisterJSONEventStream));
+		if ( (eLookupError != 0) || (pWrapperTable->m_StateEnvironment_RegisterJSONEventStream == nullptr) )
+			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libmcenv_stateenvironment_registerjpegimagestream", (void**)&(pWrapperTable->m_StateEnvironment_RegisterJPEGImageStream));
+		if ( (eLookupError != 0) || (pWrapperTable->m_StateEnvironment_RegisterJPEGImageStream == nullptr) )
+			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libmcenv_stateenvironment_publishstreamevent", (void**)&(pWrapperTable->m_StateEnvironment_PublishStreamEvent));
+		if ( (eLookupError != 0) || (pWrapperTable->m_StateEnvironment_PublishStreamEvent == nullptr) )
+			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libmcenv_stateenvironment_publishstreamimage", (void**)&(pWrapperTable->m_StateEnvironment_PublishStreamImage));
+		if ( (eLookupError != 0) || (pWrapperTable->m_StateEnvironment_PublishStreamImage == nullptr) )
+			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		eLookupError = (*pLookup)("libmcenv_stateenvironment_createalert", (void**)&(pWrapperTable->m_StateEnvironment_CreateAlert));
 		if ( (eLookupError != 0) || (pWrapperTable->m_StateEnvironment_CreateAlert == nullptr) )
 			return LIBMCENV_ERROR_COULDNOTFINDLIBRARYEXPORT;
@@ -22286,6 +22603,169 @@ public:
 		return resultModificationType;
 	}
 	
+	/**
+	* CToolpathLayer::ResolveProfileValueHandle - Resolves a profile value name into a handle that is valid for all segments of this layer. Handles allow fast repeated access to profile values without string lookups.
+	* @param[in] sNamespace - Namespace to query for.
+	* @param[in] sValueName - Value Name to query for.
+	* @return Value handle. Returns 0 if no profile of the layer has the value.
+	*/
+	LibMCEnv_uint32 CToolpathLayer::ResolveProfileValueHandle(const std::string & sNamespace, const std::string & sValueName)
+	{
+		LibMCEnv_uint32 resultValueHandle = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_ToolpathLayer_ResolveProfileValueHandle(m_pHandle, sNamespace.c_str(), sValueName.c_str(), &resultValueHandle));
+		
+		return resultValueHandle;
+	}
+	
+	/**
+	* CToolpathLayer::ResolveTypedProfileValueHandle - Resolves a profile value of a standard type into a handle that is valid for all segments of this layer.
+	* @param[in] eValueType - Enum to query for. MUST NOT be custom.
+	* @return Value handle. Returns 0 if no profile of the layer has the value.
+	*/
+	LibMCEnv_uint32 CToolpathLayer::ResolveTypedProfileValueHandle(const eToolpathProfileValueType eValueType)
+	{
+		LibMCEnv_uint32 resultValueHandle = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_ToolpathLayer_ResolveTypedProfileValueHandle(m_pHandle, eValueType, &resultValueHandle));
+		
+		return resultValueHandle;
+	}
+	
+	/**
+	* CToolpathLayer::SegmentProfileHasValueByHandle - Returns if the segment profile has a value.
+	* @param[in] nSegmentIndex - Index. Must be between 0 and Count - 1.
+	* @param[in] nValueHandle - Value handle, as returned by ResolveProfileValueHandle.
+	* @return Returns true if value exist.
+	*/
+	bool CToolpathLayer::SegmentProfileHasValueByHandle(const LibMCEnv_uint32 nSegmentIndex, const LibMCEnv_uint32 nValueHandle)
+	{
+		bool resultHasValue = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_ToolpathLayer_SegmentProfileHasValueByHandle(m_pHandle, nSegmentIndex, nValueHandle, &resultHasValue));
+		
+		return resultHasValue;
+	}
+	
+	/**
+	* CToolpathLayer::GetSegmentProfileValueByHandle - Retrieves an assigned profile custom value. Fails if value does not exist.
+	* @param[in] nSegmentIndex - Index. Must be between 0 and Count - 1.
+	* @param[in] nValueHandle - Value handle, as returned by ResolveProfileValueHandle.
+	* @return String Value.
+	*/
+	std::string CToolpathLayer::GetSegmentProfileValueByHandle(const LibMCEnv_uint32 nSegmentIndex, const LibMCEnv_uint32 nValueHandle)
+	{
+		LibMCEnv_uint32 bytesNeededValue = 0;
+		LibMCEnv_uint32 bytesWrittenValue = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_ToolpathLayer_GetSegmentProfileValueByHandle(m_pHandle, nSegmentIndex, nValueHandle, 0, &bytesNeededValue, nullptr));
+		std::vector<char> bufferValue(bytesNeededValue);
+		CheckError(m_pWrapper->m_WrapperTable.m_ToolpathLayer_GetSegmentProfileValueByHandle(m_pHandle, nSegmentIndex, nValueHandle, bytesNeededValue, &bytesWrittenValue, &bufferValue[0]));
+		
+		return std::string(&bufferValue[0]);
+	}
+	
+	/**
+	* CToolpathLayer::GetSegmentProfileValueByHandleDef - Retrieves an assigned profile custom value.
+	* @param[in] nSegmentIndex - Index. Must be between 0 and Count - 1.
+	* @param[in] nValueHandle - Value handle, as returned by ResolveProfileValueHandle.
+	* @param[in] sDefaultValue - Default value if value does not exist.
+	* @return String Value.
+	*/
+	std::string CToolpathLayer::GetSegmentProfileValueByHandleDef(const LibMCEnv_uint32 nSegmentIndex, const LibMCEnv_uint32 nValueHandle, const std::string & sDefaultValue)
+	{
+		LibMCEnv_uint32 bytesNeededValue = 0;
+		LibMCEnv_uint32 bytesWrittenValue = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_ToolpathLayer_GetSegmentProfileValueByHandleDef(m_pHandle, nSegmentIndex, nValueHandle, sDefaultValue.c_str(), 0, &bytesNeededValue, nullptr));
+		std::vector<char> bufferValue(bytesNeededValue);
+		CheckError(m_pWrapper->m_WrapperTable.m_ToolpathLayer_GetSegmentProfileValueByHandleDef(m_pHandle, nSegmentIndex, nValueHandle, sDefaultValue.c_str(), bytesNeededValue, &bytesWrittenValue, &bufferValue[0]));
+		
+		return std::string(&bufferValue[0]);
+	}
+	
+	/**
+	* CToolpathLayer::GetSegmentProfileDoubleValueByHandle - Retrieves an assigned profile custom double value. Fails if value does not exist or is not a double value.
+	* @param[in] nSegmentIndex - Index. Must be between 0 and Count - 1.
+	* @param[in] nValueHandle - Value handle, as returned by ResolveProfileValueHandle.
+	* @return Double Value.
+	*/
+	LibMCEnv_double CToolpathLayer::GetSegmentProfileDoubleValueByHandle(const LibMCEnv_uint32 nSegmentIndex, const LibMCEnv_uint32 nValueHandle)
+	{
+		LibMCEnv_double resultValue = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_ToolpathLayer_GetSegmentProfileDoubleValueByHandle(m_pHandle, nSegmentIndex, nValueHandle, &resultValue));
+		
+		return resultValue;
+	}
+	
+	/**
+	* CToolpathLayer::GetSegmentProfileDoubleValueByHandleDef - Retrieves an assigned profile custom double value. Fails if value exists but is not a double value.
+	* @param[in] nSegmentIndex - Index. Must be between 0 and Count - 1.
+	* @param[in] nValueHandle - Value handle, as returned by ResolveProfileValueHandle.
+	* @param[in] dDefaultValue - Default value if value does not exist.
+	* @return Double Value.
+	*/
+	LibMCEnv_double CToolpathLayer::GetSegmentProfileDoubleValueByHandleDef(const LibMCEnv_uint32 nSegmentIndex, const LibMCEnv_uint32 nValueHandle, const LibMCEnv_double dDefaultValue)
+	{
+		LibMCEnv_double resultValue = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_ToolpathLayer_GetSegmentProfileDoubleValueByHandleDef(m_pHandle, nSegmentIndex, nValueHandle, dDefaultValue, &resultValue));
+		
+		return resultValue;
+	}
+	
+	/**
+	* CToolpathLayer::GetSegmentProfileIntegerValueByHandle - Retrieves an assigned profile custom integer value. Fails if value does not exist or is not a integer value.
+	* @param[in] nSegmentIndex - Index. Must be between 0 and Count - 1.
+	* @param[in] nValueHandle - Value handle, as returned by ResolveProfileValueHandle.
+	* @return Integer Value.
+	*/
+	LibMCEnv_int64 CToolpathLayer::GetSegmentProfileIntegerValueByHandle(const LibMCEnv_uint32 nSegmentIndex, const LibMCEnv_uint32 nValueHandle)
+	{
+		LibMCEnv_int64 resultValue = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_ToolpathLayer_GetSegmentProfileIntegerValueByHandle(m_pHandle, nSegmentIndex, nValueHandle, &resultValue));
+		
+		return resultValue;
+	}
+	
+	/**
+	* CToolpathLayer::GetSegmentProfileIntegerValueByHandleDef - Retrieves an assigned profile custom integer value. Fails if value exists but is not a integer value.
+	* @param[in] nSegmentIndex - Index. Must be between 0 and Count - 1.
+	* @param[in] nValueHandle - Value handle, as returned by ResolveProfileValueHandle.
+	* @param[in] nDefaultValue - Default value if value does not exist.
+	* @return Integer Value.
+	*/
+	LibMCEnv_int64 CToolpathLayer::GetSegmentProfileIntegerValueByHandleDef(const LibMCEnv_uint32 nSegmentIndex, const LibMCEnv_uint32 nValueHandle, const LibMCEnv_int64 nDefaultValue)
+	{
+		LibMCEnv_int64 resultValue = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_ToolpathLayer_GetSegmentProfileIntegerValueByHandleDef(m_pHandle, nSegmentIndex, nValueHandle, nDefaultValue, &resultValue));
+		
+		return resultValue;
+	}
+	
+	/**
+	* CToolpathLayer::GetSegmentProfileBoolValueByHandle - Retrieves an assigned profile custom boolean value. A Boolean value is either an integer value, or strings of the form true or false (case insensitive). Fails if value does not exist or is not a bool value.
+	* @param[in] nSegmentIndex - Index. Must be between 0 and Count - 1.
+	* @param[in] nValueHandle - Value handle, as returned by ResolveProfileValueHandle.
+	* @return Boolean Value.
+	*/
+	bool CToolpathLayer::GetSegmentProfileBoolValueByHandle(const LibMCEnv_uint32 nSegmentIndex, const LibMCEnv_uint32 nValueHandle)
+	{
+		bool resultValue = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_ToolpathLayer_GetSegmentProfileBoolValueByHandle(m_pHandle, nSegmentIndex, nValueHandle, &resultValue));
+		
+		return resultValue;
+	}
+	
+	/**
+	* CToolpathLayer::GetSegmentProfileBoolValueByHandleDef - Retrieves an assigned profile custom boolean value. A Boolean value is either an integer value, or strings of the form true or false (case insensitive). Fails if value exists but is not a bool value.
+	* @param[in] nSegmentIndex - Index. Must be between 0 and Count - 1.
+	* @param[in] nValueHandle - Value handle, as returned by ResolveProfileValueHandle.
+	* @param[in] bDefaultValue - Default value if value does not exist.
+	* @return Boolean Value.
+	*/
+	bool CToolpathLayer::GetSegmentProfileBoolValueByHandleDef(const LibMCEnv_uint32 nSegmentIndex, const LibMCEnv_uint32 nValueHandle, const bool bDefaultValue)
+	{
+		bool resultValue = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_ToolpathLayer_GetSegmentProfileBoolValueByHandleDef(m_pHandle, nSegmentIndex, nValueHandle, bDefaultValue, &resultValue));
+		
+		return resultValue;
+	}
+	
 	/**
 	* CToolpathLayer::GetSegmentPartUUID - Retrieves the assigned segment part uuid.
 	* @param[in] nSegmentIndex - Index. Must be between 0 and Count - 1.
@@ -28463,6 +28943,97 @@ public:
 		return resultSampleValue;
 	}
 	
+	/**
+	* CJournalVariable::ComputeMinimum - Computes the minimum value of the variable in a time interval.
+	* @param[in] nStartTimeInMicroSeconds - Start of the interval in microseconds.
+	* @param[in] nEndTimeInMicroSeconds - End of the interval in microseconds. MUST be larger than the start.
+	* @return Minimum value in the interval.
+	*/
+	LibMCEnv_double CJournalVariable::ComputeMinimum(const LibMCEnv_uint64 nStartTimeInMicroSeconds, const LibMCEnv_uint64 nEndTimeInMicroSeconds)
+	{
+		LibMCEnv_double resultValue = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_JournalVariable_ComputeMinimum(m_pHandle, nStartTimeInMicroSeconds, nEndTimeInMicroSeconds, &resultValue));
+		
+		return resultValue;
+	}
+	
+	/**
+	* CJournalVariable::ComputeMaximum - Computes the maximum value of the variable in a time interval.
+	* @param[in] nStartTimeInMicroSeconds - Start of the interval in microseconds.
+	* @param[in] nEndTimeInMicroSeconds - End of the interval in microseconds. MUST be larger than the start.
+	* @return Maximum value in the interval.
+	*/
+	LibMCEnv_double CJournalVariable::ComputeMaximum(const LibMCEnv_uint64 nStartTimeInMicroSeconds, const LibMCEnv_uint64 nEndTimeInMicroSeconds)
+	{
+		LibMCEnv_double resultValue = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_JournalVariable_ComputeMaximum(m_pHandle, nStartTimeInMicroSeconds, nEndTimeInMicroSeconds, &resultValue));
+		
+		return resultValue;
+	}
+	
+	/**
+	* CJournalVariable::ComputeAverage - Computes the time weighted average of the variable in a time interval.
+	* @param[in] nStartTimeInMicroSeconds - Start of the interval in microseconds.
+	* @param[in] nEndTimeInMicroSeconds - End of the interval in microseconds. MUST be larger than the start.
+	* @return Average value in the interval.
+	*/
+	LibMCEnv_double CJournalVariable::ComputeAverage(const LibMCEnv_uint64 nStartTimeInMicroSeconds, const LibMCEnv_uint64 nEndTimeInMicroSeconds)
+	{
+		LibMCEnv_double resultValue = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_JournalVariable_ComputeAverage(m_pHandle, nStartTimeInMicroSeconds, nEndTimeInMicroSeconds, &resultValue));
+		
+		return resultValue;
+	}
+	
+	/**
+	* CJournalVariable::ComputeIntegral - Computes the time integral of the variable in a time interval.
+	* @param[in] nStartTimeInMicroSeconds - Start of the interval in microseconds.
+	* @param[in] nEndTimeInMicroSeconds - End of the interval in microseconds. MUST be larger than the start.
+	* @return Integral of the variable in value times seconds.
+	*/
+	LibMCEnv_double CJournalVariable::ComputeIntegral(const LibMCEnv_uint64 nStartTimeInMicroSeconds, const LibMCEnv_uint64 nEndTimeInMicroSeconds)
+	{
+		LibMCEnv_double resultValue = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_JournalVariable_ComputeIntegral(m_pHandle, nStartTimeInMicroSeconds, nEndTimeInMicroSeconds, &resultValue));
+		
+		return resultValue;
+	}
+	
+	/**
+	* CJournalVariable::ComputeUniformSampling - Samples the variable at equidistant time stamps, including both interval ends.
+	* @param[in] nStartTimeInMicroSeconds - Start of the interval in microseconds.
+	* @param[in] nEndTimeInMicroSeconds - End of the interval in microseconds. MUST be larger than the start.
+	* @param[in] nNumberOfSamples - Number of samples. MUST be at least 2.
+	* @return Sampling instance.
+	*/
+	PUniformJournalSampling CJournalVariable::ComputeUniformSampling(const LibMCEnv_uint64 nStartTimeInMicroSeconds, const LibMCEnv_uint64 nEndTimeInMicroSeconds, const LibMCEnv_uint32 nNumberOfSamples)
+	{
+		LibMCEnvHandle hSampling = nullptr;
+		CheckError(m_pWrapper->m_WrapperTable.m_JournalVariable_ComputeUniformSampling(m_pHandle, nStartTimeInMicroSeconds, nEndTimeInMicroSeconds, nNumberOfSamples, &hSampling));
+		
+		if (!hSampling) {
+			CheckError(LIBMCENV_ERROR_INVALIDPARAM);
+		}
+		return std::make_shared<CUniformJournalSampling>(m_pWrapper, hSampling);
+	}
+	
+	/**
+	* CJournalVariable::ReceiveRawTimeStream - Returns the value at the interval start and all recorded value changes within the interval.
+	* @param[in] nStartTimeInMicroSeconds - Start of the interval in microseconds.
+	* @param[in] nEndTimeInMicroSeconds - End of the interval in microseconds. MUST be larger than the start.
+	* @param[in] nTimeStreamEntriesBufferSize - Number of elements in buffer
+	* @param[out] pTimeStreamEntriesNeededCount - will be filled with the count of the written structs, or needed buffer size.
+	* @param[out] pTimeStreamEntriesBuffer - TimeStreamEntry buffer of Array of Timestream entries, in increasing order.
+	*/
+	void CJournalVariable::ReceiveRawTimeStream(const LibMCEnv_uint64 nStartTimeInMicroSeconds, const LibMCEnv_uint64 nEndTimeInMicroSeconds, std::vector<sTimeStreamEntry> & TimeStreamEntriesBuffer)
+	{
+		LibMCEnv_uint64 elementsNeededTimeStreamEntries = 0;
+		LibMCEnv_uint64 elementsWrittenTimeStreamEntries = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_JournalVariable_ReceiveRawTimeStream(m_pHandle, nStartTimeInMicroSeconds, nEndTimeInMicroSeconds, 0, &elementsNeededTimeStreamEntries, nullptr));
+		TimeStreamEntriesBuffer.resize((size_t) elementsNeededTimeStreamEntries);
+		CheckError(m_pWrapper->m_WrapperTable.m_JournalVariable_ReceiveRawTimeStream(m_pHandle, nStartTimeInMicroSeconds, nEndTimeInMicroSeconds, elementsNeededTimeStreamEntries, &elementsWrittenTimeStreamEntries, TimeStreamEntriesBuffer.data()));
+	}
+	
 	/**
 	 * Method definitions for class CAlert
 	 */
@@ -30974,6 +31545,59 @@ public:
 		CheckError(m_pWrapper->m_WrapperTable.m_StateEnvironment_ReleaseDataSeries(m_pHandle, sDataSeriesUUID.c_str()));
 	}
 	
+	/**
+	* CStateEnvironment::RegisterJSONEventStream - Registers a push stream of JSON events, that clients can subscribe to as Server-Sent Events. Returns the existing stream, if the identifier has been registered before.
+	* @param[in] sIdentifier - Identifier of the stream.
+	* @return UUID of the stream.
+	*/
+	std::string CStateEnvironment::RegisterJSONEventStream(const std::string & sIdentifier)
+	{
+		LibMCEnv_uint32 bytesNeededStreamUUID = 0;
+		LibMCEnv_uint32 bytesWrittenStreamUUID = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_StateEnvironment_RegisterJSONEventStream(m_pHandle, sIdentifier.c_str(), 0, &bytesNeededStreamUUID, nullptr));
+		std::vector<char> bufferStreamUUID(bytesNeededStreamUUID);
+		CheckError(m_pWrapper->m_WrapperTable.m_StateEnvironment_RegisterJSONEventStream(m_pHandle, sIdentifier.c_str(), bytesNeededStreamUUID, &bytesWrittenStreamUUID, &bufferStreamUUID[0]));
+		
+		return std::string(&bufferStreamUUID[0]);
+	}
+	
+	/**
+	* CStateEnvironment::RegisterJPEGImageStream - Registers a push stream of JPEG images, that clients can subscribe to as MJPEG stream. Returns the existing stream, if the identifier has been registered before.
+	* @param[in] sIdentifier - Identifier of the stream.
+	* @return UUID of the stream.
+	*/
+	std::string CStateEnvironment::RegisterJPEGImageStream(const std::string & sIdentifier)
+	{
+		LibMCEnv_uint32 bytesNeededStreamUUID = 0;
+		LibMCEnv_uint32 bytesWrittenStreamUUID = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_StateEnvironment_RegisterJPEGImageStream(m_pHandle, sIdentifier.c_str(), 0, &bytesNeededStreamUUID, nullptr));
+		std::vector<char> bufferStreamUUID(bytesNeededStreamUUID);
+		CheckError(m_pWrapper->m_WrapperTable.m_StateEnvironment_RegisterJPEGImageStream(m_pHandle, sIdentifier.c_str(), bytesNeededStreamUUID, &bytesWrittenStreamUUID, &bufferStreamUUID[0]));
+		
+		return std::string(&bufferStreamUUID[0]);
+	}
+	
+	/**
+	* CStateEnvironment::PublishStreamEvent - Publishes a JSON event to all connections of a JSON event stream.
+	* @param[in] sStreamUUID - UUID of the stream.
+	* @param[in] sEventJSON - JSON payload of the event.
+	*/
+	void CStateEnvironment::PublishStreamEvent(const std::string & sStreamUUID, const std::string & sEventJSON)
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_StateEnvironment_PublishStreamEvent(m_pHandle, sStreamUUID.c_str(), sEventJSON.c_str()));
+	}
+	
+	/**
+	* CStateEnvironment::PublishStreamImage - Publishes a JPEG frame to all connections of a JPEG image stream.
+	* @param[in] sStreamUUID - UUID of the stream.
+	* @param[in] nJPEGDataBufferSize - Number of elements in buffer
+	* @param[in] pJPEGDataBuffer - JPEG encoded frame.
+	*/
+	void CStateEnvironment::PublishStreamImage(const std::string & sStreamUUID, const CInputVector<LibMCEnv_uint8> & JPEGDataBuffer)
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_StateEnvironment_PublishStreamImage(m_pHandle, sStreamUUID.c_str(), (LibMCEnv_uint64)JPEGDataBuffer.size(), JPEGDataBuffer.data()));
+	}
+	
 	/**
 	* CStateEnvironment::CreateAlert - creates a new alert
 	* @param[in] sIdentifier - Alert type identifier. Call fails if identifier is not registered.
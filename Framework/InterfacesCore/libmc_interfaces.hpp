@@ -277,6 +277,13 @@ public:
 	*/
 	virtual IStreamData * GetNewContent() = 0;
 
+	/**
+	* IStreamConnection::WaitForNewContent - Blocks until new content for the stream is available or the timeout has passed.
+	* @param[in] nTimeOutInMS - Maximum time to wait in milliseconds.
+	* @return Stream Data Instance. Null, if no new content arrived in time.
+	*/
+	virtual IStreamData * WaitForNewContent(const LibMC_uint32 nTimeOutInMS) = 0;
+
 	/**
 	* IStreamConnection::GetIdleDelay - Returns the number of milliseconds, that the caller should wait before checking for another content.
 	* @return Idle Delay.
@@ -367,6 +374,41 @@ public:
 	*/
 	virtual std::string GetContentDispositionName() = 0;
 
+	/**
+	* IAPIRequestHandler::GetETag - Returns the entity tag of the response. Must be called after Handle.
+	* @return Strong entity tag including quotes. Empty, if the response is not cacheable.
+	*/
+	virtual std::string GetETag() = 0;
+
+	/**
+	* IAPIRequestHandler::SelectContentEncoding - Selects a precompressed variant of the response, if the client accepts it. Must be called after Handle and before GetResultData.
+	* @param[in] sAcceptEncoding - Value of the Accept-Encoding request header.
+	* @return Selected content encoding (gzip or deflate). Empty, if the result data is sent unencoded.
+	*/
+	virtual std::string SelectContentEncoding(const std::string & sAcceptEncoding) = 0;
+
+	/**
+	* IAPIRequestHandler::AcceptsRanges - Returns if the result data may be delivered in byte ranges. Must be called after Handle.
+	* @return True, if the response supports range requests.
+	*/
+	virtual bool AcceptsRanges() = 0;
+
+	/**
+	* IAPIRequestHandler::GetResultSize - Returns the size of the result data in the selected content encoding. Must be called after Handle.
+	* @return Size of the result data in bytes.
+	*/
+	virtual LibMC_uint64 GetResultSize() = 0;
+
+	/**
+	* IAPIRequestHandler::GetResultDataRange - Returns a byte range of the resulting data. Call only after Handle().
+	* @param[in] nOffset - Offset of the first byte to return.
+	* @param[in] nLength - Number of bytes to return. Offset plus Length MUST NOT exceed the result size.
+	* @param[in] nDataBufferSize - Number of elements in buffer
+	* @param[out] pDataNeededCount - will be filled with the count of the written structs, or needed buffer size.
+	* @param[out] pDataBuffer - uint8 buffer of Data buffer.
+	*/
+	virtual void GetResultDataRange(const LibMC_uint64 nOffset, const LibMC_uint64 nLength, LibMC_uint64 nDataBufferSize, LibMC_uint64* pDataNeededCount, LibMC_uint8 * pDataBuffer) = 0;
+
 };
 
 typedef IBaseSharedPtr<IAPIRequestHandler> PIAPIRequestHandler;
@@ -189,6 +189,34 @@ LibMCResult libmc_streamconnection_getnewcontent(LibMC_StreamConnection pStreamC
 	}
 }
 
+LibMCResult libmc_streamconnection_waitfornewcontent(LibMC_StreamConnection pStreamConnection, LibMC_uint32 nTimeOutInMS, LibMC_StreamData * pNewContent)
+{
+	IBase* pIBaseClass = (IBase *)pStreamConnection;
+
+	try {
+		if (pNewContent == nullptr)
+			throw ELibMCInterfaceException (LIBMC_ERROR_INVALIDPARAM);
+		IBase* pBaseNewContent(nullptr);
+		IStreamConnection* pIStreamConnection = dynamic_cast<IStreamConnection*>(pIBaseClass);
+		if (!pIStreamConnection)
+			throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDCAST);
+		
+		pBaseNewContent = pIStreamConnection->WaitForNewContent(nTimeOutInMS);
+
+		*pNewContent = (IBase*)(pBaseNewContent);
+		return LIBMC_SUCCESS;
+	}
+	catch (ELibMCInterfaceException & Exception) {
+		return handleLibMCException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
 LibMCResult libmc_streamconnection_getidledelay(LibMC_StreamConnection pStreamConnection, LibMC_uint32 * pIdleDelay)
 {
 	IBase* pIBaseClass = (IBase *)pStreamConnection;
@@ -566,6 +594,183 @@ LibMCResult libmc_apirequesthandler_getcontentdispositionname(LibMC_APIRequestHa
 	}
 }
 
+LibMCResult libmc_apirequesthandler_getetag(LibMC_APIRequestHandler pAPIRequestHandler, const LibMC_uint32 nETagBufferSize, LibMC_uint32* pETagNeededChars, char * pETagBuffer)
+{
+	IBase* pIBaseClass = (IBase *)pAPIRequestHandler;
+
+	try {
+		if ( (!pETagBuffer) && !(pETagNeededChars) )
+			throw ELibMCInterfaceException (LIBMC_ERROR_INVALIDPARAM);
+		std::string sETag("");
+		IAPIRequestHandler* pIAPIRequestHandler = dynamic_cast<IAPIRequestHandler*>(pIBaseClass);
+		if (!pIAPIRequestHandler)
+			throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDCAST);
+		
+		bool isCacheCall = (pETagBuffer == nullptr);
+		if (isCacheCall) {
+			sETag = pIAPIRequestHandler->GetETag();
+
+			pIAPIRequestHandler->_setCache (new ParameterCache_1<std::string> (sETag));
+		}
+		else {
+			auto cache = dynamic_cast<ParameterCache_1<std::string>*> (pIAPIRequestHandler->_getCache ());
+			if (cache == nullptr)
+				throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDCAST);
+			cache->retrieveData (sETag);
+			pIAPIRequestHandler->_setCache (nullptr);
+		}
+		
+		if (pETagNeededChars)
+			*pETagNeededChars = (LibMC_uint32) (sETag.size()+1);
+		if (pETagBuffer) {
+			if (sETag.size() >= nETagBufferSize)
+				throw ELibMCInterfaceException (LIBMC_ERROR_BUFFERTOOSMALL);
+			for (size_t iETag = 0; iETag < sETag.size(); iETag++)
+				pETagBuffer[iETag] = sETag[iETag];
+			pETagBuffer[sETag.size()] = 0;
+		}
+		return LIBMC_SUCCESS;
+	}
+	catch (ELibMCInterfaceException & Exception) {
+		return handleLibMCException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCResult libmc_apirequesthandler_selectcontentencoding(LibMC_APIRequestHandler pAPIRequestHandler, const char * pAcceptEncoding, const LibMC_uint32 nContentEncodingBufferSize, LibMC_uint32* pContentEncodingNeededChars, char * pContentEncodingBuffer)
+{
+	IBase* pIBaseClass = (IBase *)pAPIRequestHandler;
+
+	try {
+		if (pAcceptEncoding == nullptr)
+			throw ELibMCInterfaceException (LIBMC_ERROR_INVALIDPARAM);
+		if ( (!pContentEncodingBuffer) && !(pContentEncodingNeededChars) )
+			throw ELibMCInterfaceException (LIBMC_ERROR_INVALIDPARAM);
+		std::string sAcceptEncoding(pAcceptEncoding);
+		std::string sContentEncoding("");
+		IAPIRequestHandler* pIAPIRequestHandler = dynamic_cast<IAPIRequestHandler*>(pIBaseClass);
+		if (!pIAPIRequestHandler)
+			throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDCAST);
+		
+		bool isCacheCall = (pContentEncodingBuffer == nullptr);
+		if (isCacheCall) {
+			sContentEncoding = pIAPIRequestHandler->SelectContentEncoding(sAcceptEncoding);
+
+			pIAPIRequestHandler->_setCache (new ParameterCache_1<std::string> (sContentEncoding));
+		}
+		else {
+			auto cache = dynamic_cast<ParameterCache_1<std::string>*> (pIAPIRequestHandler->_getCache ());
+			if (cache == nullptr)
+				throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDCAST);
+			cache->retrieveData (sContentEncoding);
+			pIAPIRequestHandler->_setCache (nullptr);
+		}
+		
+		if (pContentEncodingNeededChars)
+			*pContentEncodingNeededChars = (LibMC_uint32) (sContentEncoding.size()+1);
+		if (pContentEncodingBuffer) {
+			if (sContentEncoding.size() >= nContentEncodingBufferSize)
+				throw ELibMCInterfaceException (LIBMC_ERROR_BUFFERTOOSMALL);
+			for (size_t iContentEncoding = 0; iContentEncoding < sContentEncoding.size(); iContentEncoding++)
+				pContentEncodingBuffer[iContentEncoding] = sContentEncoding[iContentEncoding];
+			pContentEncodingBuffer[sContentEncoding.size()] = 0;
+		}
+		return LIBMC_SUCCESS;
+	}
+	catch (ELibMCInterfaceException & Exception) {
+		return handleLibMCException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCResult libmc_apirequesthandler_acceptsranges(LibMC_APIRequestHandler pAPIRequestHandler, bool * pAcceptsRanges)
+{
+	IBase* pIBaseClass = (IBase *)pAPIRequestHandler;
+
+	try {
+		if (pAcceptsRanges == nullptr)
+			throw ELibMCInterfaceException (LIBMC_ERROR_INVALIDPARAM);
+		IAPIRequestHandler* pIAPIRequestHandler = dynamic_cast<IAPIRequestHandler*>(pIBaseClass);
+		if (!pIAPIRequestHandler)
+			throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDCAST);
+		
+		*pAcceptsRanges = pIAPIRequestHandler->AcceptsRanges();
+
+		return LIBMC_SUCCESS;
+	}
+	catch (ELibMCInterfaceException & Exception) {
+		return handleLibMCException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCResult libmc_apirequesthandler_getresultsize(LibMC_APIRequestHandler pAPIRequestHandler, LibMC_uint64 * pSize)
+{
+	IBase* pIBaseClass = (IBase *)pAPIRequestHandler;
+
+	try {
+		if (pSize == nullptr)
+			throw ELibMCInterfaceException (LIBMC_ERROR_INVALIDPARAM);
+		IAPIRequestHandler* pIAPIRequestHandler = dynamic_cast<IAPIRequestHandler*>(pIBaseClass);
+		if (!pIAPIRequestHandler)
+			throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDCAST);
+		
+		*pSize = pIAPIRequestHandler->GetResultSize();
+
+		return LIBMC_SUCCESS;
+	}
+	catch (ELibMCInterfaceException & Exception) {
+		return handleLibMCException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCResult libmc_apirequesthandler_getresultdatarange(LibMC_APIRequestHandler pAPIRequestHandler, LibMC_uint64 nOffset, LibMC_uint64 nLength, const LibMC_uint64 nDataBufferSize, LibMC_uint64* pDataNeededCount, LibMC_uint8 * pDataBuffer)
+{
+	IBase* pIBaseClass = (IBase *)pAPIRequestHandler;
+
+	try {
+		if ((!pDataBuffer) && !(pDataNeededCount))
+			throw ELibMCInterfaceException (LIBMC_ERROR_INVALIDPARAM);
+		IAPIRequestHandler* pIAPIRequestHandler = dynamic_cast<IAPIRequestHandler*>(pIBaseClass);
+		if (!pIAPIRequestHandler)
+			throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDCAST);
+		
+		pIAPIRequestHandler->GetResultDataRange(nOffset, nLength, nDataBufferSize, pDataNeededCount, pDataBuffer);
+
+		return LIBMC_SUCCESS;
+	}
+	catch (ELibMCInterfaceException & Exception) {
+		return handleLibMCException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
 
 /*************************************************************************************************************************
  Class implementation for MCContext
@@ -1017,6 +1222,8 @@ LibMCResult LibMC::Impl::LibMC_GetProcAddress (const char * pProcName, void ** p
 		*ppProcAddress = (void*) &libmc_streamdata_getmimetype;
 	if (sProcName == "libmc_streamconnection_getnewcontent") 
 		*ppProcAddress = (void*) &libmc_streamconnection_getnewcontent;
+	if (sProcName == "libmc_streamconnection_waitfornewcontent") 
+		*ppProcAddress = (void*) &libmc_streamconnection_waitfornewcontent;
 	if (sProcName == "libmc_streamconnection_getidledelay") 
 		*ppProcAddress = (void*) &libmc_streamconnection_getidledelay;
 	if (sProcName == "libmc_streamconnection_getstreamtype") 
@@ -1039,6 +1246,16 @@ LibMCResult LibMC::Impl::LibMC_GetProcAddress (const char * pProcName, void ** p
 		*ppProcAddress = (void*) &libmc_apirequesthandler_getresultdata;
 	if (sProcName == "libmc_apirequesthandler_getcontentdispositionname") 
 		*ppProcAddress = (void*) &libmc_apirequesthandler_getcontentdispositionname;
+	if (sProcName == "libmc_apirequesthandler_getetag") 
+		*ppProcAddress = (void*) &libmc_apirequesthandler_getetag;
+	if (sProcName == "libmc_apirequesthandler_selectcontentencoding") 
+		*ppProcAddress = (void*) &libmc_apirequesthandler_selectcontentencoding;
+	if (sProcName == "libmc_apirequesthandler_acceptsranges") 
+		*ppProcAddress = (void*) &libmc_apirequesthandler_acceptsranges;
+	if (sProcName == "libmc_apirequesthandler_getresultsize") 
+		*ppProcAddress = (void*) &libmc_apirequesthandler_getresultsize;
+	if (sProcName == "libmc_apirequesthandler_getresultdatarange") 
+		*ppProcAddress = (void*) &libmc_apirequesthandler_getresultdatarange;
 	if (sProcName == "libmc_mccontext_registerlibrarypath") 
 		*ppProcAddress = (void*) &libmc_mccontext_registerlibrarypath;
 	if (sProcName == "libmc_mccontext_settempbasepath") 
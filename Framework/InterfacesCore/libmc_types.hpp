@@ -718,6 +718,22 @@ typedef void * LibMC_pvoid;
 #define LIBMC_ERROR_TELEMETRYCHUNKIDMISMATCH 702 /** Telemetry Chunk ID mismatch. */
 #define LIBMC_ERROR_TELEMETRYCHUNKISREADONLY 703 /** Telemetry Chunk is readonly. */
 #define LIBMC_ERROR_TELEMETRYCHUNKSCANONLYBEARCHIVEDIFREADONLY 704 /** Telemetry Chunks can only be archived if readonly. */
+#define LIBMC_ERROR_TOOLPATHLAYERCACHEBOOKKEEPINGERROR 706 /** Toolpath layer cache memory bookkeeping error. */
+#define LIBMC_ERROR_INVALIDPROFILEVALUEHANDLE 707 /** Invalid profile value handle. */
+#define LIBMC_ERROR_PROFILEVALUEISNOTNUMERIC 708 /** Profile value is not of the requested numeric type. */
+#define LIBMC_ERROR_STREAMNOTFOUND 709 /** Stream not found. */
+#define LIBMC_ERROR_INVALIDSTREAMIDENTIFIER 710 /** Invalid stream identifier. */
+#define LIBMC_ERROR_STREAMTYPEMISMATCH 711 /** Stream has already been registered with a different type. */
+#define LIBMC_ERROR_INVALIDSTREAMIMAGEDATA 712 /** Invalid stream image data. Expected a JPEG image. */
+#define LIBMC_ERROR_SYSTEMTASKNOTFOUND 713 /** System task not found. */
+#define LIBMC_ERROR_DUPLICATESYSTEMTASK 714 /** System task has already been registered. */
+#define LIBMC_ERROR_INVALIDSYSTEMTASKINTERVAL 715 /** Invalid system task interval. */
+#define LIBMC_ERROR_INVALIDRESULTDATARANGE 716 /** Requested range exceeds the result data. */
+#define LIBMC_ERROR_INVALIDTOOLPATHLAYERCACHEPARAMETER 717 /** Invalid toolpath layer cache parameter. */
+#define LIBMC_ERROR_MISSINGTESTBUILDUUID 718 /** Missing test build uuid. */
+#define LIBMC_ERROR_MISSINGTESTBUILDNAME 719 /** Missing test build name. */
+#define LIBMC_ERROR_MISSINGTESTBUILDFILENAME 720 /** Missing test build file name. */
+#define LIBMC_ERROR_EMPTYTESTBUILDFILE 721 /** Empty test build file. */
 
 /*************************************************************************************************************************
  Error strings for LibMC
@@ -1348,6 +1364,22 @@ inline const char * LIBMC_GETERRORSTRING (LibMCResult nErrorCode) {
     case LIBMC_ERROR_TELEMETRYCHUNKIDMISMATCH: return "Telemetry Chunk ID mismatch.";
     case LIBMC_ERROR_TELEMETRYCHUNKISREADONLY: return "Telemetry Chunk is readonly.";
     case LIBMC_ERROR_TELEMETRYCHUNKSCANONLYBEARCHIVEDIFREADONLY: return "Telemetry Chunks can only be archived if readonly.";
+    case LIBMC_ERROR_TOOLPATHLAYERCACHEBOOKKEEPINGERROR: return "Toolpath layer cache memory bookkeeping error.";
+    case LIBMC_ERROR_INVALIDPROFILEVALUEHANDLE: return "Invalid profile value handle.";
+    case LIBMC_ERROR_PROFILEVALUEISNOTNUMERIC: return "Profile value is not of the requested numeric type.";
+    case LIBMC_ERROR_STREAMNOTFOUND: return "Stream not found.";
+    case LIBMC_ERROR_INVALIDSTREAMIDENTIFIER: return "Invalid stream identifier.";
+    case LIBMC_ERROR_STREAMTYPEMISMATCH: return "Stream has already been registered with a different type.";
+    case LIBMC_ERROR_INVALIDSTREAMIMAGEDATA: return "Invalid stream image data. Expected a JPEG image.";
+    case LIBMC_ERROR_SYSTEMTASKNOTFOUND: return "System task not found.";
+    case LIBMC_ERROR_DUPLICATESYSTEMTASK: return "System task has already been registered.";
+    case LIBMC_ERROR_INVALIDSYSTEMTASKINTERVAL: return "Invalid system task interval.";
+    case LIBMC_ERROR_INVALIDRESULTDATARANGE: return "Requested range exceeds the result data.";
+    case LIBMC_ERROR_INVALIDTOOLPATHLAYERCACHEPARAMETER: return "Invalid toolpath layer cache parameter.";
+    case LIBMC_ERROR_MISSINGTESTBUILDUUID: return "Missing test build uuid.";
+    case LIBMC_ERROR_MISSINGTESTBUILDNAME: return "Missing test build name.";
+    case LIBMC_ERROR_MISSINGTESTBUILDFILENAME: return "Missing test build file name.";
+    case LIBMC_ERROR_EMPTYTESTBUILDFILE: return "Empty test build file.";
     default: return "unknown error";
   }
 }
@@ -207,6 +207,14 @@ LIBMCDATA_DECLSPEC LibMCDataResult libmcdata_logsession_addentry(LibMCData_LogSe
 */
 LIBMCDATA_DECLSPEC LibMCDataResult libmcdata_logsession_getmaxlogentryid(LibMCData_LogSession pLogSession, LibMCData_uint32 * pMaxLogID);
 
+/**
+* writes all pending log entries to the database before returning.
+*
+* @param[in] pLogSession - LogSession instance.
+* @return error code or 0 (success)
+*/
+LIBMCDATA_DECLSPEC LibMCDataResult libmcdata_logsession_flush(LibMCData_LogSession pLogSession);
+
 /**
 * retrieves an excerpt of the log.
 *
@@ -856,6 +864,16 @@ LIBMCDATA_DECLSPEC LibMCDataResult libmcdata_storagestream_getcontent(LibMCData_
 */
 LIBMCDATA_DECLSPEC LibMCDataResult libmcdata_storagestream_getcallbacks(LibMCData_StorageStream pStorageStream, LibMCData_pvoid * pTheReadCallback, LibMCData_pvoid * pTheSeekCallback, LibMCData_pvoid * pStreamHandle);
 
+/**
+* returns a read-only memory mapping of the storage stream content. The mapping is only valid throughout the existence of the StorageStream instance.
+*
+* @param[in] pStorageStream - StorageStream instance.
+* @param[out] pData - Pointer to the first byte of the stream. Null, if the stream is empty.
+* @param[out] pSize - Size of the mapping in bytes.
+* @return error code or 0 (success)
+*/
+LIBMCDATA_DECLSPEC LibMCDataResult libmcdata_storagestream_mapcontent(LibMCData_StorageStream pStorageStream, LibMCData_pvoid * pData, LibMCData_uint64 * pSize);
+
 /*************************************************************************************************************************
  Class definition for StorageZIPWriter
 **************************************************************************************************************************/
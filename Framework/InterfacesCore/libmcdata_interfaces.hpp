@@ -426,6 +426,11 @@ public:
 	*/
 	virtual LibMCData_uint32 GetMaxLogEntryID() = 0;
 
+	/**
+	* ILogSession::Flush - writes all pending log entries to the database before returning.
+	*/
+	virtual void Flush() = 0;
+
 	/**
 	* ILogSession::RetrieveLogEntriesByID - retrieves an excerpt of the log.
 	* @param[in] nMinLogID - Minimum log entry ID to receive.
@@ -914,6 +919,13 @@ public:
 	*/
 	virtual void GetCallbacks(LibMCData_pvoid & pTheReadCallback, LibMCData_pvoid & pTheSeekCallback, LibMCData_pvoid & pStreamHandle) = 0;
 
+	/**
+	* IStorageStream::MapContent - returns a read-only memory mapping of the storage stream content. The mapping is only valid throughout the existence of the StorageStream instance.
+	* @param[out] pData - Pointer to the first byte of the stream. Null, if the stream is empty.
+	* @param[out] nSize - Size of the mapping in bytes.
+	*/
+	virtual void MapContent(LibMCData_pvoid & pData, LibMCData_uint64 & nSize) = 0;
+
 };
 
 typedef IBaseSharedPtr<IStorageStream> PIStorageStream;
@@ -534,6 +534,30 @@ LibMCDataResult libmcdata_logsession_getmaxlogentryid(LibMCData_LogSession pLogS
 	}
 }
 
+LibMCDataResult libmcdata_logsession_flush(LibMCData_LogSession pLogSession)
+{
+	IBase* pIBaseClass = (IBase *)pLogSession;
+
+	try {
+		ILogSession* pILogSession = dynamic_cast<ILogSession*>(pIBaseClass);
+		if (!pILogSession)
+			throw ELibMCDataInterfaceException(LIBMCDATA_ERROR_INVALIDCAST);
+		
+		pILogSession->Flush();
+
+		return LIBMCDATA_SUCCESS;
+	}
+	catch (ELibMCDataInterfaceException & Exception) {
+		return handleLibMCDataException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
 LibMCDataResult libmcdata_logsession_retrievelogentriesbyid(LibMCData_LogSession pLogSession, LibMCData_uint32 nMinLogID, LibMCData_uint32 nMaxLogID, eLibMCDataLogLevel eMinLogLevel, LibMCData_LogEntryList * pLogEntryList)
 {
 	IBase* pIBaseClass = (IBase *)pLogSession;
@@ -2598,6 +2622,34 @@ LibMCDataResult libmcdata_storagestream_getcallbacks(LibMCData_StorageStream pSt
 	}
 }
 
+LibMCDataResult libmcdata_storagestream_mapcontent(LibMCData_StorageStream pStorageStream, LibMCData_pvoid * pData, LibMCData_uint64 * pSize)
+{
+	IBase* pIBaseClass = (IBase *)pStorageStream;
+
+	try {
+		if (!pData)
+			throw ELibMCDataInterfaceException (LIBMCDATA_ERROR_INVALIDPARAM);
+		if (!pSize)
+			throw ELibMCDataInterfaceException (LIBMCDATA_ERROR_INVALIDPARAM);
+		IStorageStream* pIStorageStream = dynamic_cast<IStorageStream*>(pIBaseClass);
+		if (!pIStorageStream)
+			throw ELibMCDataInterfaceException(LIBMCDATA_ERROR_INVALIDCAST);
+		
+		pIStorageStream->MapContent(*pData, *pSize);
+
+		return LIBMCDATA_SUCCESS;
+	}
+	catch (ELibMCDataInterfaceException & Exception) {
+		return handleLibMCDataException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
 
 /*************************************************************************************************************************
  Class implementation for StorageZIPWriter
@@ -10503,6 +10555,8 @@ LibMCDataResult LibMCData::Impl::LibMCData_GetProcAddress (const char * pProcNam
 		*ppProcAddress = (void*) &libmcdata_logsession_addentry;
 	if (sProcName == "libmcdata_logsession_getmaxlogentryid") 
 		*ppProcAddress = (void*) &libmcdata_logsession_getmaxlogentryid;
+	if (sProcName == "libmcdata_logsession_flush") 
+		*ppProcAddress = (void*) &libmcdata_logsession_flush;
 	if (sProcName == "libmcdata_logsession_retrievelogentriesbyid") 
 		*ppProcAddress = (void*) &libmcdata_logsession_retrievelogentriesbyid;
 	if (sProcName == "libmcdata_alert_getuuid") 
@@ -10617,6 +10671,8 @@ LibMCDataResult LibMCData::Impl::LibMCData_GetProcAddress (const char * pProcNam
 		*ppProcAddress = (void*) &libmcdata_storagestream_getcontent;
 	if (sProcName == "libmcdata_storagestream_getcallbacks") 
 		*ppProcAddress = (void*) &libmcdata_storagestream_getcallbacks;
+	if (sProcName == "libmcdata_storagestream_mapcontent") 
+		*ppProcAddress = (void*) &libmcdata_storagestream_mapcontent;
 	if (sProcName == "libmcdata_storagezipwriter_startnewentry") 
 		*ppProcAddress = (void*) &libmcdata_storagezipwriter_startnewentry;
 	if (sProcName == "libmcdata_storagezipwriter_finishcurrententry") 
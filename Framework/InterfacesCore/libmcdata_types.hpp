@@ -475,6 +475,7 @@ typedef void * LibMCData_pvoid;
 #define LIBMCDATA_ERROR_INVALIDTELEMETRYCHANNELIDENTIFIER 448 /** Invalid telemetry channel identifier. */
 #define LIBMCDATA_ERROR_TELEMETRYCHANNELALREADYEXISTS 449 /** Telemetry channel already exists. */
 #define LIBMCDATA_ERROR_TELEMETRYCHANNELNOTFOUND 450 /** Telemetry channel not found. */
+#define LIBMCDATA_ERROR_COULDNOTMAPSTORAGESTREAM 451 /** Could not map storage stream. */
 
 /*************************************************************************************************************************
  Error strings for LibMCData
@@ -862,6 +863,7 @@ inline const char * LIBMCDATA_GETERRORSTRING (LibMCDataResult nErrorCode) {
     case LIBMCDATA_ERROR_INVALIDTELEMETRYCHANNELIDENTIFIER: return "Invalid telemetry channel identifier.";
     case LIBMCDATA_ERROR_TELEMETRYCHANNELALREADYEXISTS: return "Telemetry channel already exists.";
     case LIBMCDATA_ERROR_TELEMETRYCHANNELNOTFOUND: return "Telemetry channel not found.";
+    case LIBMCDATA_ERROR_COULDNOTMAPSTORAGESTREAM: return "Could not map storage stream.";
     default: return "unknown error";
   }
 }
@@ -971,7 +973,8 @@ namespace LibMCData {
     StateRepeatDelay = 4,
     SignalQueue = 5,
     SignalProcessing = 6,
-    SignalAcknowledgement = 7
+    SignalAcknowledgement = 7,
+    SystemTask = 8
   };
   
   enum class eTelemetryChunkEntryType : LibMCData_int32 {
@@ -3349,6 +3349,134 @@ LIBMCENV_DECLSPEC LibMCEnvResult libmcenv_toolpathlayer_getsegmentprofiletypedva
 */
 LIBMCENV_DECLSPEC LibMCEnvResult libmcenv_toolpathlayer_getsegmentprofiletypedmodificationtype(LibMCEnv_ToolpathLayer pToolpathLayer, LibMCEnv_uint32 nSegmentIndex, LibMCEnv::eToolpathProfileValueType eValueType, LibMCEnv::eToolpathProfileModificationType * pModificationType);
 
+/**
+* Resolves a profile value name into a handle that is valid for all segments of this layer. Handles allow fast repeated access to profile values without string lookups.
+*
+* @param[in] pToolpathLayer - ToolpathLayer instance.
+* @param[in] pNamespace - Namespace to query for.
+* @param[in] pValueName - Value Name to query for.
+* @param[out] pValueHandle - Value handle. Returns 0 if no profile of the layer has the value.
+* @return error code or 0 (success)
+*/
+LIBMCENV_DECLSPEC LibMCEnvResult libmcenv_toolpathlayer_resolveprofilevaluehandle(LibMCEnv_ToolpathLayer pToolpathLayer, const char * pNamespace, const char * pValueName, LibMCEnv_uint32 * pValueHandle);
+
+/**
+* Resolves a profile value of a standard type into a handle that is valid for all segments of this layer.
+*
+* @param[in] pToolpathLayer - ToolpathLayer instance.
+* @param[in] eValueType - Enum to query for. MUST NOT be custom.
+* @param[out] pValueHandle - Value handle. Returns 0 if no profile of the layer has the value.
+* @return error code or 0 (success)
+*/
+LIBMCENV_DECLSPEC LibMCEnvResult libmcenv_toolpathlayer_resolvetypedprofilevaluehandle(LibMCEnv_ToolpathLayer pToolpathLayer, eLibMCEnvToolpathProfileValueType eValueType, LibMCEnv_uint32 * pValueHandle);
+
+/**
+* Returns if the segment profile has a value.
+*
+* @param[in] pToolpathLayer - ToolpathLayer instance.
+* @param[in] nSegmentIndex - Index. Must be between 0 and Count - 1.
+* @param[in] nValueHandle - Value handle, as returned by ResolveProfileValueHandle.
+* @param[out] pHasValue - Returns true if value exist.
+* @return error code or 0 (success)
+*/
+LIBMCENV_DECLSPEC LibMCEnvResult libmcenv_toolpathlayer_segmentprofilehasvaluebyhandle(LibMCEnv_ToolpathLayer pToolpathLayer, LibMCEnv_uint32 nSegmentIndex, LibMCEnv_uint32 nValueHandle, bool * pHasValue);
+
+/**
+* Retrieves an assigned profile custom value. Fails if value does not exist.
+*
+* @param[in] pToolpathLayer - ToolpathLayer instance.
+* @param[in] nSegmentIndex - Index. Must be between 0 and Count - 1.
+* @param[in] nValueHandle - Value handle, as returned by ResolveProfileValueHandle.
+* @param[in] nValueBufferSize - size of the buffer (including trailing 0)
+* @param[out] pValueNeededChars - will be filled with the count of the written bytes, or needed buffer size.
+* @param[out] pValueBuffer -  buffer of String Value., may be NULL
+* @return error code or 0 (success)
+*/
+LIBMCENV_DECLSPEC LibMCEnvResult libmcenv_toolpathlayer_getsegmentprofilevaluebyhandle(LibMCEnv_ToolpathLayer pToolpathLayer, LibMCEnv_uint32 nSegmentIndex, LibMCEnv_uint32 nValueHandle, const LibMCEnv_uint32 nValueBufferSize, LibMCEnv_uint32* pValueNeededChars, char * pValueBuffer);
+
+/**
+* Retrieves an assigned profile custom value.
+*
+* @param[in] pToolpathLayer - ToolpathLayer instance.
+* @param[in] nSegmentIndex - Index. Must be between 0 and Count - 1.
+* @param[in] nValueHandle - Value handle, as returned by ResolveProfileValueHandle.
+* @param[in] pDefaultValue - Default value if value does not exist.
+* @param[in] nValueBufferSize - size of the buffer (including trailing 0)
+* @param[out] pValueNeededChars - will be filled with the count of the written bytes, or needed buffer size.
+* @param[out] pValueBuffer -  buffer of String Value., may be NULL
+* @return error code or 0 (success)
+*/
+LIBMCENV_DECLSPEC LibMCEnvResult libmcenv_toolpathlayer_getsegmentprofilevaluebyhandledef(LibMCEnv_ToolpathLayer pToolpathLayer, LibMCEnv_uint32 nSegmentIndex, LibMCEnv_uint32 nValueHandle, const char * pDefaultValue, const LibMCEnv_uint32 nValueBufferSize, LibMCEnv_uint32* pValueNeededChars, char * pValueBuffer);
+
+/**
+* Retrieves an assigned profile custom double value. Fails if value does not exist or is not a double value.
+*
+* @param[in] pToolpathLayer - ToolpathLayer instance.
+* @param[in] nSegmentIndex - Index. Must be between 0 and Count - 1.
+* @param[in] nValueHandle - Value handle, as returned by ResolveProfileValueHandle.
+* @param[out] pValue - Double Value.
+* @return error code or 0 (success)
+*/
+LIBMCENV_DECLSPEC LibMCEnvResult libmcenv_toolpathlayer_getsegmentprofiledoublevaluebyhandle(LibMCEnv_ToolpathLayer pToolpathLayer, LibMCEnv_uint32 nSegmentIndex, LibMCEnv_uint32 nValueHandle, LibMCEnv_double * pValue);
+
+/**
+* Retrieves an assigned profile custom double value. Fails if value exists but is not a double value.
+*
+* @param[in] pToolpathLayer - ToolpathLayer instance.
+* @param[in] nSegmentIndex - Index. Must be between 0 and Count - 1.
+* @param[in] nValueHandle - Value handle, as returned by ResolveProfileValueHandle.
+* @param[in] dDefaultValue - Default value if value does not exist.
+* @param[out] pValue - Double Value.
+* @return error code or 0 (success)
+*/
+LIBMCENV_DECLSPEC LibMCEnvResult libmcenv_toolpathlayer_getsegmentprofiledoublevaluebyhandledef(LibMCEnv_ToolpathLayer pToolpathLayer, LibMCEnv_uint32 nSegmentIndex, LibMCEnv_uint32 nValueHandle, LibMCEnv_double dDefaultValue, LibMCEnv_double * pValue);
+
+/**
+* Retrieves an assigned profile custom integer value. Fails if value does not exist or is not a integer value.
+*
+* @param[in] pToolpathLayer - ToolpathLayer instance.
+* @param[in] nSegmentIndex - Index. Must be between 0 and Count - 1.
+* @param[in] nValueHandle - Value handle, as returned by ResolveProfileValueHandle.
+* @param[out] pValue - Integer Value.
+* @return error code or 0 (success)
+*/
+LIBMCENV_DECLSPEC LibMCEnvResult libmcenv_toolpathlayer_getsegmentprofileintegervaluebyhandle(LibMCEnv_ToolpathLayer pToolpathLayer, LibMCEnv_uint32 nSegmentIndex, LibMCEnv_uint32 nValueHandle, LibMCEnv_int64 * pValue);
+
+/**
+* Retrieves an assigned profile custom integer value. Fails if value exists but is not a integer value.
+*
+* @param[in] pToolpathLayer - ToolpathLayer instance.
+* @param[in] nSegmentIndex - Index. Must be between 0 and Count - 1.
+* @param[in] nValueHandle - Value handle, as returned by ResolveProfileValueHandle.
+* @param[in] nDefaultValue - Default value if value does not exist.
+* @param[out] pValue - Integer Value.
+* @return error code or 0 (success)
+*/
+LIBMCENV_DECLSPEC LibMCEnvResult libmcenv_toolpathlayer_getsegmentprofileintegervaluebyhandledef(LibMCEnv_ToolpathLayer pToolpathLayer, LibMCEnv_uint32 nSegmentIndex, LibMCEnv_uint32 nValueHandle, LibMCEnv_int64 nDefaultValue, LibMCEnv_int64 * pValue);
+
+/**
+* Retrieves an assigned profile custom boolean value. A Boolean value is either an integer value, or strings of the form true or false (case insensitive). Fails if value does not exist or is not a bool value.
+*
+* @param[in] pToolpathLayer - ToolpathLayer instance.
+* @param[in] nSegmentIndex - Index. Must be between 0 and Count - 1.
+* @param[in] nValueHandle - Value handle, as returned by ResolveProfileValueHandle.
+* @param[out] pValue - Boolean Value.
+* @return error code or 0 (success)
+*/
+LIBMCENV_DECLSPEC LibMCEnvResult libmcenv_toolpathlayer_getsegmentprofileboolvaluebyhandle(LibMCEnv_ToolpathLayer pToolpathLayer, LibMCEnv_uint32 nSegmentIndex, LibMCEnv_uint32 nValueHandle, bool * pValue);
+
+/**
+* Retrieves an assigned profile custom boolean value. A Boolean value is either an integer value, or strings of the form true or false (case insensitive). Fails if value exists but is not a bool value.
+*
+* @param[in] pToolpathLayer - ToolpathLayer instance.
+* @param[in] nSegmentIndex - Index. Must be between 0 and Count - 1.
+* @param[in] nValueHandle - Value handle, as returned by ResolveProfileValueHandle.
+* @param[in] bDefaultValue - Default value if value does not exist.
+* @param[out] pValue - Boolean Value.
+* @return error code or 0 (success)
+*/
+LIBMCENV_DECLSPEC LibMCEnvResult libmcenv_toolpathlayer_getsegmentprofileboolvaluebyhandledef(LibMCEnv_ToolpathLayer pToolpathLayer, LibMCEnv_uint32 nSegmentIndex, LibMCEnv_uint32 nValueHandle, bool bDefaultValue, bool * pValue);
+
 /**
 * Retrieves the assigned segment part uuid.
 *
@@ -8131,6 +8259,75 @@ LIBMCENV_DECLSPEC LibMCEnvResult libmcenv_journalvariable_computedoublesample(Li
 */
 LIBMCENV_DECLSPEC LibMCEnvResult libmcenv_journalvariable_computeintegersample(LibMCEnv_JournalVariable pJournalVariable, LibMCEnv_uint64 nTimeInMicroSeconds, LibMCEnv_int64 * pSampleValue);
 
+/**
+* Computes the minimum value of the variable in a time interval.
+*
+* @param[in] pJournalVariable - JournalVariable instance.
+* @param[in] nStartTimeInMicroSeconds - Start of the interval in microseconds.
+* @param[in] nEndTimeInMicroSeconds - End of the interval in microseconds. MUST be larger than the start.
+* @param[out] pValue - Minimum value in the interval.
+* @return error code or 0 (success)
+*/
+LIBMCENV_DECLSPEC LibMCEnvResult libmcenv_journalvariable_computeminimum(LibMCEnv_JournalVariable pJournalVariable, LibMCEnv_uint64 nStartTimeInMicroSeconds, LibMCEnv_uint64 nEndTimeInMicroSeconds, LibMCEnv_double * pValue);
+
+/**
+* Computes the maximum value of the variable in a time interval.
+*
+* @param[in] pJournalVariable - JournalVariable instance.
+* @param[in] nStartTimeInMicroSeconds - Start of the interval in microseconds.
+* @param[in] nEndTimeInMicroSeconds - End of the interval in microseconds. MUST be larger than the start.
+* @param[out] pValue - Maximum value in the interval.
+* @return error code or 0 (success)
+*/
+LIBMCENV_DECLSPEC LibMCEnvResult libmcenv_journalvariable_computemaximum(LibMCEnv_JournalVariable pJournalVariable, LibMCEnv_uint64 nStartTimeInMicroSeconds, LibMCEnv_uint64 nEndTimeInMicroSeconds, LibMCEnv_double * pValue);
+
+/**
+* Computes the time weighted average of the variable in a time interval.
+*
+* @param[in] pJournalVariable - JournalVariable instance.
+* @param[in] nStartTimeInMicroSeconds - Start of the interval in microseconds.
+* @param[in] nEndTimeInMicroSeconds - End of the interval in microseconds. MUST be larger than the start.
+* @param[out] pValue - Average value in the interval.
+* @return error code or 0 (success)
+*/
+LIBMCENV_DECLSPEC LibMCEnvResult libmcenv_journalvariable_computeaverage(LibMCEnv_JournalVariable pJournalVariable, LibMCEnv_uint64 nStartTimeInMicroSeconds, LibMCEnv_uint64 nEndTimeInMicroSeconds, LibMCEnv_double * pValue);
+
+/**
+* Computes the time integral of the variable in a time interval.
+*
+* @param[in] pJournalVariable - JournalVariable instance.
+* @param[in] nStartTimeInMicroSeconds - Start of the interval in microseconds.
+* @param[in] nEndTimeInMicroSeconds - End of the interval in microseconds. MUST be larger than the start.
+* @param[out] pValue - Integral of the variable in value times seconds.
+* @return error code or 0 (success)
+*/
+LIBMCENV_DECLSPEC LibMCEnvResult libmcenv_journalvariable_computeintegral(LibMCEnv_JournalVariable pJournalVariable, LibMCEnv_uint64 nStartTimeInMicroSeconds, LibMCEnv_uint64 nEndTimeInMicroSeconds, LibMCEnv_double * pValue);
+
+/**
+* Samples the variable at equidistant time stamps, including both interval ends.
+*
+* @param[in] pJournalVariable - JournalVariable instance.
+* @param[in] nStartTimeInMicroSeconds - Start of the interval in microseconds.
+* @param[in] nEndTimeInMicroSeconds - End of the interval in microseconds. MUST be larger than the start.
+* @param[in] nNumberOfSamples - Number of samples. MUST be at least 2.
+* @param[out] pSampling - Sampling instance.
+* @return error code or 0 (success)
+*/
+LIBMCENV_DECLSPEC LibMCEnvResult libmcenv_journalvariable_computeuniformsampling(LibMCEnv_JournalVariable pJournalVariable, LibMCEnv_uint64 nStartTimeInMicroSeconds, LibMCEnv_uint64 nEndTimeInMicroSeconds, LibMCEnv_uint32 nNumberOfSamples, LibMCEnv_UniformJournalSampling * pSampling);
+
+/**
+* Returns the value at the interval start and all recorded value changes within the interval.
+*
+* @param[in] pJournalVariable - JournalVariable instance.
+* @param[in] nStartTimeInMicroSeconds - Start of the interval in microseconds.
+* @param[in] nEndTimeInMicroSeconds - End of the interval in microseconds. MUST be larger than the start.
+* @param[in] nTimeStreamEntriesBufferSize - Number of elements in buffer
+* @param[out] pTimeStreamEntriesNeededCount - will be filled with the count of the written elements, or needed buffer size.
+* @param[out] pTimeStreamEntriesBuffer - TimeStreamEntry  buffer of Array of Timestream entries, in increasing order.
+* @return error code or 0 (success)
+*/
+LIBMCENV_DECLSPEC LibMCEnvResult libmcenv_journalvariable_receiverawtimestream(LibMCEnv_JournalVariable pJournalVariable, LibMCEnv_uint64 nStartTimeInMicroSeconds, LibMCEnv_uint64 nEndTimeInMicroSeconds, const LibMCEnv_uint64 nTimeStreamEntriesBufferSize, LibMCEnv_uint64* pTimeStreamEntriesNeededCount, LibMCEnv::sTimeStreamEntry * pTimeStreamEntriesBuffer);
+
 /*************************************************************************************************************************
  Class definition for Alert
 **************************************************************************************************************************/
@@ -9962,6 +10159,51 @@ LIBMCENV_DECLSPEC LibMCEnvResult libmcenv_stateenvironment_finddataseries(LibMCE
 */
 LIBMCENV_DECLSPEC LibMCEnvResult libmcenv_stateenvironment_releasedataseries(LibMCEnv_StateEnvironment pStateEnvironment, const char * pDataSeriesUUID);
 
+/**
+* Registers a push stream of JSON events, that clients can subscribe to as Server-Sent Events. Returns the existing stream, if the identifier has been registered before.
+*
+* @param[in] pStateEnvironment - StateEnvironment instance.
+* @param[in] pIdentifier - Identifier of the stream.
+* @param[in] nStreamUUIDBufferSize - size of the buffer (including trailing 0)
+* @param[out] pStreamUUIDNeededChars - will be filled with the count of the written bytes, or needed buffer size.
+* @param[out] pStreamUUIDBuffer -  buffer of UUID of the stream., may be NULL
+* @return error code or 0 (success)
+*/
+LIBMCENV_DECLSPEC LibMCEnvResult libmcenv_stateenvironment_registerjsoneventstream(LibMCEnv_StateEnvironment pStateEnvironment, const char * pIdentifier, const LibMCEnv_uint32 nStreamUUIDBufferSize, LibMCEnv_uint32* pStreamUUIDNeededChars, char * pStreamUUIDBuffer);
+
+/**
+* Registers a push stream of JPEG images, that clients can subscribe to as MJPEG stream. Returns the existing stream, if the identifier has been registered before.
+*
+* @param[in] pStateEnvironment - StateEnvironment instance.
+* @param[in] pIdentifier - Identifier of the stream.
+* @param[in] nStreamUUIDBufferSize - size of the buffer (including trailing 0)
+* @param[out] pStreamUUIDNeededChars - will be filled with the count of the written bytes, or needed buffer size.
+* @param[out] pStreamUUIDBuffer -  buffer of UUID of the stream., may be NULL
+* @return error code or 0 (success)
+*/
+LIBMCENV_DECLSPEC LibMCEnvResult libmcenv_stateenvironment_registerjpegimagestream(LibMCEnv_StateEnvironment pStateEnvironment, const char * pIdentifier, const LibMCEnv_uint32 nStreamUUIDBufferSize, LibMCEnv_uint32* pStreamUUIDNeededChars, char * pStreamUUIDBuffer);
+
+/**
+* Publishes a JSON event to all connections of a JSON event stream.
+*
+* @param[in] pStateEnvironment - StateEnvironment instance.
+* @param[in] pStreamUUID - UUID of the stream.
+* @param[in] pEventJSON - JSON payload of the event.
+* @return error code or 0 (success)
+*/
+LIBMCENV_DECLSPEC LibMCEnvResult libmcenv_stateenvironment_publishstreamevent(LibMCEnv_StateEnvironment pStateEnvironment, const char * pStreamUUID, const char * pEventJSON);
+
+/**
+* Publishes a JPEG frame to all connections of a JPEG image stream.
+*
+* @param[in] pStateEnvironment - StateEnvironment instance.
+* @param[in] pStreamUUID - UUID of the stream.
+* @param[in] nJPEGDataBufferSize - Number of elements in buffer
+* @param[in] pJPEGDataBuffer - uint8 buffer of JPEG encoded frame.
+* @return error code or 0 (success)
+*/
+LIBMCENV_DECLSPEC LibMCEnvResult libmcenv_stateenvironment_publishstreamimage(LibMCEnv_StateEnvironment pStateEnvironment, const char * pStreamUUID, LibMCEnv_uint64 nJPEGDataBufferSize, const LibMCEnv_uint8 * pJPEGDataBuffer);
+
 /**
 * creates a new alert
 *
@@ -2880,6 +2880,97 @@ public:
 	*/
 	virtual LibMCEnv::eToolpathProfileModificationType GetSegmentProfileTypedModificationType(const LibMCEnv_uint32 nSegmentIndex, const LibMCEnv::eToolpathProfileValueType eValueType) = 0;
 
+	/**
+	* IToolpathLayer::ResolveProfileValueHandle - Resolves a profile value name into a handle that is valid for all segments of this layer. Handles allow fast repeated access to profile values without string lookups.
+	* @param[in] sNamespace - Namespace to query for.
+	* @param[in] sValueName - Value Name to query for.
+	* @return Value handle. Returns 0 if no profile of the layer has the value.
+	*/
+	virtual LibMCEnv_uint32 ResolveProfileValueHandle(const std::string & sNamespace, const std::string & sValueName) = 0;
+
+	/**
+	* IToolpathLayer::ResolveTypedProfileValueHandle - Resolves a profile value of a standard type into a handle that is valid for all segments of this layer.
+	* @param[in] eValueType - Enum to query for. MUST NOT be custom.
+	* @return Value handle. Returns 0 if no profile of the layer has the value.
+	*/
+	virtual LibMCEnv_uint32 ResolveTypedProfileValueHandle(const LibMCEnv::eToolpathProfileValueType eValueType) = 0;
+
+	/**
+	* IToolpathLayer::SegmentProfileHasValueByHandle - Returns if the segment profile has a value.
+	* @param[in] nSegmentIndex - Index. Must be between 0 and Count - 1.
+	* @param[in] nValueHandle - Value handle, as returned by ResolveProfileValueHandle.
+	* @return Returns true if value exist.
+	*/
+	virtual bool SegmentProfileHasValueByHandle(const LibMCEnv_uint32 nSegmentIndex, const LibMCEnv_uint32 nValueHandle) = 0;
+
+	/**
+	* IToolpathLayer::GetSegmentProfileValueByHandle - Retrieves an assigned profile custom value. Fails if value does not exist.
+	* @param[in] nSegmentIndex - Index. Must be between 0 and Count - 1.
+	* @param[in] nValueHandle - Value handle, as returned by ResolveProfileValueHandle.
+	* @return String Value.
+	*/
+	virtual std::string GetSegmentProfileValueByHandle(const LibMCEnv_uint32 nSegmentIndex, const LibMCEnv_uint32 nValueHandle) = 0;
+
+	/**
+	* IToolpathLayer::GetSegmentProfileValueByHandleDef - Retrieves an assigned profile custom value.
+	* @param[in] nSegmentIndex - Index. Must be between 0 and Count - 1.
+	* @param[in] nValueHandle - Value handle, as returned by ResolveProfileValueHandle.
+	* @param[in] sDefaultValue - Default value if value does not exist.
+	* @return String Value.
+	*/
+	virtual std::string GetSegmentProfileValueByHandleDef(const LibMCEnv_uint32 nSegmentIndex, const LibMCEnv_uint32 nValueHandle, const std::string & sDefaultValue) = 0;
+
+	/**
+	* IToolpathLayer::GetSegmentProfileDoubleValueByHandle - Retrieves an assigned profile custom double value. Fails if value does not exist or is not a double value.
+	* @param[in] nSegmentIndex - Index. Must be between 0 and Count - 1.
+	* @param[in] nValueHandle - Value handle, as returned by ResolveProfileValueHandle.
+	* @return Double Value.
+	*/
+	virtual LibMCEnv_double GetSegmentProfileDoubleValueByHandle(const LibMCEnv_uint32 nSegmentIndex, const LibMCEnv_uint32 nValueHandle) = 0;
+
+	/**
+	* IToolpathLayer::GetSegmentProfileDoubleValueByHandleDef - Retrieves an assigned profile custom double value. Fails if value exists but is not a double value.
+	* @param[in] nSegmentIndex - Index. Must be between 0 and Count - 1.
+	* @param[in] nValueHandle - Value handle, as returned by ResolveProfileValueHandle.
+	* @param[in] dDefaultValue - Default value if value does not exist.
+	* @return Double Value.
+	*/
+	virtual LibMCEnv_double GetSegmentProfileDoubleValueByHandleDef(const LibMCEnv_uint32 nSegmentIndex, const LibMCEnv_uint32 nValueHandle, const LibMCEnv_double dDefaultValue) = 0;
+
+	/**
+	* IToolpathLayer::GetSegmentProfileIntegerValueByHandle - Retrieves an assigned profile custom integer value. Fails if value does not exist or is not a integer value.
+	* @param[in] nSegmentIndex - Index. Must be between 0 and Count - 1.
+	* @param[in] nValueHandle - Value handle, as returned by ResolveProfileValueHandle.
+	* @return Integer Value.
+	*/
+	virtual LibMCEnv_int64 GetSegmentProfileIntegerValueByHandle(const LibMCEnv_uint32 nSegmentIndex, const LibMCEnv_uint32 nValueHandle) = 0;
+
+	/**
+	* IToolpathLayer::GetSegmentProfileIntegerValueByHandleDef - Retrieves an assigned profile custom integer value. Fails if value exists but is not a integer value.
+	* @param[in] nSegmentIndex - Index. Must be between 0 and Count - 1.
+	* @param[in] nValueHandle - Value handle, as returned by ResolveProfileValueHandle.
+	* @param[in] nDefaultValue - Default value if value does not exist.
+	* @return Integer Value.
+	*/
+	virtual LibMCEnv_int64 GetSegmentProfileIntegerValueByHandleDef(const LibMCEnv_uint32 nSegmentIndex, const LibMCEnv_uint32 nValueHandle, const LibMCEnv_int64 nDefaultValue) = 0;
+
+	/**
+	* IToolpathLayer::GetSegmentProfileBoolValueByHandle - Retrieves an assigned profile custom boolean value. A Boolean value is either an integer value, or strings of the form true or false (case insensitive). Fails if value does not exist or is not a bool value.
+	* @param[in] nSegmentIndex - Index. Must be between 0 and Count - 1.
+	* @param[in] nValueHandle - Value handle, as returned by ResolveProfileValueHandle.
+	* @return Boolean Value.
+	*/
+	virtual bool GetSegmentProfileBoolValueByHandle(const LibMCEnv_uint32 nSegmentIndex, const LibMCEnv_uint32 nValueHandle) = 0;
+
+	/**
+	* IToolpathLayer::GetSegmentProfileBoolValueByHandleDef - Retrieves an assigned profile custom boolean value. A Boolean value is either an integer value, or strings of the form true or false (case insensitive). Fails if value exists but is not a bool value.
+	* @param[in] nSegmentIndex - Index. Must be between 0 and Count - 1.
+	* @param[in] nValueHandle - Value handle, as returned by ResolveProfileValueHandle.
+	* @param[in] bDefaultValue - Default value if value does not exist.
+	* @return Boolean Value.
+	*/
+	virtual bool GetSegmentProfileBoolValueByHandleDef(const LibMCEnv_uint32 nSegmentIndex, const LibMCEnv_uint32 nValueHandle, const bool bDefaultValue) = 0;
+
 	/**
 	* IToolpathLayer::GetSegmentPartUUID - Retrieves the assigned segment part uuid.
 	* @param[in] nSegmentIndex - Index. Must be between 0 and Count - 1.
@@ -6364,6 +6455,57 @@ public:
 	*/
 	virtual LibMCEnv_int64 ComputeIntegerSample(const LibMCEnv_uint64 nTimeInMicroSeconds) = 0;
 
+	/**
+	* IJournalVariable::ComputeMinimum - Computes the minimum value of the variable in a time interval.
+	* @param[in] nStartTimeInMicroSeconds - Start of the interval in microseconds.
+	* @param[in] nEndTimeInMicroSeconds - End of the interval in microseconds. MUST be larger than the start.
+	* @return Minimum value in the interval.
+	*/
+	virtual LibMCEnv_double ComputeMinimum(const LibMCEnv_uint64 nStartTimeInMicroSeconds, const LibMCEnv_uint64 nEndTimeInMicroSeconds) = 0;
+
+	/**
+	* IJournalVariable::ComputeMaximum - Computes the maximum value of the variable in a time interval.
+	* @param[in] nStartTimeInMicroSeconds - Start of the interval in microseconds.
+	* @param[in] nEndTimeInMicroSeconds - End of the interval in microseconds. MUST be larger than the start.
+	* @return Maximum value in the interval.
+	*/
+	virtual LibMCEnv_double ComputeMaximum(const LibMCEnv_uint64 nStartTimeInMicroSeconds, const LibMCEnv_uint64 nEndTimeInMicroSeconds) = 0;
+
+	/**
+	* IJournalVariable::ComputeAverage - Computes the time weighted average of the variable in a time interval.
+	* @param[in] nStartTimeInMicroSeconds - Start of the interval in microseconds.
+	* @param[in] nEndTimeInMicroSeconds - End of the interval in microseconds. MUST be larger than the start.
+	* @return Average value in the interval.
+	*/
+	virtual LibMCEnv_double ComputeAverage(const LibMCEnv_uint64 nStartTimeInMicroSeconds, const LibMCEnv_uint64 nEndTimeInMicroSeconds) = 0;
+
+	/**
+	* IJournalVariable::ComputeIntegral - Computes the time integral of the variable in a time interval.
+	* @param[in] nStartTimeInMicroSeconds - Start of the interval in microseconds.
+	* @param[in] nEndTimeInMicroSeconds - End of the interval in microseconds. MUST be larger than the start.
+	* @return Integral of the variable in value times seconds.
+	*/
+	virtual LibMCEnv_double ComputeIntegral(const LibMCEnv_uint64 nStartTimeInMicroSeconds, const LibMCEnv_uint64 nEndTimeInMicroSeconds) = 0;
+
+	/**
+	* IJournalVariable::ComputeUniformSampling - Samples the variable at equidistant time stamps, including both interval ends.
+	* @param[in] nStartTimeInMicroSeconds - Start of the interval in microseconds.
+	* @param[in] nEndTimeInMicroSeconds - End of the interval in microseconds. MUST be larger than the start.
+	* @param[in] nNumberOfSamples - Number of samples. MUST be at least 2.
+	* @return Sampling instance.
+	*/
+	virtual IUniformJournalSampling * ComputeUniformSampling(const LibMCEnv_uint64 nStartTimeInMicroSeconds, const LibMCEnv_uint64 nEndTimeInMicroSeconds, const LibMCEnv_uint32 nNumberOfSamples) = 0;
+
+	/**
+	* IJournalVariable::ReceiveRawTimeStream - Returns the value at the interval start and all recorded value changes within the interval.
+	* @param[in] nStartTimeInMicroSeconds - Start of the interval in microseconds.
+	* @param[in] nEndTimeInMicroSeconds - End of the interval in microseconds. MUST be larger than the start.
+	* @param[in] nTimeStreamEntriesBufferSize - Number of elements in buffer
+	* @param[out] pTimeStreamEntriesNeededCount - will be filled with the count of the written structs, or needed buffer size.
+	* @param[out] pTimeStreamEntriesBuffer - TimeStreamEntry buffer of Array of Timestream entries, in increasing order.
+	*/
+	virtual void ReceiveRawTimeStream(const LibMCEnv_uint64 nStartTimeInMicroSeconds, const LibMCEnv_uint64 nEndTimeInMicroSeconds, LibMCEnv_uint64 nTimeStreamEntriesBufferSize, LibMCEnv_uint64* pTimeStreamEntriesNeededCount, LibMCEnv::sTimeStreamEntry * pTimeStreamEntriesBuffer) = 0;
+
 };
 
 typedef IBaseSharedPtr<IJournalVariable> PIJournalVariable;
@@ -7682,6 +7824,35 @@ public:
 	*/
 	virtual void ReleaseDataSeries(const std::string & sDataSeriesUUID) = 0;
 
+	/**
+	* IStateEnvironment::RegisterJSONEventStream - Registers a push stream of JSON events, that clients can subscribe to as Server-Sent Events. Returns the existing stream, if the identifier has been registered before.
+	* @param[in] sIdentifier - Identifier of the stream.
+	* @return UUID of the stream.
+	*/
+	virtual std::string RegisterJSONEventStream(const std::string & sIdentifier) = 0;
+
+	/**
+	* IStateEnvironment::RegisterJPEGImageStream - Registers a push stream of JPEG images, that clients can subscribe to as MJPEG stream. Returns the existing stream, if the identifier has been registered before.
+	* @param[in] sIdentifier - Identifier of the stream.
+	* @return UUID of the stream.
+	*/
+	virtual std::string RegisterJPEGImageStream(const std::string & sIdentifier) = 0;
+
+	/**
+	* IStateEnvironment::PublishStreamEvent - Publishes a JSON event to all connections of a JSON event stream.
+	* @param[in] sStreamUUID - UUID of the stream.
+	* @param[in] sEventJSON - JSON payload of the event.
+	*/
+	virtual void PublishStreamEvent(const std::string & sStreamUUID, const std::string & sEventJSON) = 0;
+
+	/**
+	* IStateEnvironment::PublishStreamImage - Publishes a JPEG frame to all connections of a JPEG image stream.
+	* @param[in] sStreamUUID - UUID of the stream.
+	* @param[in] nJPEGDataBufferSize - Number of elements in buffer
+	* @param[in] pJPEGDataBuffer - JPEG encoded frame.
+	*/
+	virtual void PublishStreamImage(const std::string & sStreamUUID, const LibMCEnv_uint64 nJPEGDataBufferSize, const LibMCEnv_uint8 * pJPEGDataBuffer) = 0;
+
 	/**
 	* IStateEnvironment::CreateAlert - creates a new alert
 	* @param[in] sIdentifier - Alert type identifier. Call fails if identifier is not registered.
@@ -349,6 +349,7 @@ typedef void * LibMCEnv_pvoid;
 #define LIBMCENV_ERROR_MACHINECONFIGURATIONSCHEMATYPEALREADYREGISTERED 10252 /** Schema type already registered, but with a different name. */
 #define LIBMCENV_ERROR_NOCONFIGURATIONVERSIONFOUND 10253 /** No configuration version found. */
 #define LIBMCENV_ERROR_NOCONFIGURATIONVERSIONACTIVE 10254 /** No configuration version active. */
+#define LIBMCENV_ERROR_INVALIDJOURNALSAMPLEINDEX 10255 /** Invalid journal sample index. */
 
 /*************************************************************************************************************************
  Error strings for LibMCEnv
@@ -610,6 +611,7 @@ inline const char * LIBMCENV_GETERRORSTRING (LibMCEnvResult nErrorCode) {
     case LIBMCENV_ERROR_MACHINECONFIGURATIONSCHEMATYPEALREADYREGISTERED: return "Schema type already registered, but with a different name.";
     case LIBMCENV_ERROR_NOCONFIGURATIONVERSIONFOUND: return "No configuration version found.";
     case LIBMCENV_ERROR_NOCONFIGURATIONVERSIONACTIVE: return "No configuration version active.";
+    case LIBMCENV_ERROR_INVALIDJOURNALSAMPLEINDEX: return "Invalid journal sample index.";
     default: return "unknown error";
   }
 }
@@ -228,6 +228,10 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define AMC_API_KEY_UI_ITEMHEADERS "headers"
 #define AMC_API_KEY_UI_ITEMENTRIES "entries"
 #define AMC_API_KEY_UI_ITEMENTRIESPERPAGE "entriesperpage"
+#define AMC_API_KEY_UI_ITEMENTRYCOUNT "entrycount"
+#define AMC_API_KEY_UI_ITEMENTRYINDEX "entryindex"
+#define AMC_API_KEY_UI_ITEMSTATEID "stateid"
+#define AMC_API_KEY_UI_ITEMISDELTA "isdelta"
 #define AMC_API_KEY_UI_BUTTONUUID "uuid"
 #define AMC_API_KEY_UI_BUTTONTARGETPAGE "targetpage"
 #define AMC_API_KEY_UI_BUTTONCAPTION "caption"
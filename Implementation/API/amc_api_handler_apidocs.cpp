@@ -105,20 +105,19 @@ void CAPIHandler_APIDocs::LoadAPIDocsPackage(PResourcePackage pResourcePackage)
 		std::string sNameOriginal = pEntry->getName();
 		std::string sNameLowerCase = AMCCommon::CUtils::toLowerString(sNameOriginal);
 
-		auto apiResponse = std::make_shared<CAPIFixedBufferResponse>(pEntry->getContentType());
-
 		if (sNameLowerCase == "amcf_openapi.json") {
 
+			auto apiResponse = std::make_shared<CAPIFixedBufferResponse>(pEntry->getContentType());
 			std::string sOpenAPIContent = pResourcePackage->readEntryUTF8String(sNameOriginal);
 			patchAPIJSON (sOpenAPIContent, apiResponse->getBuffer());
+			m_FilesToServe.insert(std::make_pair(sNameLowerCase, apiResponse));
 		
 		}
 		else {
-			pResourcePackage->readEntry(sNameOriginal, apiResponse->getBuffer());
+			auto apiResponse = std::make_shared<CAPIResourceResponse>(pEntry->getContentType(), pResourcePackage->readCachedEntry(sNameOriginal));
+			m_FilesToServe.insert(std::make_pair(sNameLowerCase, apiResponse));
 		}
 
-		m_FilesToServe.insert(std::make_pair(sNameLowerCase, apiResponse));
-
 	}
 
 
@@ -436,10 +436,7 @@ PAPIResponse CAPIHandler_Build::handleGetBuildDataRequest(PAPIAuth pAuth, const
 
 	auto pStorageStream = pBuildJobData->GetStorageStream();
 
-	auto pResponse = std::make_shared<CAPIFixedBufferResponse>(pBuildJobData->GetMIMEType());
-	pStorageStream->GetContent (pResponse->getBuffer());
-
-	return pResponse;
+	return std::make_shared<CAPIStorageStreamResponse>(pBuildJobData->GetMIMEType(), pStorageStream);
 	
 
 }
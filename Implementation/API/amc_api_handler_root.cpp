@@ -90,8 +90,7 @@ void CAPIHandler_Root::LoadClientPackage(PResourcePackage pResourcePackage)
 	for (size_t nIndex = 0; nIndex < nCount; nIndex++) {
 		auto pEntry = pResourcePackage->getEntry(nIndex);
 
-		auto apiResponse = std::make_shared<CAPIFixedBufferResponse>(pEntry->getContentType());
-		pResourcePackage->readEntry(pEntry->getName (), apiResponse->getBuffer());
+		auto apiResponse = std::make_shared<CAPIResourceResponse>(pEntry->getContentType(), pResourcePackage->readCachedEntry(pEntry->getName ()));
 		m_FilesToServe.insert(std::make_pair(AMCCommon::CUtils::toLowerString (pEntry->getName ()), apiResponse));
 	}
 
@@ -54,6 +54,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "common_chrono.hpp"
 
 #include <cmath>
+#include <cstring>
 #include <vector>
 #include <memory>
 #include <string>
@@ -163,6 +164,91 @@ public:
 
 
 
+// Binary point channel format, little endian, all sections aligned to 8 bytes:
+//   Header:  char[4] "AMPC", uint32 version, uint32 column count, uint32 value size (4 = float32, 8 = float64)
+//   Column:  uint32 name length, uint32 reserved, uint64 value count, name (zero padded), values (zero padded)
+#define AMC_API_POINTCHANNEL_BINARY_SIGNATURE "AMPC"
+#define AMC_API_POINTCHANNEL_BINARY_VERSION 1
+#define AMC_API_POINTCHANNEL_BINARY_CONTENTTYPE "application/x-amc-pointchannel"
+
+class CAPIPointChannelBinaryResponse : public CAPIFixedBufferResponse {
+private:
+
+	static size_t alignTo8(size_t nSize)
+	{
+		return (nSize + 7) & ~((size_t)7);
+	}
+
+	static void writeUInt32(uint8_t* pTarget, uint32_t nValue)
+	{
+		for (uint32_t nIndex = 0; nIndex < 4; nIndex++)
+			pTarget[nIndex] = (uint8_t)((nValue >> (nIndex * 8)) & 0xff);
+	}
+
+	static void writeUInt64(uint8_t* pTarget, uint64_t nValue)
+	{
+		for (uint32_t nIndex = 0; nIndex < 8; nIndex++)
+			pTarget[nIndex] = (uint8_t)((nValue >> (nIndex * 8)) & 0xff);
+	}
+
+public:
+
+	CAPIPointChannelBinaryResponse(AMC::ColumnEntries* pColumnEntries, bool bDoublePrecision)
+		: CAPIFixedBufferResponse(AMC_API_POINTCHANNEL_BINARY_CONTENTTYPE)
+	{
+		size_t nValueSize = bDoublePrecision ? sizeof(double) : sizeof(float);
+
+		// Calculate the full size first, so that the values can be written in place.
+		size_t nTotalSize = 16;
+		uint32_t nColumnCount = 0;
+		if (pColumnEntries != nullptr) {
+			for (auto& columnIter : *pColumnEntries) {
+				nTotalSize += 16 + alignTo8(columnIter.first.length()) + alignTo8(columnIter.second.size() * nValueSize);
+				nColumnCount++;
+			}
+		}
+
+		auto& buffer = getBuffer();
+		buffer.resize(nTotalSize, 0);
+		uint8_t* pTarget = buffer.data();
+
+		memcpy(pTarget, AMC_API_POINTCHANNEL_BINARY_SIGNATURE, 4);
+		writeUInt32(pTarget + 4, AMC_API_POINTCHANNEL_BINARY_VERSION);
+		writeUInt32(pTarget + 8, nColumnCount);
+		writeUInt32(pTarget + 12, (uint32_t)nValueSize);
+		pTarget += 16;
+
+		if (pColumnEntries != nullptr) {
+			for (auto& columnIter : *pColumnEntries) {
+				auto& sColumnName = columnIter.first;
+				auto& values = columnIter.second;
+
+				writeUInt32(pTarget, (uint32_t)sColumnName.length());
+				writeUInt64(pTarget + 8, values.size());
+				pTarget += 16;
+
+				memcpy(pTarget, sColumnName.c_str(), sColumnName.length());
+				pTarget += alignTo8(sColumnName.length());
+
+				if (bDoublePrecision) {
+					if (!values.empty())
+						memcpy(pTarget, values.data(), values.size() * sizeof(double));
+				}
+				else {
+					float* pFloatTarget = (float*)pTarget;
+					for (auto dValue : values)
+						*pFloatTarget++ = (float)dValue;
+				}
+
+				pTarget += alignTo8(values.size() * nValueSize);
+			}
+		}
+
+	}
+
+};
+
+
 CAPIHandler_UI::CAPIHandler_UI(PSystemState pSystemState)
 	: CAPIHandler(pSystemState->getClientHash()), m_pSystemState(pSystemState)
 {
@@ -263,6 +349,14 @@ APIHandler_UIType CAPIHandler_UI::parseRequest(const std::string& sURI, const eA
 			}
 		}
 
+		if (sParameterString.length() > 57) {
+			if ((sParameterString.substr(0, 20) == "/pointchannelbinary/") && (sParameterString.at(56) == '/')) {
+				sParameterUUID = AMCCommon::CUtils::normalizeUUIDString(sParameterString.substr(20, 36));
+				sAdditionalParameter = sParameterString.substr(57);
+				return APIHandler_UIType::utPointChannelBinary;
+			}
+		}
+
 		if (sParameterString.length() >= 43) {
 			if (sParameterString.substr(0, 8) == "/module/") {
 				sParameterUUID = AMCCommon::CUtils::normalizeUUIDString(sParameterString.substr(8, 36));
@@ -368,10 +462,7 @@ PAPIResponse CAPIHandler_UI::handleImageRequest(const std::string& sParameterUUI
 	auto pResourceEntry = pCoreResourcePackage->findEntryByUUID(sParameterUUID, false);
 
 	if (pResourceEntry != nullptr) {
-		auto apiResponse = std::make_shared<CAPIFixedBufferResponse>(pResourceEntry->getContentType ());
-		pCoreResourcePackage->readEntry(pResourceEntry->getName(), apiResponse->getBuffer());
-
-		return apiResponse;
+		return std::make_shared<CAPIResourceResponse>(pResourceEntry->getContentType (), pCoreResourcePackage->readCachedEntry(pResourceEntry->getName()));
 	}
 
 	// Then look in storage for uuid
@@ -382,10 +473,7 @@ PAPIResponse CAPIHandler_UI::handleImageRequest(const std::string& sParameterUUI
 		auto pStream = pStorage->RetrieveStream(sParameterUUID);
 		auto sContentType = pStream->GetMIMEType();
 
-		auto apiResponse = std::make_shared<CAPIFixedBufferResponse>(sContentType);
-		pStream->GetContent(apiResponse->getBuffer());
-
-		return apiResponse;		
+		return std::make_shared<CAPIStorageStreamResponse>(sContentType, pStream);
 	}
 
 
@@ -416,9 +504,8 @@ PAPIResponse CAPIHandler_UI::handleDownloadRequest(const std::string& sParameter
 	auto pStream = pStorage->RetrieveStream(sStreamUUID);
 	auto sContentType = pStream->GetMIMEType();
 
-	auto apiResponse = std::make_shared<CAPIFixedBufferResponse>(sContentType);
+	auto apiResponse = std::make_shared<CAPIStorageStreamResponse>(sContentType, pStream);
 	apiResponse->setContentDispositionName(sDownloadFileName);
-	pStream->GetContent(apiResponse->getBuffer());
 
 	return apiResponse;
 
@@ -589,6 +676,33 @@ void CAPIHandler_UI::handlePointChannelDataRequest(CJSONWriter& writer, const st
 	}
 }
 
+PAPIResponse CAPIHandler_UI::handlePointChannelBinaryRequest(const std::string& sParameterUUID, const std::string& sAdditionalParameter, PAPIAuth pAuth)
+{
+	// Additional parameter is either "<channel>" or "<channel>/float64"
+	std::string sChannelName = sAdditionalParameter;
+	bool bDoublePrecision = false;
+
+	auto nDelimiterPos = sAdditionalParameter.find('/');
+	if (nDelimiterPos != std::string::npos) {
+		sChannelName = sAdditionalParameter.substr(0, nDelimiterPos);
+		std::string sPrecision = sAdditionalParameter.substr(nDelimiterPos + 1);
+		if (sPrecision == "float64")
+			bDoublePrecision = true;
+		else if (sPrecision != "float32")
+			throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDPARAM, "Invalid point channel precision: " + sPrecision);
+	}
+
+	auto pToolpathHandler = m_pSystemState->getToolpathHandlerInstance();
+	auto pScatterplot = pToolpathHandler->restoreScatterplot(sParameterUUID, false);
+
+	auto& channelEntries = pScatterplot->getChannelEntries();
+	auto channelIt = channelEntries.find(sChannelName);
+	if (channelIt == channelEntries.end())
+		return std::make_shared<CAPIPointChannelBinaryResponse>(nullptr, bDoublePrecision);
+
+	return std::make_shared<CAPIPointChannelBinaryResponse>(&channelIt->second, bDoublePrecision);
+}
+
 PAPIResponse CAPIHandler_UI::handleRequest(const std::string& sURI, const eAPIRequestType requestType, CAPIFormFields & pFormFields, const uint8_t* pBodyData, const size_t nBodyDataSize, PAPIAuth pAuth)
 {
 	std::string sParameterUUID;
@@ -659,6 +773,9 @@ PAPIResponse CAPIHandler_UI::handleRequest(const std::string& sURI, const eAPIRe
 		break;
 	}
 
+	case APIHandler_UIType::utPointChannelBinary:
+		return handlePointChannelBinaryRequest(sParameterUUID, sAdditionalParameter, pAuth);
+
 	case APIHandler_UIType::utModule: {
 
 		int64_t nStateID = 0;
@@ -236,8 +236,9 @@ void CAPIHandler_Upload::handleFinishUploadRequest(CJSONWriter& writer, const ui
 		
 		pBuildJob->StartValidating();
 
+		// Validation does not read any layers, so no layer cache is needed
 		std::set<std::string> attachmentRelationsToRead;
-		CToolpathEntity toolpathEntity(pDataModel, pStreamObject->GetUUID(), pToolpathHandler->getLib3MFWrapper(), pBuildJob->GetName(), true, attachmentRelationsToRead);
+		CToolpathEntity toolpathEntity(pDataModel, pStreamObject->GetUUID(), pToolpathHandler->getLib3MFWrapper(), pBuildJob->GetName(), true, attachmentRelationsToRead, 0, 0);
 
 		pBuildJob->FinishValidating(toolpathEntity.getLayerCount());
 
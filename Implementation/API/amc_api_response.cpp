@@ -33,6 +33,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "amc_api_response.hpp"
 #include "amc_api_constants.hpp"
 #include "libmc_interfaceexception.hpp"
+#include "libmcdata_dynamic.hpp"
 
 using namespace AMC;
 
@@ -43,6 +44,11 @@ CAPIResponse::CAPIResponse(uint32_t nHTTPCode, const std::string& sContentType)
 
 }
 
+CAPIResponse::~CAPIResponse()
+{
+
+}
+
 size_t CAPIResponse::getStreamSize() const
 {
 	return m_StreamData.size();
@@ -56,6 +62,17 @@ const uint8_t* CAPIResponse::getStreamData() const
 	return nullptr;
 }
 
+const uint8_t* CAPIResponse::getEncodedStreamData(const std::string& sContentEncoding, size_t& nEncodedSize) const
+{
+	nEncodedSize = 0;
+	return nullptr;
+}
+
+bool CAPIResponse::acceptsRanges() const
+{
+	return false;
+}
+
 std::string CAPIResponse::getContentType() const
 {
 	return m_sContentType;
@@ -76,6 +93,16 @@ void CAPIResponse::setContentDispositionName(const std::string& sContentDisposit
 	m_sContentDispositionName = sContentDispositionName;
 }
 
+std::string CAPIResponse::getETag() const
+{
+	return m_sETag;
+}
+
+void CAPIResponse::setETag(const std::string& sETag)
+{
+	m_sETag = sETag;
+}
+
 
 
 CAPIStringResponse::CAPIStringResponse(uint32_t nHTTPCode, const std::string& sContentType, const std::string& sStringValue)
@@ -145,3 +172,78 @@ void CAPIFixedFloatBufferResponse::addFloat(float fValue)
 
 
 }
+
+
+CAPIResourceResponse::CAPIResourceResponse(const std::string& sContentType, PResourcePackageCacheEntry pCacheEntry)
+	: CAPIResponse(AMC_API_HTTP_SUCCESS, sContentType), m_pCacheEntry (pCacheEntry)
+{
+	if (pCacheEntry.get() == nullptr)
+		throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDPARAM);
+
+	m_sETag = pCacheEntry->getETag();
+}
+
+size_t CAPIResourceResponse::getStreamSize() const
+{
+	return m_pCacheEntry->getData().size();
+}
+
+const uint8_t* CAPIResourceResponse::getStreamData() const
+{
+	auto& Data = m_pCacheEntry->getData();
+	if (Data.size() > 0)
+		return Data.data();
+
+	return nullptr;
+}
+
+const uint8_t* CAPIResourceResponse::getEncodedStreamData(const std::string& sContentEncoding, size_t& nEncodedSize) const
+{
+	const std::vector<uint8_t>* pEncodedData = nullptr;
+	if (sContentEncoding == "gzip")
+		pEncodedData = m_pCacheEntry->getGZIPData();
+	else if (sContentEncoding == "deflate")
+		pEncodedData = m_pCacheEntry->getDeflateData();
+
+	if (pEncodedData == nullptr) {
+		nEncodedSize = 0;
+		return nullptr;
+	}
+
+	nEncodedSize = pEncodedData->size();
+	return pEncodedData->data();
+}
+
+
+CAPIStorageStreamResponse::CAPIStorageStreamResponse(const std::string& sContentType, LibMCData::PStorageStream pStorageStream)
+	: CAPIResponse(AMC_API_HTTP_SUCCESS, sContentType), m_pStorageStream (pStorageStream), m_pMappedData (nullptr), m_nMappedSize (0)
+{
+	if (pStorageStream.get() == nullptr)
+		throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDPARAM);
+
+	// The mapping lives as long as the storage stream instance
+	LibMCData_pvoid pData = nullptr;
+	LibMCData_uint64 nSize = 0;
+	pStorageStream->MapContent(pData, nSize);
+
+	if ((nSize > 0) && (pData == nullptr))
+		throw ELibMCInterfaceException(LIBMC_ERROR_INTERNALERROR);
+
+	m_pMappedData = (const uint8_t*)pData;
+	m_nMappedSize = (size_t)nSize;
+}
+
+size_t CAPIStorageStreamResponse::getStreamSize() const
+{
+	return m_nMappedSize;
+}
+
+const uint8_t* CAPIStorageStreamResponse::getStreamData() const
+{
+	return m_pMappedData;
+}
+
+bool CAPIStorageStreamResponse::acceptsRanges() const
+{
+	return true;
+}
@@ -35,9 +35,15 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "header_protection.hpp"
 
 #include "amc_api_types.hpp"
+#include "amc_resourcepackage.hpp"
 
 #include <vector>
 
+namespace LibMCData {
+	class CStorageStream;
+	typedef std::shared_ptr<CStorageStream> PStorageStream;
+}
+
 namespace AMC {
 
 	class CAPIResponse {
@@ -51,14 +57,25 @@ namespace AMC {
 
 		// If not empty, return a content disposition
 		std::string m_sContentDispositionName;
+
+		// If not empty, the response may be revalidated by the client
+		std::string m_sETag;
 			
 	public:
 
 		CAPIResponse (uint32_t nHTTPCode, const std::string & sContentType);
+
+		virtual ~CAPIResponse ();
 		
-		size_t getStreamSize () const;
+		virtual size_t getStreamSize () const;
 		
-		const uint8_t * getStreamData () const;
+		virtual const uint8_t * getStreamData () const;
+
+		// Returns nullptr, if no precompressed variant for this content encoding exists.
+		virtual const uint8_t * getEncodedStreamData (const std::string & sContentEncoding, size_t & nEncodedSize) const;
+
+		// Returns true, if the stream data may be delivered in byte ranges.
+		virtual bool acceptsRanges () const;
 		
 		std::string getContentType () const;
 
@@ -68,6 +85,10 @@ namespace AMC {
 
 		void setContentDispositionName(const std::string & sContentDispositionName);
 
+		std::string getETag () const;
+
+		void setETag (const std::string & sETag);
+
 
 	};
 
@@ -112,6 +133,39 @@ namespace AMC {
 	};
 
 
+	class CAPIResourceResponse : public CAPIResponse {
+	private:
+
+		PResourcePackageCacheEntry m_pCacheEntry;
+
+	public:
+
+		CAPIResourceResponse(const std::string& sContentType, PResourcePackageCacheEntry pCacheEntry);
+
+		size_t getStreamSize () const override;
+
+		const uint8_t * getStreamData () const override;
+
+		const uint8_t * getEncodedStreamData (const std::string & sContentEncoding, size_t & nEncodedSize) const override;
+
+	};
+
+
+	// Serves a storage stream directly from its memory mapping, without copying it into a buffer.
+	class CAPIStorageStreamResponse : public CAPIResponse {
+	private:
+		LibMCData::PStorageStream m_pStorageStream;
+		const uint8_t * m_pMappedData;
+		size_t m_nMappedSize;
+
+	public:
+		CAPIStorageStreamResponse(const std::string& sContentType, LibMCData::PStorageStream pStorageStream);
+
+		size_t getStreamSize () const override;
+		const uint8_t * getStreamData () const override;
+		bool acceptsRanges () const override;
+	};
+
 	typedef std::shared_ptr<CAPIResponse> PAPIResponse;
 
 	
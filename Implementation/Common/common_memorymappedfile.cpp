@@ -0,0 +1,153 @@
+/*++
+
+Copyright (C) 2025 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "common_memorymappedfile.hpp"
+#include "common_utils.hpp"
+
+#include <stdexcept>
+#include <cstring>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace AMCCommon {
+
+	CMemoryMappedFile::CMemoryMappedFile(const std::string& sUTF8FileName)
+		: m_sFileName(sUTF8FileName), m_pData(nullptr), m_nSize(0)
+#ifdef _WIN32
+		, m_hFile(INVALID_HANDLE_VALUE), m_hMapping(nullptr)
+#endif
+	{
+#ifdef _WIN32
+		std::wstring sUTF16FileName = CUtils::UTF8toUTF16(sUTF8FileName);
+		HANDLE hFile = CreateFileW(sUTF16FileName.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (hFile == INVALID_HANDLE_VALUE)
+			throw std::runtime_error("could not open file: " + sUTF8FileName);
+		m_hFile = hFile;
+
+		LARGE_INTEGER nFileSize;
+		if (!GetFileSizeEx(hFile, &nFileSize)) {
+			CloseHandle(hFile);
+			throw std::runtime_error("could not retrieve file size: " + sUTF8FileName);
+		}
+		m_nSize = (uint64_t)nFileSize.QuadPart;
+
+		// Empty files can not be mapped
+		if (m_nSize > 0) {
+			HANDLE hMapping = CreateFileMappingW(hFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+			if (hMapping == nullptr) {
+				CloseHandle(hFile);
+				throw std::runtime_error("could not create file mapping: " + sUTF8FileName);
+			}
+			m_hMapping = hMapping;
+
+			m_pData = (const uint8_t*)MapViewOfFile(hMapping, FILE_MAP_READ, 0, 0, 0);
+			if (m_pData == nullptr) {
+				CloseHandle(hMapping);
+				CloseHandle(hFile);
+				throw std::runtime_error("could not map file: " + sUTF8FileName);
+			}
+		}
+#else
+		int nFileDescriptor = open(sUTF8FileName.c_str(), O_RDONLY);
+		if (nFileDescriptor < 0)
+			throw std::runtime_error("could not open file: " + sUTF8FileName);
+
+		struct stat fileStat;
+		if (fstat(nFileDescriptor, &fileStat) != 0) {
+			close(nFileDescriptor);
+			throw std::runtime_error("could not retrieve file size: " + sUTF8FileName);
+		}
+		m_nSize = (uint64_t)fileStat.st_size;
+
+		// Empty files can not be mapped
+		if (m_nSize > 0) {
+			void* pMapping = mmap(nullptr, (size_t)m_nSize, PROT_READ, MAP_PRIVATE, nFileDescriptor, 0);
+			if (pMapping == MAP_FAILED) {
+				close(nFileDescriptor);
+				throw std::runtime_error("could not map file: " + sUTF8FileName);
+			}
+
+			m_pData = (const uint8_t*)pMapping;
+		}
+
+		// The mapping stays valid after closing the descriptor
+		close(nFileDescriptor);
+#endif
+	}
+
+	CMemoryMappedFile::~CMemoryMappedFile()
+	{
+#ifdef _WIN32
+		if (m_pData != nullptr)
+			UnmapViewOfFile(m_pData);
+		if (m_hMapping != nullptr)
+			CloseHandle((HANDLE)m_hMapping);
+		if (m_hFile != INVALID_HANDLE_VALUE)
+			CloseHandle((HANDLE)m_hFile);
+#else
+		if (m_pData != nullptr)
+			munmap((void*)m_pData, (size_t)m_nSize);
+#endif
+		m_pData = nullptr;
+		m_nSize = 0;
+	}
+
+	const uint8_t* CMemoryMappedFile::getData() const
+	{
+		return m_pData;
+	}
+
+	uint64_t CMemoryMappedFile::getSize() const
+	{
+		return m_nSize;
+	}
+
+	void CMemoryMappedFile::readRange(uint64_t nOffset, uint64_t nLength, uint8_t* pBuffer) const
+	{
+		if ((nOffset > m_nSize) || (nLength > (m_nSize - nOffset)))
+			throw std::runtime_error("read range exceeds file size: " + m_sFileName);
+
+		if (nLength > 0) {
+			if (pBuffer == nullptr)
+				throw std::runtime_error("invalid buffer parameter");
+
+			memcpy(pBuffer, m_pData + nOffset, (size_t)nLength);
+		}
+	}
+
+}
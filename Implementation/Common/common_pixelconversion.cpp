@@ -0,0 +1,859 @@
+/*++
+
+Copyright (C) 2025 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "common_pixelconversion.hpp"
+
+#include <cstring>
+#include <algorithm>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define PIXELCONVERSION_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace AMCCommon {
+
+	/*************************************************************************************************************************
+	 Scalar kernels. These define the results; the vectorized kernels must match them bit by bit.
+	**************************************************************************************************************************/
+
+	static inline uint8_t greyFromRGB(uint32_t nRed, uint32_t nGreen, uint32_t nBlue)
+	{
+		return (uint8_t)((nRed + nGreen + nBlue) / 3);
+	}
+
+	static inline uint16_t rgb16FromRGB(uint32_t nRed, uint32_t nGreen, uint32_t nBlue)
+	{
+		return (uint16_t)(((nBlue & 0xF8) << 8) | ((nGreen & 0xFC) << 3) | (nRed >> 3));
+	}
+
+	static inline void rgbFromRGB16(const uint8_t* pSource, uint32_t& nRed, uint32_t& nGreen, uint32_t& nBlue)
+	{
+		uint32_t nColor = (uint32_t)pSource[0] | ((uint32_t)pSource[1] << 8);
+		nRed = (nColor & 0x1f) << 3;
+		nGreen = ((nColor >> 5) & 0x3f) << 2;
+		nBlue = ((nColor >> 11) & 0x1f) << 3;
+	}
+
+	static inline void writeRGB16(uint8_t* pTarget, uint16_t nColor)
+	{
+		pTarget[0] = (uint8_t)(nColor & 0xff);
+		pTarget[1] = (uint8_t)(nColor >> 8);
+	}
+
+	static inline void rgbFromYUV(int nY, int nU, int nV, int& nRed, int& nGreen, int& nBlue)
+	{
+		int C = nY - 16;
+		int D = nU - 128;
+		int E = nV - 128;
+
+		nRed = std::min(255, std::max(0, (298 * C + 409 * E + 128) >> 8));
+		nGreen = std::min(255, std::max(0, (298 * C - 100 * D - 208 * E + 128) >> 8));
+		nBlue = std::min(255, std::max(0, (298 * C + 516 * D + 128) >> 8));
+	}
+
+	static void convertRGB16ToGreyScale8_Scalar(const uint8_t* pSource, uint8_t* pTarget, size_t nPixelCount)
+	{
+		for (size_t nIndex = 0; nIndex < nPixelCount; nIndex++) {
+			uint32_t nRed, nGreen, nBlue;
+			rgbFromRGB16(pSource, nRed, nGreen, nBlue);
+			pTarget[nIndex] = greyFromRGB(nRed, nGreen, nBlue);
+			pSource += 2;
+		}
+	}
+
+	static void convertRGB24ToGreyScale8_Scalar(const uint8_t* pSource, uint8_t* pTarget, size_t nPixelCount)
+	{
+		for (size_t nIndex = 0; nIndex < nPixelCount; nIndex++) {
+			pTarget[nIndex] = greyFromRGB(pSource[0], pSource[1], pSource[2]);
+			pSource += 3;
+		}
+	}
+
+	static void convertRGBA32ToGreyScale8_Scalar(const uint8_t* pSource, uint8_t* pTarget, size_t nPixelCount)
+	{
+		for (size_t nIndex = 0; nIndex < nPixelCount; nIndex++) {
+			pTarget[nIndex] = greyFromRGB(pSource[0], pSource[1], pSource[2]);
+			pSource += 4;
+		}
+	}
+
+	static void convertGreyScale8ToRGB16_Scalar(const uint8_t* pSource, uint8_t* pTarget, size_t nPixelCount)
+	{
+		for (size_t nIndex = 0; nIndex < nPixelCount; nIndex++) {
+			uint32_t nGrey = pSource[nIndex];
+			writeRGB16(pTarget, rgb16FromRGB(nGrey, nGrey, nGrey));
+			pTarget += 2;
+		}
+	}
+
+	static void convertRGB24ToRGB16_Scalar(const uint8_t* pSource, uint8_t* pTarget, size_t nPixelCount)
+	{
+		for (size_t nIndex = 0; nIndex < nPixelCount; nIndex++) {
+			writeRGB16(pTarget, rgb16FromRGB(pSource[0], pSource[1], pSource[2]));
+			pSource += 3;
+			pTarget += 2;
+		}
+	}
+
+	static void convertRGBA32ToRGB16_Scalar(const uint8_t* pSource, uint8_t* pTarget, size_t nPixelCount)
+	{
+		for (size_t nIndex = 0; nIndex < nPixelCount; nIndex++) {
+			writeRGB16(pTarget, rgb16FromRGB(pSource[0], pSource[1], pSource[2]));
+			pSource += 4;
+			pTarget += 2;
+		}
+	}
+
+	static void convertGreyScale8ToRGB24_Scalar(const uint8_t* pSource, uint8_t* pTarget, size_t nPixelCount)
+	{
+		for (size_t nIndex = 0; nIndex < nPixelCount; nIndex++) {
+			uint8_t nGrey = pSource[nIndex];
+			pTarget[0] = nGrey;
+			pTarget[1] = nGrey;
+			pTarget[2] = nGrey;
+			pTarget += 3;
+		}
+	}
+
+	static void convertRGB16ToRGB24_Scalar(const uint8_t* pSource, uint8_t* pTarget, size_t nPixelCount)
+	{
+		for (size_t nIndex = 0; nIndex < nPixelCount; nIndex++) {
+			uint32_t nRed, nGreen, nBlue;
+			rgbFromRGB16(pSource, nRed, nGreen, nBlue);
+			pTarget[0] = (uint8_t)nRed;
+			pTarget[1] = (uint8_t)nGreen;
+			pTarget[2] = (uint8_t)nBlue;
+			pSource += 2;
+			pTarget += 3;
+		}
+	}
+
+	static void convertRGBA32ToRGB24_Scalar(const uint8_t* pSource, uint8_t* pTarget, size_t nPixelCount)
+	{
+		for (size_t nIndex = 0; nIndex < nPixelCount; nIndex++) {
+			pTarget[0] = pSource[0];
+			pTarget[1] = pSource[1];
+			pTarget[2] = pSource[2];
+			pSource += 4;
+			pTarget += 3;
+		}
+	}
+
+	static void convertGreyScale8ToRGBA32_Scalar(const uint8_t* pSource, uint8_t* pTarget, size_t nPixelCount)
+	{
+		for (size_t nIndex = 0; nIndex < nPixelCount; nIndex++) {
+			uint8_t nGrey = pSource[nIndex];
+			pTarget[0] = nGrey;
+			pTarget[1] = nGrey;
+			pTarget[2] = nGrey;
+			pTarget[3] = 255;
+			pTarget += 4;
+		}
+	}
+
+	static void convertRGB16ToRGBA32_Scalar(const uint8_t* pSource, uint8_t* pTarget, size_t nPixelCount)
+	{
+		for (size_t nIndex = 0; nIndex < nPixelCount; nIndex++) {
+			uint32_t nRed, nGreen, nBlue;
+			rgbFromRGB16(pSource, nRed, nGreen, nBlue);
+			pTarget[0] = (uint8_t)nRed;
+			pTarget[1] = (uint8_t)nGreen;
+			pTarget[2] = (uint8_t)nBlue;
+			pTarget[3] = 255;
+			pSource += 2;
+			pTarget += 4;
+		}
+	}
+
+	static void convertRGB24ToRGBA32_Scalar(const uint8_t* pSource, uint8_t* pTarget, size_t nPixelCount)
+	{
+		for (size_t nIndex = 0; nIndex < nPixelCount; nIndex++) {
+			pTarget[0] = pSource[0];
+			pTarget[1] = pSource[1];
+			pTarget[2] = pSource[2];
+			pTarget[3] = 255;
+			pSource += 3;
+			pTarget += 4;
+		}
+	}
+
+	static void packGreyScale8ToBlackWhite1bit_Scalar(const uint8_t* pSource, uint8_t* pTarget, size_t nTargetBitOffset, size_t nPixelCount)
+	{
+		size_t nBitPosition = nTargetBitOffset;
+		for (size_t nIndex = 0; nIndex < nPixelCount; nIndex++) {
+			size_t nBitMod = nBitPosition % 8;
+
+			uint8_t nBlackWhiteMask = 0;
+			if (pSource[nIndex] >= 128)
+				nBlackWhiteMask = (uint8_t)(1 << (7 - nBitMod));
+
+			if (nBitMod == 0)
+				*pTarget = nBlackWhiteMask;
+			else
+				*pTarget |= nBlackWhiteMask;
+
+			if (nBitMod == 7)
+				pTarget++;
+
+			nBitPosition++;
+		}
+	}
+
+	static void packGreyScale8ToGreyScale2bit_Scalar(const uint8_t* pSource, uint8_t* pTarget, size_t nPixelCount)
+	{
+		for (size_t nIndex = 0; nIndex < nPixelCount; nIndex++) {
+			uint8_t nGrey2bit = pSource[nIndex] / 64;
+
+			size_t nIndexMod = nIndex % 4;
+			if (nIndexMod == 0)
+				*pTarget = nGrey2bit;
+			else
+				*pTarget |= (uint8_t)(nGrey2bit << (nIndexMod * 2));
+
+			if (nIndexMod == 3)
+				pTarget++;
+		}
+	}
+
+	static void packGreyScale8ToGreyScale4bit_Scalar(const uint8_t* pSource, uint8_t* pTarget, size_t nPixelCount)
+	{
+		for (size_t nIndex = 0; nIndex < nPixelCount; nIndex++) {
+			uint8_t nGrey4bit = pSource[nIndex] / 16;
+
+			if (nIndex % 2 == 0) {
+				*pTarget = nGrey4bit;
+			}
+			else {
+				*pTarget |= (uint8_t)(nGrey4bit << 4);
+				pTarget++;
+			}
+		}
+	}
+
+	static void convertYUY2ToGreyScale8_Scalar(const uint8_t* pSource, uint8_t* pTarget, size_t nPixelCount)
+	{
+		for (size_t nIndex = 0; nIndex + 1 < nPixelCount; nIndex += 2) {
+			for (int nPixel = 0; nPixel < 2; nPixel++) {
+				int nRed, nGreen, nBlue;
+				rgbFromYUV(pSource[nPixel * 2], pSource[1], pSource[3], nRed, nGreen, nBlue);
+				*pTarget = greyFromRGB(nRed, nGreen, nBlue);
+				pTarget++;
+			}
+			pSource += 4;
+		}
+	}
+
+	static void convertYUY2ToRGB16_Scalar(const uint8_t* pSource, uint8_t* pTarget, size_t nPixelCount)
+	{
+		for (size_t nIndex = 0; nIndex + 1 < nPixelCount; nIndex += 2) {
+			for (int nPixel = 0; nPixel < 2; nPixel++) {
+				int nRed, nGreen, nBlue;
+				rgbFromYUV(pSource[nPixel * 2], pSource[1], pSource[3], nRed, nGreen, nBlue);
+				writeRGB16(pTarget, rgb16FromRGB(nRed, nGreen, nBlue));
+				pTarget += 2;
+			}
+			pSource += 4;
+		}
+	}
+
+	static void convertYUY2ToRGB24_Scalar(const uint8_t* pSource, uint8_t* pTarget, size_t nPixelCount)
+	{
+		for (size_t nIndex = 0; nIndex + 1 < nPixelCount; nIndex += 2) {
+			for (int nPixel = 0; nPixel < 2; nPixel++) {
+				int nRed, nGreen, nBlue;
+				rgbFromYUV(pSource[nPixel * 2], pSource[1], pSource[3], nRed, nGreen, nBlue);
+				pTarget[0] = (uint8_t)nRed;
+				pTarget[1] = (uint8_t)nGreen;
+				pTarget[2] = (uint8_t)nBlue;
+				pTarget += 3;
+			}
+			pSource += 4;
+		}
+	}
+
+	static void convertYUY2ToRGBA32_Scalar(const uint8_t* pSource, uint8_t* pTarget, size_t nPixelCount)
+	{
+		for (size_t nIndex = 0; nIndex + 1 < nPixelCount; nIndex += 2) {
+			for (int nPixel = 0; nPixel < 2; nPixel++) {
+				int nRed, nGreen, nBlue;
+				rgbFromYUV(pSource[nPixel * 2], pSource[1], pSource[3], nRed, nGreen, nBlue);
+				pTarget[0] = (uint8_t)nRed;
+				pTarget[1] = (uint8_t)nGreen;
+				pTarget[2] = (uint8_t)nBlue;
+				pTarget[3] = 255;
+				pTarget += 4;
+			}
+			pSource += 4;
+		}
+	}
+
+
+#ifdef PIXELCONVERSION_SSE2
+
+	/*************************************************************************************************************************
+	 SSE2 kernels. Each kernel converts whole blocks and returns the number of converted pixels; the caller
+	 finishes the remainder of the row with the scalar kernel.
+	**************************************************************************************************************************/
+
+	// Exact floor (x / 3) for 16 bit lanes up to 765 (x * 43691 >> 17)
+	static inline __m128i divideBy3_SSE2(__m128i value)
+	{
+		return _mm_srli_epi16(_mm_mulhi_epu16(value, _mm_set1_epi16((short)0xAAAB)), 1);
+	}
+
+	// Returns R + G + B for four RGBA32 pixels in 32 bit lanes
+	static inline __m128i sumRGBA32_SSE2(__m128i pixels)
+	{
+		const __m128i byteMask = _mm_set1_epi32(0xFF);
+		__m128i red = _mm_and_si128(pixels, byteMask);
+		__m128i green = _mm_and_si128(_mm_srli_epi32(pixels, 8), byteMask);
+		__m128i blue = _mm_and_si128(_mm_srli_epi32(pixels, 16), byteMask);
+		return _mm_add_epi32(_mm_add_epi32(red, green), blue);
+	}
+
+	// Expands eight RGB16 pixels into 16 bit lanes of 8 bit channel values
+	static inline void unpackRGB16_SSE2(__m128i pixels, __m128i& red, __m128i& green, __m128i& blue)
+	{
+		red = _mm_slli_epi16(_mm_and_si128(pixels, _mm_set1_epi16(0x1f)), 3);
+		green = _mm_slli_epi16(_mm_and_si128(_mm_srli_epi16(pixels, 5), _mm_set1_epi16(0x3f)), 2);
+		blue = _mm_slli_epi16(_mm_srli_epi16(pixels, 11), 3);
+	}
+
+	// Packs 16 bit lanes of 8 bit channel values into RGB16 pixels
+	static inline __m128i packRGB16_SSE2(__m128i red, __m128i green, __m128i blue)
+	{
+		__m128i blueBits = _mm_slli_epi16(_mm_and_si128(blue, _mm_set1_epi16(0xF8)), 8);
+		__m128i greenBits = _mm_slli_epi16(_mm_and_si128(green, _mm_set1_epi16(0xFC)), 3);
+		__m128i redBits = _mm_srli_epi16(red, 3);
+		return _mm_or_si128(_mm_or_si128(blueBits, greenBits), redBits);
+	}
+
+	// Interleaves 16 bit lanes of 8 bit channel values into eight RGBA32 pixels
+	static inline void storeRGBA32_SSE2(uint8_t* pTarget, __m128i red, __m128i green, __m128i blue)
+	{
+		__m128i redGreen = _mm_or_si128(red, _mm_slli_epi16(green, 8));
+		__m128i blueAlpha = _mm_or_si128(blue, _mm_set1_epi16((short)0xFF00));
+		_mm_storeu_si128((__m128i*)pTarget, _mm_unpacklo_epi16(redGreen, blueAlpha));
+		_mm_storeu_si128((__m128i*)(pTarget + 16), _mm_unpackhi_epi16(redGreen, blueAlpha));
+	}
+
+	// Converts eight YUY2 pixels into clamped 16 bit lanes of 8 bit channel values
+	static inline void convertYUY2Block_SSE2(const uint8_t* pSource, __m128i& red, __m128i& green, __m128i& blue)
+	{
+		__m128i words = _mm_loadu_si128((const __m128i*)pSource);
+
+		// Lanes of luma values and of alternating U/V values
+		__m128i luma = _mm_and_si128(words, _mm_set1_epi16(0x00FF));
+		__m128i chroma = _mm_srli_epi16(words, 8);
+
+		// Both pixels of a pair share U and V
+		__m128i chromaU = _mm_or_si128(_mm_and_si128(chroma, _mm_set1_epi32(0x0000FFFF)), _mm_slli_epi32(chroma, 16));
+		__m128i chromaV = _mm_or_si128(_mm_srli_epi32(chroma, 16), _mm_and_si128(chroma, _mm_set1_epi32((int)0xFFFF0000)));
+
+		__m128i C = _mm_sub_epi16(luma, _mm_set1_epi16(16));
+		__m128i D = _mm_sub_epi16(chromaU, _mm_set1_epi16(128));
+		__m128i E = _mm_sub_epi16(chromaV, _mm_set1_epi16(128));
+
+		const __m128i rounding = _mm_set1_epi32(128);
+		const __m128i redFactors = _mm_setr_epi16(298, 409, 298, 409, 298, 409, 298, 409);
+		const __m128i greenFactorsCD = _mm_setr_epi16(298, -100, 298, -100, 298, -100, 298, -100);
+		const __m128i greenFactorsE1 = _mm_setr_epi16(-208, 128, -208, 128, -208, 128, -208, 128);
+		const __m128i blueFactors = _mm_setr_epi16(298, 516, 298, 516, 298, 516, 298, 516);
+		const __m128i ones = _mm_set1_epi16(1);
+
+		__m128i CE_Low = _mm_unpacklo_epi16(C, E);
+		__m128i CE_High = _mm_unpackhi_epi16(C, E);
+		__m128i CD_Low = _mm_unpacklo_epi16(C, D);
+		__m128i CD_High = _mm_unpackhi_epi16(C, D);
+		__m128i E1_Low = _mm_unpacklo_epi16(E, ones);
+		__m128i E1_High = _mm_unpackhi_epi16(E, ones);
+
+		__m128i redLow = _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(CE_Low, redFactors), rounding), 8);
+		__m128i redHigh = _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(CE_High, redFactors), rounding), 8);
+		__m128i greenLow = _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(CD_Low, greenFactorsCD), _mm_madd_epi16(E1_Low, greenFactorsE1)), 8);
+		__m128i greenHigh = _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(CD_High, greenFactorsCD), _mm_madd_epi16(E1_High, greenFactorsE1)), 8);
+		__m128i blueLow = _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(CD_Low, blueFactors), rounding), 8);
+		__m128i blueHigh = _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(CD_High, blueFactors), rounding), 8);
+
+		const __m128i zero = _mm_setzero_si128();
+		const __m128i maxValue = _mm_set1_epi16(255);
+		red = _mm_min_epi16(_mm_max_epi16(_mm_packs_epi32(redLow, redHigh), zero), maxValue);
+		green = _mm_min_epi16(_mm_max_epi16(_mm_packs_epi32(greenLow, greenHigh), zero), maxValue);
+		blue = _mm_min_epi16(_mm_max_epi16(_mm_packs_epi32(blueLow, blueHigh), zero), maxValue);
+	}
+
+	static size_t convertRGB16ToGreyScale8_SSE2(const uint8_t* pSource, uint8_t* pTarget, size_t nPixelCount)
+	{
+		size_t nBlockCount = nPixelCount / 16;
+		for (size_t nBlock = 0; nBlock < nBlockCount; nBlock++) {
+			__m128i grey[2];
+			for (int nHalf = 0; nHalf < 2; nHalf++) {
+				__m128i red, green, blue;
+				unpackRGB16_SSE2(_mm_loadu_si128((const __m128i*)(pSource + nHalf * 16)), red, green, blue);
+				grey[nHalf] = divideBy3_SSE2(_mm_add_epi16(_mm_add_epi16(red, green), blue));
+			}
+
+			_mm_storeu_si128((__m128i*)pTarget, _mm_packus_epi16(grey[0], grey[1]));
+			pSource += 32;
+			pTarget += 16;
+		}
+
+		return nBlockCount * 16;
+	}
+
+	static size_t convertRGBA32ToGreyScale8_SSE2(const uint8_t* pSource, uint8_t* pTarget, size_t nPixelCount)
+	{
+		size_t nBlockCount = nPixelCount / 16;
+		for (size_t nBlock = 0; nBlock < nBlockCount; nBlock++) {
+			__m128i grey[2];
+			for (int nHalf = 0; nHalf < 2; nHalf++) {
+				__m128i sum0 = sumRGBA32_SSE2(_mm_loadu_si128((const __m128i*)(pSource + nHalf * 32)));
+				__m128i sum1 = sumRGBA32_SSE2(_mm_loadu_si128((const __m128i*)(pSource + nHalf * 32 + 16)));
+				grey[nHalf] = divideBy3_SSE2(_mm_packs_epi32(sum0, sum1));
+			}
+
+			_mm_storeu_si128((__m128i*)pTarget, _mm_packus_epi16(grey[0], grey[1]));
+			pSource += 64;
+			pTarget += 16;
+		}
+
+		return nBlockCount * 16;
+	}
+
+	static size_t convertGreyScale8ToRGB16_SSE2(const uint8_t* pSource, uint8_t* pTarget, size_t nPixelCount)
+	{
+		const __m128i zero = _mm_setzero_si128();
+
+		size_t nBlockCount = nPixelCount / 16;
+		for (size_t nBlock = 0; nBlock < nBlockCount; nBlock++) {
+			__m128i grey = _mm_loadu_si128((const __m128i*)pSource);
+			__m128i greyLow = _mm_unpacklo_epi8(grey, zero);
+			__m128i greyHigh = _mm_unpackhi_epi8(grey, zero);
+
+			_mm_storeu_si128((__m128i*)pTarget, packRGB16_SSE2(greyLow, greyLow, greyLow));
+			_mm_storeu_si128((__m128i*)(pTarget + 16), packRGB16_SSE2(greyHigh, greyHigh, greyHigh));
+			pSource += 16;
+			pTarget += 32;
+		}
+
+		return nBlockCount * 16;
+	}
+
+	static size_t convertRGBA32ToRGB16_SSE2(const uint8_t* pSource, uint8_t* pTarget, size_t nPixelCount)
+	{
+		const __m128i byteMask = _mm_set1_epi32(0xFF);
+
+		size_t nBlockCount = nPixelCount / 8;
+		for (size_t nBlock = 0; nBlock < nBlockCount; nBlock++) {
+			__m128i colors[2];
+			for (int nHalf = 0; nHalf < 2; nHalf++) {
+				__m128i pixels = _mm_loadu_si128((const __m128i*)(pSource + nHalf * 16));
+				__m128i red = _mm_and_si128(pixels, byteMask);
+				__m128i green = _mm_and_si128(_mm_srli_epi32(pixels, 8), byteMask);
+				__m128i blue = _mm_and_si128(_mm_srli_epi32(pixels, 16), byteMask);
+
+				__m128i color = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(_mm_and_si128(blue, _mm_set1_epi32(0xF8)), 8), _mm_slli_epi32(_mm_and_si128(green, _mm_set1_epi32(0xFC)), 3)), _mm_srli_epi32(red, 3));
+
+				// Sign extend so that the saturating pack keeps the bit pattern
+				colors[nHalf] = _mm_srai_epi32(_mm_slli_epi32(color, 16), 16);
+			}
+
+			_mm_storeu_si128((__m128i*)pTarget, _mm_packs_epi32(colors[0], colors[1]));
+			pSource += 32;
+			pTarget += 16;
+		}
+
+		return nBlockCount * 8;
+	}
+
+	static size_t convertGreyScale8ToRGBA32_SSE2(const uint8_t* pSource, uint8_t* pTarget, size_t nPixelCount)
+	{
+		const __m128i alpha = _mm_set1_epi8((char)0xFF);
+
+		size_t nBlockCount = nPixelCount / 16;
+		for (size_t nBlock = 0; nBlock < nBlockCount; nBlock++) {
+			__m128i grey = _mm_loadu_si128((const __m128i*)pSource);
+			__m128i greyGreyLow = _mm_unpacklo_epi8(grey, grey);
+			__m128i greyGreyHigh = _mm_unpackhi_epi8(grey, grey);
+			__m128i greyAlphaLow = _mm_unpacklo_epi8(grey, alpha);
+			__m128i greyAlphaHigh = _mm_unpackhi_epi8(grey, alpha);
+
+			_mm_storeu_si128((__m128i*)pTarget, _mm_unpacklo_epi16(greyGreyLow, greyAlphaLow));
+			_mm_storeu_si128((__m128i*)(pTarget + 16), _mm_unpackhi_epi16(greyGreyLow, greyAlphaLow));
+			_mm_storeu_si128((__m128i*)(pTarget + 32), _mm_unpacklo_epi16(greyGreyHigh, greyAlphaHigh));
+			_mm_storeu_si128((__m128i*)(pTarget + 48), _mm_unpackhi_epi16(greyGreyHigh, greyAlphaHigh));
+			pSource += 16;
+			pTarget += 64;
+		}
+
+		return nBlockCount * 16;
+	}
+
+	static size_t convertRGB16ToRGBA32_SSE2(const uint8_t* pSource, uint8_t* pTarget, size_t nPixelCount)
+	{
+		size_t nBlockCount = nPixelCount / 8;
+		for (size_t nBlock = 0; nBlock < nBlockCount; nBlock++) {
+			__m128i red, green, blue;
+			unpackRGB16_SSE2(_mm_loadu_si128((const __m128i*)pSource), red, green, blue);
+			storeRGBA32_SSE2(pTarget, red, green, blue);
+			pSource += 16;
+			pTarget += 32;
+		}
+
+		return nBlockCount * 8;
+	}
+
+	static size_t packGreyScale8ToBlackWhite1bit_SSE2(const uint8_t* pSource, uint8_t* pTarget, size_t nPixelCount)
+	{
+		size_t nBlockCount = nPixelCount / 16;
+		for (size_t nBlock = 0; nBlock < nBlockCount; nBlock++) {
+			__m128i grey = _mm_loadu_si128((const __m128i*)pSource);
+
+			// Reverse the byte order within each 8 byte half, so that the first pixel ends up in the highest bit of the mask byte
+			__m128i reversed = _mm_or_si128(_mm_slli_epi16(grey, 8), _mm_srli_epi16(grey, 8));
+			reversed = _mm_shufflelo_epi16(reversed, _MM_SHUFFLE(0, 1, 2, 3));
+			reversed = _mm_shufflehi_epi16(reversed, _MM_SHUFFLE(0, 1, 2, 3));
+
+			// The sign bit of each byte is set exactly for grey values of 128 and above
+			int nMask = _mm_movemask_epi8(reversed);
+			pTarget[0] = (uint8_t)(nMask & 0xFF);
+			pTarget[1] = (uint8_t)((nMask >> 8) & 0xFF);
+
+			pSource += 16;
+			pTarget += 2;
+		}
+
+		return nBlockCount * 16;
+	}
+
+	static size_t packGreyScale8ToGreyScale2bit_SSE2(const uint8_t* pSource, uint8_t* pTarget, size_t nPixelCount)
+	{
+		size_t nBlockCount = nPixelCount / 16;
+		for (size_t nBlock = 0; nBlock < nBlockCount; nBlock++) {
+			__m128i grey = _mm_loadu_si128((const __m128i*)pSource);
+			__m128i grey2bit = _mm_and_si128(_mm_srli_epi16(grey, 6), _mm_set1_epi8(0x03));
+
+			// Combine neighbouring values, first in 16 bit and then in 32 bit lanes
+			__m128i pairs = _mm_or_si128(_mm_and_si128(grey2bit, _mm_set1_epi16(0x00FF)), _mm_slli_epi16(_mm_srli_epi16(grey2bit, 8), 2));
+			__m128i quads = _mm_or_si128(_mm_and_si128(pairs, _mm_set1_epi32(0x0000FFFF)), _mm_slli_epi32(_mm_srli_epi32(pairs, 16), 4));
+
+			__m128i packed = _mm_packus_epi16(_mm_packs_epi32(quads, quads), _mm_setzero_si128());
+			int32_t nPacked = _mm_cvtsi128_si32(packed);
+			memcpy(pTarget, &nPacked, 4);
+
+			pSource += 16;
+			pTarget += 4;
+		}
+
+		return nBlockCount * 16;
+	}
+
+	static size_t packGreyScale8ToGreyScale4bit_SSE2(const uint8_t* pSource, uint8_t* pTarget, size_t nPixelCount)
+	{
+		size_t nBlockCount = nPixelCount / 16;
+		for (size_t nBlock = 0; nBlock < nBlockCount; nBlock++) {
+			__m128i grey = _mm_loadu_si128((const __m128i*)pSource);
+			__m128i grey4bit = _mm_and_si128(_mm_srli_epi16(grey, 4), _mm_set1_epi8(0x0F));
+			__m128i pairs = _mm_or_si128(_mm_and_si128(grey4bit, _mm_set1_epi16(0x00FF)), _mm_slli_epi16(_mm_srli_epi16(grey4bit, 8), 4));
+
+			_mm_storel_epi64((__m128i*)pTarget, _mm_packus_epi16(pairs, pairs));
+
+			pSource += 16;
+			pTarget += 8;
+		}
+
+		return nBlockCount * 16;
+	}
+
+	static size_t convertYUY2ToGreyScale8_SSE2(const uint8_t* pSource, uint8_t* pTarget, size_t nPixelCount)
+	{
+		size_t nBlockCount = nPixelCount / 8;
+		for (size_t nBlock = 0; nBlock < nBlockCount; nBlock++) {
+			__m128i red, green, blue;
+			convertYUY2Block_SSE2(pSource, red, green, blue);
+
+			__m128i grey = divideBy3_SSE2(_mm_add_epi16(_mm_add_epi16(red, green), blue));
+			_mm_storel_epi64((__m128i*)pTarget, _mm_packus_epi16(grey, grey));
+
+			pSource += 16;
+			pTarget += 8;
+		}
+
+		return nBlockCount * 8;
+	}
+
+	static size_t convertYUY2ToRGB16_SSE2(const uint8_t* pSource, uint8_t* pTarget, size_t nPixelCount)
+	{
+		size_t nBlockCount = nPixelCount / 8;
+		for (size_t nBlock = 0; nBlock < nBlockCount; nBlock++) {
+			__m128i red, green, blue;
+			convertYUY2Block_SSE2(pSource, red, green, blue);
+			_mm_storeu_si128((__m128i*)pTarget, packRGB16_SSE2(red, green, blue));
+
+			pSource += 16;
+			pTarget += 16;
+		}
+
+		return nBlockCount * 8;
+	}
+
+	static size_t convertYUY2ToRGB24_SSE2(const uint8_t* pSource, uint8_t* pTarget, size_t nPixelCount)
+	{
+		// SSE2 has no byte shuffle, so the RGBA result is compacted through a small buffer
+		uint8_t rgbaBuffer[32];
+
+		size_t nBlockCount = nPixelCount / 8;
+		for (size_t nBlock = 0; nBlock < nBlockCount; nBlock++) {
+			__m128i red, green, blue;
+			convertYUY2Block_SSE2(pSource, red, green, blue);
+			storeRGBA32_SSE2(rgbaBuffer, red, green, blue);
+			convertRGBA32ToRGB24_Scalar(rgbaBuffer, pTarget, 8);
+
+			pSource += 16;
+			pTarget += 24;
+		}
+
+		return nBlockCount * 8;
+	}
+
+	static size_t convertYUY2ToRGBA32_SSE2(const uint8_t* pSource, uint8_t* pTarget, size_t nPixelCount)
+	{
+		size_t nBlockCount = nPixelCount / 8;
+		for (size_t nBlock = 0; nBlock < nBlockCount; nBlock++) {
+			__m128i red, green, blue;
+			convertYUY2Block_SSE2(pSource, red, green, blue);
+			storeRGBA32_SSE2(pTarget, red, green, blue);
+
+			pSource += 16;
+			pTarget += 32;
+		}
+
+		return nBlockCount * 8;
+	}
+
+#endif //PIXELCONVERSION_SSE2
+
+
+	/*************************************************************************************************************************
+	 Public interface
+	**************************************************************************************************************************/
+
+	bool CPixelConversion::hasSIMDSupport()
+	{
+#ifdef PIXELCONVERSION_SSE2
+		return true;
+#else
+		return false;
+#endif
+	}
+
+	void CPixelConversion::convertRGB16ToGreyScale8(const uint8_t* pSource, uint8_t* pTarget, size_t nPixelCount, bool bAllowSIMD)
+	{
+		size_t nConverted = 0;
+#ifdef PIXELCONVERSION_SSE2
+		if (bAllowSIMD)
+			nConverted = convertRGB16ToGreyScale8_SSE2(pSource, pTarget, nPixelCount);
+#endif
+		convertRGB16ToGreyScale8_Scalar(pSource + nConverted * 2, pTarget + nConverted, nPixelCount - nConverted);
+	}
+
+	void CPixelConversion::convertRGB24ToGreyScale8(const uint8_t* pSource, uint8_t* pTarget, size_t nPixelCount, bool bAllowSIMD)
+	{
+		// Three byte pixels need byte shuffles that SSE2 does not offer
+		convertRGB24ToGreyScale8_Scalar(pSource, pTarget, nPixelCount);
+	}
+
+	void CPixelConversion::convertRGBA32ToGreyScale8(const uint8_t* pSource, uint8_t* pTarget, size_t nPixelCount, bool bAllowSIMD)
+	{
+		size_t nConverted = 0;
+#ifdef PIXELCONVERSION_SSE2
+		if (bAllowSIMD)
+			nConverted = convertRGBA32ToGreyScale8_SSE2(pSource, pTarget, nPixelCount);
+#endif
+		convertRGBA32ToGreyScale8_Scalar(pSource + nConverted * 4, pTarget + nConverted, nPixelCount - nConverted);
+	}
+
+	void CPixelConversion::convertGreyScale8ToRGB16(const uint8_t* pSource, uint8_t* pTarget, size_t nPixelCount, bool bAllowSIMD)
+	{
+		size_t nConverted = 0;
+#ifdef PIXELCONVERSION_SSE2
+		if (bAllowSIMD)
+			nConverted = convertGreyScale8ToRGB16_SSE2(pSource, pTarget, nPixelCount);
+#endif
+		convertGreyScale8ToRGB16_Scalar(pSource + nConverted, pTarget + nConverted * 2, nPixelCount - nConverted);
+	}
+
+	void CPixelConversion::convertRGB24ToRGB16(const uint8_t* pSource, uint8_t* pTarget, size_t nPixelCount, bool bAllowSIMD)
+	{
+		convertRGB24ToRGB16_Scalar(pSource, pTarget, nPixelCount);
+	}
+
+	void CPixelConversion::convertRGBA32ToRGB16(const uint8_t* pSource, uint8_t* pTarget, size_t nPixelCount, bool bAllowSIMD)
+	{
+		size_t nConverted = 0;
+#ifdef PIXELCONVERSION_SSE2
+		if (bAllowSIMD)
+			nConverted = convertRGBA32ToRGB16_SSE2(pSource, pTarget, nPixelCount);
+#endif
+		convertRGBA32ToRGB16_Scalar(pSource + nConverted * 4, pTarget + nConverted * 2, nPixelCount - nConverted);
+	}
+
+	void CPixelConversion::convertGreyScale8ToRGB24(const uint8_t* pSource, uint8_t* pTarget, size_t nPixelCount, bool bAllowSIMD)
+	{
+		convertGreyScale8ToRGB24_Scalar(pSource, pTarget, nPixelCount);
+	}
+
+	void CPixelConversion::convertRGB16ToRGB24(const uint8_t* pSource, uint8_t* pTarget, size_t nPixelCount, bool bAllowSIMD)
+	{
+		convertRGB16ToRGB24_Scalar(pSource, pTarget, nPixelCount);
+	}
+
+	void CPixelConversion::convertRGBA32ToRGB24(const uint8_t* pSource, uint8_t* pTarget, size_t nPixelCount, bool bAllowSIMD)
+	{
+		convertRGBA32ToRGB24_Scalar(pSource, pTarget, nPixelCount);
+	}
+
+	void CPixelConversion::convertGreyScale8ToRGBA32(const uint8_t* pSource, uint8_t* pTarget, size_t nPixelCount, bool bAllowSIMD)
+	{
+		size_t nConverted = 0;
+#ifdef PIXELCONVERSION_SSE2
+		if (bAllowSIMD)
+			nConverted = convertGreyScale8ToRGBA32_SSE2(pSource, pTarget, nPixelCount);
+#endif
+		convertGreyScale8ToRGBA32_Scalar(pSource + nConverted, pTarget + nConverted * 4, nPixelCount - nConverted);
+	}
+
+	void CPixelConversion::convertRGB16ToRGBA32(const uint8_t* pSource, uint8_t* pTarget, size_t nPixelCount, bool bAllowSIMD)
+	{
+		size_t nConverted = 0;
+#ifdef PIXELCONVERSION_SSE2
+		if (bAllowSIMD)
+			nConverted = convertRGB16ToRGBA32_SSE2(pSource, pTarget, nPixelCount);
+#endif
+		convertRGB16ToRGBA32_Scalar(pSource + nConverted * 2, pTarget + nConverted * 4, nPixelCount - nConverted);
+	}
+
+	void CPixelConversion::convertRGB24ToRGBA32(const uint8_t* pSource, uint8_t* pTarget, size_t nPixelCount, bool bAllowSIMD)
+	{
+		convertRGB24ToRGBA32_Scalar(pSource, pTarget, nPixelCount);
+	}
+
+	void CPixelConversion::packGreyScale8ToBlackWhite1bit(const uint8_t* pSource, uint8_t* pTarget, size_t nTargetBitOffset, size_t nPixelCount, bool bAllowSIMD)
+	{
+		nTargetBitOffset = nTargetBitOffset % 8;
+
+#ifdef PIXELCONVERSION_SSE2
+		if (bAllowSIMD) {
+			// Fill up the first byte bit by bit, then continue with whole bytes
+			if (nTargetBitOffset != 0) {
+				size_t nLeadingCount = std::min(nPixelCount, 8 - nTargetBitOffset);
+				packGreyScale8ToBlackWhite1bit_Scalar(pSource, pTarget, nTargetBitOffset, nLeadingCount);
+				if (nLeadingCount == nPixelCount)
+					return;
+
+				pSource += nLeadingCount;
+				pTarget++;
+				nPixelCount -= nLeadingCount;
+				nTargetBitOffset = 0;
+			}
+
+			size_t nConverted = packGreyScale8ToBlackWhite1bit_SSE2(pSource, pTarget, nPixelCount);
+			pSource += nConverted;
+			pTarget += nConverted / 8;
+			nPixelCount -= nConverted;
+		}
+#endif
+
+		packGreyScale8ToBlackWhite1bit_Scalar(pSource, pTarget, nTargetBitOffset, nPixelCount);
+	}
+
+	void CPixelConversion::packGreyScale8ToGreyScale2bit(const uint8_t* pSource, uint8_t* pTarget, size_t nPixelCount, bool bAllowSIMD)
+	{
+		size_t nConverted = 0;
+#ifdef PIXELCONVERSION_SSE2
+		if (bAllowSIMD)
+			nConverted = packGreyScale8ToGreyScale2bit_SSE2(pSource, pTarget, nPixelCount);
+#endif
+		packGreyScale8ToGreyScale2bit_Scalar(pSource + nConverted, pTarget + nConverted / 4, nPixelCount - nConverted);
+	}
+
+	void CPixelConversion::packGreyScale8ToGreyScale4bit(const uint8_t* pSource, uint8_t* pTarget, size_t nPixelCount, bool bAllowSIMD)
+	{
+		size_t nConverted = 0;
+#ifdef PIXELCONVERSION_SSE2
+		if (bAllowSIMD)
+			nConverted = packGreyScale8ToGreyScale4bit_SSE2(pSource, pTarget, nPixelCount);
+#endif
+		packGreyScale8ToGreyScale4bit_Scalar(pSource + nConverted, pTarget + nConverted / 2, nPixelCount - nConverted);
+	}
+
+	void CPixelConversion::convertYUY2ToGreyScale8(const uint8_t* pSource, uint8_t* pTarget, size_t nPixelCount, bool bAllowSIMD)
+	{
+		size_t nConverted = 0;
+#ifdef PIXELCONVERSION_SSE2
+		if (bAllowSIMD)
+			nConverted = convertYUY2ToGreyScale8_SSE2(pSource, pTarget, nPixelCount);
+#endif
+		convertYUY2ToGreyScale8_Scalar(pSource + nConverted * 2, pTarget + nConverted, nPixelCount - nConverted);
+	}
+
+	void CPixelConversion::convertYUY2ToRGB16(const uint8_t* pSource, uint8_t* pTarget, size_t nPixelCount, bool bAllowSIMD)
+	{
+		size_t nConverted = 0;
+#ifdef PIXELCONVERSION_SSE2
+		if (bAllowSIMD)
+			nConverted = convertYUY2ToRGB16_SSE2(pSource, pTarget, nPixelCount);
+#endif
+		convertYUY2ToRGB16_Scalar(pSource + nConverted * 2, pTarget + nConverted * 2, nPixelCount - nConverted);
+	}
+
+	void CPixelConversion::convertYUY2ToRGB24(const uint8_t* pSource, uint8_t* pTarget, size_t nPixelCount, bool bAllowSIMD)
+	{
+		size_t nConverted = 0;
+#ifdef PIXELCONVERSION_SSE2
+		if (bAllowSIMD)
+			nConverted = convertYUY2ToRGB24_SSE2(pSource, pTarget, nPixelCount);
+#endif
+		convertYUY2ToRGB24_Scalar(pSource + nConverted * 2, pTarget + nConverted * 3, nPixelCount - nConverted);
+	}
+
+	void CPixelConversion::convertYUY2ToRGBA32(const uint8_t* pSource, uint8_t* pTarget, size_t nPixelCount, bool bAllowSIMD)
+	{
+		size_t nConverted = 0;
+#ifdef PIXELCONVERSION_SSE2
+		if (bAllowSIMD)
+			nConverted = convertYUY2ToRGBA32_SSE2(pSource, pTarget, nPixelCount);
+#endif
+		convertYUY2ToRGBA32_Scalar(pSource + nConverted * 2, pTarget + nConverted * 4, nPixelCount - nConverted);
+	}
+
+}
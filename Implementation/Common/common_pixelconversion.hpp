@@ -0,0 +1,85 @@
+/*++
+
+Copyright (C) 2025 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#ifndef __AMCCOMMON_PIXELCONVERSION
+#define __AMCCOMMON_PIXELCONVERSION
+
+#include <cstdint>
+#include <cstddef>
+
+namespace AMCCommon {
+
+	// Row kernels for converting between the pixel formats of image data.
+	// RGB16 pixels are little endian with red in the lowest five bits, green in the middle six and blue in the highest five.
+	// Grey values of colour pixels are the plain mean (R + G + B) / 3.
+	// Every kernel has a scalar implementation. If bAllowSIMD is set and the build supports SSE2, the bulk of a row
+	// is converted by a vectorized kernel that produces bit-identical results.
+	class CPixelConversion {
+
+	public:
+
+		static bool hasSIMDSupport();
+
+		static void convertRGB16ToGreyScale8(const uint8_t* pSource, uint8_t* pTarget, size_t nPixelCount, bool bAllowSIMD = true);
+		static void convertRGB24ToGreyScale8(const uint8_t* pSource, uint8_t* pTarget, size_t nPixelCount, bool bAllowSIMD = true);
+		static void convertRGBA32ToGreyScale8(const uint8_t* pSource, uint8_t* pTarget, size_t nPixelCount, bool bAllowSIMD = true);
+
+		static void convertGreyScale8ToRGB16(const uint8_t* pSource, uint8_t* pTarget, size_t nPixelCount, bool bAllowSIMD = true);
+		static void convertRGB24ToRGB16(const uint8_t* pSource, uint8_t* pTarget, size_t nPixelCount, bool bAllowSIMD = true);
+		static void convertRGBA32ToRGB16(const uint8_t* pSource, uint8_t* pTarget, size_t nPixelCount, bool bAllowSIMD = true);
+
+		static void convertGreyScale8ToRGB24(const uint8_t* pSource, uint8_t* pTarget, size_t nPixelCount, bool bAllowSIMD = true);
+		static void convertRGB16ToRGB24(const uint8_t* pSource, uint8_t* pTarget, size_t nPixelCount, bool bAllowSIMD = true);
+		static void convertRGBA32ToRGB24(const uint8_t* pSource, uint8_t* pTarget, size_t nPixelCount, bool bAllowSIMD = true);
+
+		static void convertGreyScale8ToRGBA32(const uint8_t* pSource, uint8_t* pTarget, size_t nPixelCount, bool bAllowSIMD = true);
+		static void convertRGB16ToRGBA32(const uint8_t* pSource, uint8_t* pTarget, size_t nPixelCount, bool bAllowSIMD = true);
+		static void convertRGB24ToRGBA32(const uint8_t* pSource, uint8_t* pTarget, size_t nPixelCount, bool bAllowSIMD = true);
+
+		// Thresholds at 128. The first pixel goes into the highest bit of a byte. nTargetBitOffset (0..7) is the bit position
+		// of the first pixel in the first target byte; bits before it are kept.
+		static void packGreyScale8ToBlackWhite1bit(const uint8_t* pSource, uint8_t* pTarget, size_t nTargetBitOffset, size_t nPixelCount, bool bAllowSIMD = true);
+
+		// The first pixel goes into the lowest bits of a byte.
+		static void packGreyScale8ToGreyScale2bit(const uint8_t* pSource, uint8_t* pTarget, size_t nPixelCount, bool bAllowSIMD = true);
+		static void packGreyScale8ToGreyScale4bit(const uint8_t* pSource, uint8_t* pTarget, size_t nPixelCount, bool bAllowSIMD = true);
+
+		// YUY2 stores two pixels in four bytes (Y0 U Y1 V). The pixel count must be even.
+		static void convertYUY2ToGreyScale8(const uint8_t* pSource, uint8_t* pTarget, size_t nPixelCount, bool bAllowSIMD = true);
+		static void convertYUY2ToRGB16(const uint8_t* pSource, uint8_t* pTarget, size_t nPixelCount, bool bAllowSIMD = true);
+		static void convertYUY2ToRGB24(const uint8_t* pSource, uint8_t* pTarget, size_t nPixelCount, bool bAllowSIMD = true);
+		static void convertYUY2ToRGBA32(const uint8_t* pSource, uint8_t* pTarget, size_t nPixelCount, bool bAllowSIMD = true);
+
+	};
+
+}
+
+#endif //__AMCCOMMON_PIXELCONVERSION
@@ -0,0 +1,160 @@
+/*++
+
+Copyright (C) 2025 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "common_sha256calculator.hpp"
+#include "common_utils.hpp"
+
+#include "PicoSHA2/picosha2.h"
+
+#include <fstream>
+#include <stdexcept>
+
+#define SHA256CALCULATOR_FILEREADBUFFERSIZE (1024 * 1024)
+
+namespace AMCCommon {
+
+	CSHA256Calculator::CSHA256Calculator(uint32_t nBlockSize)
+		: m_nBlockSize (nBlockSize), m_nCurrentBlockSize (0), m_nProcessedSize (0), m_bFinished (false)
+	{
+		if (nBlockSize == 0)
+			throw std::runtime_error("invalid hash block size!");
+
+		m_pTotalHasher.reset(new picosha2::hash256_one_by_one());
+		m_pBlockHasher.reset(new picosha2::hash256_one_by_one());
+		m_pBlockChecksumHasher.reset(new picosha2::hash256_one_by_one());
+	}
+
+	CSHA256Calculator::~CSHA256Calculator()
+	{
+	}
+
+	void CSHA256Calculator::finishCurrentBlock()
+	{
+		m_pBlockHasher->finish();
+		std::string sBlockChecksum = picosha2::get_hash_hex_string(*m_pBlockHasher);
+
+		// The block SHA256 is the SHA256 of all concatenated block checksum strings.
+		m_pBlockChecksumHasher->process(sBlockChecksum.begin(), sBlockChecksum.end());
+
+		m_pBlockHasher->init();
+		m_nCurrentBlockSize = 0;
+	}
+
+	void CSHA256Calculator::addData(const uint8_t* pData, uint64_t nDataSize)
+	{
+		if (m_bFinished)
+			throw std::runtime_error("hash calculation has already been finished");
+
+		if (nDataSize == 0)
+			return;
+		if (pData == nullptr)
+			throw std::runtime_error("invalid hash data");
+
+		const uint8_t* pCurrent = pData;
+		uint64_t nRemaining = nDataSize;
+
+		while (nRemaining > 0) {
+			uint64_t nPieceSize = (uint64_t)m_nBlockSize - m_nCurrentBlockSize;
+			if (nPieceSize > nRemaining)
+				nPieceSize = nRemaining;
+
+			m_pTotalHasher->process(pCurrent, pCurrent + nPieceSize);
+			m_pBlockHasher->process(pCurrent, pCurrent + nPieceSize);
+
+			m_nCurrentBlockSize += (uint32_t)nPieceSize;
+			if (m_nCurrentBlockSize == m_nBlockSize)
+				finishCurrentBlock();
+
+			pCurrent += nPieceSize;
+			nRemaining -= nPieceSize;
+		}
+
+		m_nProcessedSize += nDataSize;
+	}
+
+	void CSHA256Calculator::addFileRange(const std::string& sFileNameUTF8, uint64_t nOffset, uint64_t nSize)
+	{
+		if (nSize == 0)
+			return;
+
+#ifndef __GNUC__
+		auto sWidePath = AMCCommon::CUtils::UTF8toUTF16(sFileNameUTF8);
+		std::ifstream shaStream(sWidePath, std::ios::binary);
+#else
+		std::ifstream shaStream(sFileNameUTF8, std::ios::binary);
+#endif			
+		if (!shaStream.is_open())
+			throw std::runtime_error("could not open file for hash calculation.");
+
+		shaStream.seekg(nOffset, shaStream.beg);
+		if (!shaStream)
+			throw std::runtime_error("could not seek hash stream");
+
+		std::vector<uint8_t> Buffer;
+		Buffer.resize((nSize < SHA256CALCULATOR_FILEREADBUFFERSIZE) ? (size_t)nSize : SHA256CALCULATOR_FILEREADBUFFERSIZE);
+
+		uint64_t nRemaining = nSize;
+		while (nRemaining > 0) {
+			size_t nBytesToRead = Buffer.size();
+			if (nBytesToRead > nRemaining)
+				nBytesToRead = (size_t)nRemaining;
+
+			shaStream.read((char*)Buffer.data(), nBytesToRead);
+			if (!shaStream)
+				throw std::runtime_error("could not read hash stream");
+
+			addData(Buffer.data(), nBytesToRead);
+			nRemaining -= nBytesToRead;
+		}
+	}
+
+	uint64_t CSHA256Calculator::getProcessedSize()
+	{
+		return m_nProcessedSize;
+	}
+
+	void CSHA256Calculator::finish(std::string& sSHA256, std::string& sBlockSHA256)
+	{
+		if (m_bFinished)
+			throw std::runtime_error("hash calculation has already been finished");
+
+		if (m_nCurrentBlockSize > 0)
+			finishCurrentBlock();
+
+		m_pTotalHasher->finish();
+		m_pBlockChecksumHasher->finish();
+		m_bFinished = true;
+
+		sSHA256 = picosha2::get_hash_hex_string(*m_pTotalHasher);
+		sBlockSHA256 = picosha2::get_hash_hex_string(*m_pBlockChecksumHasher);
+	}
+
+}
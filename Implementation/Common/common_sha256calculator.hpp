@@ -0,0 +1,82 @@
+/*++
+
+Copyright (C) 2025 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#ifndef __AMCCOMMON_SHA256CALCULATOR
+#define __AMCCOMMON_SHA256CALCULATOR
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace picosha2 {
+	class hash256_one_by_one;
+}
+
+namespace AMCCommon {
+
+	// Calculates the SHA256 and the blockwise SHA256 of a byte stream in a single pass.
+	// Results are identical to CUtils::calculateSHA256FromFile and CUtils::calculateBlockwiseSHA256FromFile.
+	class CSHA256Calculator {
+	private:
+
+		uint32_t m_nBlockSize;
+		uint32_t m_nCurrentBlockSize;
+		uint64_t m_nProcessedSize;
+		bool m_bFinished;
+
+		std::unique_ptr<picosha2::hash256_one_by_one> m_pTotalHasher;
+		std::unique_ptr<picosha2::hash256_one_by_one> m_pBlockHasher;
+		std::unique_ptr<picosha2::hash256_one_by_one> m_pBlockChecksumHasher;
+
+		void finishCurrentBlock();
+
+	public:
+
+		CSHA256Calculator(uint32_t nBlockSize);
+
+		virtual ~CSHA256Calculator();
+
+		void addData(const uint8_t* pData, uint64_t nDataSize);
+
+		// Reads the given range of a file and adds it to the calculation.
+		void addFileRange(const std::string& sFileNameUTF8, uint64_t nOffset, uint64_t nSize);
+
+		uint64_t getProcessedSize();
+
+		void finish(std::string& sSHA256, std::string& sBlockSHA256);
+
+	};
+
+	typedef std::shared_ptr<CSHA256Calculator> PSHA256Calculator;
+
+}
+
+#endif // __AMCCOMMON_SHA256CALCULATOR
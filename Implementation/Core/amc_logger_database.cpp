@@ -50,13 +50,22 @@ namespace AMC {
 	
 	CLogger_Database::~CLogger_Database()
 	{
+		try {
+			std::lock_guard<std::mutex> lockGuard(m_DBMutex);
+			m_pLogSession->Flush();
+		}
+		catch (...) {
+			// Destructors must not throw
+		}
+
 		m_pLogSession = nullptr;
 		m_pDataModel = nullptr;
 	}
 
 	void CLogger_Database::logMessageEx(const std::string& sMessage, const std::string& sSubSystem, const eLogLevel logLevel, const std::string & sTimeStamp)
 	{
-
+		// AddEntry only enqueues the message and the journal writes it in a background batch,
+		// so the lock is held only briefly. It is still needed, as the log session instance itself is not thread safe.
 		std::lock_guard<std::mutex> lockGuard(m_DBMutex);
 		try {
 			m_pLogSession->AddEntry(sMessage, sSubSystem, logLevel, sTimeStamp);
@@ -39,10 +39,13 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "common_utils.hpp"
 
+#include <cmath>
+
 namespace AMC {
 
 	CParameter_Valued::CParameter_Valued(const std::string& sName, const std::string& sDescription, const std::string & sDefaultValue, eParameterDataType eDataType, PStateJournal pJournal, uint32_t nJournalVariableID, const std::string& sOriginalPath)
-		: m_sName(sName), m_sDescription (sDescription), m_sDefaultValue (sDefaultValue), m_nJournalVariableID(nJournalVariableID), m_pJournal (pJournal), m_DataType (eDataType), m_sOriginalPath (sOriginalPath), m_nChangeCounter(1)
+		: m_sName(sName), m_sDescription (sDescription), m_sDefaultValue (sDefaultValue), m_nJournalVariableID(nJournalVariableID), m_pJournal (pJournal), m_DataType (eDataType), m_sOriginalPath (sOriginalPath), m_nChangeCounter(1),
+		m_ValueType (eParameterValueType::String), m_dValue (0.0), m_nValue (0), m_bValue (false), m_bStringValueIsValid (true)
 	{
 		if (sName.length() == 0)
 			throw ELibMCInterfaceException(LIBMC_ERROR_EMPTYPARAMETERNAME);
@@ -51,7 +54,8 @@ namespace AMC {
 	}
 
 	CParameter_Valued::CParameter_Valued(const std::string& sName, const std::string& sDescription, const double dDefaultValue, eParameterDataType eDataType, PStateJournal pJournal, uint32_t nJournalVariableID, const std::string& sOriginalPath)
-		: m_sName(sName), m_sDescription(sDescription), m_sDefaultValue(std::to_string (dDefaultValue)), m_nJournalVariableID(nJournalVariableID), m_pJournal (pJournal), m_DataType(eDataType), m_sOriginalPath (sOriginalPath), m_nChangeCounter(1)
+		: m_sName(sName), m_sDescription(sDescription), m_sDefaultValue(std::to_string (dDefaultValue)), m_nJournalVariableID(nJournalVariableID), m_pJournal (pJournal), m_DataType(eDataType), m_sOriginalPath (sOriginalPath), m_nChangeCounter(1),
+		m_ValueType (eParameterValueType::Double), m_dValue (dDefaultValue), m_nValue (0), m_bValue (false), m_bStringValueIsValid (true)
 	{
 		if (sName.length() == 0)
 			throw ELibMCInterfaceException(LIBMC_ERROR_EMPTYPARAMETERNAME);
@@ -60,7 +64,8 @@ namespace AMC {
 	}
 
 	CParameter_Valued::CParameter_Valued(const std::string& sName, const std::string& sDescription, const int64_t nDefaultValue, eParameterDataType eDataType, PStateJournal pJournal, uint32_t nJournalVariableID, const std::string& sOriginalPath)
-		: m_sName(sName), m_sDescription(sDescription), m_sDefaultValue(std::to_string(nDefaultValue)), m_nJournalVariableID(nJournalVariableID), m_pJournal (pJournal), m_DataType(eDataType), m_sOriginalPath (sOriginalPath), m_nChangeCounter(1)
+		: m_sName(sName), m_sDescription(sDescription), m_sDefaultValue(std::to_string(nDefaultValue)), m_nJournalVariableID(nJournalVariableID), m_pJournal (pJournal), m_DataType(eDataType), m_sOriginalPath (sOriginalPath), m_nChangeCounter(1),
+		m_ValueType (eParameterValueType::Integer), m_dValue (0.0), m_nValue (nDefaultValue), m_bValue (false), m_bStringValueIsValid (true)
 	{
 		if (sName.length() == 0)
 			throw ELibMCInterfaceException(LIBMC_ERROR_EMPTYPARAMETERNAME);
@@ -69,7 +74,8 @@ namespace AMC {
 	}
 
 	CParameter_Valued::CParameter_Valued(const std::string& sName, const std::string& sDescription, const bool bDefaultValue, eParameterDataType eDataType, PStateJournal pJournal, uint32_t nJournalVariableID, const std::string& sOriginalPath)
-		: m_sName(sName), m_sDescription(sDescription), m_sDefaultValue(bDefaultValue ? "1" : "0"), m_nJournalVariableID(nJournalVariableID), m_pJournal (pJournal), m_DataType(eDataType), m_sOriginalPath (sOriginalPath), m_nChangeCounter(1)
+		: m_sName(sName), m_sDescription(sDescription), m_sDefaultValue(bDefaultValue ? "1" : "0"), m_nJournalVariableID(nJournalVariableID), m_pJournal (pJournal), m_DataType(eDataType), m_sOriginalPath (sOriginalPath), m_nChangeCounter(1),
+		m_ValueType (eParameterValueType::Bool), m_dValue (0.0), m_nValue (0), m_bValue (bDefaultValue), m_bStringValueIsValid (true)
 	{
 		if (sName.length() == 0)
 			throw ELibMCInterfaceException(LIBMC_ERROR_EMPTYPARAMETERNAME);
@@ -106,7 +112,7 @@ namespace AMC {
 	// The following calls are not thread-safe and need to be mutexed in ParameterGroup!
 	std::string CParameter_Valued::getStringValue() const
 	{
-		return std::string(m_sValue.c_str());
+		return std::string(formatStringValue().c_str());
 	}
 
 	void CParameter_Valued::setStringValue(const std::string& sValue, uint64_t nAbsoluteTimeStamp)
@@ -119,30 +125,56 @@ namespace AMC {
 
 	double CParameter_Valued::getDoubleValue() const
 	{
-		return AMCCommon::CUtils::stringToDouble(m_sValue);
+		switch (m_ValueType) {
+		case eParameterValueType::Double:
+			return m_dValue;
+		case eParameterValueType::Integer:
+			return (double)m_nValue;
+		case eParameterValueType::Bool:
+			return m_bValue ? 1.0 : 0.0;
+		default:
+			return AMCCommon::CUtils::stringToDouble(m_sValue);
+		}
 	}
 
 	void CParameter_Valued::setDoubleValue(const double dValue, uint64_t nAbsoluteTimeStamp)
 	{
 		if (m_pJournal.get() != nullptr)
 			m_pJournal->updateDoubleValue(m_nJournalVariableID, dValue);
-		setValueEx (std::to_string(dValue), nAbsoluteTimeStamp);
+		setValueEx (dValue, nAbsoluteTimeStamp);
 	}
 
 	int64_t CParameter_Valued::getIntValue() const
 	{
-		return AMCCommon::CUtils::stringToIntegerWithAccuracy(m_sValue, PARAMETER_INTEGERACCURACY);
+		switch (m_ValueType) {
+		case eParameterValueType::Integer:
+			return m_nValue;
+		case eParameterValueType::Bool:
+			return m_bValue ? 1 : 0;
+		case eParameterValueType::Double: {
+			// Same rounding rules as the string conversion
+			int64_t nResult = (int64_t)round(m_dValue);
+			if (std::fabs(m_dValue - (double)nResult) > PARAMETER_INTEGERACCURACY)
+				throw std::runtime_error("invalid integer string: " + formatStringValue());
+			return nResult;
+		}
+		default:
+			return AMCCommon::CUtils::stringToIntegerWithAccuracy(m_sValue, PARAMETER_INTEGERACCURACY);
+		}
 	}
 
 	void CParameter_Valued::setIntValue(const int64_t nValue, uint64_t nAbsoluteTimeStamp)
 	{
 		if (m_pJournal.get() != nullptr)
 			m_pJournal->updateIntegerValue(m_nJournalVariableID, nValue);
-		setValueEx (std::to_string(nValue), nAbsoluteTimeStamp);
+		setValueEx (nValue, nAbsoluteTimeStamp);
 	}
 
 	bool CParameter_Valued::getBoolValue() const
 	{
+		if (m_ValueType == eParameterValueType::Bool)
+			return m_bValue;
+
 		return getIntValue() != 0;
 	}
 
@@ -150,16 +182,18 @@ namespace AMC {
 	{
 		if (m_pJournal.get() != nullptr)
 			m_pJournal->updateBoolValue(m_nJournalVariableID, bValue);
-		if (bValue)
-			setValueEx ("1", nAbsoluteTimeStamp);
-		else
-			setValueEx ("0", nAbsoluteTimeStamp);
+		setValueEx (bValue, nAbsoluteTimeStamp);
 	}
 
 	PParameter CParameter_Valued::duplicate()
 	{
 		auto pParameter = std::make_shared<CParameter_Valued>(m_sName, m_sDescription, m_sDefaultValue, m_DataType, m_pJournal, m_nJournalVariableID, m_sOriginalPath);
+		pParameter->m_ValueType = m_ValueType;
+		pParameter->m_dValue = m_dValue;
+		pParameter->m_nValue = m_nValue;
+		pParameter->m_bValue = m_bValue;
 		pParameter->m_sValue = m_sValue;
+		pParameter->m_bStringValueIsValid = m_bStringValueIsValid;
 		return pParameter;
 	} 
 
@@ -226,16 +260,100 @@ namespace AMC {
 	}
 
 
-	
+	const std::string& CParameter_Valued::formatStringValue() const
+	{
+		if (!m_bStringValueIsValid) {
+			switch (m_ValueType) {
+			case eParameterValueType::Double:
+				m_sValue = std::to_string(m_dValue);
+				break;
+			case eParameterValueType::Integer:
+				m_sValue = std::to_string(m_nValue);
+				break;
+			case eParameterValueType::Bool:
+				m_sValue = m_bValue ? "1" : "0";
+				break;
+			default:
+				break;
+			}
+
+			m_bStringValueIsValid = true;
+		}
+
+		return m_sValue;
+	}
+
 	void CParameter_Valued::setValueEx(const std::string& sValue, uint64_t nAbsoluteTimeStamp)
 	{
-		bool hasChanged = (sValue != m_sValue);
-		if (hasChanged) {
-			m_nChangeCounter++;
-			m_sValue = sValue;
+		bool hasChanged = (sValue != formatStringValue());
+
+		m_ValueType = eParameterValueType::String;
+		m_sValue = sValue;
+		m_bStringValueIsValid = true;
+
+		if (hasChanged)
+			onValueChanged(nAbsoluteTimeStamp);
+	}
+
+	void CParameter_Valued::setValueEx(const double dValue, uint64_t nAbsoluteTimeStamp)
+	{
+		bool hasChanged;
+		if (m_ValueType == eParameterValueType::Double)
+			hasChanged = (dValue != m_dValue);
+		else
+			hasChanged = (std::to_string(dValue) != formatStringValue());
+
+		if (hasChanged || (m_ValueType != eParameterValueType::Double)) {
+			m_ValueType = eParameterValueType::Double;
+			m_dValue = dValue;
+			m_bStringValueIsValid = false;
+		}
+
+		if (hasChanged)
+			onValueChanged(nAbsoluteTimeStamp);
+	}
+
+	void CParameter_Valued::setValueEx(const int64_t nValue, uint64_t nAbsoluteTimeStamp)
+	{
+		bool hasChanged;
+		if (m_ValueType == eParameterValueType::Integer)
+			hasChanged = (nValue != m_nValue);
+		else
+			hasChanged = (std::to_string(nValue) != formatStringValue());
+
+		if (hasChanged || (m_ValueType != eParameterValueType::Integer)) {
+			m_ValueType = eParameterValueType::Integer;
+			m_nValue = nValue;
+			m_bStringValueIsValid = false;
+		}
+
+		if (hasChanged)
+			onValueChanged(nAbsoluteTimeStamp);
+	}
+
+	void CParameter_Valued::setValueEx(const bool bValue, uint64_t nAbsoluteTimeStamp)
+	{
+		bool hasChanged;
+		if (m_ValueType == eParameterValueType::Bool)
+			hasChanged = (bValue != m_bValue);
+		else
+			hasChanged = (std::string(bValue ? "1" : "0") != formatStringValue());
+
+		if (hasChanged || (m_ValueType != eParameterValueType::Bool)) {
+			m_ValueType = eParameterValueType::Bool;
+			m_bValue = bValue;
+			m_bStringValueIsValid = false;
 		}
 
-		if (hasChanged && (m_pPersistencyHandler.get () != nullptr) && (!m_sPersistentUUID.empty ())) {
+		if (hasChanged)
+			onValueChanged(nAbsoluteTimeStamp);
+	}
+
+	void CParameter_Valued::onValueChanged(uint64_t nAbsoluteTimeStamp)
+	{
+		m_nChangeCounter++;
+
+		if ((m_pPersistencyHandler.get () != nullptr) && (!m_sPersistentUUID.empty ())) {
 			LibMCData::eParameterDataType eParameterType;
 			switch (m_DataType) {
 			case eParameterDataType::String: 
@@ -258,10 +376,8 @@ namespace AMC {
 
 			}
 
-			m_pPersistencyHandler->StorePersistentParameter(m_sPersistentUUID, m_sPersistentName, eParameterType, sValue, nAbsoluteTimeStamp);
+			m_pPersistencyHandler->StorePersistentParameter(m_sPersistentUUID, m_sPersistentName, eParameterType, formatStringValue(), nAbsoluteTimeStamp);
 		}
 	}
 
 }
-
-
@@ -51,13 +51,30 @@ namespace LibMCData {
 
 namespace AMC {
 
+	// Native representation that currently holds the authoritative parameter value
+	enum class eParameterValueType : int32_t {
+		String = 0,
+		Double = 1,
+		Integer = 2,
+		Bool = 3
+	};
+
 	class CParameter_Valued : public CParameter {
 	private:
 		std::string m_sName;
 		std::string m_sDescription;
 		std::string m_sDefaultValue;
 		
-		std::string m_sValue;
+		// Typed value storage. Numeric values are kept natively and only
+		// converted to a string when the string value is requested.
+		eParameterValueType m_ValueType;
+		double m_dValue;
+		int64_t m_nValue;
+		bool m_bValue;
+
+		// Lazily formatted string cache (or the value itself for string values)
+		mutable std::string m_sValue;
+		mutable bool m_bStringValueIsValid;
 
 		// The global original path of the parameter..
 		std::string m_sOriginalPath;
@@ -66,6 +83,15 @@ namespace AMC {
 		
 		// update value including persistency storage
 		void setValueEx(const std::string& sValue, uint64_t nAbsoluteTimeStamp);
+		void setValueEx(const double dValue, uint64_t nAbsoluteTimeStamp);
+		void setValueEx(const int64_t nValue, uint64_t nAbsoluteTimeStamp);
+		void setValueEx(const bool bValue, uint64_t nAbsoluteTimeStamp);
+
+		// Marks the value as changed and writes it to the persistency storage
+		void onValueChanged(uint64_t nAbsoluteTimeStamp);
+
+		// Formats the native value into the string cache
+		const std::string& formatStringValue() const;
 
 		eParameterDataType m_DataType;
 		
@@ -51,13 +51,13 @@ namespace AMC {
 	
 
 	CParameterGroup::CParameterGroup(AMCCommon::PChrono pGlobalChrono)
-		: m_pStateJournal (nullptr), m_pGlobalChrono (pGlobalChrono)
+		: m_pStateJournal (nullptr), m_pGlobalChrono (pGlobalChrono), m_nStructureVersion (0)
 	{
 
 	}
 
 	CParameterGroup::CParameterGroup(const std::string& sName, const std::string& sDescription, AMCCommon::PChrono pGlobalChrono)
-		: m_sName(sName), m_sDescription(sDescription), m_pStateJournal (nullptr), m_pGlobalChrono(pGlobalChrono)
+		: m_sName(sName), m_sDescription(sDescription), m_pStateJournal (nullptr), m_pGlobalChrono(pGlobalChrono), m_nStructureVersion (0)
 	{
 	}
 
@@ -101,6 +101,7 @@ namespace AMC {
 
 		m_Parameters.insert(std::make_pair(sName, pParameter));
 		m_ParameterList.push_back(pParameter);
+		m_nStructureVersion++;
 	}
 
 	uint32_t CParameterGroup::getParameterCount()
@@ -137,6 +138,54 @@ namespace AMC {
 	}
 
 
+	PParameter CParameterGroup::findParameter(const std::string& sName, bool bFailIfNotExisting)
+	{
+		std::lock_guard <std::mutex> lockGuard(m_GroupMutex);
+		auto iIter = m_Parameters.find(sName);
+
+		if (iIter == m_Parameters.end()) {
+			if (bFailIfNotExisting)
+				throw ELibMCCustomException(LIBMC_ERROR_PARAMETERNOTFOUND, m_sName + "/" + sName);
+
+			return nullptr;
+		}
+
+		return iIter->second;
+	}
+
+	uint64_t CParameterGroup::getStructureVersion()
+	{
+		return m_nStructureVersion;
+	}
+
+	std::string CParameterGroup::getParameterValue(CParameter* pParameter)
+	{
+		LibMCAssertNotNull(pParameter);
+		std::lock_guard <std::mutex> lockGuard(m_GroupMutex);
+		return pParameter->getStringValue();
+	}
+
+	double CParameterGroup::getDoubleParameterValue(CParameter* pParameter)
+	{
+		LibMCAssertNotNull(pParameter);
+		std::lock_guard <std::mutex> lockGuard(m_GroupMutex);
+		return pParameter->getDoubleValue();
+	}
+
+	int64_t CParameterGroup::getIntParameterValue(CParameter* pParameter)
+	{
+		LibMCAssertNotNull(pParameter);
+		std::lock_guard <std::mutex> lockGuard(m_GroupMutex);
+		return pParameter->getIntValue();
+	}
+
+	bool CParameterGroup::getBoolParameterValue(CParameter* pParameter)
+	{
+		LibMCAssertNotNull(pParameter);
+		std::lock_guard <std::mutex> lockGuard(m_GroupMutex);
+		return pParameter->getBoolValue();
+	}
+
 	std::string CParameterGroup::getParameterValueByIndex(const uint32_t nIndex)
 	{
 		std::lock_guard <std::mutex> lockGuard(m_GroupMutex);
@@ -471,6 +520,15 @@ namespace AMC {
 		return iIter->second->getChangeCounter();
 	}
 
+	uint64_t CParameterGroup::getChangeCounterByIndex(const uint32_t nIndex)
+	{
+		std::lock_guard <std::mutex> lockGuard(m_GroupMutex);
+		if (nIndex >= m_ParameterList.size())
+			throw ELibMCCustomException(LIBMC_ERROR_INVALIDINDEX, m_sName);
+
+		return m_ParameterList[nIndex]->getChangeCounter();
+	}
+
 
 	void CParameterGroup::addNewStringParameter(const std::string& sName, const std::string& sDescription, const std::string& sDefaultValue)
 	{
@@ -615,6 +673,7 @@ namespace AMC {
 		}
 
 		m_Parameters.erase(sName);		
+		m_nStructureVersion++;
 
 	}
 
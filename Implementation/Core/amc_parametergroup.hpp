@@ -38,6 +38,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <map>
 #include <string>
 #include <mutex>
+#include <atomic>
 
 #include "amc_parametertype.hpp"
 
@@ -77,6 +78,9 @@ namespace AMC {
 
 		std::mutex m_GroupMutex;
 
+		// Increased whenever parameters are added or removed
+		std::atomic<uint64_t> m_nStructureVersion;
+
 		void addParameterInternal(PParameter pParameter);
 
 	public:
@@ -97,6 +101,9 @@ namespace AMC {
 		// Returns the change counter of the parameter (resolving all derives)
 		uint64_t getChangeCounterOf(const std::string& sName);
 
+		// Returns the change counter of the parameter at the given index (resolving all derives)
+		uint64_t getChangeCounterByIndex(const uint32_t nIndex);
+
 		// Returns the local parameter path, like "statemachine.groupname.parametername"
 		std::string getLocalParameterPath(const std::string& sName);
 
@@ -113,6 +120,16 @@ namespace AMC {
 		void getParameterInfo(const uint32_t nIndex, std::string & sName, std::string & sDescription, std::string & sDefaultValue);		
 		void getParameterInfoByName(const std::string& sName, std::string& sDescription, std::string& sDefaultValue);
 
+		// Returns the parameter object of a name. Bound parameters stay valid as long as getStructureVersion does not change.
+		PParameter findParameter(const std::string& sName, bool bFailIfNotExisting);
+		uint64_t getStructureVersion();
+
+		// Reads a parameter previously returned by findParameter
+		std::string getParameterValue(CParameter* pParameter);
+		double getDoubleParameterValue(CParameter* pParameter);
+		int64_t getIntParameterValue(CParameter* pParameter);
+		bool getBoolParameterValue(CParameter* pParameter);
+
 		std::string getParameterValueByIndex(const uint32_t nIndex);
 		std::string getParameterValueByName(const std::string & sName);
 		double getDoubleParameterValueByIndex(const uint32_t nIndex);
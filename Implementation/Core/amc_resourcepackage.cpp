@@ -33,13 +33,28 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "common_utils.hpp"
 #include "Libraries/libzip/zip.h"
+#include "Libraries/zlib/zlib.h"
 #include "Libraries/PugiXML/pugixml.hpp"
 #include "libmc_exceptiontypes.hpp"
 #include <map>
+#include <cstring>
 
 #define ROOT_ZIP_READCHUNKSIZE 65536
 #define ROOT_PACKAGEFILENAME "package.xml"
 
+// Total size of decompressed entries that are kept in memory per package.
+#define RESOURCEPACKAGE_MAXCACHESIZE (64ULL * 1024ULL * 1024ULL)
+// Larger entries are decompressed on every access.
+#define RESOURCEPACKAGE_MAXCACHEENTRYSIZE (16ULL * 1024ULL * 1024ULL)
+// Smaller entries are never sent compressed.
+#define RESOURCEPACKAGE_MINCOMPRESSIONSIZE 512
+// Compressed variants are only kept if they save at least 10 percent.
+#define RESOURCEPACKAGE_MAXCOMPRESSIONRATIO 0.9
+
+#define RESOURCEPACKAGE_ZLIBWINDOWBITS 15
+#define RESOURCEPACKAGE_GZIPWINDOWBITS (15 + 16)
+#define RESOURCEPACKAGE_ZLIBMEMLEVEL 8
+
 namespace AMC {
 
 
@@ -134,8 +149,9 @@ namespace AMC {
 		}
 
 
-		void unzipFileEx(const std::string& sName, uint8_t* pBuffer, const uint64_t nBufferSize)
+		void unzipFile(const std::string& sName, std::vector<uint8_t>& Buffer)
 		{
+
 			auto iIter = m_ZIPEntries.find(sName);
 			if (iIter == m_ZIPEntries.end())
 				throw ELibMCCustomException(LIBMC_ERROR_ZIPENTRYNOTFOUND, m_sZIPDebugName + "|" + sName);
@@ -152,17 +168,14 @@ namespace AMC {
 				throw ELibMCCustomException(LIBMC_ERROR_COULDNOTOPENZIPENTRY, m_sZIPDebugName + "|" + sName);
 
 			CResourcePackage_ZIPFilePtr pZIPFilePtr(pFile);
-			
-			if (nSize > 0) {
 
-				LibMCAssertNotNull(pBuffer);
-				if (nBufferSize < nSize)
-					throw ELibMCCustomException(LIBMC_ERROR_BUFFERTOOSMALL, m_sZIPDebugName + "|" + sName);
+			Buffer.resize(nSize);
+			if (nSize > 0) {
 
 				uint64_t cbBytesLeft = nSize;
 				uint64_t cbBytesRead = 0;
 
-				uint8_t* pData = pBuffer;
+				uint8_t* pData = Buffer.data();
 				while (cbBytesLeft > 0) {
 					uint32_t cbBytesToRead;
 					if (cbBytesLeft > ROOT_ZIP_READCHUNKSIZE)
@@ -188,67 +201,133 @@ namespace AMC {
 				}
 
 			}
-
 		}
 
 
-		void unzipFile(const std::string& sName, std::vector<uint8_t>& Buffer)
-		{
+	};
+	
 
-			auto iIter = m_ZIPEntries.find(sName);
-			if (iIter == m_ZIPEntries.end())
-				throw ELibMCCustomException(LIBMC_ERROR_ZIPENTRYNOTFOUND, m_sZIPDebugName + "|" + sName);
 
-			zip_stat_t Stat;
-			int32_t nResult = zip_stat_index(m_ZIParchive, iIter->second, ZIP_FL_UNCHANGED, &Stat);
-			if (nResult != 0)
-				throw ELibMCCustomException(LIBMC_ERROR_COULDNOTSTATZIPENTRY, m_sZIPDebugName + "|" + sName);
+	static bool compressBuffer(const std::vector<uint8_t>& Input, int32_t nWindowBits, std::vector<uint8_t>& Output)
+	{
+		Output.clear();
+		if (Input.size() > UINT32_MAX)
+			return false;
 
-			uint64_t nSize = Stat.size;
+		z_stream stream;
+		stream.zalloc = Z_NULL;
+		stream.zfree = Z_NULL;
+		stream.opaque = Z_NULL;
 
-			zip_file_t* pFile = zip_fopen_index(m_ZIParchive, iIter->second, ZIP_FL_UNCHANGED);
-			if (pFile == nullptr)
-				throw ELibMCCustomException(LIBMC_ERROR_COULDNOTOPENZIPENTRY, m_sZIPDebugName + "|" + sName);
+		if (deflateInit2(&stream, Z_BEST_COMPRESSION, Z_DEFLATED, nWindowBits, RESOURCEPACKAGE_ZLIBMEMLEVEL, Z_DEFAULT_STRATEGY) != Z_OK)
+			return false;
 
-			CResourcePackage_ZIPFilePtr pZIPFilePtr(pFile);
+		// Header of a gzip stream is larger than deflateBound assumes
+		Output.resize(deflateBound(&stream, (uLong)Input.size()) + 32);
 
-			Buffer.resize(nSize);
-			if (nSize > 0) {
+		stream.next_in = (Bytef*)Input.data();
+		stream.avail_in = (uInt)Input.size();
+		stream.next_out = Output.data();
+		stream.avail_out = (uInt)Output.size();
 
-				uint64_t cbBytesLeft = nSize;
-				uint64_t cbBytesRead = 0;
+		int32_t nResult = deflate(&stream, Z_FINISH);
+		uint64_t nCompressedSize = stream.total_out;
+		deflateEnd(&stream);
 
-				uint8_t* pData = Buffer.data();
-				while (cbBytesLeft > 0) {
-					uint32_t cbBytesToRead;
-					if (cbBytesLeft > ROOT_ZIP_READCHUNKSIZE)
-						cbBytesToRead = ROOT_ZIP_READCHUNKSIZE;
-					else
-						cbBytesToRead = (uint32_t)cbBytesLeft;
-					cbBytesLeft -= cbBytesToRead;
+		if (nResult != Z_STREAM_END) {
+			Output.clear();
+			return false;
+		}
 
-					uint64_t readSize = zip_fread(pFile, pData, cbBytesToRead);
-					if (readSize < 0)
-						throw ELibMCCustomException(LIBMC_ERROR_COULDNOTREADZIPSTREAM, m_sZIPDebugName + "|" + sName);
-					cbBytesRead += readSize;
+		Output.resize(nCompressedSize);
+		return true;
+	}
 
-					if (readSize != (uint64_t)cbBytesToRead)
-						break;
 
-					pData += readSize;
-				}
+	CResourcePackageCacheEntry::CResourcePackageCacheEntry(std::vector<uint8_t>& Data, const std::string& sContentType)
+		: m_sContentType (sContentType)
+	{
+		m_Data.swap(Data);
+	}
 
+	const std::vector<uint8_t>& CResourcePackageCacheEntry::getData()
+	{
+		return m_Data;
+	}
 
-				if ((uint64_t)cbBytesRead != nSize) {
-					throw ELibMCCustomException(LIBMC_ERROR_COULDNOTREADFULLZIPDATA, m_sZIPDebugName + "|" + sName);
-				}
+	uint64_t CResourcePackageCacheEntry::getSize()
+	{
+		return m_Data.size();
+	}
+
+	std::string CResourcePackageCacheEntry::getETag()
+	{
+		std::call_once(m_ETagFlag, [this]() {
+			m_sETag = "\"" + AMCCommon::CUtils::calculateSHA256FromData(m_Data.data(), m_Data.size()) + "\"";
+		});
+
+		return m_sETag;
+	}
 
+	void CResourcePackageCacheEntry::createEncodings()
+	{
+		std::call_once(m_EncodingFlag, [this]() {
+			if ((m_Data.size() < RESOURCEPACKAGE_MINCOMPRESSIONSIZE) || (!contentTypeIsCompressible(m_sContentType)))
+				return;
+
+			uint64_t nMaxCompressedSize = (uint64_t) (m_Data.size() * RESOURCEPACKAGE_MAXCOMPRESSIONRATIO);
+
+			if (compressBuffer(m_Data, RESOURCEPACKAGE_GZIPWINDOWBITS, m_GZIPData)) {
+				if (m_GZIPData.size() > nMaxCompressedSize)
+					m_GZIPData.clear();
 			}
-		}
 
+			if (compressBuffer(m_Data, RESOURCEPACKAGE_ZLIBWINDOWBITS, m_DeflateData)) {
+				if (m_DeflateData.size() > nMaxCompressedSize)
+					m_DeflateData.clear();
+			}
 
-	};
-	
+			m_GZIPData.shrink_to_fit();
+			m_DeflateData.shrink_to_fit();
+		});
+	}
+
+	const std::vector<uint8_t>* CResourcePackageCacheEntry::getGZIPData()
+	{
+		createEncodings();
+		if (m_GZIPData.empty())
+			return nullptr;
+
+		return &m_GZIPData;
+	}
+
+	const std::vector<uint8_t>* CResourcePackageCacheEntry::getDeflateData()
+	{
+		createEncodings();
+		if (m_DeflateData.empty())
+			return nullptr;
+
+		return &m_DeflateData;
+	}
+
+	bool CResourcePackageCacheEntry::contentTypeIsCompressible(const std::string& sContentType)
+	{
+		std::string sLowerContentType = AMCCommon::CUtils::toLowerString(sContentType);
+
+		if (sLowerContentType.find("text/") == 0)
+			return true;
+
+		if ((sLowerContentType.find("javascript") != std::string::npos) ||
+			(sLowerContentType.find("json") != std::string::npos) ||
+			(sLowerContentType.find("xml") != std::string::npos) ||
+			(sLowerContentType.find("wasm") != std::string::npos))
+			return true;
+
+		if ((sLowerContentType.find("font/ttf") == 0) || (sLowerContentType.find("font/otf") == 0) || (sLowerContentType.find("image/x-icon") == 0) || (sLowerContentType.find("image/bmp") == 0))
+			return true;
+
+		return false;
+	}
 
 
 	CResourcePackageEntry::CResourcePackageEntry(const std::string& sUUID,  const std::string& sName, const std::string& sFileName, const std::string& sExtension, const std::string& sContentType, uint32_t nSize)
@@ -314,14 +393,14 @@ namespace AMC {
 	}
 
 	CResourcePackage::CResourcePackage(const std::string& sPackageDebugName)
-		: m_sPackageDebugName (sPackageDebugName)
+		: m_sPackageDebugName (sPackageDebugName), m_nCacheSize (0)
 	{
 		m_pResourcePackageZIP = nullptr;
 	}
 
 
 	CResourcePackage::CResourcePackage(AMCCommon::CImportStream* pStream, const std::string& sPackageDebugName, const std::string& sSchemaNamespace)
-		: m_sPackageDebugName (sPackageDebugName)
+		: m_sPackageDebugName (sPackageDebugName), m_nCacheSize (0)
 	{
 		LibMCAssertNotNull(pStream);
 
@@ -446,35 +525,73 @@ namespace AMC {
 
 
 
-	void CResourcePackage::readEntry(const std::string& sName, std::vector<uint8_t>& Buffer)
+	PResourcePackageEntry CResourcePackage::findEntryInternal(const std::string& sName)
 	{
-		std::lock_guard<std::mutex> lockGuard(m_Mutex);
-
-		auto iIter = m_NameMap.find(AMCCommon::CUtils::toLowerString (sName));
+		auto iIter = m_NameMap.find(AMCCommon::CUtils::toLowerString(sName));
 		if (iIter == m_NameMap.end())
 			throw ELibMCCustomException(LIBMC_ERROR_RESOURCEENTRYNOTFOUND, m_sPackageDebugName + "/" + sName);
 
-		auto sFileName = iIter->second->getFileName ();
-		m_pResourcePackageZIP->unzipFile(sFileName, Buffer);
-
+		return iIter->second;
 	}
 
-	std::string CResourcePackage::readEntryUTF8String(const std::string& sName)
+	PResourcePackageCacheEntry CResourcePackage::readCachedEntry(const std::string& sName)
 	{
+		auto pEntry = findEntryInternal(sName);
+		auto sFileName = pEntry->getFileName();
 
-		std::lock_guard<std::mutex> lockGuard(m_Mutex);
+		{
+			std::lock_guard<std::mutex> cacheLockGuard(m_CacheMutex);
+			auto iCacheIter = m_EntryCache.find(sFileName);
+			if (iCacheIter != m_EntryCache.end())
+				return iCacheIter->second;
+		}
 
-		auto iIter = m_NameMap.find(AMCCommon::CUtils::toLowerString (sName));
-		if (iIter == m_NameMap.end())
-			throw ELibMCCustomException(LIBMC_ERROR_RESOURCEENTRYNOTFOUND, m_sPackageDebugName + "/" + sName);
+		std::vector<uint8_t> Buffer;
+		{
+			std::lock_guard<std::mutex> lockGuard(m_Mutex);
+			if (m_pResourcePackageZIP.get() == nullptr)
+				throw ELibMCCustomException(LIBMC_ERROR_RESOURCEENTRYNOTFOUND, m_sPackageDebugName + "/" + sName);
+
+			m_pResourcePackageZIP->unzipFile(sFileName, Buffer);
+		}
+
+		auto pCacheEntry = std::make_shared<CResourcePackageCacheEntry>(Buffer, pEntry->getContentType());
+		uint64_t nEntrySize = pCacheEntry->getSize();
+
+		if (nEntrySize <= RESOURCEPACKAGE_MAXCACHEENTRYSIZE) {
+			std::lock_guard<std::mutex> cacheLockGuard(m_CacheMutex);
+
+			// Another thread might have decompressed the same entry in the meantime
+			auto iCacheIter = m_EntryCache.find(sFileName);
+			if (iCacheIter != m_EntryCache.end())
+				return iCacheIter->second;
+
+			if ((m_nCacheSize + nEntrySize) <= RESOURCEPACKAGE_MAXCACHESIZE) {
+				m_EntryCache.insert(std::make_pair(sFileName, pCacheEntry));
+				m_nCacheSize += nEntrySize;
+			}
+		}
+
+		return pCacheEntry;
+	}
 
-		auto sFileName = iIter->second->getFileName();
-		std::vector <uint8_t> Buffer;
-		m_pResourcePackageZIP->unzipFile(sFileName, Buffer);
+	void CResourcePackage::readEntry(const std::string& sName, std::vector<uint8_t>& Buffer)
+	{
+		auto pCacheEntry = readCachedEntry(sName);
+		Buffer = pCacheEntry->getData();
+	}
 
-		Buffer.push_back(0);
+	std::string CResourcePackage::readEntryUTF8String(const std::string& sName)
+	{
+		auto pCacheEntry = readCachedEntry(sName);
+		auto & Buffer = pCacheEntry->getData();
 
-		std::string sUTF8String ((char*)Buffer.data());
+		std::string sUTF8String (Buffer.begin (), Buffer.end ());
+
+		// Content is truncated at the first null character
+		size_t nNullPosition = sUTF8String.find('\0');
+		if (nNullPosition != std::string::npos)
+			sUTF8String.resize(nNullPosition);
 
 		if (!AMCCommon::CUtils::UTF8StringIsValid (sUTF8String))
 			throw ELibMCCustomException(LIBMC_ERROR_RESOURCEENTRYISNOUTF8STRING, m_sPackageDebugName + "/" + sName);
@@ -485,19 +602,19 @@ namespace AMC {
 
 	void CResourcePackage::readEntryEx(const std::string& sName, uint8_t* pBuffer, const uint64_t nBufferSize)
 	{
-		std::lock_guard<std::mutex> lockGuard(m_Mutex);
+		auto pCacheEntry = readCachedEntry(sName);
+		auto& Buffer = pCacheEntry->getData();
 
-		auto iIter = m_NameMap.find(AMCCommon::CUtils::toLowerString (sName));
-		if (iIter == m_NameMap.end())
-			throw ELibMCCustomException(LIBMC_ERROR_RESOURCEENTRYNOTFOUND, m_sPackageDebugName + "/" + sName);
+		if (Buffer.size() > 0) {
+			LibMCAssertNotNull(pBuffer);
+			if (nBufferSize < Buffer.size())
+				throw ELibMCCustomException(LIBMC_ERROR_BUFFERTOOSMALL, m_sPackageDebugName + "|" + sName);
 
-		auto sFileName = iIter->second->getFileName();
-		m_pResourcePackageZIP->unzipFileEx(sFileName, pBuffer, nBufferSize);
+			memcpy(pBuffer, Buffer.data(), Buffer.size());
+		}
 
 	}
 
 
 
 }
-
-
@@ -35,6 +35,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <mutex>
 #include <map>
 #include <vector>
+#include <string>
 
 #include "common_importstream.hpp"
 
@@ -46,6 +47,9 @@ namespace AMC {
 	class CResourcePackageEntry;
 	typedef std::shared_ptr<CResourcePackageEntry> PResourcePackageEntry;
 
+	class CResourcePackageCacheEntry;
+	typedef std::shared_ptr<CResourcePackageCacheEntry> PResourcePackageCacheEntry;
+
 	class CResourcePackage;
 	typedef std::shared_ptr<CResourcePackage> PResourcePackage;
 
@@ -69,17 +73,56 @@ namespace AMC {
 		uint32_t getSize();
 	};
 
+	// Decompressed content of a package entry. Entity tag and compressed
+	// transfer variants are computed once and shared between all requests.
+	class CResourcePackageCacheEntry {
+	private:
+		std::vector<uint8_t> m_Data;
+		std::string m_sContentType;
+
+		std::once_flag m_EncodingFlag;
+		std::vector<uint8_t> m_GZIPData;
+		std::vector<uint8_t> m_DeflateData;
+
+		std::once_flag m_ETagFlag;
+		std::string m_sETag;
+
+		void createEncodings();
+
+	public:
+		// Takes ownership of the contents of Data.
+		CResourcePackageCacheEntry(std::vector<uint8_t>& Data, const std::string& sContentType);
+
+		const std::vector<uint8_t>& getData();
+		uint64_t getSize();
+
+		// Strong entity tag, derived from the SHA256 hash of the content.
+		std::string getETag();
+
+		// Returns nullptr, if the content type is not compressible or compression does not pay off.
+		const std::vector<uint8_t>* getGZIPData();
+		const std::vector<uint8_t>* getDeflateData();
+
+		static bool contentTypeIsCompressible(const std::string& sContentType);
+	};
+
 	class CResourcePackage {
 	private:
 		std::mutex m_Mutex;
 		std::vector<uint8_t> m_ZIPBuffer;
 
+		std::mutex m_CacheMutex;
+		std::map<std::string, PResourcePackageCacheEntry> m_EntryCache;
+		uint64_t m_nCacheSize;
+
 		std::map<std::string, PResourcePackageEntry> m_UUIDMap;
 		std::map<std::string, PResourcePackageEntry> m_NameMap;
 		std::vector<PResourcePackageEntry> m_Entries;
 
 		PResourcePackageZIP m_pResourcePackageZIP;
 		std::string m_sPackageDebugName;
+
+		PResourcePackageEntry findEntryInternal(const std::string& sName);
 		
 	protected:
 
@@ -99,6 +142,9 @@ namespace AMC {
 		PResourcePackageEntry findEntryByUUID(const std::string& sUUID, const bool bHasToExist);
 		PResourcePackageEntry findEntryByName(const std::string& sName, const bool bHasToExist);
 
+		// Returns the decompressed entry. Entries are cached up to a fixed total size.
+		PResourcePackageCacheEntry readCachedEntry(const std::string& sName);
+
 		// Resizes Buffer array to right size
 		void readEntry(const std::string& sName, std::vector<uint8_t>& Buffer);
 		std::string readEntryUTF8String (const std::string& sName);
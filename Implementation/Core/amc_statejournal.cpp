@@ -42,6 +42,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <future>
 #include <iostream>
 #include <mutex>
+#include <atomic>
+#include <algorithm>
 
 namespace AMC {
 
@@ -82,6 +84,12 @@ namespace AMC {
 			throw ELibMCCustomException(LIBMC_ERROR_JOURNALVARIABLEISNOTNUMERIC, m_sName);
 		}
 
+		// Factor between the recorded integer values and the numeric value
+		virtual double getNumericUnits()
+		{
+			throw ELibMCCustomException(LIBMC_ERROR_JOURNALVARIABLEISNOTNUMERIC, m_sName);
+		}
+
 	};
 
 
@@ -127,6 +135,11 @@ namespace AMC {
 			return 0.0;
 		}
 
+		double getNumericUnits() override
+		{
+			return 1.0;
+		}
+
 	};
 
 
@@ -173,6 +186,11 @@ namespace AMC {
 			return (double)m_pStream->sampleIntegerData(m_nStorageIndex, nTimeStampInMicroseconds);
 		}
 
+		double getNumericUnits() override
+		{
+			return 1.0;
+		}
+
 
 
 	};
@@ -246,6 +264,11 @@ namespace AMC {
 			return m_pStream->sampleDoubleData (m_nStorageIndex, nTimeStampInMicroseconds, m_dUnits);
 		}
 
+		double getNumericUnits() override
+		{
+			return m_dUnits;
+		}
+
 	};
 
 	class CStateJournalImplStringVariable : public CStateJournalImplVariable {
@@ -294,21 +317,28 @@ namespace AMC {
 
 		uint32_t m_nChunkWriteIntervalInSeconds;
 
-		eStateJournalMode m_JournalMode;
+		std::atomic<eStateJournalMode> m_JournalMode;
 		AMCCommon::PChrono m_pGlobalChrono;
 		uint64_t m_nAbsoluteStartTimeInMicroseconds;
-		uint64_t m_nLifetimeInMicroseconds;
+		std::atomic<uint64_t> m_nLifetimeInMicroseconds;
 
 		PStateJournalStream m_pStream;
 		PLogger m_pLogger;
 
+		// Protects the journal mode changes and the readers. Value updates do not take this mutex.
 		std::mutex m_Mutex;
 
+		// Serializes the value updates, so that the stream receives increasing time stamps from a single producer.
+		std::mutex m_UpdateMutex;
+
 		std::atomic<bool> m_ThreadStopFlag;
 		std::future<void> m_ThreadFuture;
 
 		PStateJournalImplVariable findVariable(const std::string& sName);
 
+		// Variable IDs are assigned sequentially, so the lookup does not need a map (no mutex protection)
+		CStateJournalImplVariable* findVariableByID(const uint32_t nVariableID);
+
 	public:
 
 		CStateJournalImpl(PStateJournalStream pStream, AMCCommon::PChrono pGlobalChrono);
@@ -327,10 +357,14 @@ namespace AMC {
 
 		uint64_t retrieveTimeStamp_MicroSecond();
 
-		//void readDoubleTimeStream(const std::string& sName, const sStateJournalInterval& interval, std::vector<sJournalTimeStreamDoubleEntry>& timeStream);
-
 		double computeSample(const std::string& sName, const uint64_t nTimeStampInMicroseconds);
 
+		void sampleDoubleTimeStream(const std::string& sName, std::vector<sJournalTimeStreamDoubleEntry>& timeStream);
+
+		void readDoubleTimeStream(const std::string& sName, const sStateJournalInterval& interval, std::vector<sJournalTimeStreamDoubleEntry>& timeStream);
+
+		void computeStatistics(const std::string& sName, const sStateJournalInterval& interval, sStateJournalStatistics& statistics);
+
 		void recordingThread();
 		
 		std::string getStartTimeAsUTC();
@@ -444,11 +478,11 @@ namespace AMC {
 			if (m_JournalMode != eStateJournalMode::sjmInitialising)
 				throw ELibMCInterfaceException(LIBMC_ERROR_JOURNALISNOTINITIALISING);
 
+			// Value updates only check the mode, so the stream has to be ready before recording starts
+			m_pStream->setVariableCount(m_VariableList.size());
 			m_JournalMode = eStateJournalMode::sjmRecording;
 		}
 
-		m_pStream->setVariableCount(m_VariableList.size());
-
 		m_ThreadStopFlag = false;
 		m_ThreadFuture = std::async(std::launch::async, [this] { this->recordingThread(); });
 
@@ -497,7 +531,7 @@ namespace AMC {
 			uint64_t nTimeOutTimeStamp = chrono.getUTCTimeStampInMicrosecondsSince1970 () +  (uint64_t) m_nChunkWriteIntervalInSeconds * 1000000ULL;
 			uint32_t nThreadSleepTimeInMilliseconds = 1;
 
-			while ((!m_ThreadStopFlag) && (chrono.getUTCTimeStampInMicrosecondsSince1970() < nTimeOutTimeStamp)) {
+			while ((!m_ThreadStopFlag) && (chrono.getUTCTimeStampInMicrosecondsSince1970() < nTimeOutTimeStamp) && (!m_pStream->needsSerialization())) {
 				std::this_thread::sleep_for(std::chrono::milliseconds(nThreadSleepTimeInMilliseconds));
 			}
 		}
@@ -506,16 +540,15 @@ namespace AMC {
 
 	void CStateJournalImpl::updateBoolValue(const uint32_t nVariableID, const bool bValue)
 	{
-
-		std::lock_guard<std::mutex> lockGuard(m_Mutex);
-
 		if (m_JournalMode != eStateJournalMode::sjmRecording)
 			throw ELibMCInterfaceException(LIBMC_ERROR_JOURNALISNOTRECORDING);
 
-		auto iIter = m_VariableIDMap.find(nVariableID);
-		auto pBoolVariable = std::dynamic_pointer_cast<CStateJournalImplBoolVariable> (iIter->second);
-		if (pBoolVariable.get () == nullptr)
-			throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDVARIABLETYPE, "variable " + iIter->second->getName () + " is not a boolean variable");
+		auto pVariable = findVariableByID(nVariableID);
+		if (pVariable->getType() != LibMCData::eParameterDataType::Bool)
+			throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDVARIABLETYPE, "variable " + pVariable->getName() + " is not a boolean variable");
+		auto pBoolVariable = static_cast<CStateJournalImplBoolVariable*> (pVariable);
+
+		std::lock_guard<std::mutex> lockGuard(m_UpdateMutex);
 
 		uint64_t nNewTimeStamp = retrieveTimeStamp_MicroSecond();
 		m_nLifetimeInMicroseconds = nNewTimeStamp;
@@ -525,15 +558,15 @@ namespace AMC {
 
 	void CStateJournalImpl::updateIntegerValue(const uint32_t nVariableID, const int64_t nValue)
 	{
-		std::lock_guard<std::mutex> lockGuard(m_Mutex);
-
 		if (m_JournalMode != eStateJournalMode::sjmRecording)
 			throw ELibMCInterfaceException(LIBMC_ERROR_JOURNALISNOTRECORDING);
 
-		auto iIter = m_VariableIDMap.find(nVariableID);
-		auto pIntegerVariable = std::dynamic_pointer_cast<CStateJournalImplIntegerVariable> (iIter->second);
-		if (pIntegerVariable.get() == nullptr)
-			throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDVARIABLETYPE, "variable " + iIter->second->getName() + " is not a integer variable");
+		auto pVariable = findVariableByID(nVariableID);
+		if (pVariable->getType() != LibMCData::eParameterDataType::Integer)
+			throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDVARIABLETYPE, "variable " + pVariable->getName() + " is not a integer variable");
+		auto pIntegerVariable = static_cast<CStateJournalImplIntegerVariable*> (pVariable);
+
+		std::lock_guard<std::mutex> lockGuard(m_UpdateMutex);
 
 		uint64_t nNewTimeStamp = retrieveTimeStamp_MicroSecond();
 		m_nLifetimeInMicroseconds = nNewTimeStamp;
@@ -544,15 +577,15 @@ namespace AMC {
 
 	void CStateJournalImpl::updateStringValue(const uint32_t nVariableID, const std::string& sValue)
 	{
-		std::lock_guard<std::mutex> lockGuard(m_Mutex);
-
 		if (m_JournalMode != eStateJournalMode::sjmRecording)
 			throw ELibMCInterfaceException(LIBMC_ERROR_JOURNALISNOTRECORDING);
 
-		auto iIter = m_VariableIDMap.find(nVariableID);
-		auto pStringVariable = std::dynamic_pointer_cast<CStateJournalImplStringVariable> (iIter->second);
-		if (pStringVariable.get() == nullptr)
-			throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDVARIABLETYPE, "variable " + iIter->second->getName() + " is not a string variable");
+		auto pVariable = findVariableByID(nVariableID);
+		if (pVariable->getType() != LibMCData::eParameterDataType::String)
+			throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDVARIABLETYPE, "variable " + pVariable->getName() + " is not a string variable");
+		auto pStringVariable = static_cast<CStateJournalImplStringVariable*> (pVariable);
+
+		std::lock_guard<std::mutex> lockGuard(m_UpdateMutex);
 
 		uint64_t nNewTimeStamp = retrieveTimeStamp_MicroSecond();
 		m_nLifetimeInMicroseconds = nNewTimeStamp;
@@ -562,15 +595,15 @@ namespace AMC {
 
 	void CStateJournalImpl::updateDoubleValue(const uint32_t nVariableID, const double dValue)
 	{
-		std::lock_guard<std::mutex> lockGuard(m_Mutex);
-
 		if (m_JournalMode != eStateJournalMode::sjmRecording)
 			throw ELibMCInterfaceException(LIBMC_ERROR_JOURNALISNOTRECORDING);
 
-		auto iIter = m_VariableIDMap.find(nVariableID);
-		auto pDoubleVariable = std::dynamic_pointer_cast<CStateJournalImplDoubleVariable> (iIter->second);
-		if (pDoubleVariable.get() == nullptr)
-			throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDVARIABLETYPE, "variable " + iIter->second->getName() + " is not a double variable");
+		auto pVariable = findVariableByID(nVariableID);
+		if (pVariable->getType() != LibMCData::eParameterDataType::Double)
+			throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDVARIABLETYPE, "variable " + pVariable->getName() + " is not a double variable");
+		auto pDoubleVariable = static_cast<CStateJournalImplDoubleVariable*> (pVariable);
+
+		std::lock_guard<std::mutex> lockGuard(m_UpdateMutex);
 
 		uint64_t nNewTimeStamp = retrieveTimeStamp_MicroSecond();
 		m_nLifetimeInMicroseconds = nNewTimeStamp;
@@ -579,6 +612,14 @@ namespace AMC {
 
 	}
 
+	CStateJournalImplVariable* CStateJournalImpl::findVariableByID(const uint32_t nVariableID)
+	{
+		if ((nVariableID == 0) || (nVariableID > m_VariableList.size()))
+			throw ELibMCInterfaceException(LIBMC_ERROR_JOURNALVARIABLENOTFOUND, "journal variable ID " + std::to_string(nVariableID) + " not found");
+
+		return m_VariableList[(size_t)nVariableID - 1].get();
+	}
+
 	PStateJournalImplVariable CStateJournalImpl::findVariable(const std::string& sName)
 	{
 		auto iVariableIter = m_VariableStringMap.find(sName);
@@ -605,57 +646,66 @@ namespace AMC {
 	}
 
 
-	/*void CStateJournalImpl::readDoubleTimeStream(const std::string& sName, const sStateJournalInterval& interval, std::vector<sJournalTimeStreamDoubleEntry>& timeStream)
+	void CStateJournalImpl::sampleDoubleTimeStream(const std::string& sName, std::vector<sJournalTimeStreamDoubleEntry>& timeStream)
 	{
 		std::lock_guard<std::mutex> lockGuard(m_Mutex);
 		if (m_JournalMode != eStateJournalMode::sjmRecording)
 			throw ELibMCInterfaceException(LIBMC_ERROR_JOURNALISNOTRECORDING);
 
 		auto pVariable = findVariable(sName);
+		double dUnits = pVariable->getNumericUnits();
 
-		auto pDoubleVariable = std::dynamic_pointer_cast<CStateJournalImplDoubleVariable> (pVariable);
-		if (pDoubleVariable.get() != nullptr) {
-			pDoubleVariable->readTimeStream(interval, timeStream);
-			return;
-		}
+		std::vector<sJournalTimeStreamInt64Entry> integerTimeStream;
+		integerTimeStream.resize(timeStream.size());
+		for (size_t nIndex = 0; nIndex < timeStream.size(); nIndex++)
+			integerTimeStream[nIndex].m_nTimeStampInMicroSeconds = timeStream[nIndex].m_nTimeStampInMicroSeconds;
 
-		auto pIntegerVariable = std::dynamic_pointer_cast<CStateJournalImplIntegerVariable> (pVariable);
-		if (pIntegerVariable.get() != nullptr) {
-			std::vector<sJournalTimeStreamInt64Entry> intTimeStream;
-			pIntegerVariable->readTimeStream(interval, intTimeStream);
-
-			timeStream.resize(intTimeStream.size ());
-			for (size_t nIndex = 0; nIndex < intTimeStream.size(); nIndex++) {
-				auto& srcEntry = intTimeStream.at(nIndex);
-				auto& targetEntry = timeStream.at(nIndex);
-				targetEntry.m_nTimeStampInMicroSeconds = srcEntry.m_nTimeStampInMicroSeconds;
-				targetEntry.m_dValue = (double) srcEntry.m_nValue;
-			}
+		m_pStream->sampleIntegerTimeStream(pVariable->getStorageIndex(), integerTimeStream);
 
-			return;
-		}
+		for (size_t nIndex = 0; nIndex < timeStream.size(); nIndex++)
+			timeStream[nIndex].m_dValue = integerTimeStream[nIndex].m_nValue * dUnits;
+	}
 
-		auto pBoolVariable = std::dynamic_pointer_cast<CStateJournalImplBoolVariable> (pVariable);
-		if (pBoolVariable.get() != nullptr) {
-			std::vector<sJournalTimeStreamInt64Entry> intTimeStream;
-			pBoolVariable->readTimeStream(interval, intTimeStream);
-
-			timeStream.resize(intTimeStream.size());
-			for (size_t nIndex = 0; nIndex < intTimeStream.size(); nIndex++) {
-				auto& srcEntry = intTimeStream.at(nIndex);
-				auto& targetEntry = timeStream.at(nIndex);
-				targetEntry.m_nTimeStampInMicroSeconds = srcEntry.m_nTimeStampInMicroSeconds;
-				targetEntry.m_dValue = (double)srcEntry.m_nValue;
-			}
+	void CStateJournalImpl::readDoubleTimeStream(const std::string& sName, const sStateJournalInterval& interval, std::vector<sJournalTimeStreamDoubleEntry>& timeStream)
+	{
+		std::lock_guard<std::mutex> lockGuard(m_Mutex);
+		if (m_JournalMode != eStateJournalMode::sjmRecording)
+			throw ELibMCInterfaceException(LIBMC_ERROR_JOURNALISNOTRECORDING);
+
+		auto pVariable = findVariable(sName);
+		double dUnits = pVariable->getNumericUnits();
 
-			return;
+		std::vector<sJournalTimeStreamInt64Entry> integerTimeStream;
+		m_pStream->readRawIntegerData(pVariable->getStorageIndex(), interval.m_nStartTimeInMicroSeconds, interval.m_nEndTimeInMicroSeconds, integerTimeStream);
+
+		timeStream.resize(integerTimeStream.size());
+		for (size_t nIndex = 0; nIndex < integerTimeStream.size(); nIndex++) {
+			timeStream[nIndex].m_nTimeStampInMicroSeconds = integerTimeStream[nIndex].m_nTimeStampInMicroSeconds;
+			timeStream[nIndex].m_dValue = integerTimeStream[nIndex].m_nValue * dUnits;
 		}
+	}
 
+	void CStateJournalImpl::computeStatistics(const std::string& sName, const sStateJournalInterval& interval, sStateJournalStatistics& statistics)
+	{
+		std::lock_guard<std::mutex> lockGuard(m_Mutex);
+		if (m_JournalMode != eStateJournalMode::sjmRecording)
+			throw ELibMCInterfaceException(LIBMC_ERROR_JOURNALISNOTRECORDING);
+
+		auto pVariable = findVariable(sName);
+		double dUnits = pVariable->getNumericUnits();
 
-		throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDVARIABLETYPE, "variable " + pVariable->getName() + " is not a numeric variable");
+		// The current values are only known up to now
+		uint64_t nEndTimeStamp = std::min(interval.m_nEndTimeInMicroSeconds, retrieveTimeStamp_MicroSecond());
+		if (interval.m_nStartTimeInMicroSeconds >= nEndTimeStamp)
+			throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDJOURNALCOMPUTEINTERVAL, "invalid journal compute interval for " + sName);
 
+		sStateJournalChunkSummary summary;
+		m_pStream->computeSummary(pVariable->getStorageIndex(), interval.m_nStartTimeInMicroSeconds, nEndTimeStamp, summary);
 
-	} */
+		statistics.m_Interval.m_nStartTimeInMicroSeconds = interval.m_nStartTimeInMicroSeconds;
+		statistics.m_Interval.m_nEndTimeInMicroSeconds = nEndTimeStamp;
+		CStateJournalStreamChunk::summaryToStatistics(summary, dUnits, statistics);
+	}
 
 	std::string CStateJournalImpl::getStartTimeAsUTC()
 	{
@@ -788,6 +838,21 @@ namespace AMC {
 		return m_pImpl->computeSample(sName, nTimeStamp);
 	}
 
+	void CStateJournal::sampleDoubleTimeStream(const std::string& sName, std::vector<sJournalTimeStreamDoubleEntry>& timeStream)
+	{
+		m_pImpl->sampleDoubleTimeStream(sName, timeStream);
+	}
+
+	void CStateJournal::readDoubleTimeStream(const std::string& sName, const sStateJournalInterval& interval, std::vector<sJournalTimeStreamDoubleEntry>& timeStream)
+	{
+		m_pImpl->readDoubleTimeStream(sName, interval, timeStream);
+	}
+
+	void CStateJournal::computeStatistics(const std::string& sName, const sStateJournalInterval& interval, sStateJournalStatistics& statistics)
+	{
+		m_pImpl->computeStatistics(sName, interval, statistics);
+	}
+
 
 	void CStateJournal::registerAlias(const std::string& sName, const std::string& sSourceName)
 	{
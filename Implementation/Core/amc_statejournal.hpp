@@ -48,18 +48,6 @@ namespace AMC {
 	};
 
 
-	typedef struct _sStateJournalStatistics {
-		sStateJournalInterval m_Interval;
-
-		double m_dMinValue;
-		double m_dMaxValue;
-		double m_dAverageValue;
-		double m_dAverageSquaredValue;
-		double m_dVariance;
-
-	} sStateJournalStatistics;
-
-
 	class CStateJournal;
 	typedef std::shared_ptr<CStateJournal> PStateJournal;
 
@@ -89,11 +77,15 @@ namespace AMC {
 		void updateStringValue(const uint32_t nVariableID, const std::string& sValue);
 		void updateDoubleValue(const uint32_t nVariableID, const double dValue);
 
-		//void readDoubleTimeStream (const std::string& sName, const sStateJournalInterval& interval, std::vector<sJournalTimeStreamDoubleEntry>& timeStream);
+		double computeSample(const std::string& sName, const uint64_t nTimeStamp);
 
-		//sStateJournalStatistics computeStatistics (const std::string& sName, const sStateJournalInterval& interval);
+		// Fills in the values of a list of time stamps
+		void sampleDoubleTimeStream(const std::string& sName, std::vector<sJournalTimeStreamDoubleEntry>& timeStream);
 
-		double computeSample(const std::string& sName, const uint64_t nTimeStamp);
+		// Returns the value at the interval start and all value changes within the interval
+		void readDoubleTimeStream(const std::string& sName, const sStateJournalInterval& interval, std::vector<sJournalTimeStreamDoubleEntry>& timeStream);
+
+		void computeStatistics(const std::string& sName, const sStateJournalInterval& interval, sStateJournalStatistics& statistics);
 		
 		void registerAlias (const std::string& sName, const std::string& sSourceName);
 
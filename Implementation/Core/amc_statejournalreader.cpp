@@ -37,6 +37,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <iostream>
 #include <mutex>
 #include <cmath>
+#include <algorithm>
 
 namespace AMC {
 
@@ -106,6 +107,21 @@ namespace AMC {
 		return m_dUnits;
 	}
 
+	double CStateJournalReaderVariable::getNumericUnits()
+	{
+		switch (m_DataType) {
+		case LibMCData::eParameterDataType::Integer:
+		case LibMCData::eParameterDataType::Bool:
+			return 1.0;
+
+		case LibMCData::eParameterDataType::Double:
+			return m_dUnits;
+
+		default:
+			throw ELibMCCustomException(LIBMC_ERROR_JOURNALVARIABLEISNOTNUMERIC, m_sVariableName);
+		}
+	}
+
 
 
 	CStateJournalReaderChunk::CStateJournalReaderChunk(uint32_t nChunkIndex, uint64_t nStartTimeStamp, uint64_t nEndTimeStamp)
@@ -134,6 +150,28 @@ namespace AMC {
 		return m_nEndTimeStamp;
 	}
 
+	bool CStateJournalReaderChunk::isCoveredBy(uint64_t nStartTimeStamp, uint64_t nEndTimeStamp)
+	{
+		return (nStartTimeStamp <= m_nStartTimeStamp) && (nEndTimeStamp > m_nEndTimeStamp);
+	}
+
+	bool CStateJournalReaderChunk::mergeVariableSummary(uint32_t nStorageIndex, sStateJournalChunkSummary& summary)
+	{
+		std::lock_guard<std::mutex> lockGuard(m_SummaryMutex);
+		if (nStorageIndex >= m_VariableSummaries.size())
+			return false;
+
+		CStateJournalStreamChunk::mergeSummary(summary, m_VariableSummaries.at(nStorageIndex));
+		return true;
+	}
+
+	void CStateJournalReaderChunk::storeVariableSummaries(const std::vector<sStateJournalChunkSummary>& variableSummaries)
+	{
+		std::lock_guard<std::mutex> lockGuard(m_SummaryMutex);
+		if (m_VariableSummaries.empty())
+			m_VariableSummaries = variableSummaries;
+	}
+
 
 
 	CStateJournalReader::CStateJournalReader(LibMCData::PJournalReader pReader, uint64_t nMemoryQuota, PLogger pDebugLogger)
@@ -233,9 +271,7 @@ namespace AMC {
 
 		auto pChunk = findChunkForTimestamp(nTimeStamp);
 		if (pChunk.get() != nullptr) {
-			auto pEntry = m_pStreamCache->retrieveEntry(pChunk->getChunkIndex());
-			if (pEntry.get() == nullptr)
-				pEntry = m_pStreamCache->loadEntryFromJournal(pChunk->getChunkIndex());
+			auto pEntry = retrieveChunkData(pChunk);
 
 			int64_t nIntegerData = pEntry->sampleIntegerData(pVariable->getVariableIndex(), nTimeStamp);
 
@@ -264,9 +300,7 @@ namespace AMC {
 
 		auto pChunk = findChunkForTimestamp(nTimeStamp);
 		if (pChunk.get() != nullptr) {
-			auto pEntry = m_pStreamCache->retrieveEntry(pChunk->getChunkIndex());
-			if (pEntry.get() == nullptr)
-				pEntry = m_pStreamCache->loadEntryFromJournal(pChunk->getChunkIndex());
+			auto pEntry = retrieveChunkData(pChunk);
 
 			int64_t nIntegerData = pEntry->sampleIntegerData(pVariable->getVariableIndex(), nTimeStamp);
 
@@ -289,6 +323,94 @@ namespace AMC {
 		return 0;
 	}
 
+	void CStateJournalReader::sampleDoubleTimeStream(const std::string& sName, std::vector<sJournalTimeStreamDoubleEntry>& timeStream)
+	{
+		auto pVariable = findVariable(sName);
+		double dUnits = pVariable->getNumericUnits();
+		uint32_t nStorageIndex = pVariable->getVariableIndex();
+
+		PStateJournalReaderChunk pChunk;
+		PStateJournalStreamChunk_InMemory pEntry;
+
+		for (auto& entry : timeStream) {
+			uint64_t nTimeStamp = entry.m_nTimeStampInMicroSeconds;
+
+			// Consecutive time stamps usually fall into the same chunk
+			if ((pChunk.get() == nullptr) || (nTimeStamp < pChunk->getStartTimeStamp()) || (nTimeStamp > pChunk->getEndTimeStamp())) {
+				pChunk = findChunkForTimestamp(nTimeStamp);
+				pEntry = (pChunk.get() != nullptr) ? retrieveChunkData(pChunk) : nullptr;
+			}
+
+			if (pEntry.get() != nullptr)
+				entry.m_dValue = pEntry->sampleIntegerData(nStorageIndex, nTimeStamp) * dUnits;
+			else
+				entry.m_dValue = 0.0;
+		}
+	}
+
+	void CStateJournalReader::readDoubleTimeStream(const std::string& sName, const sStateJournalInterval& interval, std::vector<sJournalTimeStreamDoubleEntry>& timeStream)
+	{
+		auto pVariable = findVariable(sName);
+		double dUnits = pVariable->getNumericUnits();
+		uint32_t nStorageIndex = pVariable->getVariableIndex();
+
+		timeStream.clear();
+		if (interval.m_nStartTimeInMicroSeconds > interval.m_nEndTimeInMicroSeconds)
+			return;
+
+		std::vector<sJournalTimeStreamInt64Entry> chunkTimeStream;
+		for (size_t nChunkIndex = findFirstChunkIndexForTimestamp(interval.m_nStartTimeInMicroSeconds); nChunkIndex < m_Chunks.size(); nChunkIndex++) {
+			auto pChunk = m_Chunks.at(nChunkIndex);
+			if (pChunk->getStartTimeStamp() > interval.m_nEndTimeInMicroSeconds)
+				break;
+
+			chunkTimeStream.clear();
+			retrieveChunkData(pChunk)->readRawIntegerData(nStorageIndex, interval.m_nStartTimeInMicroSeconds, interval.m_nEndTimeInMicroSeconds, chunkTimeStream);
+
+			// Every chunk repeats the current values at its start, these are no value changes
+			for (auto& integerEntry : chunkTimeStream) {
+				double dValue = integerEntry.m_nValue * dUnits;
+				if ((!timeStream.empty()) && (timeStream.back().m_dValue == dValue))
+					continue;
+
+				sJournalTimeStreamDoubleEntry entry;
+				entry.m_nTimeStampInMicroSeconds = integerEntry.m_nTimeStampInMicroSeconds;
+				entry.m_dValue = dValue;
+				timeStream.push_back(entry);
+			}
+		}
+	}
+
+	void CStateJournalReader::computeStatistics(const std::string& sName, const sStateJournalInterval& interval, sStateJournalStatistics& statistics)
+	{
+		auto pVariable = findVariable(sName);
+		double dUnits = pVariable->getNumericUnits();
+		uint32_t nStorageIndex = pVariable->getVariableIndex();
+
+		if (interval.m_nStartTimeInMicroSeconds >= interval.m_nEndTimeInMicroSeconds)
+			throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDJOURNALCOMPUTEINTERVAL, "invalid journal compute interval for " + sName);
+
+		sStateJournalChunkSummary summary;
+		CStateJournalStreamChunk::clearSummary(summary);
+
+		for (size_t nChunkIndex = findFirstChunkIndexForTimestamp(interval.m_nStartTimeInMicroSeconds); nChunkIndex < m_Chunks.size(); nChunkIndex++) {
+			auto pChunk = m_Chunks.at(nChunkIndex);
+			if (pChunk->getStartTimeStamp() >= interval.m_nEndTimeInMicroSeconds)
+				break;
+
+			bool bCovered = pChunk->isCoveredBy(interval.m_nStartTimeInMicroSeconds, interval.m_nEndTimeInMicroSeconds);
+			if (bCovered && pChunk->mergeVariableSummary(nStorageIndex, summary))
+				continue;
+
+			auto pChunkData = retrieveChunkData(pChunk);
+			pChunk->storeVariableSummaries(pChunkData->getVariableSummaries());
+			pChunkData->computeSummary(nStorageIndex, interval.m_nStartTimeInMicroSeconds, interval.m_nEndTimeInMicroSeconds, summary);
+		}
+
+		statistics.m_Interval = interval;
+		CStateJournalStreamChunk::summaryToStatistics(summary, dUnits, statistics);
+	}
+
 	std::string CStateJournalReader::getStartTimeAsUTC()
 	{
 		std::lock_guard<std::mutex> lockGuard(m_JournalReaderMutex);
@@ -309,6 +431,24 @@ namespace AMC {
 
 	}
 
+	PStateJournalStreamChunk_InMemory CStateJournalReader::retrieveChunkData(PStateJournalReaderChunk pChunk)
+	{
+		auto pEntry = m_pStreamCache->retrieveEntry(pChunk->getChunkIndex());
+		if (pEntry.get() == nullptr)
+			pEntry = m_pStreamCache->loadEntryFromJournal(pChunk->getChunkIndex());
+
+		return pEntry;
+	}
+
+	size_t CStateJournalReader::findFirstChunkIndexForTimestamp(uint64_t targetTimestamp)
+	{
+		auto iIter = std::lower_bound(m_Chunks.begin(), m_Chunks.end(), targetTimestamp, [](const PStateJournalReaderChunk& pChunk, uint64_t nTimestamp) {
+			return pChunk->getEndTimeStamp() < nTimestamp;
+		});
+
+		return (size_t)(iIter - m_Chunks.begin());
+	}
+
 	PStateJournalReaderChunk CStateJournalReader::findChunkForTimestamp(uint64_t targetTimestamp) 
 	{
 
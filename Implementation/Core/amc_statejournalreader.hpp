@@ -88,6 +88,9 @@ namespace AMC {
 
 		double getUnits();
 
+		// Factor between the recorded integer values and the numeric value. Fails for non-numeric variables.
+		double getNumericUnits();
+
 	};
 
 	typedef std::shared_ptr<CStateJournalReaderVariable> PStateJournalReaderVariable;
@@ -99,6 +102,10 @@ namespace AMC {
 		uint64_t m_nStartTimeStamp;
 		uint64_t m_nEndTimeStamp;
 
+		// Full chunk summaries, kept after the chunk data has been loaded once so that they survive cache eviction
+		std::mutex m_SummaryMutex;
+		std::vector<sStateJournalChunkSummary> m_VariableSummaries;
+
 	public:
 
 		CStateJournalReaderChunk(uint32_t nChunkIndex, uint64_t nStartTimeStamp, uint64_t nEndTimeStamp);
@@ -111,6 +118,14 @@ namespace AMC {
 
 		uint64_t getEndTimeStamp ();
 
+		// Returns true if the chunk covers [nStartTimeStamp, nEndTimeStamp) completely.
+		bool isCoveredBy (uint64_t nStartTimeStamp, uint64_t nEndTimeStamp);
+
+		// Merges the stored full chunk summary of a variable. Returns false if the chunk data has not been loaded yet.
+		bool mergeVariableSummary (uint32_t nStorageIndex, sStateJournalChunkSummary& summary);
+
+		void storeVariableSummaries (const std::vector<sStateJournalChunkSummary>& variableSummaries);
+
 	};
 
 	typedef std::shared_ptr<CStateJournalReaderChunk> PStateJournalReaderChunk;
@@ -131,6 +146,11 @@ namespace AMC {
 
 		PStateJournalReaderChunk findChunkForTimestamp(uint64_t targetTimestamp);
 
+		// Returns the index of the first chunk that ends at or after the timestamp
+		size_t findFirstChunkIndexForTimestamp(uint64_t targetTimestamp);
+
+		PStateJournalStreamChunk_InMemory retrieveChunkData(PStateJournalReaderChunk pChunk);
+
 		PStateJournalReaderVariable findVariable(const std::string & sVariableOrAliasName);
 
 	public:
@@ -143,6 +163,14 @@ namespace AMC {
 
 		int64_t computeIntegerSample(const std::string& sName, const uint64_t nTimeStamp);
 
+		// Fills in the values of a list of time stamps
+		void sampleDoubleTimeStream(const std::string& sName, std::vector<sJournalTimeStreamDoubleEntry>& timeStream);
+
+		// Returns the value at the interval start and all value changes within the interval
+		void readDoubleTimeStream(const std::string& sName, const sStateJournalInterval& interval, std::vector<sJournalTimeStreamDoubleEntry>& timeStream);
+
+		void computeStatistics(const std::string& sName, const sStateJournalInterval& interval, sStateJournalStatistics& statistics);
+
 		std::string getStartTimeAsUTC();
 
 		uint64_t getLifeTimeInMicroseconds();
@@ -38,6 +38,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 
 #include <stdexcept>
+#include <chrono>
+#include <thread>
 
 
 namespace AMC {
@@ -110,8 +112,74 @@ namespace AMC {
 
 
 
+	CStateJournalStreamChunkQueue::CStateJournalStreamChunkQueue(size_t nCapacity)
+		: m_nWriteCount (0), m_nReadCount (0)
+	{
+		if (nCapacity == 0)
+			throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDPARAM);
+
+		m_Slots.resize(nCapacity);
+	}
+
+	CStateJournalStreamChunkQueue::~CStateJournalStreamChunkQueue()
+	{
+
+	}
+
+	bool CStateJournalStreamChunkQueue::push(PStateJournalStreamChunk_Dynamic pChunk)
+	{
+		if (pChunk.get() == nullptr)
+			throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDPARAM);
+
+		uint64_t nWriteCount = m_nWriteCount.load(std::memory_order_relaxed);
+		uint64_t nReadCount = m_nReadCount.load(std::memory_order_acquire);
+		if ((nWriteCount - nReadCount) >= m_Slots.size())
+			return false;
+
+		m_Slots.at(nWriteCount % m_Slots.size()) = pChunk;
+		m_nWriteCount.store(nWriteCount + 1, std::memory_order_release);
+
+		return true;
+	}
+
+	PStateJournalStreamChunk_Dynamic CStateJournalStreamChunkQueue::pop()
+	{
+		uint64_t nReadCount = m_nReadCount.load(std::memory_order_relaxed);
+		uint64_t nWriteCount = m_nWriteCount.load(std::memory_order_acquire);
+		if (nReadCount == nWriteCount)
+			return nullptr;
+
+		auto& slot = m_Slots.at(nReadCount % m_Slots.size());
+		PStateJournalStreamChunk_Dynamic pChunk = std::move(slot);
+		slot = nullptr;
+
+		m_nReadCount.store(nReadCount + 1, std::memory_order_release);
+
+		return pChunk;
+	}
+
+	bool CStateJournalStreamChunkQueue::isEmpty()
+	{
+		return m_nReadCount.load(std::memory_order_acquire) == m_nWriteCount.load(std::memory_order_acquire);
+	}
+
+	size_t CStateJournalStreamChunkQueue::getCount()
+	{
+		uint64_t nReadCount = m_nReadCount.load(std::memory_order_acquire);
+		uint64_t nWriteCount = m_nWriteCount.load(std::memory_order_acquire);
+		return (size_t)(nWriteCount - nReadCount);
+	}
+
+	size_t CStateJournalStreamChunkQueue::getCapacity()
+	{
+		return m_Slots.size();
+	}
+
+
+
+
 	CStateJournalStream::CStateJournalStream(LibMCData::PJournalSession pJournalSession, PLogger pDebugLogger, bool bEnableDebugLogging)
-		: m_nChunkIntervalInMicroseconds(0), m_nCurrentTimeStampInMicroseconds (0)
+		: m_nChunkIntervalInMicroseconds(0), m_nCurrentTimeStampInMicroseconds (0), m_ChunksToSerialize (STATEJOURNALSTREAM_CHUNKQUEUECAPACITY), m_bHasOverflowChunks (false)
 	{
 		if (pJournalSession.get() == nullptr)
 			throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDPARAM);
@@ -159,18 +227,19 @@ namespace AMC {
 
 		auto pNewChunk = std::make_shared <CStateJournalStreamChunk_Dynamic>(nNewChunkIndex, nNewChunkStart, nNewChunkEnd, (uint32_t)m_CurrentVariableValues.size (), m_pDebugLogger);
 
+		// Finished chunks should always be properly serialized in memory.
+		// The handoff to the recording thread does not need the chunk change mutex.
+		if (m_pCurrentChunk.get() != nullptr) {
+			queueChunkForSerialization(m_pCurrentChunk);
+			m_pCurrentChunk = nullptr;
+		}
+
 		std::lock_guard<std::mutex> lockGuard(m_ChunkChangeMutex);
 
 		// Determine new chunk index. Timeline should always increase
 		if (nNewChunkIndex < m_ChunkTimeline.size())
 			throw ELibMCInterfaceException(LIBMC_ERROR_CHUNKTIMESTREAMNOTCONTINUOUS);
 
-		// Finished chunks should always be properly serialized in memory
-		if (m_pCurrentChunk.get() != nullptr) {
-			m_ChunksToSerialize.push(m_pCurrentChunk);
-			m_pCurrentChunk = nullptr;
-		}
-
 		// Assign current chunk
 		m_pCurrentChunk = pNewChunk;
 
@@ -192,8 +261,23 @@ namespace AMC {
 
 	}
 
+	void CStateJournalStream::queueChunkForSerialization(PStateJournalStreamChunk_Dynamic pChunk)
+	{
+		// Writers never wait for the recording thread: if it falls behind, chunks are kept in the overflow list instead.
+		if (!m_bHasOverflowChunks.load(std::memory_order_acquire)) {
+			if (m_ChunksToSerialize.push(pChunk))
+				return;
+		}
+
+		std::lock_guard<std::mutex> lockGuard(m_OverflowChunksMutex);
+		m_OverflowChunks.push_back(pChunk);
+		m_bHasOverflowChunks.store(true, std::memory_order_release);
+	}
+
 	void CStateJournalStream::writeBool_MicroSecond(const uint64_t nAbsoluteTimeStampInMicroSeconds, const uint32_t nStorageIndex, bool bValue)
 	{
+		std::lock_guard<std::mutex> lockGuard(m_CurrentChunkMutex);
+
 		ensureChunk(nAbsoluteTimeStampInMicroSeconds);
 
 		if (bValue) {
@@ -210,6 +294,8 @@ namespace AMC {
 
 	void CStateJournalStream::writeInt64_MicroSecond(const uint64_t nAbsoluteTimeStampInMicroSeconds, const uint32_t nStorageIndex, int64_t nValue)
 	{
+		std::lock_guard<std::mutex> lockGuard(m_CurrentChunkMutex);
+
 		ensureChunk(nAbsoluteTimeStampInMicroSeconds);
 
 		m_pCurrentChunk->writeEntry(nStorageIndex, nAbsoluteTimeStampInMicroSeconds, nValue);
@@ -219,6 +305,8 @@ namespace AMC {
 	
 	void CStateJournalStream::writeDouble_MicroSecond(const uint64_t nAbsoluteTimeStampInMicroSeconds, const uint32_t nStorageIndex, int64_t nValue)
 	{
+		std::lock_guard<std::mutex> lockGuard(m_CurrentChunkMutex);
+
 		ensureChunk(nAbsoluteTimeStampInMicroSeconds);
 
 		m_pCurrentChunk->writeEntry(nStorageIndex, nAbsoluteTimeStampInMicroSeconds, nValue);
@@ -228,12 +316,25 @@ namespace AMC {
 
 	void CStateJournalStream::serializeChunksThreaded()
 	{
-		while (!m_ChunksToSerialize.empty()) {
-			PStateJournalStreamChunk_Dynamic pChunkToSerialize;
-			{
-				std::lock_guard<std::mutex> lockGuard(m_ChunkChangeMutex);
-				pChunkToSerialize = m_ChunksToSerialize.front();
-				m_ChunksToSerialize.pop();
+		std::list<PStateJournalStreamChunk_Dynamic> overflowChunks;
+
+		while (true) {
+			PStateJournalStreamChunk_Dynamic pChunkToSerialize = m_ChunksToSerialize.pop();
+			if (pChunkToSerialize.get() == nullptr) {
+
+				// Overflowed chunks are newer than all chunks of the queue, and writers do not use the queue
+				// again before the overflow list has been taken over.
+				if (overflowChunks.empty() && m_bHasOverflowChunks.load(std::memory_order_acquire)) {
+					std::lock_guard<std::mutex> lockGuard(m_OverflowChunksMutex);
+					overflowChunks.swap(m_OverflowChunks);
+					m_bHasOverflowChunks.store(false, std::memory_order_release);
+				}
+
+				if (overflowChunks.empty())
+					break;
+
+				pChunkToSerialize = overflowChunks.front();
+				overflowChunks.pop_front();
 			}
 
 			auto pMemoryChunk = std::make_shared<CStateJournalStreamChunk_InMemory>(pChunkToSerialize.get (), m_pDebugLogger);
@@ -267,7 +368,7 @@ namespace AMC {
 				m_Cache->writeToJournal (pChunkToWrite);
 
 				// Push disk chunk to the archive queue
-				auto pOnDiskChunk = std::make_shared<CStateJournalStreamChunk_OnDisk>(pChunkToWrite->getStartTimeStampInMicroSeconds(), pChunkToWrite->getEndTimeStampInMicroSeconds(), pChunkToWrite->getChunkIndex(), m_Cache, m_pDebugLogger);
+				auto pOnDiskChunk = std::make_shared<CStateJournalStreamChunk_OnDisk>(pChunkToWrite->getStartTimeStampInMicroSeconds(), pChunkToWrite->getEndTimeStampInMicroSeconds(), pChunkToWrite->getChunkIndex(), m_Cache, pChunkToWrite->getVariableSummaries(), m_pDebugLogger);
 				m_ChunksToArchive.push(pOnDiskChunk);
 
 				m_ChunkTimeline.at(pChunkToWrite->getChunkIndex()) = pOnDiskChunk;
@@ -282,13 +383,9 @@ namespace AMC {
 	int64_t CStateJournalStream::sampleIntegerData(const uint32_t nStorageIndex, const uint64_t nAbsoluteTimeStampInMicroseconds)
 	{
 		uint64_t nChunkIndex = nAbsoluteTimeStampInMicroseconds / m_nChunkIntervalInMicroseconds;
-		uint64_t nChunkCount = m_ChunkTimeline.size();
 
-		PStateJournalStreamChunk pChunk;
-		if (nChunkIndex < nChunkCount) {
-			std::lock_guard<std::mutex> lockGuard(m_ChunkChangeMutex);
-			pChunk = m_ChunkTimeline.at(nChunkIndex);
-		}
+		PStateJournalStreamChunk pChunk = retrieveChunk(nChunkIndex);
+		auto currentChunkLock = lockIfCurrentChunk(pChunk);
 
 		if (pChunk.get() != nullptr)
 			return pChunk->sampleIntegerData(nStorageIndex, nAbsoluteTimeStampInMicroseconds);
@@ -299,13 +396,9 @@ namespace AMC {
 	double CStateJournalStream::sampleDoubleData(const uint32_t nStorageIndex, const uint64_t nAbsoluteTimeStampInMicroseconds, double dUnits)
 	{
 		uint64_t nChunkIndex = nAbsoluteTimeStampInMicroseconds / m_nChunkIntervalInMicroseconds;
-		uint64_t nChunkCount = m_ChunkTimeline.size();
 
-		PStateJournalStreamChunk pChunk;
-		if (nChunkIndex < nChunkCount) {
-			std::lock_guard<std::mutex> lockGuard(m_ChunkChangeMutex);
-			pChunk = m_ChunkTimeline.at(nChunkIndex);
-		}
+		PStateJournalStreamChunk pChunk = retrieveChunk(nChunkIndex);
+		auto currentChunkLock = lockIfCurrentChunk(pChunk);
 
 		if (pChunk.get() != nullptr)
 			return pChunk->sampleIntegerData(nStorageIndex, nAbsoluteTimeStampInMicroseconds) * dUnits;
@@ -316,13 +409,9 @@ namespace AMC {
 	bool CStateJournalStream::sampleBoolData(const uint32_t nStorageIndex, const uint64_t nAbsoluteTimeStampInMicroseconds)
 	{
 		uint64_t nChunkIndex = nAbsoluteTimeStampInMicroseconds / m_nChunkIntervalInMicroseconds;
-		uint64_t nChunkCount = m_ChunkTimeline.size();
 
-		PStateJournalStreamChunk pChunk;
-		if (nChunkIndex < nChunkCount) {
-			std::lock_guard<std::mutex> lockGuard(m_ChunkChangeMutex);
-			pChunk = m_ChunkTimeline.at(nChunkIndex);
-		}
+		PStateJournalStreamChunk pChunk = retrieveChunk(nChunkIndex);
+		auto currentChunkLock = lockIfCurrentChunk(pChunk);
 
 		if (pChunk.get() != nullptr)
 			return pChunk->sampleIntegerData(nStorageIndex, nAbsoluteTimeStampInMicroseconds) != 0;
@@ -333,6 +422,98 @@ namespace AMC {
 
 
 
+	PStateJournalStreamChunk CStateJournalStream::retrieveChunk(const uint64_t nChunkIndex)
+	{
+		std::lock_guard<std::mutex> lockGuard(m_ChunkChangeMutex);
+		if (nChunkIndex < m_ChunkTimeline.size())
+			return m_ChunkTimeline.at(nChunkIndex);
+
+		return nullptr;
+	}
+
+	std::unique_lock<std::mutex> CStateJournalStream::lockIfCurrentChunk(PStateJournalStreamChunk& pChunk)
+	{
+		// Finished chunks are never written again, so only the current chunk needs to exclude the writer
+		std::unique_lock<std::mutex> currentChunkLock(m_CurrentChunkMutex);
+		if (pChunk.get() != m_pCurrentChunk.get())
+			currentChunkLock.unlock();
+
+		return currentChunkLock;
+	}
+
+	void CStateJournalStream::sampleIntegerTimeStream(const uint32_t nStorageIndex, std::vector<sJournalTimeStreamInt64Entry>& timeStream)
+	{
+		PStateJournalStreamChunk pChunk;
+		std::unique_lock<std::mutex> currentChunkLock;
+		uint64_t nCurrentChunkIndex = 0;
+		bool bHasChunk = false;
+
+		for (auto& entry : timeStream) {
+			uint64_t nChunkIndex = entry.m_nTimeStampInMicroSeconds / m_nChunkIntervalInMicroseconds;
+			if ((!bHasChunk) || (nChunkIndex != nCurrentChunkIndex)) {
+				if (currentChunkLock.owns_lock())
+					currentChunkLock.unlock();
+
+				pChunk = retrieveChunk(nChunkIndex);
+				currentChunkLock = lockIfCurrentChunk(pChunk);
+				nCurrentChunkIndex = nChunkIndex;
+				bHasChunk = true;
+			}
+
+			if (pChunk.get() != nullptr)
+				entry.m_nValue = pChunk->sampleIntegerData(nStorageIndex, entry.m_nTimeStampInMicroSeconds);
+			else
+				entry.m_nValue = 0;
+		}
+	}
+
+	void CStateJournalStream::computeSummary(const uint32_t nStorageIndex, const uint64_t nStartTimeStampInMicroseconds, const uint64_t nEndTimeStampInMicroseconds, sStateJournalChunkSummary& summary)
+	{
+		CStateJournalStreamChunk::clearSummary(summary);
+		if (nStartTimeStampInMicroseconds >= nEndTimeStampInMicroseconds)
+			return;
+
+		uint64_t nFirstChunkIndex = nStartTimeStampInMicroseconds / m_nChunkIntervalInMicroseconds;
+		uint64_t nLastChunkIndex = (nEndTimeStampInMicroseconds - 1) / m_nChunkIntervalInMicroseconds;
+
+		for (uint64_t nChunkIndex = nFirstChunkIndex; nChunkIndex <= nLastChunkIndex; nChunkIndex++) {
+			auto pChunk = retrieveChunk(nChunkIndex);
+			auto currentChunkLock = lockIfCurrentChunk(pChunk);
+			if (pChunk.get() != nullptr)
+				pChunk->computeSummary(nStorageIndex, nStartTimeStampInMicroseconds, nEndTimeStampInMicroseconds, summary);
+		}
+	}
+
+	void CStateJournalStream::readRawIntegerData(const uint32_t nStorageIndex, const uint64_t nStartTimeStampInMicroseconds, const uint64_t nEndTimeStampInMicroseconds, std::vector<sJournalTimeStreamInt64Entry>& timeStream)
+	{
+		timeStream.clear();
+		if (nStartTimeStampInMicroseconds > nEndTimeStampInMicroseconds)
+			return;
+
+		uint64_t nFirstChunkIndex = nStartTimeStampInMicroseconds / m_nChunkIntervalInMicroseconds;
+		uint64_t nLastChunkIndex = nEndTimeStampInMicroseconds / m_nChunkIntervalInMicroseconds;
+
+		std::vector<sJournalTimeStreamInt64Entry> chunkTimeStream;
+		for (uint64_t nChunkIndex = nFirstChunkIndex; nChunkIndex <= nLastChunkIndex; nChunkIndex++) {
+			auto pChunk = retrieveChunk(nChunkIndex);
+			if (pChunk.get() == nullptr)
+				continue;
+
+			chunkTimeStream.clear();
+			{
+				auto currentChunkLock = lockIfCurrentChunk(pChunk);
+				pChunk->readRawIntegerData(nStorageIndex, nStartTimeStampInMicroseconds, nEndTimeStampInMicroseconds, chunkTimeStream);
+			}
+
+			// Every chunk repeats the current values at its start, these are no value changes
+			for (auto& entry : chunkTimeStream) {
+				if ((!timeStream.empty()) && (timeStream.back().m_nValue == entry.m_nValue))
+					continue;
+				timeStream.push_back(entry);
+			}
+		}
+	}
+
 	void CStateJournalStream::setVariableCount(size_t nVariableCount)
 	{
 		m_CurrentVariableValues.resize (nVariableCount);
@@ -341,6 +522,14 @@ namespace AMC {
 
 	}
 
+	bool CStateJournalStream::needsSerialization()
+	{
+		if (m_bHasOverflowChunks.load(std::memory_order_acquire))
+			return true;
+
+		return m_ChunksToSerialize.getCount() * 2 >= m_ChunksToSerialize.getCapacity();
+	}
+
 	PStateJournalStreamCache_Current CStateJournalStream::getCache()
 	{
 		return m_Cache;
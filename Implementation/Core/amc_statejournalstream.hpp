@@ -40,6 +40,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <map>
 #include <queue>
 #include <unordered_map>
+#include <atomic>
 #include "amc_logger.hpp"
 
 #include "Common/common_exportstream_native.hpp"
@@ -47,6 +48,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "amc_statejournalstreamcache.hpp"
 
+#define STATEJOURNALSTREAM_CHUNKQUEUECAPACITY 256
+
 
 namespace AMC {
 
@@ -84,10 +87,48 @@ namespace AMC {
 	typedef std::shared_ptr<CStateJournalStreamCache_Current> PStateJournalStreamCache_Current;
 
 
+	// Single producer / single consumer ring buffer that hands finished dynamic chunks over
+	// to the recording thread. The producer side is not thread safe on its own: all writers
+	// are serialized by the current chunk mutex of the stream. The ring only spares the
+	// recording thread from taking that mutex.
+	class CStateJournalStreamChunkQueue
+	{
+	private:
+
+		std::vector<PStateJournalStreamChunk_Dynamic> m_Slots;
+
+		// Monotonic counters, only written by the producer respectively the consumer
+		std::atomic<uint64_t> m_nWriteCount;
+		std::atomic<uint64_t> m_nReadCount;
+
+	public:
+
+		CStateJournalStreamChunkQueue(size_t nCapacity);
+
+		virtual ~CStateJournalStreamChunkQueue();
+
+		// Must only be called from the producer thread. Returns false if the queue is full.
+		bool push(PStateJournalStreamChunk_Dynamic pChunk);
+
+		// Must only be called from the consumer thread. Returns nullptr if the queue is empty.
+		PStateJournalStreamChunk_Dynamic pop();
+
+		bool isEmpty();
+
+		size_t getCount();
+
+		size_t getCapacity();
+
+	};
+
+
 	class CStateJournalStream
 	{
 	private:
 		std::mutex m_ChunkChangeMutex;
+
+		// Held by the writer for every write, and by readers only while they read the current chunk.
+		std::mutex m_CurrentChunkMutex;
 		PStateJournalStreamChunk_Dynamic m_pCurrentChunk;
 
 		// Optional Debug logger, maybe optional
@@ -100,7 +141,13 @@ namespace AMC {
 		std::vector<PStateJournalStreamChunk> m_ChunkTimeline;
 
 		// Queue that holds all chunks that should be serialized in memory
-		std::queue<PStateJournalStreamChunk_Dynamic> m_ChunksToSerialize;
+		CStateJournalStreamChunkQueue m_ChunksToSerialize;
+
+		// Finished chunks that did not fit into the serialization queue. Once a chunk overflowed, all
+		// further chunks are appended here until the recording thread drained the list, which keeps the chunks in order.
+		std::mutex m_OverflowChunksMutex;
+		std::list<PStateJournalStreamChunk_Dynamic> m_OverflowChunks;
+		std::atomic<bool> m_bHasOverflowChunks;
 
 		// Queue that holds all chunks that are serialized in memory but have not been written to disk.
 		std::queue<PStateJournalStreamChunk_InMemory> m_ChunksToWrite;
@@ -114,8 +161,15 @@ namespace AMC {
 		std::vector<uint64_t> m_CurrentVariableValues;
 
 		void startNewChunk(const uint64_t nAbsoluteTimeStampInMicroseconds);
+		void queueChunkForSerialization(PStateJournalStreamChunk_Dynamic pChunk);
 		void ensureChunk(const uint64_t nAbsoluteTimeStampInMicroseconds);
 
+		// Returns the chunk of the timeline, or nullptr if the chunk does not exist.
+		PStateJournalStreamChunk retrieveChunk(const uint64_t nChunkIndex);
+
+		// Returns a lock of the current chunk mutex, if the chunk is still being written. Otherwise the lock is not owned.
+		std::unique_lock<std::mutex> lockIfCurrentChunk(PStateJournalStreamChunk& pChunk);
+
 	public:
 		CStateJournalStream(LibMCData::PJournalSession pJournalSession, PLogger pDebugLogger, bool bEnableDebugLogging);
 		virtual ~CStateJournalStream();
@@ -128,12 +182,24 @@ namespace AMC {
 		double sampleDoubleData(const uint32_t nStorageIndex, const uint64_t nAbsoluteTimeStampInMicroseconds, double dUnits);
 		bool sampleBoolData(const uint32_t nStorageIndex, const uint64_t nAbsoluteTimeStampInMicroseconds);
 
+		// Samples a variable at a sorted list of time stamps, looking up each chunk only once.
+		void sampleIntegerTimeStream(const uint32_t nStorageIndex, std::vector<sJournalTimeStreamInt64Entry>& timeStream);
+
+		// Aggregates a variable over [nStartTimeStamp, nEndTimeStamp) in raw integer units.
+		void computeSummary(const uint32_t nStorageIndex, const uint64_t nStartTimeStampInMicroseconds, const uint64_t nEndTimeStampInMicroseconds, sStateJournalChunkSummary& summary);
+
+		// Returns the value at nStartTimeStamp and all value changes until nEndTimeStamp (inclusive).
+		void readRawIntegerData(const uint32_t nStorageIndex, const uint64_t nStartTimeStampInMicroseconds, const uint64_t nEndTimeStampInMicroseconds, std::vector<sJournalTimeStreamInt64Entry>& timeStream);
+
 		// Threaded function to write chunk buffers to disk!
 		void serializeChunksThreaded();
 		void writeChunksToDiskThreaded();
 
 		void setVariableCount (size_t nVariableCount);
 
+		// Returns true if the serialization queue is half full or has overflowed, and the recording thread should not wait for its next interval.
+		bool needsSerialization();
+
 		PStateJournalStreamCache_Current getCache ();
 	};
 	typedef std::shared_ptr<CStateJournalStream> PStateJournalStream;
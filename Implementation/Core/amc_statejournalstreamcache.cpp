@@ -38,6 +38,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 
 #include <stdexcept>
+#include <algorithm>
 
 #define STATEJOURNALSTREAMMINCAPACITY 65536
 
@@ -48,14 +49,81 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 namespace AMC {
 
 
+	// Merges the aggregate of a column between two relative timestamps into a summary.
+	static void summarizeColumn(const uint32_t* pTimeStamps, const int64_t* pValues, size_t nCount, uint64_t nRelativeStartTime, uint64_t nRelativeEndTime, sStateJournalChunkSummary& summary)
+	{
+		if ((nCount == 0) || (nRelativeStartTime >= nRelativeEndTime))
+			return;
+
+		// Find the entry that is valid at the start time. Times before the first entry take the first value.
+		size_t nIndex = (size_t) (std::upper_bound(pTimeStamps, pTimeStamps + nCount, (uint32_t)nRelativeStartTime) - pTimeStamps);
+		if (nIndex > 0)
+			nIndex--;
+
+		sStateJournalChunkSummary columnSummary;
+		CStateJournalStreamChunk::clearSummary(columnSummary);
+
+		uint64_t nSegmentStart = nRelativeStartTime;
+		for (; nIndex < nCount; nIndex++) {
+			uint64_t nSegmentEnd = nRelativeEndTime;
+			if ((nIndex + 1 < nCount) && (pTimeStamps[nIndex + 1] < nSegmentEnd))
+				nSegmentEnd = pTimeStamps[nIndex + 1];
+
+			if (nSegmentEnd > nSegmentStart) {
+				int64_t nValue = pValues[nIndex];
+				double dDuration = (double)(nSegmentEnd - nSegmentStart);
+
+				if ((columnSummary.m_nDurationInMicroSeconds == 0) || (nValue < columnSummary.m_nMinValue))
+					columnSummary.m_nMinValue = nValue;
+				if ((columnSummary.m_nDurationInMicroSeconds == 0) || (nValue > columnSummary.m_nMaxValue))
+					columnSummary.m_nMaxValue = nValue;
+
+				columnSummary.m_dIntegral += (double)nValue * dDuration;
+				columnSummary.m_dSquaredIntegral += (double)nValue * (double)nValue * dDuration;
+				columnSummary.m_nDurationInMicroSeconds += (nSegmentEnd - nSegmentStart);
+			}
+
+			if (nSegmentEnd >= nRelativeEndTime)
+				break;
+
+			nSegmentStart = nSegmentEnd;
+		}
+
+		CStateJournalStreamChunk::mergeSummary(summary, columnSummary);
+	}
+
+	// Appends the value valid at the start time and all entries up to the end time (inclusive) of a column.
+	static void readColumn(const uint32_t* pTimeStamps, const int64_t* pValues, size_t nCount, uint64_t nChunkStartTime, uint64_t nRelativeStartTime, uint64_t nRelativeEndTime, std::vector<sJournalTimeStreamInt64Entry>& timeStream)
+	{
+		if ((nCount == 0) || (nRelativeStartTime > nRelativeEndTime))
+			return;
+
+		size_t nIndex = (size_t)(std::upper_bound(pTimeStamps, pTimeStamps + nCount, (uint32_t)nRelativeStartTime) - pTimeStamps);
+
+		sJournalTimeStreamInt64Entry startEntry;
+		startEntry.m_nTimeStampInMicroSeconds = nChunkStartTime + nRelativeStartTime;
+		startEntry.m_nValue = (nIndex > 0) ? pValues[nIndex - 1] : pValues[0];
+		timeStream.push_back(startEntry);
+
+		for (; (nIndex < nCount) && (pTimeStamps[nIndex] <= nRelativeEndTime); nIndex++) {
+			sJournalTimeStreamInt64Entry entry;
+			entry.m_nTimeStampInMicroSeconds = nChunkStartTime + pTimeStamps[nIndex];
+			entry.m_nValue = pValues[nIndex];
+			timeStream.push_back(entry);
+		}
+	}
 
 
 	// Constructor: Initializes chunk with given index, start/end timestamps, and number of variables
 	CStateJournalStreamChunk_Dynamic::CStateJournalStreamChunk_Dynamic(uint64_t nChunkIndex, uint64_t nStartTimeStampInMicroSeconds, uint64_t nEndTimeStampInMicroSeconds, uint32_t nVariableCount, AMC::PLogger pDebugLogger)
-		: CStateJournalStreamChunk(pDebugLogger), m_nChunkIndex(nChunkIndex), m_nStartTimeStampInMicroSeconds(nStartTimeStampInMicroSeconds), m_nEndTimeStampInMicroSeconds(nEndTimeStampInMicroSeconds), m_nCurrentTimeStampInMicroSeconds(nStartTimeStampInMicroSeconds)
+		: CStateJournalStreamChunk(pDebugLogger), m_nChunkIndex(nChunkIndex), m_nStartTimeStampInMicroSeconds(nStartTimeStampInMicroSeconds), m_nEndTimeStampInMicroSeconds(nEndTimeStampInMicroSeconds), m_nCurrentTimeStampInMicroSeconds(nStartTimeStampInMicroSeconds), m_nEntryCount (0)
 	{
-		// Resize the data vector to hold maps for the specified number of variables
-		m_Data.resize(nVariableCount);
+		// Create one column per variable and reserve some room to avoid early reallocations
+		m_Columns.resize(nVariableCount);
+		for (auto& column : m_Columns) {
+			column.m_TimeStamps.reserve(STATEJOURNALSTORAGE_COLUMNINITIALCAPACITY);
+			column.m_Values.reserve(STATEJOURNALSTORAGE_COLUMNINITIALCAPACITY);
+		}
 
 		debugLog("created dynamic chunk " + std::to_string(m_nChunkIndex));
 	}
@@ -97,31 +165,58 @@ namespace AMC {
 		uint64_t nRelativeTime = nAbsoluteTimeStampInMicroseconds - m_nStartTimeStampInMicroSeconds;
 
 		// Ensure the variable index is within bounds
-		if (nStorageIndex >= m_Data.size())
+		if (nStorageIndex >= m_Columns.size())
 			throw ELibMCInterfaceException(LIBMC_ERROR_JOURNALVARIABLENOTFOUND);
 			
-		// Retrieve the map for the specified variable
-		const auto& variableData = m_Data.at (nStorageIndex);
+		// Retrieve the column for the specified variable
+		const auto& column = m_Columns.at (nStorageIndex);
 
 		// Empty chunks should not exist
-		if (variableData.empty())
+		if (column.m_TimeStamps.empty())
 			throw ELibMCInterfaceException(LIBMC_ERROR_JOURNALRECORDINGCHUNKISEMPTY);
 
 		// Perform an upper_bound search to find the closest entry after the relative timestamp
-		auto it = variableData.upper_bound((uint32_t)nRelativeTime);
+		auto it = std::upper_bound(column.m_TimeStamps.begin(), column.m_TimeStamps.end(), (uint32_t)nRelativeTime);
 
 		// If the timestamp is before the first recorded entry, return the first value
-		if (it == variableData.begin()) {
-			return it->second;
-		}
-
-		// If the timestamp is beyond the last recorded entry, return the last value
-		if (it == variableData.end()) {
-			return variableData.rbegin()->second;
+		if (it == column.m_TimeStamps.begin()) {
+			return column.m_Values.front();
 		}
 
 		// Otherwise, return the value just before the found timestamp
-		return std::prev(it)->second;
+		// (this includes the case where the timestamp is beyond the last recorded entry)
+		return column.m_Values.at((it - column.m_TimeStamps.begin()) - 1);
+	}
+
+
+	// Aggregate the values of a given variable over a time interval
+	void CStateJournalStreamChunk_Dynamic::computeSummary(const uint32_t nStorageIndex, const uint64_t nAbsoluteStartTimeStamp, const uint64_t nAbsoluteEndTimeStamp, sStateJournalChunkSummary& summary)
+	{
+		if (nStorageIndex >= m_Columns.size())
+			throw ELibMCInterfaceException(LIBMC_ERROR_JOURNALVARIABLENOTFOUND);
+
+		uint64_t nStartTime = std::max(nAbsoluteStartTimeStamp, m_nStartTimeStampInMicroSeconds);
+		uint64_t nEndTime = std::min(nAbsoluteEndTimeStamp, m_nEndTimeStampInMicroSeconds + 1);
+		if (nStartTime >= nEndTime)
+			return;
+
+		const auto& column = m_Columns.at(nStorageIndex);
+		summarizeColumn(column.m_TimeStamps.data(), column.m_Values.data(), column.m_TimeStamps.size(), nStartTime - m_nStartTimeStampInMicroSeconds, nEndTime - m_nStartTimeStampInMicroSeconds, summary);
+	}
+
+	// Read the recorded entries of a given variable in a time interval
+	void CStateJournalStreamChunk_Dynamic::readRawIntegerData(const uint32_t nStorageIndex, const uint64_t nAbsoluteStartTimeStamp, const uint64_t nAbsoluteEndTimeStamp, std::vector<sJournalTimeStreamInt64Entry>& timeStream)
+	{
+		if (nStorageIndex >= m_Columns.size())
+			throw ELibMCInterfaceException(LIBMC_ERROR_JOURNALVARIABLENOTFOUND);
+
+		uint64_t nStartTime = std::max(nAbsoluteStartTimeStamp, m_nStartTimeStampInMicroSeconds);
+		uint64_t nEndTime = std::min(nAbsoluteEndTimeStamp, m_nEndTimeStampInMicroSeconds);
+		if (nStartTime > nEndTime)
+			return;
+
+		const auto& column = m_Columns.at(nStorageIndex);
+		readColumn(column.m_TimeStamps.data(), column.m_Values.data(), column.m_TimeStamps.size(), m_nStartTimeStampInMicroSeconds, nStartTime - m_nStartTimeStampInMicroSeconds, nEndTime - m_nStartTimeStampInMicroSeconds, timeStream);
 	}
 
 
@@ -129,7 +224,7 @@ namespace AMC {
 	void CStateJournalStreamChunk_Dynamic::writeEntry (uint32_t nStorageIndex, uint64_t nAbsoluteTimeStampInMicroseconds, int64_t nValue)
 	{
 		// Ensure the variable index is within bounds
-		if (nStorageIndex >= m_Data.size())
+		if (nStorageIndex >= m_Columns.size())
 			throw ELibMCInterfaceException(LIBMC_ERROR_JOURNALVARIABLENOTFOUND);
 
 		// Ensure the timestamp is within the chunk's bounds
@@ -144,15 +239,34 @@ namespace AMC {
 		m_nCurrentTimeStampInMicroSeconds = nAbsoluteTimeStampInMicroseconds;
 
 		// Calculate relative time within the chunk
-		uint64_t nRelativeTime = nAbsoluteTimeStampInMicroseconds - m_nStartTimeStampInMicroSeconds;
+		uint32_t nRelativeTime = (uint32_t) (nAbsoluteTimeStampInMicroseconds - m_nStartTimeStampInMicroSeconds);
+
+		auto& column = m_Columns[nStorageIndex];
+
+		// Writes are incremental, so a repeated timestamp can only hit the last entry of the column
+		if ((!column.m_TimeStamps.empty()) && (column.m_TimeStamps.back() == nRelativeTime)) {
+			column.m_Values.back() = nValue;
+			return;
+		}
+
+		// Ensure that the number of entries doesn't exceed the allowed maximum
+		if (column.m_TimeStamps.size() >= STATEJOURNALSTORAGE_MAXENTRIESPERCHUNK)
+			throw ELibMCInterfaceException(LIBMC_ERROR_JOURNALCHUNKHASTOOMANYENTRIES);
 
-		// Store the value in the map for the specified variable			
-		m_Data[nStorageIndex][(uint32_t)nRelativeTime] = nValue;
+		// Append the value to the column of the specified variable
+		column.m_TimeStamps.push_back(nRelativeTime);
+		column.m_Values.push_back(nValue);
+		m_nEntryCount++;
 	}
 
 	// Get the number of variables being tracked in this chunk
 	size_t CStateJournalStreamChunk_Dynamic::getVariableCount() {
-		return m_Data.size();
+		return m_Columns.size();
+	}
+
+	// Get the total number of entries over all variables
+	uint64_t CStateJournalStreamChunk_Dynamic::getEntryCount() {
+		return m_nEntryCount;
 	}
 
 	// Serialize the journal data into provided buffers for efficient storage or transmission
@@ -169,45 +283,35 @@ namespace AMC {
 			// Populate the buffer with metadata for each variable
 			for (size_t nVariableIndex = 0; nVariableIndex < nVariableCount; nVariableIndex++) {
 
-				auto& sourceVariable = m_Data.at(nVariableIndex);
+				auto& sourceColumn = m_Columns.at(nVariableIndex);
 				auto& targetVariable = variableBuffer.at(nVariableIndex);
 
-				// Ensure that the number of entries doesn't exceed the allowed maximum
-				if (sourceVariable.size() > STATEJOURNALSTORAGE_MAXENTRIESPERCHUNK)
-					throw ELibMCInterfaceException(LIBMC_ERROR_JOURNALCHUNKHASTOOMANYENTRIES);
-
 				// Fill in metadata for this variable
 				targetVariable.m_VariableIndex = (uint32_t) nVariableIndex;
 				targetVariable.m_StorageType = 0;
 				targetVariable.m_EntryStartIndex = (uint32_t) nTotalCount;
-				targetVariable.m_EntryCount = (uint32_t)sourceVariable.size();
-				nTotalCount += sourceVariable.size();
+				targetVariable.m_EntryCount = (uint32_t)sourceColumn.m_TimeStamps.size();
+				nTotalCount += sourceColumn.m_TimeStamps.size();
 			}
 
+			// Sanity check to ensure the bookkeeping is consistent
+			if (nTotalCount != m_nEntryCount)
+				throw ELibMCInterfaceException(LIBMC_ERROR_COULDNOTSERIALIZEJOURNALENTRIES);
+
 			// Resize the buffers to hold all timestamps and values
 			timeStampBuffer.resize(nTotalCount);
 			valueBuffer.resize(nTotalCount);
 
-			size_t nTotalIndex = 0;
-
-			// Copy the timestamp and value data into the buffers
+			// The columns already have the serialized layout, so every variable is one block copy
 			for (size_t nVariableIndex = 0; nVariableIndex < nVariableCount; nVariableIndex++) {
 
-				auto& sourceVariable = m_Data.at(nVariableIndex);
+				auto& sourceColumn = m_Columns.at(nVariableIndex);
 				auto& targetVariable = variableBuffer.at(nVariableIndex);
 
-				// Copy each entry into the appropriate buffer
-				for (auto & iSourceIter : sourceVariable) {
-					timeStampBuffer.at(nTotalIndex) = iSourceIter.first;
-					valueBuffer.at(nTotalIndex) = iSourceIter.second;
-					nTotalIndex++;
-				}
+				std::copy(sourceColumn.m_TimeStamps.begin(), sourceColumn.m_TimeStamps.end(), timeStampBuffer.begin() + targetVariable.m_EntryStartIndex);
+				std::copy(sourceColumn.m_Values.begin(), sourceColumn.m_Values.end(), valueBuffer.begin() + targetVariable.m_EntryStartIndex);
 			}
 
-			// Sanity check to ensure the buffers were filled correctly
-			if (nTotalIndex != nTotalCount)
-				throw ELibMCInterfaceException(LIBMC_ERROR_COULDNOTSERIALIZEJOURNALENTRIES);
-
 		} 
 
 	}
@@ -225,6 +329,7 @@ namespace AMC {
 		m_nEndTimeStampInMicroSeconds = pDynamicChunk->getEndTimeStampInMicroSeconds();
 
 		pDynamicChunk->serialize(m_VariableBuffer, m_TimeStampBuffer, m_ValueBuffer);
+		computeVariableSummaries();
 
 		debugLog ("created in memory chunk " + std::to_string (m_nChunkIndex) + " from serialization");
 	}
@@ -243,6 +348,15 @@ namespace AMC {
 		pIntegerData->GetTimeStampData(m_TimeStampBuffer);
 		pIntegerData->GetValueData(m_ValueBuffer);
 
+		if (m_TimeStampBuffer.size() != m_ValueBuffer.size())
+			throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDJOURNALCOMPUTEDATA);
+		for (auto& variableInfo : m_VariableBuffer) {
+			if (((uint64_t)variableInfo.m_EntryStartIndex + variableInfo.m_EntryCount) > m_TimeStampBuffer.size())
+				throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDJOURNALCOMPUTEDATA);
+		}
+
+		computeVariableSummaries();
+
 		debugLog("created in memory chunk " + std::to_string(m_nChunkIndex) + " from database");
 	}
 
@@ -306,18 +420,75 @@ namespace AMC {
 		return m_ValueBuffer.at ((it - m_TimeStampBuffer.begin()) - 1);
 	}
 
+	void CStateJournalStreamChunk_InMemory::computeVariableSummaries()
+	{
+		uint64_t nChunkDuration = m_nEndTimeStampInMicroSeconds - m_nStartTimeStampInMicroSeconds + 1;
+
+		m_VariableSummaries.resize(m_VariableBuffer.size());
+		for (size_t nStorageIndex = 0; nStorageIndex < m_VariableBuffer.size(); nStorageIndex++) {
+			auto& variableInfo = m_VariableBuffer.at(nStorageIndex);
+			auto& variableSummary = m_VariableSummaries.at(nStorageIndex);
+
+			clearSummary(variableSummary);
+			if (variableInfo.m_EntryCount > 0)
+				summarizeColumn(&m_TimeStampBuffer.at(variableInfo.m_EntryStartIndex), &m_ValueBuffer.at(variableInfo.m_EntryStartIndex), variableInfo.m_EntryCount, 0, nChunkDuration, variableSummary);
+		}
+	}
+
+	void CStateJournalStreamChunk_InMemory::computeSummary(const uint32_t nStorageIndex, const uint64_t nAbsoluteStartTimeStamp, const uint64_t nAbsoluteEndTimeStamp, sStateJournalChunkSummary& summary)
+	{
+		if (nStorageIndex >= m_VariableBuffer.size())
+			throw ELibMCInterfaceException(LIBMC_ERROR_JOURNALVARIABLENOTFOUND);
+
+		uint64_t nStartTime = std::max(nAbsoluteStartTimeStamp, m_nStartTimeStampInMicroSeconds);
+		uint64_t nEndTime = std::min(nAbsoluteEndTimeStamp, m_nEndTimeStampInMicroSeconds + 1);
+		if (nStartTime >= nEndTime)
+			return;
+
+		// Chunks that are completely covered by the interval are answered from the stored summary
+		if ((nStartTime == m_nStartTimeStampInMicroSeconds) && (nEndTime == m_nEndTimeStampInMicroSeconds + 1)) {
+			mergeSummary(summary, m_VariableSummaries.at(nStorageIndex));
+			return;
+		}
+
+		auto& variableInfo = m_VariableBuffer.at(nStorageIndex);
+		if (variableInfo.m_EntryCount > 0)
+			summarizeColumn(&m_TimeStampBuffer.at(variableInfo.m_EntryStartIndex), &m_ValueBuffer.at(variableInfo.m_EntryStartIndex), variableInfo.m_EntryCount, nStartTime - m_nStartTimeStampInMicroSeconds, nEndTime - m_nStartTimeStampInMicroSeconds, summary);
+	}
+
+	void CStateJournalStreamChunk_InMemory::readRawIntegerData(const uint32_t nStorageIndex, const uint64_t nAbsoluteStartTimeStamp, const uint64_t nAbsoluteEndTimeStamp, std::vector<sJournalTimeStreamInt64Entry>& timeStream)
+	{
+		if (nStorageIndex >= m_VariableBuffer.size())
+			throw ELibMCInterfaceException(LIBMC_ERROR_JOURNALVARIABLENOTFOUND);
+
+		uint64_t nStartTime = std::max(nAbsoluteStartTimeStamp, m_nStartTimeStampInMicroSeconds);
+		uint64_t nEndTime = std::min(nAbsoluteEndTimeStamp, m_nEndTimeStampInMicroSeconds);
+		if (nStartTime > nEndTime)
+			return;
+
+		auto& variableInfo = m_VariableBuffer.at(nStorageIndex);
+		if (variableInfo.m_EntryCount > 0)
+			readColumn(&m_TimeStampBuffer.at(variableInfo.m_EntryStartIndex), &m_ValueBuffer.at(variableInfo.m_EntryStartIndex), variableInfo.m_EntryCount, m_nStartTimeStampInMicroSeconds, nStartTime - m_nStartTimeStampInMicroSeconds, nEndTime - m_nStartTimeStampInMicroSeconds, timeStream);
+	}
+
 	uint64_t CStateJournalStreamChunk_InMemory::getMemoryUsage()
 	{
-		return m_ValueBuffer.size() * sizeof(int64_t) + m_TimeStampBuffer.size() * sizeof(uint32_t) + m_VariableBuffer.size() * sizeof(LibMCData::sJournalChunkVariableInfo);
+		return m_ValueBuffer.size() * sizeof(int64_t) + m_TimeStampBuffer.size() * sizeof(uint32_t) + m_VariableBuffer.size() * sizeof(LibMCData::sJournalChunkVariableInfo) + m_VariableSummaries.size() * sizeof(sStateJournalChunkSummary);
+	}
+
+	const std::vector<sStateJournalChunkSummary>& CStateJournalStreamChunk_InMemory::getVariableSummaries()
+	{
+		return m_VariableSummaries;
 	}
 
 	
-	CStateJournalStreamChunk_OnDisk::CStateJournalStreamChunk_OnDisk(uint64_t nStartTimeStampInMicroSeconds, uint64_t nEndTimeStampInMicroSeconds, uint64_t nChunkIndex, PStateJournalStreamCache pStreamCache, AMC::PLogger pDebugLogger)
+	CStateJournalStreamChunk_OnDisk::CStateJournalStreamChunk_OnDisk(uint64_t nStartTimeStampInMicroSeconds, uint64_t nEndTimeStampInMicroSeconds, uint64_t nChunkIndex, PStateJournalStreamCache pStreamCache, const std::vector<sStateJournalChunkSummary>& variableSummaries, AMC::PLogger pDebugLogger)
 		: CStateJournalStreamChunk(pDebugLogger),
 		m_nStartTimeStampInMicroSeconds(nStartTimeStampInMicroSeconds),
 		m_nEndTimeStampInMicroSeconds(nEndTimeStampInMicroSeconds),
 		m_nChunkIndex(nChunkIndex),
-		m_pStreamCache (pStreamCache)
+		m_pStreamCache (pStreamCache),
+		m_VariableSummaries (variableSummaries)
 	{
 		if (pStreamCache.get() == nullptr)
 			throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDPARAM);
@@ -344,17 +515,44 @@ namespace AMC {
 		return m_nChunkIndex;
 	}
 
-	int64_t CStateJournalStreamChunk_OnDisk::sampleIntegerData(const uint32_t nStorageIndex, const uint64_t nAbsoluteTimeStampInMicroseconds)
+	PStateJournalStreamChunk_InMemory CStateJournalStreamChunk_OnDisk::retrieveInMemoryChunk()
 	{
 		auto pEntry = m_pStreamCache->retrieveEntry((uint32_t) m_nChunkIndex);
-		if (pEntry.get() != nullptr) {
-			return pEntry->sampleIntegerData(nStorageIndex, nAbsoluteTimeStampInMicroseconds);
-		} 
+		if (pEntry.get() != nullptr) 
+			return pEntry;
 
 		debugLog("journal cache miss " + std::to_string(m_nChunkIndex) + " memory usage: " + std::to_string (m_pStreamCache->getCurrentMemoryUsage()));
 
-		pEntry = m_pStreamCache->loadEntryFromJournal((uint32_t)m_nChunkIndex);
-		return pEntry->sampleIntegerData(nStorageIndex, nAbsoluteTimeStampInMicroseconds);
+		return m_pStreamCache->loadEntryFromJournal((uint32_t)m_nChunkIndex);
+	}
+
+	int64_t CStateJournalStreamChunk_OnDisk::sampleIntegerData(const uint32_t nStorageIndex, const uint64_t nAbsoluteTimeStampInMicroseconds)
+	{
+		return retrieveInMemoryChunk()->sampleIntegerData(nStorageIndex, nAbsoluteTimeStampInMicroseconds);
+	}
+
+	void CStateJournalStreamChunk_OnDisk::computeSummary(const uint32_t nStorageIndex, const uint64_t nAbsoluteStartTimeStamp, const uint64_t nAbsoluteEndTimeStamp, sStateJournalChunkSummary& summary)
+	{
+		if (nStorageIndex >= m_VariableSummaries.size())
+			throw ELibMCInterfaceException(LIBMC_ERROR_JOURNALVARIABLENOTFOUND);
+
+		uint64_t nStartTime = std::max(nAbsoluteStartTimeStamp, m_nStartTimeStampInMicroSeconds);
+		uint64_t nEndTime = std::min(nAbsoluteEndTimeStamp, m_nEndTimeStampInMicroSeconds + 1);
+		if (nStartTime >= nEndTime)
+			return;
+
+		if ((nStartTime == m_nStartTimeStampInMicroSeconds) && (nEndTime == m_nEndTimeStampInMicroSeconds + 1)) {
+			mergeSummary(summary, m_VariableSummaries.at(nStorageIndex));
+			return;
+		}
+
+		// Only the partially covered chunks at the interval ends need their entries
+		retrieveInMemoryChunk()->computeSummary(nStorageIndex, nAbsoluteStartTimeStamp, nAbsoluteEndTimeStamp, summary);
+	}
+
+	void CStateJournalStreamChunk_OnDisk::readRawIntegerData(const uint32_t nStorageIndex, const uint64_t nAbsoluteStartTimeStamp, const uint64_t nAbsoluteEndTimeStamp, std::vector<sJournalTimeStreamInt64Entry>& timeStream)
+	{
+		retrieveInMemoryChunk()->readRawIntegerData(nStorageIndex, nAbsoluteStartTimeStamp, nAbsoluteEndTimeStamp, timeStream);
 	}
 
 
@@ -378,6 +576,49 @@ namespace AMC {
 			m_pDebugLogger->logMessage(sDebugMessage, "journal", AMC::eLogLevel::Debug);
 	}
 
+	void CStateJournalStreamChunk::clearSummary(sStateJournalChunkSummary& summary)
+	{
+		summary.m_nMinValue = 0;
+		summary.m_nMaxValue = 0;
+		summary.m_dIntegral = 0.0;
+		summary.m_dSquaredIntegral = 0.0;
+		summary.m_nDurationInMicroSeconds = 0;
+	}
+
+	void CStateJournalStreamChunk::mergeSummary(sStateJournalChunkSummary& target, const sStateJournalChunkSummary& source)
+	{
+		if (source.m_nDurationInMicroSeconds == 0)
+			return;
+
+		if (target.m_nDurationInMicroSeconds == 0) {
+			target = source;
+			return;
+		}
+
+		target.m_nMinValue = std::min(target.m_nMinValue, source.m_nMinValue);
+		target.m_nMaxValue = std::max(target.m_nMaxValue, source.m_nMaxValue);
+		target.m_dIntegral += source.m_dIntegral;
+		target.m_dSquaredIntegral += source.m_dSquaredIntegral;
+		target.m_nDurationInMicroSeconds += source.m_nDurationInMicroSeconds;
+	}
+
+	void CStateJournalStreamChunk::summaryToStatistics(const sStateJournalChunkSummary& summary, double dUnits, sStateJournalStatistics& statistics)
+	{
+		if (summary.m_nDurationInMicroSeconds == 0)
+			throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDJOURNALCOMPUTEINTERVAL, "no journal data available in interval");
+
+		double dDuration = (double)summary.m_nDurationInMicroSeconds;
+		double dAverage = summary.m_dIntegral / dDuration;
+		double dAverageSquared = summary.m_dSquaredIntegral / dDuration;
+
+		statistics.m_dMinValue = summary.m_nMinValue * dUnits;
+		statistics.m_dMaxValue = summary.m_nMaxValue * dUnits;
+		statistics.m_dAverageValue = dAverage * dUnits;
+		statistics.m_dAverageSquaredValue = dAverageSquared * dUnits * dUnits;
+		statistics.m_dVariance = std::max(dAverageSquared - dAverage * dAverage, 0.0) * dUnits * dUnits;
+		statistics.m_dIntegral = summary.m_dIntegral * dUnits / 1000000.0;
+	}
+
 
 	CStateJournalStreamCache::CStateJournalStreamCache(uint64_t nMemoryQuota, PLogger pDebugLogger)
 		: m_nMemoryQuota(nMemoryQuota),
@@ -69,6 +69,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #define STATEJOURNALSTORAGE_MAXENTRIESPERCHUNK (128UL * 1024UL * 1024UL)
 
+#define STATEJOURNALSTORAGE_COLUMNINITIALCAPACITY 64
+
 
 namespace AMC {
 
@@ -90,6 +92,38 @@ namespace AMC {
 	} sStateJournalInterval;
 
 
+	typedef struct _sStateJournalStatistics {
+		sStateJournalInterval m_Interval;
+
+		double m_dMinValue;
+		double m_dMaxValue;
+		double m_dAverageValue;
+		double m_dAverageSquaredValue;
+		double m_dVariance;
+		double m_dIntegral;
+
+	} sStateJournalStatistics;
+
+
+	// Aggregate of a variable over a time interval, in raw integer units.
+	// Values are treated as step function, every entry holds until the next entry.
+	typedef struct _sStateJournalChunkSummary {
+		int64_t m_nMinValue;
+		int64_t m_nMaxValue;
+		double m_dIntegral;
+		double m_dSquaredIntegral;
+		uint64_t m_nDurationInMicroSeconds;
+	} sStateJournalChunkSummary;
+
+
+	// Append-only column of a single variable within a dynamic chunk.
+	// Timestamps are relative to the chunk start and strictly increasing.
+	typedef struct _sStateJournalStreamColumn {
+		std::vector<uint32_t> m_TimeStamps;
+		std::vector<int64_t> m_Values;
+	} sStateJournalStreamColumn;
+
+
 	class CStateJournalStreamCache;
 	typedef std::shared_ptr<CStateJournalStreamCache> PStateJournalStreamCache;
 
@@ -112,9 +146,22 @@ namespace AMC {
 		virtual uint64_t getChunkIndex() = 0;
 
 		virtual int64_t sampleIntegerData(const uint32_t nStorageIndex, const uint64_t nAbsoluteTimeStampInMicroseconds) = 0;
+
+		// Merges the aggregate of a variable in [nAbsoluteStartTimeStamp, nAbsoluteEndTimeStamp) into summary. The interval is clipped to the chunk.
+		virtual void computeSummary(const uint32_t nStorageIndex, const uint64_t nAbsoluteStartTimeStamp, const uint64_t nAbsoluteEndTimeStamp, sStateJournalChunkSummary& summary) = 0;
+
+		// Appends the value at nAbsoluteStartTimeStamp and all entries until nAbsoluteEndTimeStamp (inclusive). The interval is clipped to the chunk.
+		virtual void readRawIntegerData(const uint32_t nStorageIndex, const uint64_t nAbsoluteStartTimeStamp, const uint64_t nAbsoluteEndTimeStamp, std::vector<sJournalTimeStreamInt64Entry>& timeStream) = 0;
 		
 		void debugLog(const std::string & sDebugMessage);
 
+		static void clearSummary(sStateJournalChunkSummary& summary);
+
+		static void mergeSummary(sStateJournalChunkSummary& target, const sStateJournalChunkSummary& source);
+
+		// Converts a summary in raw integer units into statistics. Fails if the summary is empty.
+		static void summaryToStatistics(const sStateJournalChunkSummary& summary, double dUnits, sStateJournalStatistics& statistics);
+
 	};
 
 
@@ -132,8 +179,11 @@ namespace AMC {
 		// The latest timestamp written to this chunk, used for ensuring sequential writes
 		uint64_t m_nCurrentTimeStampInMicroSeconds;
 
-		// Vector holding maps for each variable, mapping relative timestamps to values
-		std::vector<std::map<uint32_t, int64_t>> m_Data;
+		// One append-only column per variable, laid out like the serialized in memory buffers
+		std::vector<sStateJournalStreamColumn> m_Columns;
+
+		// Total number of entries over all columns
+		uint64_t m_nEntryCount;
 
 	public:
 
@@ -156,12 +206,21 @@ namespace AMC {
 		// Retrieve the value for a given variable at a specific absolute timestamp
 		int64_t sampleIntegerData(const uint32_t nStorageIndex, const uint64_t nAbsoluteTimeStampInMicroseconds) override;
 
+		// Aggregate the values of a given variable over a time interval
+		void computeSummary(const uint32_t nStorageIndex, const uint64_t nAbsoluteStartTimeStamp, const uint64_t nAbsoluteEndTimeStamp, sStateJournalChunkSummary& summary) override;
+
+		// Read the recorded entries of a given variable in a time interval
+		void readRawIntegerData(const uint32_t nStorageIndex, const uint64_t nAbsoluteStartTimeStamp, const uint64_t nAbsoluteEndTimeStamp, std::vector<sJournalTimeStreamInt64Entry>& timeStream) override;
+
 		// Write a new value to the journal for a specific variable at a specific timestamp
 		void writeEntry(uint32_t nStorageIndex, uint64_t nAbsoluteTimeStampInMicroseconds, int64_t nValue);
 
 		// Get the number of variables being tracked in this chunk
 		size_t getVariableCount();
 
+		// Get the total number of entries over all variables
+		uint64_t getEntryCount();
+
 		// Serialize the journal data into provided buffers for efficient storage or transmission
 		void serialize(std::vector<LibMCData::sJournalChunkVariableInfo>& variableBuffer, std::vector<uint32_t>& timeStampBuffer, std::vector<int64_t>& valueBuffer);
 
@@ -180,6 +239,11 @@ namespace AMC {
 		std::vector<uint32_t> m_TimeStampBuffer;
 		std::vector<int64_t> m_ValueBuffer;
 
+		// Summary of each variable over the full chunk interval, so that ranges spanning many chunks do not decode every entry
+		std::vector<sStateJournalChunkSummary> m_VariableSummaries;
+
+		void computeVariableSummaries();
+
 	public:
 
 		CStateJournalStreamChunk_InMemory(CStateJournalStreamChunk_Dynamic* pDynamicChunk, AMC::PLogger pDebugLogger);
@@ -198,10 +262,19 @@ namespace AMC {
 		
 		int64_t sampleIntegerData(const uint32_t nStorageIndex, const uint64_t nAbsoluteTimeStampInMicroseconds) override;
 
+		void computeSummary(const uint32_t nStorageIndex, const uint64_t nAbsoluteStartTimeStamp, const uint64_t nAbsoluteEndTimeStamp, sStateJournalChunkSummary& summary) override;
+
+		void readRawIntegerData(const uint32_t nStorageIndex, const uint64_t nAbsoluteStartTimeStamp, const uint64_t nAbsoluteEndTimeStamp, std::vector<sJournalTimeStreamInt64Entry>& timeStream) override;
+
 		uint64_t getMemoryUsage();
 
+		// Summaries of all variables over the full chunk interval, indexed by storage index
+		const std::vector<sStateJournalChunkSummary>& getVariableSummaries();
+
 	};
 
+	typedef std::shared_ptr<CStateJournalStreamChunk_InMemory> PStateJournalStreamChunk_InMemory;
+
 	class CStateJournalStreamChunk_OnDisk : public CStateJournalStreamChunk
 	{
 	private:
@@ -211,8 +284,13 @@ namespace AMC {
 
 		PStateJournalStreamCache m_pStreamCache;
 
+		// Full chunk summaries taken over when the chunk is sealed, so that covered chunks are never loaded back from disk
+		std::vector<sStateJournalChunkSummary> m_VariableSummaries;
+
+		PStateJournalStreamChunk_InMemory retrieveInMemoryChunk();
+
 	public:
-		CStateJournalStreamChunk_OnDisk(uint64_t nStartTimeStampInMicroSeconds, uint64_t nEndTimeStampInMicroSeconds, uint64_t nChunkIndex, PStateJournalStreamCache pStreamCache, AMC::PLogger pDebugLogger);
+		CStateJournalStreamChunk_OnDisk(uint64_t nStartTimeStampInMicroSeconds, uint64_t nEndTimeStampInMicroSeconds, uint64_t nChunkIndex, PStateJournalStreamCache pStreamCache, const std::vector<sStateJournalChunkSummary>& variableSummaries, AMC::PLogger pDebugLogger);
 
 		virtual ~CStateJournalStreamChunk_OnDisk();
 
@@ -224,11 +302,14 @@ namespace AMC {
 
 		int64_t sampleIntegerData(const uint32_t nStorageIndex, const uint64_t nAbsoluteTimeStampInMicroseconds);
 
+		void computeSummary(const uint32_t nStorageIndex, const uint64_t nAbsoluteStartTimeStamp, const uint64_t nAbsoluteEndTimeStamp, sStateJournalChunkSummary& summary);
+
+		void readRawIntegerData(const uint32_t nStorageIndex, const uint64_t nAbsoluteStartTimeStamp, const uint64_t nAbsoluteEndTimeStamp, std::vector<sJournalTimeStreamInt64Entry>& timeStream);
+
 	};
 
 
 	typedef std::shared_ptr<CStateJournalStreamChunk> PStateJournalStreamChunk;
-	typedef std::shared_ptr<CStateJournalStreamChunk_InMemory> PStateJournalStreamChunk_InMemory;
 	
 	class CStateJournalStreamCache
 	{
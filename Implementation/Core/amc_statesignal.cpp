@@ -35,6 +35,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "libmc_exceptiontypes.hpp"
 
 #include <iterator>
+#include <chrono>
 
 namespace AMC {
 	
@@ -101,11 +102,14 @@ namespace AMC {
 		}
 
 
+		bool bPhaseChanged = false;
+
 		switch (messagePhase) {
 			case AMC::eAMCSignalPhase::InProcess:
 				m_pTelemetryInProcessMarker = m_pInProcessTelemetryChannel->startIntervalMarker(0);
 				m_MessagePhase = messagePhase;
-				return true;
+				bPhaseChanged = true;
+				break;
 
 			case AMC::eAMCSignalPhase::Handled:
 			case AMC::eAMCSignalPhase::Failed:
@@ -113,21 +117,46 @@ namespace AMC {
 			case AMC::eAMCSignalPhase::Cleared:
 				m_pTelemetryAcknowledgedMarker = m_pAcknowledgeTelemetryChannel->startIntervalMarker(0);
 				m_MessagePhase = messagePhase;
-				return true;
+				bPhaseChanged = true;
+				break;
 
 			case AMC::eAMCSignalPhase::Archived:
 				m_MessagePhase = messagePhase;
-				return true;
+				bPhaseChanged = true;
+				break;
 
 			default:
-				return false;
+				break;
 
 		}
 
+		if (bPhaseChanged)
+			m_PhaseCondition.notify_all();
 
+		return bPhaseChanged;
 		
 	}
 
+	std::condition_variable& CStateSignalMessage::getPhaseCondition()
+	{
+		return m_PhaseCondition;
+	}
+
+	bool CStateSignalMessage::isTerminalPhase(AMC::eAMCSignalPhase messagePhase)
+	{
+		switch (messagePhase) {
+			case AMC::eAMCSignalPhase::Handled:
+			case AMC::eAMCSignalPhase::Failed:
+			case AMC::eAMCSignalPhase::TimedOut:
+			case AMC::eAMCSignalPhase::Cleared:
+			case AMC::eAMCSignalPhase::Archived:
+				return true;
+
+			default:
+				return false;
+		}
+	}
+
 	AMC::eAMCSignalPhase CStateSignalMessage::getPhase() const
 	{
 		return m_MessagePhase;
@@ -440,6 +469,8 @@ namespace AMC {
 			
 		}
 
+		m_QueueCondition.notify_all();
+
 		return pMessage;
 	}
 
@@ -768,6 +799,33 @@ namespace AMC {
 		return pMessage;
 	}
 
+	bool CStateSignalSlot::waitForQueuedMessageInternal(uint64_t nTimeOutInMicroseconds)
+	{
+		std::unique_lock<std::mutex> lock(m_Mutex);
+
+		return m_QueueCondition.wait_for(lock, std::chrono::microseconds(nTimeOutInMicroseconds), [this] {
+			return !m_Queue.empty();
+		});
+	}
+
+	bool CStateSignalSlot::waitForTerminalPhaseInternal(const std::string& sMessageUUID, uint64_t nTimeOutInMicroseconds)
+	{
+		std::string sNormalizedUUID = AMCCommon::CUtils::normalizeUUIDString(sMessageUUID);
+
+		std::unique_lock<std::mutex> lock(m_Mutex);
+
+		auto iMessageIter = m_MessageMap.find(sNormalizedUUID);
+		if (iMessageIter == m_MessageMap.end())
+			return true;
+
+		// Keep the message alive while waiting, it might get archived in the meantime
+		PStateSignalMessage pMessage = iMessageIter->second;
+
+		return pMessage->getPhaseCondition().wait_for(lock, std::chrono::microseconds(nTimeOutInMicroseconds), [&pMessage] {
+			return CStateSignalMessage::isTerminalPhase(pMessage->getPhase());
+		});
+	}
+
 
 	std::string CStateSignalSlot::getResultDataJSONInternal(const std::string& sMessageUUID)
 	{
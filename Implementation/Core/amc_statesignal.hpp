@@ -48,6 +48,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <queue>
 #include <thread>
+#include <mutex>
+#include <condition_variable>
 
 namespace AMC {
 
@@ -101,6 +103,9 @@ namespace AMC {
 			PTelemetryChannel m_pInProcessTelemetryChannel;
 			PTelemetryChannel m_pAcknowledgeTelemetryChannel;
 
+			// Notified on every phase change. Must only be waited on with the mutex of the owning slot.
+			std::condition_variable m_PhaseCondition;
+
 		public:
 
 			CStateSignalMessage(const std::string & sUUID, uint32_t nReactionTimeoutInMS, PTelemetryChannel pQueueTelemetryChannel, PTelemetryChannel pInProcessTelemetryChannel, PTelemetryChannel pAcknowledgeTelemetryChannel);
@@ -134,6 +139,10 @@ namespace AMC {
 
 			bool hadReactionTimeout(uint64_t nGlobalTimestamp);
 
+			std::condition_variable& getPhaseCondition();
+
+			static bool isTerminalPhase(AMC::eAMCSignalPhase messagePhase);
+
 	};
 
 
@@ -185,6 +194,9 @@ namespace AMC {
 
 		std::mutex m_Mutex;
 
+		// Notified whenever a new message is added to the queue.
+		std::condition_variable m_QueueCondition;
+
 		CStateSignalMessage* getMessageByUUIDNoMutex (const std::string& sMessageUUIDNormalized);
 		bool queueIsFullNoMutex();
 
@@ -230,6 +242,12 @@ namespace AMC {
 		void writeMessagesToArchive (CStateSignalArchiveWriter * pArchiveWriter);
 
 		PStateSignalMessage claimMessageFromQueueInternal(bool bCheckForReactionTimeout, uint64_t nGlobalTimestamp, uint64_t nTimeStamp, bool bChangePhaseToInprocess);
+
+		// Blocks until the queue is not empty or the timeout has passed. Returns true if the queue is not empty.
+		bool waitForQueuedMessageInternal(uint64_t nTimeOutInMicroseconds);
+
+		// Blocks until the message is in a terminal phase or the timeout has passed. Returns true if the message is in a terminal phase or does not exist anymore.
+		bool waitForTerminalPhaseInternal(const std::string& sMessageUUID, uint64_t nTimeOutInMicroseconds);
 		
 		std::string getResultDataJSONInternal(const std::string& sMessageUUID);
 		std::string getParameterDataJSONInternal(const std::string& sMessageUUID);
@@ -187,6 +187,13 @@ namespace AMC {
 		return true;
 	}
 
+	bool CStateSignalInstance::waitForQueuedSignal(const std::string& sSignalName, uint64_t nTimeOutInMicroseconds)
+	{
+		AMC::PStateSignalSlot pSlot = getSignalSlot(sSignalName);
+
+		return pSlot->waitForQueuedMessageInternal(nTimeOutInMicroseconds);
+	}
+
 
 	uint32_t CStateSignalInstance::getAvailableSignalQueueEntryCount(const std::string& sSignalName)
 	{
@@ -431,6 +438,17 @@ namespace AMC {
 		return pSlot->getSignalPhaseInternal (sNormalizedUUID);
 	}
 
+	bool CStateSignalHandler::waitForSignalTerminalPhase(const std::string& sSignalUUID, uint64_t nTimeOutInMicroseconds)
+	{
+		std::string sNormalizedUUID = AMCCommon::CUtils::normalizeUUIDString(sSignalUUID);
+
+		PStateSignalSlot pSlot = findSignalSlotOfMessage(sNormalizedUUID);
+		if (pSlot == nullptr)
+			return true;
+
+		return pSlot->waitForTerminalPhaseInternal(sNormalizedUUID, nTimeOutInMicroseconds);
+	}
+
 
 	void CStateSignalHandler::checkForReactionTimeouts(uint64_t nGlobalTimestamp)
 	{
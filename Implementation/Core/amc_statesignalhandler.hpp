@@ -95,6 +95,9 @@ namespace AMC {
 
 		bool claimSignalMessage(const std::string& sSignalName, bool bCheckForReactionTimeout, uint64_t nGlobalTimestamp, uint64_t nTimeStamp, std::string& sSignalUUID, std::string& sParameterDataJSON, bool bChangePhaseToInprocess);
 
+		// Blocks until a signal of the given type is queued or the timeout has passed.
+		bool waitForQueuedSignal(const std::string& sSignalName, uint64_t nTimeOutInMicroseconds);
+
 		bool addNewInQueueSignal(const std::string& sSignalName, const std::string& sSignalUUID, const std::string& sParameterData, uint32_t nResponseTimeOutInMS, uint64_t nTimestamp);
 
 		uint32_t getAvailableSignalQueueEntryCount(const std::string& sSignalName);
@@ -155,6 +158,9 @@ namespace AMC {
 
 		AMC::eAMCSignalPhase getSignalPhase (const std::string& sSignalUUID);
 
+		// Blocks until the signal has been handled, failed, timed out, cleared or archived, or the timeout has passed.
+		bool waitForSignalTerminalPhase (const std::string& sSignalUUID, uint64_t nTimeOutInMicroseconds);
+
 		void checkForReactionTimeouts(uint64_t nGlobalTimestamp);
 
 		void autoArchiveMessages(uint64_t nGlobalTimestamp);
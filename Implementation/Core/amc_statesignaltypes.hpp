@@ -35,7 +35,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <memory>
 #include <string>
 
-#define AMC_SIGNAL_DEFAULT_WAITFOR_SLEEP_MS 1
+// Waiting for signals is event driven. The slice only bounds how long a wait blocks before checking for termination.
+#define AMC_SIGNAL_WAITFOR_MAXSLICE_MS 50
 
 #define AMC_SIGNAL_MINQUEUESIZE 1
 #define AMC_SIGNAL_MAXQUEUESIZE 1024
@@ -0,0 +1,331 @@
+/*++
+
+Copyright (C) 2025 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+
+#include "amc_streamhandler.hpp"
+#include "libmc_exceptiontypes.hpp"
+#include "common_utils.hpp"
+
+#include <chrono>
+#include <cstring>
+
+namespace AMC {
+
+	CStreamPacket::CStreamPacket(uint64_t nSequenceNumber, const std::string& sMIMEType, const uint8_t* pData, size_t nDataSize)
+		: m_nSequenceNumber (nSequenceNumber), m_sMIMEType (sMIMEType)
+	{
+		if (nDataSize > 0) {
+			if (pData == nullptr)
+				throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDPARAM);
+
+			m_Data.resize(nDataSize);
+			memcpy(m_Data.data(), pData, nDataSize);
+		}
+	}
+
+	CStreamPacket::~CStreamPacket()
+	{
+	}
+
+	uint64_t CStreamPacket::getSequenceNumber()
+	{
+		return m_nSequenceNumber;
+	}
+
+	std::string CStreamPacket::getMIMEType()
+	{
+		return m_sMIMEType;
+	}
+
+	const std::vector<uint8_t>& CStreamPacket::getData()
+	{
+		return m_Data;
+	}
+
+
+	CStreamSubscription::CStreamSubscription(size_t nQueueSize)
+		: m_nReadIndex (0), m_nCount (0), m_nDroppedPackets (0), m_bClosed (false)
+	{
+		if (nQueueSize == 0)
+			throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDPARAM);
+
+		m_Queue.resize(nQueueSize);
+	}
+
+	CStreamSubscription::~CStreamSubscription()
+	{
+	}
+
+	void CStreamSubscription::pushPacket(PStreamPacket pPacket)
+	{
+		if (pPacket.get() == nullptr)
+			throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDPARAM);
+
+		{
+			std::lock_guard<std::mutex> lockGuard(m_Mutex);
+			if (m_bClosed)
+				return;
+
+			size_t nQueueSize = m_Queue.size();
+			if (m_nCount == nQueueSize) {
+				// Drop the oldest packet
+				m_Queue[m_nReadIndex] = nullptr;
+				m_nReadIndex = (m_nReadIndex + 1) % nQueueSize;
+				m_nCount--;
+				m_nDroppedPackets++;
+			}
+
+			m_Queue[(m_nReadIndex + m_nCount) % nQueueSize] = pPacket;
+			m_nCount++;
+		}
+
+		m_Condition.notify_all();
+	}
+
+	PStreamPacket CStreamSubscription::popPacket()
+	{
+		std::lock_guard<std::mutex> lockGuard(m_Mutex);
+		if (m_nCount == 0)
+			return nullptr;
+
+		PStreamPacket pPacket = m_Queue[m_nReadIndex];
+		m_Queue[m_nReadIndex] = nullptr;
+		m_nReadIndex = (m_nReadIndex + 1) % m_Queue.size();
+		m_nCount--;
+
+		return pPacket;
+	}
+
+	PStreamPacket CStreamSubscription::waitForPacket(uint32_t nTimeOutInMS)
+	{
+		std::unique_lock<std::mutex> lock(m_Mutex);
+		m_Condition.wait_for(lock, std::chrono::milliseconds(nTimeOutInMS), [this] { return m_bClosed || (m_nCount > 0); });
+
+		if (m_nCount == 0)
+			return nullptr;
+
+		PStreamPacket pPacket = m_Queue[m_nReadIndex];
+		m_Queue[m_nReadIndex] = nullptr;
+		m_nReadIndex = (m_nReadIndex + 1) % m_Queue.size();
+		m_nCount--;
+
+		return pPacket;
+	}
+
+	void CStreamSubscription::close()
+	{
+		{
+			std::lock_guard<std::mutex> lockGuard(m_Mutex);
+			m_bClosed = true;
+		}
+
+		m_Condition.notify_all();
+	}
+
+	bool CStreamSubscription::isClosed()
+	{
+		std::lock_guard<std::mutex> lockGuard(m_Mutex);
+		return m_bClosed;
+	}
+
+	uint64_t CStreamSubscription::getDroppedPacketCount()
+	{
+		std::lock_guard<std::mutex> lockGuard(m_Mutex);
+		return m_nDroppedPackets;
+	}
+
+	size_t CStreamSubscription::getQueuedPacketCount()
+	{
+		std::lock_guard<std::mutex> lockGuard(m_Mutex);
+		return m_nCount;
+	}
+
+
+	CStream::CStream(const std::string& sUUID, const std::string& sIdentifier, eStreamType streamType)
+		: m_sUUID (AMCCommon::CUtils::normalizeUUIDString (sUUID)), m_sIdentifier (sIdentifier), m_StreamType (streamType), m_nQueueSize (0), m_nNextSequenceNumber (1)
+	{
+		switch (streamType) {
+			case eStreamType::JSONEventStream:
+				m_nQueueSize = AMC_STREAM_JSONEVENTSTREAM_QUEUESIZE;
+				break;
+			case eStreamType::JPEGImageStream:
+				m_nQueueSize = AMC_STREAM_JPEGIMAGESTREAM_QUEUESIZE;
+				break;
+			default:
+				throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDPARAM);
+		}
+	}
+
+	CStream::~CStream()
+	{
+	}
+
+	std::string CStream::getUUID()
+	{
+		return m_sUUID;
+	}
+
+	std::string CStream::getIdentifier()
+	{
+		return m_sIdentifier;
+	}
+
+	eStreamType CStream::getStreamType()
+	{
+		return m_StreamType;
+	}
+
+	PStreamSubscription CStream::subscribe()
+	{
+		auto pSubscription = std::make_shared<CStreamSubscription>(m_nQueueSize);
+
+		std::lock_guard<std::mutex> lockGuard(m_Mutex);
+		m_Subscriptions.push_back(pSubscription);
+
+		// Image streams start with the most recent frame, so that new clients do not show an empty picture.
+		if ((m_StreamType == eStreamType::JPEGImageStream) && (m_pLastPacket.get() != nullptr))
+			pSubscription->pushPacket(m_pLastPacket);
+
+		return pSubscription;
+	}
+
+	void CStream::publish(const std::string& sMIMEType, const uint8_t* pData, size_t nDataSize)
+	{
+		if (m_StreamType == eStreamType::JPEGImageStream) {
+			// Every frame must at least start with a JPEG start-of-image marker
+			if ((pData == nullptr) || (nDataSize < 2) || (pData[0] != 0xFF) || (pData[1] != 0xD8))
+				throw ELibMCCustomException(LIBMC_ERROR_INVALIDSTREAMIMAGEDATA, m_sIdentifier);
+		}
+
+		std::lock_guard<std::mutex> lockGuard(m_Mutex);
+
+		auto pPacket = std::make_shared<CStreamPacket>(m_nNextSequenceNumber, sMIMEType, pData, nDataSize);
+		m_nNextSequenceNumber++;
+
+		if (m_StreamType == eStreamType::JPEGImageStream)
+			m_pLastPacket = pPacket;
+
+		auto iIter = m_Subscriptions.begin();
+		while (iIter != m_Subscriptions.end()) {
+			auto pSubscription = iIter->lock();
+			if (pSubscription.get() != nullptr) {
+				pSubscription->pushPacket(pPacket);
+				iIter++;
+			}
+			else {
+				iIter = m_Subscriptions.erase(iIter);
+			}
+		}
+	}
+
+	size_t CStream::getSubscriptionCount()
+	{
+		std::lock_guard<std::mutex> lockGuard(m_Mutex);
+
+		size_t nCount = 0;
+		for (auto& pWeakSubscription : m_Subscriptions) {
+			if (!pWeakSubscription.expired())
+				nCount++;
+		}
+
+		return nCount;
+	}
+
+	void CStream::closeAllSubscriptions()
+	{
+		std::lock_guard<std::mutex> lockGuard(m_Mutex);
+
+		for (auto& pWeakSubscription : m_Subscriptions) {
+			auto pSubscription = pWeakSubscription.lock();
+			if (pSubscription.get() != nullptr)
+				pSubscription->close();
+		}
+
+		m_Subscriptions.clear();
+	}
+
+
+	CStreamHandler::CStreamHandler()
+	{
+	}
+
+	CStreamHandler::~CStreamHandler()
+	{
+		closeAllStreams();
+	}
+
+	PStream CStreamHandler::registerStream(const std::string& sIdentifier, eStreamType streamType)
+	{
+		if (!AMCCommon::CUtils::stringIsValidAlphanumericNameString(sIdentifier))
+			throw ELibMCCustomException(LIBMC_ERROR_INVALIDSTREAMIDENTIFIER, sIdentifier);
+
+		std::lock_guard<std::mutex> lockGuard(m_Mutex);
+
+		auto iIter = m_StreamsByIdentifier.find(sIdentifier);
+		if (iIter != m_StreamsByIdentifier.end()) {
+			if (iIter->second->getStreamType() != streamType)
+				throw ELibMCCustomException(LIBMC_ERROR_STREAMTYPEMISMATCH, sIdentifier);
+
+			return iIter->second;
+		}
+
+		auto pStream = std::make_shared<CStream>(AMCCommon::CUtils::createUUID(), sIdentifier, streamType);
+		m_StreamsByUUID.insert(std::make_pair(pStream->getUUID(), pStream));
+		m_StreamsByIdentifier.insert(std::make_pair(sIdentifier, pStream));
+
+		return pStream;
+	}
+
+	PStream CStreamHandler::findStream(const std::string& sStreamUUID, bool bFailIfNotExistent)
+	{
+		std::string sNormalizedUUID = AMCCommon::CUtils::normalizeUUIDString(sStreamUUID);
+
+		std::lock_guard<std::mutex> lockGuard(m_Mutex);
+		auto iIter = m_StreamsByUUID.find(sNormalizedUUID);
+
+		if (iIter == m_StreamsByUUID.end()) {
+			if (bFailIfNotExistent)
+				throw ELibMCCustomException(LIBMC_ERROR_STREAMNOTFOUND, sNormalizedUUID);
+
+			return nullptr;
+		}
+
+		return iIter->second;
+	}
+
+	void CStreamHandler::closeAllStreams()
+	{
+		std::lock_guard<std::mutex> lockGuard(m_Mutex);
+		for (auto& iIter : m_StreamsByUUID)
+			iIter.second->closeAllSubscriptions();
+	}
+
+}
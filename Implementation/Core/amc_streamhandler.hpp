@@ -0,0 +1,172 @@
+/*++
+
+Copyright (C) 2025 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+
+#ifndef __AMC_STREAMHANDLER
+#define __AMC_STREAMHANDLER
+
+#include <memory>
+#include <map>
+#include <list>
+#include <vector>
+#include <string>
+#include <mutex>
+#include <condition_variable>
+
+#define AMC_STREAM_JSONEVENTSTREAM_QUEUESIZE 256
+#define AMC_STREAM_JPEGIMAGESTREAM_QUEUESIZE 2
+
+namespace AMC {
+
+	enum class eStreamType : int32_t {
+		JSONEventStream = 1,
+		JPEGImageStream = 2
+	};
+
+	class CStreamPacket;
+	class CStreamSubscription;
+	class CStream;
+	class CStreamHandler;
+
+	typedef std::shared_ptr<CStreamPacket> PStreamPacket;
+	typedef std::shared_ptr<CStreamSubscription> PStreamSubscription;
+	typedef std::shared_ptr<CStream> PStream;
+	typedef std::shared_ptr<CStreamHandler> PStreamHandler;
+
+	// Immutable payload, shared between all subscriptions of a stream.
+	class CStreamPacket {
+	private:
+
+		uint64_t m_nSequenceNumber;
+		std::string m_sMIMEType;
+		std::vector<uint8_t> m_Data;
+
+	public:
+
+		CStreamPacket(uint64_t nSequenceNumber, const std::string& sMIMEType, const uint8_t* pData, size_t nDataSize);
+		virtual ~CStreamPacket();
+
+		uint64_t getSequenceNumber();
+		std::string getMIMEType();
+		const std::vector<uint8_t>& getData();
+
+	};
+
+	// Bounded per-connection queue. If a client does not keep up, the oldest packets are dropped.
+	class CStreamSubscription {
+	private:
+
+		std::mutex m_Mutex;
+		std::condition_variable m_Condition;
+
+		std::vector<PStreamPacket> m_Queue;
+		size_t m_nReadIndex;
+		size_t m_nCount;
+		uint64_t m_nDroppedPackets;
+		bool m_bClosed;
+
+	public:
+
+		CStreamSubscription(size_t nQueueSize);
+		virtual ~CStreamSubscription();
+
+		void pushPacket(PStreamPacket pPacket);
+
+		// Returns nullptr if no packet is available.
+		PStreamPacket popPacket();
+
+		// Returns nullptr on timeout or if the subscription has been closed.
+		PStreamPacket waitForPacket(uint32_t nTimeOutInMS);
+
+		void close();
+		bool isClosed();
+
+		uint64_t getDroppedPacketCount();
+		size_t getQueuedPacketCount();
+
+	};
+
+	class CStream {
+	private:
+
+		std::string m_sUUID;
+		std::string m_sIdentifier;
+		eStreamType m_StreamType;
+		size_t m_nQueueSize;
+
+		std::mutex m_Mutex;
+		std::list<std::weak_ptr<CStreamSubscription>> m_Subscriptions;
+		uint64_t m_nNextSequenceNumber;
+		PStreamPacket m_pLastPacket;
+
+	public:
+
+		CStream(const std::string& sUUID, const std::string& sIdentifier, eStreamType streamType);
+		virtual ~CStream();
+
+		std::string getUUID();
+		std::string getIdentifier();
+		eStreamType getStreamType();
+
+		PStreamSubscription subscribe();
+
+		void publish(const std::string& sMIMEType, const uint8_t* pData, size_t nDataSize);
+
+		size_t getSubscriptionCount();
+
+		void closeAllSubscriptions();
+
+	};
+
+	class CStreamHandler {
+	private:
+
+		std::mutex m_Mutex;
+		std::map<std::string, PStream> m_StreamsByUUID;
+		std::map<std::string, PStream> m_StreamsByIdentifier;
+
+	public:
+
+		CStreamHandler();
+		virtual ~CStreamHandler();
+
+		PStream registerStream(const std::string& sIdentifier, eStreamType streamType);
+
+		PStream findStream(const std::string& sStreamUUID, bool bFailIfNotExistent);
+
+		void closeAllStreams();
+
+	};
+
+}
+
+
+#endif //__AMC_STREAMHANDLER
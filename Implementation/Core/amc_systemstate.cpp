@@ -39,6 +39,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "amc_alerthandler.hpp"
 #include "amc_telemetry.hpp"
 #include "amc_dataserieshandler.hpp"
+#include "amc_streamhandler.hpp"
 #include "amc_toolpathhandler.hpp"
 #include "amc_ui_handler.hpp"
 #include "amc_ui_systemstate.hpp"
@@ -105,6 +106,7 @@ namespace AMC {
 		m_pLanguageHandler = std::make_shared<CLanguageHandler>();
 		m_pDataSeriesHandler = std::make_shared<CDataSeriesHandler>();
 		m_pAlertHandler = std::make_shared<CAlertHandler>();
+		m_pStreamHandler = std::make_shared<CStreamHandler>();
 
 		auto pUISystemState = std::make_shared<CUISystemState>(m_pStateMachineData, m_pToolpathHandler, m_pSignalHandler, m_pLogger, m_pStateJournal, getTestEnvironmentPath(), m_pAccessControl, m_pLanguageHandler, m_pMeshHandler, m_pDataSeriesHandler, m_pGlobalChrono, m_pAlertHandler, m_pDataModel);
 		m_pUIHandler = std::make_shared<CUIHandler>(pEnvWrapper, pUISystemState);
@@ -149,6 +151,11 @@ namespace AMC {
 
 	CSystemState::~CSystemState()
 	{
+		// Wake up all stream connections that are still waiting for content
+		if (m_pStreamHandler.get() != nullptr)
+			m_pStreamHandler->closeAllStreams();
+		m_pStreamHandler = nullptr;
+
 		m_pDriverHandler = nullptr;
 		m_pUIHandler = nullptr;
 		m_pStateMachineData = nullptr;
@@ -217,6 +224,16 @@ namespace AMC {
 		return m_pTelemetryHandler;
 	}
 
+	CStreamHandler* CSystemState::streamHandler()
+	{
+		return m_pStreamHandler.get();
+	}
+
+	PStreamHandler CSystemState::getStreamHandlerInstance()
+	{
+		return m_pStreamHandler;
+	}
+
 	PLogger CSystemState::getLoggerInstance()
 	{
 		return m_pLogger;
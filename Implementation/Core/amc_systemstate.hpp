@@ -73,6 +73,7 @@ namespace AMC {
 	class CDataSeriesHandler;
 	class CAlertHandler;
 	class CTelemetryHandler;
+	class CStreamHandler;
 
 	typedef std::shared_ptr<CLogger> PLogger;
 	typedef std::shared_ptr<CStateSignalHandler> PStateSignalHandler;
@@ -90,6 +91,7 @@ namespace AMC {
 	typedef std::shared_ptr<CMeshHandler> PMeshHandler;
 	typedef std::shared_ptr<CDataSeriesHandler> PDataSeriesHandler;
 	typedef std::shared_ptr<CTelemetryHandler> PTelemetryHandler;
+	typedef std::shared_ptr<CStreamHandler> PStreamHandler;
 
 	class CSystemState {
 	private:
@@ -115,6 +117,7 @@ namespace AMC {
 		AMC::PParameterHandler m_pSystemParameterHandler;
 		AMC::PParameterGroup m_pSystemMemoryGroup;
 		AMC::PTelemetryHandler m_pTelemetryHandler;
+		AMC::PStreamHandler m_pStreamHandler;
 
 		AMCCommon::PChrono m_pGlobalChrono;
 
@@ -144,6 +147,7 @@ namespace AMC {
 		CStringResourceHandler * stringResourceHandler ();
 		CAlertHandler* alertHandler();
 		CTelemetryHandler* telemetryHandler();
+		CStreamHandler* streamHandler();
 
 		AMCCommon::CChrono * globalChrono();
 
@@ -159,6 +163,7 @@ namespace AMC {
 		PDataSeriesHandler getDataSeriesHandlerInstance();
 		PAlertHandler getAlertHandlerInstance();
 		PTelemetryHandler getTelemetryHandlerInstance();
+		PStreamHandler getStreamHandlerInstance();
 
 		LibMCData::PDataModel getDataModelInstance ();
 
@@ -0,0 +1,229 @@
+/*++
+
+Copyright (C) 2025 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "amc_systemtaskscheduler.hpp"
+#include "amc_telemetry.hpp"
+#include "libmc_exceptiontypes.hpp"
+
+#include <chrono>
+
+namespace AMC {
+
+	CSystemTask::CSystemTask(const std::string& sName, const std::string& sDescription, uint32_t nIntervalInMilliseconds, SystemTaskFunction taskFunction, PTelemetryChannel pTelemetryChannel)
+		: m_sName (sName), 
+		m_sDescription (sDescription), 
+		m_TaskFunction (taskFunction), 
+		m_pTelemetryChannel (pTelemetryChannel),
+		m_nIntervalInMilliseconds (nIntervalInMilliseconds),
+		m_nNextDueTimeInMicroseconds (0),
+		m_nExecutionCount (0),
+		m_nLastDurationInMicroseconds (0),
+		m_nMaxDurationInMicroseconds (0)
+	{
+		if (!taskFunction)
+			throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDPARAM);
+	}
+
+	CSystemTask::~CSystemTask()
+	{
+	}
+
+	std::string CSystemTask::getName()
+	{
+		return m_sName;
+	}
+
+	std::string CSystemTask::getDescription()
+	{
+		return m_sDescription;
+	}
+
+
+	CSystemTaskScheduler::CSystemTaskScheduler(AMCCommon::PChrono pGlobalChrono, PTelemetryHandler pTelemetryHandler)
+		: m_bTerminationRequested (false), m_pGlobalChrono (pGlobalChrono), m_pTelemetryHandler (pTelemetryHandler)
+	{
+		if (pGlobalChrono.get() == nullptr)
+			throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDPARAM);
+	}
+
+	CSystemTaskScheduler::~CSystemTaskScheduler()
+	{
+	}
+
+	PSystemTask CSystemTaskScheduler::findTaskInternal(const std::string& sName)
+	{
+		auto iIter = m_TaskMap.find(sName);
+		if (iIter == m_TaskMap.end())
+			throw ELibMCCustomException(LIBMC_ERROR_SYSTEMTASKNOTFOUND, sName);
+
+		return iIter->second;
+	}
+
+	void CSystemTaskScheduler::registerTask(const std::string& sName, const std::string& sDescription, uint32_t nIntervalInMilliseconds, SystemTaskFunction taskFunction)
+	{
+		if (sName.empty())
+			throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDPARAM);
+		if ((nIntervalInMilliseconds < AMC_SYSTEMTASK_MININTERVAL_MILLISECONDS) || (nIntervalInMilliseconds > AMC_SYSTEMTASK_MAXINTERVAL_MILLISECONDS))
+			throw ELibMCCustomException(LIBMC_ERROR_INVALIDSYSTEMTASKINTERVAL, sName + ": " + std::to_string(nIntervalInMilliseconds));
+
+		if (hasTask(sName))
+			throw ELibMCCustomException(LIBMC_ERROR_DUPLICATESYSTEMTASK, sName);
+
+		PTelemetryChannel pTelemetryChannel;
+		if (m_pTelemetryHandler.get() != nullptr)
+			pTelemetryChannel = m_pTelemetryHandler->registerChannel("systemtask." + sName, "System Task " + sDescription, LibMCData::eTelemetryChannelType::SystemTask);
+
+		auto pTask = std::make_shared<CSystemTask>(sName, sDescription, nIntervalInMilliseconds, taskFunction, pTelemetryChannel);
+
+		std::lock_guard<std::mutex> lockGuard(m_SchedulerMutex);
+		m_Tasks.push_back(pTask);
+		m_TaskMap.insert(std::make_pair(sName, pTask));
+	}
+
+	bool CSystemTaskScheduler::hasTask(const std::string& sName)
+	{
+		std::lock_guard<std::mutex> lockGuard(m_SchedulerMutex);
+		return (m_TaskMap.find(sName) != m_TaskMap.end());
+	}
+
+	void CSystemTaskScheduler::setTaskInterval(const std::string& sName, uint32_t nIntervalInMilliseconds)
+	{
+		if ((nIntervalInMilliseconds < AMC_SYSTEMTASK_MININTERVAL_MILLISECONDS) || (nIntervalInMilliseconds > AMC_SYSTEMTASK_MAXINTERVAL_MILLISECONDS))
+			throw ELibMCCustomException(LIBMC_ERROR_INVALIDSYSTEMTASKINTERVAL, sName + ": " + std::to_string(nIntervalInMilliseconds));
+
+		{
+			std::lock_guard<std::mutex> lockGuard(m_SchedulerMutex);
+			auto pTask = findTaskInternal(sName);
+			pTask->m_nIntervalInMilliseconds = nIntervalInMilliseconds;
+
+			// Do not wait for the rest of a longer previous interval
+			uint64_t nNextDueTime = m_pGlobalChrono->getElapsedMicroseconds() + (uint64_t)nIntervalInMilliseconds * 1000;
+			if (pTask->m_nNextDueTimeInMicroseconds > nNextDueTime)
+				pTask->m_nNextDueTimeInMicroseconds = nNextDueTime;
+		}
+
+		m_WakeUpCondition.notify_all();
+	}
+
+	uint32_t CSystemTaskScheduler::getTaskInterval(const std::string& sName)
+	{
+		std::lock_guard<std::mutex> lockGuard(m_SchedulerMutex);
+		return findTaskInternal(sName)->m_nIntervalInMilliseconds;
+	}
+
+	void CSystemTaskScheduler::getTaskStatistics(const std::string& sName, uint64_t& nExecutionCount, uint64_t& nLastDurationInMicroseconds, uint64_t& nMaxDurationInMicroseconds)
+	{
+		std::lock_guard<std::mutex> lockGuard(m_SchedulerMutex);
+		auto pTask = findTaskInternal(sName);
+		nExecutionCount = pTask->m_nExecutionCount;
+		nLastDurationInMicroseconds = pTask->m_nLastDurationInMicroseconds;
+		nMaxDurationInMicroseconds = pTask->m_nMaxDurationInMicroseconds;
+	}
+
+	void CSystemTaskScheduler::wakeTask(const std::string& sName)
+	{
+		{
+			std::lock_guard<std::mutex> lockGuard(m_SchedulerMutex);
+			findTaskInternal(sName)->m_nNextDueTimeInMicroseconds = 0;
+		}
+
+		m_WakeUpCondition.notify_all();
+	}
+
+	void CSystemTaskScheduler::run()
+	{
+		std::unique_lock<std::mutex> lock(m_SchedulerMutex);
+
+		while (!m_bTerminationRequested) {
+
+			uint64_t nCurrentTime = m_pGlobalChrono->getElapsedMicroseconds();
+
+			// Of all due tasks, the one that has been waiting longest runs first
+			PSystemTask pDueTask;
+			uint64_t nNextDueTime = UINT64_MAX;
+			for (auto pTask : m_Tasks) {
+				if (pTask->m_nNextDueTimeInMicroseconds < nNextDueTime) {
+					nNextDueTime = pTask->m_nNextDueTimeInMicroseconds;
+					if (nNextDueTime <= nCurrentTime)
+						pDueTask = pTask;
+				}
+			}
+
+			if (pDueTask.get() == nullptr) {
+				if (nNextDueTime == UINT64_MAX)
+					m_WakeUpCondition.wait(lock);
+				else
+					m_WakeUpCondition.wait_for(lock, std::chrono::microseconds(nNextDueTime - nCurrentTime));
+
+				continue;
+			}
+
+			// Intervals are measured from the start of an execution. Missed executions are not caught up.
+			pDueTask->m_nNextDueTimeInMicroseconds = nCurrentTime + (uint64_t)pDueTask->m_nIntervalInMilliseconds * 1000;
+
+			lock.unlock();
+
+			if (pDueTask->m_pTelemetryChannel.get() != nullptr) {
+				auto telemetryScope = pDueTask->m_pTelemetryChannel->startIntervalScope(0);
+				pDueTask->m_TaskFunction();
+			}
+			else {
+				pDueTask->m_TaskFunction();
+			}
+
+			uint64_t nDuration = m_pGlobalChrono->getElapsedMicroseconds() - nCurrentTime;
+
+			lock.lock();
+
+			pDueTask->m_nExecutionCount++;
+			pDueTask->m_nLastDurationInMicroseconds = nDuration;
+			if (nDuration > pDueTask->m_nMaxDurationInMicroseconds)
+				pDueTask->m_nMaxDurationInMicroseconds = nDuration;
+		}
+	}
+
+	void CSystemTaskScheduler::requestTermination()
+	{
+		{
+			std::lock_guard<std::mutex> lockGuard(m_SchedulerMutex);
+			m_bTerminationRequested = true;
+		}
+
+		m_WakeUpCondition.notify_all();
+	}
+
+	void CSystemTaskScheduler::clearTerminationRequest()
+	{
+		std::lock_guard<std::mutex> lockGuard(m_SchedulerMutex);
+		m_bTerminationRequested = false;
+	}
+
+}
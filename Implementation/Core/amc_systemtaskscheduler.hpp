@@ -0,0 +1,135 @@
+/*++
+
+Copyright (C) 2025 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#ifndef __AMC_SYSTEMTASKSCHEDULER
+#define __AMC_SYSTEMTASKSCHEDULER
+
+#include <memory>
+#include <map>
+#include <vector>
+#include <string>
+#include <mutex>
+#include <functional>
+#include <condition_variable>
+
+#include "common_chrono.hpp"
+
+#define AMC_SYSTEMTASK_MININTERVAL_MILLISECONDS 1
+#define AMC_SYSTEMTASK_MAXINTERVAL_MILLISECONDS 3600000
+
+namespace AMC {
+
+	class CSystemTask;
+	class CSystemTaskScheduler;
+	class CTelemetryHandler;
+	class CTelemetryChannel;
+
+	typedef std::shared_ptr<CSystemTask> PSystemTask;
+	typedef std::shared_ptr<CSystemTaskScheduler> PSystemTaskScheduler;
+	typedef std::shared_ptr<CTelemetryHandler> PTelemetryHandler;
+	typedef std::shared_ptr<CTelemetryChannel> PTelemetryChannel;
+
+	typedef std::function<void()> SystemTaskFunction;
+
+	// A maintenance task of the system thread. The scheduling state is owned by the scheduler and protected by its mutex.
+	class CSystemTask {
+	private:
+
+		std::string m_sName;
+		std::string m_sDescription;
+		SystemTaskFunction m_TaskFunction;
+		PTelemetryChannel m_pTelemetryChannel;
+
+		uint32_t m_nIntervalInMilliseconds;
+		uint64_t m_nNextDueTimeInMicroseconds;
+		uint64_t m_nExecutionCount;
+		uint64_t m_nLastDurationInMicroseconds;
+		uint64_t m_nMaxDurationInMicroseconds;
+
+		friend class CSystemTaskScheduler;
+
+	public:
+
+		CSystemTask(const std::string& sName, const std::string& sDescription, uint32_t nIntervalInMilliseconds, SystemTaskFunction taskFunction, PTelemetryChannel pTelemetryChannel);
+		virtual ~CSystemTask();
+
+		std::string getName();
+		std::string getDescription();
+
+	};
+
+	// Runs the maintenance tasks of the system thread, each at its own interval. The thread sleeps until the next task
+	// is due, or until a task is woken up by an event.
+	class CSystemTaskScheduler {
+	private:
+
+		std::mutex m_SchedulerMutex;
+		std::condition_variable m_WakeUpCondition;
+
+		std::vector<PSystemTask> m_Tasks;
+		std::map<std::string, PSystemTask> m_TaskMap;
+
+		bool m_bTerminationRequested;
+
+		AMCCommon::PChrono m_pGlobalChrono;
+		PTelemetryHandler m_pTelemetryHandler;
+
+		PSystemTask findTaskInternal(const std::string& sName);
+
+	public:
+
+		// The telemetry handler may be null. Otherwise the run time of every task is recorded in a telemetry channel.
+		CSystemTaskScheduler(AMCCommon::PChrono pGlobalChrono, PTelemetryHandler pTelemetryHandler);
+		virtual ~CSystemTaskScheduler();
+
+		void registerTask(const std::string& sName, const std::string& sDescription, uint32_t nIntervalInMilliseconds, SystemTaskFunction taskFunction);
+
+		bool hasTask(const std::string& sName);
+
+		void setTaskInterval(const std::string& sName, uint32_t nIntervalInMilliseconds);
+		uint32_t getTaskInterval(const std::string& sName);
+
+		void getTaskStatistics(const std::string& sName, uint64_t& nExecutionCount, uint64_t& nLastDurationInMicroseconds, uint64_t& nMaxDurationInMicroseconds);
+
+		// Makes a task due immediately. May be called from any thread.
+		void wakeTask(const std::string& sName);
+
+		// Executes due tasks until termination is requested. Exceptions of a task are passed on to the caller.
+		void run();
+
+		void requestTermination();
+		void clearTerminationRequest();
+
+	};
+
+}
+
+#endif //__AMC_SYSTEMTASKSCHEDULER
@@ -221,25 +221,40 @@ namespace AMC {
 		if (nMaxChunkIndexOneBased > nReasonableMaxChunkIndex)
 			throw ELibMCCustomException(LIBMC_ERROR_TELEMETRYCHUNKINDEXOUTOFRANGE, std::to_string(nMaxChunkIndexOneBased));
 
-		std::lock_guard<std::mutex> lock(m_ChunkMutex);		
-		for (uint64_t nZeroBasedIndexToAdd = m_Chunks.size(); nZeroBasedIndexToAdd < nMaxChunkIndexOneBased; nZeroBasedIndexToAdd++) {
-			uint64_t nChunkStartTimestamp = nZeroBasedIndexToAdd * m_nChunkIntervalInMicroseconds;
-			uint64_t nChunkEndTimestamp = nChunkStartTimestamp + m_nChunkIntervalInMicroseconds - 1;
+		bool bChunksQueued = false;
+		{
+			std::lock_guard<std::mutex> lock(m_ChunkMutex);
+			for (uint64_t nZeroBasedIndexToAdd = m_Chunks.size(); nZeroBasedIndexToAdd < nMaxChunkIndexOneBased; nZeroBasedIndexToAdd++) {
+				uint64_t nChunkStartTimestamp = nZeroBasedIndexToAdd * m_nChunkIntervalInMicroseconds;
+				uint64_t nChunkEndTimestamp = nChunkStartTimestamp + m_nChunkIntervalInMicroseconds - 1;
 
-			uint64_t nOneBasedChunkIndex = nZeroBasedIndexToAdd + 1;
+				uint64_t nOneBasedChunkIndex = nZeroBasedIndexToAdd + 1;
 
-			auto pChunk = std::make_shared<CTelemetryDataChunk>(this, nOneBasedChunkIndex, nChunkStartTimestamp, nChunkEndTimestamp);
-			m_Chunks.emplace_back(pChunk);
+				auto pChunk = std::make_shared<CTelemetryDataChunk>(this, nOneBasedChunkIndex, nChunkStartTimestamp, nChunkEndTimestamp);
+				m_Chunks.emplace_back(pChunk);
 
-			// We make all chunks read-only except for the last two chunks (which might get some writing due to timing race conditions)
-			if (nZeroBasedIndexToAdd >= 2) {
-				uint64_t nZeroBasedMakeReadonly = nZeroBasedIndexToAdd - 2;
-				auto pChunkToMakeReadonly = m_Chunks.at(nZeroBasedMakeReadonly);
-				pChunkToMakeReadonly->makeReadOnly();
+				// We make all chunks read-only except for the last two chunks (which might get some writing due to timing race conditions)
+				if (nZeroBasedIndexToAdd >= 2) {
+					uint64_t nZeroBasedMakeReadonly = nZeroBasedIndexToAdd - 2;
+					auto pChunkToMakeReadonly = m_Chunks.at(nZeroBasedMakeReadonly);
+					pChunkToMakeReadonly->makeReadOnly();
 
+					std::lock_guard<std::mutex> archiveLock(m_ArchiveQueueMutex);
+					m_ArchiveQueue.push (pChunkToMakeReadonly);
+					bChunksQueued = true;
+				}
+			}
+		}
+
+		if (bChunksQueued) {
+			std::function<void()> callback;
+			{
 				std::lock_guard<std::mutex> archiveLock(m_ArchiveQueueMutex);
-				m_ArchiveQueue.push (pChunkToMakeReadonly);
+				callback = m_ArchiveQueueCallback;
 			}
+
+			if (callback)
+				callback();
 		}
 	}
 
@@ -300,6 +315,12 @@ namespace AMC {
 	}
 
 
+	void CTelemetryWriter::setArchiveQueueCallback(std::function<void()> callback)
+	{
+		std::lock_guard<std::mutex> archiveLock(m_ArchiveQueueMutex);
+		m_ArchiveQueueCallback = callback;
+	}
+
 	uint64_t CTelemetryWriter::createMarkerID()
 	{
 		return m_nNextMarkerID.fetch_add(1, std::memory_order_relaxed);
@@ -648,6 +669,11 @@ namespace AMC {
 		m_pTelemetryWriter->archiveOldChunksToDB();
 	}
 
+	void CTelemetryHandler::setArchiveQueueCallback(std::function<void()> callback)
+	{
+		m_pTelemetryWriter->setArchiveQueueCallback(callback);
+	}
+
 }
 
 
@@ -41,6 +41,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <unordered_map>
 #include <map>
 #include <queue>
+#include <functional>
 
 #include "libmcdata_types.hpp"
 
@@ -114,6 +115,7 @@ namespace AMC {
 
 			std::mutex m_ArchiveQueueMutex;
 			std::queue<PTelemetryDataChunk> m_ArchiveQueue;
+			std::function<void()> m_ArchiveQueueCallback;
 
 			uint64_t m_nChunkIntervalInMicroseconds;
 
@@ -147,6 +149,9 @@ namespace AMC {
 
 			void archiveOldChunksToDB();
 
+			// The callback is triggered whenever a chunk has been queued for archiving. It must not call back into the writer.
+			void setArchiveQueueCallback(std::function<void()> callback);
+
 			uint64_t createMarkerID();
 
 			uint64_t getCurrentTimestamp();
@@ -297,6 +302,8 @@ namespace AMC {
 
 		void archiveOldChunksToDB();
 
+		void setArchiveQueueCallback(std::function<void()> callback);
+
 
 	};
 
@@ -39,12 +39,16 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 namespace AMC {
 
-	CToolpathEntity::CToolpathEntity(LibMCData::PDataModel pDataModel, const std::string& sStorageStreamUUID, Lib3MF::PWrapper p3MFWrapper, const std::string& sDebugName, bool bAllowEmptyToolpath, const std::set<std::string>& attachmentRelationsToRead)
+	CToolpathEntity::CToolpathEntity(LibMCData::PDataModel pDataModel, const std::string& sStorageStreamUUID, Lib3MF::PWrapper p3MFWrapper, const std::string& sDebugName, bool bAllowEmptyToolpath, const std::set<std::string>& attachmentRelationsToRead, uint64_t nLayerCacheMemoryQuota, uint32_t nLayerPrefetchCount)
 		: m_ReferenceCount (0), m_sDebugName (sDebugName)
 	{
 		LibMCAssertNotNull(pDataModel.get());
 		LibMCAssertNotNull(p3MFWrapper.get());
 
+		m_pLayerCache = std::make_unique<CToolpathLayerCache<CToolpathLayerData>>(nLayerCacheMemoryQuota, nLayerPrefetchCount, [this](uint32_t nLayerIndex) {
+			return decodeLayer(nLayerIndex);
+		});
+
 		auto pStorage = pDataModel->CreateStorage();
 		m_pStorageStream = pStorage->RetrieveStream(sStorageStreamUUID);
 
@@ -113,6 +117,10 @@ namespace AMC {
 
 	CToolpathEntity::~CToolpathEntity()
 	{
+		// The prefetch thread decodes through this entity, so it needs to stop before anything is released
+		m_pLayerCache->stopPrefetch();
+		m_pLayerCache->clear();
+
 		m_Attachments.clear();
 
 		m_pToolpath = nullptr;
@@ -178,16 +186,40 @@ namespace AMC {
 
 	PToolpathLayerData CToolpathEntity::readLayer(uint32_t nLayerIndex)
 	{
+		auto pLayerData = m_pLayerCache->retrieveLayer(nLayerIndex);
+
+		if (pLayerData.get() == nullptr) {
+			uint64_t nGeneration = m_pLayerCache->getGeneration();
+			pLayerData = decodeLayer(nLayerIndex);
+			m_pLayerCache->addLayer(nLayerIndex, pLayerData, nGeneration);
+		}
+
+		m_pLayerCache->requestPrefetch(nLayerIndex, getLayerCount());
+
+		return pLayerData;
+	}
+
+	PToolpathLayerData CToolpathEntity::decodeLayer(uint32_t nLayerIndex)
+	{
+		// Lib3MF is not thread safe, so the layer is read and converted under the entity lock.
+		// This also covers decoding from the prefetch thread, which shares the model with the entity.
 		std::lock_guard<std::mutex> lockGuard(m_Mutex);
 
 		if (m_pToolpath.get() == nullptr)
 			throw ELibMCInterfaceException(LIBMC_ERROR_BUILDHASNOTOOLPATH);
 
-		double dUnits = m_pToolpath->GetUnits();
-
 		auto p3MFLayerData = m_pToolpath->ReadLayerData(nLayerIndex);
-		auto nZValue = m_pToolpath->GetLayerZMax(nLayerIndex);
-		return std::make_shared<CToolpathLayerData> (m_pToolpath, p3MFLayerData, dUnits, nZValue, m_sDebugName, m_CustomSegmentAttributes);
+		return std::make_shared<CToolpathLayerData> (m_pToolpath, p3MFLayerData, m_pToolpath->GetUnits(), m_pToolpath->GetLayerZMax(nLayerIndex), m_sDebugName, m_CustomSegmentAttributes);
+	}
+
+	uint64_t CToolpathEntity::getLayerCacheMemoryQuota()
+	{
+		return m_pLayerCache->getMemoryQuota();
+	}
+
+	uint64_t CToolpathEntity::getLayerCacheMemoryUsage()
+	{
+		return m_pLayerCache->getMemoryUsage();
 	}
 
 
@@ -383,6 +415,9 @@ namespace AMC {
 		m_CustomSegmentAttributes.push_back(pSegmentAttribute) ;
 
 		m_CustomSegmentAttributeMap.insert(std::make_pair (key, pSegmentAttribute));
+
+		// Cached layers have been decoded without the new attribute
+		m_pLayerCache->clear();
 		
 	}
 
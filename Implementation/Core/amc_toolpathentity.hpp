@@ -39,6 +39,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <set>
 
 #include "amc_toolpathlayerdata.hpp"
+#include "amc_toolpathlayercache.hpp"
 #include "amc_toolpathpart.hpp"
 #include "amc_xmldocument.hpp"
 
@@ -78,6 +79,12 @@ namespace AMC {
 
 		std::string m_sDebugName;
 
+		// Decoded layer cache. Lock order is m_Mutex before the cache mutexes, never the other way round.
+		std::unique_ptr<CToolpathLayerCache<CToolpathLayerData>> m_pLayerCache;
+
+		// Reads a layer from the 3MF toolpath under m_Mutex and decodes it without holding the mutex (mutex protected)
+		PToolpathLayerData decodeLayer(uint32_t nLayerIndex);
+
 		void copyMetaDataNode (AMC::PXMLDocumentNodeInstance pTargetNodeInstance, Lib3MF::PCustomXMLNode pSourceNodeInstance);
 
 		Lib3MF::PAttachment findBinaryMetaData(const std::string& sPath, bool bMustExist);
@@ -86,7 +93,7 @@ namespace AMC {
 
 	public:
 
-		CToolpathEntity(LibMCData::PDataModel pDataModel, const std::string & sStorageStreamUUID, Lib3MF::PWrapper p3MFWrapper, const std::string & sDebugName, bool bAllowEmptyToolpath, const std::set<std::string> & attachmentRelationsToRead);
+		CToolpathEntity(LibMCData::PDataModel pDataModel, const std::string & sStorageStreamUUID, Lib3MF::PWrapper p3MFWrapper, const std::string & sDebugName, bool bAllowEmptyToolpath, const std::set<std::string> & attachmentRelationsToRead, uint64_t nLayerCacheMemoryQuota, uint32_t nLayerPrefetchCount);
 		virtual ~CToolpathEntity();		
 
 		void IncRef();
@@ -96,6 +103,9 @@ namespace AMC {
 
 		PToolpathLayerData readLayer(uint32_t nLayerIndex);
 
+		uint64_t getLayerCacheMemoryQuota();
+		uint64_t getLayerCacheMemoryUsage();
+
 		double getUnits();
 
 		std::string getDebugName ();
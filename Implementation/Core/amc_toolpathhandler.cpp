@@ -39,7 +39,9 @@ namespace AMC {
 
 
 	CToolpathHandler::CToolpathHandler(LibMCData::PDataModel pDataModel)
-		: m_pDataModel(pDataModel)
+		: m_pDataModel(pDataModel),
+		m_nLayerCacheMemoryQuotaInMB (AMC_TOOLPATH_LAYERCACHE_DEFAULTMEMORYQUOTA_MB),
+		m_nLayerPrefetchCount (AMC_TOOLPATH_LAYERCACHE_DEFAULTPREFETCHCOUNT)
 	{
 		LibMCAssertNotNull(pDataModel.get());
 	
@@ -74,7 +76,7 @@ namespace AMC {
 			auto pStorage = m_pDataModel->CreateStorage();
 			auto pStorageStream = pStorage->RetrieveStream(sStreamUUID);
 
-			auto pNewToolpathEntity = std::make_shared<CToolpathEntity>(m_pDataModel, sStreamUUID, getLib3MFWrapper(), pStorageStream->GetName (), true, m_AttachmentRelationsToRead);
+			auto pNewToolpathEntity = std::make_shared<CToolpathEntity>(m_pDataModel, sStreamUUID, getLib3MFWrapper(), pStorageStream->GetName (), true, m_AttachmentRelationsToRead, ((uint64_t)m_nLayerCacheMemoryQuotaInMB) * 1024ULL * 1024ULL, m_nLayerPrefetchCount);
 			pNewToolpathEntity->IncRef();
 			m_Entities.insert(std::make_pair(sStreamUUID, pNewToolpathEntity));
 			return pNewToolpathEntity.get();
@@ -121,6 +123,27 @@ namespace AMC {
 
 	}
 
+	void CToolpathHandler::setLayerCacheParameters(uint32_t nMemoryQuotaInMB, uint32_t nPrefetchCount)
+	{
+		if (nMemoryQuotaInMB > AMC_TOOLPATH_LAYERCACHE_MAXMEMORYQUOTA_MB)
+			throw ELibMCCustomException(LIBMC_ERROR_INVALIDTOOLPATHLAYERCACHEPARAMETER, "memory quota: " + std::to_string(nMemoryQuotaInMB));
+		if (nPrefetchCount > AMC_TOOLPATH_LAYERCACHE_MAXPREFETCHCOUNT)
+			throw ELibMCCustomException(LIBMC_ERROR_INVALIDTOOLPATHLAYERCACHEPARAMETER, "prefetch count: " + std::to_string(nPrefetchCount));
+
+		m_nLayerCacheMemoryQuotaInMB = nMemoryQuotaInMB;
+		m_nLayerPrefetchCount = nPrefetchCount;
+	}
+
+	uint32_t CToolpathHandler::getLayerCacheMemoryQuotaInMB()
+	{
+		return m_nLayerCacheMemoryQuotaInMB;
+	}
+
+	uint32_t CToolpathHandler::getLayerPrefetchCount()
+	{
+		return m_nLayerPrefetchCount;
+	}
+
 	void CToolpathHandler::registerAttachmentRelationsToRead(const std::string& sRelationShip)
 	{
 		m_AttachmentRelationsToRead.insert(sRelationShip);
@@ -62,6 +62,10 @@ namespace AMC {
 
 		std::map<std::string, PScatterplot> m_Scatterplots;
 
+		// Applies to toolpath entities that are loaded afterwards
+		uint32_t m_nLayerCacheMemoryQuotaInMB;
+		uint32_t m_nLayerPrefetchCount;
+
 	public:
 
 		CToolpathHandler(LibMCData::PDataModel pDataModel);
@@ -77,6 +81,11 @@ namespace AMC {
 
 		Lib3MF::PWrapper getLib3MFWrapper();
 
+		// A memory quota of 0 disables the layer cache, a prefetch count of 0 disables prefetching.
+		void setLayerCacheParameters(uint32_t nMemoryQuotaInMB, uint32_t nPrefetchCount);
+		uint32_t getLayerCacheMemoryQuotaInMB();
+		uint32_t getLayerPrefetchCount();
+
 		void registerAttachmentRelationsToRead(const std::string & sRelationShip);
 
 		void unregisterAttachmentRelationsToRead(const std::string& sRelationShip);
@@ -0,0 +1,322 @@
+/*++
+
+Copyright (C) 2025 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#ifndef __AMC_TOOLPATHLAYERCACHE
+#define __AMC_TOOLPATHLAYERCACHE
+
+#include <memory>
+#include <string>
+#include <thread>
+#include <mutex>
+#include <list>
+#include <unordered_map>
+#include <functional>
+#include <condition_variable>
+
+#include "libmc_exceptiontypes.hpp"
+
+// Default memory quota of the decoded layer cache per toolpath entity in megabytes
+#define AMC_TOOLPATH_LAYERCACHE_DEFAULTMEMORYQUOTA_MB 256
+#define AMC_TOOLPATH_LAYERCACHE_MAXMEMORYQUOTA_MB (64 * 1024)
+// Default number of layers that are decoded in advance after a layer has been read
+#define AMC_TOOLPATH_LAYERCACHE_DEFAULTPREFETCHCOUNT 2
+#define AMC_TOOLPATH_LAYERCACHE_MAXPREFETCHCOUNT 64
+
+namespace AMC {
+
+	// LRU cache of decoded layers, bounded by a memory quota in the same way as CStateJournalStreamCache.
+	// TLayerData needs to provide uint64_t getMemoryUsage().
+	// An optional prefetch thread decodes the layers following the last layer that has been read.
+	template <class TLayerData> class CToolpathLayerCache {
+	public:
+		typedef std::shared_ptr<TLayerData> PLayerData;
+
+		// Decodes a layer. Called from the prefetch thread, so it needs to do its own locking.
+		typedef std::function<PLayerData(uint32_t nLayerIndex)> LayerDecodeFunction;
+
+	private:
+
+		std::mutex m_CacheMutex;
+		uint64_t m_nMemoryUsage;
+		uint64_t m_nMemoryQuota;
+
+		// Increased by every clear, so that layers decoded before a clear do not enter the cache afterwards
+		uint64_t m_nGeneration;
+
+		// Doubly linked list to store the decoded layers in LRU order
+		std::list<std::pair<uint32_t, PLayerData>> m_CacheList;
+
+		// Hash map to store the mapping from layer index to list iterator
+		std::unordered_map<uint32_t, typename std::list<std::pair<uint32_t, PLayerData>>::iterator> m_CacheMap;
+
+		// Prefetch thread, the lock order is m_PrefetchMutex before m_CacheMutex
+		std::mutex m_PrefetchMutex;
+		std::condition_variable m_PrefetchCondition;
+		std::thread m_PrefetchThread;
+		LayerDecodeFunction m_DecodeFunction;
+		uint32_t m_nPrefetchCount;
+		bool m_bPrefetchThreadStarted;
+		bool m_bPrefetchCancelled;
+		bool m_bPrefetchRequested;
+		uint32_t m_nPrefetchLayerIndex;
+		uint32_t m_nPrefetchLayerCount;
+
+		// Enforces the memory quota (m_CacheMutex must be locked)
+		void enforceMemoryQuotaInternal(uint64_t nAdditionalMemory)
+		{
+			while (((m_nMemoryUsage + nAdditionalMemory) > m_nMemoryQuota) && !(m_CacheList.empty())) {
+				auto& lastEntry = m_CacheList.back();
+
+				uint64_t nLayerMemoryUsage = lastEntry.second->getMemoryUsage();
+				if (nLayerMemoryUsage > m_nMemoryUsage)
+					throw ELibMCInterfaceException(LIBMC_ERROR_TOOLPATHLAYERCACHEBOOKKEEPINGERROR);
+
+				m_nMemoryUsage -= nLayerMemoryUsage;
+				m_CacheMap.erase(lastEntry.first);
+				m_CacheList.pop_back();
+			}
+		}
+
+		void prefetchThreadLoop()
+		{
+			while (true) {
+				uint32_t nLayerIndex = 0;
+				uint32_t nLayerCount = 0;
+
+				{
+					std::unique_lock<std::mutex> prefetchLock(m_PrefetchMutex);
+					m_PrefetchCondition.wait(prefetchLock, [this] { return m_bPrefetchCancelled || m_bPrefetchRequested; });
+
+					if (m_bPrefetchCancelled)
+						return;
+
+					nLayerIndex = m_nPrefetchLayerIndex;
+					nLayerCount = m_nPrefetchLayerCount;
+					m_bPrefetchRequested = false;
+				}
+
+				for (uint32_t nOffset = 1; nOffset <= m_nPrefetchCount; nOffset++) {
+
+					{
+						// Abort early if the consumer has already moved on
+						std::lock_guard<std::mutex> prefetchLock(m_PrefetchMutex);
+						if (m_bPrefetchCancelled || m_bPrefetchRequested)
+							break;
+					}
+
+					uint64_t nPrefetchLayerIndex = (uint64_t)nLayerIndex + nOffset;
+					if (nPrefetchLayerIndex >= nLayerCount)
+						break;
+
+					try {
+						if (retrieveLayer((uint32_t)nPrefetchLayerIndex).get() == nullptr) {
+							uint64_t nGeneration = getGeneration();
+							auto pLayerData = m_DecodeFunction((uint32_t)nPrefetchLayerIndex);
+							addLayer((uint32_t)nPrefetchLayerIndex, pLayerData, nGeneration);
+						}
+					}
+					catch (...) {
+						// Prefetching is best effort. The error will surface when the layer is actually read.
+						break;
+					}
+				}
+			}
+		}
+
+	public:
+
+		CToolpathLayerCache(uint64_t nMemoryQuota, uint32_t nPrefetchCount, LayerDecodeFunction decodeFunction)
+			: m_nMemoryUsage(0),
+			m_nMemoryQuota(nMemoryQuota),
+			m_nGeneration(0),
+			m_DecodeFunction(decodeFunction),
+			m_nPrefetchCount(nPrefetchCount),
+			m_bPrefetchThreadStarted(false),
+			m_bPrefetchCancelled(false),
+			m_bPrefetchRequested(false),
+			m_nPrefetchLayerIndex(0),
+			m_nPrefetchLayerCount(0)
+		{
+			if (nPrefetchCount > AMC_TOOLPATH_LAYERCACHE_MAXPREFETCHCOUNT)
+				throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDTOOLPATHLAYERCACHEPARAMETER);
+			if ((nPrefetchCount > 0) && (!decodeFunction))
+				throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDPARAM);
+
+			// Prefetched layers would be discarded right away without a cache
+			if (nMemoryQuota == 0)
+				m_nPrefetchCount = 0;
+		}
+
+		virtual ~CToolpathLayerCache()
+		{
+			stopPrefetch();
+		}
+
+		// Stops the prefetch thread. Needs to be called before anything the decode function uses is released.
+		void stopPrefetch()
+		{
+			{
+				std::lock_guard<std::mutex> prefetchLock(m_PrefetchMutex);
+				m_bPrefetchCancelled = true;
+			}
+			m_PrefetchCondition.notify_all();
+
+			if (m_PrefetchThread.joinable())
+				m_PrefetchThread.join();
+		}
+
+		// Returns a cached layer and marks it as most recently used, or null if not cached
+		PLayerData retrieveLayer(uint32_t nLayerIndex)
+		{
+			std::lock_guard<std::mutex> cacheLock(m_CacheMutex);
+
+			auto iIter = m_CacheMap.find(nLayerIndex);
+			if (iIter == m_CacheMap.end())
+				return nullptr;
+
+			// Move the accessed entry to the front of the list
+			m_CacheList.splice(m_CacheList.begin(), m_CacheList, iIter->second);
+
+			return iIter->second->second;
+		}
+
+		// Returns the generation that needs to be passed to addLayer for a layer that is decoded now
+		uint64_t getGeneration()
+		{
+			std::lock_guard<std::mutex> cacheLock(m_CacheMutex);
+			return m_nGeneration;
+		}
+
+		// Adds a decoded layer to the cache. Returns false if the layer does not fit into the quota at all,
+		// or if the cache has been cleared since nGeneration has been retrieved.
+		bool addLayer(uint32_t nLayerIndex, PLayerData pLayerData, uint64_t nGeneration)
+		{
+			if (pLayerData.get() == nullptr)
+				throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDPARAM);
+
+			uint64_t nLayerMemoryUsage = pLayerData->getMemoryUsage();
+
+			std::lock_guard<std::mutex> cacheLock(m_CacheMutex);
+
+			if (nGeneration != m_nGeneration)
+				return false;
+
+			// Layers that do not fit into the cache at all are handed out uncached
+			if (nLayerMemoryUsage > m_nMemoryQuota)
+				return false;
+
+			auto iIter = m_CacheMap.find(nLayerIndex);
+			if (iIter != m_CacheMap.end()) {
+				m_nMemoryUsage -= iIter->second->second->getMemoryUsage();
+				m_CacheList.erase(iIter->second);
+				m_CacheMap.erase(iIter);
+			}
+
+			enforceMemoryQuotaInternal(nLayerMemoryUsage);
+
+			m_CacheList.push_front(std::make_pair(nLayerIndex, pLayerData));
+			m_CacheMap[nLayerIndex] = m_CacheList.begin();
+
+			m_nMemoryUsage += nLayerMemoryUsage;
+
+			return true;
+		}
+
+		// Removes all cached layers and invalidates layers that are being decoded
+		void clear()
+		{
+			std::lock_guard<std::mutex> cacheLock(m_CacheMutex);
+
+			m_CacheMap.clear();
+			m_CacheList.clear();
+			m_nMemoryUsage = 0;
+			m_nGeneration++;
+		}
+
+		// Schedules the layers after nLayerIndex for decoding in the prefetch thread.
+		// The thread is started with the first request.
+		void requestPrefetch(uint32_t nLayerIndex, uint32_t nLayerCount)
+		{
+			if (m_nPrefetchCount == 0)
+				return;
+
+			{
+				std::lock_guard<std::mutex> prefetchLock(m_PrefetchMutex);
+				if (m_bPrefetchCancelled)
+					return;
+
+				m_nPrefetchLayerIndex = nLayerIndex;
+				m_nPrefetchLayerCount = nLayerCount;
+				m_bPrefetchRequested = true;
+
+				if (!m_bPrefetchThreadStarted) {
+					m_PrefetchThread = std::thread(&CToolpathLayerCache::prefetchThreadLoop, this);
+					m_bPrefetchThreadStarted = true;
+				}
+			}
+
+			m_PrefetchCondition.notify_one();
+		}
+
+		bool hasLayer(uint32_t nLayerIndex)
+		{
+			std::lock_guard<std::mutex> cacheLock(m_CacheMutex);
+			return (m_CacheMap.find(nLayerIndex) != m_CacheMap.end());
+		}
+
+		uint32_t getLayerCount()
+		{
+			std::lock_guard<std::mutex> cacheLock(m_CacheMutex);
+			return (uint32_t)m_CacheList.size();
+		}
+
+		uint64_t getMemoryQuota()
+		{
+			return m_nMemoryQuota;
+		}
+
+		uint64_t getMemoryUsage()
+		{
+			std::lock_guard<std::mutex> cacheLock(m_CacheMutex);
+			return m_nMemoryUsage;
+		}
+
+		uint32_t getPrefetchCount()
+		{
+			return m_nPrefetchCount;
+		}
+
+	};
+
+}
+
+
+#endif //__AMC_TOOLPATHLAYERCACHE
@@ -40,7 +40,7 @@ namespace AMC {
 
 
 	CToolpathCustomSegmentAttribute::CToolpathCustomSegmentAttribute(uint32_t nInternalAttributeID, const std::string& sNameSpace, const std::string& sAttributeName, LibMCEnv::eToolpathAttributeType attributeType)
-		: m_sNameSpace (sNameSpace), m_sAttributeName (sAttributeName), m_AttributeType (attributeType), m_n3MFAttributeID (0), m_nInternalAttributeID (nInternalAttributeID)
+		: m_sNameSpace (sNameSpace), m_sAttributeName (sAttributeName), m_AttributeType (attributeType), m_nInternalAttributeID (nInternalAttributeID)
 	{
 
 	}
@@ -55,16 +55,6 @@ namespace AMC {
 		return m_nInternalAttributeID;
 	}
 
-	uint32_t CToolpathCustomSegmentAttribute::get3MFAttributeID()
-	{
-		return m_n3MFAttributeID;
-	}
-
-	void CToolpathCustomSegmentAttribute::set3MFAttributeID(uint32_t nAttributeID)
-	{
-		m_n3MFAttributeID = nAttributeID;
-	}
-
 	LibMCEnv::eToolpathAttributeType CToolpathCustomSegmentAttribute::getAttributeType()
 	{
 		return m_AttributeType;
@@ -195,6 +185,81 @@ namespace AMC {
 		return m_nProfileIndex;
 	}
 
+	void CToolpathLayerProfile::bindValueHandles(std::map<std::pair<std::string, std::string>, uint32_t>& valueHandleMap)
+	{
+		for (auto& profileValue : m_ProfileValues) {
+
+			uint32_t nValueHandle = 0;
+			auto iHandleIter = valueHandleMap.find(profileValue.first);
+			if (iHandleIter != valueHandleMap.end()) {
+				nValueHandle = iHandleIter->second;
+			}
+			else {
+				nValueHandle = (uint32_t)valueHandleMap.size() + 1;
+				valueHandleMap.insert(std::make_pair(profileValue.first, nValueHandle));
+			}
+
+			if (m_HandleValues.size() < nValueHandle) {
+				sToolpathLayerProfileValue emptyValue;
+				emptyValue.m_bExists = false;
+				emptyValue.m_bIsDouble = false;
+				emptyValue.m_bIsInteger = false;
+				emptyValue.m_bIsBool = false;
+				emptyValue.m_dValue = 0.0;
+				emptyValue.m_nValue = 0;
+				emptyValue.m_bValue = false;
+				m_HandleValues.resize(nValueHandle, emptyValue);
+			}
+
+			auto& typedValue = m_HandleValues.at((size_t)nValueHandle - 1);
+			typedValue.m_bExists = true;
+			typedValue.m_sValue = profileValue.second;
+
+			try {
+				typedValue.m_dValue = AMCCommon::CUtils::stringToDouble(profileValue.second);
+				typedValue.m_bIsDouble = true;
+			}
+			catch (...) {
+				typedValue.m_bIsDouble = false;
+			}
+
+			try {
+				typedValue.m_nValue = AMCCommon::CUtils::stringToIntegerWithAccuracy(profileValue.second, PARAMETER_INTEGERACCURACY);
+				typedValue.m_bIsInteger = true;
+			}
+			catch (...) {
+				typedValue.m_bIsInteger = false;
+			}
+
+			std::string sTrimmedValue = AMCCommon::CUtils::trimString(AMCCommon::CUtils::toLowerString(profileValue.second));
+			if (sTrimmedValue == "true") {
+				typedValue.m_bValue = true;
+				typedValue.m_bIsBool = true;
+			}
+			else if (sTrimmedValue == "false") {
+				typedValue.m_bValue = false;
+				typedValue.m_bIsBool = true;
+			}
+			else {
+				typedValue.m_bValue = (typedValue.m_nValue != 0);
+				typedValue.m_bIsBool = typedValue.m_bIsInteger;
+			}
+
+		}
+	}
+
+	sToolpathLayerProfileValue* CToolpathLayerProfile::findValueByHandle(uint32_t nValueHandle)
+	{
+		if ((nValueHandle == 0) || (nValueHandle > m_HandleValues.size()))
+			return nullptr;
+
+		auto pValue = &m_HandleValues[(size_t)nValueHandle - 1];
+		if (!pValue->m_bExists)
+			return nullptr;
+
+		return pValue;
+	}
+
 	LibMCEnv::eToolpathProfileModificationType CToolpathLayerProfile::getModificationType(const std::string& sNameSpace, const std::string& sValueName)
 	{
 		auto iIter = m_ProfileModifiers.find(std::make_pair(sNameSpace, sValueName));
@@ -234,10 +299,13 @@ namespace AMC {
 		uint32_t nSegmentCount = p3MFLayer->GetSegmentCount();
 		uint32_t nTotalPointCount = 0;
 
+		// The attribute IDs are specific to this layer. They are kept locally, as the attribute objects are shared with layers that are decoded concurrently.
+		std::vector<uint32_t> attribute3MFIDs;
+		attribute3MFIDs.reserve(m_CustomSegmentAttributes.size());
 		for (auto& attribute : m_CustomSegmentAttributes) {
 			std::string sNameSpace = attribute->getNameSpace();
 			std::string sAttributeName = attribute->getAttributeName();
-			attribute->set3MFAttributeID (p3MFLayer->FindSegmentAttributeIDByName (sNameSpace, sAttributeName));
+			attribute3MFIDs.push_back (p3MFLayer->FindSegmentAttributeIDByName (sNameSpace, sAttributeName));
 			m_CustomSegmentAttributeMap.insert (std::make_pair (std::make_pair (sNameSpace, sAttributeName), attribute));
 		}
 
@@ -287,6 +355,7 @@ namespace AMC {
 
 				segment.m_3MFSegmentIndex = nSegmentIndex;
 				segment.m_ProfileUUID = registerUUID(sProfileUUID);
+				segment.m_ProfileIndex = storeProfileData(pToolpath, sProfileUUID);
 				segment.m_PartUUID = registerUUID(sBuildItemUUID);
 				segment.m_LocalPartID = nLocalPartID;
 				segment.m_LaserIndex = 0;
@@ -296,13 +365,15 @@ namespace AMC {
 					segment.m_AttributeData = &m_SegmentAttributeData.at((size_t)nSegmentIndex * m_CustomSegmentAttributes.size());
 					int64_t* pAttributeData = segment.m_AttributeData;
 
-					for (auto& attribute : m_CustomSegmentAttributes) {
+					for (size_t nAttributeIndex = 0; nAttributeIndex < m_CustomSegmentAttributes.size(); nAttributeIndex++) {
+						auto& attribute = m_CustomSegmentAttributes.at(nAttributeIndex);
+						uint32_t nAttribute3MFID = attribute3MFIDs.at(nAttributeIndex);
 						switch (attribute->getAttributeType()) {
 						case LibMCEnv::eToolpathAttributeType::Integer:
-							*pAttributeData = p3MFLayer->GetSegmentIntegerAttributeByID(nSegmentIndex, attribute->get3MFAttributeID());
+							*pAttributeData = p3MFLayer->GetSegmentIntegerAttributeByID(nSegmentIndex, nAttribute3MFID);
 							break;
 						case LibMCEnv::eToolpathAttributeType::Double:
-							*((double*)pAttributeData) = p3MFLayer->GetSegmentDoubleAttributeByID(nSegmentIndex, attribute->get3MFAttributeID());
+							*((double*)pAttributeData) = p3MFLayer->GetSegmentDoubleAttributeByID(nSegmentIndex, nAttribute3MFID);
 							break;
 						default:
 							throw ELibMCCustomException(LIBMC_ERROR_INVALIDTOOLPATHATTRIBUTETYPE, m_sDebugName);
@@ -316,12 +387,12 @@ namespace AMC {
 				}
 
 				m_Segments.push_back(segment);
-
-				storeProfileData(pToolpath, sProfileUUID);
 			}
 
 		}
 
+		registerProfileValueHandles();
+
 		// Read point information
 		m_Points.resize(nTotalPointCount);
 		m_OverrideFactors.resize(nTotalPointCount);
@@ -658,6 +729,25 @@ namespace AMC {
 		return m_sUUID;
 	}
 
+	uint64_t CToolpathLayerData::getMemoryUsage()
+	{
+		uint64_t nMemoryUsage = sizeof(CToolpathLayerData);
+
+		nMemoryUsage += (uint64_t)m_Segments.capacity() * sizeof(sToolpathLayerSegment);
+		nMemoryUsage += (uint64_t)m_SegmentAttributeData.capacity() * sizeof(int64_t);
+		nMemoryUsage += (uint64_t)m_Points.capacity() * sizeof(LibMCEnv::sPosition2D);
+		nMemoryUsage += (uint64_t)m_OverrideFactors.capacity() * sizeof(sToolpathLayerOverride);
+		nMemoryUsage += (uint64_t)m_InterpolationData.capacity() * sizeof(Lib3MF::sHatchModificationInterpolationData);
+
+		for (auto& sUUID : m_UUIDs)
+			nMemoryUsage += 2 * (sizeof(std::string) + sUUID.length());
+
+		for (auto& customData : m_CustomData)
+			nMemoryUsage += customData.first.first.length() + customData.first.second.length() + customData.second.length();
+
+		return nMemoryUsage;
+	}
+
 	uint32_t CToolpathLayerData::getSegmentPointCount(const uint32_t nSegmentIndex)
 	{
 		if (nSegmentIndex >= m_Segments.size())
@@ -843,8 +933,136 @@ namespace AMC {
 		if (nSegmentIndex >= m_Segments.size())
 			throw ELibMCCustomException(LIBMC_ERROR_INVALIDSEGMENTINDEX, m_sDebugName);
 
-		auto sProfileUUID = getRegisteredUUID(m_Segments[nSegmentIndex].m_ProfileUUID);
-		return retrieveProfileData(sProfileUUID );
+		uint32_t nProfileIndex = m_Segments[nSegmentIndex].m_ProfileIndex;
+		if (nProfileIndex >= m_ProfileList.size())
+			throw ELibMCCustomException(LIBMC_ERROR_PROFILENOTFOUND, m_sDebugName);
+
+		return m_ProfileList[nProfileIndex];
+	}
+
+	uint32_t CToolpathLayerData::resolveProfileValueHandle(const std::string& sNameSpace, const std::string& sValueName)
+	{
+		auto iIter = m_ProfileValueHandleMap.find(std::make_pair(sNameSpace, sValueName));
+		if (iIter == m_ProfileValueHandleMap.end())
+			return 0;
+
+		return iIter->second;
+	}
+
+	std::string CToolpathLayerData::getProfileValueHandleName(const uint32_t nValueHandle)
+	{
+		if ((nValueHandle == 0) || (nValueHandle > m_ProfileValueHandleNames.size()))
+			return std::to_string(nValueHandle);
+
+		auto& handleName = m_ProfileValueHandleNames[(size_t)nValueHandle - 1];
+		return handleName.first + "/" + handleName.second;
+	}
+
+	sToolpathLayerProfileValue* CToolpathLayerData::findSegmentProfileValueByHandle(const uint32_t nSegmentIndex, const uint32_t nValueHandle)
+	{
+		if (nSegmentIndex >= m_Segments.size())
+			throw ELibMCCustomException(LIBMC_ERROR_INVALIDSEGMENTINDEX, m_sDebugName);
+
+		if (nValueHandle > m_ProfileValueHandleNames.size())
+			throw ELibMCCustomException(LIBMC_ERROR_INVALIDPROFILEVALUEHANDLE, std::to_string(nValueHandle) + " in " + m_sDebugName);
+
+		if (nValueHandle == 0)
+			return nullptr;
+
+		uint32_t nProfileIndex = m_Segments[nSegmentIndex].m_ProfileIndex;
+		if (nProfileIndex >= m_ProfileList.size())
+			throw ELibMCCustomException(LIBMC_ERROR_PROFILENOTFOUND, m_sDebugName);
+
+		return m_ProfileList[nProfileIndex]->findValueByHandle(nValueHandle);
+	}
+
+	bool CToolpathLayerData::segmentProfileHasValueByHandle(const uint32_t nSegmentIndex, const uint32_t nValueHandle)
+	{
+		return (findSegmentProfileValueByHandle(nSegmentIndex, nValueHandle) != nullptr);
+	}
+
+	std::string CToolpathLayerData::getSegmentProfileValueByHandle(const uint32_t nSegmentIndex, const uint32_t nValueHandle)
+	{
+		auto pValue = findSegmentProfileValueByHandle(nSegmentIndex, nValueHandle);
+		if (pValue == nullptr)
+			throw ELibMCCustomException(LIBMC_ERROR_PROFILEVALUENOTFOUND, getProfileValueHandleName(nValueHandle));
+
+		return pValue->m_sValue;
+	}
+
+	std::string CToolpathLayerData::getSegmentProfileValueByHandleDef(const uint32_t nSegmentIndex, const uint32_t nValueHandle, const std::string& sDefaultValue)
+	{
+		auto pValue = findSegmentProfileValueByHandle(nSegmentIndex, nValueHandle);
+		if (pValue == nullptr)
+			return sDefaultValue;
+
+		return pValue->m_sValue;
+	}
+
+	double CToolpathLayerData::getSegmentProfileDoubleValueByHandle(const uint32_t nSegmentIndex, const uint32_t nValueHandle)
+	{
+		auto pValue = findSegmentProfileValueByHandle(nSegmentIndex, nValueHandle);
+		if (pValue == nullptr)
+			throw ELibMCCustomException(LIBMC_ERROR_PROFILEVALUENOTFOUND, getProfileValueHandleName(nValueHandle));
+		if (!pValue->m_bIsDouble)
+			throw ELibMCCustomException(LIBMC_ERROR_PROFILEVALUEISNOTNUMERIC, getProfileValueHandleName(nValueHandle) + ": " + pValue->m_sValue);
+
+		return pValue->m_dValue;
+	}
+
+	double CToolpathLayerData::getSegmentProfileDoubleValueByHandleDef(const uint32_t nSegmentIndex, const uint32_t nValueHandle, double dDefaultValue)
+	{
+		auto pValue = findSegmentProfileValueByHandle(nSegmentIndex, nValueHandle);
+		if (pValue == nullptr)
+			return dDefaultValue;
+		if (!pValue->m_bIsDouble)
+			throw ELibMCCustomException(LIBMC_ERROR_PROFILEVALUEISNOTNUMERIC, getProfileValueHandleName(nValueHandle) + ": " + pValue->m_sValue);
+
+		return pValue->m_dValue;
+	}
+
+	int64_t CToolpathLayerData::getSegmentProfileIntegerValueByHandle(const uint32_t nSegmentIndex, const uint32_t nValueHandle)
+	{
+		auto pValue = findSegmentProfileValueByHandle(nSegmentIndex, nValueHandle);
+		if (pValue == nullptr)
+			throw ELibMCCustomException(LIBMC_ERROR_PROFILEVALUENOTFOUND, getProfileValueHandleName(nValueHandle));
+		if (!pValue->m_bIsInteger)
+			throw ELibMCCustomException(LIBMC_ERROR_PROFILEVALUEISNOTNUMERIC, getProfileValueHandleName(nValueHandle) + ": " + pValue->m_sValue);
+
+		return pValue->m_nValue;
+	}
+
+	int64_t CToolpathLayerData::getSegmentProfileIntegerValueByHandleDef(const uint32_t nSegmentIndex, const uint32_t nValueHandle, int64_t nDefaultValue)
+	{
+		auto pValue = findSegmentProfileValueByHandle(nSegmentIndex, nValueHandle);
+		if (pValue == nullptr)
+			return nDefaultValue;
+		if (!pValue->m_bIsInteger)
+			throw ELibMCCustomException(LIBMC_ERROR_PROFILEVALUEISNOTNUMERIC, getProfileValueHandleName(nValueHandle) + ": " + pValue->m_sValue);
+
+		return pValue->m_nValue;
+	}
+
+	bool CToolpathLayerData::getSegmentProfileBoolValueByHandle(const uint32_t nSegmentIndex, const uint32_t nValueHandle)
+	{
+		auto pValue = findSegmentProfileValueByHandle(nSegmentIndex, nValueHandle);
+		if (pValue == nullptr)
+			throw ELibMCCustomException(LIBMC_ERROR_PROFILEVALUENOTFOUND, getProfileValueHandleName(nValueHandle));
+		if (!pValue->m_bIsBool)
+			throw ELibMCCustomException(LIBMC_ERROR_PROFILEVALUEISNOTNUMERIC, getProfileValueHandleName(nValueHandle) + ": " + pValue->m_sValue);
+
+		return pValue->m_bValue;
+	}
+
+	bool CToolpathLayerData::getSegmentProfileBoolValueByHandleDef(const uint32_t nSegmentIndex, const uint32_t nValueHandle, bool bDefaultValue)
+	{
+		auto pValue = findSegmentProfileValueByHandle(nSegmentIndex, nValueHandle);
+		if (pValue == nullptr)
+			return bDefaultValue;
+		if (!pValue->m_bIsBool)
+			throw ELibMCCustomException(LIBMC_ERROR_PROFILEVALUEISNOTNUMERIC, getProfileValueHandleName(nValueHandle) + ": " + pValue->m_sValue);
+
+		return pValue->m_bValue;
 	}
 
 	bool CToolpathLayerData::findCustomSegmentAttribute(const std::string& sNameSpace, const std::string& sAttributeName, uint32_t& nAttributeID, LibMCEnv::eToolpathAttributeType& attributeType)
@@ -904,7 +1122,7 @@ namespace AMC {
 		return m_nZValue;
 	}
 
-	void CToolpathLayerData::storeProfileData(Lib3MF::PToolpath pToolpath, const std::string & sProfileUUID)
+	uint32_t CToolpathLayerData::storeProfileData(Lib3MF::PToolpath pToolpath, const std::string & sProfileUUID)
 	{
 		LibMCAssertNotNull(pToolpath.get());
 
@@ -977,8 +1195,22 @@ namespace AMC {
 
 
 			m_ProfileMap.insert(std::make_pair (sProfileUUID, pLayerProfile));
+			m_ProfileList.push_back(pLayerProfile);
+
+			return pLayerProfile->getProfileIndex();
 		}
 
+		return iIter->second->getProfileIndex();
+	}
+
+	void CToolpathLayerData::registerProfileValueHandles()
+	{
+		for (auto pProfile : m_ProfileList)
+			pProfile->bindValueHandles(m_ProfileValueHandleMap);
+
+		m_ProfileValueHandleNames.resize(m_ProfileValueHandleMap.size());
+		for (auto& handleEntry : m_ProfileValueHandleMap)
+			m_ProfileValueHandleNames.at((size_t)handleEntry.second - 1) = handleEntry.first;
 	}
 
 
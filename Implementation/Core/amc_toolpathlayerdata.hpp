@@ -56,6 +56,7 @@ namespace AMC {
 		uint32_t m_PointStartIndex;
 		uint32_t m_PointCount;
 		uint32_t m_ProfileUUID;
+		uint32_t m_ProfileIndex;
 		uint32_t m_PartUUID;
 		uint32_t m_LocalPartID;
 		uint32_t m_LaserIndex;
@@ -71,10 +72,21 @@ namespace AMC {
 		double m_dFactors[3]; // F, G and H
 	} sToolpathLayerOverride;
 
+	// Profile value, parsed once when the layer is decoded.
+	typedef struct _sToolpathLayerProfileValue {
+		bool m_bExists;
+		bool m_bIsDouble;
+		bool m_bIsInteger;
+		bool m_bIsBool;
+		double m_dValue;
+		int64_t m_nValue;
+		bool m_bValue;
+		std::string m_sValue;
+	} sToolpathLayerProfileValue;
+
 	class CToolpathCustomSegmentAttribute {
 	private:
 		uint32_t m_nInternalAttributeID;
-		uint32_t m_n3MFAttributeID;
 		LibMCEnv::eToolpathAttributeType m_AttributeType;
 		std::string m_sNameSpace;
 		std::string m_sAttributeName;
@@ -87,9 +99,6 @@ namespace AMC {
 
 		uint32_t getInternalAttributeID();
 
-		uint32_t get3MFAttributeID();
-		void set3MFAttributeID(uint32_t nAttributeID);
-
 		LibMCEnv::eToolpathAttributeType getAttributeType ();
 		std::string getNameSpace();
 		std::string getAttributeName ();
@@ -130,6 +139,9 @@ namespace AMC {
 			std::map<std::pair<std::string, std::string>, std::string> m_ProfileValues;
 			std::map<std::pair<std::string, std::string>, CToolpathLayerProfileModifier> m_ProfileModifiers;
 
+			// Typed values, indexed by layer value handle - 1. Might be shorter than the number of handles of the layer.
+			std::vector<sToolpathLayerProfileValue> m_HandleValues;
+
 		public:
 
 			CToolpathLayerProfile(const uint32_t nProfileIndex,  const std::string& sUUID, const std::string& sName);
@@ -150,6 +162,12 @@ namespace AMC {
 
 			uint32_t getProfileIndex();
 
+			// Assigns a value handle to all values of the profile. Unknown value names are appended to the handle map.
+			void bindValueHandles(std::map<std::pair<std::string, std::string>, uint32_t> & valueHandleMap);
+
+			// Returns nullptr if the profile does not have a value for the handle.
+			sToolpathLayerProfileValue* findValueByHandle(uint32_t nValueHandle);
+
 			LibMCEnv::eToolpathProfileModificationType getModificationType(const std::string& sNameSpace, const std::string& sValueName);
 			void getModificationInformation (const std::string& sNameSpace, const std::string& sValueName, LibMCEnv::eToolpathProfileModificationFactor & modificationFactor, double & dMinValue, double & dMaxValue);
 	};
@@ -172,6 +190,10 @@ namespace AMC {
 		std::vector<std::string> m_UUIDs;
 		std::map<std::string, uint32_t> m_UUIDMap;
 		std::map<std::string, PToolpathLayerProfile> m_ProfileMap;
+		std::vector<PToolpathLayerProfile> m_ProfileList;
+
+		std::map<std::pair<std::string, std::string>, uint32_t> m_ProfileValueHandleMap;
+		std::vector<std::pair<std::string, std::string>> m_ProfileValueHandleNames;
 
 		std::vector<std::pair<std::pair<std::string, std::string>, std::string>> m_CustomData;
 
@@ -183,9 +205,13 @@ namespace AMC {
 		uint32_t registerUUID(const std::string& sUUID);
 		std::string getRegisteredUUID(const uint32_t nID);
 
-		void storeProfileData(Lib3MF::PToolpath pToolpath, const std::string& sProfileUUID);
+		uint32_t storeProfileData(Lib3MF::PToolpath pToolpath, const std::string& sProfileUUID);
 		PToolpathLayerProfile retrieveProfileData(const std::string& sProfileUUID);
 
+		void registerProfileValueHandles();
+		sToolpathLayerProfileValue* findSegmentProfileValueByHandle(const uint32_t nSegmentIndex, const uint32_t nValueHandle);
+		std::string getProfileValueHandleName(const uint32_t nValueHandle);
+
 	public:
 
 		CToolpathLayerData(Lib3MF::PToolpath pToolpath, Lib3MF::PToolpathLayerReader p3MFLayer, double dUnits, int32_t nZValue, const std::string & sDebugName, std::vector<PToolpathCustomSegmentAttribute> customSegmentAttributes);
@@ -193,6 +219,9 @@ namespace AMC {
 
 		std::string getUUID ();
 
+		// Returns an estimate of the heap memory held by the decoded layer in bytes
+		uint64_t getMemoryUsage();
+
 		uint32_t getSegmentCount();	
 		uint32_t getSegmentPointCount (const uint32_t nSegmentIndex);
 		LibMCEnv::eToolpathSegmentType getSegmentType (const uint32_t nSegmentIndex);
@@ -210,6 +239,18 @@ namespace AMC {
 		uint32_t getSegmentLaserIndex(const uint32_t nSegmentIndex);
 		PToolpathLayerProfile getSegmentProfile(const uint32_t nSegmentIndex);
 
+		// Profile value handles are unique within the layer. Handle 0 denotes a value that no profile of the layer has.
+		uint32_t resolveProfileValueHandle(const std::string& sNameSpace, const std::string& sValueName);
+		bool segmentProfileHasValueByHandle(const uint32_t nSegmentIndex, const uint32_t nValueHandle);
+		std::string getSegmentProfileValueByHandle(const uint32_t nSegmentIndex, const uint32_t nValueHandle);
+		std::string getSegmentProfileValueByHandleDef(const uint32_t nSegmentIndex, const uint32_t nValueHandle, const std::string& sDefaultValue);
+		double getSegmentProfileDoubleValueByHandle(const uint32_t nSegmentIndex, const uint32_t nValueHandle);
+		double getSegmentProfileDoubleValueByHandleDef(const uint32_t nSegmentIndex, const uint32_t nValueHandle, double dDefaultValue);
+		int64_t getSegmentProfileIntegerValueByHandle(const uint32_t nSegmentIndex, const uint32_t nValueHandle);
+		int64_t getSegmentProfileIntegerValueByHandleDef(const uint32_t nSegmentIndex, const uint32_t nValueHandle, int64_t nDefaultValue);
+		bool getSegmentProfileBoolValueByHandle(const uint32_t nSegmentIndex, const uint32_t nValueHandle);
+		bool getSegmentProfileBoolValueByHandleDef(const uint32_t nSegmentIndex, const uint32_t nValueHandle, bool bDefaultValue);
+
 		bool findCustomSegmentAttribute(const std::string& sNameSpace, const std::string& sName, uint32_t& nAttributeID, LibMCEnv::eToolpathAttributeType & attributeType);
 		int64_t getSegmentIntegerAttribute(const uint32_t nSegmentIndex, uint32_t nAttributeID);
 		double getSegmentDoubleAttribute(const uint32_t nSegmentIndex, uint32_t nAttributeID);
@@ -41,6 +41,81 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <cstring>
 
 namespace AMCData {
+
+	CJournalLogQueue::CJournalLogQueue()
+		: m_pHead (nullptr), m_nPendingCount (0)
+	{
+
+	}
+
+	CJournalLogQueue::~CJournalLogQueue()
+	{
+		sJournalLogQueueEntry* pEntry = m_pHead.exchange(nullptr);
+		while (pEntry != nullptr) {
+			sJournalLogQueueEntry* pNext = pEntry->m_pNext;
+			delete pEntry;
+			pEntry = pNext;
+		}
+	}
+
+	bool CJournalLogQueue::push(const std::string& sMessage, const std::string& sSubSystem, const LibMCData::eLogLevel logLevel, const std::string& sTimestamp)
+	{
+		sJournalLogQueueEntry* pEntry = new sJournalLogQueueEntry;
+		pEntry->m_sMessage = sMessage;
+		pEntry->m_sSubSystem = sSubSystem;
+		pEntry->m_sTimestamp = sTimestamp;
+		pEntry->m_LogLevel = logLevel;
+
+		// Count the entry before it is published, so that popAll never subtracts an entry that has not been counted yet
+		m_nPendingCount++;
+
+		// Once published, the entry may already have been popped and deleted. Only the expected head may be used afterwards.
+		sJournalLogQueueEntry* pExpectedHead = m_pHead.load(std::memory_order_relaxed);
+		do {
+			pEntry->m_pNext = pExpectedHead;
+		} while (!m_pHead.compare_exchange_weak(pExpectedHead, pEntry, std::memory_order_release, std::memory_order_relaxed));
+
+		return (pExpectedHead == nullptr);
+	}
+
+	void CJournalLogQueue::popAll(std::vector<sJournalLogQueueEntry>& entries)
+	{
+		sJournalLogQueueEntry* pEntry = m_pHead.exchange(nullptr, std::memory_order_acquire);
+		if (pEntry == nullptr)
+			return;
+
+		// The stack holds the newest entry first, reverse it to restore insertion order.
+		sJournalLogQueueEntry* pReversed = nullptr;
+		while (pEntry != nullptr) {
+			sJournalLogQueueEntry* pNext = pEntry->m_pNext;
+			pEntry->m_pNext = pReversed;
+			pReversed = pEntry;
+			pEntry = pNext;
+		}
+
+		uint64_t nPoppedCount = 0;
+		while (pReversed != nullptr) {
+			sJournalLogQueueEntry* pNext = pReversed->m_pNext;
+			pReversed->m_pNext = nullptr;
+			entries.push_back(std::move (*pReversed));
+			delete pReversed;
+			pReversed = pNext;
+
+			nPoppedCount++;
+		}
+
+		m_nPendingCount -= nPoppedCount;
+	}
+
+	bool CJournalLogQueue::isEmpty()
+	{
+		return (m_pHead.load(std::memory_order_acquire) == nullptr);
+	}
+
+	uint64_t CJournalLogQueue::getPendingCount()
+	{
+		return m_nPendingCount;
+	}
 		
 	CActiveJournalFile::CActiveJournalFile(const std::string& sFileName, uint32_t nFileIndex)
 		: m_nFileIndex (nFileIndex), m_nTotalSize (0)
@@ -154,7 +229,7 @@ namespace AMCData {
 	CJournal::CJournal(const std::string& sJournalBasePath, const std::string& sJournalName, const std::string& sJournalChunkBaseName, const std::string& sTelemetryChunkBaseName, const std::string& sSessionUUID)
 		: m_LogID(1), m_AlertID(1), m_sSessionUUID(AMCCommon::CUtils::normalizeUUIDString(sSessionUUID)),
 		m_sJournalBasePath(sJournalBasePath), m_sChunkBaseName (sJournalChunkBaseName),
-		m_TelemetryChunkID (1)
+		m_TelemetryChunkID (1), m_bLogWriterCancelled (false), m_nLogWriteFailureCount (0), m_nDroppedLogEntryCount (0)
 	{
 		if (!sTelemetryChunkBaseName.empty()) {
 			m_sTelemetryChunkBaseName = sTelemetryChunkBaseName;
@@ -285,11 +360,97 @@ namespace AMCData {
 		m_pCurrentJournalFile = createJournalFile();
 		m_pCurrentTelemetryFile = createTelemetryFile();
 
+		m_LogWriterThread = std::thread(&CJournal::logWriterThreadLoop, this);
+
 	}
 
 	CJournal::~CJournal()
 	{
+		{
+			std::lock_guard<std::mutex> lockGuard(m_LogWriterMutex);
+			m_bLogWriterCancelled = true;
+		}
+		m_LogWriterCondition.notify_all();
+
+		if (m_LogWriterThread.joinable())
+			m_LogWriterThread.join();
 
+		try {
+			FlushLogEntries();
+		}
+		catch (...) {
+			// Destructors must not throw
+		}
+	}
+
+	void CJournal::logWriterThreadLoop()
+	{
+		bool bCancelled = false;
+		while (!bCancelled) {
+
+			{
+				// Producers notify without holding the mutex, so a wakeup might be missed. 
+				// The wait interval bounds the latency in that case.
+				std::unique_lock<std::mutex> lock(m_LogWriterMutex);
+				m_LogWriterCondition.wait_for(lock, std::chrono::milliseconds(JOURNAL_LOGWRITER_INTERVALINMS), [this] {
+					return m_bLogWriterCancelled || !m_LogQueue.isEmpty();
+				});
+				bCancelled = m_bLogWriterCancelled;
+			}
+
+			try {
+				FlushLogEntries();
+			}
+			catch (...) {
+				// A failing batch must not terminate the writer thread. 
+				// FlushLogEntries keeps the failed entries, so they are retried in the next interval.
+			}
+		}
+	}
+
+	void CJournal::writeLogEntriesInternal(std::vector<sJournalLogQueueEntry>& entries)
+	{
+		size_t nEntryCount = entries.size();
+		size_t nStartIndex = 0;
+
+		try {
+			while (nStartIndex < nEntryCount) {
+				size_t nEndIndex = nStartIndex + JOURNAL_LOGWRITER_MAXBATCHSIZE;
+				if (nEndIndex > nEntryCount)
+					nEndIndex = nEntryCount;
+
+				uint32_t nLogID = m_LogID;
+
+				auto pTransaction = m_pSQLHandler->beginTransaction();
+				auto pStatement = pTransaction->prepareStatement("INSERT INTO logs (logindex, loglevel, timestamp, subsystem, message) VALUES (?, ?, ?, ?, ?)");
+				for (size_t nIndex = nStartIndex; nIndex < nEndIndex; nIndex++) {
+					auto& entry = entries.at(nIndex);
+					pStatement->setInt(1, nLogID);
+					pStatement->setInt(2, (int)entry.m_LogLevel);
+					pStatement->setString(3, entry.m_sTimestamp);
+					pStatement->setString(4, entry.m_sSubSystem);
+					pStatement->setString(5, entry.m_sMessage);
+					pStatement->execute();
+					pStatement->reset();
+
+					nLogID++;
+				}
+				pStatement = nullptr;
+
+				pTransaction->commit();
+
+				// Only committed entries become visible to GetMaxLogEntryID
+				m_LogID = nLogID;
+
+				nStartIndex = nEndIndex;
+			}
+		}
+		catch (...) {
+			entries.erase(entries.begin(), entries.begin() + nStartIndex);
+			throw;
+		}
+
+		entries.clear();
 	}
 
 	PActiveJournalFile CJournal::createJournalFile()
@@ -353,19 +514,16 @@ namespace AMCData {
 
 	void CJournal::AddEntry(const std::string& sMessage, const std::string& sSubSystem, const LibMCData::eLogLevel logLevel, const std::string& sTimestamp)
 	{
-		std::lock_guard<std::mutex> lockGuard(m_LogMutex);
-
-		std::string sQuery = "INSERT INTO logs (logindex, loglevel, timestamp, subsystem, message) VALUES (?, ?, ?, ?, ?)";
-		auto pStatement = m_pSQLHandler->prepareStatement(sQuery);
-		pStatement->setInt(1, m_LogID);
-		pStatement->setInt(2, (int)logLevel);
-		pStatement->setString(3, sTimestamp);
-		pStatement->setString(4, sSubSystem);
-		pStatement->setString(5, sMessage);
-		pStatement->execute();
-		pStatement = nullptr;
+		bool bWasEmpty = m_LogQueue.push(sMessage, sSubSystem, logLevel, sTimestamp);
 
-		m_LogID++;
+		// If the writer thread can not keep up, the producers write synchronously instead of growing the queue without bounds.
+		if (m_LogQueue.getPendingCount() > JOURNAL_LOGQUEUE_MAXPENDINGENTRIES) {
+			FlushLogEntries();
+		}
+		else {
+			if (bWasEmpty)
+				m_LogWriterCondition.notify_one();
+		}
 	}
 
 	LibMCData_uint32 CJournal::GetMaxLogEntryID()
@@ -373,6 +531,47 @@ namespace AMCData {
 		return m_LogID;
 	}
 
+	void CJournal::FlushLogEntries()
+	{
+		std::lock_guard<std::mutex> lockGuard(m_LogWriteMutex);
+
+		// New entries are appended behind the ones of a previously failed write, so the log order is kept.
+		m_LogQueue.popAll(m_UnwrittenLogEntries);
+		if (m_UnwrittenLogEntries.empty())
+			return;
+
+		try {
+			writeLogEntriesInternal(m_UnwrittenLogEntries);
+			m_nLogWriteFailureCount = 0;
+		}
+		catch (...) {
+			m_nLogWriteFailureCount++;
+			if (m_nLogWriteFailureCount >= JOURNAL_LOGWRITER_MAXRETRIES) {
+				uint64_t nDroppedCount = m_UnwrittenLogEntries.size();
+				m_nDroppedLogEntryCount += nDroppedCount;
+
+				// Leave a trace of the gap in the log, it is written as soon as the database recovers.
+				sJournalLogQueueEntry droppedEntry;
+				droppedEntry.m_sMessage = "journal dropped " + std::to_string(nDroppedCount) + " log entries after " + std::to_string(m_nLogWriteFailureCount) + " failed write attempts";
+				droppedEntry.m_sSubSystem = "journal";
+				droppedEntry.m_sTimestamp = m_UnwrittenLogEntries.back().m_sTimestamp;
+				droppedEntry.m_LogLevel = LibMCData::eLogLevel::CriticalError;
+				droppedEntry.m_pNext = nullptr;
+
+				m_UnwrittenLogEntries.clear();
+				m_UnwrittenLogEntries.push_back(droppedEntry);
+				m_nLogWriteFailureCount = 0;
+			}
+
+			throw;
+		}
+	}
+
+	uint64_t CJournal::getDroppedLogEntryCount()
+	{
+		return m_nDroppedLogEntryCount;
+	}
+
 	AMCData::PSQLHandler CJournal::getSQLHandler()
 	{
 		return m_pSQLHandler;
@@ -916,6 +1115,8 @@ namespace AMCData {
 				return "signalprocessing";
 			case LibMCData::eTelemetryChannelType::SignalAcknowledgement:
 				return "signalacknowledgement";
+			case LibMCData::eTelemetryChannelType::SystemTask:
+				return "systemtask";
 
 		default:
 			return "unknown";
@@ -939,6 +1140,8 @@ namespace AMCData {
 			return LibMCData::eTelemetryChannelType::SignalProcessing;
 		if (sValue == "signalacknowledgement")
 			return LibMCData::eTelemetryChannelType::SignalAcknowledgement;
+		if (sValue == "systemtask")
+			return LibMCData::eTelemetryChannelType::SystemTask;
 
 		throw ELibMCDataInterfaceException(LIBMCDATA_ERROR_UNKNOWNTELEMETRYCHANNELTYPE, "Unknown telemetry channel type: " + sValue);
 	}
@@ -38,6 +38,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <mutex>
 #include <fstream>
 #include <atomic>
+#include <thread>
+#include <condition_variable>
 
 #include "amcdata_sqlhandler.hpp"
 #include "common_exportstream_native.hpp"
@@ -49,6 +51,44 @@ namespace AMCData {
 	#define JOURNAL_MAXFILESPERSESSION 999999
 	#define JOURNAL_MAXFILEDIGITS 6
 
+	#define JOURNAL_LOGWRITER_INTERVALINMS 20
+	#define JOURNAL_LOGWRITER_MAXBATCHSIZE 4096
+	#define JOURNAL_LOGQUEUE_MAXPENDINGENTRIES 65536
+	#define JOURNAL_LOGWRITER_MAXRETRIES 5
+
+	typedef struct _sJournalLogQueueEntry {
+		std::string m_sMessage;
+		std::string m_sSubSystem;
+		std::string m_sTimestamp;
+		LibMCData::eLogLevel m_LogLevel;
+		_sJournalLogQueueEntry* m_pNext;
+	} sJournalLogQueueEntry;
+
+	// Lock-free multiple producer, single consumer queue of log entries.
+	// Producers push onto an atomic linked stack, the consumer detaches the whole stack at once.
+	class CJournalLogQueue {
+	private:
+		std::atomic<sJournalLogQueueEntry*> m_pHead;
+		std::atomic<uint64_t> m_nPendingCount;
+
+	public:
+
+		CJournalLogQueue();
+
+		virtual ~CJournalLogQueue();
+
+		// Returns true if the queue has been empty before.
+		bool push(const std::string& sMessage, const std::string& sSubSystem, const LibMCData::eLogLevel logLevel, const std::string& sTimestamp);
+
+		// Removes all pending entries and returns them in the order they have been pushed.
+		void popAll(std::vector<sJournalLogQueueEntry> & entries);
+
+		bool isEmpty();
+
+		uint64_t getPendingCount();
+
+	};
+
 
 	class CActiveJournalFile : public CJournalChunkDataFile {
 	private:
@@ -105,8 +145,26 @@ namespace AMCData {
 
 		std::atomic<uint32_t> m_TelemetryChunkID;
 
+		CJournalLogQueue m_LogQueue;
+		std::mutex m_LogWriteMutex;
+		std::mutex m_LogWriterMutex;
+		std::condition_variable m_LogWriterCondition;
+		std::thread m_LogWriterThread;
+		bool m_bLogWriterCancelled;
+
+		// Entries that have been taken from the queue but are not committed yet. Requires m_LogWriteMutex.
+		// A failing write keeps them for the next flush, they are only dropped after JOURNAL_LOGWRITER_MAXRETRIES failed attempts.
+		std::vector<sJournalLogQueueEntry> m_UnwrittenLogEntries;
+		uint32_t m_nLogWriteFailureCount;
+		std::atomic<uint64_t> m_nDroppedLogEntryCount;
+
 		PActiveJournalFile createTelemetryFile();
 
+		void logWriterThreadLoop();
+
+		// Requires m_LogWriteMutex to be locked. Removes all committed entries from the front of entries, also if a later batch fails.
+		void writeLogEntriesInternal(std::vector<sJournalLogQueueEntry> & entries);
+
 	public:
 
 		static std::string convertAlertLevelToString(const LibMCData::eAlertLevel eLevel);
@@ -125,6 +183,13 @@ namespace AMCData {
 
 		LibMCData_uint32 GetMaxLogEntryID();
 
+		// Writes all queued log entries to the database before returning. 
+		// Throws if the database write fails, the entries are retried with the next flush.
+		void FlushLogEntries();
+
+		// Returns the number of log entries that have been dropped after repeated database write failures.
+		uint64_t getDroppedLogEntryCount();
+
 		void CreateVariableInJournalDB(const std::string& sName, const LibMCData_uint32 nID, const LibMCData_uint32 nIndex, const LibMCData::eParameterDataType eDataType, double dUnits);
 
 		void CreateVariableAliasInJournalDB(const std::string& sAliasName, const std::string& sSourceName);
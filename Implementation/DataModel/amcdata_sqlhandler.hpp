@@ -57,7 +57,15 @@ namespace AMCData {
 
 	class CSQLTransactionLock {
 		private:
-			std::lock_guard<std::mutex> m_lockGuard;
+			std::unique_lock<std::mutex> m_lockGuard;
+
+		protected:
+			// For handlers that guard their connections with a different kind of mutex.
+			CSQLTransactionLock()
+			{
+
+
+			}
 
 		public:
 			CSQLTransactionLock(std::mutex& mutexToLock)
@@ -94,6 +102,13 @@ namespace AMCData {
 
 		virtual PSQLStatement prepareStatementLocked (const std::string& sSQLString, PSQLTransactionLock pLock) = 0;
 
+		// Prepares a statement that only reads from the database. Handlers may execute it on a
+		// separate read connection, so it must not depend on uncommitted writes of the caller.
+		virtual PSQLStatement prepareReadStatement(const std::string& sSQLString)
+		{
+			return prepareStatement(sSQLString);
+		}
+
 		virtual PSQLTransaction beginTransaction() = 0;
 
 		virtual PSQLTransactionLock createLock() {
@@ -36,18 +36,229 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 namespace AMCData {
 
-	CSQLHandler_SQLite::CSQLHandler_SQLite(const std::string& sFileName)
-		: m_pDBHandle (nullptr)
+	CSQLiteConnection::CSQLiteConnection(const std::string& sFileName, bool bReadOnly, uint32_t nStatementCacheSize)
+		: m_pDBHandle(nullptr), m_nCachedStatementCount(0), m_nStatementCacheSize(nStatementCacheSize)
 	{
-		sqlite3* pDBHandle = nullptr;
-		sqlite3_open(sFileName.c_str(), &pDBHandle);
+		int nFlags = bReadOnly ? SQLITE_OPEN_READONLY : (SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE);
 
+		sqlite3* pDBHandle = nullptr;
+		int nResult = sqlite3_open_v2(sFileName.c_str(), &pDBHandle, nFlags, nullptr);
 		m_pDBHandle = pDBHandle;
+
+		if (nResult != SQLITE_OK) {
+			std::string sErrorMessage;
+			if (pDBHandle != nullptr)
+				sErrorMessage = sqlite3_errmsg(pDBHandle);
+
+			sqlite3_close(pDBHandle);
+			m_pDBHandle = nullptr;
+
+			throw ELibMCDataInterfaceException(LIBMCDATA_ERROR_SQLITE_CANTOPEN, sErrorMessage);
+		}
+	}
+
+	CSQLiteConnection::~CSQLiteConnection()
+	{
+		clearStatementCache();
+		sqlite3_close((sqlite3*)m_pDBHandle);
+	}
+
+	void* CSQLiteConnection::getDBHandle()
+	{
+		return m_pDBHandle;
+	}
+
+	std::recursive_mutex& CSQLiteConnection::getUsageMutex()
+	{
+		return m_UsageMutex;
+	}
+
+	void* CSQLiteConnection::acquireStatement(const std::string& sSQLString, int& nErrorCode)
+	{
+		nErrorCode = SQLITE_OK;
+
+		if (m_nStatementCacheSize > 0) {
+			std::lock_guard<std::mutex> lockGuard(m_StatementCacheMutex);
+
+			auto iIter = m_StatementCache.find(sSQLString);
+			if ((iIter != m_StatementCache.end()) && (!iIter->second.empty())) {
+				void* pStmtHandle = iIter->second.back();
+				iIter->second.pop_back();
+				m_nCachedStatementCount--;
+				return pStmtHandle;
+			}
+		}
+
+		// Cached statements are kept around, which SQLite can optimize for.
+		unsigned int nPrepareFlags = (m_nStatementCacheSize > 0) ? SQLITE_PREPARE_PERSISTENT : 0;
+
+		sqlite3_stmt* pStmt = nullptr;
+		nErrorCode = sqlite3_prepare_v3((sqlite3*)m_pDBHandle, sSQLString.c_str(), (int)sSQLString.length(), nPrepareFlags, &pStmt, nullptr);
+		if (nErrorCode != SQLITE_OK) {
+			sqlite3_finalize(pStmt);
+			return nullptr;
+		}
+
+		return pStmt;
+	}
+
+	void CSQLiteConnection::releaseStatement(const std::string& sSQLString, void* pStmtHandle)
+	{
+		if (pStmtHandle == nullptr)
+			return;
+
+		if (m_nStatementCacheSize > 0) {
+			sqlite3_reset((sqlite3_stmt*)pStmtHandle);
+			sqlite3_clear_bindings((sqlite3_stmt*)pStmtHandle);
+
+			std::lock_guard<std::mutex> lockGuard(m_StatementCacheMutex);
+			if (m_nCachedStatementCount < m_nStatementCacheSize) {
+				m_StatementCache[sSQLString].push_back(pStmtHandle);
+				m_nCachedStatementCount++;
+				return;
+			}
+		}
+
+		sqlite3_finalize((sqlite3_stmt*)pStmtHandle);
+	}
+
+	void CSQLiteConnection::clearStatementCache()
+	{
+		std::lock_guard<std::mutex> lockGuard(m_StatementCacheMutex);
+
+		for (auto& iIter : m_StatementCache) {
+			for (auto pStmtHandle : iIter.second)
+				sqlite3_finalize((sqlite3_stmt*)pStmtHandle);
+		}
+
+		m_StatementCache.clear();
+		m_nCachedStatementCount = 0;
+	}
+
+	uint32_t CSQLiteConnection::getCachedStatementCount()
+	{
+		std::lock_guard<std::mutex> lockGuard(m_StatementCacheMutex);
+		return m_nCachedStatementCount;
+	}
+
+	void CSQLiteConnection::executePragma(const std::string& sPragma)
+	{
+		char* pErrorMessage = nullptr;
+		int nResult = sqlite3_exec((sqlite3*)m_pDBHandle, sPragma.c_str(), nullptr, nullptr, &pErrorMessage);
+
+		std::string sErrorMessage;
+		if (pErrorMessage != nullptr) {
+			sErrorMessage = pErrorMessage;
+			sqlite3_free(pErrorMessage);
+		}
+
+		if (nResult != SQLITE_OK)
+			throw ELibMCDataInterfaceException(LIBMCDATA_ERROR_SQLITE_ERROR, sPragma + ": " + sErrorMessage);
+	}
+
+
+	CSQLiteConnectionLock::CSQLiteConnectionLock(std::recursive_mutex& mutexToLock)
+		: m_Lock(mutexToLock)
+	{
+	}
+
+	CSQLiteConnectionLock::CSQLiteConnectionLock(std::recursive_mutex& mutexToLock, std::adopt_lock_t adoptLock)
+		: m_Lock(mutexToLock, adoptLock)
+	{
+	}
+
+	CSQLiteConnectionLock::~CSQLiteConnectionLock()
+	{
+	}
+
+
+	CSQLHandler_SQLite::CSQLHandler_SQLite(const std::string& sFileName)
+		: CSQLHandler_SQLite (sFileName, getDefaultConfiguration ())
+	{
+	}
+
+	CSQLHandler_SQLite::CSQLHandler_SQLite(const std::string& sFileName, const sSQLiteConfiguration& configuration)
+		: m_nNextReadConnection (0)
+	{
+		if (configuration.m_nReadConnectionCount > SQLITE_MAXREADCONNECTIONS)
+			throw ELibMCDataInterfaceException(LIBMCDATA_ERROR_INVALIDPARAM);
+
+		m_pWriteConnection = std::make_shared<CSQLiteConnection>(sFileName, false, configuration.m_nStatementCacheSize);
+		applyConfiguration(m_pWriteConnection.get(), configuration, true);
+
+		// Readers only run in parallel to the writer with a write-ahead log. In-memory databases can not be shared.
+		bool bIsFileDatabase = (!sFileName.empty()) && (sFileName != ":memory:");
+		if ((configuration.m_JournalMode == eSQLiteJournalMode::WAL) && bIsFileDatabase) {
+			for (uint32_t nIndex = 0; nIndex < configuration.m_nReadConnectionCount; nIndex++) {
+				auto pReadConnection = std::make_shared<CSQLiteConnection>(sFileName, true, configuration.m_nStatementCacheSize);
+				applyConfiguration(pReadConnection.get(), configuration, false);
+				m_ReadConnections.push_back(pReadConnection);
+			}
+		}
 	}
 
 	CSQLHandler_SQLite::~CSQLHandler_SQLite()
 	{
-		sqlite3_close((sqlite3*) m_pDBHandle);
+		m_ReadConnections.clear();
+		m_pWriteConnection = nullptr;
+	}
+
+	sSQLiteConfiguration CSQLHandler_SQLite::getDefaultConfiguration()
+	{
+		sSQLiteConfiguration configuration;
+		configuration.m_JournalMode = eSQLiteJournalMode::Unchanged;
+		configuration.m_SynchronousMode = eSQLiteSynchronousMode::Unchanged;
+		configuration.m_nCacheSizeInKB = 0;
+		configuration.m_nMMapSizeInBytes = 0;
+		configuration.m_nBusyTimeoutInMS = 0;
+		configuration.m_nReadConnectionCount = 0;
+		configuration.m_nStatementCacheSize = SQLITE_DEFAULTSTATEMENTCACHESIZE;
+		return configuration;
+	}
+
+	sSQLiteConfiguration CSQLHandler_SQLite::getConcurrentConfiguration()
+	{
+		sSQLiteConfiguration configuration;
+		configuration.m_JournalMode = eSQLiteJournalMode::WAL;
+		configuration.m_SynchronousMode = eSQLiteSynchronousMode::Normal;
+		configuration.m_nCacheSizeInKB = 16 * 1024;
+		configuration.m_nMMapSizeInBytes = 256 * 1024 * 1024;
+		configuration.m_nBusyTimeoutInMS = 5000;
+		configuration.m_nReadConnectionCount = 4;
+		configuration.m_nStatementCacheSize = SQLITE_DEFAULTSTATEMENTCACHESIZE;
+		return configuration;
+	}
+
+	void CSQLHandler_SQLite::applyConfiguration(CSQLiteConnection* pConnection, const sSQLiteConfiguration& configuration, bool bIsWriteConnection)
+	{
+		if (pConnection == nullptr)
+			throw ELibMCDataInterfaceException(LIBMCDATA_ERROR_INVALIDPARAM);
+
+		if (configuration.m_nBusyTimeoutInMS > 0)
+			checkSQLiteError(sqlite3_busy_timeout((sqlite3*)pConnection->getDBHandle(), (int)configuration.m_nBusyTimeoutInMS), pConnection);
+
+		// The journal mode is persistent in the database file, so only the writer sets it.
+		if (bIsWriteConnection) {
+			switch (configuration.m_JournalMode) {
+				case eSQLiteJournalMode::Delete: pConnection->executePragma("PRAGMA journal_mode=DELETE;"); break;
+				case eSQLiteJournalMode::WAL: pConnection->executePragma("PRAGMA journal_mode=WAL;"); break;
+				default: break;
+			}
+		}
+
+		switch (configuration.m_SynchronousMode) {
+			case eSQLiteSynchronousMode::Off: pConnection->executePragma("PRAGMA synchronous=OFF;"); break;
+			case eSQLiteSynchronousMode::Normal: pConnection->executePragma("PRAGMA synchronous=NORMAL;"); break;
+			case eSQLiteSynchronousMode::Full: pConnection->executePragma("PRAGMA synchronous=FULL;"); break;
+			default: break;
+		}
+
+		// Negative cache sizes are interpreted by SQLite as KiB instead of pages.
+		if (configuration.m_nCacheSizeInKB > 0)
+			pConnection->executePragma("PRAGMA cache_size=-" + std::to_string(configuration.m_nCacheSizeInKB) + ";");
+
+		if (configuration.m_nMMapSizeInBytes > 0)
+			pConnection->executePragma("PRAGMA mmap_size=" + std::to_string(configuration.m_nMMapSizeInBytes) + ";");
 	}
 
 	PSQLStatement CSQLHandler_SQLite::prepareStatementLocked(const std::string& sSQLString, PSQLTransactionLock pLock) 
@@ -55,18 +266,79 @@ namespace AMCData {
 		if (sSQLString.length() > SQLITE_MAXSTATEMENTLENGTH)
 			throw ELibMCDataInterfaceException(LIBMCDATA_ERROR_INVALIDPARAM);
 
-		sqlite3_stmt* pStmt = nullptr;
-		checkSQLiteError(sqlite3_prepare_v2((sqlite3*)m_pDBHandle, sSQLString.c_str(), (int)sSQLString.length(), &pStmt, nullptr));
+		int nErrorCode = SQLITE_OK;
+		void* pStmtHandle = m_pWriteConnection->acquireStatement(sSQLString, nErrorCode);
+		checkSQLiteError(nErrorCode, m_pWriteConnection.get());
 			
-		return std::make_shared<CSQLStatement_SQLite>(this, (void *)pStmt, pLock);
+		return std::make_shared<CSQLStatement_SQLite>(this, m_pWriteConnection, sSQLString, pStmtHandle, pLock);
+	}
+
+	PSQLStatement CSQLHandler_SQLite::prepareReadStatement(const std::string& sSQLString)
+	{
+		size_t nReadConnectionCount = m_ReadConnections.size();
+		if (nReadConnectionCount == 0)
+			return prepareStatement(sSQLString);
+
+		if (sSQLString.length() > SQLITE_MAXSTATEMENTLENGTH)
+			throw ELibMCDataInterfaceException(LIBMCDATA_ERROR_INVALIDPARAM);
+
+		// Take the first idle read connection, starting round robin. try_lock also succeeds on a connection
+		// that the calling thread already holds, so nested statements never wait for themselves. Only if all
+		// connections are held by other threads, block on one; the calling thread holds none in that case.
+		uint32_t nStartIndex = m_nNextReadConnection.fetch_add(1);
+		PSQLiteConnection pConnection;
+		PSQLTransactionLock pLock;
+
+		for (size_t nIndex = 0; nIndex < nReadConnectionCount; nIndex++) {
+			auto pCandidate = m_ReadConnections.at((nStartIndex + nIndex) % nReadConnectionCount);
+			if (pCandidate->getUsageMutex().try_lock()) {
+				pConnection = pCandidate;
+				pLock = std::make_shared<CSQLiteConnectionLock>(pCandidate->getUsageMutex(), std::adopt_lock);
+				break;
+			}
+		}
+
+		if (pConnection.get() == nullptr) {
+			pConnection = m_ReadConnections.at(nStartIndex % nReadConnectionCount);
+			pLock = std::make_shared<CSQLiteConnectionLock>(pConnection->getUsageMutex());
+		}
+
+		int nErrorCode = SQLITE_OK;
+		void* pStmtHandle = pConnection->acquireStatement(sSQLString, nErrorCode);
+		checkSQLiteError(nErrorCode, pConnection.get());
+
+		return std::make_shared<CSQLStatement_SQLite>(this, pConnection, sSQLString, pStmtHandle, pLock);
+	}
+
+	uint32_t CSQLHandler_SQLite::getReadConnectionCount()
+	{
+		return (uint32_t)m_ReadConnections.size();
+	}
+
+	PSQLiteConnection CSQLHandler_SQLite::getWriteConnection()
+	{
+		return m_pWriteConnection;
+	}
+
+	PSQLiteConnection CSQLHandler_SQLite::getReadConnection(uint32_t nIndex)
+	{
+		if (nIndex >= m_ReadConnections.size())
+			throw ELibMCDataInterfaceException(LIBMCDATA_ERROR_INVALIDINDEX);
+
+		return m_ReadConnections.at(nIndex);
+	}
+
+	void CSQLHandler_SQLite::checkSQLiteError(int nError)
+	{
+		checkSQLiteError(nError, m_pWriteConnection.get());
 	}
 
-    void CSQLHandler_SQLite::checkSQLiteError(int nError)
+	void CSQLHandler_SQLite::checkSQLiteError(int nError, CSQLiteConnection* pConnection)
 	{
 		std::string sErrorMessage;
 		if (nError != SQLITE_OK) {
-			if (m_pDBHandle != nullptr)
-				sErrorMessage = sqlite3_errmsg((sqlite3*)m_pDBHandle);
+			if ((pConnection != nullptr) && (pConnection->getDBHandle() != nullptr))
+				sErrorMessage = sqlite3_errmsg((sqlite3*)pConnection->getDBHandle());
 		}
 
 		switch (nError) {
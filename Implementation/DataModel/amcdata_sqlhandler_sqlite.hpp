@@ -35,11 +35,16 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <memory>
 #include <string>
 #include <mutex>
+#include <map>
+#include <vector>
+#include <atomic>
 
 #include "amcdata_sqlhandler.hpp"
 #include "amcdata_sqlstatement_sqlite.hpp"
 
 #define SQLITE_MAXSTATEMENTLENGTH (1024 * 1024 * 1024)
+#define SQLITE_MAXREADCONNECTIONS 64
+#define SQLITE_DEFAULTSTATEMENTCACHESIZE 128
 
 namespace AMCData {
 
@@ -50,25 +55,130 @@ namespace AMCData {
 	class CSQLStatement_SQLite;
 	typedef std::shared_ptr<CSQLStatement_SQLite> PSQLStatement_SQLite;
 
+	class CSQLiteConnection;
+	typedef std::shared_ptr<CSQLiteConnection> PSQLiteConnection;
+
+	enum class eSQLiteJournalMode : int32_t {
+		Unchanged = 0,
+		Delete = 1,
+		WAL = 2
+	};
+
+	enum class eSQLiteSynchronousMode : int32_t {
+		Unchanged = 0,
+		Off = 1,
+		Normal = 2,
+		Full = 3
+	};
+
+	typedef struct _sSQLiteConfiguration {
+		eSQLiteJournalMode m_JournalMode;
+		eSQLiteSynchronousMode m_SynchronousMode;
+		int64_t m_nCacheSizeInKB; // 0 keeps the SQLite default
+		int64_t m_nMMapSizeInBytes; // 0 disables memory mapped I/O
+		uint32_t m_nBusyTimeoutInMS; // 0 fails immediately on a locked database
+		uint32_t m_nReadConnectionCount; // Read connections are only opened in WAL mode
+		uint32_t m_nStatementCacheSize; // Number of cached prepared statements per connection, 0 disables the cache
+	} sSQLiteConfiguration;
+
+
+	// A single SQLite connection with its cache of prepared statements.
+	class CSQLiteConnection {
+	private:
+
+		void* m_pDBHandle;
+
+		std::mutex m_StatementCacheMutex;
+		std::map<std::string, std::vector<void*>> m_StatementCache;
+		uint32_t m_nCachedStatementCount;
+		uint32_t m_nStatementCacheSize;
+
+		// Serializes the use of a read connection, in the same way the handler mutex does for the write connection.
+		// It is recursive, so that a thread can prepare nested statements on a connection it already holds.
+		std::recursive_mutex m_UsageMutex;
+
+	public:
+
+		CSQLiteConnection(const std::string& sFileName, bool bReadOnly, uint32_t nStatementCacheSize);
+
+		virtual ~CSQLiteConnection();
+
+		void* getDBHandle();
+
+		std::recursive_mutex& getUsageMutex();
+
+		// Returns a cached statement for the SQL string or prepares a new one.
+		void* acquireStatement(const std::string& sSQLString, int& nErrorCode);
+
+		// Resets the statement and puts it back into the cache. Finalizes it, if the cache is full.
+		void releaseStatement(const std::string& sSQLString, void* pStmtHandle);
+
+		void clearStatementCache();
+
+		uint32_t getCachedStatementCount();
+
+		void executePragma(const std::string& sPragma);
+
+	};
+
+
+	// Holds the usage mutex of a read connection until the statement has been executed.
+	class CSQLiteConnectionLock : public CSQLTransactionLock {
+	private:
+		std::unique_lock<std::recursive_mutex> m_Lock;
+
+	public:
+
+		CSQLiteConnectionLock(std::recursive_mutex& mutexToLock);
+
+		// Takes ownership of a mutex that has already been locked by the caller.
+		CSQLiteConnectionLock(std::recursive_mutex& mutexToLock, std::adopt_lock_t adoptLock);
+
+		virtual ~CSQLiteConnectionLock();
+
+	};
+
 
 	class CSQLHandler_SQLite : public CSQLHandler {
 	protected:
 
-		void* m_pDBHandle;
+		PSQLiteConnection m_pWriteConnection;
+
+		std::vector<PSQLiteConnection> m_ReadConnections;
+		std::atomic<uint32_t> m_nNextReadConnection;
+
+		void applyConfiguration(CSQLiteConnection* pConnection, const sSQLiteConfiguration& configuration, bool bIsWriteConnection);
 
 	public:
 
 		CSQLHandler_SQLite() = delete;
 		CSQLHandler_SQLite(const std::string & sFileName);
+		CSQLHandler_SQLite(const std::string & sFileName, const sSQLiteConfiguration & configuration);
 
 		virtual ~CSQLHandler_SQLite();
 
+		// Keeps SQLite defaults, only enables the statement cache.
+		static sSQLiteConfiguration getDefaultConfiguration();
+
+		// WAL journal with a pool of read connections, for databases with concurrent readers and writers.
+		static sSQLiteConfiguration getConcurrentConfiguration();
+
 		PSQLTransaction beginTransaction() override;
 
 		virtual PSQLStatement prepareStatementLocked(const std::string& sSQLString, PSQLTransactionLock pLock) override;
 
+		virtual PSQLStatement prepareReadStatement(const std::string& sSQLString) override;
+
+		uint32_t getReadConnectionCount();
+
+		PSQLiteConnection getWriteConnection();
+
+		PSQLiteConnection getReadConnection(uint32_t nIndex);
+
 		void checkSQLiteError (int nError);		
 
+		void checkSQLiteError (int nError, CSQLiteConnection * pConnection);
+
 	};
 
 	
@@ -76,6 +76,9 @@ namespace AMCData {
 		virtual bool nextRow() = 0;
 		virtual void execute() = 0;
 
+		// Rewinds an executed statement and clears its bindings, so that it can be executed again.
+		virtual void reset() = 0;
+
 		virtual std::string getColumnString(uint32_t nIdx) = 0;
 		virtual double getColumnDouble(uint32_t nIdx) = 0;
 		virtual int32_t getColumnInt(uint32_t nIdx) = 0;
@@ -35,11 +35,13 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 namespace AMCData {
 
-	CSQLStatement_SQLite::CSQLStatement_SQLite(CSQLHandler_SQLite* pHandler, void* pStmtHandle, PSQLTransactionLock pLock)
-		: m_pHandler (pHandler), m_pStmtHandle (pStmtHandle), m_bAllowNext (true), m_bHasColumn (false), m_bHadRow (false), m_pLock (pLock)
+	CSQLStatement_SQLite::CSQLStatement_SQLite(CSQLHandler_SQLite* pHandler, PSQLiteConnection pConnection, const std::string& sSQLString, void* pStmtHandle, PSQLTransactionLock pLock)
+		: m_pLock (pLock), m_pHandler (pHandler), m_pConnection (pConnection), m_sSQLString (sSQLString), m_pStmtHandle (pStmtHandle), m_bAllowNext (true), m_bHasColumn (false), m_bHadRow (false)
 	{
 		if (pHandler == nullptr)
 			throw ELibMCDataInterfaceException(LIBMCDATA_ERROR_INVALIDPARAM);
+		if (pConnection.get() == nullptr)
+			throw ELibMCDataInterfaceException(LIBMCDATA_ERROR_INVALIDPARAM);
 		if (pStmtHandle == nullptr)
 			throw ELibMCDataInterfaceException(LIBMCDATA_ERROR_INVALIDPARAM);
 
@@ -48,7 +50,9 @@ namespace AMCData {
 
 	CSQLStatement_SQLite::~CSQLStatement_SQLite()
 	{
-		sqlite3_finalize((sqlite3_stmt*) m_pStmtHandle);
+		// Hand the prepared statement back to the connection cache for the next query with the same SQL.
+		m_pConnection->releaseStatement(m_sSQLString, m_pStmtHandle);
+		m_pStmtHandle = nullptr;
 		m_bHasColumn = false;
 	}
 
@@ -83,7 +87,7 @@ namespace AMCData {
 	void CSQLStatement_SQLite::checkSQLiteError(int nError)
 	{
 		if (m_pHandler != nullptr) {
-			m_pHandler->checkSQLiteError(nError);
+			m_pHandler->checkSQLiteError(nError, m_pConnection.get());
 		}
 		else {
 			if (nError != SQLITE_OK)
@@ -145,6 +149,16 @@ namespace AMCData {
 
 	}
 
+	void CSQLStatement_SQLite::reset()
+	{
+		checkSQLiteError(sqlite3_reset((sqlite3_stmt*)m_pStmtHandle));
+		checkSQLiteError(sqlite3_clear_bindings((sqlite3_stmt*)m_pStmtHandle));
+
+		m_bAllowNext = true;
+		m_bHasColumn = false;
+		m_bHadRow = false;
+	}
+
 
 	bool CSQLStatement_SQLite::columnIsNull(uint32_t nIdx)
 	{
@@ -47,11 +47,16 @@ namespace AMCData {
 	class CSQLStatement_SQLite;
 	typedef std::shared_ptr<CSQLStatement_SQLite> PSQLStatement_SQLite;
 
+	class CSQLiteConnection;
+	typedef std::shared_ptr<CSQLiteConnection> PSQLiteConnection;
+
 	class CSQLStatement_SQLite : public CSQLStatement {
 	private:
 		PSQLTransactionLock m_pLock;
 
 		CSQLHandler_SQLite* m_pHandler; 
+		PSQLiteConnection m_pConnection;
+		std::string m_sSQLString;
 		void* m_pStmtHandle;
 
 		bool m_bAllowNext;
@@ -63,7 +68,7 @@ namespace AMCData {
 	public:
 
 		CSQLStatement_SQLite() = delete;
-		CSQLStatement_SQLite(CSQLHandler_SQLite* pHandler, void* pStmtHandle, PSQLTransactionLock pLock);
+		CSQLStatement_SQLite(CSQLHandler_SQLite* pHandler, PSQLiteConnection pConnection, const std::string& sSQLString, void* pStmtHandle, PSQLTransactionLock pLock);
 
 		virtual ~CSQLStatement_SQLite();
 			
@@ -75,6 +80,7 @@ namespace AMCData {
 
 		bool nextRow() override;
 		void execute() override;
+		void reset() override;
 
 		bool columnIsNull (uint32_t nIdx) override;
 
@@ -35,9 +35,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "common_exportstream_native.hpp"
 #include "common_importstream_native.hpp"
 
-#include "PicoSHA2/picosha2.h"
-
 #define STORAGE_ZIPSTREAM_MAXENTRIES (1024*1024*1024)
+#define STORAGE_HASHBLOCKSIZE 65536
 
 namespace AMCData {
 
@@ -56,6 +55,7 @@ namespace AMCData {
 		: CStorageWriter(), m_nSize (nSize), m_sUUID (AMCCommon::CUtils::normalizeUUIDString (sUUID)), m_sPath (sPath)
 	{
 		m_pExportStream = std::make_shared<AMCCommon::CExportStream_Native>(sPath);
+		m_pSHA256Calculator = std::make_shared<AMCCommon::CSHA256Calculator>(STORAGE_HASHBLOCKSIZE);
 	}
 
 	CStorageWriter_Partial::~CStorageWriter_Partial()
@@ -91,6 +91,16 @@ namespace AMCData {
 
 
 			m_pExportStream->writeBuffer(pChunkData, nChunkSize);
+
+			if (m_pSHA256Calculator.get() != nullptr) {
+				if ((nOffset == nSize) && (nOffset == m_pSHA256Calculator->getProcessedSize())) {
+					m_pSHA256Calculator->addData(pChunkData, nChunkSize);
+				}
+				else {
+					// Out of order write, hashes need to be calculated from disk on finalize.
+					m_pSHA256Calculator = nullptr;
+				}
+			}
 		}
 
 	}
@@ -112,8 +122,13 @@ namespace AMCData {
 			// Free ExportStream and close file
 			m_pExportStream = nullptr;
 
-			sCalculatedSHA256 = AMCCommon::CUtils::calculateSHA256FromFile(m_sPath);
-			sCalculatedBlockSHA256 = AMCCommon::CUtils::calculateBlockwiseSHA256FromFile(m_sPath, 65536);
+			if (m_pSHA256Calculator.get() == nullptr) {
+				m_pSHA256Calculator = std::make_shared<AMCCommon::CSHA256Calculator>(STORAGE_HASHBLOCKSIZE);
+				m_pSHA256Calculator->addFileRange(m_sPath, 0, nSize);
+			}
+
+			m_pSHA256Calculator->finish(sCalculatedSHA256, sCalculatedBlockSHA256);
+			m_pSHA256Calculator = nullptr;
 
 			if (!sNeededSHA256.empty()) {
 				auto sNeededSHA256Normalized = AMCCommon::CUtils::normalizeSHA256String(sNeededSHA256);
@@ -141,6 +156,7 @@ namespace AMCData {
 		: CStorageWriter(), m_sUUID(AMCCommon::CUtils::normalizeUUIDString(sUUID)), m_sPath(sPath)
 	{
 		m_pExportStream = std::make_shared<AMCCommon::CExportStream_Native>(sPath);
+		m_pSHA256Calculator = std::make_shared<AMCCommon::CSHA256Calculator>(STORAGE_HASHBLOCKSIZE);
 	}
 
 	CStorageWriter_RandomAccess::~CStorageWriter_RandomAccess()
@@ -176,6 +192,16 @@ namespace AMCData {
 
 
 			m_pExportStream->writeBuffer(pChunkData, nChunkSize);
+
+			if (m_pSHA256Calculator.get() != nullptr) {
+				if ((nOffset == nSize) && (nOffset == m_pSHA256Calculator->getProcessedSize())) {
+					m_pSHA256Calculator->addData(pChunkData, nChunkSize);
+				}
+				else {
+					// Out of order write, hashes need to be calculated from disk on finalize.
+					m_pSHA256Calculator = nullptr;
+				}
+			}
 		}
 
 	}
@@ -195,8 +221,13 @@ namespace AMCData {
 			// Free ExportStream and close file
 			m_pExportStream = nullptr;
 
-			sCalculatedSHA256 = AMCCommon::CUtils::calculateSHA256FromFile(m_sPath);
-			sCalculatedBlockSHA256 = AMCCommon::CUtils::calculateBlockwiseSHA256FromFile(m_sPath, 65536);
+			if (m_pSHA256Calculator.get() == nullptr) {
+				m_pSHA256Calculator = std::make_shared<AMCCommon::CSHA256Calculator>(STORAGE_HASHBLOCKSIZE);
+				m_pSHA256Calculator->addFileRange(m_sPath, 0, nSize);
+			}
+
+			m_pSHA256Calculator->finish(sCalculatedSHA256, sCalculatedBlockSHA256);
+			m_pSHA256Calculator = nullptr;
 
 		}
 		catch (...) {
@@ -234,6 +265,7 @@ namespace AMCData {
 	{
 		m_pExportStream = std::make_shared<AMCCommon::CExportStream_Native>(sPath);
 		m_pPortableZIPWriter = std::make_shared<AMCCommon::CPortableZIPWriter>(m_pExportStream, true);
+		m_pSHA256Calculator = std::make_shared<AMCCommon::CSHA256Calculator>(STORAGE_HASHBLOCKSIZE);
 	}
 
 	CStorageWriter_ZIPStream::~CStorageWriter_ZIPStream()
@@ -308,6 +340,19 @@ namespace AMCData {
 		m_nZIPSize = m_pExportStream->getPosition();
 
 		m_nCurrentEntryID = 0;
+
+		hashFinishedData();
+	}
+
+	void CStorageWriter_ZIPStream::hashFinishedData()
+	{
+		// Everything in front of the next local header is final now. The data is read back
+		// while it is still in the file cache, instead of rehashing the full file on finalize.
+		uint64_t nHashedSize = m_pSHA256Calculator->getProcessedSize();
+		if (m_nZIPSize > nHashedSize) {
+			m_pExportStream->flushStream();
+			m_pSHA256Calculator->addFileRange(m_sPath, nHashedSize, m_nZIPSize - nHashedSize);
+		}
 	}
 
 	uint32_t CStorageWriter_ZIPStream::getOpenEntryID()
@@ -386,11 +431,14 @@ namespace AMCData {
 			m_pExportStream->seekFromEnd(0, true);
 			m_nZIPSize = m_pExportStream->getPosition();
 
+			// Hash central directory
+			hashFinishedData();
+
 			// Free ExportStream and close file
 			m_pExportStream = nullptr;
 
-			sCalculatedSHA256 = AMCCommon::CUtils::calculateSHA256FromFile(m_sPath);
-			sCalculatedBlockSHA256 = AMCCommon::CUtils::calculateBlockwiseSHA256FromFile(m_sPath, 65536);
+			m_pSHA256Calculator->finish(sCalculatedSHA256, sCalculatedBlockSHA256);
+			m_pSHA256Calculator = nullptr;
 
 		}
 		catch (...) {
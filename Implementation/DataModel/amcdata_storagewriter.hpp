@@ -37,7 +37,9 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <map>
 #include <mutex>
 #include "common_exportstream.hpp"
+#include "common_exportstream_native.hpp"
 #include "common_portablezipwriter.hpp"
+#include "common_sha256calculator.hpp"
 
 namespace AMCData {
 
@@ -67,6 +69,9 @@ private:
 	uint64_t m_nSize;
     AMCCommon::PExportStream m_pExportStream;
 
+    // Hashes are calculated while writing, as long as chunks arrive in order.
+    AMCCommon::PSHA256Calculator m_pSHA256Calculator;
+
     std::mutex m_WriteMutex;
 
 public:
@@ -90,6 +95,9 @@ private:
     std::string m_sPath;
     AMCCommon::PExportStream m_pExportStream;
 
+    // Hashes are calculated while writing, as long as chunks arrive in order.
+    AMCCommon::PSHA256Calculator m_pSHA256Calculator;
+
     std::mutex m_WriteMutex;
 
 public:
@@ -113,7 +121,7 @@ class CStorageWriter_ZIPStream : public CStorageWriter {
 private:
     std::string m_sUUID;
     std::string m_sPath;
-    AMCCommon::PExportStream m_pExportStream;
+    AMCCommon::PExportStream_Native m_pExportStream;
     AMCCommon::PExportStream m_pCurrentEntryExportStream;
     AMCCommon::PPortableZIPWriter m_pPortableZIPWriter;
 
@@ -124,6 +132,11 @@ private:
 
     std::map <uint32_t, uint64_t> m_nEntryDataSizes;
 
+    // ZIP headers are patched when an entry is closed, so hashing follows behind the last finished entry.
+    AMCCommon::PSHA256Calculator m_pSHA256Calculator;
+
+    void hashFinishedData();
+
     std::mutex m_WriteMutex;
 
 public:
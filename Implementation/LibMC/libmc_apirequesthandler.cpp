@@ -38,6 +38,10 @@ Abstract: This is a stub class definition of CAPIRequestHandler
 #include "amc_api_constants.hpp"
 #include "amc_api_response.hpp"
 // Include custom headers here.
+#include "common_utils.hpp"
+
+#include <cstring>
+#include <cstdlib>
 
 
 using namespace LibMC::Impl;
@@ -141,13 +145,29 @@ void CAPIRequestHandler::SetRequestParameter(const std::string& sName, const std
 }
 
 
-void CAPIRequestHandler::GetResultData(LibMC_uint64 nDataBufferSize, LibMC_uint64* pDataNeededCount, LibMC_uint8 * pDataBuffer)
+void CAPIRequestHandler::getResultStream(const uint8_t*& pStreamData, uint64_t& nStreamSize)
 {
+	if (m_pResponse.get() == nullptr)
+		throw ELibMCInterfaceException(LIBMC_ERROR_APIREQUESTNOTHANDLED);
+
+	if (!m_sContentEncoding.empty()) {
+		size_t nEncodedSize = 0;
+		pStreamData = m_pResponse->getEncodedStreamData(m_sContentEncoding, nEncodedSize);
+		if (pStreamData == nullptr)
+			throw ELibMCInterfaceException(LIBMC_ERROR_INTERNALERROR);
+		nStreamSize = (uint64_t)nEncodedSize;
+	}
+	else {
+		pStreamData = m_pResponse->getStreamData();
+		nStreamSize = (uint64_t)m_pResponse->getStreamSize();
+	}
+}
 
-    if (m_pResponse.get() == nullptr)
-        throw ELibMCInterfaceException(LIBMC_ERROR_APIREQUESTNOTHANDLED);
-
-	uint64_t nStreamSize = (uint64_t)m_pResponse->getStreamSize();
+void CAPIRequestHandler::GetResultData(LibMC_uint64 nDataBufferSize, LibMC_uint64* pDataNeededCount, LibMC_uint8 * pDataBuffer)
+{
+	const uint8_t* pStreamData = nullptr;
+	uint64_t nStreamSize = 0;
+	getResultStream(pStreamData, nStreamSize);
 
 	if (pDataNeededCount != nullptr) {
 		*pDataNeededCount = nStreamSize;
@@ -158,16 +178,51 @@ void CAPIRequestHandler::GetResultData(LibMC_uint64 nDataBufferSize, LibMC_uint6
 		if (nDataBufferSize < nStreamSize)
 			throw ELibMCInterfaceException(LIBMC_ERROR_BUFFERTOOSMALL);
 
-		if (m_pResponse.get() != nullptr) {
-			const uint8_t* pSrc = m_pResponse->getStreamData();
-			uint8_t* pDst = pDataBuffer;
+		if (nStreamSize > 0)
+			memcpy(pDataBuffer, pStreamData, (size_t)nStreamSize);
+	}
+
+}
+
+bool CAPIRequestHandler::AcceptsRanges()
+{
+	if (m_pResponse.get() == nullptr)
+		throw ELibMCInterfaceException(LIBMC_ERROR_APIREQUESTNOTHANDLED);
+
+	// Ranges always refer to the unencoded representation
+	return m_sContentEncoding.empty() && m_pResponse->acceptsRanges();
+}
+
+LibMC_uint64 CAPIRequestHandler::GetResultSize()
+{
+	const uint8_t* pStreamData = nullptr;
+	uint64_t nStreamSize = 0;
+	getResultStream(pStreamData, nStreamSize);
+
+	return nStreamSize;
+}
 
-			for (uint64_t nIndex = 0; nIndex < nStreamSize; nIndex++) {
-				*pDst = *pSrc; pDst++; pSrc++;
-			}
-		}
+void CAPIRequestHandler::GetResultDataRange(const LibMC_uint64 nOffset, const LibMC_uint64 nLength, LibMC_uint64 nDataBufferSize, LibMC_uint64* pDataNeededCount, LibMC_uint8* pDataBuffer)
+{
+	const uint8_t* pStreamData = nullptr;
+	uint64_t nStreamSize = 0;
+	getResultStream(pStreamData, nStreamSize);
+
+	if ((nOffset > nStreamSize) || (nLength > (nStreamSize - nOffset)))
+		throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDRESULTDATARANGE);
+
+	if (pDataNeededCount != nullptr) {
+		*pDataNeededCount = nLength;
 	}
 
+	if (pDataBuffer != nullptr) {
+
+		if (nDataBufferSize < nLength)
+			throw ELibMCInterfaceException(LIBMC_ERROR_BUFFERTOOSMALL);
+
+		if (nLength > 0)
+			memcpy(pDataBuffer, pStreamData + nOffset, (size_t)nLength);
+	}
 }
 
 
@@ -180,3 +235,79 @@ std::string CAPIRequestHandler::GetContentDispositionName()
 
 }
 
+std::string CAPIRequestHandler::GetETag()
+{
+    if (m_pResponse.get() == nullptr)
+        throw ELibMCInterfaceException(LIBMC_ERROR_APIREQUESTNOTHANDLED);
+
+    return m_pResponse->getETag();
+}
+
+std::string CAPIRequestHandler::SelectContentEncoding(const std::string& sAcceptEncoding)
+{
+    if (m_pResponse.get() == nullptr)
+        throw ELibMCInterfaceException(LIBMC_ERROR_APIREQUESTNOTHANDLED);
+
+    bool bAcceptsGZIP = false;
+    bool bAcceptsDeflate = false;
+    bool bListsGZIP = false;
+    bool bListsDeflate = false;
+    bool bAcceptsWildcard = false;
+
+    // Parse comma separated list of codings with optional quality values, e.g. "gzip;q=1.0, deflate, *;q=0"
+    std::string sLowerAcceptEncoding = AMCCommon::CUtils::toLowerString(sAcceptEncoding);
+    size_t nStart = 0;
+    while (nStart < sLowerAcceptEncoding.length()) {
+        size_t nEnd = sLowerAcceptEncoding.find(',', nStart);
+        if (nEnd == std::string::npos)
+            nEnd = sLowerAcceptEncoding.length();
+
+        std::string sToken = sLowerAcceptEncoding.substr(nStart, nEnd - nStart);
+        nStart = nEnd + 1;
+
+        std::string sCoding = sToken;
+        double dQuality = 1.0;
+        size_t nSemicolon = sToken.find(';');
+        if (nSemicolon != std::string::npos) {
+            sCoding = sToken.substr(0, nSemicolon);
+            size_t nQualityPos = sToken.find("q=", nSemicolon);
+            if (nQualityPos != std::string::npos)
+                dQuality = strtod(sToken.c_str() + nQualityPos + 2, nullptr);
+        }
+
+        sCoding = AMCCommon::CUtils::trimString(sCoding);
+        bool bAccepted = (dQuality > 0.0);
+
+        // Codings that are listed explicitly, even with q=0, are not affected by the wildcard
+        if (sCoding == "gzip") {
+            bListsGZIP = true;
+            bAcceptsGZIP = bAccepted;
+        }
+        else if (sCoding == "deflate") {
+            bListsDeflate = true;
+            bAcceptsDeflate = bAccepted;
+        }
+        else if (sCoding == "*") {
+            bAcceptsWildcard = bAccepted;
+        }
+    }
+
+    if (bAcceptsWildcard) {
+        if (!bListsGZIP)
+            bAcceptsGZIP = true;
+        if (!bListsDeflate)
+            bAcceptsDeflate = true;
+    }
+
+    m_sContentEncoding = "";
+
+    size_t nEncodedSize = 0;
+    if (bAcceptsGZIP && (m_pResponse->getEncodedStreamData("gzip", nEncodedSize) != nullptr)) {
+        m_sContentEncoding = "gzip";
+    }
+    else if (bAcceptsDeflate && (m_pResponse->getEncodedStreamData("deflate", nEncodedSize) != nullptr)) {
+        m_sContentEncoding = "deflate";
+    }
+
+    return m_sContentEncoding;
+}
@@ -77,6 +77,12 @@ protected:
 
 	AMC::PLogger m_pLogger;
 
+	// Selected precompressed variant of the response, if any
+	std::string m_sContentEncoding;
+
+	// Returns the result data in the selected content encoding
+	void getResultStream(const uint8_t*& pStreamData, uint64_t& nStreamSize);
+
 public:
 
 	CAPIRequestHandler(AMC::PAPI pAPI, const std::string& sURI, const AMC::eAPIRequestType eRequestType, AMC::PAPIAuth pAuth, AMC::PLogger pLogger);
@@ -98,6 +104,16 @@ public:
 	void SetRequestParameter(const std::string& sName, const std::string& sValue) override;
 
 	std::string GetContentDispositionName() override;
+
+	std::string GetETag() override;
+
+	std::string SelectContentEncoding(const std::string& sAcceptEncoding) override;
+
+	bool AcceptsRanges() override;
+
+	LibMC_uint64 GetResultSize() override;
+
+	void GetResultDataRange(const LibMC_uint64 nOffset, const LibMC_uint64 nLength, LibMC_uint64 nDataBufferSize, LibMC_uint64* pDataNeededCount, LibMC_uint8 * pDataBuffer) override;
 	
 };
 
@@ -48,6 +48,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "amc_resourcepackage.hpp"
 #include "amc_accesscontrol.hpp"
 #include "amc_statesignalhandler.hpp"
+#include "amc_toolpathhandler.hpp"
 
 #include "amc_api_factory.hpp"
 #include "amc_api_sessionhandler.hpp"
@@ -62,7 +63,15 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define MACHINEDEFINITION_XMLSCHEMA "http://schemas.autodesk.com/amc/machinedefinitions/2020/02"
 #define MACHINEDEFINITIONTEST_XMLSCHEMA "http://schemas.autodesk.com/amc/testdefinitions/2020/02"
 
-#define LIBMC_SYSTEMTHREAD_INTERVAL_MILLISECONDS 10
+#define LIBMC_SYSTEMTASK_SIGNALTIMEOUTS "signaltimeouts"
+#define LIBMC_SYSTEMTASK_SIGNALARCHIVE "signalarchive"
+#define LIBMC_SYSTEMTASK_TELEMETRYARCHIVE "telemetryarchive"
+#define LIBMC_SYSTEMTASK_MEMORYUSAGE "memoryusage"
+
+#define LIBMC_SYSTEMTASK_SIGNALTIMEOUTS_DEFAULTINTERVAL_MILLISECONDS 10
+#define LIBMC_SYSTEMTASK_SIGNALARCHIVE_DEFAULTINTERVAL_MILLISECONDS 100
+#define LIBMC_SYSTEMTASK_TELEMETRYARCHIVE_DEFAULTINTERVAL_MILLISECONDS 10000
+#define LIBMC_SYSTEMTASK_MEMORYUSAGE_DEFAULTINTERVAL_MILLISECONDS 1000
 
 using namespace LibMC::Impl;
 using namespace AMC;
@@ -130,6 +139,10 @@ CMCContext::CMCContext(LibMCData::PDataModel pDataModel)
     }
 
     m_pSystemState->driverHandler()->setTempBasePath(sTempPath);
+
+    // Create System Task Scheduler
+    m_pSystemTaskScheduler = std::make_shared<CSystemTaskScheduler>(pGlobalChrono, m_pSystemState->getTelemetryHandlerInstance());
+    registerSystemTasks();
 }
 
 CMCContext::~CMCContext()
@@ -210,6 +223,20 @@ void CMCContext::ParseConfiguration(const std::string & sXMLString)
 
         }
 
+        auto systemTasksNode = mainNode.child("systemtasks");
+        if (!systemTasksNode.empty()) {
+
+            loadSystemTaskIntervals(systemTasksNode);
+
+        }
+
+        auto toolpathCacheNode = mainNode.child("toolpathcache");
+        if (!toolpathCacheNode.empty()) {
+
+            loadToolpathCacheParameters(toolpathCacheNode);
+
+        }
+
         auto sCoreResourcePath = m_pSystemState->getLibraryResourcePath("core");
         m_pSystemState->logger()->logMessage("Loading core resources from " + sCoreResourcePath + "...", LOG_SUBSYSTEM_SYSTEM, AMC::eLogLevel::Message);
         auto pResourcePackageStream = std::make_shared<AMCCommon::CImportStream_Native>(sCoreResourcePath);
@@ -944,28 +971,92 @@ LibMCPlugin::PWrapper CMCContext::loadPlugin(std::string sPluginName)
 }
 
 
-void CMCContext::executeSystemThread()
+void CMCContext::registerSystemTasks()
 {
-    auto pLogger = m_pSystemState->getLoggerInstance();
+    auto pSystemState = m_pSystemState.get();
+
+    m_pSystemTaskScheduler->registerTask(LIBMC_SYSTEMTASK_SIGNALTIMEOUTS, "Signal Reaction Timeouts", LIBMC_SYSTEMTASK_SIGNALTIMEOUTS_DEFAULTINTERVAL_MILLISECONDS, [pSystemState]() {
+        pSystemState->stateSignalHandler()->checkForReactionTimeouts(pSystemState->globalChrono()->getElapsedMicroseconds());
+    });
+
+    m_pSystemTaskScheduler->registerTask(LIBMC_SYSTEMTASK_SIGNALARCHIVE, "Signal Archiving", LIBMC_SYSTEMTASK_SIGNALARCHIVE_DEFAULTINTERVAL_MILLISECONDS, [pSystemState]() {
+        auto pSignalHandler = pSystemState->stateSignalHandler();
+        pSignalHandler->autoArchiveMessages(pSystemState->globalChrono()->getElapsedMicroseconds());
+        pSignalHandler->writeMessagesToArchive(nullptr);
+    });
+
+    m_pSystemTaskScheduler->registerTask(LIBMC_SYSTEMTASK_TELEMETRYARCHIVE, "Telemetry Archiving", LIBMC_SYSTEMTASK_TELEMETRYARCHIVE_DEFAULTINTERVAL_MILLISECONDS, [pSystemState]() {
+        pSystemState->telemetryHandler()->archiveOldChunksToDB();
+    });
+
+    m_pSystemTaskScheduler->registerTask(LIBMC_SYSTEMTASK_MEMORYUSAGE, "Memory Usage Update", LIBMC_SYSTEMTASK_MEMORYUSAGE_DEFAULTINTERVAL_MILLISECONDS, [pSystemState]() {
+        pSystemState->updateMemoryUsageParameters();
+    });
+
+    // Archive telemetry chunks as soon as they become read-only
+    std::weak_ptr<CSystemTaskScheduler> pWeakScheduler = m_pSystemTaskScheduler;
+    m_pSystemState->telemetryHandler()->setArchiveQueueCallback([pWeakScheduler]() {
+        auto pScheduler = pWeakScheduler.lock();
+        if (pScheduler.get() != nullptr)
+            pScheduler->wakeTask(LIBMC_SYSTEMTASK_TELEMETRYARCHIVE);
+    });
+}
 
-    try {
+void CMCContext::loadSystemTaskIntervals(const pugi::xml_node& xmlNode)
+{
+    auto taskNodes = xmlNode.children("task");
+    for (auto taskNode : taskNodes) {
+        std::string sTaskName = taskNode.attribute("name").as_string();
+        if (!m_pSystemTaskScheduler->hasTask(sTaskName))
+            throw ELibMCCustomException(LIBMC_ERROR_SYSTEMTASKNOTFOUND, sTaskName);
 
-        while (!systemThreadShallTerminate()) {
+        auto intervalAttrib = taskNode.attribute("interval");
+        if (intervalAttrib.empty())
+            throw ELibMCCustomException(LIBMC_ERROR_INVALIDSYSTEMTASKINTERVAL, sTaskName);
 
+        int nInterval = intervalAttrib.as_int();
+        if ((nInterval < AMC_SYSTEMTASK_MININTERVAL_MILLISECONDS) || (nInterval > AMC_SYSTEMTASK_MAXINTERVAL_MILLISECONDS))
+            throw ELibMCCustomException(LIBMC_ERROR_INVALIDSYSTEMTASKINTERVAL, sTaskName + ": " + intervalAttrib.as_string());
 
-            auto pSignalHandler = m_pSystemState->getStateSignalHandlerInstance();
-            pSignalHandler->checkForReactionTimeouts(m_pSystemState->globalChrono()->getElapsedMicroseconds());
-            pSignalHandler->autoArchiveMessages(m_pSystemState->globalChrono()->getElapsedMicroseconds());            
-            pSignalHandler->writeMessagesToArchive(nullptr);
-            
-			auto pTelemetryHandler = m_pSystemState->getTelemetryHandlerInstance();
-            pTelemetryHandler->archiveOldChunksToDB();
+        m_pSystemTaskScheduler->setTaskInterval(sTaskName, (uint32_t)nInterval);
+    }
+}
 
-            m_pSystemState->updateMemoryUsageParameters();            
+void CMCContext::loadToolpathCacheParameters(const pugi::xml_node& xmlNode)
+{
+    auto pToolpathHandler = m_pSystemState->toolpathHandler();
+
+    uint32_t nMemoryQuotaInMB = pToolpathHandler->getLayerCacheMemoryQuotaInMB();
+    auto memoryQuotaAttrib = xmlNode.attribute("memoryquota");
+    if (!memoryQuotaAttrib.empty()) {
+        int nValue = memoryQuotaAttrib.as_int(-1);
+        if (nValue < 0)
+            throw ELibMCCustomException(LIBMC_ERROR_INVALIDTOOLPATHLAYERCACHEPARAMETER, std::string("memoryquota: ") + memoryQuotaAttrib.as_string());
+        nMemoryQuotaInMB = (uint32_t)nValue;
+    }
 
+    uint32_t nPrefetchCount = pToolpathHandler->getLayerPrefetchCount();
+    auto prefetchCountAttrib = xmlNode.attribute("prefetchcount");
+    if (!prefetchCountAttrib.empty()) {
+        int nValue = prefetchCountAttrib.as_int(-1);
+        if (nValue < 0)
+            throw ELibMCCustomException(LIBMC_ERROR_INVALIDTOOLPATHLAYERCACHEPARAMETER, std::string("prefetchcount: ") + prefetchCountAttrib.as_string());
+        nPrefetchCount = (uint32_t)nValue;
+    }
 
+    pToolpathHandler->setLayerCacheParameters(nMemoryQuotaInMB, nPrefetchCount);
+
+    m_pSystemState->logger()->logMessage("Toolpath layer cache: " + std::to_string(nMemoryQuotaInMB) + " MB, prefetching " + std::to_string(nPrefetchCount) + " layers", LOG_SUBSYSTEM_SYSTEM, AMC::eLogLevel::Message);
+}
+
+void CMCContext::executeSystemThread()
+{
+    auto pLogger = m_pSystemState->getLoggerInstance();
+
+    try {
+
+        m_pSystemTaskScheduler->run();
 
-        }
     }
     catch (std::exception & E)
     {
@@ -998,6 +1089,7 @@ void CMCContext::startSystemThread()
     // Initialise signals
     m_SystemTerminateSignal = std::promise<void>();
     m_SystemTerminateFuture = m_SystemTerminateSignal.get_future();
+    m_pSystemTaskScheduler->clearTerminationRequest();
 
     // Start Thread
     m_SystemThread = std::thread(&CMCContext::executeSystemThread, this);
@@ -1009,14 +1101,6 @@ bool CMCContext::systemThreadIsRunning()
     return m_SystemTerminateFuture.valid();
 }
 
-bool CMCContext::systemThreadShallTerminate()
-{
-    if (m_SystemTerminateFuture.wait_for(std::chrono::milliseconds(LIBMC_SYSTEMTHREAD_INTERVAL_MILLISECONDS)) == std::future_status::timeout)
-        return false;
-
-    return true;
-}
-
 void CMCContext::terminateSystemThread()
 {
     m_pSystemState->logger()->logMessage("terminating system thread...", LOG_SUBSYSTEM_SYSTEM, AMC::eLogLevel::Message);
@@ -1024,8 +1108,9 @@ void CMCContext::terminateSystemThread()
     if (!systemThreadIsRunning())
         throw ELibMCCustomException(LIBMC_ERROR_THREADISNOTRUNNING, "system");
 
-    // Set termination flag
+    // Set termination flag and wake up the scheduler
     m_SystemTerminateSignal.set_value();
+    m_pSystemTaskScheduler->requestTermination();
 
     // Wait for thread to finish
     m_SystemThread.join();
@@ -1188,9 +1273,8 @@ IAPIRequestHandler* CMCContext::CreateAPIRequestHandler(const std::string& sURI,
 
 IStreamConnection* CMCContext::CreateStreamConnection(const std::string& sStreamUUID)
 {
-    std::string sNormalizedStreamUUID = AMCCommon::CUtils::normalizeUUIDString(sStreamUUID);
-
-    return new CStreamConnection(sNormalizedStreamUUID);
+    auto pStream = m_pSystemState->getStreamHandlerInstance()->findStream(sStreamUUID, true);
 
+    return new CStreamConnection(pStream);
 
 }
@@ -39,6 +39,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "amc_statesignalhandler.hpp"
 #include "amc_resourcepackage.hpp"
+#include "amc_systemtaskscheduler.hpp"
 
 #include "API/amc_api_handler_root.hpp"
 #include "API/amc_api_handler_apidocs.hpp"
@@ -101,12 +102,13 @@ private:
 	std::thread m_SystemThread;
 	std::promise<void> m_SystemTerminateSignal;
 	std::future<void> m_SystemTerminateFuture;
+	AMC::PSystemTaskScheduler m_pSystemTaskScheduler;
 
+	void registerSystemTasks();
 	void startSystemThread();
 	void terminateSystemThread();
 	void executeSystemThread();
 	bool systemThreadIsRunning();
-	bool systemThreadShallTerminate();
 
 
 	void loadParameterGroup (const pugi::xml_node& xmlNode, AMC::PParameterGroup pGroup);
@@ -114,6 +116,8 @@ private:
 	void loadDriverParameterGroup (const pugi::xml_node& xmlNode, AMC::PParameterGroup pGroup);
 	void loadAccessControl(const pugi::xml_node& xmlNode);
 	void loadAlertDefinitions(const pugi::xml_node& xmlNode);
+	void loadSystemTaskIntervals(const pugi::xml_node& xmlNode);
+	void loadToolpathCacheParameters(const pugi::xml_node& xmlNode);
 
 	void readSignalParameters(const std::string& sSignalName, const pugi::xml_node& xmlNode, std::vector<AMC::CStateSignalParameter>& Parameters, std::vector<AMC::CStateSignalParameter>& Results, uint32_t& nSignalReactionTimeOut, uint32_t & nAutomaticArchiveTimeInMS, uint32_t& nSignalQueueSize);
 
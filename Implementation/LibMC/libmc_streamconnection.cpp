@@ -35,55 +35,67 @@ Abstract: This is a stub class definition of CStreamConnection
 #include "libmc_interfaceexception.hpp"
 
 // Include custom headers here.
-#include "common_utils.hpp"
 #include "libmc_streamdata.hpp"
 
 using namespace LibMC::Impl;
 
-#include <iostream>
 
 /*************************************************************************************************************************
  Class definition of CStreamConnection 
 **************************************************************************************************************************/
 
-CStreamConnection::CStreamConnection(const std::string& sStreamUUID)
-    : m_sStreamUUID (AMCCommon::CUtils::normalizeUUIDString (sStreamUUID)),
-    m_nDummy (0)
+CStreamConnection::CStreamConnection(AMC::PStream pStream)
+    : m_pStream (pStream)
 {
+    if (pStream.get() == nullptr)
+        throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDPARAM);
 
+    m_pSubscription = m_pStream->subscribe();
 }
 
 
 CStreamConnection::~CStreamConnection()
 {
-
+    // Closing the subscription makes the stream drop it on its next publish
+    if (m_pSubscription.get() != nullptr)
+        m_pSubscription->close();
 }
 
-
-IStreamData * CStreamConnection::GetNewContent()
+IStreamData* CStreamConnection::createStreamData(AMC::PStreamPacket pPacket)
 {
-	std::unique_ptr<CStreamData> pStreamData(new CStreamData("image/jpeg"));
+    if (pPacket.get() == nullptr)
+        return nullptr;
 
-    auto & buffer = pStreamData->getBuffer();
-
-    std::string sString = "{ \"test\": \"abc" + std::to_string (m_nDummy)  + "\" }";
-    for (auto ch : sString) {
-        buffer.push_back(ch);
-    }
-
-    m_nDummy++;
+    std::unique_ptr<CStreamData> pStreamData(new CStreamData(pPacket->getMIMEType()));
+    pStreamData->getBuffer() = pPacket->getData();
 
     return pStreamData.release();
+}
 
 
+IStreamData * CStreamConnection::GetNewContent()
+{
+    return createStreamData(m_pSubscription->popPacket());
+}
+
+IStreamData* CStreamConnection::WaitForNewContent(const LibMC_uint32 nTimeOutInMS)
+{
+    return createStreamData(m_pSubscription->waitForPacket(nTimeOutInMS));
 }
 
 uint32_t CStreamConnection::GetIdleDelay()
 {
-    return 50;
+    return LIBMC_STREAMCONNECTION_IDLEDELAY_MS;
 }
 
 LibMC::eStreamConnectionType CStreamConnection::GetStreamType()
 {
-    return LibMC::eStreamConnectionType::JSONEventStream;
+    switch (m_pStream->getStreamType()) {
+        case AMC::eStreamType::JSONEventStream:
+            return LibMC::eStreamConnectionType::JSONEventStream;
+        case AMC::eStreamType::JPEGImageStream:
+            return LibMC::eStreamConnectionType::JPEGImageStream;
+        default:
+            throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDPARAM);
+    }
 }
@@ -45,7 +45,9 @@ Abstract: This is the class declaration of CStreamConnection
 #endif
 
 // Include custom headers here.
+#include "amc_streamhandler.hpp"
 
+#define LIBMC_STREAMCONNECTION_IDLEDELAY_MS 1000
 
 namespace LibMC {
 namespace Impl {
@@ -58,17 +60,21 @@ namespace Impl {
 class CStreamConnection : public virtual IStreamConnection, public virtual CBase {
 private:
 
-    std::string m_sStreamUUID;
-    uint32_t m_nDummy;
+    AMC::PStream m_pStream;
+    AMC::PStreamSubscription m_pSubscription;
+
+    IStreamData* createStreamData(AMC::PStreamPacket pPacket);
 
 public:
 
-    CStreamConnection(const std::string & sStreamUUID);
+    CStreamConnection(AMC::PStream pStream);
 
     virtual ~CStreamConnection();
 
 	IStreamData * GetNewContent() override;
 
+	IStreamData * WaitForNewContent(const LibMC_uint32 nTimeOutInMS) override;
+
 	uint32_t GetIdleDelay() override;
 
     LibMC::eStreamConnectionType GetStreamType() override;
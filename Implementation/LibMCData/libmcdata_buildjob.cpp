@@ -91,7 +91,7 @@ CBuildJob* CBuildJob::makeFromDatabase(const std::string& sJobUUID, AMCData::PSQ
     auto sParsedJobUUID = AMCCommon::CUtils::normalizeUUIDString(sJobUUID);
 
     std::string sQuery = "SELECT buildjobs.uuid, buildjobs.name, buildjobs.status, buildjobs.timestamp, buildjobs.storagestreamuuid, buildjobs.layercount, buildjobs.useruuid, users.login, (SELECT count(buildjobexecutions.uuid) FROM buildjobexecutions WHERE buildjobexecutions.jobuuid=buildjobs.uuid), buildjobs.thumbnailuuid, storage_streams.size FROM buildjobs LEFT JOIN users ON users.uuid=buildjobs.useruuid LEFT JOIN storage_streams ON storage_streams.uuid=buildjobs.storagestreamuuid WHERE buildjobs.uuid=?";
-    auto pStatement = pSQLHandler->prepareStatement(sQuery);
+    auto pStatement = pSQLHandler->prepareReadStatement(sQuery);
     pStatement->setString(1, sParsedJobUUID);
     if (!pStatement->nextRow())
         throw ELibMCDataInterfaceException(LIBMCDATA_ERROR_JOBUUIDNOTFOUND);
@@ -359,7 +359,7 @@ bool CBuildJob::JobCanBeArchived()
 {
     // TODO: Track active jobs and prevent them from archiving.
     std::string sQuery = "SELECT uuid FROM buildjobs WHERE status=? AND uuid=?";
-    auto pStatement = m_pSQLHandler->prepareStatement(sQuery);
+    auto pStatement = m_pSQLHandler->prepareReadStatement(sQuery);
     pStatement->setString(1, convertBuildJobStatusToString(LibMCData::eBuildJobStatus::Validated));
     pStatement->setString(2, m_sUUID);
     return pStatement->nextRow();
@@ -444,7 +444,7 @@ IBuildJobDataIterator* CBuildJob::ListJobDataByType(const LibMCData::eCustomData
 {
 
     std::string sQuery = "SELECT buildjobdata.uuid, buildjobdata.jobuuid, buildjobdata.identifier, buildjobdata.name, buildjobdata.datatype, buildjobdata.timestamp, buildjobdata.storagestreamuuid, buildjobdata.useruuid, storage_streams.sha2, storage_streams.size FROM buildjobdata LEFT JOIN storage_streams ON storage_streams.uuid=storagestreamuuid WHERE jobuuid=? AND active=? AND datatype=? ORDER BY buildjobdata.timestamp DESC";
-    auto pStatement = m_pSQLHandler->prepareStatement(sQuery);
+    auto pStatement = m_pSQLHandler->prepareReadStatement(sQuery);
     pStatement->setString (1, m_sUUID);
     pStatement->setInt(2, 1);
     pStatement->setString(3, CBuildJobData::convertCustomDataTypeToString(eDataType));
@@ -457,7 +457,7 @@ IBuildJobDataIterator* CBuildJob::ListJobData()
     std::unique_ptr<CBuildJobDataIterator> buildJobIterator (new CBuildJobDataIterator ());
 
     std::string sQuery = "SELECT buildjobdata.uuid, buildjobdata.jobuuid, buildjobdata.identifier, buildjobdata.name, buildjobdata.datatype, buildjobdata.timestamp, buildjobdata.storagestreamuuid, buildjobdata.useruuid, storage_streams.sha2, storage_streams.size FROM buildjobdata LEFT JOIN storage_streams ON storage_streams.uuid=storagestreamuuid WHERE jobuuid=? AND active=? ORDER BY buildjobdata.timestamp DESC";
-    auto pStatement = m_pSQLHandler->prepareStatement(sQuery);
+    auto pStatement = m_pSQLHandler->prepareReadStatement(sQuery);
     pStatement->setString(1, m_sUUID);
     pStatement->setInt(2, 1);
 
@@ -472,7 +472,7 @@ IBuildJobData* CBuildJob::RetrieveJobData(const std::string& sDataUUID)
     std::unique_ptr<CBuildJobDataIterator> buildJobIterator(new CBuildJobDataIterator());
 
     std::string sQuery = "SELECT buildjobdata.uuid, buildjobdata.jobuuid, buildjobdata.identifier, buildjobdata.name, buildjobdata.datatype, buildjobdata.timestamp, buildjobdata.storagestreamuuid, buildjobdata.useruuid, storage_streams.sha2, storage_streams.size FROM buildjobdata LEFT JOIN storage_streams ON storage_streams.uuid=storagestreamuuid WHERE jobuuid=? AND buildjobdata.uuid=? AND active=?";
-    auto pStatement = m_pSQLHandler->prepareStatement(sQuery);
+    auto pStatement = m_pSQLHandler->prepareReadStatement(sQuery);
     pStatement->setString(1, m_sUUID);
     pStatement->setString(2, sNormalizedDataUUID);
     pStatement->setInt(3, 1);
@@ -491,7 +491,7 @@ IBuildJobData* CBuildJob::RetrieveJobDataByIdentifier(const std::string& sIdenti
     std::unique_ptr<CBuildJobDataIterator> buildJobIterator(new CBuildJobDataIterator());
 
     std::string sQuery = "SELECT buildjobdata.uuid, buildjobdata.jobuuid, buildjobdata.identifier, buildjobdata.name, buildjobdata.datatype, buildjobdata.timestamp, buildjobdata.storagestreamuuid, buildjobdata.useruuid, storage_streams.sha2, storage_streams.size FROM buildjobdata LEFT JOIN storage_streams ON storage_streams.uuid=storagestreamuuid WHERE jobuuid=? AND buildjobdata.identifier=? AND active=?";
-    auto pStatement = m_pSQLHandler->prepareStatement(sQuery);
+    auto pStatement = m_pSQLHandler->prepareReadStatement(sQuery);
     pStatement->setString(1, m_sUUID);
     pStatement->setString(2, sIdentifier);
     pStatement->setInt(3, 1);
@@ -508,7 +508,7 @@ bool CBuildJob::HasJobDataUUID(const std::string& sUUID)
     std::string sNormalizedDataUUID = AMCCommon::CUtils::normalizeUUIDString(sUUID);
 
     std::string sQuery = "SELECT buildjobdata.uuid FROM buildjobdata WHERE jobuuid=? AND buildjobdata.uuid=? AND active=?";
-    auto pStatement = m_pSQLHandler->prepareStatement(sQuery);
+    auto pStatement = m_pSQLHandler->prepareReadStatement(sQuery);
     pStatement->setString(1, m_sUUID);
     pStatement->setString(2, sNormalizedDataUUID);
     pStatement->setInt(3, 1);
@@ -522,7 +522,7 @@ bool CBuildJob::HasJobDataIdentifier(const std::string& sIdentifier)
         throw ELibMCDataInterfaceException(LIBMCDATA_ERROR_EMPTYJOBDATAIDENTIFIER, "empty job data identifier");
 
     std::string sQuery = "SELECT buildjobdata.uuid FROM buildjobdata WHERE jobuuid=? AND buildjobdata.identifier=? AND active=?";
-    auto pStatement = m_pSQLHandler->prepareStatement(sQuery);
+    auto pStatement = m_pSQLHandler->prepareReadStatement(sQuery);
     pStatement->setString(1, m_sUUID);
     pStatement->setString(2, sIdentifier);
     pStatement->setInt(3, 1);
@@ -444,7 +444,7 @@ IBuildJobExecutionDataIterator* CBuildJobExecution::listJobExecutionDataEx(AMCDa
 IBuildJobExecutionDataIterator* CBuildJobExecution::ListJobExecutionDataByType(const LibMCData::eCustomDataType eDataType)
 {
 	std::string sQuery = "SELECT buildjobexecutiondata.uuid, buildjobexecutiondata.executionuuid, buildjobexecutiondata.identifier, buildjobexecutiondata.name, buildjobexecutiondata.datatype, buildjobexecutiondata.timestamp, buildjobexecutiondata.storagestreamuuid, buildjobexecutiondata.useruuid, storage_streams.sha2, storage_streams.size FROM buildjobexecutiondata LEFT JOIN storage_streams ON storage_streams.uuid=storagestreamuuid WHERE executionuuid=? AND active=? AND datatype=? ORDER BY buildjobexecutiondata.timestamp DESC";
-	auto pStatement = m_pSQLHandler->prepareStatement(sQuery);
+	auto pStatement = m_pSQLHandler->prepareReadStatement(sQuery);
 	pStatement->setString(1, m_sExecutionUUID);
 	pStatement->setInt(2, 1);
 	pStatement->setString(3, CCustomDataStream::convertCustomDataTypeToString(eDataType));
@@ -455,7 +455,7 @@ IBuildJobExecutionDataIterator* CBuildJobExecution::ListJobExecutionDataByType(c
 IBuildJobExecutionDataIterator* CBuildJobExecution::ListJobExecutionData()
 {
 	std::string sQuery = "SELECT buildjobexecutiondata.uuid, buildjobexecutiondata.executionuuid, buildjobexecutiondata.identifier, buildjobexecutiondata.name, buildjobexecutiondata.datatype, buildjobexecutiondata.timestamp, buildjobexecutiondata.storagestreamuuid, buildjobexecutiondata.useruuid, storage_streams.sha2, storage_streams.size FROM buildjobexecutiondata LEFT JOIN storage_streams ON storage_streams.uuid=storagestreamuuid WHERE executionuuid=? AND active=? ORDER BY buildjobexecutiondata.timestamp DESC";
-	auto pStatement = m_pSQLHandler->prepareStatement(sQuery);
+	auto pStatement = m_pSQLHandler->prepareReadStatement(sQuery);
 	pStatement->setString(1, m_sExecutionUUID);
 	pStatement->setInt(2, 1);
 
@@ -469,7 +469,7 @@ IBuildJobExecutionData* CBuildJobExecution::RetrieveJobExecutionData(const std::
 	std::unique_ptr<CBuildJobExecutionDataIterator> buildJobIterator(new CBuildJobExecutionDataIterator());
 
 	std::string sQuery = "SELECT buildjobexecutiondata.uuid, buildjobexecutiondata.executionuuid, buildjobexecutiondata.identifier, buildjobexecutiondata.name, buildjobexecutiondata.datatype, buildjobexecutiondata.timestamp, buildjobexecutiondata.storagestreamuuid, buildjobexecutiondata.useruuid, storage_streams.sha2, storage_streams.size FROM buildjobexecutiondata LEFT JOIN storage_streams ON storage_streams.uuid=storagestreamuuid WHERE executionuuid=? AND buildjobexecutiondata.uuid=? AND active=?";
-	auto pStatement = m_pSQLHandler->prepareStatement(sQuery);
+	auto pStatement = m_pSQLHandler->prepareReadStatement(sQuery);
 	pStatement->setString(1, m_sExecutionUUID);
 	pStatement->setString(2, sNormalizedDataUUID);
 	pStatement->setInt(3, 1);
@@ -488,7 +488,7 @@ IBuildJobExecutionData* CBuildJobExecution::RetrieveJobExecutionDataByIdentifier
 	std::unique_ptr<CBuildJobExecutionDataIterator> buildJobIterator(new CBuildJobExecutionDataIterator());
 
 	std::string sQuery = "SELECT buildjobexecutiondata.uuid, buildjobexecutiondata.executionuuid, buildjobexecutiondata.identifier, buildjobexecutiondata.name, buildjobexecutiondata.datatype, buildjobexecutiondata.timestamp, buildjobexecutiondata.storagestreamuuid, buildjobexecutiondata.useruuid, storage_streams.sha2, storage_streams.size FROM buildjobexecutiondata LEFT JOIN storage_streams ON storage_streams.uuid=storagestreamuuid WHERE executionuuid=? AND buildjobexecutiondata.identifier=? AND active=?";
-	auto pStatement = m_pSQLHandler->prepareStatement(sQuery);
+	auto pStatement = m_pSQLHandler->prepareReadStatement(sQuery);
 	pStatement->setString(1, m_sExecutionUUID);
 	pStatement->setString(2, sIdentifier);
 	pStatement->setInt(3, 1);
@@ -504,7 +504,7 @@ bool CBuildJobExecution::HasJobExecutionDataUUID(const std::string& sUUID)
 	std::string sNormalizedDataUUID = AMCCommon::CUtils::normalizeUUIDString(sUUID);
 
 	std::string sQuery = "SELECT buildjobexecutiondata.uuid FROM buildjobexecutiondata WHERE executionuuid=? AND buildjobexecutiondata.uuid=? AND active=?";
-	auto pStatement = m_pSQLHandler->prepareStatement(sQuery);
+	auto pStatement = m_pSQLHandler->prepareReadStatement(sQuery);
 	pStatement->setString(1, m_sExecutionUUID);
 	pStatement->setString(2, sNormalizedDataUUID);
 	pStatement->setInt(3, 1);
@@ -518,7 +518,7 @@ bool CBuildJobExecution::HasJobExecutionDataIdentifier(const std::string& sIdent
 		throw ELibMCDataInterfaceException(LIBMCDATA_ERROR_EMPTYJOBDATAIDENTIFIER, "empty job execution data identifier");
 
 	std::string sQuery = "SELECT buildjobexecutiondata.uuid FROM buildjobexecutiondata WHERE executionuuid=? AND buildjobexecutiondata.identifier=? AND active=?";
-	auto pStatement = m_pSQLHandler->prepareStatement(sQuery);
+	auto pStatement = m_pSQLHandler->prepareReadStatement(sQuery);
 	pStatement->setString(1, m_sExecutionUUID);
 	pStatement->setString(2, sIdentifier);
 	pStatement->setInt(3, 1);
@@ -129,7 +129,7 @@ bool CBuildJobHandler::JobExists(const std::string& sJobUUID)
         return false;
 
     std::string sQuery = "SELECT uuid FROM buildjobs WHERE uuid=?";
-    auto pStatement = m_pSQLHandler->prepareStatement(sQuery);
+    auto pStatement = m_pSQLHandler->prepareReadStatement(sQuery);
     pStatement->setString(1, AMCCommon::CUtils::normalizeUUIDString (sJobUUID));
     return (pStatement->nextRow());
 }
@@ -140,7 +140,7 @@ IBuildJobIterator* CBuildJobHandler::ListJobsByStatus(const LibMCData::eBuildJob
     std::unique_ptr<CBuildJobIterator> pJobIterator(new CBuildJobIterator());
 
     std::string sQuery = "SELECT buildjobs.uuid, buildjobs.name, buildjobs.status, buildjobs.timestamp, buildjobs.storagestreamuuid, buildjobs.layercount, buildjobs.useruuid, users.login, (SELECT count(buildjobexecutions.uuid) FROM buildjobexecutions WHERE buildjobexecutions.jobuuid=buildjobs.uuid), buildjobs.thumbnailuuid, storage_streams.size FROM buildjobs LEFT JOIN users On users.uuid=buildjobs.useruuid LEFT JOIN storage_streams ON storage_streams.uuid=buildjobs.storagestreamuuid WHERE buildjobs.status=? ORDER BY buildjobs.timestamp DESC";
-    auto pStatement = m_pSQLHandler->prepareStatement(sQuery);
+    auto pStatement = m_pSQLHandler->prepareReadStatement(sQuery);
     pStatement->setString(1, CBuildJob::convertBuildJobStatusToString(eStatus));
     while (pStatement->nextRow()) {
 
@@ -176,7 +176,7 @@ IBuildJob* CBuildJobHandler::FindJobOfData(const std::string& sDataUUID)
 {
 
     std::string sQuery = "SELECT jobuuid FROM buildjobdata WHERE uuid=?";
-    auto pStatement = m_pSQLHandler->prepareStatement(sQuery);
+    auto pStatement = m_pSQLHandler->prepareReadStatement(sQuery);
     pStatement->setString(1, sDataUUID);
     if (!pStatement->nextRow())
         throw ELibMCDataInterfaceException(LIBMCDATA_ERROR_BUILDJOBDATANOTFOUND);
@@ -217,7 +217,7 @@ IBuildJobExecutionIterator* CBuildJobHandler::ListJobExecutions(const std::strin
 
     uint32_t nColumn = 1;
 
-    auto pStatement = m_pSQLHandler->prepareStatement(sQuery);
+    auto pStatement = m_pSQLHandler->prepareReadStatement(sQuery);
     pStatement->setInt(nColumn, 1); 
     nColumn++;
 
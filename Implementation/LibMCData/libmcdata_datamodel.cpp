@@ -122,7 +122,7 @@ void CDataModel::InitialiseDatabase(const std::string & sDataDirectory, const Li
     m_pStorageState->addImageContent("image/jpeg");
 
     if (dataBaseType == eDataBaseType::SqLite) {
-        m_pSQLHandler = std::make_shared<AMCData::CSQLHandler_SQLite>(sConnectionString);
+        m_pSQLHandler = std::make_shared<AMCData::CSQLHandler_SQLite>(sConnectionString, AMCData::CSQLHandler_SQLite::getConcurrentConfiguration ());
     }
     else {
         throw ELibMCDataInterfaceException(LIBMCDATA_ERROR_UNKNOWNDATABASETYPE);
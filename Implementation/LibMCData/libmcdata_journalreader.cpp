@@ -222,7 +222,7 @@ CJournalReader::CJournalReader(AMCData::PSQLHandler pSQLHandler, const std::stri
     if (pSQLHandler.get() == nullptr)
         throw ELibMCDataInterfaceException(LIBMCDATA_ERROR_INVALIDPARAM);
 
-    auto pStatement = pSQLHandler->prepareStatement("SELECT starttime, logfilename, schemaversion FROM journals WHERE uuid=?");
+    auto pStatement = pSQLHandler->prepareReadStatement("SELECT starttime, logfilename, schemaversion FROM journals WHERE uuid=?");
     pStatement->setString(1, m_sJournalUUID);
 
     if (!pStatement->nextRow ())
@@ -67,6 +67,11 @@ LibMCData_uint32 CLogSession::GetMaxLogEntryID()
 	return m_pJournal->GetMaxLogEntryID();
 }
 
+void CLogSession::Flush()
+{
+	m_pJournal->FlushLogEntries();
+}
+
 ILogEntryList* CLogSession::RetrieveLogEntriesByID(const LibMCData_uint32 nMinLogID, const LibMCData_uint32 nMaxLogID, const LibMCData::eLogLevel eMinLogLevel)
 {
 	auto pSQLHandler = m_pJournal->getSQLHandler();
@@ -76,6 +76,8 @@ public:
 
 	LibMCData_uint32 GetMaxLogEntryID() override;
 
+	void Flush() override;
+
 	ILogEntryList* RetrieveLogEntriesByID(const LibMCData_uint32 nMinLogID, const LibMCData_uint32 nMaxLogID, const LibMCData::eLogLevel eMinLogLevel) override;
 
 };
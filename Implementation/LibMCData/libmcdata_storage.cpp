@@ -102,7 +102,7 @@ bool CStorage::StreamIsReady(const std::string& sUUID)
     std::string sParsedUUID = AMCCommon::CUtils::normalizeUUIDString(sUUID);
 
     std::string sQuery = "SELECT uuid FROM storage_streams WHERE uuid=? AND status=?";
-    auto pStatement = m_pSQLHandler->prepareStatement(sQuery);
+    auto pStatement = m_pSQLHandler->prepareReadStatement(sQuery);
     pStatement->setString(1, sParsedUUID);
     pStatement->setString(2, AMCData::CStorageState::storageStreamStatusToString(AMCData::eStorageStreamStatus::sssValidated));
     return (pStatement->nextRow());
@@ -385,7 +385,7 @@ bool CStorage::StreamIsImage(const std::string& sUUID)
     std::string sParsedUUID = AMCCommon::CUtils::normalizeUUIDString(sUUID);
 
     std::string sQuery = "SELECT mimetype FROM storage_streams WHERE uuid=?";
-    auto pStatement = m_pSQLHandler->prepareStatement(sQuery);
+    auto pStatement = m_pSQLHandler->prepareReadStatement(sQuery);
     pStatement->setString(1, sParsedUUID);
     if (!pStatement->nextRow())
         throw ELibMCDataInterfaceException(LIBMCDATA_ERROR_STORAGESTREAMNOTFOUND, "storage stream not found: " + sParsedUUID);
@@ -100,7 +100,7 @@ uint32_t storageStream_SeekCallback(uint64_t nPosition, void* pUserData)
 }
 
 
-CStorageStream::CStorageStream(AMCCommon::PImportStream pImportStream, const std::string& sUUID, const std::string& sContextIdentifier, const std::string& sName, const uint64_t nSize, const std::string& sMIMEType, const std::string& sSHA2, const std::string& sTimeStamp, const std::string& sUserID)
+CStorageStream::CStorageStream(AMCCommon::PImportStream pImportStream, const std::string& sStreamPath, const std::string& sUUID, const std::string& sContextIdentifier, const std::string& sName, const uint64_t nSize, const std::string& sMIMEType, const std::string& sSHA2, const std::string& sTimeStamp, const std::string& sUserID)
 	: m_pImportStream (pImportStream),
 	m_sUUID (AMCCommon::CUtils::normalizeUUIDString(sUUID)),
 	m_sName (sName),
@@ -109,7 +109,8 @@ CStorageStream::CStorageStream(AMCCommon::PImportStream pImportStream, const std
 	m_sMIMEType (sMIMEType),
 	m_sSHA2 (sSHA2),
 	m_sTimeStamp (sTimeStamp),
-	m_sUserID (sUserID)
+	m_sUserID (sUserID),
+	m_sStreamPath (sStreamPath)
 {
 	if (pImportStream.get() == nullptr)
 		throw ELibMCDataInterfaceException(LIBMCDATA_ERROR_INVALIDPARAM);
@@ -119,9 +120,9 @@ CStorageStream::CStorageStream(AMCCommon::PImportStream pImportStream, const std
 }
 
 
-CStorageStream* CStorageStream::make(AMCCommon::PImportStream pImportStream, const std::string& sUUID, const std::string& sContextIdentifier, const std::string& sName, const uint64_t nSize, const std::string& sMIMEType, const std::string& sSHA2, const std::string& sTimeStamp, const std::string& sUserID)
+CStorageStream* CStorageStream::make(AMCCommon::PImportStream pImportStream, const std::string& sStreamPath, const std::string& sUUID, const std::string& sContextIdentifier, const std::string& sName, const uint64_t nSize, const std::string& sMIMEType, const std::string& sSHA2, const std::string& sTimeStamp, const std::string& sUserID)
 {
-	return new CStorageStream (pImportStream, sUUID, sContextIdentifier, sName, nSize, sMIMEType, sSHA2, sTimeStamp, sUserID);
+	return new CStorageStream (pImportStream, sStreamPath, sUUID, sContextIdentifier, sName, nSize, sMIMEType, sSHA2, sTimeStamp, sUserID);
 }
 
 CStorageStream* CStorageStream::makeFromDatabase(const std::string& sStreamUUID, AMCData::PSQLHandler pSQLHandler, AMCData::PStorageState pStorageState)
@@ -134,7 +135,7 @@ CStorageStream* CStorageStream::makeFromDatabase(const std::string& sStreamUUID,
 	auto sParsedStreamUUID = AMCCommon::CUtils::normalizeUUIDString(sStreamUUID);
 
 	std::string sQuery = "SELECT uuid, identifier, name, mimetype, sha2, size, userid, timestamp FROM storage_streams WHERE uuid=?";
-	auto pStatement = pSQLHandler->prepareStatement(sQuery);
+	auto pStatement = pSQLHandler->prepareReadStatement(sQuery);
 	pStatement->setString(1, sParsedStreamUUID);
 	//pStatement->setString(2, AMCData::CStorageState::storageStreamStatusToString(AMCData::sssValidated));
 	if (!pStatement->nextRow())
@@ -150,14 +151,15 @@ CStorageStream* CStorageStream::makeFromDatabase(const std::string& sStreamUUID,
 	auto sTimeStamp = pStatement->getColumnString(8);
 	pStatement = nullptr;
 
-	auto pImportStream = std::make_shared<AMCCommon::CImportStream_Native>(pStorageState->getStreamPath(sParsedStreamUUID));
+	std::string sStreamPath = pStorageState->getStreamPath(sParsedStreamUUID);
+	auto pImportStream = std::make_shared<AMCCommon::CImportStream_Native>(sStreamPath);
 	
-	return make (pImportStream, sUUID, sContextIdentifier, sName, (uint64_t)nSize, sMIMEType, sSHA2, sTimeStamp, sUserID);
+	return make (pImportStream, sStreamPath, sUUID, sContextIdentifier, sName, (uint64_t)nSize, sMIMEType, sSHA2, sTimeStamp, sUserID);
 }
 
-PStorageStream CStorageStream::makeShared(AMCCommon::PImportStream pImportStream, const std::string& sUUID, const std::string& sContextIdentifier, const std::string& sName, const uint64_t nSize, const std::string& sMIMEType, const std::string& sSHA2, const std::string& sTimeStamp, const std::string& sUserID)
+PStorageStream CStorageStream::makeShared(AMCCommon::PImportStream pImportStream, const std::string& sStreamPath, const std::string& sUUID, const std::string& sContextIdentifier, const std::string& sName, const uint64_t nSize, const std::string& sMIMEType, const std::string& sSHA2, const std::string& sTimeStamp, const std::string& sUserID)
 {
-	return std::shared_ptr<CStorageStream>(make(pImportStream, sUUID, sContextIdentifier, sName, nSize, sMIMEType, sSHA2, sTimeStamp, sUserID));
+	return std::shared_ptr<CStorageStream>(make(pImportStream, sStreamPath, sUUID, sContextIdentifier, sName, nSize, sMIMEType, sSHA2, sTimeStamp, sUserID));
 }
 
 PStorageStream CStorageStream::makeSharedFromDatabase(const std::string& sStreamUUID, AMCData::PSQLHandler pSQLHandler, AMCData::PStorageState pStorageState)
@@ -170,6 +172,7 @@ CStorageStream::~CStorageStream()
 {
 	m_sStreamCallbackData.m_nStructSign = 0;
 	m_sStreamCallbackData.m_pStream = nullptr;
+	m_pMappedFile = nullptr;
 }
 
 
@@ -210,6 +213,24 @@ LibMCData_uint64 CStorageStream::GetSize()
 
 void CStorageStream::GetContent(LibMCData_uint64 nContentBufferSize, LibMCData_uint64* pContentNeededCount, LibMCData_uint8 * pContentBuffer)
 {
+	auto pMappedFile = getMappedFile();
+	if (pMappedFile != nullptr) {
+		uint64_t nSize = pMappedFile->getSize();
+
+		if (pContentNeededCount != nullptr) {
+			*pContentNeededCount = nSize;
+		}
+
+		if (pContentBuffer != nullptr) {
+			if (nContentBufferSize < nSize)
+				throw ELibMCDataInterfaceException(LIBMCDATA_ERROR_BUFFERTOOSMALL);
+
+			pMappedFile->readRange(0, nSize, pContentBuffer);
+		}
+
+		return;
+	}
+
 	uint64_t nSize = m_pImportStream->retrieveSize();
 
 	if (pContentNeededCount != nullptr) {
@@ -234,11 +255,38 @@ void CStorageStream::GetCallbacks(LibMCData_pvoid & pTheReadCallback, LibMCData_
 	pStreamHandle = (void*)&m_sStreamCallbackData;
 }
 
+void CStorageStream::MapContent(LibMCData_pvoid& pData, LibMCData_uint64& nSize)
+{
+	auto pMappedFile = getMappedFile();
+	if (pMappedFile == nullptr)
+		throw ELibMCDataInterfaceException(LIBMCDATA_ERROR_COULDNOTMAPSTORAGESTREAM, "storage stream is not stored on disk: " + m_sUUID);
+
+	pData = (void*)pMappedFile->getData();
+	nSize = pMappedFile->getSize();
+}
+
 AMCCommon::CImportStream* CStorageStream::getImportStream()
 {
 	return m_pImportStream.get();
 }
 
+AMCCommon::CMemoryMappedFile* CStorageStream::getMappedFile()
+{
+	if (m_sStreamPath.empty())
+		return nullptr;
+
+	if (m_pMappedFile.get() == nullptr) {
+		try {
+			m_pMappedFile = std::make_shared<AMCCommon::CMemoryMappedFile>(m_sStreamPath);
+		}
+		catch (std::exception& E) {
+			throw ELibMCDataInterfaceException(LIBMCDATA_ERROR_COULDNOTMAPSTORAGESTREAM, E.what());
+		}
+	}
+
+	return m_pMappedFile.get();
+}
+
 
 void CStorageStream::EnsureSHA256IsValid()
 {
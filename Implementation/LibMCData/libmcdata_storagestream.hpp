@@ -46,6 +46,7 @@ Abstract: This is the class declaration of CStorageStream
 
 // Include custom headers here.
 #include "common_importstream.hpp"
+#include "common_memorymappedfile.hpp"
 #include "amcdata_storagestate.hpp"
 #include "amcdata_sqlhandler.hpp"
 
@@ -84,17 +85,21 @@ private:
 	std::string m_sUserID;
 	AMCCommon::PImportStream m_pImportStream;		
 
+	// Mapped lazily on first use, empty for streams that do not live on disk
+	std::string m_sStreamPath;
+	AMCCommon::PMemoryMappedFile m_pMappedFile;
+
 	sStorageStreamCallbackData m_sStreamCallbackData;
 
 protected:
 
-	CStorageStream(AMCCommon::PImportStream pImportStream, const std::string& sUUID, const std::string& sContextIdentifier, const std::string& sName, const uint64_t nSize, const std::string& sMIMEType, const std::string& sSHA2, const std::string& sTimeStamp, const std::string& sUserID);
+	CStorageStream(AMCCommon::PImportStream pImportStream, const std::string& sStreamPath, const std::string& sUUID, const std::string& sContextIdentifier, const std::string& sName, const uint64_t nSize, const std::string& sMIMEType, const std::string& sSHA2, const std::string& sTimeStamp, const std::string& sUserID);
 
 public:
 
-	static CStorageStream* make (AMCCommon::PImportStream pImportStream, const std::string& sUUID, const std::string& sContextIdentifier, const std::string& sName, const uint64_t nSize, const std::string& sMIMEType, const std::string& sSHA2, const std::string& sTimeStamp, const std::string& sUserID);
+	static CStorageStream* make (AMCCommon::PImportStream pImportStream, const std::string& sStreamPath, const std::string& sUUID, const std::string& sContextIdentifier, const std::string& sName, const uint64_t nSize, const std::string& sMIMEType, const std::string& sSHA2, const std::string& sTimeStamp, const std::string& sUserID);
 	static CStorageStream* makeFromDatabase (const std::string& sStreamUUID, AMCData::PSQLHandler pSQLHandler, AMCData::PStorageState pStorageState);
-	static PStorageStream makeShared(AMCCommon::PImportStream pImportStream, const std::string& sUUID, const std::string& sContextIdentifier, const std::string& sName, const uint64_t nSize, const std::string& sMIMEType, const std::string& sSHA2, const std::string& sTimeStamp, const std::string& sUserID);
+	static PStorageStream makeShared(AMCCommon::PImportStream pImportStream, const std::string& sStreamPath, const std::string& sUUID, const std::string& sContextIdentifier, const std::string& sName, const uint64_t nSize, const std::string& sMIMEType, const std::string& sSHA2, const std::string& sTimeStamp, const std::string& sUserID);
 	static PStorageStream makeSharedFromDatabase(const std::string& sStreamUUID, AMCData::PSQLHandler pSQLHandler, AMCData::PStorageState pStorageState);
 
 	~CStorageStream();
@@ -117,8 +122,12 @@ public:
 
 	void GetCallbacks(LibMCData_pvoid & pTheReadCallback, LibMCData_pvoid & pTheSeekCallback, LibMCData_pvoid & pStreamHandle) override;
 
+	void MapContent(LibMCData_pvoid & pData, LibMCData_uint64 & nSize) override;
+
 	AMCCommon::CImportStream * getImportStream ();
 
+	AMCCommon::CMemoryMappedFile * getMappedFile ();
+
 	void EnsureSHA256IsValid() override;
 
 };
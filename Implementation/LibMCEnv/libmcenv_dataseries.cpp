@@ -164,8 +164,9 @@ void CDataSeries::SampleJournalVariable(IJournalVariable* pJournalVariable, cons
 	if (nNumberOfSamples < 2)
 		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDNUMBEROFSAMPLES);
 
-	auto pJournalVariableImpl = dynamic_cast<CJournalVariable_Current*> (pJournalVariable);
-	if (pJournalVariableImpl == nullptr)
+	auto pCurrentVariable = dynamic_cast<CJournalVariable_Current*> (pJournalVariable);
+	auto pHistoricVariable = dynamic_cast<CJournalVariable_Historic*> (pJournalVariable);
+	if ((pCurrentVariable == nullptr) && (pHistoricVariable == nullptr))
 		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
 
 	if (nEndTimeStamp < nStartTimeStamp)
@@ -174,21 +175,25 @@ void CDataSeries::SampleJournalVariable(IJournalVariable* pJournalVariable, cons
 	uint64_t nDeltaTime = nEndTimeStamp - nStartTimeStamp;
 
 	if (nDeltaTime > 0) {
-		//auto pSampling = pJournalVariableImpl->ComputeUniformAverageSamples(nStartTimeStamp, nEndTimeStamp, nNumberOfSamples, dMovingAverageDelta, true);
-		entries.resize(nNumberOfSamples);
+		std::vector<AMC::sJournalTimeStreamDoubleEntry> timeStream;
+		timeStream.resize(nNumberOfSamples);
 
 		for (uint32_t nIndex = 0; nIndex < nNumberOfSamples; nIndex++) {
+			timeStream.at(nIndex).m_nTimeStampInMicroSeconds = nStartTimeStamp + (nIndex * nDeltaTime + (nDeltaTime / 2)) / nNumberOfSamples;
+			timeStream.at(nIndex).m_dValue = 0.0;
+		}
 
-			double dValue = 0.0;
-
-			uint64_t nTimeStampInMicroSeconds = nStartTimeStamp + (nIndex * nDeltaTime + (nDeltaTime / 2)) / nNumberOfSamples;
-
-			dValue = pJournalVariable->ComputeDoubleSample (nTimeStampInMicroSeconds);
+		// Samples all time stamps in one pass instead of locating the chunk for every sample
+		if (pCurrentVariable != nullptr)
+			pCurrentVariable->sampleTimeStream(timeStream);
+		else
+			pHistoricVariable->sampleTimeStream(timeStream);
 
+		entries.resize(nNumberOfSamples);
+		for (uint32_t nIndex = 0; nIndex < nNumberOfSamples; nIndex++) {
 			auto& entry = entries.at(nIndex);
-
-			entry.m_nTimeStampInMicroSeconds = nTimeStampInMicroSeconds;
-			entry.m_dValue = dValue;
+			entry.m_nTimeStampInMicroSeconds = timeStream.at(nIndex).m_nTimeStampInMicroSeconds;
+			entry.m_dValue = timeStream.at(nIndex).m_dValue;
 		}
 
 	}
@@ -42,6 +42,7 @@ Abstract: This is a stub class definition of CImageData
 #include "Libraries/LodePNG/lodepng.h"
 
 #include "common_jpeg.hpp"
+#include "common_pixelconversion.hpp"
 
 #include <cmath>
 
@@ -826,6 +827,8 @@ size_t CImageData::getBytesPerPixel()
 	switch (m_PixelFormat) {
 	case eImagePixelFormat::GreyScale8bit:
 		return 1;
+	case eImagePixelFormat::RGB16bit:
+		return 2;
 	case eImagePixelFormat::RGB24bit: 
 		return 3;
 	case eImagePixelFormat::RGBA32bit: 
@@ -1072,42 +1075,7 @@ void CImageData::convertFromYUY2_GreyScale8bit(const uint8_t* pSource)
 	if (m_PixelData == nullptr)
 		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDIMAGEBUFFER);
 
-	uint8_t* pTarget = m_PixelData->data();
-
-	uint64_t byteIndex = 0;
-	uint64_t byteCount = (uint64_t)m_nPixelCountX * (uint64_t)m_nPixelCountY * 2;
-	for (uint64_t byteIndex = 0; byteIndex < byteCount; byteIndex += 4) {
-
-		// Read the YUY2 data (2 pixels per 4 bytes)
-		uint8_t Y1 = pSource[byteIndex];
-		uint8_t U = pSource[byteIndex + 1];
-		uint8_t Y2 = pSource[byteIndex + 2];
-		uint8_t V = pSource[byteIndex + 3];
-
-		// Convert YUV to RGB for two pixels
-		for (int j = 0; j < 2; j++) {
-			uint8_t Y = (j == 0) ? Y1 : Y2;
-
-			// YUV to RGB conversion formulas
-			int C = Y - 16;
-			int D = U - 128;
-			int E = V - 128;
-
-			int R = (298 * C + 409 * E + 128) >> 8;
-			int G = (298 * C - 100 * D - 208 * E + 128) >> 8;
-			int B = (298 * C + 516 * D + 128) >> 8;
-
-			// Clamp RGB values to [0, 255]
-			R = std::min(255, std::max(0, R));
-			G = std::min(255, std::max(0, G));
-			B = std::min(255, std::max(0, B));
-
-			// Average computation
-			int nAverage = (R + G + B) / 3;
-
-			*pTarget = (uint8_t)nAverage; pTarget++;
-		}
-	}
+	AMCCommon::CPixelConversion::convertYUY2ToGreyScale8(pSource, m_PixelData->data(), (size_t)m_nPixelCountX * (size_t)m_nPixelCountY);
 }
 
 void CImageData::convertFromYUY2_RGB16bit(const uint8_t* pSource)
@@ -1117,39 +1085,7 @@ void CImageData::convertFromYUY2_RGB16bit(const uint8_t* pSource)
 	if (m_PixelData == nullptr)
 		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDIMAGEBUFFER);
 
-	uint16_t* pTarget = (uint16_t *) m_PixelData->data();
-
-	uint64_t byteIndex = 0;
-	uint64_t byteCount = (uint64_t)m_nPixelCountX * (uint64_t)m_nPixelCountY * 2;
-	for (uint64_t byteIndex = 0; byteIndex < byteCount; byteIndex += 4) {
-
-		// Read the YUY2 data (2 pixels per 4 bytes)
-		uint8_t Y1 = pSource[byteIndex];
-		uint8_t U = pSource[byteIndex + 1];
-		uint8_t Y2 = pSource[byteIndex + 2];
-		uint8_t V = pSource[byteIndex + 3];
-
-		// Convert YUV to RGB for two pixels
-		for (int j = 0; j < 2; j++) {
-			uint8_t Y = (j == 0) ? Y1 : Y2;
-
-			// YUV to RGB conversion formulas
-			int C = Y - 16;
-			int D = U - 128;
-			int E = V - 128;
-
-			int R = (298 * C + 409 * E + 128) >> 8;
-			int G = (298 * C - 100 * D - 208 * E + 128) >> 8;
-			int B = (298 * C + 516 * D + 128) >> 8;
-
-			// Clamp RGB values to [0, 255]
-			R = std::min(255, std::max(0, R));
-			G = std::min(255, std::max(0, G));
-			B = std::min(255, std::max(0, B));
-
-			*pTarget = ((B & 0xF8) << 8) | ((G & 0xFC) << 3) | (R >> 3);
-		}
-	}
+	AMCCommon::CPixelConversion::convertYUY2ToRGB16(pSource, m_PixelData->data(), (size_t)m_nPixelCountX * (size_t)m_nPixelCountY);
 }
 
 void CImageData::convertFromYUY2_RGB24bit(const uint8_t* pSource)
@@ -1159,41 +1095,7 @@ void CImageData::convertFromYUY2_RGB24bit(const uint8_t* pSource)
 	if (m_PixelData == nullptr)
 		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDIMAGEBUFFER);
 
-	uint8_t* pTarget = m_PixelData->data();
-
-	uint64_t byteIndex = 0;
-	uint64_t byteCount = (uint64_t) m_nPixelCountX * (uint64_t) m_nPixelCountY * 2;
-	for (uint64_t byteIndex = 0; byteIndex < byteCount; byteIndex += 4) {
-
-		// Read the YUY2 data (2 pixels per 4 bytes)
-		uint8_t Y1 = pSource[byteIndex];
-		uint8_t U = pSource[byteIndex + 1];
-		uint8_t Y2 = pSource[byteIndex + 2];
-		uint8_t V = pSource[byteIndex + 3];
-
-		// Convert YUV to RGB for two pixels
-		for (int j = 0; j < 2; j++) {
-			uint8_t Y = (j == 0) ? Y1 : Y2;
-
-			// YUV to RGB conversion formulas
-			int C = Y - 16;
-			int D = U - 128;
-			int E = V - 128;
-
-			int R = (298 * C + 409 * E + 128) >> 8;
-			int G = (298 * C - 100 * D - 208 * E + 128) >> 8;
-			int B = (298 * C + 516 * D + 128) >> 8;
-
-			// Clamp RGB values to [0, 255]
-			R = std::min(255, std::max(0, R));
-			G = std::min(255, std::max(0, G));
-			B = std::min(255, std::max(0, B));
-
-			*pTarget = (uint8_t)R; pTarget++;
-			*pTarget = (uint8_t)G; pTarget++;
-			*pTarget = (uint8_t)B; pTarget++;
-		}
-	}
+	AMCCommon::CPixelConversion::convertYUY2ToRGB24(pSource, m_PixelData->data(), (size_t)m_nPixelCountX * (size_t)m_nPixelCountY);
 }
 
 void CImageData::convertFromYUY2_RGBA32bit(const uint8_t* pSource)
@@ -1203,49 +1105,40 @@ void CImageData::convertFromYUY2_RGBA32bit(const uint8_t* pSource)
 	if (m_PixelData == nullptr)
 		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDIMAGEBUFFER);
 
-	uint8_t* pTarget = m_PixelData->data();
-
-	uint64_t byteIndex = 0;
-	uint64_t byteCount = (uint64_t)m_nPixelCountX * (uint64_t)m_nPixelCountY * 2;
-	for (uint64_t byteIndex = 0; byteIndex < byteCount; byteIndex += 4) {
-
-		// Read the YUY2 data (2 pixels per 4 bytes)
-		uint8_t Y1 = pSource[byteIndex];
-		uint8_t U = pSource[byteIndex + 1];
-		uint8_t Y2 = pSource[byteIndex + 2];
-		uint8_t V = pSource[byteIndex + 3];
+	AMCCommon::CPixelConversion::convertYUY2ToRGBA32(pSource, m_PixelData->data(), (size_t)m_nPixelCountX * (size_t)m_nPixelCountY);
+}
 
-		// Convert YUV to RGB for two pixels
-		for (int j = 0; j < 2; j++) {
-			uint8_t Y = (j == 0) ? Y1 : Y2;
 
-			// YUV to RGB conversion formulas
-			int C = Y - 16;
-			int D = U - 128;
-			int E = V - 128;
 
-			int R = (298 * C + 409 * E + 128) >> 8;
-			int G = (298 * C - 100 * D - 208 * E + 128) >> 8;
-			int B = (298 * C + 516 * D + 128) >> 8;
+std::vector <uint8_t>& CImageData::getPixelData()
+{
+	return *m_PixelData.get ();
+}
 
-			// Clamp RGB values to [0, 255]
-			R = std::min(255, std::max(0, R));
-			G = std::min(255, std::max(0, G));
-			B = std::min(255, std::max(0, B));
+const uint8_t* CImageData::convertLineToGreyScale8(const uint8_t* pSourceLine, uint32_t nCountX, std::vector<uint8_t>& greyLineBuffer)
+{
+	switch (m_PixelFormat) {
+	case eImagePixelFormat::GreyScale8bit:
+		return pSourceLine;
 
-			*pTarget = (uint8_t)R; pTarget++;
-			*pTarget = (uint8_t)G; pTarget++;
-			*pTarget = (uint8_t)B; pTarget++;
-			*pTarget = 255; pTarget++;
-		}
-	}
-}
+	case eImagePixelFormat::RGB16bit:
+		greyLineBuffer.resize(nCountX);
+		AMCCommon::CPixelConversion::convertRGB16ToGreyScale8(pSourceLine, greyLineBuffer.data(), nCountX);
+		return greyLineBuffer.data();
 
+	case eImagePixelFormat::RGB24bit:
+		greyLineBuffer.resize(nCountX);
+		AMCCommon::CPixelConversion::convertRGB24ToGreyScale8(pSourceLine, greyLineBuffer.data(), nCountX);
+		return greyLineBuffer.data();
 
+	case eImagePixelFormat::RGBA32bit:
+		greyLineBuffer.resize(nCountX);
+		AMCCommon::CPixelConversion::convertRGBA32ToGreyScale8(pSourceLine, greyLineBuffer.data(), nCountX);
+		return greyLineBuffer.data();
 
-std::vector <uint8_t>& CImageData::getPixelData()
-{
-	return *m_PixelData.get ();
+	default:
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPIXELFORMAT);
+	}
 }
 
 void CImageData::writeToRawMemoryEx_BlackWhite1bit(uint32_t nStartX, uint32_t nStartY, uint32_t nCountX, uint32_t nCountY, uint8_t* pTarget, uint32_t nYLinePixelOffset)
@@ -1267,184 +1160,189 @@ void CImageData::writeToRawMemoryEx_BlackWhite1bit(uint32_t nStartX, uint32_t nS
 	if (((uint64_t)nStartY + nCountY) > m_nPixelCountY)
 		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDYCOORDINATE);
 
-	size_t nLineAddress = (size_t)nStartX + (size_t)nStartY * (size_t)m_nPixelCountX;
-	size_t nLineBitPosition = 0;
-
-	switch (m_PixelFormat) {
-	case eImagePixelFormat::GreyScale8bit: {
-		for (uint32_t nRow = 0; nRow < nCountY; nRow++) {
-
-			size_t nPixelSourceAddress = nLineAddress;
-			uint8_t* pPixelTargetPtr = &pTarget[nLineBitPosition / 8];
-			size_t nPixelTargetBitPosition = nLineBitPosition % 8;
-
-			for (uint32_t nColumn = 0; nColumn < nCountX; nColumn++) {
-				uint8_t nGrayValue = m_PixelData->at(nPixelSourceAddress);
-				nPixelSourceAddress++;
-
-				uint32_t nPixelTargetMod = nPixelTargetBitPosition % 8;
-				nPixelTargetBitPosition++;
-
-				uint8_t nBlackWhiteMask = 0;
-				if (nGrayValue >= 128)
-					nBlackWhiteMask = 1 << (7 - nPixelTargetMod);
-
-				if (nPixelTargetMod == 0) {
-					*pPixelTargetPtr = nBlackWhiteMask;
-
-				}
-				else {
-					*pPixelTargetPtr |= nBlackWhiteMask;
-				}
-
-				if (nPixelTargetMod == 7)
-					pPixelTargetPtr++;
+	size_t nBytesPerPixel = getBytesPerPixel();
+	size_t nSourceLineSize = (size_t)m_nPixelCountX * nBytesPerPixel;
+	const uint8_t* pSourceLine = m_PixelData->data() + ((size_t)nStartX + (size_t)nStartY * (size_t)m_nPixelCountX) * nBytesPerPixel;
 
-			}
-
-			nLineBitPosition += nYLinePixelOffset;
-			nLineAddress += m_nPixelCountX;
-		}
+	std::vector<uint8_t> greyLineBuffer;
+	size_t nLineBitPosition = 0;
 
+	for (uint32_t nRow = 0; nRow < nCountY; nRow++) {
+		const uint8_t* pGreyLine = convertLineToGreyScale8(pSourceLine, nCountX, greyLineBuffer);
+		AMCCommon::CPixelConversion::packGreyScale8ToBlackWhite1bit(pGreyLine, &pTarget[nLineBitPosition / 8], nLineBitPosition % 8, nCountX);
 
-		break;
+		nLineBitPosition += nYLinePixelOffset;
+		pSourceLine += nSourceLineSize;
 	}
+}
 
+void CImageData::writeToRawMemoryEx_GreyScale2bit(uint32_t nStartX, uint32_t nStartY, uint32_t nCountX, uint32_t nCountY, uint8_t* pTarget, uint32_t nYLineOffset)
+{
+	if ((nCountX <= 0) || (nCountY <= 0))
+		return;
 
-	case eImagePixelFormat::RGB16bit: {
-		for (uint32_t nRow = 0; nRow < nCountY; nRow++) {
+	if (m_PixelData.get() == nullptr)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDIMAGEBUFFER);
+	if (pTarget == nullptr)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDIMAGEBUFFER);
 
-			size_t nPixelSourceAddress = nLineAddress;
-			uint8_t* pPixelTargetPtr = &pTarget[nLineBitPosition / 8];
-			size_t nPixelTargetBitPosition = nLineBitPosition % 8;
+	if (nStartX >= m_nPixelCountX)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDXCOORDINATE);
+	if (nStartY >= m_nPixelCountY)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDYCOORDINATE);
+	if (((uint64_t)nStartX + nCountX) > m_nPixelCountX)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDXCOORDINATE);
+	if (((uint64_t)nStartY + nCountY) > m_nPixelCountY)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDYCOORDINATE);
 
-			for (uint32_t nColumn = 0; nColumn < nCountX; nColumn++) {
+	size_t nBytesPerPixel = getBytesPerPixel();
+	size_t nSourceLineSize = (size_t)m_nPixelCountX * nBytesPerPixel;
+	const uint8_t* pSourceLine = m_PixelData->data() + ((size_t)nStartX + (size_t)nStartY * (size_t)m_nPixelCountX) * nBytesPerPixel;
 
-				uint32_t nLow = m_PixelData->at(nPixelSourceAddress); nPixelSourceAddress++;
-				uint32_t nHigh = m_PixelData->at(nPixelSourceAddress); nPixelSourceAddress++;
-				uint16_t nColor = nLow | (nHigh << 8);
+	std::vector<uint8_t> greyLineBuffer;
+	uint8_t* pLinePtr = pTarget;
 
-				uint32_t nRed = (nColor & 0x1f) << 3;
-				uint32_t nGreen = ((nColor >> 5) & 0x3f) << 2;
-				uint32_t nBlue = ((nColor >> 11) & 0x1f) << 3;
+	for (uint32_t nRow = 0; nRow < nCountY; nRow++) {
+		const uint8_t* pGreyLine = convertLineToGreyScale8(pSourceLine, nCountX, greyLineBuffer);
+		AMCCommon::CPixelConversion::packGreyScale8ToGreyScale2bit(pGreyLine, pLinePtr, nCountX);
 
-				uint8_t nGray = (uint8_t)((nRed + nGreen + nBlue) / 3);
+		pLinePtr += nYLineOffset;
+		pSourceLine += nSourceLineSize;
+	}
+}
 
-				uint32_t nPixelTargetMod = nPixelTargetBitPosition % 8;
-				nPixelTargetBitPosition++;
+void CImageData::writeToRawMemoryEx_GreyScale4bit(uint32_t nStartX, uint32_t nStartY, uint32_t nCountX, uint32_t nCountY, uint8_t* pTarget, uint32_t nYLineOffset)
+{
+	if ((nCountX <= 0) || (nCountY <= 0))
+		return;
 
-				uint8_t nBlackWhiteMask = 0;
-				if (nGray >= 128)
-					nBlackWhiteMask = 1 << (7 - nPixelTargetMod);
+	if (m_PixelData.get() == nullptr)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDIMAGEBUFFER);
+	if (pTarget == nullptr)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDIMAGEBUFFER);
 
-				if (nPixelTargetMod == 0) {
-					*pPixelTargetPtr = nBlackWhiteMask;
+	if (nStartX >= m_nPixelCountX)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDXCOORDINATE);
+	if (nStartY >= m_nPixelCountY)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDYCOORDINATE);
+	if (((uint64_t)nStartX + nCountX) > m_nPixelCountX)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDXCOORDINATE);
+	if (((uint64_t)nStartY + nCountY) > m_nPixelCountY)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDYCOORDINATE);
 
-				}
-				else {
-					*pPixelTargetPtr |= nBlackWhiteMask;
-				}
+	size_t nBytesPerPixel = getBytesPerPixel();
+	size_t nSourceLineSize = (size_t)m_nPixelCountX * nBytesPerPixel;
+	const uint8_t* pSourceLine = m_PixelData->data() + ((size_t)nStartX + (size_t)nStartY * (size_t)m_nPixelCountX) * nBytesPerPixel;
 
-				if (nPixelTargetMod == 7)
-					pPixelTargetPtr++;
-			}
+	std::vector<uint8_t> greyLineBuffer;
+	uint8_t* pLinePtr = pTarget;
 
-			nLineBitPosition += nYLinePixelOffset;
-			nLineAddress += (size_t)m_nPixelCountX * 2;
-		}
+	for (uint32_t nRow = 0; nRow < nCountY; nRow++) {
+		const uint8_t* pGreyLine = convertLineToGreyScale8(pSourceLine, nCountX, greyLineBuffer);
+		AMCCommon::CPixelConversion::packGreyScale8ToGreyScale4bit(pGreyLine, pLinePtr, nCountX);
 
-		break;
+		pLinePtr += nYLineOffset;
+		pSourceLine += nSourceLineSize;
 	}
+}
 
-	case eImagePixelFormat::RGB24bit: {
-		for (uint32_t nRow = 0; nRow < nCountY; nRow++) {
-
-			size_t nPixelSourceAddress = nLineAddress;
-			uint8_t* pPixelTargetPtr = &pTarget[nLineBitPosition / 8];
-			size_t nPixelTargetBitPosition = nLineBitPosition % 8;
-
-			for (uint32_t nColumn = 0; nColumn < nCountX; nColumn++) {
-
-				uint32_t nRed = m_PixelData->at(nPixelSourceAddress); nPixelSourceAddress++;
-				uint32_t nGreen = m_PixelData->at(nPixelSourceAddress); nPixelSourceAddress++;
-				uint32_t nBlue = m_PixelData->at(nPixelSourceAddress); nPixelSourceAddress++;
-
-				uint8_t nGray = (uint8_t)((nRed + nGreen + nBlue) / 3);
-
-				uint32_t nPixelTargetMod = nPixelTargetBitPosition % 8;
-				nPixelTargetBitPosition++;
+void CImageData::writeToRawMemoryEx_GreyScale8bit(uint32_t nStartX, uint32_t nStartY, uint32_t nCountX, uint32_t nCountY, uint8_t* pTarget, uint32_t nYLineOffset)
+{
+	if ((nCountX <= 0) || (nCountY <= 0))
+		return;
 
-				uint8_t nBlackWhiteMask = 0;
-				if (nGray >= 128)
-					nBlackWhiteMask = 1 << (7 - nPixelTargetMod);
+	if (m_PixelData.get() == nullptr)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDIMAGEBUFFER);
+	if (pTarget == nullptr)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDIMAGEBUFFER);
 
-				if (nPixelTargetMod == 0) {
-					*pPixelTargetPtr = nBlackWhiteMask;
+	if (nStartX >= m_nPixelCountX)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDXCOORDINATE);
+	if (nStartY >= m_nPixelCountY)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDYCOORDINATE);
+	if (((uint64_t)nStartX + nCountX) > m_nPixelCountX)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDXCOORDINATE);
+	if (((uint64_t)nStartY + nCountY) > m_nPixelCountY)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDYCOORDINATE);
 
-				}
-				else {
-					*pPixelTargetPtr |= nBlackWhiteMask;
-				}
+	size_t nBytesPerPixel = getBytesPerPixel();
+	size_t nSourceLineSize = (size_t)m_nPixelCountX * nBytesPerPixel;
+	const uint8_t* pSourceLine = m_PixelData->data() + ((size_t)nStartX + (size_t)nStartY * (size_t)m_nPixelCountX) * nBytesPerPixel;
+	uint8_t* pLinePtr = pTarget;
 
-				if (nPixelTargetMod == 7)
-					pPixelTargetPtr++;
-			}
+	for (uint32_t nRow = 0; nRow < nCountY; nRow++) {
 
-			nLineBitPosition += nYLinePixelOffset;
-			nLineAddress += (size_t)m_nPixelCountX * 3;
+		switch (m_PixelFormat) {
+		case eImagePixelFormat::GreyScale8bit:
+			memcpy(pLinePtr, pSourceLine, nCountX);
+			break;
+		case eImagePixelFormat::RGB16bit:
+			AMCCommon::CPixelConversion::convertRGB16ToGreyScale8(pSourceLine, pLinePtr, nCountX);
+			break;
+		case eImagePixelFormat::RGB24bit:
+			AMCCommon::CPixelConversion::convertRGB24ToGreyScale8(pSourceLine, pLinePtr, nCountX);
+			break;
+		case eImagePixelFormat::RGBA32bit:
+			AMCCommon::CPixelConversion::convertRGBA32ToGreyScale8(pSourceLine, pLinePtr, nCountX);
+			break;
+		default:
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPIXELFORMAT);
 		}
 
-		break;
+		pLinePtr += nYLineOffset;
+		pSourceLine += nSourceLineSize;
 	}
+}
 
-	case eImagePixelFormat::RGBA32bit: {
-		for (uint32_t nRow = 0; nRow < nCountY; nRow++) {
-			size_t nPixelSourceAddress = nLineAddress;
-			uint8_t* pPixelTargetPtr = &pTarget[nLineBitPosition / 8];
-			size_t nPixelTargetBitPosition = nLineBitPosition % 8;
-
-			for (uint32_t nColumn = 0; nColumn < nCountX; nColumn++) {
-
-				uint32_t nRed = m_PixelData->at(nPixelSourceAddress); nPixelSourceAddress++;
-				uint32_t nGreen = m_PixelData->at(nPixelSourceAddress); nPixelSourceAddress++;
-				uint32_t nBlue = m_PixelData->at(nPixelSourceAddress); nPixelSourceAddress++;
-				nPixelSourceAddress++; // Ignore alpha
-
-				uint8_t nGray = (uint8_t)((nRed + nGreen + nBlue) / 3);
-
-				uint32_t nPixelTargetMod = nPixelTargetBitPosition % 8;
-				nPixelTargetBitPosition++;
+void CImageData::writeToRawMemoryEx_RGB16bit(uint32_t nStartX, uint32_t nStartY, uint32_t nCountX, uint32_t nCountY, uint8_t* pTarget, uint32_t nYLineOffset)
+{
+	if ((nCountX <= 0) || (nCountY <= 0))
+		return;
 
-				uint8_t nBlackWhiteMask = 0;
-				if (nGray >= 128)
-					nBlackWhiteMask = 1 << (7 - nPixelTargetMod);
+	if (m_PixelData.get() == nullptr)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDIMAGEBUFFER);
+	if (pTarget == nullptr)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDIMAGEBUFFER);
 
-				if (nPixelTargetMod == 0) {
-					*pPixelTargetPtr = nBlackWhiteMask;
+	if (nStartX >= m_nPixelCountX)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDXCOORDINATE);
+	if (nStartY >= m_nPixelCountY)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDYCOORDINATE);
+	if (((uint64_t)nStartX + nCountX) > m_nPixelCountX)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDXCOORDINATE);
+	if (((uint64_t)nStartY + nCountY) > m_nPixelCountY)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDYCOORDINATE);
 
-				}
-				else {
-					*pPixelTargetPtr |= nBlackWhiteMask;
-				}
+	size_t nBytesPerPixel = getBytesPerPixel();
+	size_t nSourceLineSize = (size_t)m_nPixelCountX * nBytesPerPixel;
+	const uint8_t* pSourceLine = m_PixelData->data() + ((size_t)nStartX + (size_t)nStartY * (size_t)m_nPixelCountX) * nBytesPerPixel;
+	uint8_t* pLinePtr = pTarget;
 
-				if (nPixelTargetMod == 7)
-					pPixelTargetPtr++;
-			}
+	for (uint32_t nRow = 0; nRow < nCountY; nRow++) {
 
-			nLineBitPosition += nYLinePixelOffset;
-			nLineAddress += (size_t)m_nPixelCountX * 4;
+		switch (m_PixelFormat) {
+		case eImagePixelFormat::GreyScale8bit:
+			AMCCommon::CPixelConversion::convertGreyScale8ToRGB16(pSourceLine, pLinePtr, nCountX);
+			break;
+		case eImagePixelFormat::RGB16bit:
+			memcpy(pLinePtr, pSourceLine, (size_t)nCountX * 2);
+			break;
+		case eImagePixelFormat::RGB24bit:
+			AMCCommon::CPixelConversion::convertRGB24ToRGB16(pSourceLine, pLinePtr, nCountX);
+			break;
+		case eImagePixelFormat::RGBA32bit:
+			AMCCommon::CPixelConversion::convertRGBA32ToRGB16(pSourceLine, pLinePtr, nCountX);
+			break;
+		default:
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPIXELFORMAT);
 		}
 
-		break;
-	}
-
-	default:
-		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPIXELFORMAT);
-
+		pLinePtr += nYLineOffset;
+		pSourceLine += nSourceLineSize;
 	}
 }
 
-void CImageData::writeToRawMemoryEx_GreyScale2bit(uint32_t nStartX, uint32_t nStartY, uint32_t nCountX, uint32_t nCountY, uint8_t* pTarget, uint32_t nYLineOffset)
+void CImageData::writeToRawMemoryEx_RGB24bit(uint32_t nStartX, uint32_t nStartY, uint32_t nCountX, uint32_t nCountY, uint8_t* pTarget, uint32_t nYLineOffset)
 {
 	if ((nCountX <= 0) || (nCountY <= 0))
 		return;
@@ -1463,855 +1361,81 @@ void CImageData::writeToRawMemoryEx_GreyScale2bit(uint32_t nStartX, uint32_t nSt
 	if (((uint64_t)nStartY + nCountY) > m_nPixelCountY)
 		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDYCOORDINATE);
 
-	size_t nLineAddress = (size_t)nStartX + (size_t)nStartY * (size_t)m_nPixelCountX;
+	size_t nBytesPerPixel = getBytesPerPixel();
+	size_t nSourceLineSize = (size_t)m_nPixelCountX * nBytesPerPixel;
+	const uint8_t* pSourceLine = m_PixelData->data() + ((size_t)nStartX + (size_t)nStartY * (size_t)m_nPixelCountX) * nBytesPerPixel;
 	uint8_t* pLinePtr = pTarget;
 
-	switch (m_PixelFormat) {
-	case eImagePixelFormat::GreyScale8bit: {
-		for (uint32_t nRow = 0; nRow < nCountY; nRow++) {
-
-			size_t nPixelAddress = nLineAddress;
-			uint8_t* pPixelPtr = pLinePtr;
-
-			for (uint32_t nColumn = 0; nColumn < nCountX; nColumn++) {
-				uint8_t nGrayValue = m_PixelData->at(nPixelAddress);
-				nPixelAddress++;
+	for (uint32_t nRow = 0; nRow < nCountY; nRow++) {
 
-				uint8_t nGrayValue2bit = nGrayValue / 64;
-
-				uint32_t nColumnMod = nColumn % 4;
-				if (nColumnMod == 0) {
-					*pPixelPtr = nGrayValue2bit;
-
-				}
-				else {
-					*pPixelPtr |= nGrayValue2bit << (nColumnMod * 2);
-				}
-
-				if (nColumnMod == 3)
-					pPixelPtr++;
-
-			}
-
-			pLinePtr += nYLineOffset;
-			nLineAddress += m_nPixelCountX;
+		switch (m_PixelFormat) {
+		case eImagePixelFormat::GreyScale8bit:
+			AMCCommon::CPixelConversion::convertGreyScale8ToRGB24(pSourceLine, pLinePtr, nCountX);
+			break;
+		case eImagePixelFormat::RGB16bit:
+			AMCCommon::CPixelConversion::convertRGB16ToRGB24(pSourceLine, pLinePtr, nCountX);
+			break;
+		case eImagePixelFormat::RGB24bit:
+			memcpy(pLinePtr, pSourceLine, (size_t)nCountX * 3);
+			break;
+		case eImagePixelFormat::RGBA32bit:
+			AMCCommon::CPixelConversion::convertRGBA32ToRGB24(pSourceLine, pLinePtr, nCountX);
+			break;
+		default:
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPIXELFORMAT);
 		}
 
-
-		break;
+		pLinePtr += nYLineOffset;
+		pSourceLine += nSourceLineSize;
 	}
+}
 
+void CImageData::writeToRawMemoryEx_RGBA32bit(uint32_t nStartX, uint32_t nStartY, uint32_t nCountX, uint32_t nCountY, uint8_t* pTarget, uint32_t nYLineOffset)
+{
+	if ((nCountX <= 0) || (nCountY <= 0))
+		return;
 
-	case eImagePixelFormat::RGB16bit: {
-		for (uint32_t nRow = 0; nRow < nCountY; nRow++) {
-
-			size_t nPixelAddress = nLineAddress;
-			uint8_t* pPixelPtr = pLinePtr;
-
-			for (uint32_t nColumn = 0; nColumn < nCountX; nColumn++) {
-
-				uint32_t nLow = m_PixelData->at(nPixelAddress); nPixelAddress++;
-				uint32_t nHigh = m_PixelData->at(nPixelAddress); nPixelAddress++;
-				uint16_t nColor = nLow | (nHigh << 8);
-
-				uint32_t nRed = (nColor & 0x1f) << 3;
-				uint32_t nGreen = ((nColor >> 5) & 0x3f) << 2;
-				uint32_t nBlue = ((nColor >> 11) & 0x1f) << 3;
-
-				uint8_t nGray = (uint8_t)((nRed + nGreen + nBlue) / 3);
-
-				uint8_t nGrayValue2bit = nGray / 64;
+	if (m_PixelData.get() == nullptr)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDIMAGEBUFFER);
+	if (pTarget == nullptr)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDIMAGEBUFFER);
 
-				uint32_t nColumnMod = nColumn % 4;
-				if (nColumnMod == 0) {
-					*pPixelPtr = nGrayValue2bit;
+	if (nStartX >= m_nPixelCountX)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDXCOORDINATE);
+	if (nStartY >= m_nPixelCountY)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDYCOORDINATE);
+	if (((uint64_t)nStartX + nCountX) > m_nPixelCountX)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDXCOORDINATE);
+	if (((uint64_t)nStartY + nCountY) > m_nPixelCountY)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDYCOORDINATE);
 
-				}
-				else {
-					*pPixelPtr |= nGrayValue2bit << (nColumnMod * 2);
-				}
+	size_t nBytesPerPixel = getBytesPerPixel();
+	size_t nSourceLineSize = (size_t)m_nPixelCountX * nBytesPerPixel;
+	const uint8_t* pSourceLine = m_PixelData->data() + ((size_t)nStartX + (size_t)nStartY * (size_t)m_nPixelCountX) * nBytesPerPixel;
+	uint8_t* pLinePtr = pTarget;
 
-				if (nColumnMod == 3)
-					pPixelPtr++;
-			}
+	for (uint32_t nRow = 0; nRow < nCountY; nRow++) {
 
-			pLinePtr += nYLineOffset;
-			nLineAddress += (size_t)m_nPixelCountX * 2;
+		switch (m_PixelFormat) {
+		case eImagePixelFormat::GreyScale8bit:
+			AMCCommon::CPixelConversion::convertGreyScale8ToRGBA32(pSourceLine, pLinePtr, nCountX);
+			break;
+		case eImagePixelFormat::RGB16bit:
+			AMCCommon::CPixelConversion::convertRGB16ToRGBA32(pSourceLine, pLinePtr, nCountX);
+			break;
+		case eImagePixelFormat::RGB24bit:
+			AMCCommon::CPixelConversion::convertRGB24ToRGBA32(pSourceLine, pLinePtr, nCountX);
+			break;
+		case eImagePixelFormat::RGBA32bit:
+			memcpy(pLinePtr, pSourceLine, (size_t)nCountX * 4);
+			break;
+		default:
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPIXELFORMAT);
 		}
 
-		break;
+		pLinePtr += nYLineOffset;
+		pSourceLine += nSourceLineSize;
 	}
-
-	case eImagePixelFormat::RGB24bit: {
-		for (uint32_t nRow = 0; nRow < nCountY; nRow++) {
-
-			size_t nPixelAddress = nLineAddress;
-			uint8_t* pPixelPtr = pLinePtr;
-
-			for (uint32_t nColumn = 0; nColumn < nCountX; nColumn++) {
-
-				uint32_t nRed = m_PixelData->at(nPixelAddress); nPixelAddress++;
-				uint32_t nGreen = m_PixelData->at(nPixelAddress); nPixelAddress++;
-				uint32_t nBlue = m_PixelData->at(nPixelAddress); nPixelAddress++;
-
-				uint8_t nGray = (uint8_t)((nRed + nGreen + nBlue) / 3);
-
-				uint8_t nGrayValue2bit = nGray / 64;
-
-				uint32_t nColumnMod = nColumn % 4;
-				if (nColumnMod == 0) {
-					*pPixelPtr = nGrayValue2bit;
-
-				}
-				else {
-					*pPixelPtr |= nGrayValue2bit << (nColumnMod * 2);
-				}
-
-				if (nColumnMod == 3)
-					pPixelPtr++;
-			}
-
-			pLinePtr += nYLineOffset;
-			nLineAddress += (size_t)m_nPixelCountX * 3;
-		}
-
-		break;
-	}
-
-	case eImagePixelFormat::RGBA32bit: {
-		size_t nPixelAddress = nLineAddress;
-		uint8_t* pPixelPtr = pLinePtr;
-
-		for (uint32_t nColumn = 0; nColumn < nCountX; nColumn++) {
-
-			uint32_t nRed = m_PixelData->at(nPixelAddress); nPixelAddress++;
-			uint32_t nGreen = m_PixelData->at(nPixelAddress); nPixelAddress++;
-			uint32_t nBlue = m_PixelData->at(nPixelAddress); nPixelAddress++;
-			nPixelAddress++; // Ignore alpha
-
-			uint8_t nGray = (uint8_t)((nRed + nGreen + nBlue) / 3);
-			uint8_t nGrayValue2bit = nGray / 64;
-
-			uint32_t nColumnMod = nColumn % 4;
-			if (nColumnMod == 0) {
-				*pPixelPtr = nGrayValue2bit;
-
-			}
-			else {
-				*pPixelPtr |= nGrayValue2bit << (nColumnMod * 2);
-			}
-
-			if (nColumnMod == 3)
-				pPixelPtr++;
-		}
-
-		pLinePtr += nYLineOffset;
-		nLineAddress += (size_t)m_nPixelCountX * 4;
-
-		break;
-	}
-
-	default:
-		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPIXELFORMAT);
-
-	}
-}
-
-void CImageData::writeToRawMemoryEx_GreyScale4bit(uint32_t nStartX, uint32_t nStartY, uint32_t nCountX, uint32_t nCountY, uint8_t* pTarget, uint32_t nYLineOffset)
-{
-	if ((nCountX <= 0) || (nCountY <= 0))
-		return;
-
-	if (m_PixelData.get() == nullptr)
-		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDIMAGEBUFFER);
-	if (pTarget == nullptr)
-		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDIMAGEBUFFER);
-
-	if (nStartX >= m_nPixelCountX)
-		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDXCOORDINATE);
-	if (nStartY >= m_nPixelCountY)
-		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDYCOORDINATE);
-	if (((uint64_t)nStartX + nCountX) > m_nPixelCountX)
-		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDXCOORDINATE);
-	if (((uint64_t)nStartY + nCountY) > m_nPixelCountY)
-		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDYCOORDINATE);
-
-	size_t nLineAddress = (size_t)nStartX + (size_t)nStartY * (size_t)m_nPixelCountX;
-	uint8_t* pLinePtr = pTarget;
-
-	switch (m_PixelFormat) {
-	case eImagePixelFormat::GreyScale8bit: {
-		for (uint32_t nRow = 0; nRow < nCountY; nRow++) {
-
-			size_t nPixelAddress = nLineAddress;
-			uint8_t* pPixelPtr = pLinePtr;
-
-			for (uint32_t nColumn = 0; nColumn < nCountX; nColumn++) {
-				uint8_t nGrayValue4Bit = m_PixelData->at(nPixelAddress) / 16;
-				nPixelAddress++;
-
-				if (nColumn % 2 == 0) {
-					*pPixelPtr = nGrayValue4Bit;
-				}
-				else {
-					*pPixelPtr |= (nGrayValue4Bit << 4);
-					pPixelPtr++;
-
-				}
-			}
-
-			pLinePtr += nYLineOffset;
-			nLineAddress += m_nPixelCountX;
-		}
-
-
-		break;
-	}
-
-
-	case eImagePixelFormat::RGB16bit: {
-		for (uint32_t nRow = 0; nRow < nCountY; nRow++) {
-
-			size_t nPixelAddress = nLineAddress;
-			uint8_t* pPixelPtr = pLinePtr;
-
-			for (uint32_t nColumn = 0; nColumn < nCountX; nColumn++) {
-
-				uint32_t nLow = m_PixelData->at(nPixelAddress); nPixelAddress++;
-				uint32_t nHigh = m_PixelData->at(nPixelAddress); nPixelAddress++;
-				uint16_t nColor = nLow | (nHigh << 8);
-
-				uint32_t nRed = (nColor & 0x1f) << 3;
-				uint32_t nGreen = ((nColor >> 5) & 0x3f) << 2;
-				uint32_t nBlue = ((nColor >> 11) & 0x1f) << 3;
-
-				uint8_t nGray = (uint8_t)((nRed + nGreen + nBlue) / 3);
-
-				uint8_t nGrayValue4Bit = nGray / 16;
-				if (nColumn % 2 == 0) {
-					*pPixelPtr = nGrayValue4Bit;
-				}
-				else {
-					*pPixelPtr |= (nGrayValue4Bit << 4);
-					pPixelPtr++;
-				}
-			}
-
-			pLinePtr += nYLineOffset;
-			nLineAddress += (size_t)m_nPixelCountX * 2;
-		}
-
-		break;
-	}
-
-	case eImagePixelFormat::RGB24bit: {
-		for (uint32_t nRow = 0; nRow < nCountY; nRow++) {
-
-			size_t nPixelAddress = nLineAddress;
-			uint8_t* pPixelPtr = pLinePtr;
-
-			for (uint32_t nColumn = 0; nColumn < nCountX; nColumn++) {
-
-				uint32_t nRed = m_PixelData->at(nPixelAddress); nPixelAddress++;
-				uint32_t nGreen = m_PixelData->at(nPixelAddress); nPixelAddress++;
-				uint32_t nBlue = m_PixelData->at(nPixelAddress); nPixelAddress++;
-
-				uint8_t nGray = (uint8_t)((nRed + nGreen + nBlue) / 3);
-				uint8_t nGrayValue4Bit = nGray / 16;
-				if (nColumn % 2 == 0) {
-					*pPixelPtr = nGrayValue4Bit;
-				}
-				else {
-					*pPixelPtr |= (nGrayValue4Bit << 4);
-					pPixelPtr++;
-				}
-			}
-
-			pLinePtr += nYLineOffset;
-			nLineAddress += (size_t)m_nPixelCountX * 3;
-		}
-
-		break;
-	}
-
-	case eImagePixelFormat::RGBA32bit: {
-		size_t nPixelAddress = nLineAddress;
-		uint8_t* pPixelPtr = pLinePtr;
-
-		for (uint32_t nColumn = 0; nColumn < nCountX; nColumn++) {
-
-			uint32_t nRed = m_PixelData->at(nPixelAddress); nPixelAddress++;
-			uint32_t nGreen = m_PixelData->at(nPixelAddress); nPixelAddress++;
-			uint32_t nBlue = m_PixelData->at(nPixelAddress); nPixelAddress++;
-			nPixelAddress++; // Ignore alpha
-
-			uint8_t nGray = (uint8_t)((nRed + nGreen + nBlue) / 3);
-			uint8_t nGrayValue4Bit = nGray / 16;
-			if (nColumn % 2 == 0) {
-				*pPixelPtr = nGrayValue4Bit;
-			}
-			else {
-				*pPixelPtr |= (nGrayValue4Bit << 4);
-				pPixelPtr++;
-			}
-		}
-
-		pLinePtr += nYLineOffset;
-		nLineAddress += (size_t)m_nPixelCountX * 4;
-
-		break;
-	}
-
-	default:
-		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPIXELFORMAT);
-
-	}
-}
-
-void CImageData::writeToRawMemoryEx_GreyScale8bit(uint32_t nStartX, uint32_t nStartY, uint32_t nCountX, uint32_t nCountY, uint8_t* pTarget, uint32_t nYLineOffset)
-{
-	if ((nCountX <= 0) || (nCountY <= 0))
-		return;
-
-	if (m_PixelData.get() == nullptr)
-		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDIMAGEBUFFER);
-	if (pTarget == nullptr)
-		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDIMAGEBUFFER);
-
-	if (nStartX >= m_nPixelCountX)
-		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDXCOORDINATE);
-	if (nStartY >= m_nPixelCountY)
-		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDYCOORDINATE);
-	if (((uint64_t)nStartX + nCountX) > m_nPixelCountX)
-		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDXCOORDINATE);
-	if (((uint64_t)nStartY + nCountY) > m_nPixelCountY)
-		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDYCOORDINATE);
-
-	size_t nLineAddress = (size_t)nStartX + (size_t)nStartY * (size_t)m_nPixelCountX;
-	uint8_t* pLinePtr = pTarget;
-
-	switch (m_PixelFormat) {
-	case eImagePixelFormat::GreyScale8bit: {
-		for (uint32_t nRow = 0; nRow < nCountY; nRow++) {
-
-			size_t nPixelAddress = nLineAddress;
-			uint8_t* pPixelPtr = pLinePtr;
-
-			for (uint32_t nColumn = 0; nColumn < nCountX; nColumn++) {
-				*pPixelPtr = m_PixelData->at(nPixelAddress);
-				nPixelAddress++;
-				pPixelPtr++;
-			}
-
-			pLinePtr += nYLineOffset;
-			nLineAddress += m_nPixelCountX;
-		}
-
-		
-		break;
-	}
-
-
-	case eImagePixelFormat::RGB16bit: {
-		for (uint32_t nRow = 0; nRow < nCountY; nRow++) {
-
-			size_t nPixelAddress = nLineAddress;
-			uint8_t* pPixelPtr = pLinePtr;
-
-			for (uint32_t nColumn = 0; nColumn < nCountX; nColumn++) {
-
-				uint32_t nLow = m_PixelData->at(nPixelAddress); nPixelAddress++;
-				uint32_t nHigh = m_PixelData->at(nPixelAddress); nPixelAddress++;
-				uint16_t nColor = nLow | (nHigh << 8);
-
-				uint32_t nRed = (nColor & 0x1f) << 3;
-				uint32_t nGreen = ((nColor >> 5) & 0x3f) << 2;
-				uint32_t nBlue = ((nColor >> 11) & 0x1f) << 3;
-
-				uint8_t nGray = (uint8_t)((nRed + nGreen + nBlue) / 3);
-				*pPixelPtr = nGray;
-
-				pPixelPtr++;
-			}
-
-			pLinePtr += nYLineOffset;
-			nLineAddress += (size_t)m_nPixelCountX * 2;
-		}
-
-		break;
-	}
-
-	case eImagePixelFormat::RGB24bit: {
-		for (uint32_t nRow = 0; nRow < nCountY; nRow++) {
-
-			size_t nPixelAddress = nLineAddress;
-			uint8_t* pPixelPtr = pLinePtr;
-
-			for (uint32_t nColumn = 0; nColumn < nCountX; nColumn++) {
-
-				uint32_t nRed = m_PixelData->at(nPixelAddress); nPixelAddress++;
-				uint32_t nGreen = m_PixelData->at(nPixelAddress); nPixelAddress++;
-				uint32_t nBlue = m_PixelData->at(nPixelAddress); nPixelAddress++;
-
-				uint8_t nGray = (uint8_t)((nRed + nGreen + nBlue) / 3);
-				*pPixelPtr = nGray;
-
-				pPixelPtr++;
-			}
-
-			pLinePtr += nYLineOffset;
-			nLineAddress += (size_t) m_nPixelCountX * 3;
-		}
-
-		break;
-	}
-
-	case eImagePixelFormat::RGBA32bit: {
-		size_t nPixelAddress = nLineAddress;
-		uint8_t* pPixelPtr = pLinePtr;
-
-		for (uint32_t nColumn = 0; nColumn < nCountX; nColumn++) {
-
-			uint32_t nRed = m_PixelData->at(nPixelAddress); nPixelAddress++;
-			uint32_t nGreen = m_PixelData->at(nPixelAddress); nPixelAddress++;
-			uint32_t nBlue = m_PixelData->at(nPixelAddress); nPixelAddress++;
-			nPixelAddress++; // Ignore alpha
-
-			uint8_t nGray = (uint8_t)((nRed + nGreen + nBlue) / 3);
-			*pPixelPtr = nGray;
-
-			pPixelPtr++;
-		}
-
-		pLinePtr += nYLineOffset;
-		nLineAddress += (size_t)m_nPixelCountX * 4;
-
-		break;
-	}
-
-	default:
-		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPIXELFORMAT);
-
-	}
-
-
-}
-
-void CImageData::writeToRawMemoryEx_RGB16bit(uint32_t nStartX, uint32_t nStartY, uint32_t nCountX, uint32_t nCountY, uint8_t* pTarget, uint32_t nYLineOffset)
-{
-	if ((nCountX <= 0) || (nCountY <= 0))
-		return;
-
-	if (m_PixelData.get() == nullptr)
-		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDIMAGEBUFFER);
-	if (pTarget == nullptr)
-		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDIMAGEBUFFER);
-
-	if (nStartX >= m_nPixelCountX)
-		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDXCOORDINATE);
-	if (nStartY >= m_nPixelCountY)
-		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDYCOORDINATE);
-	if (((uint64_t)nStartX + nCountX) > m_nPixelCountX)
-		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDXCOORDINATE);
-	if (((uint64_t)nStartY + nCountY) > m_nPixelCountY)
-		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDYCOORDINATE);
-
-	uint8_t* pLinePtr = pTarget;
-
-	switch (m_PixelFormat) {
-	case eImagePixelFormat::GreyScale8bit: {
-		size_t nLineAddress = (size_t)nStartX + (size_t)nStartY * (size_t)m_nPixelCountX;
-
-		for (uint32_t nRow = 0; nRow < nCountY; nRow++) {
-
-			size_t nPixelAddress = nLineAddress;
-			uint16_t* pPixelPtr = (uint16_t*)pLinePtr;
-
-			for (uint32_t nColumn = 0; nColumn < nCountX; nColumn++) {
-				uint32_t nGrayValue = m_PixelData->at(nPixelAddress);
-				nPixelAddress++;
-
-				*pPixelPtr = ((nGrayValue & 0xF8) << 8) | ((nGrayValue & 0xFC) << 3) | (nGrayValue >> 3);
-
-				pPixelPtr++;
-			}
-
-			pLinePtr += nYLineOffset;
-			nLineAddress += m_nPixelCountX;
-		}
-
-
-		break;
-	}
-
-
-	case eImagePixelFormat::RGB16bit: {
-		size_t nLineAddress = ((size_t)nStartX + (size_t)nStartY * (size_t)m_nPixelCountX) * 2;
-
-		for (uint32_t nRow = 0; nRow < nCountY; nRow++) {
-
-			size_t nPixelAddress = nLineAddress;
-			uint16_t* pPixelPtr = (uint16_t*)pLinePtr;
-
-			for (uint32_t nColumn = 0; nColumn < nCountX; nColumn++) {
-
-				uint32_t nLow = m_PixelData->at(nPixelAddress); nPixelAddress++;
-				uint32_t nHigh = m_PixelData->at(nPixelAddress); nPixelAddress++;
-				uint16_t nColor = nLow | (nHigh << 8);
-
-				*pPixelPtr = nColor;
-
-				pPixelPtr++;
-			}
-
-			pLinePtr += nYLineOffset;
-			nLineAddress += (size_t)m_nPixelCountX * 2;
-		}
-
-		break;
-	}
-
-	case eImagePixelFormat::RGB24bit: {
-		size_t nLineAddress = ((size_t)nStartX + (size_t)nStartY * (size_t)m_nPixelCountX) * 3;
-
-		for (uint32_t nRow = 0; nRow < nCountY; nRow++) {
-
-			size_t nPixelAddress = nLineAddress;
-			uint16_t* pPixelPtr = (uint16_t*)pLinePtr;
-
-			for (uint32_t nColumn = 0; nColumn < nCountX; nColumn++) {
-
-				uint32_t nRed = m_PixelData->at(nPixelAddress); nPixelAddress++;
-				uint32_t nGreen = m_PixelData->at(nPixelAddress); nPixelAddress++;
-				uint32_t nBlue = m_PixelData->at(nPixelAddress); nPixelAddress++;
-
-				*pPixelPtr = ((nBlue & 0xF8) << 8) | ((nGreen & 0xFC) << 3) | (nRed >> 3);
-
-				pPixelPtr++;
-			}
-
-			pLinePtr += nYLineOffset;
-			nLineAddress += (size_t)m_nPixelCountX * 3;
-		}
-
-		break;
-	}
-
-	case eImagePixelFormat::RGBA32bit: {
-		size_t nLineAddress = ((size_t)nStartX + (size_t)nStartY * (size_t)m_nPixelCountX) * 4;
-
-		for (uint32_t nRow = 0; nRow < nCountY; nRow++) {
-
-			size_t nPixelAddress = nLineAddress;
-			uint16_t* pPixelPtr = (uint16_t*)pLinePtr;
-
-			for (uint32_t nColumn = 0; nColumn < nCountX; nColumn++) {
-
-				uint32_t nRed = m_PixelData->at(nPixelAddress); nPixelAddress++;
-				uint32_t nGreen = m_PixelData->at(nPixelAddress); nPixelAddress++;
-				uint32_t nBlue = m_PixelData->at(nPixelAddress); nPixelAddress++;
-				nPixelAddress++; // alpha
-
-				*pPixelPtr = ((nBlue & 0xF8) << 8) | ((nGreen & 0xFC) << 3) | (nRed >> 3);
-
-				pPixelPtr++;
-			}
-
-			pLinePtr += nYLineOffset;
-			nLineAddress += (size_t)m_nPixelCountX * 3;
-		}
-
-		break;
-	}
-
-	default:
-		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPIXELFORMAT);
-
-	}
-
-
-}
-
-void CImageData::writeToRawMemoryEx_RGB24bit(uint32_t nStartX, uint32_t nStartY, uint32_t nCountX, uint32_t nCountY, uint8_t* pTarget, uint32_t nYLineOffset)
-{
-	if ((nCountX <= 0) || (nCountY <= 0))
-		return;
-
-	if (m_PixelData.get() == nullptr)
-		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDIMAGEBUFFER);
-	if (pTarget == nullptr)
-		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDIMAGEBUFFER);
-
-	if (nStartX >= m_nPixelCountX)
-		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDXCOORDINATE);
-	if (nStartY >= m_nPixelCountY)
-		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDYCOORDINATE);
-	if (((uint64_t)nStartX + nCountX) > m_nPixelCountX)
-		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDXCOORDINATE);
-	if (((uint64_t)nStartY + nCountY) > m_nPixelCountY)
-		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDYCOORDINATE);
-
-	uint8_t* pLinePtr = pTarget;
-
-	switch (m_PixelFormat) {
-	case eImagePixelFormat::GreyScale8bit: {
-		size_t nLineAddress = (size_t)nStartX + (size_t)nStartY * (size_t)m_nPixelCountX;
-
-		for (uint32_t nRow = 0; nRow < nCountY; nRow++) {
-
-			size_t nPixelAddress = nLineAddress;
-			uint8_t* pPixelPtr = pLinePtr;
-
-			for (uint32_t nColumn = 0; nColumn < nCountX; nColumn++) {
-				uint8_t nGrayValue = m_PixelData->at(nPixelAddress);
-				nPixelAddress++;
-				*pPixelPtr = nGrayValue;  pPixelPtr++;
-				*pPixelPtr = nGrayValue;  pPixelPtr++;
-				*pPixelPtr = nGrayValue;  pPixelPtr++;
-			}
-
-			pLinePtr += nYLineOffset;
-			nLineAddress += m_nPixelCountX;
-		}
-
-
-		break;
-	}
-
-
-	case eImagePixelFormat::RGB16bit: {
-		size_t nLineAddress = ((size_t)nStartX + (size_t)nStartY * (size_t)m_nPixelCountX) * 2;
-		for (uint32_t nRow = 0; nRow < nCountY; nRow++) {
-
-			size_t nPixelAddress = nLineAddress;
-			uint8_t* pPixelPtr = pLinePtr;
-
-			for (uint32_t nColumn = 0; nColumn < nCountX; nColumn++) {
-
-				uint32_t nLow = m_PixelData->at(nPixelAddress); nPixelAddress++;
-				uint32_t nHigh = m_PixelData->at(nPixelAddress); nPixelAddress++;
-				uint16_t nColor = nLow | (nHigh << 8);
-
-				uint32_t nRed = (nColor & 0x1f) << 3;
-				uint32_t nGreen = ((nColor >> 5) & 0x3f) << 2;
-				uint32_t nBlue = ((nColor >> 11) & 0x1f) << 3;
-
-				*pPixelPtr = nRed; pPixelPtr++;
-				*pPixelPtr = nGreen; pPixelPtr++;
-				*pPixelPtr = nBlue; pPixelPtr++;
-			}
-
-			pLinePtr += nYLineOffset;
-			nLineAddress += (size_t)m_nPixelCountX * 2;
-		}
-
-		break;
-	}
-
-	case eImagePixelFormat::RGB24bit: {
-		size_t nLineAddress = ((size_t)nStartX + (size_t)nStartY * (size_t)m_nPixelCountX) * 3;
-		for (uint32_t nRow = 0; nRow < nCountY; nRow++) {
-
-			size_t nPixelAddress = nLineAddress;
-			uint8_t* pPixelPtr = pLinePtr;
-
-			for (uint32_t nColumn = 0; nColumn < nCountX; nColumn++) {
-
-				uint32_t nRed = m_PixelData->at(nPixelAddress); nPixelAddress++;
-				uint32_t nGreen = m_PixelData->at(nPixelAddress); nPixelAddress++;
-				uint32_t nBlue = m_PixelData->at(nPixelAddress); nPixelAddress++;
-
-				*pPixelPtr = nRed; pPixelPtr++;
-				*pPixelPtr = nGreen; pPixelPtr++;
-				*pPixelPtr = nBlue; pPixelPtr++;				
-			}
-
-			pLinePtr += nYLineOffset;
-			nLineAddress += (size_t)m_nPixelCountX * 3;
-		}
-
-		break;
-	}
-
-	case eImagePixelFormat::RGBA32bit: {
-		size_t nLineAddress = ((size_t)nStartX + (size_t)nStartY * (size_t)m_nPixelCountX) * 4;
-		for (uint32_t nRow = 0; nRow < nCountY; nRow++) {
-
-			size_t nPixelAddress = nLineAddress;
-			uint8_t* pPixelPtr = pLinePtr;
-
-			for (uint32_t nColumn = 0; nColumn < nCountX; nColumn++) {
-
-				uint32_t nRed = m_PixelData->at(nPixelAddress); nPixelAddress++;
-				uint32_t nGreen = m_PixelData->at(nPixelAddress); nPixelAddress++;
-				uint32_t nBlue = m_PixelData->at(nPixelAddress); nPixelAddress++;
-				nPixelAddress++; // alpha
-
-				*pPixelPtr = nRed; pPixelPtr++;
-				*pPixelPtr = nGreen; pPixelPtr++;
-				*pPixelPtr = nBlue; pPixelPtr++;
-			}
-
-			pLinePtr += nYLineOffset;
-			nLineAddress += (size_t)m_nPixelCountX * 3;
-		}
-
-		break;
-	}
-
-	default:
-		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPIXELFORMAT);
-
-	}
-
-
-}
-
-void CImageData::writeToRawMemoryEx_RGBA32bit(uint32_t nStartX, uint32_t nStartY, uint32_t nCountX, uint32_t nCountY, uint8_t* pTarget, uint32_t nYLineOffset)
-{
-	if ((nCountX <= 0) || (nCountY <= 0))
-		return;
-
-	if (m_PixelData.get() == nullptr)
-		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDIMAGEBUFFER);
-	if (pTarget == nullptr)
-		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDIMAGEBUFFER);
-
-	if (nStartX >= m_nPixelCountX)
-		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDXCOORDINATE);
-	if (nStartY >= m_nPixelCountY)
-		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDYCOORDINATE);
-	if (((uint64_t)nStartX + nCountX) > m_nPixelCountX)
-		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDXCOORDINATE);
-	if (((uint64_t)nStartY + nCountY) > m_nPixelCountY)
-		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDYCOORDINATE);
-
-	uint8_t* pLinePtr = pTarget;
-
-	switch (m_PixelFormat) {
-	case eImagePixelFormat::GreyScale8bit: {
-		size_t nLineAddress = (size_t)nStartX + (size_t)nStartY * (size_t)m_nPixelCountX;
-
-		for (uint32_t nRow = 0; nRow < nCountY; nRow++) {
-
-			size_t nPixelAddress = nLineAddress;
-			uint8_t* pPixelPtr = pLinePtr;
-
-			for (uint32_t nColumn = 0; nColumn < nCountX; nColumn++) {
-				uint8_t nGrayValue = m_PixelData->at(nPixelAddress);
-				nPixelAddress++;
-				*pPixelPtr = nGrayValue;  pPixelPtr++;
-				*pPixelPtr = nGrayValue;  pPixelPtr++;
-				*pPixelPtr = nGrayValue;  pPixelPtr++;
-				*pPixelPtr = 255;  pPixelPtr++;
-			}
-
-			pLinePtr += nYLineOffset;
-			nLineAddress += m_nPixelCountX;
-		}
-
-
-		break;
-	}
-
-
-	case eImagePixelFormat::RGB16bit: {
-		size_t nLineAddress = ((size_t)nStartX + (size_t)nStartY * (size_t)m_nPixelCountX) * 2;
-
-		for (uint32_t nRow = 0; nRow < nCountY; nRow++) {
-
-			size_t nPixelAddress = nLineAddress;
-			uint8_t* pPixelPtr = pLinePtr;
-
-			for (uint32_t nColumn = 0; nColumn < nCountX; nColumn++) {
-
-				uint32_t nLow = m_PixelData->at(nPixelAddress); nPixelAddress++;
-				uint32_t nHigh = m_PixelData->at(nPixelAddress); nPixelAddress++;
-				uint16_t nColor = nLow | (nHigh << 8);
-
-				uint32_t nRed = (nColor & 0x1f) << 3;
-				uint32_t nGreen = ((nColor >> 5) & 0x3f) << 2;
-				uint32_t nBlue = ((nColor >> 11) & 0x1f) << 3;
-
-				*pPixelPtr = nRed; pPixelPtr++;
-				*pPixelPtr = nGreen; pPixelPtr++;
-				*pPixelPtr = nBlue; pPixelPtr++;
-				*pPixelPtr = 255;  pPixelPtr++;
-			}
-
-			pLinePtr += nYLineOffset;
-			nLineAddress += (size_t)m_nPixelCountX * 2;
-		}
-
-		break;
-	}
-
-	case eImagePixelFormat::RGB24bit: {
-		size_t nLineAddress = ((size_t)nStartX + (size_t)nStartY * (size_t)m_nPixelCountX) * 3;
-
-		for (uint32_t nRow = 0; nRow < nCountY; nRow++) {
-
-			size_t nPixelAddress = nLineAddress;
-			uint8_t* pPixelPtr = pLinePtr;
-
-			for (uint32_t nColumn = 0; nColumn < nCountX; nColumn++) {
-
-				uint32_t nRed = m_PixelData->at(nPixelAddress); nPixelAddress++;
-				uint32_t nGreen = m_PixelData->at(nPixelAddress); nPixelAddress++;
-				uint32_t nBlue = m_PixelData->at(nPixelAddress); nPixelAddress++;
-
-				*pPixelPtr = nRed; pPixelPtr++;
-				*pPixelPtr = nGreen; pPixelPtr++;
-				*pPixelPtr = nBlue; pPixelPtr++;
-				*pPixelPtr = 255;  pPixelPtr++;
-
-				pPixelPtr++;
-			}
-
-			pLinePtr += nYLineOffset;
-			nLineAddress += (size_t)m_nPixelCountX * 3;
-		}
-
-		break;
-	}
-
-	case eImagePixelFormat::RGBA32bit: {
-		size_t nLineAddress = ((size_t)nStartX + (size_t)nStartY * (size_t)m_nPixelCountX) * 4;
-
-		for (uint32_t nRow = 0; nRow < nCountY; nRow++) {
-
-			size_t nPixelAddress = nLineAddress;
-			uint8_t* pPixelPtr = pLinePtr;
-
-			for (uint32_t nColumn = 0; nColumn < nCountX; nColumn++) {
-
-				uint32_t nRed = m_PixelData->at(nPixelAddress); nPixelAddress++;
-				uint32_t nGreen = m_PixelData->at(nPixelAddress); nPixelAddress++;
-				uint32_t nBlue = m_PixelData->at(nPixelAddress); nPixelAddress++;
-				nPixelAddress++; // alpha
-
-				*pPixelPtr = nRed; pPixelPtr++;
-				*pPixelPtr = nGreen; pPixelPtr++;
-				*pPixelPtr = nBlue; pPixelPtr++;
-				*pPixelPtr = 255;  pPixelPtr++;
-
-				pPixelPtr++;
-			}
-
-			pLinePtr += nYLineOffset;
-			nLineAddress += (size_t)m_nPixelCountX * 4;
-		}
-
-		break;
-	}
-
-
-	default:
-		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPIXELFORMAT);
-
-	}
-
-
 }
 
 void CImageData::readFromRawMemoryEx_GreyScale8bit(uint32_t nStartX, uint32_t nStartY, uint32_t nCountX, uint32_t nCountY, const uint8_t* pSource, uint32_t nYLineOffset)
@@ -72,6 +72,9 @@ private:
 
 	size_t getBytesPerPixel();
 
+	// Returns the source line itself for grey scale images, otherwise converts it into the buffer
+	const uint8_t* convertLineToGreyScale8(const uint8_t* pSourceLine, uint32_t nCountX, std::vector<uint8_t>& greyLineBuffer);
+
 	
 	void writeToRawMemoryEx_BlackWhite1bit(uint32_t nStartX, uint32_t nStartY, uint32_t nCountX, uint32_t nCountY, uint8_t* pTarget, uint32_t nYLinePixelOffset);
 	void writeToRawMemoryEx_GreyScale2bit(uint32_t nStartX, uint32_t nStartY, uint32_t nCountX, uint32_t nCountY, uint8_t* pTarget, uint32_t nYLinePixelOffset);
@@ -61,6 +61,8 @@ private:
     AMC::PStateJournal m_pStateJournal;
     std::string m_sVariableName;
 
+    void computeStatistics(const LibMCEnv_uint64 nStartTimeInMicroSeconds, const LibMCEnv_uint64 nEndTimeInMicroSeconds, AMC::sStateJournalStatistics& statistics);
+
 public:
     CJournalVariable_Current(AMC::PStateJournal pStateJournal, const std::string & sVariableName);
 
@@ -72,6 +74,21 @@ public:
 
     LibMCEnv_int64 ComputeIntegerSample(const LibMCEnv_uint64 nTimeInMicroSeconds) override;
 
+    LibMCEnv_double ComputeMinimum(const LibMCEnv_uint64 nStartTimeInMicroSeconds, const LibMCEnv_uint64 nEndTimeInMicroSeconds) override;
+
+    LibMCEnv_double ComputeMaximum(const LibMCEnv_uint64 nStartTimeInMicroSeconds, const LibMCEnv_uint64 nEndTimeInMicroSeconds) override;
+
+    LibMCEnv_double ComputeAverage(const LibMCEnv_uint64 nStartTimeInMicroSeconds, const LibMCEnv_uint64 nEndTimeInMicroSeconds) override;
+
+    LibMCEnv_double ComputeIntegral(const LibMCEnv_uint64 nStartTimeInMicroSeconds, const LibMCEnv_uint64 nEndTimeInMicroSeconds) override;
+
+    IUniformJournalSampling* ComputeUniformSampling(const LibMCEnv_uint64 nStartTimeInMicroSeconds, const LibMCEnv_uint64 nEndTimeInMicroSeconds, const LibMCEnv_uint32 nNumberOfSamples) override;
+
+    void ReceiveRawTimeStream(const LibMCEnv_uint64 nStartTimeInMicroSeconds, const LibMCEnv_uint64 nEndTimeInMicroSeconds, LibMCEnv_uint64 nTimeStreamEntriesBufferSize, LibMCEnv_uint64* pTimeStreamEntriesNeededCount, LibMCEnv::sTimeStreamEntry* pTimeStreamEntriesBuffer) override;
+
+    // Fills in the values of a list of time stamps in one pass
+    void sampleTimeStream(std::vector<AMC::sJournalTimeStreamDoubleEntry>& timeStream);
+
 };
 
 } // namespace Impl
@@ -33,6 +33,7 @@ Abstract: This is a stub class definition of CJournalVariable
 
 #include "libmcenv_journalvariable_historic.hpp"
 #include "libmcenv_interfaceexception.hpp"
+#include "libmcenv_uniformjournalsampling.hpp"
 
 
 // Include custom headers here.
@@ -74,5 +75,95 @@ LibMCEnv_int64 CJournalVariable_Historic::ComputeIntegerSample(const LibMCEnv_ui
     return m_pJournalReader->computeIntegerSample(m_sVariableName, nTimeInMicroSeconds);
 }
 
+void CJournalVariable_Historic::computeStatistics(const LibMCEnv_uint64 nStartTimeInMicroSeconds, const LibMCEnv_uint64 nEndTimeInMicroSeconds, AMC::sStateJournalStatistics& statistics)
+{
+    if (nEndTimeInMicroSeconds <= nStartTimeInMicroSeconds)
+        throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDJOURNALVARIABLEINTERVAL);
+
+    AMC::sStateJournalInterval interval;
+    interval.m_nStartTimeInMicroSeconds = nStartTimeInMicroSeconds;
+    interval.m_nEndTimeInMicroSeconds = nEndTimeInMicroSeconds;
+
+    m_pJournalReader->computeStatistics(m_sVariableName, interval, statistics);
+}
+
+LibMCEnv_double CJournalVariable_Historic::ComputeMinimum(const LibMCEnv_uint64 nStartTimeInMicroSeconds, const LibMCEnv_uint64 nEndTimeInMicroSeconds)
+{
+    AMC::sStateJournalStatistics statistics;
+    computeStatistics(nStartTimeInMicroSeconds, nEndTimeInMicroSeconds, statistics);
+    return statistics.m_dMinValue;
+}
+
+LibMCEnv_double CJournalVariable_Historic::ComputeMaximum(const LibMCEnv_uint64 nStartTimeInMicroSeconds, const LibMCEnv_uint64 nEndTimeInMicroSeconds)
+{
+    AMC::sStateJournalStatistics statistics;
+    computeStatistics(nStartTimeInMicroSeconds, nEndTimeInMicroSeconds, statistics);
+    return statistics.m_dMaxValue;
+}
+
+LibMCEnv_double CJournalVariable_Historic::ComputeAverage(const LibMCEnv_uint64 nStartTimeInMicroSeconds, const LibMCEnv_uint64 nEndTimeInMicroSeconds)
+{
+    AMC::sStateJournalStatistics statistics;
+    computeStatistics(nStartTimeInMicroSeconds, nEndTimeInMicroSeconds, statistics);
+    return statistics.m_dAverageValue;
+}
+
+LibMCEnv_double CJournalVariable_Historic::ComputeIntegral(const LibMCEnv_uint64 nStartTimeInMicroSeconds, const LibMCEnv_uint64 nEndTimeInMicroSeconds)
+{
+    AMC::sStateJournalStatistics statistics;
+    computeStatistics(nStartTimeInMicroSeconds, nEndTimeInMicroSeconds, statistics);
+    return statistics.m_dIntegral;
+}
+
+IUniformJournalSampling* CJournalVariable_Historic::ComputeUniformSampling(const LibMCEnv_uint64 nStartTimeInMicroSeconds, const LibMCEnv_uint64 nEndTimeInMicroSeconds, const LibMCEnv_uint32 nNumberOfSamples)
+{
+    std::vector<LibMCEnv::sTimeStreamEntry> samples;
+    CUniformJournalSampling::createSampleTimeStamps(nStartTimeInMicroSeconds, nEndTimeInMicroSeconds, nNumberOfSamples, samples);
+
+    std::vector<AMC::sJournalTimeStreamDoubleEntry> timeStream;
+    timeStream.resize(samples.size());
+    for (size_t nIndex = 0; nIndex < samples.size(); nIndex++)
+        timeStream.at(nIndex).m_nTimeStampInMicroSeconds = samples.at(nIndex).m_TimestampInMicroSeconds;
+
+    sampleTimeStream(timeStream);
+
+    for (size_t nIndex = 0; nIndex < samples.size(); nIndex++)
+        samples.at(nIndex).m_Value = timeStream.at(nIndex).m_dValue;
+
+    return new CUniformJournalSampling(m_sVariableName, nStartTimeInMicroSeconds, nEndTimeInMicroSeconds, samples);
+}
+
+void CJournalVariable_Historic::ReceiveRawTimeStream(const LibMCEnv_uint64 nStartTimeInMicroSeconds, const LibMCEnv_uint64 nEndTimeInMicroSeconds, LibMCEnv_uint64 nTimeStreamEntriesBufferSize, LibMCEnv_uint64* pTimeStreamEntriesNeededCount, LibMCEnv::sTimeStreamEntry* pTimeStreamEntriesBuffer)
+{
+    if (nEndTimeInMicroSeconds <= nStartTimeInMicroSeconds)
+        throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDJOURNALVARIABLEINTERVAL);
+
+    AMC::sStateJournalInterval interval;
+    interval.m_nStartTimeInMicroSeconds = nStartTimeInMicroSeconds;
+    interval.m_nEndTimeInMicroSeconds = nEndTimeInMicroSeconds;
+
+    std::vector<AMC::sJournalTimeStreamDoubleEntry> timeStream;
+    m_pJournalReader->readDoubleTimeStream(m_sVariableName, interval, timeStream);
+
+    if (pTimeStreamEntriesNeededCount != nullptr)
+        *pTimeStreamEntriesNeededCount = timeStream.size();
+
+    if (pTimeStreamEntriesBuffer != nullptr) {
+        if (nTimeStreamEntriesBufferSize < timeStream.size())
+            throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_BUFFERTOOSMALL);
+
+        for (auto& entry : timeStream) {
+            pTimeStreamEntriesBuffer->m_TimestampInMicroSeconds = entry.m_nTimeStampInMicroSeconds;
+            pTimeStreamEntriesBuffer->m_Value = entry.m_dValue;
+            pTimeStreamEntriesBuffer++;
+        }
+    }
+}
+
+void CJournalVariable_Historic::sampleTimeStream(std::vector<AMC::sJournalTimeStreamDoubleEntry>& timeStream)
+{
+    m_pJournalReader->sampleDoubleTimeStream(m_sVariableName, timeStream);
+}
+
 
 
@@ -62,6 +62,8 @@ private:
     std::string m_sVariableName;
     AMC::PStateJournalReader m_pJournalReader;
 
+    void computeStatistics(const LibMCEnv_uint64 nStartTimeInMicroSeconds, const LibMCEnv_uint64 nEndTimeInMicroSeconds, AMC::sStateJournalStatistics& statistics);
+
 public:
     CJournalVariable_Historic(AMC::PStateJournalReader pJournalReader, const std::string& sVariableName);
 
@@ -73,6 +75,21 @@ public:
 
     LibMCEnv_int64 ComputeIntegerSample(const LibMCEnv_uint64 nTimeInMicroSeconds) override;
 
+    LibMCEnv_double ComputeMinimum(const LibMCEnv_uint64 nStartTimeInMicroSeconds, const LibMCEnv_uint64 nEndTimeInMicroSeconds) override;
+
+    LibMCEnv_double ComputeMaximum(const LibMCEnv_uint64 nStartTimeInMicroSeconds, const LibMCEnv_uint64 nEndTimeInMicroSeconds) override;
+
+    LibMCEnv_double ComputeAverage(const LibMCEnv_uint64 nStartTimeInMicroSeconds, const LibMCEnv_uint64 nEndTimeInMicroSeconds) override;
+
+    LibMCEnv_double ComputeIntegral(const LibMCEnv_uint64 nStartTimeInMicroSeconds, const LibMCEnv_uint64 nEndTimeInMicroSeconds) override;
+
+    IUniformJournalSampling* ComputeUniformSampling(const LibMCEnv_uint64 nStartTimeInMicroSeconds, const LibMCEnv_uint64 nEndTimeInMicroSeconds, const LibMCEnv_uint32 nNumberOfSamples) override;
+
+    void ReceiveRawTimeStream(const LibMCEnv_uint64 nStartTimeInMicroSeconds, const LibMCEnv_uint64 nEndTimeInMicroSeconds, LibMCEnv_uint64 nTimeStreamEntriesBufferSize, LibMCEnv_uint64* pTimeStreamEntriesNeededCount, LibMCEnv::sTimeStreamEntry* pTimeStreamEntriesBuffer) override;
+
+    // Fills in the values of a list of time stamps in one pass
+    void sampleTimeStream(std::vector<AMC::sJournalTimeStreamDoubleEntry>& timeStream);
+
 };
 
 } // namespace Impl
@@ -210,10 +210,11 @@ bool CSignalTrigger::WaitForHandling(const LibMCEnv_uint32 nTimeOutInMillisecond
 			return true;
 		} 
 
-		bIsTimeOut = chrono.getUTCTimeStampInMicrosecondsSince1970() > nTimeOutTimeStamp;
+		uint64_t nCurrentTimeStamp = chrono.getUTCTimeStampInMicrosecondsSince1970();
+		bIsTimeOut = nCurrentTimeStamp > nTimeOutTimeStamp;
 
 		if (!bIsTimeOut) {			
-			chrono.sleepMilliseconds(AMC_SIGNAL_DEFAULT_WAITFOR_SLEEP_MS);
+			m_pSignalHandler->waitForSignalTerminalPhase(m_sSignalUUID, nTimeOutTimeStamp - nCurrentTimeStamp);
 		}
 	} 
 
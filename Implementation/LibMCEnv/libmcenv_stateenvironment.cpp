@@ -70,6 +70,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "amc_meshhandler.hpp"
 #include "amc_alerthandler.hpp"
 #include "amc_dataserieshandler.hpp"
+#include "amc_streamhandler.hpp"
+#include "libmc_exceptiontypes.hpp"
 
 #include "common_chrono.hpp"
 #include <thread> 
@@ -148,8 +150,11 @@ bool CStateEnvironment::WaitForSignal(const std::string& sSignalName, const LibM
 			if (CheckForTermination())
 				throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_TERMINATED);
 
-			AMCCommon::CChrono chrono;
-			chrono.sleepMilliseconds(AMC_SIGNAL_DEFAULT_WAITFOR_SLEEP_MS);
+			uint64_t nWaitTime = nEndTime - nCurrentTime;
+			if (nWaitTime > AMC_SIGNAL_WAITFOR_MAXSLICE_MS * 1000ULL)
+				nWaitTime = AMC_SIGNAL_WAITFOR_MAXSLICE_MS * 1000ULL;
+
+			pSignalInstance->waitForQueuedSignal(sSignalName, nWaitTime);
 		}
 	}
 
@@ -853,6 +858,36 @@ void CStateEnvironment::ReleaseDataSeries(const std::string& sDataSeriesUUID)
 
 }
 
+std::string CStateEnvironment::RegisterJSONEventStream(const std::string& sIdentifier)
+{
+	auto pStream = m_pSystemState->getStreamHandlerInstance()->registerStream(sIdentifier, AMC::eStreamType::JSONEventStream);
+	return pStream->getUUID();
+}
+
+std::string CStateEnvironment::RegisterJPEGImageStream(const std::string& sIdentifier)
+{
+	auto pStream = m_pSystemState->getStreamHandlerInstance()->registerStream(sIdentifier, AMC::eStreamType::JPEGImageStream);
+	return pStream->getUUID();
+}
+
+void CStateEnvironment::PublishStreamEvent(const std::string& sStreamUUID, const std::string& sEventJSON)
+{
+	auto pStream = m_pSystemState->getStreamHandlerInstance()->findStream(sStreamUUID, true);
+	if (pStream->getStreamType() != AMC::eStreamType::JSONEventStream)
+		throw ELibMCCustomException(LIBMC_ERROR_STREAMTYPEMISMATCH, pStream->getIdentifier());
+
+	pStream->publish("application/json", reinterpret_cast<const uint8_t*> (sEventJSON.c_str()), sEventJSON.length());
+}
+
+void CStateEnvironment::PublishStreamImage(const std::string& sStreamUUID, const LibMCEnv_uint64 nJPEGDataBufferSize, const LibMCEnv_uint8* pJPEGDataBuffer)
+{
+	auto pStream = m_pSystemState->getStreamHandlerInstance()->findStream(sStreamUUID, true);
+	if (pStream->getStreamType() != AMC::eStreamType::JPEGImageStream)
+		throw ELibMCCustomException(LIBMC_ERROR_STREAMTYPEMISMATCH, pStream->getIdentifier());
+
+	pStream->publish("image/jpeg", pJPEGDataBuffer, (size_t)nJPEGDataBufferSize);
+}
+
 
 IAlert* CStateEnvironment::CreateAlert(const std::string& sIdentifier, const std::string& sReadableContextInformation, const bool bAutomaticLogEntry) 
 {
@@ -213,6 +213,14 @@ public:
 
 	void ReleaseDataSeries(const std::string& sDataSeriesUUID) override;
 
+	std::string RegisterJSONEventStream(const std::string& sIdentifier) override;
+
+	std::string RegisterJPEGImageStream(const std::string& sIdentifier) override;
+
+	void PublishStreamEvent(const std::string& sStreamUUID, const std::string& sEventJSON) override;
+
+	void PublishStreamImage(const std::string& sStreamUUID, const LibMCEnv_uint64 nJPEGDataBufferSize, const LibMCEnv_uint8* pJPEGDataBuffer) override;
+
 	IAlert* CreateAlert(const std::string& sIdentifier, const std::string& sReadableContextInformation, const bool bAutomaticLogEntry) override;
 
 	IAlert* FindAlert(const std::string& sUUID) override;
@@ -37,13 +37,15 @@ Abstract: This is a stub class definition of CStreamReader
 // Include custom headers here.
 #include "lib3mf/lib3mf_dynamic.hpp"
 
+#include <cstring>
+
 using namespace LibMCEnv::Impl;
 
 /*************************************************************************************************************************
  Class definition of CStreamReader 
 **************************************************************************************************************************/
 CStreamReader::CStreamReader(LibMCData::PStorage pStorage, LibMCData::PStorageStream pStorageStream)
-	: m_pStorage (pStorage), m_pStorageStream (pStorageStream), m_nSize (0), m_nReadPosition (0)
+	: m_pStorage (pStorage), m_pStorageStream (pStorageStream), m_nSize (0), m_nReadPosition (0), m_pMappedData (nullptr)
 {
 	if (pStorage.get () == nullptr)
 		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPARAM);
@@ -58,6 +60,7 @@ CStreamReader::CStreamReader(LibMCData::PStorage pStorage, LibMCData::PStorageSt
 
 CStreamReader::~CStreamReader()
 {
+	m_pMappedData = nullptr;
 	m_pStorageStream = nullptr;
 	m_pStorage = nullptr;
 }
@@ -115,37 +118,29 @@ void CStreamReader::ReadData(const LibMCEnv_uint64 nSizeToRead, LibMCEnv_uint64
 		if (nSizeToRead > nDataBufferSize)
 			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_BUFFERTOOSMALL);
 
-		void* pReadCallback = nullptr;
-		void* pSeekCallback = nullptr;
-		void* pUserData = nullptr;
+		memcpy(pDataBuffer, getMappedData() + m_nReadPosition, (size_t)nSizeToRead);
 
-		m_pStorageStream->GetCallbacks (pReadCallback, pSeekCallback, pUserData);
+		m_nReadPosition += nSizeToRead;
 
-		if (pReadCallback == nullptr)
-			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDSTREAMREADCALLBACK);
-		if (pSeekCallback == nullptr)
-			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDSTREAMSEEKCALLBACK);
-		if (pUserData == nullptr)
-			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDSTREAMCALLBACKUSERDATA);
+	}
 
-		LibMCData::StreamReadCallback readCallback = (LibMCData::StreamReadCallback)pReadCallback;
-		LibMCData::StreamSeekCallback seekCallback = (LibMCData::StreamSeekCallback)pSeekCallback;
 
-		uint32_t nSeekErrorCode = 0;
-		seekCallback(m_nReadPosition, pUserData, &nSeekErrorCode);
-		if (nSeekErrorCode)
-			throw ELibMCEnvInterfaceException (nSeekErrorCode);
+}
 
-		uint32_t nReadErrorCode = 0;
-		readCallback((void*) pDataBuffer, nSizeToRead, pUserData, &nReadErrorCode);
-		if (nReadErrorCode)
-			throw ELibMCEnvInterfaceException(nSeekErrorCode);
+const uint8_t* CStreamReader::getMappedData()
+{
+	if (m_pMappedData == nullptr) {
+		LibMCData_pvoid pData = nullptr;
+		LibMCData_uint64 nMappedSize = 0;
+		m_pStorageStream->MapContent(pData, nMappedSize);
 
-		m_nReadPosition += nSizeToRead;
+		if ((pData == nullptr) || (nMappedSize < m_nSize))
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_STREAMREADEXCEEDSSTREAMSIZE);
 
+		m_pMappedData = (const uint8_t*)pData;
 	}
 
-
+	return m_pMappedData;
 }
 
 void CStreamReader::ReadAllData(LibMCEnv_uint64 nDataBufferSize, LibMCEnv_uint64* pDataNeededCount, LibMCEnv_uint8 * pDataBuffer)
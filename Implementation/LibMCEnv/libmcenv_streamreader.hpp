@@ -68,6 +68,11 @@ private:
 	uint64_t m_nSize;
 	uint64_t m_nReadPosition;
 
+	// Read-only mapping of the stream content, owned by m_pStorageStream
+	const uint8_t* m_pMappedData;
+
+	const uint8_t* getMappedData();
+
 
 public:
 
@@ -288,6 +288,62 @@ LibMCEnv::eToolpathProfileModificationType CToolpathLayer::GetSegmentProfileType
 
 }
 
+LibMCEnv_uint32 CToolpathLayer::ResolveProfileValueHandle(const std::string& sNamespace, const std::string& sValueName)
+{
+	return m_pToolpathLayerData->resolveProfileValueHandle(sNamespace, sValueName);
+}
+
+LibMCEnv_uint32 CToolpathLayer::ResolveTypedProfileValueHandle(const LibMCEnv::eToolpathProfileValueType eValueType)
+{
+	std::string sValueName = AMC::CToolpathLayerData::getValueNameByType(eValueType);
+	return m_pToolpathLayerData->resolveProfileValueHandle("", sValueName);
+}
+
+bool CToolpathLayer::SegmentProfileHasValueByHandle(const LibMCEnv_uint32 nSegmentIndex, const LibMCEnv_uint32 nValueHandle)
+{
+	return m_pToolpathLayerData->segmentProfileHasValueByHandle(nSegmentIndex, nValueHandle);
+}
+
+std::string CToolpathLayer::GetSegmentProfileValueByHandle(const LibMCEnv_uint32 nSegmentIndex, const LibMCEnv_uint32 nValueHandle)
+{
+	return m_pToolpathLayerData->getSegmentProfileValueByHandle(nSegmentIndex, nValueHandle);
+}
+
+std::string CToolpathLayer::GetSegmentProfileValueByHandleDef(const LibMCEnv_uint32 nSegmentIndex, const LibMCEnv_uint32 nValueHandle, const std::string& sDefaultValue)
+{
+	return m_pToolpathLayerData->getSegmentProfileValueByHandleDef(nSegmentIndex, nValueHandle, sDefaultValue);
+}
+
+LibMCEnv_double CToolpathLayer::GetSegmentProfileDoubleValueByHandle(const LibMCEnv_uint32 nSegmentIndex, const LibMCEnv_uint32 nValueHandle)
+{
+	return m_pToolpathLayerData->getSegmentProfileDoubleValueByHandle(nSegmentIndex, nValueHandle);
+}
+
+LibMCEnv_double CToolpathLayer::GetSegmentProfileDoubleValueByHandleDef(const LibMCEnv_uint32 nSegmentIndex, const LibMCEnv_uint32 nValueHandle, const LibMCEnv_double dDefaultValue)
+{
+	return m_pToolpathLayerData->getSegmentProfileDoubleValueByHandleDef(nSegmentIndex, nValueHandle, dDefaultValue);
+}
+
+LibMCEnv_int64 CToolpathLayer::GetSegmentProfileIntegerValueByHandle(const LibMCEnv_uint32 nSegmentIndex, const LibMCEnv_uint32 nValueHandle)
+{
+	return m_pToolpathLayerData->getSegmentProfileIntegerValueByHandle(nSegmentIndex, nValueHandle);
+}
+
+LibMCEnv_int64 CToolpathLayer::GetSegmentProfileIntegerValueByHandleDef(const LibMCEnv_uint32 nSegmentIndex, const LibMCEnv_uint32 nValueHandle, const LibMCEnv_int64 nDefaultValue)
+{
+	return m_pToolpathLayerData->getSegmentProfileIntegerValueByHandleDef(nSegmentIndex, nValueHandle, nDefaultValue);
+}
+
+bool CToolpathLayer::GetSegmentProfileBoolValueByHandle(const LibMCEnv_uint32 nSegmentIndex, const LibMCEnv_uint32 nValueHandle)
+{
+	return m_pToolpathLayerData->getSegmentProfileBoolValueByHandle(nSegmentIndex, nValueHandle);
+}
+
+bool CToolpathLayer::GetSegmentProfileBoolValueByHandleDef(const LibMCEnv_uint32 nSegmentIndex, const LibMCEnv_uint32 nValueHandle, const bool bDefaultValue)
+{
+	return m_pToolpathLayerData->getSegmentProfileBoolValueByHandleDef(nSegmentIndex, nValueHandle, bDefaultValue);
+}
+
 
 void CToolpathLayer::GetSegmentPolylineData(const LibMCEnv_uint32 nIndex, LibMCEnv_uint64 nPointDataBufferSize, LibMCEnv_uint64* pPointDataNeededCount, LibMCEnv::sPosition2D * pPointDataBuffer)
 {
@@ -125,6 +125,28 @@ public:
 
 	LibMCEnv::eToolpathProfileModificationType GetSegmentProfileTypedModificationType(const LibMCEnv_uint32 nSegmentIndex, const LibMCEnv::eToolpathProfileValueType eValueType) override;
 
+	LibMCEnv_uint32 ResolveProfileValueHandle(const std::string& sNamespace, const std::string& sValueName) override;
+
+	LibMCEnv_uint32 ResolveTypedProfileValueHandle(const LibMCEnv::eToolpathProfileValueType eValueType) override;
+
+	bool SegmentProfileHasValueByHandle(const LibMCEnv_uint32 nSegmentIndex, const LibMCEnv_uint32 nValueHandle) override;
+
+	std::string GetSegmentProfileValueByHandle(const LibMCEnv_uint32 nSegmentIndex, const LibMCEnv_uint32 nValueHandle) override;
+
+	std::string GetSegmentProfileValueByHandleDef(const LibMCEnv_uint32 nSegmentIndex, const LibMCEnv_uint32 nValueHandle, const std::string& sDefaultValue) override;
+
+	LibMCEnv_double GetSegmentProfileDoubleValueByHandle(const LibMCEnv_uint32 nSegmentIndex, const LibMCEnv_uint32 nValueHandle) override;
+
+	LibMCEnv_double GetSegmentProfileDoubleValueByHandleDef(const LibMCEnv_uint32 nSegmentIndex, const LibMCEnv_uint32 nValueHandle, const LibMCEnv_double dDefaultValue) override;
+
+	LibMCEnv_int64 GetSegmentProfileIntegerValueByHandle(const LibMCEnv_uint32 nSegmentIndex, const LibMCEnv_uint32 nValueHandle) override;
+
+	LibMCEnv_int64 GetSegmentProfileIntegerValueByHandleDef(const LibMCEnv_uint32 nSegmentIndex, const LibMCEnv_uint32 nValueHandle, const LibMCEnv_int64 nDefaultValue) override;
+
+	bool GetSegmentProfileBoolValueByHandle(const LibMCEnv_uint32 nSegmentIndex, const LibMCEnv_uint32 nValueHandle) override;
+
+	bool GetSegmentProfileBoolValueByHandleDef(const LibMCEnv_uint32 nSegmentIndex, const LibMCEnv_uint32 nValueHandle, const bool bDefaultValue) override;
+
 	void GetSegmentPolylineData(const LibMCEnv_uint32 nIndex, LibMCEnv_uint64 nPointDataBufferSize, LibMCEnv_uint64* pPointDataNeededCount, LibMCEnv::sPosition2D * pPointDataBuffer) override;
 
 	void GetSegmentHatchData(const LibMCEnv_uint32 nIndex, LibMCEnv_uint64 nHatchDataBufferSize, LibMCEnv_uint64* pHatchDataNeededCount, LibMCEnv::sHatch2D* pHatchDataBuffer) override;
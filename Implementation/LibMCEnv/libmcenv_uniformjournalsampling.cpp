@@ -35,6 +35,7 @@ Abstract: This is a stub class definition of CUniformJournalSampling
 #include "libmcenv_interfaceexception.hpp"
 
 // Include custom headers here.
+#include <cstring>
 
 
 using namespace LibMCEnv::Impl;
@@ -43,34 +44,85 @@ using namespace LibMCEnv::Impl;
  Class definition of CUniformJournalSampling 
 **************************************************************************************************************************/
 
+CUniformJournalSampling::CUniformJournalSampling(const std::string& sVariableName, uint64_t nStartTimeStamp, uint64_t nEndTimeStamp, std::vector<LibMCEnv::sTimeStreamEntry>& samples)
+	: m_sVariableName(sVariableName), m_nStartTimeStamp(nStartTimeStamp), m_nEndTimeStamp(nEndTimeStamp)
+{
+	if (nEndTimeStamp < nStartTimeStamp)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDJOURNALVARIABLEINTERVAL);
+
+	m_Samples.swap(samples);
+}
+
+CUniformJournalSampling::~CUniformJournalSampling()
+{
+
+}
+
+void CUniformJournalSampling::createSampleTimeStamps(uint64_t nStartTimeStamp, uint64_t nEndTimeStamp, uint32_t nNumberOfSamples, std::vector<LibMCEnv::sTimeStreamEntry>& samples)
+{
+	if (nEndTimeStamp <= nStartTimeStamp)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDJOURNALVARIABLEINTERVAL);
+	if (nNumberOfSamples < 2)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDNUMBEROFSAMPLES);
+	if (nNumberOfSamples > UNIFORMJOURNALSAMPLING_MAXSAMPLECOUNT)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_SAMPLEPOINTCOUNTEXCEEDSMAXIMUM);
+
+	uint64_t nDeltaTime = nEndTimeStamp - nStartTimeStamp;
+	uint64_t nIntervalCount = (uint64_t)nNumberOfSamples - 1;
+
+	samples.resize(nNumberOfSamples);
+	for (uint32_t nIndex = 0; nIndex < nNumberOfSamples; nIndex++) {
+		auto& sample = samples.at(nIndex);
+		// Split the delta to avoid overflowing for long intervals
+		sample.m_TimestampInMicroSeconds = nStartTimeStamp + (nDeltaTime / nIntervalCount) * nIndex + ((nDeltaTime % nIntervalCount) * nIndex) / nIntervalCount;
+		sample.m_Value = 0.0;
+	}
+}
+
 std::string CUniformJournalSampling::GetVariableName()
 {
-	throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_NOTIMPLEMENTED);
+	return m_sVariableName;
 }
 
 LibMCEnv_uint32 CUniformJournalSampling::GetNumberOfSamples()
 {
-	throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_NOTIMPLEMENTED);
+	return (uint32_t)m_Samples.size();
 }
 
 LibMCEnv_uint64 CUniformJournalSampling::GetStartTimeStamp()
 {
-	throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_NOTIMPLEMENTED);
+	return m_nStartTimeStamp;
 }
 
 LibMCEnv_uint64 CUniformJournalSampling::GetEndTimeStamp()
 {
-	throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_NOTIMPLEMENTED);
+	return m_nEndTimeStamp;
 }
 
 void CUniformJournalSampling::GetSample(const LibMCEnv_uint32 nIndex, LibMCEnv_uint64 & nTimeStamp, LibMCEnv_double & dValue)
 {
-	throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_NOTIMPLEMENTED);
+	if (nIndex >= m_Samples.size())
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDJOURNALSAMPLEINDEX);
+
+	auto& sample = m_Samples.at(nIndex);
+	nTimeStamp = sample.m_TimestampInMicroSeconds;
+	dValue = sample.m_Value;
 }
 
 void CUniformJournalSampling::GetAllSamples(LibMCEnv_uint64 nSamplesBufferSize, LibMCEnv_uint64* pSamplesNeededCount, LibMCEnv::sTimeStreamEntry* pSamplesBuffer)
 {
-    throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_NOTIMPLEMENTED);
+	uint64_t nSampleCount = m_Samples.size();
+
+	if (pSamplesNeededCount != nullptr)
+		*pSamplesNeededCount = nSampleCount;
+
+	if (pSamplesBuffer != nullptr) {
+		if (nSamplesBufferSize < nSampleCount)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_BUFFERTOOSMALL);
+
+		if (nSampleCount > 0)
+			memcpy(pSamplesBuffer, m_Samples.data(), nSampleCount * sizeof(LibMCEnv::sTimeStreamEntry));
+	}
 }
 
 
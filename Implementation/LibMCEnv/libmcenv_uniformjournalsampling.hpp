@@ -45,7 +45,9 @@ Abstract: This is the class declaration of CUniformJournalSampling
 #endif
 
 // Include custom headers here.
+#include <vector>
 
+#define UNIFORMJOURNALSAMPLING_MAXSAMPLECOUNT (1024UL * 1024UL)
 
 namespace LibMCEnv {
 namespace Impl {
@@ -58,26 +60,19 @@ namespace Impl {
 class CUniformJournalSampling : public virtual IUniformJournalSampling, public virtual CBase {
 private:
 
-	/**
-	* Put private members here.
-	*/
-
-protected:
-
-	/**
-	* Put protected members here.
-	*/
+	std::string m_sVariableName;
+	uint64_t m_nStartTimeStamp;
+	uint64_t m_nEndTimeStamp;
+	std::vector<LibMCEnv::sTimeStreamEntry> m_Samples;
 
 public:
 
-	/**
-	* Put additional public members here. They will not be visible in the external API.
-	*/
+	CUniformJournalSampling(const std::string& sVariableName, uint64_t nStartTimeStamp, uint64_t nEndTimeStamp, std::vector<LibMCEnv::sTimeStreamEntry>& samples);
 
+	virtual ~CUniformJournalSampling();
 
-	/**
-	* Public member functions to implement.
-	*/
+	// Returns the equidistant time stamps of a sampling, including both interval ends
+	static void createSampleTimeStamps(uint64_t nStartTimeStamp, uint64_t nEndTimeStamp, uint32_t nNumberOfSamples, std::vector<LibMCEnv::sTimeStreamEntry>& samples);
 
 	std::string GetVariableName() override;
 
@@ -35,6 +35,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "Libraries/cpp-httplib/httplib.h"
 
 #include "amc_server.hpp"
+#include "amc_server_byterange.hpp"
 #include "common_utils.hpp"
 #include <iostream>
 
@@ -45,6 +46,9 @@ using namespace AMC;
 
 #define PEMMAXLENGTH (1024 * 1024)
 
+// Internal header, that carries the content type of a response past httplib's range handling. It is never sent.
+#define AMCSERVER_UNRANGEDCONTENTTYPEHEADER "X-AMC-Unranged-Content-Type"
+
 #ifdef _WIN32
 class CX509Certificate {
 private:
@@ -186,6 +190,107 @@ CServer::~CServer()
 
 }
 
+// Checks an If-None-Match header against a strong entity tag, using the weak comparison of RFC 9110.
+static bool entityTagMatches(const std::string& sIfNoneMatch, const std::string& sETag)
+{
+	if (sIfNoneMatch.empty() || sETag.empty())
+		return false;
+
+	size_t nStart = 0;
+	while (nStart < sIfNoneMatch.length()) {
+		size_t nEnd = sIfNoneMatch.find(',', nStart);
+		if (nEnd == std::string::npos)
+			nEnd = sIfNoneMatch.length();
+
+		std::string sCandidate = AMCCommon::CUtils::trimString(sIfNoneMatch.substr(nStart, nEnd - nStart));
+		nStart = nEnd + 1;
+
+		if (sCandidate == "*")
+			return true;
+
+		if (sCandidate.find("W/") == 0)
+			sCandidate = sCandidate.substr(2);
+
+		if (sCandidate == sETag)
+			return true;
+	}
+
+	return false;
+}
+
+// A strong entity tag identifies the representation as sent, so every content coding gets a tag of its own (RFC 7232, 2.3.3).
+static std::string getEncodedEntityTag(const std::string& sETag, const std::string& sContentEncoding)
+{
+	if (sETag.empty() || sContentEncoding.empty())
+		return sETag;
+
+	if ((sETag.length() >= 2) && (sETag.back() == '"'))
+		return sETag.substr(0, sETag.length() - 1) + "-" + sContentEncoding + "\"";
+
+	return sETag + "-" + sContentEncoding;
+}
+
+// httplib applies the ranges of a request to the content of every response it writes. Content, that must not be
+// sliced, is therefore written by a chunked content provider, which httplib passes through unchanged.
+static void setUnrangedContent(const httplib::Request& req, httplib::Response& res, const std::string& sContent, const std::string& sContentType)
+{
+	if (req.ranges.empty()) {
+		res.set_content(sContent, sContentType.c_str());
+		return;
+	}
+
+	res.body.clear();
+	res.headers.erase("Content-Type");
+	res.headers.erase("Content-Range");
+	res.headers.erase(AMCSERVER_UNRANGEDCONTENTTYPEHEADER);
+	if (req.ranges.size() > 1)
+		res.set_header(AMCSERVER_UNRANGEDCONTENTTYPEHEADER, sContentType);
+
+	auto pContent = std::make_shared<std::string>(sContent);
+	res.set_chunked_content_provider(sContentType.c_str(),
+		[pContent](size_t nOffset, httplib::DataSink& sink) -> bool {
+			if (!pContent->empty()) {
+				if (!sink.write(pContent->data(), pContent->size()))
+					return false;
+			}
+			sink.done();
+			return true;
+		});
+}
+
+// httplib announces a multipart response for every request with several ranges. The responses of this server are
+// never multipart, so the content type is restored after routing.
+static void restoreUnrangedContentType(const httplib::Request& req, httplib::Response& res)
+{
+	if (res.has_header(AMCSERVER_UNRANGEDCONTENTTYPEHEADER)) {
+		std::string sContentType = res.get_header_value(AMCSERVER_UNRANGEDCONTENTTYPEHEADER);
+		res.headers.erase(AMCSERVER_UNRANGEDCONTENTTYPEHEADER);
+		res.headers.erase("Content-Type");
+		res.set_header("Content-Type", sContentType);
+	}
+}
+
+static bool writeResultDataRange(LibMC::PAPIRequestHandler pHandler, uint64_t nOffset, uint64_t nLength, httplib::DataSink& sink)
+{
+	const uint64_t nChunkSize = 1024 * 1024;
+	std::vector<uint8_t> ChunkBuffer;
+
+	while (nLength > 0) {
+		if (!sink.is_writable())
+			return false;
+
+		uint64_t nBytesToWrite = (nLength < nChunkSize) ? nLength : nChunkSize;
+		pHandler->GetResultDataRange(nOffset, nBytesToWrite, ChunkBuffer);
+		if (!sink.write(reinterpret_cast<const char*>(ChunkBuffer.data()), ChunkBuffer.size()))
+			return false;
+
+		nOffset += nBytesToWrite;
+		nLength -= nBytesToWrite;
+	}
+
+	return true;
+}
+
 void onLogMessage(const char* pLogMessage, const char* pSubSystem, LibMCData::eLogLevel eLogLevel, const char* pTimeStamp, LibMCData_pvoid pUserData)
 {
 	if ((pLogMessage != nullptr) && (pSubSystem != nullptr) && (pTimeStamp != nullptr) && (pUserData != nullptr)) {
@@ -353,49 +458,73 @@ void CServer::executeBlocking(const std::string& sConfigurationFileName)
 										return false;
 
 									// Initial connection response
-									{
+									if ((offset == 0) && (streamType == LibMC::eStreamConnectionType::JSONEventStream)) {
 										std::string sInitial = ": connected\n\n"; // SSE comment
 										sink.os.write(sInitial.c_str(), sInitial.length());
 										sink.os.flush();
 									}
 
-									std::this_thread::sleep_for(std::chrono::milliseconds(pStreamConnection->GetIdleDelay()));
+									// Block until the producer publishes new content, instead of polling
+									auto pContent = pStreamConnection->WaitForNewContent(pStreamConnection->GetIdleDelay());
+									if (pContent.get() == nullptr) {
+										if (streamType == LibMC::eStreamConnectionType::JSONEventStream) {
+											// SSE comment, keeps proxies from closing an idle connection
+											std::string sKeepAlive = ": keepalive\n\n";
+											sink.os.write(sKeepAlive.c_str(), sKeepAlive.length());
+											sink.os.flush();
+										}
+
+										return sink.is_writable();
+									}
+
+									std::vector<uint8_t> dataBuffer;
+									pContent->GetData(dataBuffer);
+									std::string sMIMEType = pContent->GetMIMEType();
 
-									auto pContent = pStreamConnection->GetNewContent();
-									if (pContent.get() != nullptr) {
-										std::vector<uint8_t> dataBuffer;
-										pContent->GetData(dataBuffer);
-										std::string sMIMEType = pContent->GetMIMEType();
+									if (dataBuffer.size() > 0) {
 
-										if (dataBuffer.size() > 0) {
+										switch (streamType) {
+											case LibMC::eStreamConnectionType::JSONEventStream: {
+												std::string sPayload(reinterpret_cast<char*>(dataBuffer.data()), dataBuffer.size());
 
-											switch (streamType) {
-												case LibMC::eStreamConnectionType::JSONEventStream: {
-													std::string sPayload(reinterpret_cast<char*>(dataBuffer.data()), dataBuffer.size());
+												// SSE format: every payload line needs its own data field, terminated by an empty line
+												std::string sData;
+												sData.reserve(sPayload.length() + 16);
+												size_t nLineStart = 0;
+												while (nLineStart <= sPayload.length()) {
+													size_t nLineEnd = sPayload.find('\n', nLineStart);
+													if (nLineEnd == std::string::npos)
+														nLineEnd = sPayload.length();
 
-													// SSE format: event + data + double newline
-													std::string sData = "data: " + sPayload + "\n\n";
-													sink.os.write(sData.c_str(), sData.length());
-													sink.os.flush(); // Force immediate sending
+													sData += "data: ";
+													sData.append(sPayload, nLineStart, nLineEnd - nLineStart);
+													sData += "\n";
 
-													break;
+													nLineStart = nLineEnd + 1;
 												}
+												sData += "\n";
 
-												case LibMC::eStreamConnectionType::JPEGImageStream: {
-													std::string sHeader = sBoundary + "\r\n" +
-														"Content-Type: " + sMIMEType + "\r\n" +
-														"Content-Length: " + std::to_string (dataBuffer.size()) + "\r\n\r\n";
+												sink.os.write(sData.c_str(), sData.length());
+												sink.os.flush(); // Force immediate sending
 
-													sink.os.write(sHeader.c_str(), sHeader.length());
-													sink.os.write((char*)dataBuffer.data(), dataBuffer.size());
+												break;
+											}
 
-													break;
-												}
+											case LibMC::eStreamConnectionType::JPEGImageStream: {
+												std::string sHeader = "--" + sBoundary + "\r\n" +
+													"Content-Type: " + sMIMEType + "\r\n" +
+													"Content-Length: " + std::to_string (dataBuffer.size()) + "\r\n\r\n";
 
-											}									
+												sink.os.write(sHeader.c_str(), sHeader.length());
+												sink.os.write((char*)dataBuffer.data(), dataBuffer.size());
+												sink.os.write("\r\n", 2);
+												sink.os.flush();
 
+												break;
+											}
 
 										}
+
 									}
 								}
 								catch (std::exception& E) {
@@ -416,13 +545,13 @@ void CServer::executeBlocking(const std::string& sConfigurationFileName)
 				catch (std::exception& E) {
 					this->log("Internal server error: " + std::string(E.what()));
 					res.status = 500;
-					res.set_content("Internal Server Error", "text/plain");
+					setUnrangedContent(req, res, "Internal Server Error", "text/plain");
 				}
 				catch (...) {
 					this->log("Internal server error (Unknown)");
 
 					res.status = 500;
-					res.set_content("Internal Server Error", "text/plain");
+					setUnrangedContent(req, res, "Internal Server Error", "text/plain");
 				}
 
 			};
@@ -493,7 +622,24 @@ void CServer::executeBlocking(const std::string& sConfigurationFileName)
 
 					pHandler->Handle(Buffer, sContentType, nHttpCode);
 
-					pHandler->GetResultData(ResultBuffer);
+					std::string sContentEncoding = pHandler->SelectContentEncoding(req.get_header_value("Accept-Encoding"));
+
+					std::string sETag = getEncodedEntityTag(pHandler->GetETag(), sContentEncoding);
+					if (!sETag.empty()) {
+						// Clients may keep the content, but have to revalidate it on every use
+						res.set_header("ETag", sETag);
+						res.set_header("Cache-Control", "no-cache");
+						res.set_header("Vary", "Accept-Encoding");
+
+						if ((nHttpCode == 200) && entityTagMatches(req.get_header_value("If-None-Match"), sETag)) {
+							res.status = 304;
+							return;
+						}
+					}
+
+					if (!sContentEncoding.empty())
+						res.set_header("Content-Encoding", sContentEncoding);
+
 					std::string sContentDispositionName = pHandler->GetContentDispositionName();
 
 					if (!sContentDispositionName.empty()) {
@@ -513,14 +659,59 @@ void CServer::executeBlocking(const std::string& sConfigurationFileName)
 						}
 					}
 
-					if (!ResultBuffer.empty()) {
-						std::string sResult(reinterpret_cast<char*>(ResultBuffer.data()), ResultBuffer.size());
+					bool bAcceptsRanges = (nHttpCode == 200) && pHandler->AcceptsRanges();
+
+					if (bAcceptsRanges) {
+						uint64_t nResultSize = pHandler->GetResultSize();
+						res.set_header("Accept-Ranges", "bytes");
+
+						if (!req.ranges.empty()) {
+							std::vector<sServerRequestedByteRange> requestedRanges;
+							for (auto& range : req.ranges)
+								requestedRanges.push_back(std::make_pair((int64_t)range.first, (int64_t)range.second));
 
-						res.set_content(sResult, sContentType.c_str());
+							CServerByteRange byteRange(requestedRanges, nResultSize);
+							if (!byteRange.isSatisfiable()) {
+								setUnrangedContent(req, res, "", sContentType);
+								res.set_header("Content-Range", byteRange.getContentRangeHeader());
+								res.status = 416;
+								return;
+							}
+
+							// The range is served by this handler, as httplib would slice by the unresolved ranges of the request.
+							uint64_t nRangeOffset = byteRange.getOffset();
+							uint64_t nRangeLength = byteRange.getLength();
+
+							if (req.ranges.size() > 1)
+								res.set_header(AMCSERVER_UNRANGEDCONTENTTYPEHEADER, sContentType);
+							res.set_header("Content-Range", byteRange.getContentRangeHeader());
+							res.set_chunked_content_provider(sContentType.c_str(),
+								[pHandler, nRangeOffset, nRangeLength](size_t nOffset, httplib::DataSink& sink) -> bool {
+									if (!writeResultDataRange(pHandler, nRangeOffset, nRangeLength, sink))
+										return false;
+									sink.done();
+									return true;
+								});
+
+							nHttpCode = 206;
+						}
+						else if (nResultSize > 0) {
+							// Deliver the data in chunks straight from the response, instead of copying it into a string first
+							res.set_content_provider((size_t)nResultSize, sContentType.c_str(),
+								[pHandler](size_t nOffset, size_t nLength, httplib::DataSink& sink) -> bool {
+									return writeResultDataRange(pHandler, nOffset, nLength, sink);
+								});
+						}
+						else {
+							res.set_content("", sContentType.c_str());
+						}
 
 					}
 					else {
-						res.set_content("", sContentType.c_str());
+						pHandler->GetResultData(ResultBuffer);
+
+						std::string sResult(reinterpret_cast<char*>(ResultBuffer.data()), ResultBuffer.size());
+						setUnrangedContent(req, res, sResult, sContentType);
 					}
 
 					res.status = nHttpCode;
@@ -529,13 +720,13 @@ void CServer::executeBlocking(const std::string& sConfigurationFileName)
 				catch (std::exception& E) {
 					this->log("Internal server error: " + std::string(E.what()));
 					res.status = 500;
-					res.set_content("Internal Server Error", "text/plain");
+					setUnrangedContent(req, res, "Internal Server Error", "text/plain");
 				}
 				catch (...) {
 					this->log("Internal server error (Unknown)");
 
 					res.status = 500;
-					res.set_content("Internal Server Error", "text/plain");
+					setUnrangedContent(req, res, "Internal Server Error", "text/plain");
 				}
 			};
 
@@ -558,6 +749,7 @@ void CServer::executeBlocking(const std::string& sConfigurationFileName)
 					sslsvr.Post("(.*?)", requestHandler);
 					sslsvr.Put("(.*?)", requestHandler);
 					sslsvr.Options("(.*?)", requestHandler);
+					sslsvr.set_post_routing_handler(restoreUnrangedContentType);
 
 					m_bServiceHasBeenStarted = true;
 
@@ -592,6 +784,7 @@ void CServer::executeBlocking(const std::string& sConfigurationFileName)
 					svr.Post("(.*?)", requestHandler);
 					svr.Put("(.*?)", requestHandler);
 					svr.Options("(.*?)", requestHandler);
+					svr.set_post_routing_handler(restoreUnrangedContentType);
 					m_pListeningServerInstance = &svr;
 
 					m_bServiceHasBeenStarted = true;
@@ -0,0 +1,119 @@
+/*++
+
+Copyright (C) 2025 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "amc_server_byterange.hpp"
+
+using namespace AMC;
+
+
+CServerByteRange::CServerByteRange(const std::vector<sServerRequestedByteRange>& requestedRanges, uint64_t nContentLength)
+	: m_nContentLength (nContentLength), m_nOffset (0), m_nLength (0)
+{
+	uint64_t nSpanFirst = 0;
+	uint64_t nSpanLast = 0;
+
+	for (auto& range : requestedRanges) {
+		uint64_t nFirst;
+		uint64_t nLast;
+
+		if (range.first < 0) {
+			// Suffix range, i.e. the last N bytes
+			if (range.second <= 0)
+				continue;
+			if (nContentLength == 0)
+				continue;
+
+			uint64_t nSuffixLength = (uint64_t)range.second;
+			nFirst = (nSuffixLength < nContentLength) ? (nContentLength - nSuffixLength) : 0;
+			nLast = nContentLength - 1;
+		}
+		else {
+			nFirst = (uint64_t)range.first;
+			if (nFirst >= nContentLength)
+				continue;
+
+			if ((range.second >= 0) && ((uint64_t)range.second < nFirst))
+				continue;
+
+			if ((range.second < 0) || ((uint64_t)range.second >= nContentLength))
+				nLast = nContentLength - 1;
+			else
+				nLast = (uint64_t)range.second;
+		}
+
+		if (m_nLength == 0) {
+			nSpanFirst = nFirst;
+			nSpanLast = nLast;
+		}
+		else {
+			if (nFirst < nSpanFirst)
+				nSpanFirst = nFirst;
+			if (nLast > nSpanLast)
+				nSpanLast = nLast;
+		}
+
+		m_nOffset = nSpanFirst;
+		m_nLength = nSpanLast - nSpanFirst + 1;
+	}
+
+}
+
+CServerByteRange::~CServerByteRange()
+{
+
+}
+
+bool CServerByteRange::isSatisfiable()
+{
+	return (m_nLength > 0);
+}
+
+uint64_t CServerByteRange::getOffset()
+{
+	return m_nOffset;
+}
+
+uint64_t CServerByteRange::getLength()
+{
+	return m_nLength;
+}
+
+uint64_t CServerByteRange::getContentLength()
+{
+	return m_nContentLength;
+}
+
+std::string CServerByteRange::getContentRangeHeader()
+{
+	if (m_nLength == 0)
+		return "bytes */" + std::to_string(m_nContentLength);
+
+	return "bytes " + std::to_string(m_nOffset) + "-" + std::to_string(m_nOffset + m_nLength - 1) + "/" + std::to_string(m_nContentLength);
+}
@@ -0,0 +1,75 @@
+/*++
+
+Copyright (C) 2025 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef __AMCSERVER_SERVER_BYTERANGE
+#define __AMCSERVER_SERVER_BYTERANGE
+
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+
+
+namespace AMC {
+
+	// A byte range of a Range request header, with positions as parsed by httplib:
+	// A negative first position denotes a suffix range, a negative last position an open-ended range.
+	typedef std::pair<int64_t, int64_t> sServerRequestedByteRange;
+
+	// Resolves the byte ranges of a request against the content length (RFC 7233, 2.1).
+	// Unsatisfiable ranges are dropped. Overlapping or several ranges are served as the single span that encloses them,
+	// so that a response never needs to be multipart (RFC 7233, 4.1).
+	class CServerByteRange {
+		private:
+
+			uint64_t m_nContentLength;
+			uint64_t m_nOffset;
+			uint64_t m_nLength;
+
+		public:
+
+			CServerByteRange(const std::vector<sServerRequestedByteRange>& requestedRanges, uint64_t nContentLength);
+			virtual ~CServerByteRange();
+
+			bool isSatisfiable();
+
+			uint64_t getOffset();
+			uint64_t getLength();
+			uint64_t getContentLength();
+
+			// Returns the Content-Range header value of the response, i.e. "bytes */<length>" if the range is not satisfiable.
+			std::string getContentRangeHeader();
+
+	};
+
+}
+
+#endif //__AMCSERVER_SERVER_BYTERANGE
@@ -32,6 +32,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "amc_test.hpp"
 #include "common_utils.hpp"
+#include "common_importstream_native.hpp"
 #include <iostream>
 #include <chrono>
 #include <pugixml.hpp>
@@ -43,6 +44,9 @@ using namespace AMCTest;
 
 #define XMLNS_TESTDEFINITION "http://schemas.autodesk.com/amc/testdefinitions/2020/02"
 
+#define AMCTEST_BUILDUSERNAME "testrunner"
+#define AMCTEST_BUILDUSERROLE "administrator"
+
 static std::string getPlatformLibraryExtension()
 {
 #ifdef _WIN32
@@ -132,6 +136,23 @@ CTest::CTest(PTestIO pTestIO, const std::string& sPackageConfigurationXML, const
 		m_TestLibraries.push_back(std::make_shared<CTestLibrary> (sName, sDLLFileName, sResourceFileName));
 	}
 
+	auto buildNodes = amcNode.children("build");
+	for (auto buildNode : buildNodes) {
+		std::string sUUID = buildNode.attribute("uuid").as_string();
+		if (sUUID.empty())
+			throw LibMC::ELibMCException(LIBMC_ERROR_MISSINGTESTBUILDUUID, "Missing test build uuid");
+
+		std::string sName = buildNode.attribute("name").as_string();
+		if (sName.empty())
+			throw LibMC::ELibMCException(LIBMC_ERROR_MISSINGTESTBUILDNAME, "Missing test build name");
+
+		std::string sFileName = buildNode.attribute("file").as_string();
+		if (sFileName.empty())
+			throw LibMC::ELibMCException(LIBMC_ERROR_MISSINGTESTBUILDFILENAME, "Missing test build file name");
+
+		m_TestBuilds.push_back(std::make_shared<CTestBuild>(sUUID, sName, sFileName));
+	}
+
 	auto testNodes = amcNode.children("test");
 	for (auto testNode : testNodes) {
 		auto descriptionAttrib = testNode.attribute("description");
@@ -218,6 +239,8 @@ void CTest::executeBlocking()
 
 		m_pDataModel->SetLogCallback(onLogMessage, this);
 
+		storeTestBuilds();
+
 		log("Loading framework...");
 		m_pWrapper = LibMC::CWrapper::loadLibrary(sCoreLibraryPath);
 		m_pWrapper->GetVersion(nMajorFrameworkVersion, nMinorFrameworkVersion, nMicroFrameworkVersion);
@@ -279,6 +302,46 @@ void CTest::executeBlocking()
 }
 
 
+void CTest::storeTestBuilds()
+{
+	if (m_TestBuilds.empty())
+		return;
+
+	auto pLoginHandler = m_pDataModel->CreateLoginHandler();
+	if (!pLoginHandler->UserExists(AMCTEST_BUILDUSERNAME)) {
+		// The user only owns the test builds and is never logged in
+		std::string sSalt = AMCCommon::CUtils::calculateSHA256FromString(AMCCommon::CUtils::createUUID());
+		std::string sHashedPassword = AMCCommon::CUtils::calculateSHA256FromString(AMCCommon::CUtils::createUUID());
+		pLoginHandler->CreateUser(AMCTEST_BUILDUSERNAME, AMCTEST_BUILDUSERROLE, sSalt, sHashedPassword, "Owner of test builds");
+	}
+	std::string sUserUUID = pLoginHandler->GetUserUUID(AMCTEST_BUILDUSERNAME);
+
+	auto pStorage = m_pDataModel->CreateStorage();
+	auto pBuildJobHandler = m_pDataModel->CreateBuildJobHandler();
+
+	for (auto pTestBuild : m_TestBuilds) {
+		std::string sBuildUUID = pTestBuild->getUUID();
+		if (pBuildJobHandler->JobExists(sBuildUUID))
+			continue;
+
+		std::string sFileName = pTestBuild->getFileName(m_sGitHash);
+		log("Storing test build " + pTestBuild->getName() + " from " + sFileName + "...");
+
+		std::vector<uint8_t> Buffer;
+		AMCCommon::CImportStream_Native importStream(sFileName);
+		importStream.readIntoMemory(Buffer);
+		if (Buffer.empty())
+			throw LibMC::ELibMCException(LIBMC_ERROR_EMPTYTESTBUILDFILE, "Empty test build file: " + sFileName);
+
+		uint64_t nTimeStamp = (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+
+		std::string sStreamUUID = AMCCommon::CUtils::createUUID();
+		pStorage->StoreNewStream(sStreamUUID, pTestBuild->getName(), "application/3mf", Buffer, sUserUUID, nTimeStamp);
+		pBuildJobHandler->CreateJob(sBuildUUID, pTestBuild->getName(), sUserUUID, sStreamUUID, nTimeStamp);
+	}
+}
+
+
 void CTest::log(const std::string& sMessage)
 {
 	m_pTestIO->logMessageString(sMessage);
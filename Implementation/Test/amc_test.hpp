@@ -39,6 +39,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "amc_test_io.hpp"
 #include "amc_test_library.hpp"
 #include "amc_test_definition.hpp"
+#include "amc_test_build.hpp"
 
 #include "libmcdata_dynamic.hpp"
 #include "libmc_dynamic.hpp"
@@ -67,6 +68,10 @@ namespace AMCTest {
 
 			std::vector<PTestDefinition> m_TestDefinitions;
 			std::vector<PTestLibrary> m_TestLibraries;
+			std::vector<PTestBuild> m_TestBuilds;
+
+			// Stores the build nodes of the test definition as build jobs, so that plugins can load their toolpaths
+			void storeTestBuilds();
 
 	public:
 		
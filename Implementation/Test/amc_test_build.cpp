@@ -0,0 +1,77 @@
+/*++
+
+Copyright (C) 2025 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "amc_test_build.hpp"
+#include "common_utils.hpp"
+#include <regex>
+#include <vector>
+
+using namespace AMCTest;
+
+CTestBuild::CTestBuild(const std::string& sUUID, const std::string& sName, const std::string& sFileName)
+	: m_sUUID (AMCCommon::CUtils::normalizeUUIDString (sUUID)), m_sName (sName), m_sFileName (sFileName)
+{
+}
+
+CTestBuild::~CTestBuild()
+{
+
+}
+
+std::string CTestBuild::getUUID()
+{
+	return m_sUUID;
+}
+
+std::string CTestBuild::getName()
+{
+	return m_sName;
+}
+
+std::string CTestBuild::getFileName(const std::string& sGitHash)
+{
+	std::string sFileName = std::regex_replace(m_sFileName, std::regex("\\%githash%"), sGitHash);
+
+	// Toolpath files are deployed next to the libraries
+	std::vector<std::string> searchPaths = {
+		"./" + sFileName,
+		"./Output/" + sFileName,
+		"../Output/" + sFileName,
+		"build_linux64/Output/" + sFileName
+	};
+
+	for (const auto& sPath : searchPaths) {
+		if (AMCCommon::CUtils::fileOrPathExistsOnDisk(sPath))
+			return sPath;
+	}
+
+	return "./" + sFileName;
+}
@@ -34,6 +34,148 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "libmc_exceptiontypes.hpp"
 #include <sstream>
 #include <iomanip>
+#include <atomic>
+
+namespace AMC {
+
+	enum class eUIExpressionBindingType
+	{
+		ebtUnresolved = 0,
+		ebtParameter = 1,
+		ebtInstanceState = 2
+	};
+
+	// Result of resolving the dot-notation path of an expression value against a state machine data instance.
+	// Bindings are immutable, they are replaced as a whole when the parameter group changes its structure.
+	// Unresolved bindings are kept as well, as long as the reason for the failure can not change.
+	class CUIExpressionBinding {
+	private:
+		CStateMachineData* m_pStateMachineData;
+		eUIExpressionBindingType m_BindingType;
+
+		bool m_bInverted;
+		bool m_bHasAlphanumericPath;
+		bool m_bIsInvalidExpression;
+
+		std::string m_sInstanceName;
+		PParameterGroup m_pParameterGroup;
+		PParameter m_pParameter;
+		uint64_t m_nStructureVersion;
+
+	public:
+
+		CUIExpressionBinding(const std::string& sExpression, CStateMachineData* pStateMachineData)
+			: m_pStateMachineData(pStateMachineData), m_BindingType(eUIExpressionBindingType::ebtUnresolved), m_bInverted(false), m_bHasAlphanumericPath(false), m_bIsInvalidExpression(false), m_nStructureVersion(0)
+		{
+			LibMCAssertNotNull(pStateMachineData);
+
+			std::string sPath = AMCCommon::CUtils::trimString(sExpression);
+			if ((!sPath.empty()) && (sPath.at(0) == '!')) {
+				sPath = sPath.substr(1);
+				m_bInverted = true;
+			}
+
+			// Expressions that do not resolve stay unresolved, evaluation then reports the same errors as without binding.
+			std::string sParameterGroupName, sParameterName;
+			try {
+				CStateMachineData::extractParameterDetailsFromDotString(sPath, m_sInstanceName, sParameterGroupName, sParameterName, true, true);
+			}
+			catch (std::exception&) {
+				m_bIsInvalidExpression = true;
+				return;
+			}
+
+			m_bHasAlphanumericPath = AMCCommon::CUtils::stringIsValidAlphanumericNameString(m_sInstanceName) &&
+				AMCCommon::CUtils::stringIsValidAlphanumericNameString(sParameterGroupName) &&
+				AMCCommon::CUtils::stringIsValidAlphanumericNameString(sParameterName);
+
+			if (sParameterName.empty()) {
+				if (sParameterGroupName == "$state")
+					m_BindingType = eUIExpressionBindingType::ebtInstanceState;
+				else
+					m_bIsInvalidExpression = true;
+				return;
+			}
+
+			PParameterGroup pParameterGroup;
+			try {
+				auto pParameterHandler = pStateMachineData->getParameterHandler(m_sInstanceName);
+				pParameterGroup = pParameterHandler->findGroup(sParameterGroupName, true);
+			}
+			catch (std::exception&) {
+				return;
+			}
+
+			// Read the version first, so that a concurrent change always outdates the binding.
+			// A missing parameter is kept as unresolved binding of its group, until the group changes its structure.
+			m_nStructureVersion = pParameterGroup->getStructureVersion();
+			m_pParameterGroup = pParameterGroup;
+			m_pParameter = pParameterGroup->findParameter(sParameterName, false);
+			if (m_pParameter.get() != nullptr)
+				m_BindingType = eUIExpressionBindingType::ebtParameter;
+		}
+
+		bool isResolved()
+		{
+			return m_BindingType != eUIExpressionBindingType::ebtUnresolved;
+		}
+
+		bool isValidFor(CStateMachineData* pStateMachineData)
+		{
+			if (m_pStateMachineData != pStateMachineData)
+				return false;
+
+			if (m_pParameterGroup.get() != nullptr)
+				return m_pParameterGroup->getStructureVersion() == m_nStructureVersion;
+
+			return isResolved() || m_bIsInvalidExpression;
+		}
+
+		bool hasStringValue()
+		{
+			return isResolved() && !m_bInverted;
+		}
+
+		bool hasTypedValue()
+		{
+			return (m_BindingType == eUIExpressionBindingType::ebtParameter) && m_bHasAlphanumericPath && !m_bInverted;
+		}
+
+		bool hasBoolValue()
+		{
+			return (m_BindingType == eUIExpressionBindingType::ebtParameter) && m_bHasAlphanumericPath;
+		}
+
+		std::string getStringValue()
+		{
+			if (m_BindingType == eUIExpressionBindingType::ebtInstanceState)
+				return m_pStateMachineData->getInstanceStateName(m_sInstanceName);
+
+			return m_pParameterGroup->getParameterValue(m_pParameter.get());
+		}
+
+		double getDoubleValue()
+		{
+			return m_pParameterGroup->getDoubleParameterValue(m_pParameter.get());
+		}
+
+		int64_t getIntValue()
+		{
+			return m_pParameterGroup->getIntParameterValue(m_pParameter.get());
+		}
+
+		bool getBoolValue()
+		{
+			bool bValue = m_pParameterGroup->getBoolParameterValue(m_pParameter.get());
+			if (m_bInverted)
+				return !bValue;
+
+			return bValue;
+		}
+
+	};
+
+}
 
 using namespace AMC;
 
@@ -61,6 +203,25 @@ void CUIExpression::setFixedValue(const std::string& sValue)
 {
 	m_sFixedValue = sValue;
 	m_sExpressionValue = "";
+	invalidateBinding();
+}
+
+void CUIExpression::invalidateBinding()
+{
+	std::atomic_store(&m_pBinding, PUIExpressionBinding());
+}
+
+PUIExpressionBinding CUIExpression::getBinding(CStateMachineData* pStateMachineData)
+{
+	auto pBinding = std::atomic_load(&m_pBinding);
+	if ((pBinding.get() != nullptr) && pBinding->isValidFor(pStateMachineData))
+		return pBinding;
+
+	pBinding = std::make_shared<CUIExpressionBinding>(m_sExpressionValue, pStateMachineData);
+	if (pBinding->isValidFor(pStateMachineData))
+		std::atomic_store(&m_pBinding, pBinding);
+
+	return pBinding;
 }
 
 
@@ -99,6 +260,10 @@ std::string CUIExpression::evaluateValueEx(CStateMachineData* pStateMachineData)
 	if (!m_sExpressionValue.empty()) {
 		LibMCAssertNotNull(pStateMachineData);
 
+		auto pBinding = getBinding(pStateMachineData);
+		if (pBinding->hasStringValue())
+			return pBinding->getStringValue();
+
 		std::string sParameterInstanceName, sParameterGroupName, sParameterName;
 		CStateMachineData::extractParameterDetailsFromDotString(m_sExpressionValue, sParameterInstanceName, sParameterGroupName, sParameterName, true, true);
 
@@ -216,6 +381,10 @@ double CUIExpression::evaluateNumberValue(CStateMachineData* pStateMachineData)
 	if (!m_sExpressionValue.empty()) {
 		LibMCAssertNotNull(pStateMachineData);
 
+		auto pBinding = getBinding(pStateMachineData);
+		if (pBinding->hasTypedValue())
+			return pBinding->getDoubleValue();
+
 		std::string sParameterInstanceName, sParameterGroupName, sParameterName;
 		CStateMachineData::extractParameterDetailsFromDotString(m_sExpressionValue, sParameterInstanceName, sParameterGroupName, sParameterName, false, false);
 
@@ -251,6 +420,10 @@ int64_t CUIExpression::evaluateIntegerValue(CStateMachineData* pStateMachineData
 	if (!m_sExpressionValue.empty()) {
 		LibMCAssertNotNull(pStateMachineData);
 
+		auto pBinding = getBinding(pStateMachineData);
+		if (pBinding->hasTypedValue())
+			return pBinding->getIntValue();
+
 		std::string sParameterInstanceName, sParameterGroupName, sParameterName;
 		CStateMachineData::extractParameterDetailsFromDotString(m_sExpressionValue, sParameterInstanceName, sParameterGroupName, sParameterName, false, false);
 
@@ -286,6 +459,10 @@ bool CUIExpression::evaluateBoolValue(CStateMachineData* pStateMachineData)
 	if (!m_sExpressionValue.empty()) {
 		LibMCAssertNotNull(pStateMachineData);
 
+		auto pBinding = getBinding(pStateMachineData);
+		if (pBinding->hasBoolValue())
+			return pBinding->getBoolValue();
+
 		std::string sTrimmedExpression = AMCCommon::CUtils::trimString(m_sExpressionValue);
 
 		if (sTrimmedExpression.empty())
@@ -42,6 +42,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 namespace AMC {
 
 	amcDeclareDependingClass(CStateMachineData, PStateMachineData);
+	amcDeclareDependingClass(CUIExpressionBinding, PUIExpressionBinding);
 
 	enum class eUIExpressionFormatType 
 	{
@@ -57,8 +58,13 @@ namespace AMC {
 
 		std::string m_sFormatString;
 
+		// Parameter reference of the expression value, resolved on first evaluation and shared between copies
+		PUIExpressionBinding m_pBinding;
+
 		void readFromXML(const pugi::xml_node& xmlNode, const std::string& attributeName, const std::string& defaultValue, bool bValueMustExist);
 
+		PUIExpressionBinding getBinding(CStateMachineData* pStateMachineData);
+
 		std::string evaluateValueEx(CStateMachineData* pStateMachineData);
 	public:
 
@@ -83,6 +89,10 @@ namespace AMC {
 		void checkExpressionSyntax(CStateMachineData* pStateMachineData);
 		void checkExpressionSyntax(PStateMachineData pStateMachineData);
 
+		// Forces the expression value to be resolved again on next evaluation.
+		// Not needed when parameters are added or removed, as bindings check the structure version of their parameter group.
+		void invalidateBinding();
+
 		bool needsSync();
 		bool isEmpty(CStateMachineData* pStateMachineData);
 		bool isEmpty(PStateMachineData pStateMachineData);
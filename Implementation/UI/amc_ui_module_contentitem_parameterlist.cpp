@@ -43,6 +43,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "libmcdata_dynamic.hpp"
 #include "libmc_exceptiontypes.hpp"
 
+#include <random>
+
 using namespace AMC;
 
 
@@ -116,7 +118,8 @@ PUIModule_ContentParameterList CUIModule_ContentParameterList::makeFromXML(const
 
 
 CUIModule_ContentParameterList::CUIModule_ContentParameterList(const std::string& sLoadingText, const uint32_t nEntriesPerPage, PStateMachineData pStateMachineData, const std::string& sItemName, const std::string & sModulePath)
-	: CUIModule_ContentItem (AMCCommon::CUtils::createUUID(), sItemName, sModulePath), m_sLoadingText (sLoadingText), m_nEntriesPerPage (nEntriesPerPage), m_pStateMachineData(pStateMachineData)
+	: CUIModule_ContentItem (AMCCommon::CUtils::createUUID(), sItemName, sModulePath), m_sLoadingText (sLoadingText), m_nEntriesPerPage (nEntriesPerPage), m_pStateMachineData(pStateMachineData),
+	m_nCurrentStateID (0), m_nLayoutStateID (0)
 {
 	if (pStateMachineData.get() == nullptr)
 		throw ELibMCInterfaceException (LIBMC_ERROR_INVALIDPARAM);
@@ -126,6 +129,12 @@ CUIModule_ContentParameterList::CUIModule_ContentParameterList(const std::string
 	m_sParameterGroupCaption = "Group";
 	m_sParameterSystemCaption = "System";
 
+	// Leave room for many state changes before the 31 bit state IDs restart
+	std::random_device randomDevice;
+	std::uniform_int_distribution<uint32_t> startDistribution(1, INT32_MAX / 2);
+	m_nCurrentStateID = startDistribution(randomDevice);
+	m_nLayoutStateID = m_nCurrentStateID;
+
 }
 
 CUIModule_ContentParameterList::~CUIModule_ContentParameterList()
@@ -135,48 +144,82 @@ CUIModule_ContentParameterList::~CUIModule_ContentParameterList()
 
 
 
-void CUIModule_ContentParameterList::addParameterGroupToJSON(CJSONWriter& writer, PParameterGroup pParameterGroup, CJSONWriterArray& entryArray, bool fullGroup, const std::string& sParameterName, const std::string& sParameterHandlerDescription)
+void CUIModule_ContentParameterList::collectRows(std::vector<sParameterListRow>& rows)
 {
-	std::string sGroupDescription = pParameterGroup->getDescription();
+	for (auto entry : m_List) {
+		auto pParameterHandler = m_pStateMachineData->getParameterHandler(entry->getInstance());
 
-	if (fullGroup) {
+		sParameterListRow row;
+		row.m_pParameterHandler = pParameterHandler;
+		row.m_pSingleEntry = nullptr;
+		row.m_nParameterIndex = 0;
+
+		if (entry->isFullInstance()) {
 
-		uint32_t nCount = pParameterGroup->getParameterCount();
-		for (uint32_t nIndex = 0; nIndex < nCount; nIndex++) {
+			uint32_t nGroupCount = pParameterHandler->getGroupCount();
+			for (uint32_t nGroupIndex = 0; nGroupIndex < nGroupCount; nGroupIndex++) {
+				row.m_pParameterGroup = pParameterHandler->getGroup(nGroupIndex);
+
+				uint32_t nCount = row.m_pParameterGroup->getParameterCount();
+				for (uint32_t nIndex = 0; nIndex < nCount; nIndex++) {
+					row.m_nParameterIndex = nIndex;
+					rows.push_back(row);
+				}
+			}
 
-			std::string sParameterName;
-			std::string sDescription;
-			std::string sDefaultValue;
+		}
+		else {
 
-			pParameterGroup->getParameterInfo(nIndex, sParameterName, sDescription, sDefaultValue);
-			std::string sValue = pParameterGroup->getParameterValueByIndex(nIndex);
+			row.m_pParameterGroup = pParameterHandler->findGroup(entry->getParameterGroup(), true);
 
-			CJSONWriterObject entryObject(writer);
-			entryObject.addString(AMC_API_KEY_UI_ITEMPARAMETERDESCRIPTION, sDescription);
-			entryObject.addString(AMC_API_KEY_UI_ITEMPARAMETERVALUE, sValue);
-			entryObject.addString(AMC_API_KEY_UI_ITEMPARAMETERGROUP, sGroupDescription);
-			entryObject.addString(AMC_API_KEY_UI_ITEMPARAMETERSYSTEM, sParameterHandlerDescription);
-			entryArray.addObject(entryObject);
+			if (entry->isFullGroup()) {
+				uint32_t nCount = row.m_pParameterGroup->getParameterCount();
+				for (uint32_t nIndex = 0; nIndex < nCount; nIndex++) {
+					row.m_nParameterIndex = nIndex;
+					rows.push_back(row);
+				}
+			}
+			else {
+				row.m_pSingleEntry = entry.get();
+				rows.push_back(row);
+			}
 
 		}
 	}
-	else {
-		std::string sDescription;
-		std::string sDefaultValue;
-		std::string sValue;
+}
 
-		pParameterGroup->getParameterInfoByName(sParameterName, sDescription, sDefaultValue);
-		sValue = pParameterGroup->getParameterValueByName(sParameterName);
+uint64_t CUIModule_ContentParameterList::getRowChangeCounter(const sParameterListRow& row)
+{
+	if (row.m_pSingleEntry != nullptr)
+		return row.m_pParameterGroup->getChangeCounterOf(row.m_pSingleEntry->getParameter());
 
-		CJSONWriterObject entryObject(writer);
-		entryObject.addString(AMC_API_KEY_UI_ITEMPARAMETERDESCRIPTION, sDescription);
-		entryObject.addString(AMC_API_KEY_UI_ITEMPARAMETERVALUE, sValue);
-		entryObject.addString(AMC_API_KEY_UI_ITEMPARAMETERGROUP, sGroupDescription);
-		entryObject.addString(AMC_API_KEY_UI_ITEMPARAMETERSYSTEM, sParameterHandlerDescription);
-		entryArray.addObject(entryObject);
+	return row.m_pParameterGroup->getChangeCounterByIndex(row.m_nParameterIndex);
+}
 
+void CUIModule_ContentParameterList::addRowToJSON(CJSONWriter& writer, const sParameterListRow& row, CJSONWriterArray& entryArray, uint32_t nEntryIndex)
+{
+	std::string sParameterName;
+	std::string sDescription;
+	std::string sDefaultValue;
+	std::string sValue;
+
+	if (row.m_pSingleEntry != nullptr) {
+		sParameterName = row.m_pSingleEntry->getParameter();
+		row.m_pParameterGroup->getParameterInfoByName(sParameterName, sDescription, sDefaultValue);
+		sValue = row.m_pParameterGroup->getParameterValueByName(sParameterName);
+	}
+	else {
+		row.m_pParameterGroup->getParameterInfo(row.m_nParameterIndex, sParameterName, sDescription, sDefaultValue);
+		sValue = row.m_pParameterGroup->getParameterValueByIndex(row.m_nParameterIndex);
 	}
 
+	CJSONWriterObject entryObject(writer);
+	entryObject.addInteger(AMC_API_KEY_UI_ITEMENTRYINDEX, nEntryIndex);
+	entryObject.addString(AMC_API_KEY_UI_ITEMPARAMETERDESCRIPTION, sDescription);
+	entryObject.addString(AMC_API_KEY_UI_ITEMPARAMETERVALUE, sValue);
+	entryObject.addString(AMC_API_KEY_UI_ITEMPARAMETERGROUP, row.m_pParameterGroup->getDescription());
+	entryObject.addString(AMC_API_KEY_UI_ITEMPARAMETERSYSTEM, row.m_pParameterHandler->getDescription());
+	entryArray.addObject(entryObject);
 }
 
 
@@ -212,34 +255,55 @@ void CUIModule_ContentParameterList::addLegacyContentToJSON(CJSONWriter& writer,
 
 	object.addArray(AMC_API_KEY_UI_ITEMHEADERS, headersArray);
 
-	CJSONWriterArray entriesArray(writer);
-	object.addArray(AMC_API_KEY_UI_ITEMENTRIES, entriesArray);
+	std::lock_guard<std::mutex> lockGuard(m_ChangeStateMutex);
 
+	std::vector<sParameterListRow> rows;
+	collectRows(rows);
+	uint32_t nRowCount = (uint32_t)rows.size();
 
-	CJSONWriterArray entryArray(writer);
-
-	for (auto entry : m_List) {
-		auto pParameterHandler = m_pStateMachineData->getParameterHandler(entry->getInstance ());
-		auto sParameterHandlerDescription = pParameterHandler->getDescription();
-
-		if (entry->isFullInstance()) {
-
-			uint32_t nGroupCount = pParameterHandler->getGroupCount();
-			for (uint32_t nGroupIndex = 0; nGroupIndex < nGroupCount; nGroupIndex++) {
-				auto pParameterGroup = pParameterHandler->getGroup(nGroupIndex);
-				addParameterGroupToJSON(writer, pParameterGroup, entryArray, true, "", sParameterHandlerDescription);
+	// State IDs are sent as 31 bit integers. Restarting them invalidates all client states, like a layout change.
+	if (m_nCurrentStateID >= INT32_MAX) {
+		m_nCurrentStateID = 0;
+		m_RowChangeCounters.clear();
+	}
 
-			}
+	// Advance the state ID at most once per poll, and only if something actually changed.
+	bool bStateAdvanced = false;
+	auto advanceState = [this, &bStateAdvanced]() {
+		if (!bStateAdvanced) {
+			m_nCurrentStateID++;
+			bStateAdvanced = true;
+		}
+	};
+
+	// If the set of rows changed, the deltas of all earlier states are invalid
+	if ((nRowCount != m_RowChangeCounters.size()) || (m_nLayoutStateID > m_nCurrentStateID)) {
+		advanceState();
+		m_nLayoutStateID = m_nCurrentStateID;
+		m_RowChangeCounters.assign(nRowCount, 0);
+		m_RowStateIDs.assign(nRowCount, m_nCurrentStateID);
+	}
 
+	for (uint32_t nRowIndex = 0; nRowIndex < nRowCount; nRowIndex++) {
+		uint64_t nChangeCounter = getRowChangeCounter(rows[nRowIndex]);
+		if (nChangeCounter != m_RowChangeCounters[nRowIndex]) {
+			advanceState();
+			m_RowChangeCounters[nRowIndex] = nChangeCounter;
+			m_RowStateIDs[nRowIndex] = m_nCurrentStateID;
 		}
-		else {
+	}
 
-			auto pParameterGroup = pParameterHandler->findGroup(entry->getParameterGroup(), true);
-			addParameterGroupToJSON(writer, pParameterGroup, entryArray, entry->isFullGroup(), entry->getParameter(), sParameterHandlerDescription);
+	bool bIsDelta = (nStateID != 0) && (nStateID >= m_nLayoutStateID) && (nStateID <= m_nCurrentStateID);
 
-		}
+	object.addInteger(AMC_API_KEY_UI_ITEMSTATEID, m_nCurrentStateID);
+	object.addInteger(AMC_API_KEY_UI_ITEMENTRYCOUNT, nRowCount);
+	object.addBool(AMC_API_KEY_UI_ITEMISDELTA, bIsDelta);
 
+	CJSONWriterArray entryArray(writer);
 
+	for (uint32_t nRowIndex = 0; nRowIndex < nRowCount; nRowIndex++) {
+		if ((!bIsDelta) || (m_RowStateIDs[nRowIndex] > nStateID))
+			addRowToJSON(writer, rows[nRowIndex], entryArray, nRowIndex);
 	}
 
 	object.addArray (AMC_API_KEY_UI_ITEMENTRIES, entryArray);
@@ -44,6 +44,9 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "pugixml.hpp"
 
+#include <mutex>
+#include <vector>
+
 namespace AMC {
 
 	amcDeclareDependingClass(CStateMachineData, PStateMachineData);
@@ -51,6 +54,7 @@ namespace AMC {
 	amcDeclareDependingClass(CUIModule_ContentParameterListEntry, PUIModule_ContentParameterListEntry);
 	amcDeclareDependingClass(CUIModuleEnvironment, PUIModuleEnvironment);
 	amcDeclareDependingClass(CParameterGroup, PParameterGroup);
+	amcDeclareDependingClass(CParameterHandler, PParameterHandler);
 
 	class CUIModule_ContentParameterListEntry {
 	private:
@@ -72,6 +76,14 @@ namespace AMC {
 	};
 
 
+	// One displayed row of the parameter list. Entries that reference a full group or instance expand into several rows.
+	typedef struct _sParameterListRow {
+		PParameterHandler m_pParameterHandler;
+		PParameterGroup m_pParameterGroup;
+		CUIModule_ContentParameterListEntry* m_pSingleEntry; // only set if the row references a single parameter by name
+		uint32_t m_nParameterIndex;
+	} sParameterListRow;
+
 	class CUIModule_ContentParameterList : public CUIModule_ContentItem {
 	protected:
 
@@ -87,7 +99,21 @@ namespace AMC {
 
 		PStateMachineData m_pStateMachineData;
 
-		void addParameterGroupToJSON(CJSONWriter& writer, AMC::PParameterGroup pParameterGroup, CJSONWriterArray& entryArray, bool fullGroup, const std::string & sParameterName, const std::string & sParameterHandlerDescription);
+		// Change tracking for delta updates. Every poll that observes a changed parameter advances the state ID
+		// of the list; each row remembers the state ID of its last change. Clients send back the last state ID they
+		// received and only get the rows that changed after it. Every list starts its state IDs at a random offset,
+		// so that a state ID issued by another content item or by an earlier server run is not valid for this list.
+		std::mutex m_ChangeStateMutex;
+		std::vector<uint64_t> m_RowChangeCounters;
+		std::vector<uint32_t> m_RowStateIDs;
+		uint32_t m_nCurrentStateID;
+		uint32_t m_nLayoutStateID;
+
+		void collectRows(std::vector<sParameterListRow>& rows);
+
+		uint64_t getRowChangeCounter(const sParameterListRow& row);
+
+		void addRowToJSON(CJSONWriter& writer, const sParameterListRow& row, CJSONWriterArray& entryArray, uint32_t nEntryIndex);
 
 	public:
 
@@ -46,10 +46,21 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "amc_unittests_common_utils.hpp"
 #include "amc_unittests_resourcepackage.hpp"
 #include "amc_unittests_jpeg.hpp"
+#include "amc_unittests_pixelconversion.hpp"
 #include "amc_unittests_streams.hpp"
 #include "amc_unittests_alerts.hpp"
 #include "amc_unittests_dataseries.hpp"
 #include "amc_unittests_discretefielddata2d.hpp"
+#include "amc_unittests_toolpathprofile.hpp"
+#include "amc_unittests_streamhandler.hpp"
+#include "amc_unittests_systemtaskscheduler.hpp"
+#include "amc_unittests_uiexpression.hpp"
+#include "amc_unittests_sqlhandler.hpp"
+#include "amc_unittests_smcparser.hpp"
+#include "amc_unittests_toolpathlayercache.hpp"
+#include "amc_unittests_parametergroup.hpp"
+#include "amc_unittests_uiparameterlist.hpp"
+#include "amc_unittests_serverbyterange.hpp"
 
 
 using namespace AMCUnitTest;
@@ -74,8 +85,19 @@ CUnitTests::CUnitTests (PUnitTestIO pIO)
 	registerTestGroup(std::make_shared <CUnitTestGroup_CommonUtils>());
 	registerTestGroup(std::make_shared <CUnitTestGroup_ResourcePackage>());
 	registerTestGroup(std::make_shared <CUnitTestGroup_JPEG>());
+	registerTestGroup(std::make_shared <CUnitTestGroup_PixelConversion>());
 	registerTestGroup(std::make_shared <CUnitTestGroup_Streams>());
 	registerTestGroup(std::make_shared <CUnitTestGroup_Alerts>());
 	registerTestGroup(std::make_shared <CUnitTestGroup_DataSeries>());
 	registerTestGroup(std::make_shared <CUnitTestGroup_DiscreteFieldData2D>());
+	registerTestGroup(std::make_shared <CUnitTestGroup_ToolpathProfile>());
+	registerTestGroup(std::make_shared <CUnitTestGroup_StreamHandler>());
+	registerTestGroup(std::make_shared <CUnitTestGroup_SystemTaskScheduler>());
+	registerTestGroup(std::make_shared <CUnitTestGroup_UIExpression>());
+	registerTestGroup(std::make_shared <CUnitTestGroup_SQLHandler>());
+	registerTestGroup(std::make_shared <CUnitTestGroup_SMCParser>());
+	registerTestGroup(std::make_shared <CUnitTestGroup_ToolpathLayerCache>());
+	registerTestGroup(std::make_shared <CUnitTestGroup_ParameterGroup>());
+	registerTestGroup(std::make_shared <CUnitTestGroup_UIParameterList>());
+	registerTestGroup(std::make_shared <CUnitTestGroup_ServerByteRange>());
 }
@@ -34,6 +34,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "amc_unittests.hpp"
 #include "common_utils.hpp"
+#include "common_sha256calculator.hpp"
 
 #include <fstream>
 #include <cstdlib>
@@ -52,6 +53,7 @@ namespace AMCUnitTest {
 			registerTest("UTF8Conversions", "UTF8/UTF16 conversions and UTF8 validation", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_CommonUtils::testUTF8Conversions, this));
 			registerTest("StringConversions", "String trimming, splitting, and numeric parsing", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_CommonUtils::testStringConversions, this));
 			registerTest("SHA256Functions", "SHA256 helpers for data, strings, and files", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_CommonUtils::testSHA256Functions, this));
+			registerTest("SHA256Calculator", "Incremental SHA256 matches file based hashing", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_CommonUtils::testSHA256Calculator, this));
 			registerTest("Base64Functions", "Base64 encoding/decoding and RFC5987 encoding", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_CommonUtils::testBase64Functions, this));
 			registerTest("FilePathFunctions", "Path handling and file/directory helpers", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_CommonUtils::testFilePathFunctions, this));
 			registerTest("TempAndDirectoryFunctions", "Temporary paths, directory content, and OS helpers", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_CommonUtils::testTempAndDirectoryFunctions, this));
@@ -352,6 +354,64 @@ namespace AMCUnitTest {
 			assertTrue(thrown, "Expected calculateRandomSHA256String to throw on too many iterations");
 		}
 
+		void testSHA256Calculator()
+		{
+			// Content does not align with the block size, to check partial blocks and chunks spanning blocks.
+			std::string sContent;
+			for (uint32_t nIndex = 0; nIndex < 10000; nIndex++)
+				sContent += std::to_string(nIndex * 7919) + ",";
+
+			CScopedTempDir tempDir;
+			std::string filePath = joinPath(tempDir.m_sPath, "incremental.txt");
+			CScopedTempFile tempFile(filePath);
+			writeFile(filePath, sContent);
+
+			std::string sExpectedSHA256 = AMCCommon::CUtils::calculateSHA256FromFile(filePath);
+			std::string sExpectedBlockSHA256 = AMCCommon::CUtils::calculateBlockwiseSHA256FromFile(filePath, 4096);
+
+			AMCCommon::CSHA256Calculator calculator(4096);
+			const uint8_t* pData = reinterpret_cast<const uint8_t*>(sContent.data());
+			uint64_t nOffset = 0;
+			uint64_t nChunkSize = 1;
+			while (nOffset < sContent.size()) {
+				uint64_t nSize = std::min<uint64_t>(nChunkSize, sContent.size() - nOffset);
+				calculator.addData(pData + nOffset, nSize);
+				nOffset += nSize;
+				nChunkSize = (nChunkSize * 3) + 1;
+			}
+			assertTrue(calculator.getProcessedSize() == sContent.size());
+
+			std::string sSHA256, sBlockSHA256;
+			calculator.finish(sSHA256, sBlockSHA256);
+			assertTrue(sSHA256 == sExpectedSHA256);
+			assertTrue(sBlockSHA256 == sExpectedBlockSHA256);
+
+			AMCCommon::CSHA256Calculator fileCalculator(4096);
+			fileCalculator.addFileRange(filePath, 0, 5000);
+			fileCalculator.addFileRange(filePath, 5000, sContent.size() - 5000);
+			fileCalculator.finish(sSHA256, sBlockSHA256);
+			assertTrue(sSHA256 == sExpectedSHA256);
+			assertTrue(sBlockSHA256 == sExpectedBlockSHA256);
+
+			std::string emptyPath = joinPath(tempDir.m_sPath, "empty.txt");
+			CScopedTempFile emptyFile(emptyPath);
+			writeFile(emptyPath, "");
+
+			AMCCommon::CSHA256Calculator emptyCalculator(4096);
+			emptyCalculator.finish(sSHA256, sBlockSHA256);
+			assertTrue(sSHA256 == AMCCommon::CUtils::calculateSHA256FromFile(emptyPath));
+			assertTrue(sBlockSHA256 == AMCCommon::CUtils::calculateBlockwiseSHA256FromFile(emptyPath, 4096));
+
+			bool thrown = false;
+			try {
+				emptyCalculator.addData(pData, 1);
+			}
+			catch (...) {
+				thrown = true;
+			}
+			assertTrue(thrown, "Expected addData to throw after finish");
+		}
+
 		void testBase64Functions()
 		{
 			std::string input = "hello world";
@@ -0,0 +1,188 @@
+/*++
+
+Copyright (C) 2025 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+#ifndef __AMCTEST_UNITTEST_PARAMETERGROUP
+#define __AMCTEST_UNITTEST_PARAMETERGROUP
+
+
+#include "amc_unittests.hpp"
+#include "amc_parametergroup.hpp"
+#include "common_chrono.hpp"
+
+#include <memory>
+#include <string>
+
+
+namespace AMCUnitTest {
+
+	class CUnitTestGroup_ParameterGroup : public CUnitTestGroup {
+	public:
+
+		std::string getTestGroupName() override {
+			return "ParameterGroup";
+		}
+
+		void registerTests() override {
+			registerTest("NativeDoubleValues", "Double values are returned without string rounding", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_ParameterGroup::testNativeDoubleValues, this));
+			registerTest("DoubleChangeDetection", "Double changes are detected on the native value", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_ParameterGroup::testDoubleChangeDetection, this));
+			registerTest("IntegerAndBoolValues", "Integer and bool values keep their conversion rules", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_ParameterGroup::testIntegerAndBoolValues, this));
+			registerTest("StringValues", "String values switch parameters back to string storage", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_ParameterGroup::testStringValues, this));
+			registerTest("CopyToGroup", "Copied parameters keep their native values", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_ParameterGroup::testCopyToGroup, this));
+		}
+
+		void initializeTests() override {
+		}
+
+	private:
+
+		static AMC::PParameterGroup createGroup()
+		{
+			auto pGroup = std::make_shared<AMC::CParameterGroup>("group", "Group", std::make_shared<AMCCommon::CChrono>());
+			pGroup->addNewDoubleParameter("speed", "Speed", 1.0, 0.001);
+			pGroup->addNewIntParameter("layer", "Layer", 42);
+			pGroup->addNewBoolParameter("active", "Active", true);
+			pGroup->addNewStringParameter("name", "Name", "part1");
+			return pGroup;
+		}
+
+		void testNativeDoubleValues()
+		{
+			auto pGroup = createGroup();
+
+			pGroup->setDoubleParameterValueByName("speed", 1.23456789);
+
+			// Getters return the exact value that has been set, not the 6 digit string representation
+			assertTrue(pGroup->getDoubleParameterValueByName("speed") == 1.23456789, "Expected the native double value");
+
+			// Serialization keeps the std::to_string format
+			assertTrue(pGroup->getParameterValueByName("speed") == "1.234568");
+			assertTrue(pGroup->serializeToJSON().find("1.234568") != std::string::npos, "Expected the formatted value in the JSON serialization");
+
+			pGroup->setDoubleParameterValueByName("speed", -0.000000001);
+			assertTrue(pGroup->getDoubleParameterValueByName("speed") == -0.000000001);
+			assertTrue(pGroup->getParameterValueByName("speed") == "-0.000000");
+		}
+
+		void testDoubleChangeDetection()
+		{
+			auto pGroup = createGroup();
+
+			pGroup->setDoubleParameterValueByName("speed", 1.23456789);
+			uint64_t nChangeCounter = pGroup->getChangeCounterOf("speed");
+
+			// Setting the identical value is not a change
+			pGroup->setDoubleParameterValueByName("speed", 1.23456789);
+			assertTrue(pGroup->getChangeCounterOf("speed") == nChangeCounter, "Expected no change for the identical value");
+
+			// Differences below the string precision are changes. These were swallowed by the std::to_string comparison before.
+			pGroup->setDoubleParameterValueByName("speed", 1.2345679);
+			assertTrue(pGroup->getChangeCounterOf("speed") == nChangeCounter + 1, "Expected a change below the string precision");
+			assertTrue(pGroup->getParameterValueByName("speed") == "1.234568");
+
+			// The first double value on a string valued parameter is compared by its formatted string
+			pGroup->setParameterValueByName("speed", "2.500000");
+			nChangeCounter = pGroup->getChangeCounterOf("speed");
+			pGroup->setDoubleParameterValueByName("speed", 2.5);
+			assertTrue(pGroup->getChangeCounterOf("speed") == nChangeCounter, "Expected no change for the same formatted value");
+			pGroup->setDoubleParameterValueByName("speed", 2.5000001);
+			assertTrue(pGroup->getChangeCounterOf("speed") == nChangeCounter + 1, "Expected a change on the native value");
+		}
+
+		void testIntegerAndBoolValues()
+		{
+			auto pGroup = createGroup();
+
+			uint64_t nLayerChangeCounter = pGroup->getChangeCounterOf("layer");
+			pGroup->setIntParameterValueByName("layer", 42);
+			assertTrue(pGroup->getChangeCounterOf("layer") == nLayerChangeCounter);
+			pGroup->setIntParameterValueByName("layer", 43);
+			assertTrue(pGroup->getChangeCounterOf("layer") == nLayerChangeCounter + 1);
+			assertTrue(pGroup->getIntParameterValueByName("layer") == 43);
+			assertTrue(pGroup->getDoubleParameterValueByName("layer") == 43.0);
+			assertTrue(pGroup->getParameterValueByName("layer") == "43");
+
+			// Double values convert to integers with the same accuracy as their strings
+			pGroup->setDoubleParameterValueByName("layer", 44.0004);
+			assertTrue(pGroup->getIntParameterValueByName("layer") == 44);
+			pGroup->setDoubleParameterValueByName("layer", 44.4);
+			bool thrown = false;
+			try {
+				pGroup->getIntParameterValueByName("layer");
+			}
+			catch (...) {
+				thrown = true;
+			}
+			assertTrue(thrown, "Expected a non-integer double value to throw");
+
+			uint64_t nActiveChangeCounter = pGroup->getChangeCounterOf("active");
+			pGroup->setBoolParameterValueByName("active", true);
+			assertTrue(pGroup->getChangeCounterOf("active") == nActiveChangeCounter);
+			pGroup->setBoolParameterValueByName("active", false);
+			assertTrue(pGroup->getChangeCounterOf("active") == nActiveChangeCounter + 1);
+			assertTrue(!pGroup->getBoolParameterValueByName("active"));
+			assertTrue(pGroup->getIntParameterValueByName("active") == 0);
+			assertTrue(pGroup->getParameterValueByName("active") == "0");
+		}
+
+		void testStringValues()
+		{
+			auto pGroup = createGroup();
+
+			pGroup->setDoubleParameterValueByName("speed", 1.23456789);
+			uint64_t nChangeCounter = pGroup->getChangeCounterOf("speed");
+
+			// The string has the same representation, so this is not a change, but the value is parsed from the string from now on
+			pGroup->setParameterValueByName("speed", "1.234568");
+			assertTrue(pGroup->getChangeCounterOf("speed") == nChangeCounter);
+			assertTrue(pGroup->getDoubleParameterValueByName("speed") == 1.234568);
+
+			pGroup->setParameterValueByName("name", "part2");
+			assertTrue(pGroup->getParameterValueByName("name") == "part2");
+		}
+
+		void testCopyToGroup()
+		{
+			auto pGroup = createGroup();
+			pGroup->setDoubleParameterValueByName("speed", 1.23456789);
+			pGroup->setIntParameterValueByName("layer", 7);
+
+			auto pCopy = std::make_shared<AMC::CParameterGroup>("copy", "Copy", std::make_shared<AMCCommon::CChrono>());
+			pGroup->copyToGroup(pCopy.get());
+
+			assertTrue(pCopy->getDoubleParameterValueByName("speed") == 1.23456789);
+			assertTrue(pCopy->getParameterValueByName("speed") == "1.234568");
+			assertTrue(pCopy->getIntParameterValueByName("layer") == 7);
+			assertTrue(pCopy->getBoolParameterValueByName("active"));
+		}
+
+	};
+
+}
+
+#endif // __AMCTEST_UNITTEST_PARAMETERGROUP
@@ -0,0 +1,233 @@
+/*++
+
+Copyright (C) 2025 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+#ifndef __AMCTEST_UNITTEST_PIXELCONVERSION
+#define __AMCTEST_UNITTEST_PIXELCONVERSION
+
+
+#include "amc_unittests.hpp"
+#include "common_pixelconversion.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+
+namespace AMCUnitTest {
+
+	class CUnitTestGroup_PixelConversion : public CUnitTestGroup {
+	public:
+
+		std::string getTestGroupName() override {
+			return "PixelConversion";
+		}
+
+		void registerTests() override {
+			registerTest("KnownValues", "Converts single pixels to the expected values", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_PixelConversion::testKnownValues, this));
+			registerTest("BitPacking", "Packs grey values into 1, 2 and 4 bit rows", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_PixelConversion::testBitPacking, this));
+			registerTest("SIMDMatchesScalar", "Vectorized kernels produce the same result as the scalar kernels", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_PixelConversion::testSIMDMatchesScalar, this));
+			registerTest("YUY2SIMDMatchesScalar", "Vectorized YUY2 kernels match the scalar kernels for all input values", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_PixelConversion::testYUY2SIMDMatchesScalar, this));
+		}
+
+		void initializeTests() override {
+		}
+
+	private:
+
+		typedef std::function<void(const uint8_t*, uint8_t*, size_t, bool)> PixelKernel;
+
+		static std::vector<uint8_t> createPattern(size_t nSize, uint32_t nSeed)
+		{
+			std::vector<uint8_t> buffer(nSize);
+			uint32_t nState = nSeed;
+			for (auto& value : buffer) {
+				nState = nState * 1664525 + 1013904223;
+				value = (uint8_t)(nState >> 24);
+			}
+			return buffer;
+		}
+
+		void compareKernel(const std::string& sName, PixelKernel kernel, size_t nSourceBytesPerPixel, size_t nTargetBytesPerPixel)
+		{
+			for (size_t nPixelCount = 0; nPixelCount < 100; nPixelCount++) {
+				auto source = createPattern(nPixelCount * nSourceBytesPerPixel, (uint32_t)nPixelCount + 1);
+				std::vector<uint8_t> scalarTarget(nPixelCount * nTargetBytesPerPixel + 1, 0xA5);
+				std::vector<uint8_t> simdTarget(nPixelCount * nTargetBytesPerPixel + 1, 0xA5);
+
+				kernel(source.data(), scalarTarget.data(), nPixelCount, false);
+				kernel(source.data(), simdTarget.data(), nPixelCount, true);
+
+				assertTrue(scalarTarget == simdTarget, sName + " differs for " + std::to_string(nPixelCount) + " pixels");
+				assertTrue(simdTarget.back() == 0xA5, sName + " writes past the end of the row");
+			}
+		}
+
+		void testKnownValues()
+		{
+			uint8_t nGrey = 200;
+
+			uint8_t rgba[4] = { 0, 0, 0, 0 };
+			AMCCommon::CPixelConversion::convertGreyScale8ToRGBA32(&nGrey, rgba, 1);
+			assertTrue((rgba[0] == 200) && (rgba[1] == 200) && (rgba[2] == 200) && (rgba[3] == 255));
+
+			uint8_t rgb[3] = { 0, 0, 0 };
+			AMCCommon::CPixelConversion::convertGreyScale8ToRGB24(&nGrey, rgb, 1);
+			assertTrue((rgb[0] == 200) && (rgb[1] == 200) && (rgb[2] == 200));
+
+			uint8_t rgbaSource[4] = { 30, 60, 90, 17 };
+			uint8_t nResultGrey = 0;
+			AMCCommon::CPixelConversion::convertRGBA32ToGreyScale8(rgbaSource, &nResultGrey, 1);
+			assertTrue(nResultGrey == 60);
+
+			// Pure red is stored in the lowest five bits.
+			uint8_t redRGB24[3] = { 255, 0, 0 };
+			uint8_t rgb16[2] = { 0, 0 };
+			AMCCommon::CPixelConversion::convertRGB24ToRGB16(redRGB24, rgb16, 1);
+			assertTrue((rgb16[0] == 0x1F) && (rgb16[1] == 0x00));
+
+			uint8_t redRGBA[4] = { 0, 0, 0, 0 };
+			AMCCommon::CPixelConversion::convertRGB16ToRGBA32(rgb16, redRGBA, 1);
+			assertTrue((redRGBA[0] == 248) && (redRGBA[1] == 0) && (redRGBA[2] == 0) && (redRGBA[3] == 255));
+
+			// Y = 235 with neutral chroma is white, Y = 16 is black.
+			uint8_t yuy2[4] = { 235, 128, 16, 128 };
+			uint8_t yuy2Grey[2] = { 0, 0 };
+			AMCCommon::CPixelConversion::convertYUY2ToGreyScale8(yuy2, yuy2Grey, 2);
+			assertTrue((yuy2Grey[0] == 255) && (yuy2Grey[1] == 0));
+		}
+
+		void testBitPacking()
+		{
+			std::vector<uint8_t> greyValues = { 255, 0, 128, 127, 0, 0, 0, 200, 255 };
+
+			std::vector<uint8_t> packed1bit(2, 0);
+			AMCCommon::CPixelConversion::packGreyScale8ToBlackWhite1bit(greyValues.data(), packed1bit.data(), 0, greyValues.size());
+			assertTrue(packed1bit[0] == 0xA1);
+			assertTrue(packed1bit[1] == 0x80);
+
+			// Bits in front of the target offset are kept.
+			std::vector<uint8_t> offsetPacked(2, 0xC0);
+			AMCCommon::CPixelConversion::packGreyScale8ToBlackWhite1bit(greyValues.data(), offsetPacked.data(), 2, greyValues.size());
+			assertTrue(offsetPacked[0] == 0xE8);
+			assertTrue(offsetPacked[1] == 0x60);
+
+			std::vector<uint8_t> grey2bit = { 0, 64, 128, 255 };
+			uint8_t nPacked2bit = 0;
+			AMCCommon::CPixelConversion::packGreyScale8ToGreyScale2bit(grey2bit.data(), &nPacked2bit, grey2bit.size());
+			assertTrue(nPacked2bit == 0xE4);
+
+			std::vector<uint8_t> grey4bit = { 16, 255 };
+			uint8_t nPacked4bit = 0;
+			AMCCommon::CPixelConversion::packGreyScale8ToGreyScale4bit(grey4bit.data(), &nPacked4bit, grey4bit.size());
+			assertTrue(nPacked4bit == 0xF1);
+
+			for (size_t nBitOffset = 0; nBitOffset < 8; nBitOffset++) {
+				for (size_t nPixelCount = 0; nPixelCount < 100; nPixelCount++) {
+					auto source = createPattern(nPixelCount, (uint32_t)(nBitOffset * 100 + nPixelCount));
+					std::vector<uint8_t> scalarTarget(16, 0x5A);
+					std::vector<uint8_t> simdTarget(16, 0x5A);
+
+					AMCCommon::CPixelConversion::packGreyScale8ToBlackWhite1bit(source.data(), scalarTarget.data(), nBitOffset, nPixelCount, false);
+					AMCCommon::CPixelConversion::packGreyScale8ToBlackWhite1bit(source.data(), simdTarget.data(), nBitOffset, nPixelCount, true);
+					assertTrue(scalarTarget == simdTarget, "1 bit packing differs at offset " + std::to_string(nBitOffset));
+				}
+			}
+
+			compareKernel("GreyScale2bit", [](const uint8_t* pSource, uint8_t* pTarget, size_t nPixelCount, bool bAllowSIMD) {
+				std::vector<uint8_t> packed((nPixelCount + 3) / 4 + 1, 0);
+				AMCCommon::CPixelConversion::packGreyScale8ToGreyScale2bit(pSource, packed.data(), nPixelCount, bAllowSIMD);
+				std::copy(packed.begin(), packed.end() - 1, pTarget);
+			}, 1, 1);
+
+			compareKernel("GreyScale4bit", [](const uint8_t* pSource, uint8_t* pTarget, size_t nPixelCount, bool bAllowSIMD) {
+				std::vector<uint8_t> packed((nPixelCount + 1) / 2 + 1, 0);
+				AMCCommon::CPixelConversion::packGreyScale8ToGreyScale4bit(pSource, packed.data(), nPixelCount, bAllowSIMD);
+				std::copy(packed.begin(), packed.end() - 1, pTarget);
+			}, 1, 1);
+		}
+
+		void testSIMDMatchesScalar()
+		{
+			compareKernel("RGB16ToGreyScale8", &AMCCommon::CPixelConversion::convertRGB16ToGreyScale8, 2, 1);
+			compareKernel("RGB24ToGreyScale8", &AMCCommon::CPixelConversion::convertRGB24ToGreyScale8, 3, 1);
+			compareKernel("RGBA32ToGreyScale8", &AMCCommon::CPixelConversion::convertRGBA32ToGreyScale8, 4, 1);
+
+			compareKernel("GreyScale8ToRGB16", &AMCCommon::CPixelConversion::convertGreyScale8ToRGB16, 1, 2);
+			compareKernel("RGB24ToRGB16", &AMCCommon::CPixelConversion::convertRGB24ToRGB16, 3, 2);
+			compareKernel("RGBA32ToRGB16", &AMCCommon::CPixelConversion::convertRGBA32ToRGB16, 4, 2);
+
+			compareKernel("GreyScale8ToRGB24", &AMCCommon::CPixelConversion::convertGreyScale8ToRGB24, 1, 3);
+			compareKernel("RGB16ToRGB24", &AMCCommon::CPixelConversion::convertRGB16ToRGB24, 2, 3);
+			compareKernel("RGBA32ToRGB24", &AMCCommon::CPixelConversion::convertRGBA32ToRGB24, 4, 3);
+
+			compareKernel("GreyScale8ToRGBA32", &AMCCommon::CPixelConversion::convertGreyScale8ToRGBA32, 1, 4);
+			compareKernel("RGB16ToRGBA32", &AMCCommon::CPixelConversion::convertRGB16ToRGBA32, 2, 4);
+			compareKernel("RGB24ToRGBA32", &AMCCommon::CPixelConversion::convertRGB24ToRGBA32, 3, 4);
+		}
+
+		void testYUY2SIMDMatchesScalar()
+		{
+			// Every combination of Y, U and V, one row of 256 Y values per (U, V) pair.
+			std::vector<uint8_t> source(256 * 2);
+			std::vector<PixelKernel> kernels = {
+				&AMCCommon::CPixelConversion::convertYUY2ToGreyScale8,
+				&AMCCommon::CPixelConversion::convertYUY2ToRGB16,
+				&AMCCommon::CPixelConversion::convertYUY2ToRGB24,
+				&AMCCommon::CPixelConversion::convertYUY2ToRGBA32
+			};
+			std::vector<size_t> targetBytesPerPixel = { 1, 2, 3, 4 };
+
+			for (uint32_t nU = 0; nU < 256; nU += 5) {
+				for (uint32_t nV = 0; nV < 256; nV += 3) {
+					for (uint32_t nY = 0; nY < 256; nY += 2) {
+						source[nY * 2] = (uint8_t)nY;
+						source[nY * 2 + 1] = (uint8_t)nU;
+						source[nY * 2 + 2] = (uint8_t)(nY + 1);
+						source[nY * 2 + 3] = (uint8_t)nV;
+					}
+
+					for (size_t nKernelIndex = 0; nKernelIndex < kernels.size(); nKernelIndex++) {
+						std::vector<uint8_t> scalarTarget(256 * targetBytesPerPixel[nKernelIndex]);
+						std::vector<uint8_t> simdTarget(256 * targetBytesPerPixel[nKernelIndex]);
+						kernels[nKernelIndex](source.data(), scalarTarget.data(), 256, false);
+						kernels[nKernelIndex](source.data(), simdTarget.data(), 256, true);
+						assertTrue(scalarTarget == simdTarget, "YUY2 conversion differs for U=" + std::to_string(nU) + " V=" + std::to_string(nV));
+					}
+				}
+			}
+
+			compareKernel("YUY2ToRGBA32", [](const uint8_t* pSource, uint8_t* pTarget, size_t nPixelCount, bool bAllowSIMD) {
+				AMCCommon::CPixelConversion::convertYUY2ToRGBA32(pSource, pTarget, nPixelCount & ~(size_t)1, bAllowSIMD);
+			}, 2, 4);
+		}
+	};
+
+}
+
+#endif // __AMCTEST_UNITTEST_PIXELCONVERSION
@@ -39,6 +39,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "common_importstream_native.hpp"
 #include "common_portablezipwriter.hpp"
 #include "common_utils.hpp"
+#include "Libraries/zlib/zlib.h"
 
 #include <sstream>
 #include <vector>
@@ -69,6 +70,10 @@ namespace AMCUnitTest {
 			registerTest("ReadEntryExExactSize", "Read entry with exact buffer size", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_ResourcePackage::testReadEntryExExactSize, this));
 			registerTest("ReadEntryExBufferTooSmallThrows", "Read entry throws on too-small buffer", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_ResourcePackage::testReadEntryExBufferTooSmallThrows, this));
 			registerTest("ReadEntryMissingNameThrows", "Reading missing entry throws", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_ResourcePackage::testReadEntryMissingNameThrows, this));
+			registerTest("ReadCachedEntryIsShared", "Cached entry is decompressed once and shared", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_ResourcePackage::testReadCachedEntryIsShared, this));
+			registerTest("CachedEntryETagFromContent", "Entity tag is derived from entry content", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_ResourcePackage::testCachedEntryETagFromContent, this));
+			registerTest("CachedEntryGZIPRoundTrip", "Precompressed gzip variant inflates to entry data", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_ResourcePackage::testCachedEntryGZIPRoundTrip, this));
+			registerTest("CachedEntryBinaryNotCompressed", "Binary content types have no compressed variant", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_ResourcePackage::testCachedEntryBinaryNotCompressed, this));
 			registerTest("MissingPackageXMLThrows", "Package without package.xml throws", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_ResourcePackage::testMissingPackageXMLThrows, this));
 			registerTest("EmptyPackageXMLThrows", "Empty package.xml throws", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_ResourcePackage::testEmptyPackageXMLThrows, this));
 			registerTest("InvalidXMLThrows", "Malformed package.xml throws", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_ResourcePackage::testInvalidXMLThrows, this));
@@ -458,6 +463,111 @@ namespace AMCUnitTest {
 			assertTrue(thrown, "Expected readEntry to throw on missing entry");
 		}
 
+		std::string makeRepetitiveText(size_t nLineCount)
+		{
+			std::stringstream ss;
+			for (size_t nIndex = 0; nIndex < nLineCount; nIndex++)
+				ss << "function line" << nIndex << "() { return \"resource package cache\"; }\n";
+			return ss.str();
+		}
+
+		void testReadCachedEntryIsShared()
+		{
+			CScopedTempDir tempDir;
+			std::string zipPath = joinPath(tempDir.m_sPath, "cached_shared.zip");
+
+			auto entry = makeEntry("Script", "script.js", "js", "application/javascript", makeRepetitiveText(64));
+			std::vector<CPackageEntrySpec> entries = { entry };
+			std::string packageXML = buildPackageXML(m_sSchemaNamespace, entries);
+
+			writeZIPFile(zipPath, packageXML, entries, true);
+			auto pPackage = loadPackageFromZip(zipPath);
+
+			auto pFirst = pPackage->readCachedEntry("script");
+			auto pSecond = pPackage->readCachedEntry("SCRIPT");
+			assertTrue(pFirst.get() == pSecond.get(), "Expected cached entry to be shared");
+			assertTrue(pFirst->getSize() == entry.m_sData.size());
+
+			std::vector<uint8_t> buffer;
+			pPackage->readEntry("script", buffer);
+			assertTrue(std::memcmp(buffer.data(), entry.m_sData.data(), buffer.size()) == 0);
+		}
+
+		void testCachedEntryETagFromContent()
+		{
+			CScopedTempDir tempDir;
+			std::string zipPath = joinPath(tempDir.m_sPath, "cached_etag.zip");
+
+			auto entryA = makeEntry("A", "a.txt", "txt", "text/plain", "same content");
+			auto entryB = makeEntry("B", "b.txt", "txt", "text/plain", "same content");
+			auto entryC = makeEntry("C", "c.txt", "txt", "text/plain", "other content");
+			std::vector<CPackageEntrySpec> entries = { entryA, entryB, entryC };
+			std::string packageXML = buildPackageXML(m_sSchemaNamespace, entries);
+
+			writeZIPFile(zipPath, packageXML, entries, true);
+			auto pPackage = loadPackageFromZip(zipPath);
+
+			std::string sETagA = pPackage->readCachedEntry("a")->getETag();
+			std::string sETagB = pPackage->readCachedEntry("b")->getETag();
+			std::string sETagC = pPackage->readCachedEntry("c")->getETag();
+
+			assertTrue(sETagA == "\"" + AMCCommon::CUtils::calculateSHA256FromString("same content") + "\"");
+			assertTrue(sETagA == sETagB);
+			assertTrue(sETagA != sETagC);
+		}
+
+		void testCachedEntryGZIPRoundTrip()
+		{
+			CScopedTempDir tempDir;
+			std::string zipPath = joinPath(tempDir.m_sPath, "cached_gzip.zip");
+
+			auto entry = makeEntry("Script", "script.js", "js", "application/javascript", makeRepetitiveText(256));
+			std::vector<CPackageEntrySpec> entries = { entry };
+			std::string packageXML = buildPackageXML(m_sSchemaNamespace, entries);
+
+			writeZIPFile(zipPath, packageXML, entries, true);
+			auto pPackage = loadPackageFromZip(zipPath);
+
+			auto pCacheEntry = pPackage->readCachedEntry("script");
+			auto pGZIPData = pCacheEntry->getGZIPData();
+			assertAssigned((void*)pGZIPData, "Expected gzip variant for javascript entry");
+			assertTrue(pGZIPData->size() < entry.m_sData.size());
+			assertAssigned((void*)pCacheEntry->getDeflateData(), "Expected deflate variant for javascript entry");
+
+			std::vector<uint8_t> inflated(entry.m_sData.size() + 16);
+			z_stream stream;
+			std::memset(&stream, 0, sizeof(stream));
+			assertTrue(inflateInit2(&stream, 15 + 16) == Z_OK);
+			stream.next_in = (Bytef*)pGZIPData->data();
+			stream.avail_in = (uInt)pGZIPData->size();
+			stream.next_out = inflated.data();
+			stream.avail_out = (uInt)inflated.size();
+			int nResult = inflate(&stream, Z_FINISH);
+			size_t nInflatedSize = stream.total_out;
+			inflateEnd(&stream);
+
+			assertTrue(nResult == Z_STREAM_END);
+			assertTrue(nInflatedSize == entry.m_sData.size());
+			assertTrue(std::memcmp(inflated.data(), entry.m_sData.data(), nInflatedSize) == 0);
+		}
+
+		void testCachedEntryBinaryNotCompressed()
+		{
+			CScopedTempDir tempDir;
+			std::string zipPath = joinPath(tempDir.m_sPath, "cached_binary.zip");
+
+			auto entry = makeEntry("Image", "image.png", "png", "image/png", makeRepetitiveText(64));
+			std::vector<CPackageEntrySpec> entries = { entry };
+			std::string packageXML = buildPackageXML(m_sSchemaNamespace, entries);
+
+			writeZIPFile(zipPath, packageXML, entries, true);
+			auto pPackage = loadPackageFromZip(zipPath);
+
+			auto pCacheEntry = pPackage->readCachedEntry("image");
+			assertNull((void*)pCacheEntry->getGZIPData(), "Expected no gzip variant for png entry");
+			assertNull((void*)pCacheEntry->getDeflateData(), "Expected no deflate variant for png entry");
+		}
+
 		void testMissingPackageXMLThrows()
 		{
 			CScopedTempDir tempDir;
@@ -0,0 +1,126 @@
+/*++
+
+Copyright (C) 2025 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef __AMCTEST_UNITTEST_SERVERBYTERANGE
+#define __AMCTEST_UNITTEST_SERVERBYTERANGE
+
+
+#include "amc_unittests.hpp"
+#include "Implementation/Server/amc_server_byterange.hpp"
+
+#include <vector>
+
+namespace AMCUnitTest {
+
+	class CUnitTestGroup_ServerByteRange : public CUnitTestGroup {
+	public:
+
+		std::string getTestGroupName() override {
+			return "ServerByteRange";
+		}
+
+		void registerTests() override {
+			registerTest("SingleRanges", "Closed and open-ended ranges are clamped to the content", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_ServerByteRange::testSingleRanges, this));
+			registerTest("SuffixRanges", "Suffix ranges select the last bytes of the content", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_ServerByteRange::testSuffixRanges, this));
+			registerTest("InvalidRanges", "Unsatisfiable ranges are dropped", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_ServerByteRange::testInvalidRanges, this));
+			registerTest("OverlappingRanges", "Several ranges are served as their enclosing span", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_ServerByteRange::testOverlappingRanges, this));
+		}
+
+		void initializeTests() override {
+		}
+
+	private:
+
+		void assertRange(const std::vector<AMC::sServerRequestedByteRange>& requestedRanges, uint64_t nContentLength, uint64_t nOffset, uint64_t nLength, const std::string& sContentRange)
+		{
+			AMC::CServerByteRange byteRange(requestedRanges, nContentLength);
+			assertTrue(byteRange.isSatisfiable(), "Expected a satisfiable range: " + sContentRange);
+			assertTrue(byteRange.getOffset() == nOffset, "Invalid range offset: " + byteRange.getContentRangeHeader());
+			assertTrue(byteRange.getLength() == nLength, "Invalid range length: " + byteRange.getContentRangeHeader());
+			assertTrue(byteRange.getContentRangeHeader() == sContentRange, "Invalid content range: " + byteRange.getContentRangeHeader());
+		}
+
+		void assertUnsatisfiable(const std::vector<AMC::sServerRequestedByteRange>& requestedRanges, uint64_t nContentLength)
+		{
+			AMC::CServerByteRange byteRange(requestedRanges, nContentLength);
+			assertFalse(byteRange.isSatisfiable(), "Expected an unsatisfiable range: " + byteRange.getContentRangeHeader());
+			assertTrue(byteRange.getLength() == 0);
+			assertTrue(byteRange.getContentRangeHeader() == "bytes */" + std::to_string(nContentLength), "Invalid content range: " + byteRange.getContentRangeHeader());
+		}
+
+		void testSingleRanges()
+		{
+			assertRange({ { 0, 99 } }, 1000, 0, 100, "bytes 0-99/1000");
+			assertRange({ { 500, 500 } }, 1000, 500, 1, "bytes 500-500/1000");
+			assertRange({ { 0, -1 } }, 1000, 0, 1000, "bytes 0-999/1000");
+			assertRange({ { 900, -1 } }, 1000, 900, 100, "bytes 900-999/1000");
+			assertRange({ { 900, 5000 } }, 1000, 900, 100, "bytes 900-999/1000");
+			assertRange({ { 999, 999 } }, 1000, 999, 1, "bytes 999-999/1000");
+		}
+
+		void testSuffixRanges()
+		{
+			assertRange({ { -1, 100 } }, 1000, 900, 100, "bytes 900-999/1000");
+			assertRange({ { -1, 1 } }, 1000, 999, 1, "bytes 999-999/1000");
+			assertRange({ { -1, 1000 } }, 1000, 0, 1000, "bytes 0-999/1000");
+			assertRange({ { -1, 5000 } }, 1000, 0, 1000, "bytes 0-999/1000");
+		}
+
+		void testInvalidRanges()
+		{
+			assertUnsatisfiable({ }, 1000);
+			assertUnsatisfiable({ { 1000, 1999 } }, 1000);
+			assertUnsatisfiable({ { 1000, -1 } }, 1000);
+			assertUnsatisfiable({ { 200, 100 } }, 1000);
+			assertUnsatisfiable({ { -1, 0 } }, 1000);
+			assertUnsatisfiable({ { 0, 99 } }, 0);
+			assertUnsatisfiable({ { -1, 100 } }, 0);
+			assertUnsatisfiable({ { 1000, 1999 }, { 2000, -1 } }, 1000);
+
+			// Unsatisfiable ranges are dropped from a request that contains satisfiable ones
+			assertRange({ { 2000, 2999 }, { 10, 19 } }, 1000, 10, 10, "bytes 10-19/1000");
+		}
+
+		void testOverlappingRanges()
+		{
+			assertRange({ { 0, 49 }, { 25, 74 } }, 1000, 0, 75, "bytes 0-74/1000");
+			assertRange({ { 25, 74 }, { 0, 49 } }, 1000, 0, 75, "bytes 0-74/1000");
+			assertRange({ { 10, 19 }, { 12, 15 } }, 1000, 10, 10, "bytes 10-19/1000");
+			assertRange({ { 0, 9 }, { 10, 19 } }, 1000, 0, 20, "bytes 0-19/1000");
+			assertRange({ { 0, 9 }, { 90, 99 } }, 1000, 0, 100, "bytes 0-99/1000");
+			assertRange({ { 0, 9 }, { -1, 10 } }, 1000, 0, 1000, "bytes 0-999/1000");
+			assertRange({ { 950, -1 }, { -1, 100 } }, 1000, 900, 100, "bytes 900-999/1000");
+		}
+
+	};
+
+}
+
+#endif //__AMCTEST_UNITTEST_SERVERBYTERANGE
@@ -165,6 +165,8 @@ public:
         registerTest("ParameterResultAccess", "Tests getting parameter and result JSON", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_SignalSlot::test_ParameterResultAccess, this));
         registerTest("ClearQueueWorks", "Clears the queue and marks signals as cleared", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_SignalSlot::test_ClearQueueWorks, this));
         registerTest("TimeoutAndOverflowTest", "Simulates queue overflow and timeout scenarios", eUnitTestCategory::utOptionalPass, std::bind(&CUnitTestGroup_SignalSlot::test_TimeoutAndOverflowTest, this));
+        registerTest("WaitForQueuedMessage", "Waiting for a queued message wakes up when a signal is added", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_SignalSlot::test_WaitForQueuedMessage, this));
+        registerTest("WaitForTerminalPhase", "Waiting for a message wakes up when the signal is handled", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_SignalSlot::test_WaitForTerminalPhase, this));
     }
 
 private:
@@ -345,6 +347,64 @@ private:
         assertTrue(rejected.size() == total - capacity);
         assertTrue(timedOut > 0);
     }
+
+    void test_WaitForQueuedMessage() {
+
+        CDummyRegistry registry;
+
+        AMC::CStateSignalSlot slot("instance", "signal", {}, {}, 5000, 5000, 4, nullptr, &registry);
+
+        // Empty queue times out
+        assertFalse(slot.waitForQueuedMessageInternal(10000));
+
+        AMCCommon::CChrono chrono;
+        uint64_t nStartTime = chrono.getElapsedMicroseconds();
+
+        std::thread producer([&slot, &chrono]() {
+            chrono.sleepMilliseconds(20);
+            slot.addNewInQueueSignalInternal("a0000001-0000-0000-0000-000000000001", "{}", 5000, chrono.getElapsedMicroseconds());
+        });
+
+        bool bHasMessage = slot.waitForQueuedMessageInternal(5000000);
+        uint64_t nWaitTime = chrono.getElapsedMicroseconds() - nStartTime;
+        producer.join();
+
+        assertTrue(bHasMessage);
+        assertTrue(nWaitTime < 2000000);
+    }
+
+    void test_WaitForTerminalPhase() {
+
+        CDummyRegistry registry;
+
+        AMC::CStateSignalSlot slot("instance", "signal", {}, {}, 5000, 5000, 4, nullptr, &registry);
+        std::string uuid = "b0000001-0000-0000-0000-000000000001";
+
+        AMCCommon::CChrono chrono;
+        auto pMessage = slot.addNewInQueueSignalInternal(uuid, "{}", 5000, chrono.getElapsedMicroseconds());
+        assertTrue(pMessage != nullptr);
+
+        // Queued message is not terminal yet
+        assertFalse(slot.waitForTerminalPhaseInternal(uuid, 10000));
+
+        uint64_t nStartTime = chrono.getElapsedMicroseconds();
+
+        std::thread handler([&slot, &chrono, uuid]() {
+            chrono.sleepMilliseconds(20);
+            slot.changeSignalPhaseToHandledInternal(uuid, "{}", chrono.getElapsedMicroseconds());
+        });
+
+        bool bIsTerminal = slot.waitForTerminalPhaseInternal(uuid, 5000000);
+        uint64_t nWaitTime = chrono.getElapsedMicroseconds() - nStartTime;
+        handler.join();
+
+        assertTrue(bIsTerminal);
+        assertTrue(nWaitTime < 2000000);
+        assertTrue(slot.getSignalPhaseInternal(uuid) == AMC::eAMCSignalPhase::Handled);
+
+        // Unknown messages do not block
+        assertTrue(slot.waitForTerminalPhaseInternal("b0000002-0000-0000-0000-000000000002", 5000000));
+    }
 };
 
 
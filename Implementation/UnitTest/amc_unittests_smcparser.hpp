@@ -0,0 +1,299 @@
+/*++
+
+Copyright (C) 2025 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef __AMCTEST_UNITTEST_SMCPARSER
+#define __AMCTEST_UNITTEST_SMCPARSER
+
+#include "amc_unittests.hpp"
+#include "common_utils.hpp"
+
+#include "libmcdriver_scanlabsmc_smccsvparser.hpp"
+#include "libmcdriver_scanlabsmc_smcsimulationparser.hpp"
+#include "libmcdriver_scanlabsmc_smcparserworkerpool.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <set>
+#include <atomic>
+#include <fstream>
+#include <stdexcept>
+
+namespace AMCUnitTest {
+
+	using namespace LibMCDriver_ScanLabSMC::Impl;
+
+	// The expected values below were produced by the line based parsers that CSMCCSVParser and
+	// CSMCSimulationParser replaced, so the tests pin the output of the chunked parsers to them.
+	class CUnitTestGroup_SMCParser : public CUnitTestGroup {
+	public:
+		CUnitTestGroup_SMCParser() = default;
+		virtual ~CUnitTestGroup_SMCParser() = default;
+
+		std::string getTestGroupName() override {
+			return "SMCParser";
+		}
+
+		void registerTests() override {
+			registerTest("SimulationCSVMatchesLegacyParser", "Parses an SMC 1.x simulation CSV like the legacy parser", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_SMCParser::test_SimulationCSVMatchesLegacyParser, this));
+			registerTest("LogRecordCSVMatchesLegacyParser", "Parses an SMC log record CSV like the legacy parser", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_SMCParser::test_LogRecordCSVMatchesLegacyParser, this));
+			registerTest("SimulationFileMatchesLegacyParser", "Parses an SMC 0.8/0.9 simulation file like the legacy parser", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_SMCParser::test_SimulationFileMatchesLegacyParser, this));
+			registerTest("MultiChunkThreadCount", "Parses files of several chunks with one and with four threads to the same result", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_SMCParser::test_MultiChunkThreadCount, this));
+			registerTest("WorkerPool", "Reuses the parser worker threads and rethrows worker exceptions", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_SMCParser::test_WorkerPool, this));
+		}
+
+		void initializeTests() override {
+		}
+
+	private:
+
+		std::string writeFixture(const std::string& sExtension, const std::string& sContent) {
+			std::string sRootPath = "testoutput";
+			if (!AMCCommon::CUtils::fileOrPathExistsOnDisk(sRootPath))
+				AMCCommon::CUtils::createDirectoryOnDisk(sRootPath);
+
+			std::string sFileName = sRootPath + "/smcparser_" + AMCCommon::CUtils::createUUID() + "." + sExtension;
+			std::ofstream stream(sFileName, std::ios::binary);
+			stream.write(sContent.data(), sContent.size());
+			return sFileName;
+		}
+
+		// Simulation CSV of SMC 1.x, with a comment line, CRLF line breaks, leading blanks,
+		// laser signals with and without sub-cycles, and no line break at the end.
+		std::string getSimulationCSVFixture() {
+			return
+				"# DisplacedX;DisplacedY;LaserSignal;LaserToggle;ActiveChannel0;ActiveChannel1;CommandCount;TriggerSignal;Unused;Timestamp\n"
+				"+0.000;+0.000;0;0;+0.0;+0.0;0;0;0;0\n"
+				"+1.250;-0.500;1_1_+2.5_+5.0;1;+35.5;+1.0;1;0;0;10\n"
+				"+2.500;-1.000;1_0_+3.0;1;+36.0;+1.0;2;0;0;20\r\n"
+				" +3.750; -1.500;0;0;+0.0;+0.0;3;0;0;30\r\n"
+				"+5.000;-2.000;1_1_+1.0_+4.0_+7.5;1;+40.25;+1.0;4;0;0;40\n"
+				"+6.250;-2.500;1_1;1;+41.0;+1.0;5;0;0;50\n"
+				"+7.500;-3.000;0;0;+0.0;+0.0;6;0;0;60";
+		}
+
+		// Simulation output of SMC 0.8/0.9 with one scan device. The laser on delay of the second line
+		// moves its entry behind the fourth line, so the entries need to be sorted.
+		std::string getSimulationFileFixture() {
+			return
+				"<!--Simulation output Version=\"0.9\" ScanDevices=\"1\" Stage=\"None\" Unit=\"mm\"-->\n"
+				"+0.000;+0.000;0;0;0;0.0;0.0;0\n"
+				"+1.000;+0.500;1;25.0;0;1;1.0;0.0;1\n"
+				"+2.000;+1.000;0;1;3.5;1;1.0;0.0;2\n"
+				"+3.000;+1.500;2;2.0;4.0;1;6.0;1;1.0;1.0;3\n"
+				"-4.000;+2.000;0;0;0;0.0;0.0;4\n";
+		}
+
+		// Bindings of CSMCJobInstance::ReadSimulationFile_SMC_v1_0
+		std::vector<CSMCCSVParser::FieldBinding> getSimulationCSVBindings() {
+			uint8_t nExtendAndInterpolate = CSMCCSVParser::FieldProcessingStep::Extend | CSMCCSVParser::FieldProcessingStep::Interpolate;
+			return {
+				{{CSMCCSVParser::FieldParserType::Double, nExtendAndInterpolate}, "x"},
+				{{CSMCCSVParser::FieldParserType::Double, nExtendAndInterpolate}, "y"},
+				{{CSMCCSVParser::FieldParserType::LaserSignal, CSMCCSVParser::FieldProcessingStep::Nop}, "laseron"},
+				{{CSMCCSVParser::FieldParserType::None, CSMCCSVParser::FieldProcessingStep::Nop}, ""},
+				{{CSMCCSVParser::FieldParserType::Double, nExtendAndInterpolate}, "power"},
+				{{CSMCCSVParser::FieldParserType::Double, nExtendAndInterpolate}, "active1"},
+				{{CSMCCSVParser::FieldParserType::None, CSMCCSVParser::FieldProcessingStep::Nop}, ""},
+				{{CSMCCSVParser::FieldParserType::None, CSMCCSVParser::FieldProcessingStep::Nop}, ""},
+				{{CSMCCSVParser::FieldParserType::None, CSMCCSVParser::FieldProcessingStep::Nop}, ""},
+				{{CSMCCSVParser::FieldParserType::Timestamp, CSMCCSVParser::FieldProcessingStep::Nop}, "timestamp"}
+			};
+		}
+
+		// Bindings of CSMCJobInstance::ReadLogRecordFile
+		std::vector<CSMCCSVParser::FieldBinding> getLogRecordBindings() {
+			uint8_t nExtendAndInterpolate = CSMCCSVParser::FieldProcessingStep::Extend | CSMCCSVParser::FieldProcessingStep::Interpolate;
+			return {
+				{{CSMCCSVParser::FieldParserType::Double, nExtendAndInterpolate}, "x"},
+				{{CSMCCSVParser::FieldParserType::Double, nExtendAndInterpolate}, "y"},
+				{{CSMCCSVParser::FieldParserType::LaserSignal, CSMCCSVParser::FieldProcessingStep::Nop}, "laseron"},
+				{{CSMCCSVParser::FieldParserType::Timestamp, CSMCCSVParser::FieldProcessingStep::Nop}, "timestamp"}
+			};
+		}
+
+		template<typename T>
+		void assertValues(const std::vector<T>& values, const std::vector<T>& expectedValues, const std::string& sContext) {
+			assertIntegerRange((int64_t)values.size(), (int64_t)expectedValues.size(), (int64_t)expectedValues.size(), sContext + ": value count");
+			for (size_t nIndex = 0; nIndex < expectedValues.size(); nIndex++)
+				assertTrue(values[nIndex] == expectedValues[nIndex], sContext + ": value " + std::to_string(nIndex) + " is " + std::to_string(values[nIndex]) + " instead of " + std::to_string(expectedValues[nIndex]));
+		}
+
+		void assertLegacyCSVPositions(CSMCCSVParser& parser, const std::string& sContext) {
+			assertValues<double>(parser.GetTimestamps(), { 0, 10, 12.5, 15, 20, 23, 30, 40, 41, 44, 47.5, 50, 60 }, sContext + " timestamp");
+			assertValues<double>(parser.GetDoubleColumnValues("x"), { 0, 1.25, 1.5625, 1.875, 2.5, 2.875, 3.75, 5, 5.125, 5.5, 5.9375, 6.25, 7.5 }, sContext + " x");
+			assertValues<double>(parser.GetDoubleColumnValues("y"), { 0, -0.5, -0.625, -0.75, -1, -1.1499999999999999, -1.5, -2, -2.0499999999999998, -2.2000000000000002, -2.375, -2.5, -3 }, sContext + " y");
+			assertValues<uint32_t>(parser.GetUint32ColumnValues("laseron"), { 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0 }, sContext + " laseron");
+		}
+
+		void test_SimulationCSVMatchesLegacyParser() {
+			std::string sFileName = writeFixture("csv", getSimulationCSVFixture());
+
+			for (uint32_t nThreadCount : { 1, 4 }) {
+				auto pWorkerPool = std::make_shared<CSMCParserWorkerPool>(nThreadCount);
+				CSMCCSVParser parser(sFileName, ';', pWorkerPool);
+				parser.Parse(getSimulationCSVBindings());
+
+				std::string sContext = "simulation csv with " + std::to_string(nThreadCount) + " threads";
+				assertIntegerRange((int64_t)parser.GetTimestampCount(), 13, 13, sContext + ": timestamp count");
+				assertLegacyCSVPositions(parser, sContext);
+				assertValues<double>(parser.GetDoubleColumnValues("power"), { 0, 35.5, 35.625, 35.75, 36, 25.200000000000003, 0, 40.25, 40.325000000000003, 40.549999999999997, 40.8125, 41, 0 }, sContext + " power");
+				assertValues<double>(parser.GetDoubleColumnValues("active1"), { 0, 1, 1, 1, 1, 0.69999999999999996, 0, 1, 1, 1, 1, 1, 0 }, sContext + " active1");
+			}
+		}
+
+		void test_LogRecordCSVMatchesLegacyParser() {
+			std::string sFileName = writeFixture("csv", getSimulationCSVFixture());
+
+			auto pWorkerPool = std::make_shared<CSMCParserWorkerPool>(1);
+			CSMCCSVParser parser(sFileName, ';', pWorkerPool);
+			parser.Parse(getLogRecordBindings());
+
+			assertLegacyCSVPositions(parser, "log record");
+		}
+
+		void test_SimulationFileMatchesLegacyParser() {
+			std::string sFileName = writeFixture("txt", getSimulationFileFixture());
+
+			for (uint32_t nThreadCount : { 1, 4 }) {
+				auto pWorkerPool = std::make_shared<CSMCParserWorkerPool>(nThreadCount);
+				CSMCSimulationParser parser(sFileName, pWorkerPool);
+
+				std::string sContext = "simulation file with " + std::to_string(nThreadCount) + " threads";
+				auto& columns = parser.getColumns();
+				assertIntegerRange((int64_t)parser.getCount(), 7, 7, sContext + ": entry count");
+
+				// The legacy parser only returned timestamps and positions
+				assertValues<double>(columns.m_Timestamps, { 10, 33.5, 42, 44, 45, 46, 50 }, sContext + " timestamp");
+				assertValues<double>(columns.m_XValues, { 0, 2, 3, 3, 1, 3, -4 }, sContext + " x");
+				assertValues<double>(columns.m_YValues, { 0, 1, 1.5, 1.5, 0.5, 1.5, 2 }, sContext + " y");
+
+				assertValues<int32_t>(columns.m_LaserToggleValues, { 0, 1, 1, 1, 1, 1, 0 }, sContext + " laseron");
+				assertValues<double>(columns.m_ActiveChannel1Values, { 0, 1, 1, 1, 1, 1, 0 }, sContext + " active1");
+				assertValues<double>(columns.m_ActiveChannel2Values, { 0, 0, 1, 1, 0, 1, 0 }, sContext + " active2");
+				assertValues<int32_t>(columns.m_CommandIndexValues, { 0, 2, 3, 3, 1, 3, 4 }, sContext + " cmdindex");
+			}
+		}
+
+		void test_MultiChunkThreadCount() {
+			// Repeats the fixture lines until the files span several parser chunks
+			std::string sSimulationCSV;
+			std::string sSimulationFile = "<!--Simulation output Version=\"0.9\" ScanDevices=\"1\" Stage=\"None\" Unit=\"mm\"-->\n";
+			size_t nLineIndex = 0;
+			while (sSimulationCSV.size() < 3 * CSMCCSVParser::ChunkSize) {
+				std::string sX = std::to_string((double)(nLineIndex % 1000) * 0.125);
+				std::string sCommand = std::to_string(nLineIndex);
+				if (nLineIndex % 5 == 0)
+					sSimulationCSV += "+" + sX + ";-1.5;1_1_+2.5_+5.0;1;+35.5;+1.0;" + sCommand + ";0;0;0\n";
+				else
+					sSimulationCSV += "+" + sX + ";-1.5;0;0;+0.0;+0.0;" + sCommand + ";0;0;0\n";
+
+				if (nLineIndex % 7 == 0)
+					sSimulationFile += "+" + sX + ";+0.5;1;25.0;0;1;1.0;0.0;" + sCommand + "\n";
+				else
+					sSimulationFile += "+" + sX + ";+0.5;0;0;0;0.0;0.0;" + sCommand + "\n";
+				nLineIndex++;
+			}
+
+			std::string sCSVFileName = writeFixture("csv", sSimulationCSV);
+			std::string sSimulationFileName = writeFixture("txt", sSimulationFile);
+
+			auto pSingleThreadPool = std::make_shared<CSMCParserWorkerPool>(1);
+			auto pMultiThreadPool = std::make_shared<CSMCParserWorkerPool>(4);
+
+			CSMCCSVParser singleThreadCSVParser(sCSVFileName, ';', pSingleThreadPool);
+			singleThreadCSVParser.Parse(getSimulationCSVBindings());
+			CSMCCSVParser multiThreadCSVParser(sCSVFileName, ';', pMultiThreadPool);
+			multiThreadCSVParser.Parse(getSimulationCSVBindings());
+
+			assertIntegerRange((int64_t)singleThreadCSVParser.GetTimestampCount(), (int64_t)nLineIndex, INT64_MAX, "csv must have an entry per line");
+			assertTrue(singleThreadCSVParser.GetTimestamps() == multiThreadCSVParser.GetTimestamps(), "csv timestamps must not depend on the thread count");
+			for (std::string sColumn : { "x", "y", "power", "active1" })
+				assertTrue(singleThreadCSVParser.GetDoubleColumnValues(sColumn) == multiThreadCSVParser.GetDoubleColumnValues(sColumn), "csv column " + sColumn + " must not depend on the thread count");
+			assertTrue(singleThreadCSVParser.GetUint32ColumnValues("laseron") == multiThreadCSVParser.GetUint32ColumnValues("laseron"), "csv laser signal must not depend on the thread count");
+
+			CSMCSimulationParser singleThreadSimulationParser(sSimulationFileName, pSingleThreadPool);
+			CSMCSimulationParser multiThreadSimulationParser(sSimulationFileName, pMultiThreadPool);
+			auto& singleThreadColumns = singleThreadSimulationParser.getColumns();
+			auto& multiThreadColumns = multiThreadSimulationParser.getColumns();
+
+			assertIntegerRange((int64_t)singleThreadSimulationParser.getCount(), (int64_t)nLineIndex, (int64_t)nLineIndex, "simulation file must have an entry per line");
+			assertTrue(singleThreadColumns.m_Timestamps == multiThreadColumns.m_Timestamps, "simulation timestamps must not depend on the thread count");
+			assertTrue(singleThreadColumns.m_XValues == multiThreadColumns.m_XValues, "simulation x values must not depend on the thread count");
+			assertTrue(singleThreadColumns.m_YValues == multiThreadColumns.m_YValues, "simulation y values must not depend on the thread count");
+			assertTrue(singleThreadColumns.m_CommandIndexValues == multiThreadColumns.m_CommandIndexValues, "simulation command indices must not depend on the thread count");
+		}
+
+		void test_WorkerPool() {
+			CSMCParserWorkerPool workerPool(4);
+			assertIntegerRange(workerPool.getThreadCount(), 4, 4, "worker pool must report its thread count");
+
+			for (uint32_t nRun = 0; nRun < 50; nRun++) {
+				std::vector<std::atomic<uint32_t>> callCounts(37);
+				workerPool.processInParallel(callCounts.size(), [&callCounts](size_t nIndex) {
+					callCounts.at(nIndex)++;
+				});
+
+				for (auto& nCallCount : callCounts)
+					assertIntegerRange(nCallCount.load(), 1, 1, "every index must be processed exactly once");
+			}
+
+			bool bCaughtException = false;
+			try {
+				workerPool.processInParallel(16, [](size_t nIndex) {
+					if (nIndex == 11)
+						throw std::runtime_error("chunk failed");
+				});
+			}
+			catch (std::runtime_error&) {
+				bCaughtException = true;
+			}
+			assertTrue(bCaughtException, "worker exceptions must be rethrown on the calling thread");
+
+			// The pool stays usable after an exception
+			std::atomic<uint32_t> nCallCount(0);
+			workerPool.processInParallel(8, [&nCallCount](size_t nIndex) { nCallCount++; });
+			assertIntegerRange(nCallCount.load(), 8, 8, "pool must process work after an exception");
+
+			bool bRejectedThreadCount = false;
+			try {
+				CSMCParserWorkerPool invalidPool(0);
+			}
+			catch (std::exception&) {
+				bRejectedThreadCount = true;
+			}
+			assertTrue(bRejectedThreadCount, "a thread count of 0 must be rejected");
+		}
+
+	};
+
+}
+
+#endif // __AMCTEST_UNITTEST_SMCPARSER
@@ -0,0 +1,255 @@
+/*++
+
+Copyright (C) 2025 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef __AMCTEST_UNITTEST_SQLHANDLER
+#define __AMCTEST_UNITTEST_SQLHANDLER
+
+#include "amc_unittests.hpp"
+#include "amcdata_sqlhandler_sqlite.hpp"
+#include "amcdata_sqlstatement_sqlite.hpp"
+#include "common_utils.hpp"
+
+#include <memory>
+#include <string>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <vector>
+
+namespace AMCUnitTest {
+
+	class CUnitTestGroup_SQLHandler : public CUnitTestGroup {
+	public:
+		CUnitTestGroup_SQLHandler() = default;
+		virtual ~CUnitTestGroup_SQLHandler() = default;
+
+		std::string getTestGroupName() override {
+			return "SQLHandler";
+		}
+
+		void registerTests() override {
+			registerTest("NestedReadStatements", "Prepares nested read statements on a single read connection without deadlocking", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_SQLHandler::test_NestedReadStatements, this));
+			registerTest("ConcurrentReadStatements", "Waits for a read connection that is held by another thread", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_SQLHandler::test_ConcurrentReadStatements, this));
+			registerTest("StatementCache", "Reuses reset prepared statements and bounds the cache size", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_SQLHandler::test_StatementCache, this));
+			registerTest("ReadThroughputBenchmark", "Compares read throughput of the write connection and the read pool while a writer is active", eUnitTestCategory::utOptionalPass, std::bind(&CUnitTestGroup_SQLHandler::test_ReadThroughputBenchmark, this));
+		}
+
+		void initializeTests() override {
+		}
+
+	private:
+
+		std::string createDatabaseFileName() {
+			std::string sRootPath = "testoutput";
+			if (!AMCCommon::CUtils::fileOrPathExistsOnDisk(sRootPath))
+				AMCCommon::CUtils::createDirectoryOnDisk(sRootPath);
+
+			return sRootPath + "/sqlhandler_" + AMCCommon::CUtils::createUUID() + ".db";
+		}
+
+		// Creates a table with the entries (1, 10), (2, 20), ... (nEntryCount, nEntryCount * 10)
+		void createEntries(AMCData::CSQLHandler_SQLite& sqlHandler, int32_t nEntryCount) {
+			sqlHandler.prepareStatement("CREATE TABLE entries (id INTEGER PRIMARY KEY, value INTEGER)")->execute();
+			for (int32_t nID = 1; nID <= nEntryCount; nID++) {
+				auto pStatement = sqlHandler.prepareStatement("INSERT INTO entries (id, value) VALUES (?, ?)");
+				pStatement->setInt(1, nID);
+				pStatement->setInt(2, nID * 10);
+				pStatement->execute();
+			}
+		}
+
+		AMCData::sSQLiteConfiguration createSingleReaderConfiguration() {
+			auto configuration = AMCData::CSQLHandler_SQLite::getConcurrentConfiguration();
+			configuration.m_nReadConnectionCount = 1;
+			configuration.m_nMMapSizeInBytes = 0;
+			return configuration;
+		}
+
+		void test_NestedReadStatements() {
+			AMCData::CSQLHandler_SQLite sqlHandler(createDatabaseFileName(), createSingleReaderConfiguration());
+			assertIntegerRange(sqlHandler.getReadConnectionCount(), 1, 1, "Handler must have one read connection");
+			createEntries(sqlHandler, 3);
+
+			// Both statements are prepared before the first one is executed, so the connection is still held.
+			auto pOuterStatement = sqlHandler.prepareReadStatement("SELECT id FROM entries ORDER BY id");
+			auto pCountStatement = sqlHandler.prepareReadStatement("SELECT COUNT(*) FROM entries");
+			assertTrue(pCountStatement->nextRow(), "Nested statement must return a row");
+			assertIntegerRange(pCountStatement->getColumnInt(1), 3, 3, "Nested statement must count all entries");
+
+			// Inner lookups while the outer statement is stepping, like FindJobOfData calling RetrieveJob.
+			int32_t nRowCount = 0;
+			while (pOuterStatement->nextRow()) {
+				int32_t nID = pOuterStatement->getColumnInt(1);
+				auto pInnerStatement = sqlHandler.prepareReadStatement("SELECT value FROM entries WHERE id=?");
+				pInnerStatement->setInt(1, nID);
+				assertTrue(pInnerStatement->nextRow(), "Inner statement must find the entry");
+				assertIntegerRange(pInnerStatement->getColumnInt(1), nID * 10, nID * 10, "Inner statement must read the value of the outer row");
+				nRowCount++;
+			}
+			assertIntegerRange(nRowCount, 3, 3, "Outer statement must return all entries");
+		}
+
+		void test_ConcurrentReadStatements() {
+			AMCData::CSQLHandler_SQLite sqlHandler(createDatabaseFileName(), createSingleReaderConfiguration());
+			createEntries(sqlHandler, 2);
+
+			// The only read connection is held until the statement is executed.
+			auto pStatement = sqlHandler.prepareReadStatement("SELECT value FROM entries WHERE id=1");
+
+			int32_t nOtherValue = 0;
+			std::thread otherThread([&sqlHandler, &nOtherValue]() {
+				auto pOtherStatement = sqlHandler.prepareReadStatement("SELECT value FROM entries WHERE id=2");
+				if (pOtherStatement->nextRow())
+					nOtherValue = pOtherStatement->getColumnInt(1);
+			});
+
+			assertTrue(pStatement->nextRow(), "Statement must return a row");
+			assertIntegerRange(pStatement->getColumnInt(1), 10, 10, "Statement must read its value");
+
+			otherThread.join();
+			assertIntegerRange(nOtherValue, 20, 20, "Waiting thread must read its value after the connection was released");
+		}
+
+		void test_StatementCache() {
+			auto configuration = AMCData::CSQLHandler_SQLite::getDefaultConfiguration();
+			configuration.m_nStatementCacheSize = 1;
+
+			AMCData::CSQLHandler_SQLite sqlHandler(createDatabaseFileName(), configuration);
+			createEntries(sqlHandler, 2);
+
+			auto pConnection = sqlHandler.getWriteConnection();
+			pConnection->clearStatementCache();
+
+			std::string sQuery = "SELECT value FROM entries WHERE id=?";
+			{
+				auto pStatement = sqlHandler.prepareStatement(sQuery);
+				pStatement->setInt(1, 1);
+				assertTrue(pStatement->nextRow(), "First query must return a row");
+				assertIntegerRange(pStatement->getColumnInt(1), 10, 10, "First query must read its value");
+			}
+			assertIntegerRange(pConnection->getCachedStatementCount(), 1, 1, "Released statement must be cached");
+
+			{
+				// The cached statement must come back reset, with its bindings cleared
+				auto pStatement = sqlHandler.prepareStatement(sQuery);
+				assertIntegerRange(pConnection->getCachedStatementCount(), 0, 0, "Cached statement must be reused");
+				pStatement->setInt(1, 2);
+				assertTrue(pStatement->nextRow(), "Reused statement must return a row");
+				assertIntegerRange(pStatement->getColumnInt(1), 20, 20, "Reused statement must read the new binding");
+				assertFalse(pStatement->nextRow(), "Reused statement must return one row");
+			}
+
+			{
+				// Two statements with the same SQL are in use at the same time, only one fits into the cache.
+				// The write connection is held until a statement is executed, so step the first one before preparing the second.
+				auto pStatement1 = sqlHandler.prepareStatement(sQuery);
+				pStatement1->setInt(1, 1);
+				assertTrue(pStatement1->nextRow(), "First parallel statement must return a row");
+
+				auto pStatement2 = sqlHandler.prepareStatement(sQuery);
+				pStatement2->setInt(1, 2);
+				assertTrue(pStatement2->nextRow(), "Second parallel statement must return a row");
+
+				assertIntegerRange(pStatement1->getColumnInt(1), 10, 10, "Parallel statements must not share a handle");
+				assertIntegerRange(pStatement2->getColumnInt(1), 20, 20, "Parallel statements must not share a handle");
+			}
+			assertIntegerRange(pConnection->getCachedStatementCount(), 1, 1, "Cache must be bounded by its size");
+
+			pConnection->clearStatementCache();
+			assertIntegerRange(pConnection->getCachedStatementCount(), 0, 0, "Cleared cache must be empty");
+		}
+
+		// Runs nReaderCount reader threads against a concurrent writer and returns the reads per second
+		double measureReadThroughput(AMCData::CSQLHandler_SQLite& sqlHandler, bool bUseReadPool, uint32_t nReaderCount, uint32_t nReadsPerReader, int32_t nEntryCount) {
+			std::atomic<bool> bStopWriter(false);
+			std::atomic<uint32_t> nFailedReads(0);
+
+			std::thread writerThread([&sqlHandler, &bStopWriter, nEntryCount]() {
+				int32_t nWriteIndex = 0;
+				while (!bStopWriter) {
+					auto pStatement = sqlHandler.prepareStatement("UPDATE entries SET value=? WHERE id=?");
+					pStatement->setInt(1, nWriteIndex);
+					pStatement->setInt(2, (nWriteIndex % nEntryCount) + 1);
+					pStatement->execute();
+					nWriteIndex++;
+				}
+			});
+
+			auto startTime = std::chrono::steady_clock::now();
+
+			std::vector<std::thread> readerThreads;
+			for (uint32_t nReaderIndex = 0; nReaderIndex < nReaderCount; nReaderIndex++) {
+				readerThreads.push_back(std::thread([&sqlHandler, &nFailedReads, bUseReadPool, nReadsPerReader, nEntryCount, nReaderIndex]() {
+					for (uint32_t nReadIndex = 0; nReadIndex < nReadsPerReader; nReadIndex++) {
+						std::string sQuery = "SELECT value FROM entries WHERE id=?";
+						auto pStatement = bUseReadPool ? sqlHandler.prepareReadStatement(sQuery) : sqlHandler.prepareStatement(sQuery);
+						pStatement->setInt(1, ((nReadIndex + nReaderIndex) % nEntryCount) + 1);
+						if (!pStatement->nextRow())
+							nFailedReads++;
+					}
+				}));
+			}
+
+			for (auto& readerThread : readerThreads)
+				readerThread.join();
+
+			auto endTime = std::chrono::steady_clock::now();
+			bStopWriter = true;
+			writerThread.join();
+
+			assertIntegerRange(nFailedReads, 0, 0, "All reads must find their entry");
+
+			double dDurationInSeconds = std::chrono::duration<double>(endTime - startTime).count();
+			if (dDurationInSeconds <= 0.0)
+				dDurationInSeconds = 1.0e-6;
+
+			return (double)(nReaderCount * nReadsPerReader) / dDurationInSeconds;
+		}
+
+		void test_ReadThroughputBenchmark() {
+			const uint32_t nReaderCount = 4;
+			const uint32_t nReadsPerReader = 5000;
+			const int32_t nEntryCount = 100;
+
+			AMCData::CSQLHandler_SQLite sqlHandler(createDatabaseFileName(), AMCData::CSQLHandler_SQLite::getConcurrentConfiguration());
+			createEntries(sqlHandler, nEntryCount);
+
+			double dWriteConnectionReads = measureReadThroughput(sqlHandler, false, nReaderCount, nReadsPerReader, nEntryCount);
+			double dReadPoolReads = measureReadThroughput(sqlHandler, true, nReaderCount, nReadsPerReader, nEntryCount);
+
+			logInfo("Write connection: " + std::to_string((uint64_t)dWriteConnectionReads) + " reads/s");
+			logInfo("Read pool x" + std::to_string(sqlHandler.getReadConnectionCount()) + ": " + std::to_string((uint64_t)dReadPoolReads) + " reads/s");
+		}
+
+	};
+
+}
+
+#endif //__AMCTEST_UNITTEST_SQLHANDLER
@@ -42,6 +42,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <memory>
 #include <string>
+#include <thread>
+#include <atomic>
 
 namespace AMCUnitTest {
 
@@ -58,6 +60,13 @@ namespace AMCUnitTest {
 			registerTest("BasicRecordAndSample", "Records bool/int/double values and samples them by timestamp", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_StateJournal::test_BasicRecordAndSample, this));
 			registerTest("AliasAndStringErrors", "Uses aliases for sampling and rejects non-numeric variables", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_StateJournal::test_AliasAndStringErrors, this));
 			registerTest("LifecycleErrors", "Validates state journal lifecycle errors", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_StateJournal::test_LifecycleErrors, this));
+			registerTest("DynamicChunkColumns", "Writes columnar chunk data, samples it and serializes it into an in memory chunk", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_StateJournal::test_DynamicChunkColumns, this));
+			registerTest("ChunkQueue", "Hands chunks over through the single producer single consumer queue", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_StateJournal::test_ChunkQueue, this));
+			registerTest("ChunkQueueOverflow", "Keeps writing when the recording thread falls behind and records the overflowed chunks in order", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_StateJournal::test_ChunkQueueOverflow, this));
+			registerTest("ChunkSummaries", "Computes interval summaries and raw entries of dynamic and in memory chunks", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_StateJournal::test_ChunkSummaries, this));
+			registerTest("OnDiskChunkSummaries", "Answers fully covered on disk chunks from the sealed summary without loading the chunk", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_StateJournal::test_OnDiskChunkSummaries, this));
+			registerTest("ConcurrentUpdates", "Updates variables from several threads while sampling the current chunk", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_StateJournal::test_ConcurrentUpdates, this));
+			registerTest("IntervalQueries", "Computes statistics, raw time streams and batched samples of a recording journal", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_StateJournal::test_IntervalQueries, this));
 		}
 
 		void initializeTests() override {
@@ -212,6 +221,355 @@ namespace AMCUnitTest {
 			assertTrue(bThrewOnUpdateAfterFinish, "Updating after finishRecording must throw");
 		}
 
+		void test_DynamicChunkColumns() {
+			AMC::CStateJournalStreamChunk_Dynamic dynamicChunk(3, 3000, 3999, 2, nullptr);
+
+			dynamicChunk.writeEntry(0, 3000, 10);
+			dynamicChunk.writeEntry(1, 3000, -5);
+			dynamicChunk.writeEntry(0, 3100, 20);
+			dynamicChunk.writeEntry(0, 3100, 25);
+			dynamicChunk.writeEntry(1, 3500, 7);
+			dynamicChunk.writeEntry(0, 3900, 30);
+
+			assertIntegerRange((int64_t)dynamicChunk.getEntryCount(), 5, 5, "Overwriting the last timestamp must not append an entry");
+
+			assertIntegerRange(dynamicChunk.sampleIntegerData(0, 3000), 10, 10, "Sample at chunk start");
+			assertIntegerRange(dynamicChunk.sampleIntegerData(0, 3099), 10, 10, "Sample before second entry");
+			assertIntegerRange(dynamicChunk.sampleIntegerData(0, 3100), 25, 25, "Sample at overwritten entry");
+			assertIntegerRange(dynamicChunk.sampleIntegerData(0, 3999), 30, 30, "Sample after last entry");
+			assertIntegerRange(dynamicChunk.sampleIntegerData(1, 3499), -5, -5, "Negative sample");
+			assertIntegerRange(dynamicChunk.sampleIntegerData(1, 3500), 7, 7, "Sample at second variable entry");
+
+			bool bThrewOnNonIncremental = false;
+			try {
+				dynamicChunk.writeEntry(1, 3800, 1);
+			}
+			catch (const std::exception&) {
+				bThrewOnNonIncremental = true;
+			}
+			assertTrue(bThrewOnNonIncremental, "Writing before the current timestamp must throw");
+
+			AMC::CStateJournalStreamChunk_InMemory inMemoryChunk(&dynamicChunk, nullptr);
+			assertIntegerRange((int64_t)inMemoryChunk.getChunkIndex(), 3, 3, "In memory chunk index");
+			assertIntegerRange((int64_t)inMemoryChunk.getMemoryUsage(), 5 * (sizeof(int64_t) + sizeof(uint32_t)) + 2 * (sizeof(LibMCData::sJournalChunkVariableInfo) + sizeof(AMC::sStateJournalChunkSummary)), 5 * (sizeof(int64_t) + sizeof(uint32_t)) + 2 * (sizeof(LibMCData::sJournalChunkVariableInfo) + sizeof(AMC::sStateJournalChunkSummary)), "In memory chunk size");
+
+			for (uint64_t nTimeStamp = 3000; nTimeStamp < 4000; nTimeStamp += 50) {
+				for (uint32_t nStorageIndex = 0; nStorageIndex < 2; nStorageIndex++) {
+					int64_t nExpected = dynamicChunk.sampleIntegerData(nStorageIndex, nTimeStamp);
+					assertIntegerRange(inMemoryChunk.sampleIntegerData(nStorageIndex, nTimeStamp), nExpected, nExpected, "Serialized chunk must sample like the dynamic chunk");
+				}
+			}
+		}
+
+		void test_ChunkQueue() {
+			AMC::CStateJournalStreamChunkQueue chunkQueue(2);
+			assertTrue(chunkQueue.isEmpty(), "New queue must be empty");
+			assertTrue(chunkQueue.pop().get() == nullptr, "Empty queue must return null");
+
+			auto pChunk1 = std::make_shared<AMC::CStateJournalStreamChunk_Dynamic>(1, 1000, 1999, 1, nullptr);
+			auto pChunk2 = std::make_shared<AMC::CStateJournalStreamChunk_Dynamic>(2, 2000, 2999, 1, nullptr);
+			auto pChunk3 = std::make_shared<AMC::CStateJournalStreamChunk_Dynamic>(3, 3000, 3999, 1, nullptr);
+
+			assertTrue(chunkQueue.push(pChunk1), "First push must succeed");
+			assertTrue(chunkQueue.push(pChunk2), "Second push must succeed");
+			assertFalse(chunkQueue.push(pChunk3), "Push into full queue must fail");
+
+			assertIntegerRange((int64_t)chunkQueue.pop()->getChunkIndex(), 1, 1, "Queue must be FIFO");
+			assertTrue(chunkQueue.push(pChunk3), "Push after pop must succeed");
+			assertIntegerRange((int64_t)chunkQueue.pop()->getChunkIndex(), 2, 2, "Queue must be FIFO");
+			assertIntegerRange((int64_t)chunkQueue.pop()->getChunkIndex(), 3, 3, "Queue must wrap around");
+			assertTrue(chunkQueue.isEmpty(), "Drained queue must be empty");
+		}
+
+		void test_ChunkQueueOverflow() {
+			auto fixture = createFixture(AMCCommon::CUtils::createUUID());
+			uint64_t nChunkInterval = fixture.m_pJournalSession->GetChunkIntervalInMicroseconds();
+			uint64_t nOverflowCount = 2;
+			uint64_t nChunkCount = STATEJOURNALSTREAM_CHUNKQUEUECAPACITY + nOverflowCount + 1;
+
+			// Without a recording thread, the queue fills up after STATEJOURNALSTREAM_CHUNKQUEUECAPACITY finished chunks
+			fixture.m_pStream->setVariableCount(1);
+			for (uint64_t nChunkIndex = 0; nChunkIndex < nChunkCount; nChunkIndex++)
+				fixture.m_pStream->writeInt64_MicroSecond(nChunkIndex * nChunkInterval, 0, (int64_t)nChunkIndex);
+
+			assertTrue(fixture.m_pStream->needsSerialization(), "Full queue must request serialization");
+
+			// Overflowed chunks stay in memory until they are serialized
+			for (uint64_t nChunkIndex = 0; nChunkIndex < nChunkCount; nChunkIndex++)
+				assertIntegerRange(fixture.m_pStream->sampleIntegerData(0, nChunkIndex * nChunkInterval), (int64_t)nChunkIndex, (int64_t)nChunkIndex, "Every chunk must be sampled after an overflow");
+
+			fixture.m_pStream->serializeChunksThreaded();
+			assertFalse(fixture.m_pStream->needsSerialization(), "Serialization must drain the queue and the overflow list");
+
+			// The queue is used again after the overflow list has been drained
+			fixture.m_pStream->writeInt64_MicroSecond(nChunkCount * nChunkInterval, 0, (int64_t)nChunkCount);
+			fixture.m_pStream->serializeChunksThreaded();
+			fixture.m_pStream->writeChunksToDiskThreaded();
+
+			// All finished chunks, including the overflowed ones, have been written to the journal
+			for (uint64_t nChunkIndex = 0; nChunkIndex < nChunkCount; nChunkIndex++) {
+				auto pChunkData = fixture.m_pJournalSession->ReadChunkIntegerData((uint32_t)nChunkIndex);
+				assertIntegerRange((int64_t)pChunkData->GetChunkIndex(), (int64_t)nChunkIndex, (int64_t)nChunkIndex, "Every chunk must be written to the journal");
+			}
+
+			for (uint64_t nChunkIndex = 0; nChunkIndex <= nChunkCount; nChunkIndex++)
+				assertIntegerRange(fixture.m_pStream->sampleIntegerData(0, nChunkIndex * nChunkInterval), (int64_t)nChunkIndex, (int64_t)nChunkIndex, "Every chunk must be sampled after writing");
+		}
+
+		void test_ChunkSummaries() {
+			AMC::CStateJournalStreamChunk_Dynamic dynamicChunk(3, 3000, 3999, 2, nullptr);
+
+			dynamicChunk.writeEntry(0, 3000, 10);
+			dynamicChunk.writeEntry(1, 3000, -5);
+			dynamicChunk.writeEntry(0, 3100, 25);
+			dynamicChunk.writeEntry(1, 3500, 7);
+			dynamicChunk.writeEntry(0, 3900, 30);
+
+			AMC::CStateJournalStreamChunk_InMemory inMemoryChunk(&dynamicChunk, nullptr);
+
+			std::vector<AMC::CStateJournalStreamChunk*> chunks = { &dynamicChunk, &inMemoryChunk };
+			for (auto pChunk : chunks) {
+
+				// Full chunk, answered from the stored summary for in memory chunks
+				AMC::sStateJournalChunkSummary summary;
+				AMC::CStateJournalStreamChunk::clearSummary(summary);
+				pChunk->computeSummary(0, 0, 10000, summary);
+				assertIntegerRange((int64_t)summary.m_nDurationInMicroSeconds, 1000, 1000, "Full chunk duration");
+				assertIntegerRange(summary.m_nMinValue, 10, 10, "Full chunk minimum");
+				assertIntegerRange(summary.m_nMaxValue, 30, 30, "Full chunk maximum");
+				assertDoubleRange(summary.m_dIntegral, 24000.0, 24000.0, "Full chunk integral");
+
+				// Partial chunk
+				AMC::CStateJournalStreamChunk::clearSummary(summary);
+				pChunk->computeSummary(0, 3050, 3950, summary);
+				assertIntegerRange((int64_t)summary.m_nDurationInMicroSeconds, 900, 900, "Partial chunk duration");
+				assertDoubleRange(summary.m_dIntegral, 22000.0, 22000.0, "Partial chunk integral");
+
+				AMC::CStateJournalStreamChunk::clearSummary(summary);
+				pChunk->computeSummary(1, 3200, 3400, summary);
+				assertIntegerRange(summary.m_nMinValue, -5, -5, "Constant interval minimum");
+				assertIntegerRange(summary.m_nMaxValue, -5, -5, "Constant interval maximum");
+
+				AMC::sStateJournalStatistics statistics;
+				AMC::CStateJournalStreamChunk::clearSummary(summary);
+				pChunk->computeSummary(1, 3000, 4000, summary);
+				AMC::CStateJournalStreamChunk::summaryToStatistics(summary, 0.5, statistics);
+				assertDoubleRange(statistics.m_dMinValue, -2.5, -2.5, "Statistics minimum in units");
+				assertDoubleRange(statistics.m_dMaxValue, 3.5, 3.5, "Statistics maximum in units");
+				assertDoubleRange(statistics.m_dAverageValue, 0.5, 0.5, "Statistics average in units");
+				assertDoubleRange(statistics.m_dIntegral, 0.0005, 0.0005, "Statistics integral in value seconds");
+
+				std::vector<AMC::sJournalTimeStreamInt64Entry> timeStream;
+				pChunk->readRawIntegerData(0, 3050, 3900, timeStream);
+				assertIntegerRange((int64_t)timeStream.size(), 3, 3, "Raw entries in interval");
+				assertIntegerRange((int64_t)timeStream.at(0).m_nTimeStampInMicroSeconds, 3050, 3050, "Raw stream starts at interval start");
+				assertIntegerRange(timeStream.at(0).m_nValue, 10, 10, "Raw stream start value");
+				assertIntegerRange((int64_t)timeStream.at(1).m_nTimeStampInMicroSeconds, 3100, 3100, "Raw entry time stamp");
+				assertIntegerRange(timeStream.at(2).m_nValue, 30, 30, "Raw stream includes interval end");
+			}
+		}
+
+		// Stream cache that hands out a fixed in memory chunk and counts how often it has been loaded
+		class CCountingStreamCache : public AMC::CStateJournalStreamCache {
+		private:
+			AMC::PStateJournalStreamChunk_InMemory m_pChunk;
+			uint32_t m_nLoadCount;
+
+		public:
+			CCountingStreamCache(AMC::PStateJournalStreamChunk_InMemory pChunk)
+				: AMC::CStateJournalStreamCache(0, nullptr), m_pChunk(pChunk), m_nLoadCount(0)
+			{
+			}
+
+			AMC::PStateJournalStreamChunk_InMemory loadEntryFromJournal(uint32_t nTimeChunkIndex) override {
+				m_nLoadCount++;
+				return m_pChunk;
+			}
+
+			uint32_t getLoadCount() {
+				return m_nLoadCount;
+			}
+		};
+
+		void test_OnDiskChunkSummaries() {
+			AMC::CStateJournalStreamChunk_Dynamic dynamicChunk(3, 3000, 3999, 2, nullptr);
+			dynamicChunk.writeEntry(0, 3000, 10);
+			dynamicChunk.writeEntry(1, 3000, -5);
+			dynamicChunk.writeEntry(0, 3100, 25);
+			dynamicChunk.writeEntry(1, 3500, 7);
+			dynamicChunk.writeEntry(0, 3900, 30);
+
+			auto pInMemoryChunk = std::make_shared<AMC::CStateJournalStreamChunk_InMemory>(&dynamicChunk, nullptr);
+			auto pCache = std::make_shared<CCountingStreamCache>(pInMemoryChunk);
+			AMC::CStateJournalStreamChunk_OnDisk onDiskChunk(3000, 3999, 3, pCache, pInMemoryChunk->getVariableSummaries(), nullptr);
+
+			// Fully covered chunk, answered from the summary taken over at seal time
+			AMC::sStateJournalChunkSummary summary;
+			AMC::CStateJournalStreamChunk::clearSummary(summary);
+			onDiskChunk.computeSummary(0, 0, 10000, summary);
+			assertIntegerRange(pCache->getLoadCount(), 0, 0, "Covered chunk must not be loaded");
+			assertIntegerRange((int64_t)summary.m_nDurationInMicroSeconds, 1000, 1000, "Full chunk duration");
+			assertIntegerRange(summary.m_nMinValue, 10, 10, "Full chunk minimum");
+			assertIntegerRange(summary.m_nMaxValue, 30, 30, "Full chunk maximum");
+			assertDoubleRange(summary.m_dIntegral, 24000.0, 24000.0, "Full chunk integral");
+
+			// Interval outside of the chunk
+			AMC::CStateJournalStreamChunk::clearSummary(summary);
+			onDiskChunk.computeSummary(1, 5000, 6000, summary);
+			assertIntegerRange(pCache->getLoadCount(), 0, 0, "Disjoint chunk must not be loaded");
+			assertIntegerRange((int64_t)summary.m_nDurationInMicroSeconds, 0, 0, "Disjoint interval must be empty");
+
+			// Partially covered chunk, scans the entries
+			AMC::CStateJournalStreamChunk::clearSummary(summary);
+			onDiskChunk.computeSummary(0, 3050, 3950, summary);
+			assertIntegerRange(pCache->getLoadCount(), 1, 1, "Partially covered chunk must be loaded");
+			assertIntegerRange((int64_t)summary.m_nDurationInMicroSeconds, 900, 900, "Partial chunk duration");
+			assertDoubleRange(summary.m_dIntegral, 22000.0, 22000.0, "Partial chunk integral");
+
+			bool bThrewOnUnknownVariable = false;
+			try {
+				onDiskChunk.computeSummary(2, 0, 10000, summary);
+			}
+			catch (const std::exception&) {
+				bThrewOnUnknownVariable = true;
+			}
+			assertTrue(bThrewOnUnknownVariable, "Unknown storage index must throw");
+		}
+
+		void test_ConcurrentUpdates() {
+			auto fixture = createFixture(AMCCommon::CUtils::createUUID());
+
+			const uint32_t nThreadCount = 4;
+			const int64_t nUpdateCount = 20000;
+
+			std::vector<uint32_t> variableIDs;
+			for (uint32_t nThreadIndex = 0; nThreadIndex < nThreadCount; nThreadIndex++)
+				variableIDs.push_back(fixture.m_pJournal->registerIntegerValue("counter" + std::to_string(nThreadIndex), 0));
+
+			fixture.m_pJournal->startRecording();
+
+			std::atomic<bool> bFailed(false);
+			std::atomic<bool> bWritersDone(false);
+			std::vector<std::thread> threads;
+			for (uint32_t nThreadIndex = 0; nThreadIndex < nThreadCount; nThreadIndex++) {
+				uint32_t nVariableID = variableIDs.at(nThreadIndex);
+				threads.push_back(std::thread([&fixture, &bFailed, nVariableID, nUpdateCount]() {
+					try {
+						for (int64_t nValue = 1; nValue <= nUpdateCount; nValue++)
+							fixture.m_pJournal->updateIntegerValue(nVariableID, nValue);
+					}
+					catch (...) {
+						bFailed = true;
+					}
+				}));
+			}
+
+			// Sampling reads the current chunk while it is being written
+			std::thread readerThread([&fixture, &bFailed, &bWritersDone]() {
+				try {
+					while (!bWritersDone) {
+						uint64_t nTimeStamp = fixture.m_pJournal->getLifeTimeInMicroseconds();
+						double dValue = fixture.m_pJournal->computeSample("counter0", nTimeStamp);
+						if ((dValue < 0.0) || (dValue > (double)nUpdateCount))
+							bFailed = true;
+					}
+				}
+				catch (...) {
+					bFailed = true;
+				}
+			});
+
+			for (auto& thread : threads)
+				thread.join();
+			bWritersDone = true;
+			readerThread.join();
+
+			assertFalse(bFailed, "Concurrent updates and samples must not fail");
+
+			uint64_t nEndTime = fixture.m_pJournal->getLifeTimeInMicroseconds();
+			for (uint32_t nThreadIndex = 0; nThreadIndex < nThreadCount; nThreadIndex++)
+				assertDoubleRange(fixture.m_pJournal->computeSample("counter" + std::to_string(nThreadIndex), nEndTime), (double)nUpdateCount, (double)nUpdateCount, "Every thread must have recorded its last value");
+
+			fixture.m_pJournal->finishRecording();
+		}
+
+		void test_IntervalQueries() {
+			auto fixture = createFixture(AMCCommon::CUtils::createUUID());
+
+			uint32_t nCountID = fixture.m_pJournal->registerIntegerValue("count", 0);
+			uint32_t nStatusID = fixture.m_pJournal->registerStringValue("status", "idle");
+
+			fixture.m_pJournal->startRecording();
+
+			AMCCommon::CChrono::sleepMicroseconds(2000);
+			fixture.m_pJournal->updateIntegerValue(nCountID, 10);
+			fixture.m_pJournal->updateStringValue(nStatusID, "running");
+
+			AMCCommon::CChrono::sleepMicroseconds(2000);
+			fixture.m_pJournal->updateIntegerValue(nCountID, 20);
+
+			AMCCommon::CChrono::sleepMicroseconds(2000);
+			fixture.m_pJournal->updateIntegerValue(nCountID, 20);
+			uint64_t nEndTime = fixture.m_pJournal->getLifeTimeInMicroseconds();
+
+			AMC::sStateJournalInterval interval;
+			interval.m_nStartTimeInMicroSeconds = 0;
+			interval.m_nEndTimeInMicroSeconds = nEndTime;
+
+			std::vector<AMC::sJournalTimeStreamDoubleEntry> timeStream;
+			fixture.m_pJournal->readDoubleTimeStream("count", interval, timeStream);
+			assertIntegerRange((int64_t)timeStream.size(), 3, 3, "Raw time stream must only contain value changes");
+			assertDoubleRange(timeStream.at(0).m_dValue, 0.0, 0.0, "Raw time stream initial value");
+			assertDoubleRange(timeStream.at(1).m_dValue, 10.0, 10.0, "Raw time stream first update");
+			assertDoubleRange(timeStream.at(2).m_dValue, 20.0, 20.0, "Raw time stream second update");
+
+			uint64_t nFirstUpdate = timeStream.at(1).m_nTimeStampInMicroSeconds;
+			uint64_t nSecondUpdate = timeStream.at(2).m_nTimeStampInMicroSeconds;
+			assertTrue((nFirstUpdate < nSecondUpdate) && (nSecondUpdate < nEndTime), "Raw time stream must be increasing");
+
+			interval.m_nStartTimeInMicroSeconds = nFirstUpdate;
+			AMC::sStateJournalStatistics statistics;
+			fixture.m_pJournal->computeStatistics("count", interval, statistics);
+
+			double dExpectedIntegral = (10.0 * (nSecondUpdate - nFirstUpdate) + 20.0 * (nEndTime - nSecondUpdate)) / 1000000.0;
+			double dExpectedAverage = dExpectedIntegral * 1000000.0 / (double)(nEndTime - nFirstUpdate);
+			assertDoubleRange(statistics.m_dMinValue, 10.0, 10.0, "Interval minimum");
+			assertDoubleRange(statistics.m_dMaxValue, 20.0, 20.0, "Interval maximum");
+			assertDoubleRange(statistics.m_dIntegral, dExpectedIntegral - 1.0E-9, dExpectedIntegral + 1.0E-9, "Interval integral");
+			assertDoubleRange(statistics.m_dAverageValue, dExpectedAverage - 1.0E-6, dExpectedAverage + 1.0E-6, "Interval average");
+
+			std::vector<AMC::sJournalTimeStreamDoubleEntry> samples(3);
+			samples.at(0).m_nTimeStampInMicroSeconds = nFirstUpdate - 1;
+			samples.at(1).m_nTimeStampInMicroSeconds = nFirstUpdate;
+			samples.at(2).m_nTimeStampInMicroSeconds = nEndTime;
+			fixture.m_pJournal->sampleDoubleTimeStream("count", samples);
+			for (auto& sample : samples) {
+				double dExpected = fixture.m_pJournal->computeSample("count", sample.m_nTimeStampInMicroSeconds);
+				assertDoubleRange(sample.m_dValue, dExpected, dExpected, "Batched sample must match single sample");
+			}
+
+			bool bThrewOnStringStatistics = false;
+			try {
+				fixture.m_pJournal->computeStatistics("status", interval, statistics);
+			}
+			catch (const std::exception&) {
+				bThrewOnStringStatistics = true;
+			}
+			assertTrue(bThrewOnStringStatistics, "Statistics of a string variable must throw");
+
+			bool bThrewOnEmptyInterval = false;
+			interval.m_nStartTimeInMicroSeconds = nEndTime;
+			try {
+				fixture.m_pJournal->computeStatistics("count", interval, statistics);
+			}
+			catch (const std::exception&) {
+				bThrewOnEmptyInterval = true;
+			}
+			assertTrue(bThrewOnEmptyInterval, "Statistics of an empty interval must throw");
+
+			fixture.m_pJournal->finishRecording();
+		}
+
 	};
 
 }
@@ -0,0 +1,189 @@
+/*++
+
+Copyright (C) 2025 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef __AMCTEST_UNITTEST_STREAMHANDLER
+#define __AMCTEST_UNITTEST_STREAMHANDLER
+
+
+#include "amc_unittests.hpp"
+#include "amc_streamhandler.hpp"
+#include "common_utils.hpp"
+
+#include <thread>
+#include <chrono>
+
+
+namespace AMCUnitTest {
+
+	class CUnitTestGroup_StreamHandler : public CUnitTestGroup {
+	public:
+
+		std::string getTestGroupName() override {
+			return "StreamHandler";
+		}
+
+		void registerTests() override {
+			registerTest("StreamRegistration", "Stream registration and lookup", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_StreamHandler::testStreamRegistration, this));
+			registerTest("StreamSubscriptionQueue", "Bounded subscription queue drops the oldest packets", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_StreamHandler::testStreamSubscriptionQueue, this));
+			registerTest("StreamPublishWakesWaiter", "Publishing wakes a blocked subscriber", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_StreamHandler::testStreamPublishWakesWaiter, this));
+			registerTest("StreamImageValidation", "Image streams only accept JPEG frames and replay the last frame", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_StreamHandler::testStreamImageValidation, this));
+		}
+
+		void initializeTests() override {
+		}
+
+	private:
+
+		void testStreamRegistration()
+		{
+			AMC::CStreamHandler handler;
+
+			auto pStream = handler.registerStream("events", AMC::eStreamType::JSONEventStream);
+			assertTrue(pStream.get() != nullptr);
+			assertTrue(pStream->getIdentifier() == "events");
+			assertTrue(handler.registerStream("events", AMC::eStreamType::JSONEventStream).get() == pStream.get());
+			assertTrue(handler.findStream(pStream->getUUID(), true).get() == pStream.get());
+			assertTrue(handler.findStream(AMCCommon::CUtils::createUUID(), false).get() == nullptr);
+
+			bool thrown = false;
+			try {
+				handler.registerStream("events", AMC::eStreamType::JPEGImageStream);
+			}
+			catch (...) {
+				thrown = true;
+			}
+			assertTrue(thrown, "Expected registerStream to throw on type mismatch");
+
+			thrown = false;
+			try {
+				handler.registerStream("invalid identifier", AMC::eStreamType::JSONEventStream);
+			}
+			catch (...) {
+				thrown = true;
+			}
+			assertTrue(thrown, "Expected registerStream to throw on invalid identifier");
+
+			thrown = false;
+			try {
+				handler.findStream(AMCCommon::CUtils::createUUID(), true);
+			}
+			catch (...) {
+				thrown = true;
+			}
+			assertTrue(thrown, "Expected findStream to throw on missing stream");
+		}
+
+		void testStreamSubscriptionQueue()
+		{
+			AMC::CStreamSubscription subscription(3);
+			assertTrue(subscription.popPacket().get() == nullptr);
+
+			for (uint8_t nIndex = 1; nIndex <= 5; nIndex++)
+				subscription.pushPacket(std::make_shared<AMC::CStreamPacket>(nIndex, "application/json", &nIndex, 1));
+
+			assertTrue(subscription.getQueuedPacketCount() == 3);
+			assertTrue(subscription.getDroppedPacketCount() == 2);
+
+			assertTrue(subscription.popPacket()->getSequenceNumber() == 3);
+			assertTrue(subscription.popPacket()->getSequenceNumber() == 4);
+			auto pLast = subscription.popPacket();
+			assertTrue(pLast->getSequenceNumber() == 5);
+			assertTrue(pLast->getData().size() == 1);
+			assertTrue(pLast->getData().at(0) == 5);
+			assertTrue(subscription.popPacket().get() == nullptr);
+
+			assertTrue(subscription.waitForPacket(1).get() == nullptr);
+
+			subscription.close();
+			assertTrue(subscription.isClosed());
+			subscription.pushPacket(std::make_shared<AMC::CStreamPacket>(6, "application/json", nullptr, 0));
+			assertTrue(subscription.getQueuedPacketCount() == 0);
+		}
+
+		void testStreamPublishWakesWaiter()
+		{
+			AMC::CStreamHandler handler;
+			auto pStream = handler.registerStream("wakeup", AMC::eStreamType::JSONEventStream);
+			auto pSubscription = pStream->subscribe();
+			assertTrue(pStream->getSubscriptionCount() == 1);
+
+			std::string sEvent = "{ \"value\": 1 }";
+			std::thread publisherThread([pStream, sEvent]() {
+				std::this_thread::sleep_for(std::chrono::milliseconds(20));
+				pStream->publish("application/json", reinterpret_cast<const uint8_t*>(sEvent.c_str()), sEvent.length());
+			});
+
+			auto pPacket = pSubscription->waitForPacket(5000);
+			publisherThread.join();
+
+			assertTrue(pPacket.get() != nullptr);
+			assertTrue(std::string(pPacket->getData().begin(), pPacket->getData().end()) == sEvent);
+
+			// Closed subscriptions return immediately
+			std::thread closeThread([pSubscription]() {
+				std::this_thread::sleep_for(std::chrono::milliseconds(20));
+				pSubscription->close();
+			});
+			assertTrue(pSubscription->waitForPacket(5000).get() == nullptr);
+			closeThread.join();
+
+			pSubscription = nullptr;
+			assertTrue(pStream->getSubscriptionCount() == 0);
+		}
+
+		void testStreamImageValidation()
+		{
+			AMC::CStreamHandler handler;
+			auto pStream = handler.registerStream("camera", AMC::eStreamType::JPEGImageStream);
+
+			std::vector<uint8_t> invalidFrame = { 0x00, 0x01, 0x02 };
+			bool thrown = false;
+			try {
+				pStream->publish("image/jpeg", invalidFrame.data(), invalidFrame.size());
+			}
+			catch (...) {
+				thrown = true;
+			}
+			assertTrue(thrown, "Expected publish to throw on invalid JPEG data");
+
+			std::vector<uint8_t> frame = { 0xFF, 0xD8, 0xFF, 0xD9 };
+			pStream->publish("image/jpeg", frame.data(), frame.size());
+
+			auto pSubscription = pStream->subscribe();
+			auto pPacket = pSubscription->popPacket();
+			assertTrue(pPacket.get() != nullptr);
+			assertTrue(pPacket->getData() == frame);
+			assertTrue(pPacket->getMIMEType() == "image/jpeg");
+		}
+	};
+
+}
+
+#endif //__AMCTEST_UNITTEST_STREAMHANDLER
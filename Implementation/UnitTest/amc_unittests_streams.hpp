@@ -35,9 +35,12 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "amc_unittests.hpp"
 #include "common_exportstream_native.hpp"
 #include "common_importstream_native.hpp"
+#include "common_memorymappedfile.hpp"
 #include "common_portablezipwriter.hpp"
 #include "common_utils.hpp"
 
+#include <cstring>
+
 
 namespace AMCUnitTest {
 
@@ -50,6 +53,7 @@ namespace AMCUnitTest {
 
 		void registerTests() override {
 			registerTest("NativeRoundTrip", "Export/import stream roundtrip including seek operations", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_Streams::testNativeRoundTrip, this));
+			registerTest("MemoryMappedFile", "Memory mapped file exposes the file content and reads ranges", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_Streams::testMemoryMappedFile, this));
 			registerTest("ZIPRoundTrip", "ZIP export stream writes expected ZIP structures", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_Streams::testZIPRoundTrip, this));
 		}
 
@@ -158,6 +162,66 @@ namespace AMCUnitTest {
 			assertTrue((tail[0] == 0) && (tail[1] == 0));
 		}
 
+		void testMemoryMappedFile()
+		{
+			CScopedTempDir tempDir;
+			std::string filePath = joinPath(tempDir.m_sPath, "mapped.bin");
+			std::string emptyFilePath = joinPath(tempDir.m_sPath, "empty.bin");
+
+			std::vector<uint8_t> data(100000);
+			for (size_t index = 0; index < data.size(); index++)
+				data[index] = (uint8_t)((index * 7) & 0xff);
+
+			{
+				AMCCommon::CExportStream_Native exportStream(filePath);
+				exportStream.writeBuffer(data.data(), data.size());
+				exportStream.flushStream();
+			}
+			{
+				AMCCommon::CExportStream_Native exportStream(emptyFilePath);
+				exportStream.flushStream();
+			}
+
+			{
+				AMCCommon::CMemoryMappedFile mappedFile(filePath);
+				assertTrue(mappedFile.getSize() == data.size());
+				assertTrue(mappedFile.getData() != nullptr);
+				assertTrue(memcmp(mappedFile.getData(), data.data(), data.size()) == 0);
+
+				std::vector<uint8_t> range(1000);
+				mappedFile.readRange(65000, range.size(), range.data());
+				assertTrue(memcmp(range.data(), data.data() + 65000, range.size()) == 0);
+
+				mappedFile.readRange(data.size() - 1, 1, range.data());
+				assertTrue(range.at(0) == data.at(data.size() - 1));
+
+				bool thrown = false;
+				try {
+					mappedFile.readRange(data.size() - 10, 11, range.data());
+				}
+				catch (...) {
+					thrown = true;
+				}
+				assertTrue(thrown, "Expected read beyond the end of the file to fail");
+			}
+
+			{
+				AMCCommon::CMemoryMappedFile emptyFile(emptyFilePath);
+				assertTrue(emptyFile.getSize() == 0);
+				assertTrue(emptyFile.getData() == nullptr);
+				emptyFile.readRange(0, 0, nullptr);
+			}
+
+			bool thrown = false;
+			try {
+				AMCCommon::CMemoryMappedFile missingFile(joinPath(tempDir.m_sPath, "missing.bin"));
+			}
+			catch (...) {
+				thrown = true;
+			}
+			assertTrue(thrown, "Expected mapping of a missing file to fail");
+		}
+
 		void testZIPRoundTrip()
 		{
 			CScopedTempDir tempDir;
@@ -0,0 +1,170 @@
+/*++
+
+Copyright (C) 2025 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+#ifndef __AMCTEST_UNITTEST_SYSTEMTASKSCHEDULER
+#define __AMCTEST_UNITTEST_SYSTEMTASKSCHEDULER
+
+
+#include "amc_unittests.hpp"
+#include "amc_systemtaskscheduler.hpp"
+
+#include <thread>
+#include <chrono>
+#include <atomic>
+
+
+namespace AMCUnitTest {
+
+	class CUnitTestGroup_SystemTaskScheduler : public CUnitTestGroup {
+	public:
+
+		std::string getTestGroupName() override {
+			return "SystemTaskScheduler";
+		}
+
+		void registerTests() override {
+			registerTest("TaskRegistration", "Task registration and interval validation", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_SystemTaskScheduler::testTaskRegistration, this));
+			registerTest("IdleSchedulerSleeps", "Tasks only run at their interval", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_SystemTaskScheduler::testIdleSchedulerSleeps, this));
+			registerTest("WakeTask", "Waking a task runs it without waiting for its interval", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_SystemTaskScheduler::testWakeTask, this));
+		}
+
+		void initializeTests() override {
+		}
+
+	private:
+
+		template <typename T> static bool waitForCondition(T condition, uint32_t nTimeOutInMS)
+		{
+			for (uint32_t nIndex = 0; nIndex < nTimeOutInMS; nIndex++) {
+				if (condition())
+					return true;
+				std::this_thread::sleep_for(std::chrono::milliseconds(1));
+			}
+			return condition();
+		}
+
+		void testTaskRegistration()
+		{
+			AMC::CSystemTaskScheduler scheduler(std::make_shared<AMCCommon::CChrono>(), nullptr);
+
+			scheduler.registerTask("first", "First Task", 100, []() {});
+			assertTrue(scheduler.hasTask("first"));
+			assertTrue(!scheduler.hasTask("second"));
+			assertTrue(scheduler.getTaskInterval("first") == 100);
+
+			scheduler.setTaskInterval("first", 250);
+			assertTrue(scheduler.getTaskInterval("first") == 250);
+
+			bool thrown = false;
+			try {
+				scheduler.registerTask("first", "Duplicate Task", 100, []() {});
+			}
+			catch (...) {
+				thrown = true;
+			}
+			assertTrue(thrown, "Expected registerTask to throw on duplicate name");
+
+			thrown = false;
+			try {
+				scheduler.registerTask("second", "Second Task", 0, []() {});
+			}
+			catch (...) {
+				thrown = true;
+			}
+			assertTrue(thrown, "Expected registerTask to throw on zero interval");
+
+			thrown = false;
+			try {
+				scheduler.setTaskInterval("first", AMC_SYSTEMTASK_MAXINTERVAL_MILLISECONDS + 1);
+			}
+			catch (...) {
+				thrown = true;
+			}
+			assertTrue(thrown, "Expected setTaskInterval to throw on invalid interval");
+
+			thrown = false;
+			try {
+				scheduler.wakeTask("unknown");
+			}
+			catch (...) {
+				thrown = true;
+			}
+			assertTrue(thrown, "Expected wakeTask to throw on unknown task");
+		}
+
+		void testIdleSchedulerSleeps()
+		{
+			AMC::CSystemTaskScheduler scheduler(std::make_shared<AMCCommon::CChrono>(), nullptr);
+
+			std::atomic<uint32_t> nSlowCount(0);
+			std::atomic<uint32_t> nFastCount(0);
+			scheduler.registerTask("slow", "Slow Task", 60000, [&nSlowCount]() { nSlowCount++; });
+			scheduler.registerTask("fast", "Fast Task", 20, [&nFastCount]() { nFastCount++; });
+
+			std::thread schedulerThread([&scheduler]() { scheduler.run(); });
+			std::this_thread::sleep_for(std::chrono::milliseconds(200));
+			scheduler.requestTermination();
+			schedulerThread.join();
+
+			// Every task runs once at start, then at its own interval
+			assertTrue(nSlowCount == 1);
+			assertTrue((nFastCount >= 3) && (nFastCount <= 12), "Unexpected execution count of fast task: " + std::to_string(nFastCount));
+
+			uint64_t nExecutionCount, nLastDuration, nMaxDuration;
+			scheduler.getTaskStatistics("fast", nExecutionCount, nLastDuration, nMaxDuration);
+			assertTrue(nExecutionCount == nFastCount);
+			assertTrue(nLastDuration <= nMaxDuration);
+		}
+
+		void testWakeTask()
+		{
+			AMC::CSystemTaskScheduler scheduler(std::make_shared<AMCCommon::CChrono>(), nullptr);
+
+			std::atomic<uint32_t> nCount(0);
+			scheduler.registerTask("archive", "Archive Task", 60000, [&nCount]() { nCount++; });
+
+			std::thread schedulerThread([&scheduler]() { scheduler.run(); });
+
+			assertTrue(waitForCondition([&nCount]() { return nCount == 1; }, 1000), "Task did not run at start");
+
+			scheduler.wakeTask("archive");
+			bool bWokenUp = waitForCondition([&nCount]() { return nCount == 2; }, 1000);
+
+			// Termination must not wait for the next interval either
+			scheduler.requestTermination();
+			schedulerThread.join();
+
+			assertTrue(bWokenUp, "Woken task did not run");
+			assertTrue(nCount == 2);
+		}
+	};
+
+}
+
+#endif // __AMCTEST_UNITTEST_SYSTEMTASKSCHEDULER
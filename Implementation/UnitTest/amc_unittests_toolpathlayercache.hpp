@@ -0,0 +1,256 @@
+/*++
+
+Copyright (C) 2025 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+#ifndef __AMCTEST_UNITTEST_TOOLPATHLAYERCACHE
+#define __AMCTEST_UNITTEST_TOOLPATHLAYERCACHE
+
+
+#include "amc_unittests.hpp"
+#include "amc_toolpathlayercache.hpp"
+
+#include <thread>
+#include <chrono>
+#include <atomic>
+#include <set>
+
+
+namespace AMCUnitTest {
+
+	class CUnitTestGroup_ToolpathLayerCache : public CUnitTestGroup {
+	public:
+
+		std::string getTestGroupName() override {
+			return "ToolpathLayerCache";
+		}
+
+		void registerTests() override {
+			registerTest("CacheHits", "Cached layers are returned without decoding", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_ToolpathLayerCache::testCacheHits, this));
+			registerTest("EvictionUnderQuota", "Least recently used layers are evicted to stay within the memory quota", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_ToolpathLayerCache::testEvictionUnderQuota, this));
+			registerTest("ClearInvalidatesDecodes", "Layers decoded before a clear do not enter the cache", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_ToolpathLayerCache::testClearInvalidatesDecodes, this));
+			registerTest("Prefetch", "Layers after the last read layer are decoded in the background", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_ToolpathLayerCache::testPrefetch, this));
+			registerTest("InvalidParameters", "Rejects invalid cache parameters", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_ToolpathLayerCache::testInvalidParameters, this));
+		}
+
+		void initializeTests() override {
+		}
+
+	private:
+
+		class CTestLayer {
+		private:
+			uint32_t m_nLayerIndex;
+			uint64_t m_nMemoryUsage;
+		public:
+			CTestLayer(uint32_t nLayerIndex, uint64_t nMemoryUsage)
+				: m_nLayerIndex(nLayerIndex), m_nMemoryUsage(nMemoryUsage)
+			{
+			}
+
+			uint32_t getLayerIndex()
+			{
+				return m_nLayerIndex;
+			}
+
+			uint64_t getMemoryUsage()
+			{
+				return m_nMemoryUsage;
+			}
+		};
+
+		typedef AMC::CToolpathLayerCache<CTestLayer> CTestLayerCache;
+		typedef std::shared_ptr<CTestLayer> PTestLayer;
+
+		template <typename T> static bool waitForCondition(T condition, uint32_t nTimeOutInMS)
+		{
+			for (uint32_t nIndex = 0; nIndex < nTimeOutInMS; nIndex++) {
+				if (condition())
+					return true;
+				std::this_thread::sleep_for(std::chrono::milliseconds(1));
+			}
+			return condition();
+		}
+
+		void testCacheHits()
+		{
+			CTestLayerCache cache(1000, 0, nullptr);
+
+			for (uint32_t nLayerIndex = 0; nLayerIndex < 3; nLayerIndex++)
+				assertTrue(cache.addLayer(nLayerIndex, std::make_shared<CTestLayer>(nLayerIndex, 100), cache.getGeneration()));
+
+			assertTrue(cache.getLayerCount() == 3);
+			assertTrue(cache.getMemoryUsage() == 300);
+
+			auto pLayer = cache.retrieveLayer(1);
+			assertTrue(pLayer.get() != nullptr);
+			assertTrue(pLayer->getLayerIndex() == 1);
+			assertTrue(cache.retrieveLayer(1).get() == pLayer.get(), "Expected the cached instance to be returned");
+			assertTrue(cache.retrieveLayer(3).get() == nullptr);
+
+			// Replacing a layer updates the memory bookkeeping
+			assertTrue(cache.addLayer(1, std::make_shared<CTestLayer>(1, 250), cache.getGeneration()));
+			assertTrue(cache.getLayerCount() == 3);
+			assertTrue(cache.getMemoryUsage() == 450);
+			assertTrue(cache.retrieveLayer(1)->getMemoryUsage() == 250);
+
+			cache.clear();
+			assertTrue(cache.getLayerCount() == 0);
+			assertTrue(cache.getMemoryUsage() == 0);
+		}
+
+		void testEvictionUnderQuota()
+		{
+			CTestLayerCache cache(300, 0, nullptr);
+
+			for (uint32_t nLayerIndex = 0; nLayerIndex < 3; nLayerIndex++)
+				cache.addLayer(nLayerIndex, std::make_shared<CTestLayer>(nLayerIndex, 100), cache.getGeneration());
+
+			// Layer 0 becomes the most recently used one, so layer 1 is the eviction candidate
+			assertTrue(cache.retrieveLayer(0).get() != nullptr);
+			cache.addLayer(3, std::make_shared<CTestLayer>(3, 100), cache.getGeneration());
+
+			assertTrue(cache.getMemoryUsage() == 300);
+			assertTrue(cache.hasLayer(0));
+			assertTrue(!cache.hasLayer(1), "Expected the least recently used layer to be evicted");
+			assertTrue(cache.hasLayer(2));
+			assertTrue(cache.hasLayer(3));
+
+			// A larger layer evicts as many layers as needed
+			cache.addLayer(4, std::make_shared<CTestLayer>(4, 250), cache.getGeneration());
+			assertTrue(cache.getMemoryUsage() <= cache.getMemoryQuota());
+			assertTrue(cache.hasLayer(4));
+			assertTrue(cache.getLayerCount() == 1);
+
+			// Layers that exceed the quota on their own are not cached and do not evict anything
+			assertTrue(!cache.addLayer(5, std::make_shared<CTestLayer>(5, 301), cache.getGeneration()));
+			assertTrue(!cache.hasLayer(5));
+			assertTrue(cache.hasLayer(4));
+
+			// A quota of 0 disables caching
+			CTestLayerCache disabledCache(0, 0, nullptr);
+			assertTrue(!disabledCache.addLayer(0, std::make_shared<CTestLayer>(0, 1), disabledCache.getGeneration()));
+			assertTrue(disabledCache.getLayerCount() == 0);
+		}
+
+		void testClearInvalidatesDecodes()
+		{
+			CTestLayerCache cache(1000, 0, nullptr);
+
+			uint64_t nGeneration = cache.getGeneration();
+			cache.clear();
+
+			assertTrue(!cache.addLayer(0, std::make_shared<CTestLayer>(0, 100), nGeneration), "Expected a layer decoded before the clear to be rejected");
+			assertTrue(!cache.hasLayer(0));
+
+			assertTrue(cache.addLayer(0, std::make_shared<CTestLayer>(0, 100), cache.getGeneration()));
+			assertTrue(cache.hasLayer(0));
+		}
+
+		void testPrefetch()
+		{
+			std::mutex decodedMutex;
+			std::set<uint32_t> decodedLayers;
+			std::atomic<uint32_t> nFailingLayer(UINT32_MAX);
+
+			CTestLayerCache cache(1000, 2, [&](uint32_t nLayerIndex) {
+				if (nLayerIndex == nFailingLayer)
+					throw std::runtime_error("decode error");
+
+				std::lock_guard<std::mutex> lockGuard(decodedMutex);
+				decodedLayers.insert(nLayerIndex);
+				return std::make_shared<CTestLayer>(nLayerIndex, 10);
+			});
+
+			cache.requestPrefetch(3, 10);
+			assertTrue(waitForCondition([&cache]() { return cache.hasLayer(4) && cache.hasLayer(5); }, 5000), "Expected layers 4 and 5 to be prefetched");
+			assertTrue(!cache.hasLayer(3));
+			assertTrue(!cache.hasLayer(6));
+
+			// Prefetching stops at the last layer
+			cache.requestPrefetch(8, 10);
+			assertTrue(waitForCondition([&cache]() { return cache.hasLayer(9); }, 5000), "Expected layer 9 to be prefetched");
+
+			// Already cached layers are not decoded again
+			cache.requestPrefetch(3, 10);
+
+			// A failing decode is skipped and does not stop later requests
+			nFailingLayer = 1;
+			cache.requestPrefetch(0, 10);
+			cache.requestPrefetch(6, 10);
+			assertTrue(waitForCondition([&cache]() { return cache.hasLayer(7); }, 5000), "Expected layer 7 to be prefetched after a failing decode");
+			assertTrue(!cache.hasLayer(1));
+
+			cache.stopPrefetch();
+
+			std::lock_guard<std::mutex> lockGuard(decodedMutex);
+			for (auto nLayerIndex : decodedLayers)
+				assertTrue(nLayerIndex < 10, "Expected no layer beyond the layer count to be decoded");
+			assertTrue(decodedLayers.count(3) == 0, "Expected the read layer itself not to be prefetched");
+
+			// Without a prefetch count no thread is started and nothing is decoded
+			CTestLayerCache noPrefetchCache(1000, 0, nullptr);
+			noPrefetchCache.requestPrefetch(0, 10);
+			assertTrue(noPrefetchCache.getLayerCount() == 0);
+		}
+
+		void testInvalidParameters()
+		{
+			bool thrown = false;
+			try {
+				CTestLayerCache cache(1000, AMC_TOOLPATH_LAYERCACHE_MAXPREFETCHCOUNT + 1, [](uint32_t nLayerIndex) { return std::make_shared<CTestLayer>(nLayerIndex, 10); });
+			}
+			catch (...) {
+				thrown = true;
+			}
+			assertTrue(thrown, "Expected an invalid prefetch count to throw");
+
+			thrown = false;
+			try {
+				CTestLayerCache cache(1000, 2, nullptr);
+			}
+			catch (...) {
+				thrown = true;
+			}
+			assertTrue(thrown, "Expected prefetching without decode function to throw");
+
+			thrown = false;
+			try {
+				CTestLayerCache cache(1000, 0, nullptr);
+				cache.addLayer(0, nullptr, cache.getGeneration());
+			}
+			catch (...) {
+				thrown = true;
+			}
+			assertTrue(thrown, "Expected adding a null layer to throw");
+		}
+
+	};
+
+}
+
+#endif // __AMCTEST_UNITTEST_TOOLPATHLAYERCACHE
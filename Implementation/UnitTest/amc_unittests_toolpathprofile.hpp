@@ -0,0 +1,133 @@
+/*++
+
+Copyright (C) 2025 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+#ifndef __AMCTEST_UNITTEST_TOOLPATHPROFILE
+#define __AMCTEST_UNITTEST_TOOLPATHPROFILE
+
+
+#include "amc_unittests.hpp"
+#include "amc_toolpathlayerdata.hpp"
+
+
+namespace AMCUnitTest {
+
+	class CUnitTestGroup_ToolpathProfile : public CUnitTestGroup {
+	public:
+
+		std::string getTestGroupName() override {
+			return "ToolpathProfile";
+		}
+
+		void registerTests() override {
+			registerTest("ValueHandleBinding", "Profile value handles are shared across profiles", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_ToolpathProfile::testValueHandleBinding, this));
+			registerTest("TypedValues", "Profile values are parsed into typed values", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_ToolpathProfile::testTypedValues, this));
+		}
+
+		void initializeTests() override {
+		}
+
+	private:
+
+		void testValueHandleBinding()
+		{
+			std::map<std::pair<std::string, std::string>, uint32_t> valueHandleMap;
+
+			AMC::CToolpathLayerProfile profile1(0, "uuid1", "profile1");
+			profile1.addValue("", "laserpower", "100");
+			profile1.addValue("", "laserspeed", "500");
+
+			AMC::CToolpathLayerProfile profile2(1, "uuid2", "profile2");
+			profile2.addValue("", "laserspeed", "800");
+			profile2.addValue("http://schemas.test.com/ns", "custom", "abc");
+
+			profile1.bindValueHandles(valueHandleMap);
+			profile2.bindValueHandles(valueHandleMap);
+
+			assertTrue(valueHandleMap.size() == 3);
+			uint32_t nPowerHandle = valueHandleMap.at(std::make_pair(std::string(""), std::string("laserpower")));
+			uint32_t nSpeedHandle = valueHandleMap.at(std::make_pair(std::string(""), std::string("laserspeed")));
+			uint32_t nCustomHandle = valueHandleMap.at(std::make_pair(std::string("http://schemas.test.com/ns"), std::string("custom")));
+
+			assertTrue(nPowerHandle != 0);
+			assertTrue(nSpeedHandle != 0);
+			assertTrue(nCustomHandle != 0);
+			assertTrue((nPowerHandle != nSpeedHandle) && (nSpeedHandle != nCustomHandle) && (nPowerHandle != nCustomHandle));
+
+			assertAssigned(profile1.findValueByHandle(nSpeedHandle));
+			assertAssigned(profile2.findValueByHandle(nSpeedHandle));
+			assertTrue(profile1.findValueByHandle(nSpeedHandle)->m_nValue == 500);
+			assertTrue(profile2.findValueByHandle(nSpeedHandle)->m_nValue == 800);
+
+			assertAssigned(profile1.findValueByHandle(nPowerHandle));
+			assertNull(profile2.findValueByHandle(nPowerHandle));
+			assertNull(profile1.findValueByHandle(nCustomHandle));
+			assertNull(profile1.findValueByHandle(0));
+			assertNull(profile1.findValueByHandle(1000));
+		}
+
+		void testTypedValues()
+		{
+			std::map<std::pair<std::string, std::string>, uint32_t> valueHandleMap;
+
+			AMC::CToolpathLayerProfile profile(0, "uuid", "profile");
+			profile.addValue("", "double", " 1.5 ");
+			profile.addValue("", "integer", "1.0000");
+			profile.addValue("", "bool", "TRUE");
+			profile.addValue("", "string", "gpio:1;wait:10");
+			profile.bindValueHandles(valueHandleMap);
+
+			auto pDouble = profile.findValueByHandle(valueHandleMap.at(std::make_pair(std::string(""), std::string("double"))));
+			assertAssigned(pDouble);
+			assertTrue(pDouble->m_bIsDouble);
+			assertDoubleRange(pDouble->m_dValue, 1.5, 1.5);
+			assertFalse(pDouble->m_bIsInteger);
+			assertFalse(pDouble->m_bIsBool);
+
+			auto pInteger = profile.findValueByHandle(valueHandleMap.at(std::make_pair(std::string(""), std::string("integer"))));
+			assertAssigned(pInteger);
+			assertTrue(pInteger->m_bIsInteger);
+			assertTrue(pInteger->m_nValue == 1);
+			assertTrue(pInteger->m_bIsBool && pInteger->m_bValue);
+
+			auto pBool = profile.findValueByHandle(valueHandleMap.at(std::make_pair(std::string(""), std::string("bool"))));
+			assertAssigned(pBool);
+			assertTrue(pBool->m_bIsBool && pBool->m_bValue);
+			assertFalse(pBool->m_bIsDouble);
+
+			auto pString = profile.findValueByHandle(valueHandleMap.at(std::make_pair(std::string(""), std::string("string"))));
+			assertAssigned(pString);
+			assertTrue(pString->m_sValue == "gpio:1;wait:10");
+			assertFalse(pString->m_bIsDouble || pString->m_bIsInteger || pString->m_bIsBool);
+		}
+
+	};
+
+}
+
+#endif //__AMCTEST_UNITTEST_TOOLPATHPROFILE
@@ -0,0 +1,297 @@
+/*++
+
+Copyright (C) 2025 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef __AMCTEST_UNITTEST_UIEXPRESSION
+#define __AMCTEST_UNITTEST_UIEXPRESSION
+
+
+#include "amc_unittests.hpp"
+#include "amc_ui_expression.hpp"
+#include "amc_statemachinedata.hpp"
+#include "amc_parameterhandler.hpp"
+#include "amc_parametergroup.hpp"
+#include "common_chrono.hpp"
+
+#include <pugixml.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+
+namespace AMCUnitTest {
+
+	class CUnitTestGroup_UIExpression : public CUnitTestGroup {
+	public:
+
+		std::string getTestGroupName() override {
+			return "UIExpression";
+		}
+
+		void registerTests() override {
+			registerTest("BoundValues", "Evaluates sync expressions of all types through their resolved parameter reference", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_UIExpression::testBoundValues, this));
+			registerTest("Invalidation", "Resolves expressions again when parameters are added or removed", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_UIExpression::testInvalidation, this));
+			registerTest("UnresolvedExpressions", "Keeps unresolved expressions until their parameter group changes", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_UIExpression::testUnresolvedExpressions, this));
+			registerTest("EvaluationBenchmark", "Measures the evaluation cost of a generated UI configuration", eUnitTestCategory::utOptionalPass, std::bind(&CUnitTestGroup_UIExpression::testEvaluationBenchmark, this));
+		}
+
+		void initializeTests() override {
+		}
+
+	private:
+
+		typedef struct _sUIExpressionFixture {
+			AMCCommon::PChrono m_pChrono;
+			AMC::PStateMachineData m_pStateMachineData;
+			AMC::PParameterGroup m_pGroup;
+		} sUIExpressionFixture;
+
+		static sUIExpressionFixture createFixture()
+		{
+			sUIExpressionFixture fixture;
+			fixture.m_pChrono = std::make_shared<AMCCommon::CChrono>();
+			fixture.m_pStateMachineData = std::make_shared<AMC::CStateMachineData>();
+
+			auto pHandler = std::make_shared<AMC::CParameterHandler>("main", fixture.m_pChrono);
+			fixture.m_pGroup = pHandler->addGroup("jobinfo", "Job Information");
+			fixture.m_pGroup->addNewStringParameter("name", "Name", "part1");
+			fixture.m_pGroup->addNewDoubleParameter("speed", "Speed", 12.5, 0.001);
+			fixture.m_pGroup->addNewIntParameter("layer", "Layer", 42);
+			fixture.m_pGroup->addNewBoolParameter("active", "Active", true);
+
+			fixture.m_pStateMachineData->registerParameterHandler("main", pHandler, fixture.m_pChrono);
+			fixture.m_pStateMachineData->setInstanceStateName("main", "idle");
+
+			return fixture;
+		}
+
+		static AMC::CUIExpression createExpression(pugi::xml_document& xmlDocument, const std::string& sSyncValue, const std::string& sFormat = "")
+		{
+			auto xmlNode = xmlDocument.append_child("item");
+			xmlNode.append_attribute("sync:value").set_value(sSyncValue.c_str());
+			if (!sFormat.empty())
+				xmlNode.append_attribute("format:value").set_value(sFormat.c_str());
+
+			return AMC::CUIExpression(xmlNode, "value");
+		}
+
+		static bool evaluationThrows(AMC::CUIExpression& expression, AMC::CStateMachineData* pStateMachineData)
+		{
+			try {
+				expression.evaluateStringValue(pStateMachineData);
+			}
+			catch (const std::exception&) {
+				return true;
+			}
+			return false;
+		}
+
+		void testBoundValues()
+		{
+			auto fixture = createFixture();
+			auto pData = fixture.m_pStateMachineData.get();
+			pugi::xml_document xmlDocument;
+
+			auto nameExpression = createExpression(xmlDocument, "main.jobinfo.name");
+			auto speedExpression = createExpression(xmlDocument, "main.jobinfo.speed", "%.2f mm/s");
+			auto layerExpression = createExpression(xmlDocument, "main.jobinfo.layer");
+			auto activeExpression = createExpression(xmlDocument, "main.jobinfo.active");
+			auto inactiveExpression = createExpression(xmlDocument, " !main.jobinfo.active");
+			auto stateExpression = createExpression(xmlDocument, "main.$state");
+
+			assertTrue(nameExpression.evaluateStringValue(pData) == "part1");
+			assertTrue(speedExpression.evaluateStringValue(pData) == "12.50 mm/s");
+			assertDoubleRange(speedExpression.evaluateNumberValue(pData), 12.4999, 12.5001);
+			assertTrue(layerExpression.evaluateIntegerValue(pData) == 42);
+			assertTrue(activeExpression.evaluateBoolValue(pData));
+			assertFalse(inactiveExpression.evaluateBoolValue(pData));
+			assertTrue(stateExpression.evaluateStringValue(pData) == "idle");
+
+			// Values are read through the binding on every evaluation
+			fixture.m_pGroup->setParameterValueByName("name", "part2");
+			fixture.m_pGroup->setIntParameterValueByName("layer", 43);
+			fixture.m_pGroup->setBoolParameterValueByName("active", false);
+			fixture.m_pStateMachineData->setInstanceStateName("main", "running");
+
+			assertTrue(nameExpression.evaluateStringValue(pData) == "part2");
+			assertTrue(layerExpression.evaluateIntegerValue(pData) == 43);
+			assertFalse(activeExpression.evaluateBoolValue(pData));
+			assertTrue(inactiveExpression.evaluateBoolValue(pData));
+			assertTrue(stateExpression.evaluateStringValue(pData) == "running");
+
+			// Copies share the binding, but evaluate against the current value
+			auto copiedExpression = nameExpression;
+			assertTrue(copiedExpression.evaluateStringValue(pData) == "part2");
+
+			// Inverted and state expressions are not valid as typed values
+			bool bThrewOnInvertedNumber = false;
+			try {
+				inactiveExpression.evaluateIntegerValue(pData);
+			}
+			catch (const std::exception&) {
+				bThrewOnInvertedNumber = true;
+			}
+			assertTrue(bThrewOnInvertedNumber);
+
+			bool bThrewOnStateNumber = false;
+			try {
+				stateExpression.evaluateNumberValue(pData);
+			}
+			catch (const std::exception&) {
+				bThrewOnStateNumber = true;
+			}
+			assertTrue(bThrewOnStateNumber);
+
+			auto invalidExpression = createExpression(xmlDocument, "main.$invalid");
+			assertTrue(evaluationThrows(invalidExpression, pData));
+		}
+
+		void testInvalidation()
+		{
+			auto fixture = createFixture();
+			auto pData = fixture.m_pStateMachineData.get();
+			pugi::xml_document xmlDocument;
+
+			auto lateExpression = createExpression(xmlDocument, "main.jobinfo.late");
+			auto missingGroupExpression = createExpression(xmlDocument, "main.nogroup.late");
+			auto nameExpression = createExpression(xmlDocument, "main.jobinfo.name");
+
+			assertTrue(evaluationThrows(lateExpression, pData));
+			assertTrue(evaluationThrows(missingGroupExpression, pData));
+			assertTrue(nameExpression.evaluateStringValue(pData) == "part1");
+
+			fixture.m_pGroup->addNewStringParameter("late", "Late parameter", "added");
+			assertTrue(lateExpression.evaluateStringValue(pData) == "added");
+
+			// Replacing a parameter outdates the bindings of its group
+			fixture.m_pGroup->removeValue("name");
+			assertTrue(evaluationThrows(nameExpression, pData));
+
+			fixture.m_pGroup->addNewIntParameter("name", "Replaced name", 7);
+			assertTrue(nameExpression.evaluateStringValue(pData) == "7");
+			assertTrue(nameExpression.evaluateIntegerValue(pData) == 7);
+
+			fixture.m_pGroup->setIntParameterValueByName("name", 8);
+			nameExpression.invalidateBinding();
+			assertTrue(nameExpression.evaluateIntegerValue(pData) == 8);
+
+			// Fixed values drop the binding
+			nameExpression.setFixedValue("fixed");
+			assertFalse(nameExpression.needsSync());
+			assertTrue(nameExpression.evaluateStringValue(pData) == "fixed");
+		}
+
+		void testUnresolvedExpressions()
+		{
+			auto fixture = createFixture();
+			auto pData = fixture.m_pStateMachineData.get();
+			pugi::xml_document xmlDocument;
+
+			auto missingExpression = createExpression(xmlDocument, "main.jobinfo.missing");
+			auto invertedExpression = createExpression(xmlDocument, "!main.jobinfo.missingflag");
+			auto invalidExpression = createExpression(xmlDocument, "main.$invalid");
+			auto missingGroupExpression = createExpression(xmlDocument, "main.lategroup.value");
+
+			// Repeated evaluations of a cached unresolved binding report the same errors
+			for (uint32_t nIndex = 0; nIndex < 3; nIndex++) {
+				assertTrue(evaluationThrows(missingExpression, pData));
+				assertTrue(evaluationThrows(invertedExpression, pData));
+				assertTrue(evaluationThrows(invalidExpression, pData));
+				assertTrue(evaluationThrows(missingGroupExpression, pData));
+			}
+
+			// Changing the values of a group does not outdate its unresolved bindings
+			fixture.m_pGroup->setIntParameterValueByName("layer", 43);
+			assertTrue(evaluationThrows(missingExpression, pData));
+
+			fixture.m_pGroup->addNewDoubleParameter("missing", "Added parameter", 2.5, 0.001);
+			fixture.m_pGroup->addNewBoolParameter("missingflag", "Added flag", true);
+			assertTrue(missingExpression.evaluateNumberValue(pData) == 2.5);
+			assertFalse(invertedExpression.evaluateBoolValue(pData));
+
+			auto pHandler = pData->getParameterHandler("main");
+			auto pLateGroup = pHandler->addGroup("lategroup", "Late group");
+			pLateGroup->addNewIntParameter("value", "Value", 5);
+			assertTrue(missingGroupExpression.evaluateIntegerValue(pData) == 5);
+
+			assertTrue(evaluationThrows(invalidExpression, pData));
+		}
+
+		void testEvaluationBenchmark()
+		{
+			const uint32_t nParameterCount = 500;
+			const uint32_t nExpressionCount = 5000;
+			const uint32_t nPollCount = 20;
+
+			auto fixture = createFixture();
+			auto pData = fixture.m_pStateMachineData.get();
+
+			for (uint32_t nIndex = 0; nIndex < nParameterCount; nIndex++)
+				fixture.m_pGroup->addNewDoubleParameter("value" + std::to_string(nIndex), "Generated value", (double)nIndex, 0.001);
+
+			pugi::xml_document xmlDocument;
+			std::vector<AMC::CUIExpression> expressions;
+			expressions.reserve(nExpressionCount);
+			for (uint32_t nIndex = 0; nIndex < nExpressionCount; nIndex++)
+				expressions.push_back(createExpression(xmlDocument, "main.jobinfo.value" + std::to_string(nIndex % nParameterCount), "%.3f"));
+
+			AMCCommon::CChrono chrono;
+			double dCheckSum = 0.0;
+
+			uint64_t nStartTime = chrono.getElapsedMicroseconds();
+			for (uint32_t nPoll = 0; nPoll < nPollCount; nPoll++) {
+				for (auto& expression : expressions) {
+					expression.invalidateBinding();
+					dCheckSum += expression.evaluateNumberValue(pData);
+				}
+			}
+			uint64_t nUnboundTime = chrono.getElapsedMicroseconds() - nStartTime;
+
+			nStartTime = chrono.getElapsedMicroseconds();
+			for (uint32_t nPoll = 0; nPoll < nPollCount; nPoll++) {
+				for (auto& expression : expressions)
+					dCheckSum -= expression.evaluateNumberValue(pData);
+			}
+			uint64_t nBoundTime = chrono.getElapsedMicroseconds() - nStartTime;
+
+			assertDoubleRange(dCheckSum, -0.001, 0.001);
+
+			double dEvaluationCount = (double)nExpressionCount * nPollCount;
+			logInfo("Unbound: " + std::to_string(nUnboundTime * 1000.0 / dEvaluationCount) + " ns per evaluation");
+			logInfo("Bound: " + std::to_string(nBoundTime * 1000.0 / dEvaluationCount) + " ns per evaluation");
+
+			assertTrue(nBoundTime <= nUnboundTime, "bound evaluation is slower than resolving");
+		}
+
+	};
+
+}
+
+#endif // __AMCTEST_UNITTEST_UIEXPRESSION
@@ -0,0 +1,240 @@
+/*++
+
+Copyright (C) 2025 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+#ifndef __AMCTEST_UNITTEST_UIPARAMETERLIST
+#define __AMCTEST_UNITTEST_UIPARAMETERLIST
+
+#define __AMCIMPL_UI_MODULE
+#define __AMCIMPL_API_CONSTANTS
+
+#include "amc_unittests.hpp"
+#include "amc_ui_module_contentitem_parameterlist.hpp"
+#include "amc_api_constants.hpp"
+#include "amc_jsonwriter.hpp"
+#include "amc_statemachinedata.hpp"
+#include "amc_parameterhandler.hpp"
+#include "amc_parametergroup.hpp"
+#include "common_chrono.hpp"
+
+#include "RapidJSON/document.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+
+namespace AMCUnitTest {
+
+	class CUnitTestGroup_UIParameterList : public CUnitTestGroup {
+	public:
+
+		std::string getTestGroupName() override {
+			return "UIParameterList";
+		}
+
+		void registerTests() override {
+			registerTest("FullResponse", "Clients without a valid state ID receive all rows", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_UIParameterList::testFullResponse, this));
+			registerTest("DeltaResponse", "Clients with a valid state ID receive only the changed rows", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_UIParameterList::testDeltaResponse, this));
+			registerTest("StatePerItem", "State IDs of one parameter list are not valid for another one", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_UIParameterList::testStatePerItem, this));
+			registerTest("LayoutChange", "A changed set of rows invalidates earlier state IDs", eUnitTestCategory::utMandatoryPass, std::bind(&CUnitTestGroup_UIParameterList::testLayoutChange, this));
+		}
+
+		void initializeTests() override {
+		}
+
+	private:
+
+		typedef struct _sListResponse {
+			uint32_t m_nStateID;
+			uint32_t m_nEntryCount;
+			bool m_bIsDelta;
+			std::vector<uint32_t> m_EntryIndices;
+			std::vector<std::string> m_EntryValues;
+		} sListResponse;
+
+		AMCCommon::PChrono m_pChrono;
+		AMC::PParameterGroup m_pGroup;
+		AMC::PStateMachineData m_pStateMachineData;
+
+		void createStateMachineData()
+		{
+			m_pChrono = std::make_shared<AMCCommon::CChrono>();
+
+			auto pParameterHandler = std::make_shared<AMC::CParameterHandler>("Machine", m_pChrono);
+			m_pGroup = pParameterHandler->addGroup("status", "Status");
+			m_pGroup->addNewIntParameter("layer", "Layer", 1);
+			m_pGroup->addNewIntParameter("temperature", "Temperature", 20);
+			m_pGroup->addNewIntParameter("pressure", "Pressure", 1000);
+
+			m_pStateMachineData = std::make_shared<AMC::CStateMachineData>();
+			m_pStateMachineData->registerParameterHandler("main", pParameterHandler, m_pChrono);
+		}
+
+		AMC::PUIModule_ContentParameterList createList()
+		{
+			auto pList = std::make_shared<AMC::CUIModule_ContentParameterList>("Loading", 25, m_pStateMachineData, "list", "main.status");
+			pList->addEntry("main", "status", "");
+			return pList;
+		}
+
+		sListResponse poll(AMC::PUIModule_ContentParameterList pList, uint32_t nStateID)
+		{
+			AMC::CJSONWriter writer;
+			AMC::CJSONWriterObject object(writer);
+			pList->addLegacyContentToJSON(writer, object, nullptr, nStateID);
+			writer.addObject("content", object);
+
+			rapidjson::Document document;
+			document.Parse(writer.saveToString().c_str());
+			assertFalse(document.HasParseError(), "Expected a valid JSON response");
+
+			auto& content = document["content"];
+			sListResponse response;
+			response.m_nStateID = content[AMC_API_KEY_UI_ITEMSTATEID].GetUint();
+			response.m_nEntryCount = content[AMC_API_KEY_UI_ITEMENTRYCOUNT].GetUint();
+			response.m_bIsDelta = content[AMC_API_KEY_UI_ITEMISDELTA].GetBool();
+			for (auto& entry : content[AMC_API_KEY_UI_ITEMENTRIES].GetArray()) {
+				response.m_EntryIndices.push_back(entry[AMC_API_KEY_UI_ITEMENTRYINDEX].GetUint());
+				response.m_EntryValues.push_back(entry[AMC_API_KEY_UI_ITEMPARAMETERVALUE].GetString());
+			}
+
+			return response;
+		}
+
+		void testFullResponse()
+		{
+			createStateMachineData();
+			auto pList = createList();
+
+			auto response = poll(pList, 0);
+			assertFalse(response.m_bIsDelta, "Expected a full response without state ID");
+			assertTrue(response.m_nStateID > 0, "Expected a state ID");
+			assertTrue(response.m_nEntryCount == 3);
+			assertTrue(response.m_EntryIndices == std::vector<uint32_t>({ 0, 1, 2 }));
+			assertTrue(response.m_EntryValues == std::vector<std::string>({ "1", "20", "1000" }));
+
+			// State IDs that this list never issued
+			for (uint32_t nInvalidStateID : { response.m_nStateID + 1, response.m_nStateID - 1, (uint32_t)INT32_MAX }) {
+				auto invalidResponse = poll(pList, nInvalidStateID);
+				assertFalse(invalidResponse.m_bIsDelta, "Expected a full response for an unknown state ID");
+				assertTrue(invalidResponse.m_EntryIndices.size() == 3);
+				assertTrue(invalidResponse.m_nStateID == response.m_nStateID, "Expected an unchanged state ID");
+			}
+		}
+
+		void testDeltaResponse()
+		{
+			createStateMachineData();
+			auto pList = createList();
+
+			auto fullResponse = poll(pList, 0);
+
+			// Nothing changed
+			auto response = poll(pList, fullResponse.m_nStateID);
+			assertTrue(response.m_bIsDelta, "Expected a delta response");
+			assertTrue(response.m_nStateID == fullResponse.m_nStateID, "Expected an unchanged state ID");
+			assertTrue(response.m_nEntryCount == 3);
+			assertTrue(response.m_EntryIndices.empty(), "Expected no rows");
+
+			// Setting the same value is not a change
+			m_pGroup->setIntParameterValueByName("temperature", 20);
+			response = poll(pList, fullResponse.m_nStateID);
+			assertTrue(response.m_EntryIndices.empty(), "Expected no rows for an unchanged value");
+
+			m_pGroup->setIntParameterValueByName("temperature", 25);
+			auto changedResponse = poll(pList, fullResponse.m_nStateID);
+			assertTrue(changedResponse.m_bIsDelta);
+			assertTrue(changedResponse.m_nStateID > fullResponse.m_nStateID, "Expected an advanced state ID");
+			assertTrue(changedResponse.m_EntryIndices == std::vector<uint32_t>({ 1 }));
+			assertTrue(changedResponse.m_EntryValues == std::vector<std::string>({ "25" }));
+
+			// A client on the new state does not get the row again, a client on the old state does
+			response = poll(pList, changedResponse.m_nStateID);
+			assertTrue(response.m_bIsDelta && response.m_EntryIndices.empty());
+			response = poll(pList, fullResponse.m_nStateID);
+			assertTrue(response.m_bIsDelta);
+			assertTrue(response.m_EntryIndices == std::vector<uint32_t>({ 1 }));
+
+			// Changes of several polls add up for a client that did not poll in between
+			m_pGroup->setIntParameterValueByName("pressure", 990);
+			auto secondChangeResponse = poll(pList, changedResponse.m_nStateID);
+			assertTrue(secondChangeResponse.m_EntryIndices == std::vector<uint32_t>({ 2 }));
+			m_pGroup->setIntParameterValueByName("layer", 2);
+			response = poll(pList, fullResponse.m_nStateID);
+			assertTrue(response.m_EntryIndices == std::vector<uint32_t>({ 0, 1, 2 }));
+			assertTrue(response.m_EntryValues == std::vector<std::string>({ "2", "25", "990" }));
+		}
+
+		void testStatePerItem()
+		{
+			createStateMachineData();
+			auto pFirstList = createList();
+			auto pSecondList = createList();
+
+			auto firstResponse = poll(pFirstList, 0);
+			auto secondResponse = poll(pSecondList, 0);
+			assertTrue(firstResponse.m_nStateID != secondResponse.m_nStateID, "Expected different state IDs per list");
+
+			// A change seen by the first list does not touch the state of the second one
+			m_pGroup->setIntParameterValueByName("layer", 5);
+			auto firstChangedResponse = poll(pFirstList, firstResponse.m_nStateID);
+			assertTrue(firstChangedResponse.m_EntryIndices == std::vector<uint32_t>({ 0 }));
+
+			auto secondChangedResponse = poll(pSecondList, secondResponse.m_nStateID);
+			assertTrue(secondChangedResponse.m_bIsDelta, "Expected a delta response of the second list");
+			assertTrue(secondChangedResponse.m_EntryIndices == std::vector<uint32_t>({ 0 }));
+
+			// The state ID of one list is not a valid state of the other one
+			auto crossResponse = poll(pSecondList, firstChangedResponse.m_nStateID);
+			assertFalse(crossResponse.m_bIsDelta, "Expected a full response for the state ID of another list");
+			assertTrue(crossResponse.m_EntryIndices.size() == 3);
+		}
+
+		void testLayoutChange()
+		{
+			createStateMachineData();
+			auto pList = createList();
+
+			auto fullResponse = poll(pList, 0);
+
+			m_pGroup->addNewIntParameter("speed", "Speed", 100);
+			auto response = poll(pList, fullResponse.m_nStateID);
+			assertFalse(response.m_bIsDelta, "Expected a full response after a layout change");
+			assertTrue(response.m_nEntryCount == 4);
+			assertTrue(response.m_EntryIndices == std::vector<uint32_t>({ 0, 1, 2, 3 }));
+
+			response = poll(pList, response.m_nStateID);
+			assertTrue(response.m_bIsDelta && response.m_EntryIndices.empty());
+		}
+
+	};
+
+}
+
+#endif // __AMCTEST_UNITTEST_UIPARAMETERLIST
@@ -0,0 +1,282 @@
+/*++
+
+Copyright (C) 2025 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "libmcplugin_impl.hpp"
+#include "libmcdriver_ads_dynamic.hpp"
+
+using namespace LibMCPlugin::Impl;
+
+#include <stdexcept>
+#include <cmath>
+
+
+/*************************************************************************************************************************
+ Import functionality for Driver into current plugin
+**************************************************************************************************************************/
+LIBMC_IMPORTDRIVERCLASSES(ADS, ADS)
+
+
+/*************************************************************************************************************************
+ Class definition of CTestData
+**************************************************************************************************************************/
+class CTestData : public virtual CPluginData {
+protected:
+	// We need to globally store driver wrappers in the plugin
+	PDriverCast_ADS m_DriverCast_ADS;
+
+public:
+
+	PDriver_ADS acquireADS(LibMCEnv::PStateEnvironment pStateEnvironment)
+	{
+		return m_DriverCast_ADS.acquireDriver(pStateEnvironment, "ads");
+	}
+
+};
+
+/*************************************************************************************************************************
+ Class definition of CTestState
+**************************************************************************************************************************/
+typedef CState<CTestData> CTestState;
+
+
+/*************************************************************************************************************************
+ Value set that is written to the mock PLC, once with single writes and once with a write batch
+**************************************************************************************************************************/
+class CADSTestValues {
+public:
+	int64_t m_nCounter;
+	int64_t m_nTarget;
+	int64_t m_nStep;
+	bool m_bEnabled;
+	double m_dPosition;
+	std::string m_sJobName;
+
+	CADSTestValues(uint32_t nRound)
+		: m_nCounter(1000 + nRound), m_nTarget(-50000 - (int64_t)nRound), m_nStep(nRound % 128), m_bEnabled((nRound % 2) == 1), m_dPosition(12.5 * nRound + 0.25), m_sJobName("job" + std::to_string(nRound))
+	{
+	}
+
+	void write(PDriver_ADS pDriver)
+	{
+		pDriver->WriteIntegerValue("counter", m_nCounter);
+		pDriver->WriteIntegerValue("target", m_nTarget);
+		pDriver->WriteIntegerValue("step", m_nStep);
+		pDriver->WriteBoolValue("enabled", m_bEnabled);
+		pDriver->WriteFloatValue("position", m_dPosition);
+		pDriver->WriteStringValue("jobname", m_sJobName);
+	}
+
+	// Compares against single reads of every variable
+	void checkSingleReads(PDriver_ADS pDriver, const std::string& sContext)
+	{
+		checkValues(pDriver->ReadIntegerValue("counter"), pDriver->ReadIntegerValue("target"), pDriver->ReadIntegerValue("step"),
+			pDriver->ReadBoolValue("enabled"), pDriver->ReadFloatValue("position"), pDriver->ReadStringValue("jobname"), sContext + " (single reads)");
+	}
+
+	// Compares against the driver parameters, which QueryParameters fills with batched sum reads
+	void checkBatchedReads(PDriver_ADS pDriver, LibMCEnv::PStateEnvironment pStateEnvironment, const std::string& sContext)
+	{
+		pDriver->QueryParameters();
+		checkValues(pStateEnvironment->GetIntegerParameter("adsstate", "counter"), pStateEnvironment->GetIntegerParameter("adsstate", "target"), pStateEnvironment->GetIntegerParameter("adsstate", "step"),
+			pStateEnvironment->GetBoolParameter("adsstate", "enabled"), pStateEnvironment->GetDoubleParameter("adsstate", "position"), pStateEnvironment->GetStringParameter("adsstate", "jobname"), sContext + " (batched reads)");
+	}
+
+	void checkValues(int64_t nCounter, int64_t nTarget, int64_t nStep, bool bEnabled, double dPosition, const std::string& sJobName, const std::string& sContext)
+	{
+		if ((nCounter != m_nCounter) || (nTarget != m_nTarget) || (nStep != m_nStep))
+			throw std::runtime_error("integer mismatch " + sContext + ": " + std::to_string(nCounter) + "/" + std::to_string(nTarget) + "/" + std::to_string(nStep));
+		if (bEnabled != m_bEnabled)
+			throw std::runtime_error("bool mismatch " + sContext);
+		if (std::fabs(dPosition - m_dPosition) > 1.0e-9)
+			throw std::runtime_error("float mismatch " + sContext + ": " + std::to_string(dPosition));
+		if (sJobName != m_sJobName)
+			throw std::runtime_error("string mismatch " + sContext + ": " + sJobName);
+	}
+
+};
+
+
+/*************************************************************************************************************************
+ Class definition of CTestState_Init
+**************************************************************************************************************************/
+class CTestState_Init : public virtual CTestState {
+public:
+
+	CTestState_Init(const std::string& sStateName, PPluginData pPluginData)
+		: CTestState(getStateName(), sStateName, pPluginData)
+	{
+	}
+
+	static const std::string getStateName()
+	{
+		return "init";
+	}
+
+
+	void Execute(LibMCEnv::PStateEnvironment pStateEnvironment)
+	{
+
+		if (pStateEnvironment.get() == nullptr)
+			throw ELibMCPluginInterfaceException(LIBMCPLUGIN_ERROR_INVALIDPARAM);
+
+		auto pDriver = m_pPluginData->acquireADS(pStateEnvironment);
+
+		std::string sSDKResource = pStateEnvironment->GetStringParameter("adsconfig", "sdkresource");
+		auto nPort = pStateEnvironment->GetIntegerParameter("adsconfig", "port");
+		auto nTimeout = pStateEnvironment->GetIntegerParameter("adsconfig", "timeout");
+		auto nRounds = pStateEnvironment->GetIntegerParameter("adsconfig", "rounds");
+
+		pStateEnvironment->LogMessage("Connecting to ADS SDK resource " + sSDKResource);
+		pDriver->SetCustomSDKResource(sSDKResource);
+		pDriver->Connect((uint32_t)nPort, (uint32_t)nTimeout);
+
+		for (uint32_t nRound = 0; nRound < (uint32_t)nRounds; nRound++) {
+
+			// Single writes, read back with single and batched reads
+			CADSTestValues singleValues(2 * nRound);
+			singleValues.write(pDriver);
+			singleValues.checkSingleReads(pDriver, "after single writes");
+			singleValues.checkBatchedReads(pDriver, pStateEnvironment, "after single writes");
+
+			// Batched writes must not reach the PLC before the commit
+			CADSTestValues batchedValues(2 * nRound + 1);
+			pDriver->BeginWriteBatch();
+			batchedValues.write(pDriver);
+			singleValues.checkSingleReads(pDriver, "before committing the write batch");
+			pDriver->CommitWriteBatch();
+
+			batchedValues.checkSingleReads(pDriver, "after batched writes");
+			batchedValues.checkBatchedReads(pDriver, pStateEnvironment, "after batched writes");
+		}
+
+		// Discarded batches must leave the PLC unchanged
+		CADSTestValues lastValues(2 * (uint32_t)nRounds - 1);
+		CADSTestValues discardedValues(2 * (uint32_t)nRounds);
+		pDriver->BeginWriteBatch();
+		discardedValues.write(pDriver);
+		pDriver->DiscardWriteBatch();
+		lastValues.checkSingleReads(pDriver, "after discarding the write batch");
+		lastValues.checkBatchedReads(pDriver, pStateEnvironment, "after discarding the write batch");
+
+		pStateEnvironment->LogMessage("Batched and single ADS access matched in " + std::to_string(nRounds) + " rounds");
+
+		pDriver->Disconnect();
+
+		pStateEnvironment->SetNextState("success");
+
+	}
+
+};
+
+
+
+/*************************************************************************************************************************
+ Class definition of CTestState_Success
+**************************************************************************************************************************/
+class CTestState_Success : public virtual CTestState {
+public:
+
+	CTestState_Success(const std::string& sStateName, PPluginData pPluginData)
+		: CTestState(getStateName(), sStateName, pPluginData)
+	{
+	}
+
+	static const std::string getStateName()
+	{
+		return "success";
+	}
+
+
+	void Execute(LibMCEnv::PStateEnvironment pStateEnvironment)
+	{
+
+		pStateEnvironment->SetNextState("success");
+
+	}
+
+};
+
+
+/*************************************************************************************************************************
+ Class definition of CTestState_FatalError
+**************************************************************************************************************************/
+class CTestState_FatalError : public virtual CTestState {
+public:
+
+	CTestState_FatalError(const std::string& sStateName, PPluginData pPluginData)
+		: CTestState(getStateName(), sStateName, pPluginData)
+	{
+	}
+
+	static const std::string getStateName()
+	{
+		return "fatalerror";
+	}
+
+
+	void Execute(LibMCEnv::PStateEnvironment pStateEnvironment)
+	{
+		if (pStateEnvironment.get() == nullptr)
+			throw ELibMCPluginInterfaceException(LIBMCPLUGIN_ERROR_INVALIDPARAM);
+
+		pStateEnvironment->SetNextState("fatalerror");
+	}
+
+};
+
+
+
+/*************************************************************************************************************************
+ Class definition of CStateFactory
+**************************************************************************************************************************/
+
+CStateFactory::CStateFactory(const std::string& sInstanceName)
+{
+	m_pPluginData = std::make_shared<CTestData>();
+}
+
+IState* CStateFactory::CreateState(const std::string& sStateName)
+{
+
+	IState* pStateInstance = nullptr;
+
+	if (createStateInstanceByName<CTestState_Init>(sStateName, pStateInstance, m_pPluginData))
+		return pStateInstance;
+
+	if (createStateInstanceByName<CTestState_Success>(sStateName, pStateInstance, m_pPluginData))
+		return pStateInstance;
+
+	if (createStateInstanceByName<CTestState_FatalError>(sStateName, pStateInstance, m_pPluginData))
+		return pStateInstance;
+
+	throw ELibMCPluginInterfaceException(LIBMCPLUGIN_ERROR_INVALIDSTATENAME);
+
+}
@@ -38,6 +38,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 using namespace LibMCPlugin::Impl;
 
 #include <iostream>
+#include <chrono>
+#include <stdexcept>
 
 #ifdef _MSC_VER
 #pragma warning(push)
@@ -111,6 +113,9 @@ public:
 		pDriver->Connect(sIPAddress, (uint32_t) nPort, (uint32_t) nTimeout);
 		pStateEnvironment->LogMessage("successful...");
 
+		uint32_t nMaxPacketsInFlight = (uint32_t)pStateEnvironment->GetIntegerParameter("pipelining", "maxpacketsinflight");
+		pDriver->SetMaxPacketsInFlight(nMaxPacketsInFlight);
+
 		pStateEnvironment->LogMessage("Create Command List");
 		auto pPLCCommandList = pDriver->CreateCommandList();
 
@@ -195,6 +200,60 @@ public:
 			pStateEnvironment->LogMessage("Movement timeout!");
 		}
 
+		uint32_t nBenchmarkCommands = (uint32_t)pStateEnvironment->GetIntegerParameter("benchmark", "listcommands");
+		uint32_t nBenchmarkRepetitions = (uint32_t)pStateEnvironment->GetIntegerParameter("benchmark", "repetitions");
+		if (nBenchmarkCommands > 0) {
+			for (uint32_t nRepetition = 0; nRepetition < nBenchmarkRepetitions; nRepetition++) {
+				auto pBenchmarkList = pDriver->CreateCommandList();
+				for (uint32_t nCommandIndex = 0; nCommandIndex < nBenchmarkCommands; nCommandIndex++) {
+					auto pPLCCommand_Move = pDriver->CreateCommand("move");
+					pPLCCommand_Move->SetIntegerParameter("targetx", 50000 + (nCommandIndex % 2) * 10000);
+					pPLCCommand_Move->SetIntegerParameter("targety", 10000);
+					pPLCCommand_Move->SetIntegerParameter("targetz", 2000);
+					pPLCCommand_Move->SetIntegerParameter("targete", 0);
+					pPLCCommand_Move->SetIntegerParameter("velocity", 5000);
+					pBenchmarkList->AddCommand(pPLCCommand_Move);
+				}
+				pBenchmarkList->FinishList();
+
+				auto startTime = std::chrono::high_resolution_clock::now();
+				pBenchmarkList->ExecuteList();
+				auto duration = std::chrono::high_resolution_clock::now() - startTime;
+				double dDurationInMS = (double)std::chrono::duration_cast<std::chrono::microseconds> (duration).count() / 1000.0;
+
+				pStateEnvironment->LogMessage("Benchmark #" + std::to_string(nRepetition) + ": executing list of " + std::to_string(nBenchmarkCommands) + " commands took " + std::to_string(dDurationInMS) + " ms");
+
+				pBenchmarkList->WaitForList(300, 10000);
+				pBenchmarkList->DeleteList();
+			}
+		}
+
+		// A list that is longer than the in-flight window has to be sent in several refills. The simulator
+		// checks the order of the sequence IDs and the window size, and never finishes the list if either is violated.
+		uint32_t nPipeliningCommands = (uint32_t)pStateEnvironment->GetIntegerParameter("pipelining", "listcommands");
+		if (nPipeliningCommands > 0) {
+			pStateEnvironment->LogMessage("Executing list of " + std::to_string(nPipeliningCommands) + " commands with " + std::to_string(nMaxPacketsInFlight) + " packets in flight");
+
+			auto pPipeliningList = pDriver->CreateCommandList();
+			for (uint32_t nCommandIndex = 0; nCommandIndex < nPipeliningCommands; nCommandIndex++) {
+				auto pPLCCommand_Move = pDriver->CreateCommand("move");
+				pPLCCommand_Move->SetIntegerParameter("targetx", nCommandIndex);
+				pPLCCommand_Move->SetIntegerParameter("targety", 10000);
+				pPLCCommand_Move->SetIntegerParameter("targetz", 2000);
+				pPLCCommand_Move->SetIntegerParameter("targete", 0);
+				pPLCCommand_Move->SetIntegerParameter("velocity", 5000);
+				pPipeliningList->AddCommand(pPLCCommand_Move);
+			}
+			pPipeliningList->FinishList();
+			pPipeliningList->ExecuteList();
+
+			if (!pPipeliningList->WaitForList(300, 10000))
+				throw std::runtime_error("pipelined list did not finish");
+
+			pPipeliningList->DeleteList();
+			pStateEnvironment->LogMessage("Pipelined list successful");
+		}
+
 		pStateEnvironment->SetNextState("success");
 	}
 
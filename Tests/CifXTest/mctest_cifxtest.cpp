@@ -35,6 +35,7 @@ using namespace LibMCPlugin::Impl;
 
 #include <iostream>
 #include <fstream>
+#include <stdexcept>
 
 
 /*************************************************************************************************************************
@@ -67,6 +68,59 @@ public:
 typedef CState<CTestData> CTestState;
 
 
+/*************************************************************************************************************************
+ Echo test against cifxsdk_mock: the simulated slave copies every output image into the input image, so each
+ echo_out_* value is decoded again from the double buffered input image as the echo_in_* value at the same address.
+**************************************************************************************************************************/
+class CCifXEchoTest {
+private:
+	PDriver_CifX m_pDriver;
+	LibMCEnv::PStateEnvironment m_pStateEnvironment;
+	uint32_t m_nTimeOutInMs;
+
+	bool inputsMatch(int64_t nCounter, int64_t nSigned, int64_t nWord, bool bFlagA, bool bFlagB)
+	{
+		return (m_pDriver->ReadIntegerValue("echo_in_counter") == nCounter) &&
+			(m_pDriver->ReadIntegerValue("echo_in_signed") == nSigned) &&
+			(m_pDriver->ReadIntegerValue("echo_in_word") == nWord) &&
+			(m_pDriver->ReadBoolValue("echo_in_flag_a") == bFlagA) &&
+			(m_pDriver->ReadBoolValue("echo_in_flag_b") == bFlagB);
+	}
+
+public:
+
+	CCifXEchoTest(PDriver_CifX pDriver, LibMCEnv::PStateEnvironment pStateEnvironment, uint32_t nTimeOutInMs)
+		: m_pDriver(pDriver), m_pStateEnvironment(pStateEnvironment), m_nTimeOutInMs(nTimeOutInMs)
+	{
+	}
+
+	void runRound(uint32_t nRound)
+	{
+		int64_t nCounter = 100000 + (int64_t)nRound * 7919;
+		int64_t nSigned = -1000 - (int64_t)nRound;
+		int64_t nWord = (nRound * 257) % 65536;
+		bool bFlagA = (nRound % 2) == 0;
+		bool bFlagB = (nRound % 3) == 0;
+
+		m_pDriver->WriteIntegerValue("echo_out_counter", nCounter, false, 0);
+		m_pDriver->WriteIntegerValue("echo_out_signed", nSigned, false, 0);
+		m_pDriver->WriteIntegerValue("echo_out_word", nWord, false, 0);
+		m_pDriver->WriteBoolValue("echo_out_flag_a", bFlagA, 0);
+		m_pDriver->WriteBoolValue("echo_out_flag_b", bFlagB, 0);
+
+		uint64_t nStartTime = m_pStateEnvironment->GetGlobalTimerInMilliseconds();
+		while (!inputsMatch(nCounter, nSigned, nWord, bFlagA, bFlagB)) {
+			if (m_pStateEnvironment->GetGlobalTimerInMilliseconds() - nStartTime > m_nTimeOutInMs)
+				throw std::runtime_error("echo round " + std::to_string(nRound) + " timed out: counter " + std::to_string(m_pDriver->ReadIntegerValue("echo_in_counter")) +
+					", signed " + std::to_string(m_pDriver->ReadIntegerValue("echo_in_signed")) + ", word " + std::to_string(m_pDriver->ReadIntegerValue("echo_in_word")));
+
+			m_pStateEnvironment->Sleep(1);
+		}
+	}
+
+};
+
+
 /*************************************************************************************************************************
  Class definition of CTestState_Init
 **************************************************************************************************************************/
@@ -93,13 +147,24 @@ public:
 		auto pDriver = m_pPluginData->acquireCifX(pStateEnvironment);
 
 		pStateEnvironment->LogMessage("Starting test");
-		pDriver->SetCustomSDKResource("cifxsdk_win64");
+		std::string sSDKResource = pStateEnvironment->GetStringParameter("cifxconfig", "sdkresource");
+		int64_t nCycles = pStateEnvironment->GetIntegerParameter("cifxconfig", "cycles");
+		pDriver->SetCustomSDKResource(sSDKResource);
 
 		pStateEnvironment->LogMessage("Connecting to Siemens PLC");
 		pDriver->Connect();
 		pStateEnvironment->LogMessage("Connected!");
 
-		for (int index = 0; index < 100; index++) {
+		int64_t nEchoRounds = pStateEnvironment->GetIntegerParameter("cifxconfig", "echorounds");
+		if (nEchoRounds > 0) {
+			pStateEnvironment->LogMessage("Running " + std::to_string(nEchoRounds) + " echo rounds");
+			CCifXEchoTest echoTest(pDriver, pStateEnvironment, (uint32_t)pStateEnvironment->GetIntegerParameter("cifxconfig", "echotimeout"));
+			for (int64_t nRound = 0; nRound < nEchoRounds; nRound++)
+				echoTest.runRound((uint32_t)nRound);
+			pStateEnvironment->LogMessage("Echo rounds passed");
+		}
+
+		for (int64_t index = 0; index < nCycles; index++) {
 			if (pDriver->ReadBoolValue("plc_alive")) {
 				pStateEnvironment->LogMessage("PLC is Alive: ON");
 				pDriver->WriteBoolValue("pc_alive", true, 1000);
@@ -112,6 +177,23 @@ public:
 			pStateEnvironment->Sleep(300);
 		}
 
+		uint32_t nChannelCount = pDriver->GetChannelCount();
+		for (uint32_t nChannelIndex = 0; nChannelIndex < nChannelCount; nChannelIndex++) {
+			auto pChannelInformation = pDriver->GetChannelInformation(nChannelIndex);
+
+			uint32_t nSucceededUpdates = 0;
+			uint32_t nUpdateErrors = 0;
+			double dMinimumDuration = 0.0;
+			double dMaximumDuration = 0.0;
+			double dAverageDuration = 0.0;
+			double dDurationVariance = 0.0;
+			pChannelInformation->GetConnectionStatistics(nSucceededUpdates, nUpdateErrors, dMinimumDuration, dMaximumDuration, dAverageDuration, dDurationVariance);
+
+			pStateEnvironment->LogMessage("Channel " + pChannelInformation->GetBoardName() + "/" + std::to_string(pChannelInformation->GetChannelIndex()) + ": " +
+				std::to_string(nSucceededUpdates) + " updates, " + std::to_string(nUpdateErrors) + " errors, update duration min/avg/max " +
+				std::to_string(dMinimumDuration) + "/" + std::to_string(dAverageDuration) + "/" + std::to_string(dMaximumDuration) + " ms, variance " + std::to_string(dDurationVariance));
+		}
+
 
 		pStateEnvironment->LogMessage("Disconnecting!");
 		pDriver->Disconnect();
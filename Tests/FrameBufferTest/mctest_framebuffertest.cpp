@@ -0,0 +1,488 @@
+/*++
+
+Copyright (C) 2020 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "libmcplugin_impl.hpp"
+#include "libmcdriver_framebuffer_dynamic.hpp"
+
+using namespace LibMCPlugin::Impl;
+
+#include <iostream>
+#include <stdexcept>
+
+
+/*************************************************************************************************************************
+ Import functionality for Driver into current plugin
+**************************************************************************************************************************/
+LIBMC_IMPORTDRIVERCLASSES(FrameBuffer, FrameBuffer)
+
+// Screen size of the simulated framebuffers. 128 is the minimum screen size of the driver.
+#define FRAMEBUFFERTEST_SCREENWIDTH 256
+#define FRAMEBUFFERTEST_SCREENHEIGHT 128
+
+
+/*************************************************************************************************************************
+ Class definition of CTestData
+**************************************************************************************************************************/
+class CTestData : public virtual CPluginData {
+protected:
+	// We need to globally store driver wrappers in the plugin
+	PDriverCast_FrameBuffer m_DriverCast_FrameBuffer;
+
+public:
+
+	PDriver_FrameBuffer acquireFrameBuffer(LibMCEnv::PStateEnvironment pStateEnvironment)
+	{
+		return m_DriverCast_FrameBuffer.acquireDriver(pStateEnvironment, "framebuffer");
+	}
+
+	// The tests use color values whose bits survive the conversion to RGB565, so that every bit depth reads back the same values.
+	static LibMCDriver_FrameBuffer::sColor makeColor(uint8_t nRed, uint8_t nGreen, uint8_t nBlue)
+	{
+		LibMCDriver_FrameBuffer::sColor color;
+		color.m_Red = nRed;
+		color.m_Green = nGreen;
+		color.m_Blue = nBlue;
+		return color;
+	}
+
+	static std::string getBitDepthName(LibMCDriver_FrameBuffer::eFrameBufferBitDepth bitDepth)
+	{
+		switch (bitDepth) {
+		case LibMCDriver_FrameBuffer::eFrameBufferBitDepth::RGB565: return "RGB565";
+		case LibMCDriver_FrameBuffer::eFrameBufferBitDepth::RGB888: return "RGB888";
+		case LibMCDriver_FrameBuffer::eFrameBufferBitDepth::RGBA8888: return "RGBA8888";
+		default: return "unknown";
+		}
+	}
+
+	static std::vector<LibMCDriver_FrameBuffer::eFrameBufferBitDepth> getBitDepths()
+	{
+		return { LibMCDriver_FrameBuffer::eFrameBufferBitDepth::RGB565, LibMCDriver_FrameBuffer::eFrameBufferBitDepth::RGB888, LibMCDriver_FrameBuffer::eFrameBufferBitDepth::RGBA8888 };
+	}
+
+	// Creates a new simulated framebuffer. A framebuffer of a previous run with the same identifier is released first.
+	LibMCDriver_FrameBuffer::PFrameBufferAccess createSimulation(LibMCEnv::PStateEnvironment pStateEnvironment, const std::string& sIdentifier, LibMCDriver_FrameBuffer::eFrameBufferBitDepth bitDepth)
+	{
+		auto pDriver = acquireFrameBuffer(pStateEnvironment);
+		if (pDriver->FrameBufferExists(sIdentifier))
+			pDriver->ReleaseFramebuffer(sIdentifier);
+
+		auto pFrameBuffer = pDriver->CreateFrameBufferSimulation(sIdentifier, FRAMEBUFFERTEST_SCREENWIDTH, FRAMEBUFFERTEST_SCREENHEIGHT, bitDepth);
+		if (!pFrameBuffer->UsesDoubleBuffering())
+			throw std::runtime_error("simulated framebuffer " + sIdentifier + " does not use double buffering");
+
+		return pFrameBuffer;
+	}
+
+	// Checks a pixel as it is shown on screen.
+	static void checkPixel(LibMCDriver_FrameBuffer::PFrameBufferAccess pFrameBuffer, int32_t nX, int32_t nY, const LibMCDriver_FrameBuffer::sColor& expectedColor, const std::string& sContext)
+	{
+		uint8_t nRed = 0;
+		uint8_t nGreen = 0;
+		uint8_t nBlue = 0;
+		pFrameBuffer->GetPixelRGB(nX, nY, nRed, nGreen, nBlue);
+
+		if ((nRed != expectedColor.m_Red) || (nGreen != expectedColor.m_Green) || (nBlue != expectedColor.m_Blue))
+			throw std::runtime_error(sContext + ": pixel " + std::to_string(nX) + "/" + std::to_string(nY) + " is " +
+				std::to_string(nRed) + "/" + std::to_string(nGreen) + "/" + std::to_string(nBlue) + " instead of " +
+				std::to_string(expectedColor.m_Red) + "/" + std::to_string(expectedColor.m_Green) + "/" + std::to_string(expectedColor.m_Blue));
+	}
+
+};
+
+/*************************************************************************************************************************
+ Class definition of CTestState
+**************************************************************************************************************************/
+typedef CState<CTestData> CTestState;
+
+
+/*************************************************************************************************************************
+ Class definition of CTestState_Init
+**************************************************************************************************************************/
+class CTestState_Init : public virtual CTestState {
+public:
+
+	CTestState_Init(const std::string& sStateName, PPluginData pPluginData)
+		: CTestState(getStateName(), sStateName, pPluginData)
+	{
+	}
+
+	static const std::string getStateName()
+	{
+		return "init";
+	}
+
+
+	void Execute(LibMCEnv::PStateEnvironment pStateEnvironment)
+	{
+		if (pStateEnvironment.get() == nullptr)
+			throw ELibMCPluginInterfaceException(LIBMCPLUGIN_ERROR_INVALIDPARAM);
+
+		auto pDriver = m_pPluginData->acquireFrameBuffer(pStateEnvironment);
+		if (!pDriver->SupportsSimulation())
+			throw std::runtime_error("framebuffer driver does not support simulation");
+
+		pStateEnvironment->SetNextState("partialredraw");
+	}
+
+};
+
+
+/*************************************************************************************************************************
+ Partial redraws across flips: after a flip, the draw buffer has to contain the frame that is shown. Regions of the last
+ frame are copied lazily, so drawing partly into such a region must keep the rest of it.
+**************************************************************************************************************************/
+class CTestState_PartialRedraw : public virtual CTestState {
+public:
+
+	CTestState_PartialRedraw(const std::string& sStateName, PPluginData pPluginData)
+		: CTestState(getStateName(), sStateName, pPluginData)
+	{
+	}
+
+	static const std::string getStateName()
+	{
+		return "partialredraw";
+	}
+
+
+	void Execute(LibMCEnv::PStateEnvironment pStateEnvironment)
+	{
+		if (pStateEnvironment.get() == nullptr)
+			throw ELibMCPluginInterfaceException(LIBMCPLUGIN_ERROR_INVALIDPARAM);
+
+		auto red = CTestData::makeColor(248, 0, 0);
+		auto green = CTestData::makeColor(0, 252, 0);
+		auto blue = CTestData::makeColor(0, 0, 248);
+		auto white = CTestData::makeColor(248, 252, 248);
+
+		for (auto bitDepth : CTestData::getBitDepths()) {
+			std::string sBitDepth = CTestData::getBitDepthName(bitDepth);
+			auto pFrameBuffer = m_pPluginData->createSimulation(pStateEnvironment, "partialredraw", bitDepth);
+
+			// Frame 1: full redraw
+			pFrameBuffer->ClearScreen(red);
+			pFrameBuffer->Flip();
+			CTestData::checkPixel(pFrameBuffer, 0, 0, red, sBitDepth + " frame 1");
+
+			// Frame 2: only a small rectangle changes, the background comes from frame 1
+			pFrameBuffer->FillRectangle(10, 10, 20, 20, green);
+			pFrameBuffer->Flip();
+			CTestData::checkPixel(pFrameBuffer, 15, 15, green, sBitDepth + " frame 2");
+			CTestData::checkPixel(pFrameBuffer, 5, 5, red, sBitDepth + " frame 2 background");
+
+			// Frame 3: the rectangle of frame 2 is not redrawn and has to be carried over
+			pFrameBuffer->FillRectangle(100, 100, 110, 110, blue);
+			pFrameBuffer->Flip();
+			CTestData::checkPixel(pFrameBuffer, 15, 15, green, sBitDepth + " frame 3 carried over");
+			CTestData::checkPixel(pFrameBuffer, 105, 105, blue, sBitDepth + " frame 3");
+
+			// Frame 4: the rectangle of frame 3 is still pending. It is partly overwritten by a rectangle and a pixel,
+			// so the rest of it has to be copied before drawing.
+			pFrameBuffer->FillRectangle(5, 5, 12, 12, white);
+			pFrameBuffer->FillRectangle(95, 95, 102, 102, white);
+			pFrameBuffer->SetPixel(108, 108, white);
+			pFrameBuffer->SetPixel(200, 50, white);
+			pFrameBuffer->Flip();
+			CTestData::checkPixel(pFrameBuffer, 12, 12, white, sBitDepth + " frame 4 rectangle");
+			CTestData::checkPixel(pFrameBuffer, 13, 13, green, sBitDepth + " frame 4 rectangle of frame 2");
+			CTestData::checkPixel(pFrameBuffer, 102, 102, white, sBitDepth + " frame 4 rectangle on pending region");
+			CTestData::checkPixel(pFrameBuffer, 103, 103, blue, sBitDepth + " frame 4 rest of pending region");
+			CTestData::checkPixel(pFrameBuffer, 110, 110, blue, sBitDepth + " frame 4 rest of pending region");
+			CTestData::checkPixel(pFrameBuffer, 108, 108, white, sBitDepth + " frame 4 pixel on pending region");
+			CTestData::checkPixel(pFrameBuffer, 107, 107, blue, sBitDepth + " frame 4 pixel neighbour");
+			CTestData::checkPixel(pFrameBuffer, 200, 50, white, sBitDepth + " frame 4 pixel on background");
+
+			// Frames 5 and 6 draw nothing and must show the same picture
+			for (uint32_t nFrame = 5; nFrame <= 6; nFrame++) {
+				pFrameBuffer->Flip();
+				std::string sContext = sBitDepth + " frame " + std::to_string(nFrame);
+				CTestData::checkPixel(pFrameBuffer, 0, 0, red, sContext);
+				CTestData::checkPixel(pFrameBuffer, 5, 5, white, sContext);
+				CTestData::checkPixel(pFrameBuffer, 16, 16, green, sContext);
+				CTestData::checkPixel(pFrameBuffer, 98, 98, white, sContext);
+				CTestData::checkPixel(pFrameBuffer, 105, 105, blue, sContext);
+				CTestData::checkPixel(pFrameBuffer, 108, 108, white, sContext);
+				CTestData::checkPixel(pFrameBuffer, 200, 50, white, sContext);
+				CTestData::checkPixel(pFrameBuffer, 255, 127, red, sContext);
+			}
+
+			m_pPluginData->acquireFrameBuffer(pStateEnvironment)->ReleaseFramebuffer("partialredraw");
+		}
+
+		pStateEnvironment->LogMessage("Partial redraws are consistent across flips");
+
+		pStateEnvironment->SetNextState("fillrectangle");
+	}
+
+};
+
+
+/*************************************************************************************************************************
+ FillRectangle in all bit depths, including the corner points, swapped corners and clipping at the screen border
+**************************************************************************************************************************/
+class CTestState_FillRectangle : public virtual CTestState {
+public:
+
+	CTestState_FillRectangle(const std::string& sStateName, PPluginData pPluginData)
+		: CTestState(getStateName(), sStateName, pPluginData)
+	{
+	}
+
+	static const std::string getStateName()
+	{
+		return "fillrectangle";
+	}
+
+
+	void Execute(LibMCEnv::PStateEnvironment pStateEnvironment)
+	{
+		if (pStateEnvironment.get() == nullptr)
+			throw ELibMCPluginInterfaceException(LIBMCPLUGIN_ERROR_INVALIDPARAM);
+
+		auto black = CTestData::makeColor(0, 0, 0);
+		auto orange = CTestData::makeColor(248, 128, 8);
+		auto teal = CTestData::makeColor(16, 200, 160);
+
+		for (auto bitDepth : CTestData::getBitDepths()) {
+			std::string sBitDepth = CTestData::getBitDepthName(bitDepth);
+			auto pFrameBuffer = m_pPluginData->createSimulation(pStateEnvironment, "fillrectangle", bitDepth);
+
+			pFrameBuffer->ClearScreen(black);
+			pFrameBuffer->FillRectangle(30, 40, 33, 41, orange);
+			pFrameBuffer->FillRectangleRGB(80, 60, 70, 50, teal.m_Red, teal.m_Green, teal.m_Blue);
+			pFrameBuffer->FillRectangle(-20, 120, 5, 200, teal);
+			pFrameBuffer->FillRectangle(250, -5, 400, 2, orange);
+			pFrameBuffer->FillRectangle(-10, -10, -1, -1, orange);
+			pFrameBuffer->Flip();
+
+			CTestData::checkPixel(pFrameBuffer, 30, 40, orange, sBitDepth + " first corner");
+			CTestData::checkPixel(pFrameBuffer, 33, 41, orange, sBitDepth + " second corner");
+			CTestData::checkPixel(pFrameBuffer, 29, 40, black, sBitDepth + " left of rectangle");
+			CTestData::checkPixel(pFrameBuffer, 34, 41, black, sBitDepth + " right of rectangle");
+			CTestData::checkPixel(pFrameBuffer, 33, 42, black, sBitDepth + " below rectangle");
+
+			CTestData::checkPixel(pFrameBuffer, 70, 50, teal, sBitDepth + " swapped corners");
+			CTestData::checkPixel(pFrameBuffer, 80, 60, teal, sBitDepth + " swapped corners");
+			CTestData::checkPixel(pFrameBuffer, 69, 55, black, sBitDepth + " left of swapped rectangle");
+
+			CTestData::checkPixel(pFrameBuffer, 0, 127, teal, sBitDepth + " clipped at bottom left");
+			CTestData::checkPixel(pFrameBuffer, 5, 120, teal, sBitDepth + " clipped at bottom left");
+			CTestData::checkPixel(pFrameBuffer, 6, 120, black, sBitDepth + " right of clipped rectangle");
+
+			CTestData::checkPixel(pFrameBuffer, 255, 0, orange, sBitDepth + " clipped at top right");
+			CTestData::checkPixel(pFrameBuffer, 250, 2, orange, sBitDepth + " clipped at top right");
+			CTestData::checkPixel(pFrameBuffer, 249, 2, black, sBitDepth + " left of clipped rectangle");
+
+			CTestData::checkPixel(pFrameBuffer, 0, 0, black, sBitDepth + " rectangle outside of screen");
+
+			m_pPluginData->acquireFrameBuffer(pStateEnvironment)->ReleaseFramebuffer("fillrectangle");
+		}
+
+		pStateEnvironment->LogMessage("FillRectangle is correct in all bit depths");
+
+		pStateEnvironment->SetNextState("drawimage");
+	}
+
+};
+
+
+/*************************************************************************************************************************
+ DrawImage with images that reach over every screen border or lie completely outside of the screen
+**************************************************************************************************************************/
+class CTestState_DrawImage : public virtual CTestState {
+public:
+
+	CTestState_DrawImage(const std::string& sStateName, PPluginData pPluginData)
+		: CTestState(getStateName(), sStateName, pPluginData)
+	{
+	}
+
+	static const std::string getStateName()
+	{
+		return "drawimage";
+	}
+
+
+	void Execute(LibMCEnv::PStateEnvironment pStateEnvironment)
+	{
+		if (pStateEnvironment.get() == nullptr)
+			throw ELibMCPluginInterfaceException(LIBMCPLUGIN_ERROR_INVALIDPARAM);
+
+		const int32_t nImageSizeX = 40;
+		const int32_t nImageSizeY = 30;
+		const int32_t nScreenWidth = FRAMEBUFFERTEST_SCREENWIDTH;
+		const int32_t nScreenHeight = FRAMEBUFFERTEST_SCREENHEIGHT;
+
+		auto black = CTestData::makeColor(0, 0, 0);
+		auto white = CTestData::makeColor(248, 252, 248);
+		auto fullWhite = CTestData::makeColor(255, 255, 255);
+
+		// Grey scale pixels have the same value in every channel, independent of the channel order of the target format
+		auto pImage = pStateEnvironment->CreateEmptyImage(nImageSizeX, nImageSizeY, 96.0, 96.0, LibMCEnv::eImagePixelFormat::GreyScale8bit);
+		pImage->Clear(255);
+
+		for (auto bitDepth : CTestData::getBitDepths()) {
+			std::string sBitDepth = CTestData::getBitDepthName(bitDepth);
+			auto imageColor = (bitDepth == LibMCDriver_FrameBuffer::eFrameBufferBitDepth::RGB565) ? white : fullWhite;
+
+			auto pFrameBuffer = m_pPluginData->createSimulation(pStateEnvironment, "drawimage", bitDepth);
+
+			pFrameBuffer->ClearScreen(black);
+			pFrameBuffer->DrawImage(-10, -5, pImage);
+			pFrameBuffer->DrawImage(nScreenWidth - 15, nScreenHeight - 20, pImage);
+			pFrameBuffer->DrawImage(100, 50, pImage);
+			pFrameBuffer->DrawImage(-nImageSizeX, 60, pImage);
+			pFrameBuffer->DrawImage(nScreenWidth, 60, pImage);
+			pFrameBuffer->DrawImage(150, -nImageSizeY, pImage);
+			pFrameBuffer->DrawImage(150, nScreenHeight, pImage);
+			pFrameBuffer->Flip();
+
+			CTestData::checkPixel(pFrameBuffer, 0, 0, imageColor, sBitDepth + " image clipped at top left");
+			CTestData::checkPixel(pFrameBuffer, nImageSizeX - 11, nImageSizeY - 6, imageColor, sBitDepth + " image clipped at top left");
+			CTestData::checkPixel(pFrameBuffer, nImageSizeX - 10, 0, black, sBitDepth + " right of image clipped at top left");
+			CTestData::checkPixel(pFrameBuffer, 0, nImageSizeY - 5, black, sBitDepth + " below image clipped at top left");
+
+			CTestData::checkPixel(pFrameBuffer, nScreenWidth - 1, nScreenHeight - 1, imageColor, sBitDepth + " image clipped at bottom right");
+			CTestData::checkPixel(pFrameBuffer, nScreenWidth - 15, nScreenHeight - 20, imageColor, sBitDepth + " image clipped at bottom right");
+			CTestData::checkPixel(pFrameBuffer, nScreenWidth - 16, nScreenHeight - 1, black, sBitDepth + " left of image clipped at bottom right");
+
+			CTestData::checkPixel(pFrameBuffer, 100, 50, imageColor, sBitDepth + " image inside of screen");
+			CTestData::checkPixel(pFrameBuffer, 100 + nImageSizeX - 1, 50 + nImageSizeY - 1, imageColor, sBitDepth + " image inside of screen");
+			CTestData::checkPixel(pFrameBuffer, 100 + nImageSizeX, 50, black, sBitDepth + " right of image inside of screen");
+
+			CTestData::checkPixel(pFrameBuffer, 0, 60, black, sBitDepth + " image left of screen");
+			CTestData::checkPixel(pFrameBuffer, nScreenWidth - 1, 60, black, sBitDepth + " image right of screen");
+			CTestData::checkPixel(pFrameBuffer, 150, 0, black, sBitDepth + " image above screen");
+			CTestData::checkPixel(pFrameBuffer, 150, nScreenHeight - 1, black, sBitDepth + " image below screen");
+
+			m_pPluginData->acquireFrameBuffer(pStateEnvironment)->ReleaseFramebuffer("drawimage");
+		}
+
+		pStateEnvironment->LogMessage("DrawImage is clipped correctly in all bit depths");
+
+		pStateEnvironment->SetNextState("success");
+	}
+
+};
+
+
+/*************************************************************************************************************************
+ Class definition of CTestState_Success
+**************************************************************************************************************************/
+class CTestState_Success : public virtual CTestState {
+public:
+
+	CTestState_Success(const std::string& sStateName, PPluginData pPluginData)
+		: CTestState(getStateName(), sStateName, pPluginData)
+	{
+	}
+
+	static const std::string getStateName()
+	{
+		return "success";
+	}
+
+
+	void Execute(LibMCEnv::PStateEnvironment pStateEnvironment)
+	{
+		if (pStateEnvironment.get() == nullptr)
+			throw ELibMCPluginInterfaceException(LIBMCPLUGIN_ERROR_INVALIDPARAM);
+
+		pStateEnvironment->SetNextState("success");
+	}
+
+};
+
+
+/*************************************************************************************************************************
+ Class definition of CTestState_FatalError
+**************************************************************************************************************************/
+class CTestState_FatalError : public virtual CTestState {
+public:
+
+	CTestState_FatalError(const std::string& sStateName, PPluginData pPluginData)
+		: CTestState(getStateName(), sStateName, pPluginData)
+	{
+	}
+
+	static const std::string getStateName()
+	{
+		return "fatalerror";
+	}
+
+
+	void Execute(LibMCEnv::PStateEnvironment pStateEnvironment)
+	{
+		if (pStateEnvironment.get() == nullptr)
+			throw ELibMCPluginInterfaceException(LIBMCPLUGIN_ERROR_INVALIDPARAM);
+
+		pStateEnvironment->SetNextState("fatalerror");
+	}
+
+};
+
+
+
+/*************************************************************************************************************************
+ Class definition of CStateFactory
+**************************************************************************************************************************/
+
+CStateFactory::CStateFactory(const std::string& sInstanceName)
+{
+	m_pPluginData = std::make_shared<CTestData>();
+}
+
+IState* CStateFactory::CreateState(const std::string& sStateName)
+{
+
+	IState* pStateInstance = nullptr;
+
+	if (createStateInstanceByName<CTestState_Init>(sStateName, pStateInstance, m_pPluginData))
+		return pStateInstance;
+
+	if (createStateInstanceByName<CTestState_PartialRedraw>(sStateName, pStateInstance, m_pPluginData))
+		return pStateInstance;
+
+	if (createStateInstanceByName<CTestState_FillRectangle>(sStateName, pStateInstance, m_pPluginData))
+		return pStateInstance;
+
+	if (createStateInstanceByName<CTestState_DrawImage>(sStateName, pStateInstance, m_pPluginData))
+		return pStateInstance;
+
+	if (createStateInstanceByName<CTestState_Success>(sStateName, pStateInstance, m_pPluginData))
+		return pStateInstance;
+
+	if (createStateInstanceByName<CTestState_FatalError>(sStateName, pStateInstance, m_pPluginData))
+		return pStateInstance;
+
+	throw ELibMCPluginInterfaceException(LIBMCPLUGIN_ERROR_INVALIDSTATENAME);
+
+}
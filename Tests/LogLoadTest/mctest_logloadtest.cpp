@@ -0,0 +1,233 @@
+/*++
+
+Copyright (C) 2024 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "libmcplugin_impl.hpp"
+
+using namespace LibMCPlugin::Impl;
+
+#include <stdint.h>
+#include <string>
+
+/*************************************************************************************************************************
+ Import functionality for Driver into current plugin
+**************************************************************************************************************************/
+__NODRIVERIMPORT
+
+
+/*************************************************************************************************************************
+ Class definition of CLogLoadData
+**************************************************************************************************************************/
+class CLogLoadData : public virtual CPluginData {
+public:
+	std::string m_sInstanceName;
+	uint32_t m_nLogged;
+	uint32_t m_nMaxCount;
+	uint32_t m_nLinesPerCycle;
+	uint64_t m_nStartTimeInMicroseconds;
+	uint64_t m_nMaxCycleTimeInMicroseconds;
+
+	CLogLoadData(const std::string& sInstanceName)
+		: m_sInstanceName(sInstanceName), m_nLogged(0), m_nMaxCount(100000), m_nLinesPerCycle(256), m_nStartTimeInMicroseconds(0), m_nMaxCycleTimeInMicroseconds(0)
+	{
+	}
+};
+
+typedef CState<CLogLoadData> CLogLoadState;
+
+
+/*************************************************************************************************************************
+ Class definition of CLogLoadState_Init
+**************************************************************************************************************************/
+class CLogLoadState_Init : public virtual CLogLoadState {
+public:
+
+	CLogLoadState_Init(const std::string& sStateName, PPluginData pPluginData)
+		: CLogLoadState(getStateName(), sStateName, pPluginData)
+	{
+	}
+
+	static const std::string getStateName()
+	{
+		return "init";
+	}
+
+	void Execute(LibMCEnv::PStateEnvironment pStateEnvironment)
+	{
+		if (pStateEnvironment.get() == nullptr)
+			throw ELibMCPluginInterfaceException(LIBMCPLUGIN_ERROR_INVALIDPARAM);
+
+		m_pPluginData->m_nLogged = 0;
+		m_pPluginData->m_nMaxCycleTimeInMicroseconds = 0;
+		m_pPluginData->m_nStartTimeInMicroseconds = pStateEnvironment->GetGlobalTimerInMicroseconds();
+
+		pStateEnvironment->SetNextState("run");
+	}
+
+};
+
+
+/*************************************************************************************************************************
+ Class definition of CLogLoadState_Run
+**************************************************************************************************************************/
+class CLogLoadState_Run : public virtual CLogLoadState {
+public:
+
+	CLogLoadState_Run(const std::string& sStateName, PPluginData pPluginData)
+		: CLogLoadState(getStateName(), sStateName, pPluginData)
+	{
+	}
+
+	static const std::string getStateName()
+	{
+		return "run";
+	}
+
+	void Execute(LibMCEnv::PStateEnvironment pStateEnvironment)
+	{
+		if (pStateEnvironment.get() == nullptr)
+			throw ELibMCPluginInterfaceException(LIBMCPLUGIN_ERROR_INVALIDPARAM);
+
+		uint64_t nCycleStartTime = pStateEnvironment->GetGlobalTimerInMicroseconds();
+
+		uint32_t nLinesInCycle = 0;
+		while ((m_pPluginData->m_nLogged < m_pPluginData->m_nMaxCount) && (nLinesInCycle < m_pPluginData->m_nLinesPerCycle)) {
+			pStateEnvironment->LogInfo("log load line " + std::to_string(m_pPluginData->m_nLogged) + " of " + m_pPluginData->m_sInstanceName);
+			m_pPluginData->m_nLogged++;
+			nLinesInCycle++;
+		}
+
+		uint64_t nCycleEndTime = pStateEnvironment->GetGlobalTimerInMicroseconds();
+		uint64_t nCycleTime = nCycleEndTime - nCycleStartTime;
+		if (nCycleTime > m_pPluginData->m_nMaxCycleTimeInMicroseconds)
+			m_pPluginData->m_nMaxCycleTimeInMicroseconds = nCycleTime;
+
+		if (m_pPluginData->m_nLogged >= m_pPluginData->m_nMaxCount) {
+			uint64_t nTotalTime = nCycleEndTime - m_pPluginData->m_nStartTimeInMicroseconds;
+			if (nTotalTime == 0)
+				nTotalTime = 1;
+
+			uint64_t nLinesPerSecond = ((uint64_t)m_pPluginData->m_nLogged * 1000000ULL) / nTotalTime;
+
+			pStateEnvironment->LogMessage("Logged " + std::to_string(m_pPluginData->m_nLogged) + " lines in " + std::to_string(nTotalTime / 1000) + " ms: "
+				+ std::to_string(nLinesPerSecond) + " lines per second, maximum cycle time " + std::to_string(m_pPluginData->m_nMaxCycleTimeInMicroseconds) + " us");
+
+			pStateEnvironment->SetNextState("success");
+			return;
+		}
+
+		pStateEnvironment->SetNextState("run");
+	}
+
+};
+
+
+/*************************************************************************************************************************
+ Class definition of CLogLoadState_Success
+**************************************************************************************************************************/
+class CLogLoadState_Success : public virtual CLogLoadState {
+public:
+
+	CLogLoadState_Success(const std::string& sStateName, PPluginData pPluginData)
+		: CLogLoadState(getStateName(), sStateName, pPluginData)
+	{
+	}
+
+	static const std::string getStateName()
+	{
+		return "success";
+	}
+
+	void Execute(LibMCEnv::PStateEnvironment pStateEnvironment)
+	{
+		if (pStateEnvironment.get() == nullptr)
+			throw ELibMCPluginInterfaceException(LIBMCPLUGIN_ERROR_INVALIDPARAM);
+
+		pStateEnvironment->SetNextState("success");
+	}
+
+};
+
+
+/*************************************************************************************************************************
+ Class definition of CLogLoadState_FatalError
+**************************************************************************************************************************/
+class CLogLoadState_FatalError : public virtual CLogLoadState {
+public:
+
+	CLogLoadState_FatalError(const std::string& sStateName, PPluginData pPluginData)
+		: CLogLoadState(getStateName(), sStateName, pPluginData)
+	{
+	}
+
+	static const std::string getStateName()
+	{
+		return "fatalerror";
+	}
+
+	void Execute(LibMCEnv::PStateEnvironment pStateEnvironment)
+	{
+		if (pStateEnvironment.get() == nullptr)
+			throw ELibMCPluginInterfaceException(LIBMCPLUGIN_ERROR_INVALIDPARAM);
+
+		pStateEnvironment->SetNextState("fatalerror");
+	}
+
+};
+
+
+/*************************************************************************************************************************
+ Class definition of CStateFactory
+**************************************************************************************************************************/
+
+CStateFactory::CStateFactory(const std::string& sInstanceName)
+{
+	m_pPluginData = std::make_shared<CLogLoadData>(sInstanceName);
+}
+
+IState* CStateFactory::CreateState(const std::string& sStateName)
+{
+
+	IState* pStateInstance = nullptr;
+
+	if (createStateInstanceByName<CLogLoadState_Init>(sStateName, pStateInstance, m_pPluginData))
+		return pStateInstance;
+
+	if (createStateInstanceByName<CLogLoadState_Run>(sStateName, pStateInstance, m_pPluginData))
+		return pStateInstance;
+
+	if (createStateInstanceByName<CLogLoadState_Success>(sStateName, pStateInstance, m_pPluginData))
+		return pStateInstance;
+
+	if (createStateInstanceByName<CLogLoadState_FatalError>(sStateName, pStateInstance, m_pPluginData))
+		return pStateInstance;
+
+	throw ELibMCPluginInterfaceException(LIBMCPLUGIN_ERROR_INVALIDSTATENAME);
+
+}
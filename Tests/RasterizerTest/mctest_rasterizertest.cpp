@@ -35,6 +35,7 @@ using namespace LibMCPlugin::Impl;
 
 #include <iostream>
 #include <fstream>
+#include <cmath>
 
 
 /*************************************************************************************************************************
@@ -58,6 +59,70 @@ public:
 		return m_DriverCast_Rasterizer.acquireDriver(pStateEnvironment, "rasterizer");
 	}
 
+	// Creates a layer with a grid of wavy circles, so that most blocks of the image are border blocks.
+	LibMCDriver_Rasterizer::PLayerObject createStressLayer(PDriver_Rasterizer pDriver, double dOffset)
+	{
+		const double dPi = 3.14159265358979323846;
+		const uint32_t nPointCount = 256;
+
+		auto pLayer = pDriver->CreateEmptyLayer();
+		for (uint32_t nCircleY = 0; nCircleY < 12; nCircleY++) {
+			for (uint32_t nCircleX = 0; nCircleX < 20; nCircleX++) {
+				double dCenterX = 12.0 + nCircleX * 24.0 + dOffset;
+				double dCenterY = 12.0 + nCircleY * 24.0;
+				double dRadius = 8.0 + (double) ((nCircleX + nCircleY) % 3);
+
+				std::vector<LibMCDriver_Rasterizer::sPosition2D> PointsBuffer;
+				for (uint32_t nIndex = 0; nIndex < nPointCount; nIndex++) {
+					double dAngle = 2.0 * dPi * (double)nIndex / (double)nPointCount;
+					double dWavyRadius = dRadius * (1.0 + 0.2 * sin(7.0 * dAngle));
+					PointsBuffer.push_back({ dCenterX + dWavyRadius * cos(dAngle), dCenterY + dWavyRadius * sin(dAngle) });
+				}
+
+				pLayer->AddEntity(PointsBuffer, LibMCDriver_Rasterizer::eGeometryType::SolidGeometry);
+			}
+		}
+
+		return pLayer;
+	}
+
+	// Rasterizes three offset stress layers with the given thread count. Returns the calculation time in microseconds.
+	uint64_t rasterizeStressLayers(LibMCEnv::PStateEnvironment pStateEnvironment, uint32_t nThreadCount, std::vector<LibMCEnv_uint8> & pixelBuffer)
+	{
+		const uint32_t nPixelSizeX = 4800;
+		const uint32_t nPixelSizeY = 2880;
+
+		auto pDriver = acquireRasterizer(pStateEnvironment);
+
+		std::string sInstanceName = "stress_" + std::to_string(nThreadCount);
+		if (pDriver->HasInstance(sInstanceName))
+			pDriver->UnregisterInstance(sInstanceName);
+
+		auto pRasterizer = pDriver->RegisterInstance(sInstanceName, nPixelSizeX, nPixelSizeY, 254.0, 254.0);
+		pRasterizer->SetSamplingParameters(64, 16);
+		pRasterizer->SetSubsampling(4, 4);
+		if (pRasterizer->GetThreadCount() != 1)
+			throw std::runtime_error("rasterization should be single threaded by default");
+		pRasterizer->SetThreadCount(nThreadCount);
+		if (pRasterizer->GetThreadCount() != nThreadCount)
+			throw std::runtime_error("thread count mismatch");
+
+		for (uint32_t nLayerIndex = 0; nLayerIndex < 3; nLayerIndex++)
+			pRasterizer->AddLayer(createStressLayer(pDriver, nLayerIndex * 0.05));
+
+		auto pImage = pStateEnvironment->CreateEmptyImage(nPixelSizeX, nPixelSizeY, 254.0, 254.0, LibMCEnv::eImagePixelFormat::GreyScale8bit);
+
+		uint64_t nStartTime = pStateEnvironment->GetGlobalTimerInMicroseconds();
+		pRasterizer->CalculateImage(pImage, true);
+		uint64_t nEndTime = pStateEnvironment->GetGlobalTimerInMicroseconds();
+
+		pImage->GetPixels(0, 0, nPixelSizeX, nPixelSizeY, LibMCEnv::eImagePixelFormat::GreyScale8bit, pixelBuffer);
+
+		pDriver->UnregisterInstance(sInstanceName);
+
+		return nEndTime - nStartTime;
+	}
+
 };
 
 /*************************************************************************************************************************
@@ -110,15 +175,116 @@ public:
 
 		pRasterizer->CalculateImage(pImage, true);
 
-		pImage->EncodePNG();
+		auto pPNGImage = pImage->CreatePNGImage(nullptr);
 		std::vector<uint8_t> pngData;
-		pImage->GetEncodedPNGData (pngData);
+		pPNGImage->GetPNGDataStream (pngData);
 
 		std::ofstream pngStream("output.png", std::ios::binary | std::ios::out);
 		if (pngData.size() > 0)
 			pngStream.write((const char*)pngData.data(), pngData.size());
 		pngStream.close();
 
+		pStateEnvironment->SetNextState("determinism");
+	}
+
+};
+
+
+/*************************************************************************************************************************
+ Class definition of CRasterizerState_Determinism
+**************************************************************************************************************************/
+class CRasterizerState_Determinism : public virtual CRasterizerState {
+public:
+
+	CRasterizerState_Determinism(const std::string& sStateName, PPluginData pPluginData)
+		: CRasterizerState(getStateName(), sStateName, pPluginData)
+	{
+	}
+
+	static const std::string getStateName()
+	{
+		return "determinism";
+	}
+
+
+	void Execute(LibMCEnv::PStateEnvironment pStateEnvironment)
+	{
+		if (pStateEnvironment.get() == nullptr)
+			throw ELibMCPluginInterfaceException(LIBMCPLUGIN_ERROR_INVALIDPARAM);
+
+		std::vector<LibMCEnv_uint8> referenceBuffer;
+		m_pPluginData->rasterizeStressLayers(pStateEnvironment, 1, referenceBuffer);
+
+		uint64_t nFilledPixels = 0;
+		for (auto nValue : referenceBuffer) {
+			if (nValue != 0)
+				nFilledPixels++;
+		}
+		if (nFilledPixels == 0)
+			throw std::runtime_error("rasterized image is empty");
+
+		// 3 does not divide the block row count evenly
+		std::vector<uint32_t> threadCounts = { 2, 3, 8, 64 };
+		for (auto nThreadCount : threadCounts) {
+			std::vector<LibMCEnv_uint8> pixelBuffer;
+			m_pPluginData->rasterizeStressLayers(pStateEnvironment, nThreadCount, pixelBuffer);
+
+			if (pixelBuffer != referenceBuffer)
+				throw std::runtime_error("rasterization result with " + std::to_string(nThreadCount) + " threads differs from single threaded result");
+		}
+
+		pStateEnvironment->LogMessage("Rasterization is deterministic (" + std::to_string(nFilledPixels) + " filled pixels)");
+
+		pStateEnvironment->SetNextState("benchmark");
+	}
+
+};
+
+
+/*************************************************************************************************************************
+ Class definition of CRasterizerState_Benchmark
+**************************************************************************************************************************/
+class CRasterizerState_Benchmark : public virtual CRasterizerState {
+public:
+
+	CRasterizerState_Benchmark(const std::string& sStateName, PPluginData pPluginData)
+		: CRasterizerState(getStateName(), sStateName, pPluginData)
+	{
+	}
+
+	static const std::string getStateName()
+	{
+		return "benchmark";
+	}
+
+
+	void Execute(LibMCEnv::PStateEnvironment pStateEnvironment)
+	{
+		if (pStateEnvironment.get() == nullptr)
+			throw ELibMCPluginInterfaceException(LIBMCPLUGIN_ERROR_INVALIDPARAM);
+
+		const uint32_t nRepetitions = 3;
+
+		std::vector<uint32_t> threadCounts = { 1, 2, 4, 8 };
+		uint64_t nSingleThreadedTime = 0;
+		for (auto nThreadCount : threadCounts) {
+
+			// Take the best of several runs to reduce scheduling noise
+			uint64_t nBestTime = 0;
+			for (uint32_t nRepetition = 0; nRepetition < nRepetitions; nRepetition++) {
+				std::vector<LibMCEnv_uint8> pixelBuffer;
+				uint64_t nTime = m_pPluginData->rasterizeStressLayers(pStateEnvironment, nThreadCount, pixelBuffer);
+				if ((nRepetition == 0) || (nTime < nBestTime))
+					nBestTime = nTime;
+			}
+
+			if (nThreadCount == 1)
+				nSingleThreadedTime = nBestTime;
+
+			double dSpeedUp = (nBestTime > 0) ? ((double)nSingleThreadedTime / (double)nBestTime) : 0.0;
+			pStateEnvironment->LogMessage("Rasterization with " + std::to_string(nThreadCount) + " threads: " + std::to_string(nBestTime / 1000) + " ms (speed up " + std::to_string(dSpeedUp) + ")");
+		}
+
 		pStateEnvironment->SetNextState("success");
 	}
 
@@ -199,6 +365,12 @@ IState* CStateFactory::CreateState(const std::string& sStateName)
 	if (createStateInstanceByName<CRasterizerState_Init>(sStateName, pStateInstance, m_pPluginData))
 		return pStateInstance;
 
+	if (createStateInstanceByName<CRasterizerState_Determinism>(sStateName, pStateInstance, m_pPluginData))
+		return pStateInstance;
+
+	if (createStateInstanceByName<CRasterizerState_Benchmark>(sStateName, pStateInstance, m_pPluginData))
+		return pStateInstance;
+
 
 	if (createStateInstanceByName<CRasterizerState_Success>(sStateName, pStateInstance, m_pPluginData))
 		return pStateInstance;
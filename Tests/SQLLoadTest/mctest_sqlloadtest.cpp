@@ -0,0 +1,368 @@
+/*++
+
+Copyright (C) 2024 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "libmcplugin_impl.hpp"
+
+using namespace LibMCPlugin::Impl;
+
+#include <stdint.h>
+#include <string>
+#include <cstdio>
+#include <functional>
+
+/*************************************************************************************************************************
+ Import functionality for Driver into current plugin
+**************************************************************************************************************************/
+__NODRIVERIMPORT
+
+
+/*************************************************************************************************************************
+ Class definition of CSQLLoadData
+**************************************************************************************************************************/
+class CSQLLoadData : public virtual CPluginData {
+public:
+	std::string m_sInstanceName;
+	uint32_t m_nQueries;
+	uint32_t m_nMaxCount;
+	uint32_t m_nQueriesPerCycle;
+	uint64_t m_nStartTimeInMicroseconds;
+	uint64_t m_nMaxCycleTimeInMicroseconds;
+	uint32_t m_nWrites;
+	uint32_t m_nMaxWriteCount;
+	uint32_t m_nWritesPerCycle;
+
+	CSQLLoadData(const std::string& sInstanceName)
+		: m_sInstanceName(sInstanceName), m_nQueries(0), m_nMaxCount(20000), m_nQueriesPerCycle(64), m_nStartTimeInMicroseconds(0), m_nMaxCycleTimeInMicroseconds(0),
+		m_nWrites(0), m_nMaxWriteCount(2000), m_nWritesPerCycle(8)
+	{
+	}
+
+	// All writer instances update the description of the same user, so every write contends for the write connection.
+	static std::string getWriterUserName()
+	{
+		return "sqlloadwriter";
+	}
+
+	// Returns a well-formed UUID that is unique per query, so that every lookup misses and hits the database.
+	std::string createQueryUUID()
+	{
+		char pBuffer[64];
+		uint64_t nInstanceHash = std::hash<std::string>{}(m_sInstanceName) & 0xffffffffULL;
+		snprintf(pBuffer, sizeof(pBuffer), "%08x-0000-4000-8000-%012x", (uint32_t)nInstanceHash, m_nQueries);
+		return std::string(pBuffer);
+	}
+};
+
+typedef CState<CSQLLoadData> CSQLLoadState;
+
+
+/*************************************************************************************************************************
+ Class definition of CSQLLoadState_Init
+**************************************************************************************************************************/
+class CSQLLoadState_Init : public virtual CSQLLoadState {
+public:
+
+	CSQLLoadState_Init(const std::string& sStateName, PPluginData pPluginData)
+		: CSQLLoadState(getStateName(), sStateName, pPluginData)
+	{
+	}
+
+	static const std::string getStateName()
+	{
+		return "init";
+	}
+
+	void Execute(LibMCEnv::PStateEnvironment pStateEnvironment)
+	{
+		if (pStateEnvironment.get() == nullptr)
+			throw ELibMCPluginInterfaceException(LIBMCPLUGIN_ERROR_INVALIDPARAM);
+
+		m_pPluginData->m_nQueries = 0;
+		m_pPluginData->m_nMaxCycleTimeInMicroseconds = 0;
+		m_pPluginData->m_nStartTimeInMicroseconds = pStateEnvironment->GetGlobalTimerInMicroseconds();
+
+		pStateEnvironment->SetNextState("run");
+	}
+
+};
+
+
+/*************************************************************************************************************************
+ Class definition of CSQLLoadState_Run
+**************************************************************************************************************************/
+class CSQLLoadState_Run : public virtual CSQLLoadState {
+public:
+
+	CSQLLoadState_Run(const std::string& sStateName, PPluginData pPluginData)
+		: CSQLLoadState(getStateName(), sStateName, pPluginData)
+	{
+	}
+
+	static const std::string getStateName()
+	{
+		return "run";
+	}
+
+	void Execute(LibMCEnv::PStateEnvironment pStateEnvironment)
+	{
+		if (pStateEnvironment.get() == nullptr)
+			throw ELibMCPluginInterfaceException(LIBMCPLUGIN_ERROR_INVALIDPARAM);
+
+		uint64_t nCycleStartTime = pStateEnvironment->GetGlobalTimerInMicroseconds();
+
+		uint32_t nQueriesInCycle = 0;
+		while ((m_pPluginData->m_nQueries < m_pPluginData->m_nMaxCount) && (nQueriesInCycle < m_pPluginData->m_nQueriesPerCycle)) {
+			std::string sUUID = m_pPluginData->createQueryUUID();
+
+			bool bFound;
+			if (m_pPluginData->m_nQueries % 2 == 0)
+				bFound = pStateEnvironment->HasBuildJob(sUUID);
+			else
+				bFound = pStateEnvironment->HasBuildExecution(sUUID);
+
+			if (bFound) {
+				pStateEnvironment->LogWarning("unexpected database entry " + sUUID + " in " + m_pPluginData->m_sInstanceName);
+				pStateEnvironment->SetNextState("fatalerror");
+				return;
+			}
+
+			m_pPluginData->m_nQueries++;
+			nQueriesInCycle++;
+		}
+
+		uint64_t nCycleEndTime = pStateEnvironment->GetGlobalTimerInMicroseconds();
+		uint64_t nCycleTime = nCycleEndTime - nCycleStartTime;
+		if (nCycleTime > m_pPluginData->m_nMaxCycleTimeInMicroseconds)
+			m_pPluginData->m_nMaxCycleTimeInMicroseconds = nCycleTime;
+
+		if (m_pPluginData->m_nQueries >= m_pPluginData->m_nMaxCount) {
+			uint64_t nTotalTime = nCycleEndTime - m_pPluginData->m_nStartTimeInMicroseconds;
+			if (nTotalTime == 0)
+				nTotalTime = 1;
+
+			uint64_t nQueriesPerSecond = ((uint64_t)m_pPluginData->m_nQueries * 1000000ULL) / nTotalTime;
+
+			pStateEnvironment->LogMessage("Executed " + std::to_string(m_pPluginData->m_nQueries) + " queries in " + std::to_string(nTotalTime / 1000) + " ms: "
+				+ std::to_string(nQueriesPerSecond) + " queries per second, maximum cycle time " + std::to_string(m_pPluginData->m_nMaxCycleTimeInMicroseconds) + " us");
+
+			pStateEnvironment->SetNextState("success");
+			return;
+		}
+
+		pStateEnvironment->SetNextState("run");
+	}
+
+};
+
+
+/*************************************************************************************************************************
+ Class definition of CSQLLoadState_InitWriter
+**************************************************************************************************************************/
+class CSQLLoadState_InitWriter : public virtual CSQLLoadState {
+public:
+
+	CSQLLoadState_InitWriter(const std::string& sStateName, PPluginData pPluginData)
+		: CSQLLoadState(getStateName(), sStateName, pPluginData)
+	{
+	}
+
+	static const std::string getStateName()
+	{
+		return "initwriter";
+	}
+
+	void Execute(LibMCEnv::PStateEnvironment pStateEnvironment)
+	{
+		if (pStateEnvironment.get() == nullptr)
+			throw ELibMCPluginInterfaceException(LIBMCPLUGIN_ERROR_INVALIDPARAM);
+
+		auto pUserManagement = pStateEnvironment->CreateUserManagement();
+		std::string sUserName = CSQLLoadData::getWriterUserName();
+		if (!pUserManagement->UserExists(sUserName))
+			pUserManagement->CreateUser(sUserName, "operator", std::string(64, 'a'), std::string(64, 'b'), "SQL load test writer");
+
+		m_pPluginData->m_nWrites = 0;
+		m_pPluginData->m_nMaxCycleTimeInMicroseconds = 0;
+		m_pPluginData->m_nStartTimeInMicroseconds = pStateEnvironment->GetGlobalTimerInMicroseconds();
+
+		pStateEnvironment->SetNextState("write");
+	}
+
+};
+
+
+/*************************************************************************************************************************
+ Class definition of CSQLLoadState_Write
+**************************************************************************************************************************/
+class CSQLLoadState_Write : public virtual CSQLLoadState {
+public:
+
+	CSQLLoadState_Write(const std::string& sStateName, PPluginData pPluginData)
+		: CSQLLoadState(getStateName(), sStateName, pPluginData)
+	{
+	}
+
+	static const std::string getStateName()
+	{
+		return "write";
+	}
+
+	void Execute(LibMCEnv::PStateEnvironment pStateEnvironment)
+	{
+		if (pStateEnvironment.get() == nullptr)
+			throw ELibMCPluginInterfaceException(LIBMCPLUGIN_ERROR_INVALIDPARAM);
+
+		uint64_t nCycleStartTime = pStateEnvironment->GetGlobalTimerInMicroseconds();
+
+		auto pUserManagement = pStateEnvironment->CreateUserManagement();
+		std::string sUserName = CSQLLoadData::getWriterUserName();
+
+		uint32_t nWritesInCycle = 0;
+		while ((m_pPluginData->m_nWrites < m_pPluginData->m_nMaxWriteCount) && (nWritesInCycle < m_pPluginData->m_nWritesPerCycle)) {
+			pUserManagement->SetUserDescription(sUserName, "write " + std::to_string(m_pPluginData->m_nWrites) + " of " + m_pPluginData->m_sInstanceName);
+
+			m_pPluginData->m_nWrites++;
+			nWritesInCycle++;
+		}
+
+		uint64_t nCycleEndTime = pStateEnvironment->GetGlobalTimerInMicroseconds();
+		uint64_t nCycleTime = nCycleEndTime - nCycleStartTime;
+		if (nCycleTime > m_pPluginData->m_nMaxCycleTimeInMicroseconds)
+			m_pPluginData->m_nMaxCycleTimeInMicroseconds = nCycleTime;
+
+		if (m_pPluginData->m_nWrites >= m_pPluginData->m_nMaxWriteCount) {
+			uint64_t nTotalTime = nCycleEndTime - m_pPluginData->m_nStartTimeInMicroseconds;
+			if (nTotalTime == 0)
+				nTotalTime = 1;
+
+			uint64_t nWritesPerSecond = ((uint64_t)m_pPluginData->m_nWrites * 1000000ULL) / nTotalTime;
+
+			pStateEnvironment->LogMessage("Executed " + std::to_string(m_pPluginData->m_nWrites) + " writes in " + std::to_string(nTotalTime / 1000) + " ms: "
+				+ std::to_string(nWritesPerSecond) + " writes per second, maximum cycle time " + std::to_string(m_pPluginData->m_nMaxCycleTimeInMicroseconds) + " us");
+
+			pStateEnvironment->SetNextState("success");
+			return;
+		}
+
+		pStateEnvironment->SetNextState("write");
+	}
+
+};
+
+
+/*************************************************************************************************************************
+ Class definition of CSQLLoadState_Success
+**************************************************************************************************************************/
+class CSQLLoadState_Success : public virtual CSQLLoadState {
+public:
+
+	CSQLLoadState_Success(const std::string& sStateName, PPluginData pPluginData)
+		: CSQLLoadState(getStateName(), sStateName, pPluginData)
+	{
+	}
+
+	static const std::string getStateName()
+	{
+		return "success";
+	}
+
+	void Execute(LibMCEnv::PStateEnvironment pStateEnvironment)
+	{
+		if (pStateEnvironment.get() == nullptr)
+			throw ELibMCPluginInterfaceException(LIBMCPLUGIN_ERROR_INVALIDPARAM);
+
+		pStateEnvironment->SetNextState("success");
+	}
+
+};
+
+
+/*************************************************************************************************************************
+ Class definition of CSQLLoadState_FatalError
+**************************************************************************************************************************/
+class CSQLLoadState_FatalError : public virtual CSQLLoadState {
+public:
+
+	CSQLLoadState_FatalError(const std::string& sStateName, PPluginData pPluginData)
+		: CSQLLoadState(getStateName(), sStateName, pPluginData)
+	{
+	}
+
+	static const std::string getStateName()
+	{
+		return "fatalerror";
+	}
+
+	void Execute(LibMCEnv::PStateEnvironment pStateEnvironment)
+	{
+		if (pStateEnvironment.get() == nullptr)
+			throw ELibMCPluginInterfaceException(LIBMCPLUGIN_ERROR_INVALIDPARAM);
+
+		pStateEnvironment->SetNextState("fatalerror");
+	}
+
+};
+
+
+/*************************************************************************************************************************
+ Class definition of CStateFactory
+**************************************************************************************************************************/
+
+CStateFactory::CStateFactory(const std::string& sInstanceName)
+{
+	m_pPluginData = std::make_shared<CSQLLoadData>(sInstanceName);
+}
+
+IState* CStateFactory::CreateState(const std::string& sStateName)
+{
+
+	IState* pStateInstance = nullptr;
+
+	if (createStateInstanceByName<CSQLLoadState_Init>(sStateName, pStateInstance, m_pPluginData))
+		return pStateInstance;
+
+	if (createStateInstanceByName<CSQLLoadState_Run>(sStateName, pStateInstance, m_pPluginData))
+		return pStateInstance;
+
+	if (createStateInstanceByName<CSQLLoadState_InitWriter>(sStateName, pStateInstance, m_pPluginData))
+		return pStateInstance;
+
+	if (createStateInstanceByName<CSQLLoadState_Write>(sStateName, pStateInstance, m_pPluginData))
+		return pStateInstance;
+
+	if (createStateInstanceByName<CSQLLoadState_Success>(sStateName, pStateInstance, m_pPluginData))
+		return pStateInstance;
+
+	if (createStateInstanceByName<CSQLLoadState_FatalError>(sStateName, pStateInstance, m_pPluginData))
+		return pStateInstance;
+
+	throw ELibMCPluginInterfaceException(LIBMCPLUGIN_ERROR_INVALIDSTATENAME);
+
+}
@@ -0,0 +1,275 @@
+/*++
+
+Copyright (C) 2020 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "libmcplugin_impl.hpp"
+#include "libmcdriver_scanlab_dynamic.hpp"
+
+using namespace LibMCPlugin::Impl;
+
+#include <chrono>
+
+#define SCANLABRTCBENCHMARK_SERIALNUMBER 123456
+
+
+/*************************************************************************************************************************
+ Import functionality for Driver into current plugin
+**************************************************************************************************************************/
+LIBMC_IMPORTDRIVERCLASSES(ScanLab, ScanLab_RTC6)
+
+
+/*************************************************************************************************************************
+ Class definition of CTestData
+**************************************************************************************************************************/
+class CTestData : public virtual CPluginData {
+protected:
+	// We need to globally store driver wrappers in the plugin
+	PDriverCast_ScanLab_RTC6 m_DriverCast_ScanLab_RTC6;
+
+public:
+
+	PDriver_ScanLab_RTC6 acquireRTC6(LibMCEnv::PStateEnvironment pStateEnvironment)
+	{
+		return m_DriverCast_ScanLab_RTC6.acquireDriver(pStateEnvironment, "scanlab_rtc6");
+	}
+
+};
+
+/*************************************************************************************************************************
+ Class definition of CTestState
+**************************************************************************************************************************/
+typedef CState<CTestData> CTestState;
+
+
+/*************************************************************************************************************************
+ Class definition of CTestState_Init
+**************************************************************************************************************************/
+class CTestState_Init : public virtual CTestState {
+public:
+
+	CTestState_Init(const std::string& sStateName, PPluginData pPluginData)
+		: CTestState(getStateName(), sStateName, pPluginData)
+	{
+	}
+
+	static const std::string getStateName()
+	{
+		return "init";
+	}
+
+	static double getElapsedMilliseconds(const std::chrono::high_resolution_clock::time_point& startTime)
+	{
+		auto duration = std::chrono::high_resolution_clock::now() - startTime;
+		return (double)std::chrono::duration_cast<std::chrono::microseconds> (duration).count() / 1000.0;
+	}
+
+	void Execute(LibMCEnv::PStateEnvironment pStateEnvironment)
+	{
+		if (pStateEnvironment.get() == nullptr)
+			throw ELibMCPluginInterfaceException(LIBMCPLUGIN_ERROR_INVALIDPARAM);
+
+		std::string sSDKResource = pStateEnvironment->GetStringParameter("benchmark", "sdkresource");
+		std::string sBuildUUID = pStateEnvironment->GetUUIDParameter("benchmark", "builduuid");
+		uint32_t nRepetitions = (uint32_t)pStateEnvironment->GetIntegerParameter("benchmark", "repetitions");
+		bool bExecuteList = pStateEnvironment->GetBoolParameter("benchmark", "executelist");
+
+		if (nRepetitions == 0)
+			throw ELibMCPluginInterfaceException(LIBMCPLUGIN_ERROR_INVALIDPARAM);
+
+		pStateEnvironment->LogMessage("Loading simulated RTC6 SDK resource " + sSDKResource);
+		auto pRTC6Driver = m_pPluginData->acquireRTC6(pStateEnvironment);
+		pRTC6Driver->LoadSDK(sSDKResource);
+		pRTC6Driver->Initialise("", "", 1000, SCANLABRTCBENCHMARK_SERIALNUMBER);
+
+		// The simulated card accepts any correction data and reports a fixed bits per mm factor
+		std::vector<uint8_t> CorrectionFileBuffer(16, 0);
+		pRTC6Driver->SetCorrectionFile(CorrectionFileBuffer, 1, 2, 1, 0);
+		pRTC6Driver->ConfigureLaserMode(LibMCDriver_ScanLab::eLaserMode::YAG1, LibMCDriver_ScanLab::eLaserPort::Port12BitAnalog1, 400.0, false, false, true, true, false, false);
+		pRTC6Driver->ConfigureDelays(100.0, 100.0, 10.0, 10.0, 10.0);
+
+		auto pRTCContext = pRTC6Driver->GetContext();
+
+		// The build job is stored by the test runner from the build node of the test definition
+		pStateEnvironment->LogMessage("Loading toolpath of build job " + sBuildUUID);
+		auto pBuildJob = pStateEnvironment->GetBuildJob(sBuildUUID);
+		pBuildJob->LoadToolpath();
+		auto pToolpath = pBuildJob->CreateToolpathAccessor();
+
+		// Layers are loaded upfront, so that only the list building is timed
+		uint32_t nLayerCount = pToolpath->GetLayerCount();
+		if (nLayerCount == 0)
+			throw ELibMCPluginInterfaceException(LIBMCPLUGIN_ERROR_INVALIDPARAM);
+
+		std::vector<LibMCEnv::PToolpathLayer> Layers;
+		uint64_t nSegmentCount = 0;
+		for (uint32_t nLayerIndex = 0; nLayerIndex < nLayerCount; nLayerIndex++) {
+			auto pLayer = pToolpath->LoadLayer(nLayerIndex);
+			nSegmentCount += pLayer->GetSegmentCount();
+			Layers.push_back(pLayer);
+		}
+
+		pStateEnvironment->LogMessage("Toolpath has " + std::to_string(nLayerCount) + " layers with " + std::to_string(nSegmentCount) + " segments");
+
+		double dTotalTime = 0.0;
+		double dMinTime = 0.0;
+		uint64_t nListCommands = 0;
+
+		for (uint32_t nRepetition = 0; nRepetition < nRepetitions; nRepetition++) {
+			double dRepetitionTime = 0.0;
+			uint64_t nRepetitionListCommands = 0;
+
+			// Each layer is built into its own list, as in a build
+			for (auto pLayer : Layers) {
+				auto startTime = std::chrono::high_resolution_clock::now();
+
+				pRTCContext->SetStartList(1, 0);
+				pRTCContext->AddLayerToList(pLayer, false);
+				pRTCContext->SetEndOfList();
+
+				dRepetitionTime += getElapsedMilliseconds(startTime);
+				nRepetitionListCommands += pRTCContext->GetInputPointer();
+			}
+
+			nListCommands = nRepetitionListCommands;
+			dTotalTime += dRepetitionTime;
+			if ((nRepetition == 0) || (dRepetitionTime < dMinTime))
+				dMinTime = dRepetitionTime;
+		}
+
+		double dAverageTime = dTotalTime / nRepetitions;
+		pStateEnvironment->LogMessage("List commands per toolpath: " + std::to_string(nListCommands));
+		pStateEnvironment->LogMessage("Average list build time per toolpath: " + std::to_string(dAverageTime) + " ms (best " + std::to_string(dMinTime) + " ms)");
+		if (dMinTime > 0.0)
+			pStateEnvironment->LogMessage("Throughput: " + std::to_string((uint64_t)(nListCommands / dMinTime * 1000.0)) + " list commands/s");
+
+		if (bExecuteList) {
+			pStateEnvironment->LogMessage("Executing last layer on simulated card...");
+			auto startTime = std::chrono::high_resolution_clock::now();
+			pRTCContext->ExecuteList(1, 0);
+
+			bool bBusy = true;
+			uint32_t nPosition = 0;
+			while (bBusy) {
+				pStateEnvironment->Sleep(10);
+				pRTCContext->GetStatus(bBusy, nPosition);
+			}
+
+			pStateEnvironment->LogMessage("Simulated execution time: " + std::to_string(getElapsedMilliseconds(startTime)) + " ms, final list position " + std::to_string(nPosition));
+		}
+
+		pStateEnvironment->SetNextState("success");
+	}
+
+};
+
+
+/*************************************************************************************************************************
+ Class definition of CTestState_Success
+**************************************************************************************************************************/
+class CTestState_Success : public virtual CTestState {
+public:
+
+	CTestState_Success(const std::string& sStateName, PPluginData pPluginData)
+		: CTestState(getStateName(), sStateName, pPluginData)
+	{
+	}
+
+	static const std::string getStateName()
+	{
+		return "success";
+	}
+
+
+	void Execute(LibMCEnv::PStateEnvironment pStateEnvironment)
+	{
+
+		pStateEnvironment->SetNextState("success");
+
+	}
+
+};
+
+
+/*************************************************************************************************************************
+ Class definition of CTestState_FatalError
+**************************************************************************************************************************/
+class CTestState_FatalError : public virtual CTestState {
+public:
+
+	CTestState_FatalError(const std::string& sStateName, PPluginData pPluginData)
+		: CTestState(getStateName(), sStateName, pPluginData)
+	{
+	}
+
+	static const std::string getStateName()
+	{
+		return "fatalerror";
+	}
+
+
+	void Execute(LibMCEnv::PStateEnvironment pStateEnvironment)
+	{
+		if (pStateEnvironment.get() == nullptr)
+			throw ELibMCPluginInterfaceException(LIBMCPLUGIN_ERROR_INVALIDPARAM);
+
+		pStateEnvironment->SetNextState("fatalerror");
+	}
+
+};
+
+
+
+/*************************************************************************************************************************
+ Class definition of CStateFactory
+**************************************************************************************************************************/
+
+CStateFactory::CStateFactory(const std::string& sInstanceName)
+{
+	m_pPluginData = std::make_shared<CTestData>();
+}
+
+IState* CStateFactory::CreateState(const std::string& sStateName)
+{
+
+	IState* pStateInstance = nullptr;
+
+	if (createStateInstanceByName<CTestState_Init>(sStateName, pStateInstance, m_pPluginData))
+		return pStateInstance;
+
+	if (createStateInstanceByName<CTestState_Success>(sStateName, pStateInstance, m_pPluginData))
+		return pStateInstance;
+
+	if (createStateInstanceByName<CTestState_FatalError>(sStateName, pStateInstance, m_pPluginData))
+		return pStateInstance;
+
+	throw ELibMCPluginInterfaceException(LIBMCPLUGIN_ERROR_INVALIDSTATENAME);
+
+}
+
+
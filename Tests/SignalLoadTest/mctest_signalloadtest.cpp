@@ -33,6 +33,9 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 using namespace LibMCPlugin::Impl;
 
 #include <stdint.h>
+#include <vector>
+#include <algorithm>
+#include <string>
 
 /*************************************************************************************************************************
  Import functionality for Driver into current plugin
@@ -53,9 +56,12 @@ public:
 	uint32_t m_nInFlight;
 	uint32_t m_nMaxCount;
 	uint32_t m_nWindowSize;
+	uint32_t m_nLatencyCount;
+	uint32_t m_nWaitTimeOutInMS;
+	std::vector<uint64_t> m_RoundTripTimes;
 
 	CSignalLoadData(const std::string& sInstanceName)
-		: m_sInstanceName(sInstanceName), m_bIsPing(sInstanceName == "ping"), m_bStarted(false), m_nSent(0), m_nReceived(0), m_nInFlight(0), m_nMaxCount(100000), m_nWindowSize(1024)
+		: m_sInstanceName(sInstanceName), m_bIsPing(sInstanceName == "ping"), m_bStarted(false), m_nSent(0), m_nReceived(0), m_nInFlight(0), m_nMaxCount(100000), m_nWindowSize(1024), m_nLatencyCount(10000), m_nWaitTimeOutInMS(10)
 	{
 	}
 };
@@ -88,6 +94,7 @@ public:
 		m_pPluginData->m_nSent = 0;
 		m_pPluginData->m_nReceived = 0;
 		m_pPluginData->m_nInFlight = 0;
+		m_pPluginData->m_RoundTripTimes.clear();
 
 		pStateEnvironment->SetNextState("run");
 	}
@@ -113,14 +120,20 @@ public:
 
 	void handlePingSignals(LibMCEnv::PStateEnvironment pStateEnvironment)
 	{
+		// Block until the first ping arrives, so that replies do not wait for the next state cycle
 		LibMCEnv::PSignalHandler pHandler;
-		while ((pHandler = pStateEnvironment->GetUnhandledSignal("signal_ping")) != nullptr) {
+		if (!pStateEnvironment->WaitForSignal("signal_ping", m_pPluginData->m_nWaitTimeOutInMS, pHandler))
+			return;
+
+		while (pHandler.get() != nullptr) {
 			int64_t nCounter = pHandler->GetInteger("counter");
 			pHandler->SignalHandled();
 
 			auto pReply = pStateEnvironment->PrepareSignal("ping", "signal_pong");
 			pReply->SetInteger("counter", nCounter);
 			pReply->Trigger();
+
+			pHandler = pStateEnvironment->GetUnhandledSignal("signal_ping");
 		}
 	}
 
@@ -172,9 +185,7 @@ public:
 			sendPingBurst(pStateEnvironment);
 
 			if ((m_pPluginData->m_nReceived >= m_pPluginData->m_nMaxCount) && (m_pPluginData->m_nInFlight == 0)) {
-				auto pStop = pStateEnvironment->PrepareSignal("pong", "signal_stop");
-				pStop->Trigger();
-				pStateEnvironment->SetNextState("success");
+				pStateEnvironment->SetNextState("latency");
 				return;
 			}
 
@@ -194,6 +205,80 @@ public:
 };
 
 
+/*************************************************************************************************************************
+ Class definition of CSignalLoadState_Latency
+**************************************************************************************************************************/
+class CSignalLoadState_Latency : public virtual CSignalLoadState {
+public:
+
+	CSignalLoadState_Latency(const std::string& sStateName, PPluginData pPluginData)
+		: CSignalLoadState(getStateName(), sStateName, pPluginData)
+	{
+	}
+
+	static const std::string getStateName()
+	{
+		return "latency";
+	}
+
+	static uint64_t getPercentile(const std::vector<uint64_t>& sortedTimes, uint32_t nPercentile)
+	{
+		if (sortedTimes.empty())
+			return 0;
+
+		size_t nIndex = ((sortedTimes.size() - 1) * nPercentile) / 100;
+		return sortedTimes.at(nIndex);
+	}
+
+	void Execute(LibMCEnv::PStateEnvironment pStateEnvironment)
+	{
+		if (pStateEnvironment.get() == nullptr)
+			throw ELibMCPluginInterfaceException(LIBMCPLUGIN_ERROR_INVALIDPARAM);
+
+		// Sequential round trips: ping triggers, waits for pong to handle the signal and for the reply to arrive.
+		auto& roundTripTimes = m_pPluginData->m_RoundTripTimes;
+		roundTripTimes.reserve(m_pPluginData->m_nLatencyCount);
+
+		for (uint32_t nIndex = 0; nIndex < m_pPluginData->m_nLatencyCount; nIndex++) {
+			uint64_t nStartTime = pStateEnvironment->GetGlobalTimerInMicroseconds();
+
+			auto pSignal = pStateEnvironment->PrepareSignal("pong", "signal_ping");
+			pSignal->SetInteger("counter", (int64_t)nIndex);
+			pSignal->Trigger();
+
+			if (!pSignal->WaitForHandling(m_pPluginData->m_nWaitTimeOutInMS * 100)) {
+				pStateEnvironment->LogWarning("ping " + std::to_string(nIndex) + " has not been handled");
+				pStateEnvironment->SetNextState("fatalerror");
+				return;
+			}
+
+			LibMCEnv::PSignalHandler pHandler;
+			if (!pStateEnvironment->WaitForSignal("signal_pong", m_pPluginData->m_nWaitTimeOutInMS * 100, pHandler)) {
+				pStateEnvironment->LogWarning("pong " + std::to_string(nIndex) + " has not been received");
+				pStateEnvironment->SetNextState("fatalerror");
+				return;
+			}
+			pHandler->SignalHandled();
+
+			roundTripTimes.push_back(pStateEnvironment->GetGlobalTimerInMicroseconds() - nStartTime);
+		}
+
+		std::sort(roundTripTimes.begin(), roundTripTimes.end());
+
+		pStateEnvironment->LogMessage("Signal round trip latency over " + std::to_string(roundTripTimes.size()) + " samples: "
+			+ "p50 " + std::to_string(getPercentile(roundTripTimes, 50)) + " us, "
+			+ "p90 " + std::to_string(getPercentile(roundTripTimes, 90)) + " us, "
+			+ "p99 " + std::to_string(getPercentile(roundTripTimes, 99)) + " us, "
+			+ "max " + std::to_string(getPercentile(roundTripTimes, 100)) + " us");
+
+		auto pStop = pStateEnvironment->PrepareSignal("pong", "signal_stop");
+		pStop->Trigger();
+		pStateEnvironment->SetNextState("success");
+	}
+
+};
+
+
 /*************************************************************************************************************************
  Class definition of CSignalLoadState_Success
 **************************************************************************************************************************/
@@ -268,6 +353,9 @@ IState* CStateFactory::CreateState(const std::string& sStateName)
 	if (createStateInstanceByName<CSignalLoadState_Run>(sStateName, pStateInstance, m_pPluginData))
 		return pStateInstance;
 
+	if (createStateInstanceByName<CSignalLoadState_Latency>(sStateName, pStateInstance, m_pPluginData))
+		return pStateInstance;
+
 	if (createStateInstanceByName<CSignalLoadState_Success>(sStateName, pStateInstance, m_pPluginData))
 		return pStateInstance;
 